@@ -0,0 +1,116 @@
+##===----------------------------------------------------------------------===//
+##
+##                             === Libarch ===
+##
+##  This  document  is the property of "Is This On?" It is considered to be
+##  confidential and proprietary and may not be, in any form, reproduced or
+##  transmitted, in whole or in part, without express permission of Is This
+##  On?.
+##
+##  Copyright (C) 2023, Is This On? Holdings Limited
+##
+##  Harry Moulton <me@h3adsh0tzz.com>
+##
+##===----------------------------------------------------------------------===//
+
+##
+##  Generates src/logical-immediates.c, which holds the decoded value of every
+##  N:immr:imms logical immediate encoding, and the inverse map from value to
+##  encoding. Re-run this if the table layout changes:
+##
+##      python3 config/logical_immediate_generator.py -o src/logical-immediates.c
+##
+
+import argparse
+
+HEADER = """//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ *  This file is generated by config/logical_immediate_generator.py. Do not
+ *  edit it by hand.
+ */
+
+#include "arm64/arm64-logical-immediates.h"
+"""
+
+def decode_bit_masks(N, immr, imms):
+    """ DecodeBitMasks() from the AArch64 Reference Manual, immediate form """
+    combined = (N << 6) | (~imms & 0x3f)
+    if combined == 0:
+        return None
+
+    length = combined.bit_length() - 1
+    if length < 1:
+        return None
+
+    levels = (1 << length) - 1
+    if (imms & levels) == levels:
+        return None
+
+    S = imms & levels
+    R = immr & levels
+    esize = 1 << length
+
+    welem = (1 << (S + 1)) - 1
+    welem = ((welem >> R) | (welem << (esize - R))) & ((1 << esize) - 1)
+
+    value = 0
+    for shift in range(0, 64, esize):
+        value |= welem << shift
+    return value
+
+def generate():
+    values = []
+    inverse = {}
+    for encoding in range(8192):
+        N, immr, imms = encoding >> 12, (encoding >> 6) & 0x3f, encoding & 0x3f
+        value = decode_bit_masks(N, immr, imms)
+
+        # Invalid encodings decode to zero, which is not a valid logical immediate
+        values.append(value or 0)
+
+        # immr bits above the element size are ignored, so keep the canonical
+        # encoding, which is the first one seen for each value
+        if value is not None:
+            inverse.setdefault(value, encoding)
+    return values, sorted(inverse.items())
+
+def write_table(fn, values, inverse):
+    out = [HEADER]
+
+    out.append("const uint64_t A64_LOGICAL_IMMEDIATES[] = {")
+    for i in range(0, len(values), 4):
+        out.append("    " + " ".join("0x%016xULL," % v for v in values[i:i + 4]))
+    out.append("};\n")
+    out.append("const uint64_t A64_LOGICAL_IMMEDIATES_LEN = sizeof (A64_LOGICAL_IMMEDIATES) / sizeof (*A64_LOGICAL_IMMEDIATES);\n")
+
+    out.append("const arm64_logical_immediate_t A64_LOGICAL_IMMEDIATE_ENCODINGS[] = {")
+    for i in range(0, len(inverse), 2):
+        out.append("    " + " ".join("{ 0x%016xULL, 0x%04x }," % e for e in inverse[i:i + 2]))
+    out.append("};\n")
+    out.append("const uint64_t A64_LOGICAL_IMMEDIATE_ENCODINGS_LEN = sizeof (A64_LOGICAL_IMMEDIATE_ENCODINGS) / sizeof (*A64_LOGICAL_IMMEDIATE_ENCODINGS);")
+
+    with open(fn, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-o", "--outfile", action="store", required=True, help="Path to the generated source file")
+    args = parser.parse_args()
+
+    values, inverse = generate()
+    write_table(args.outfile, values, inverse)
+    print("path: {}: {} encodings, {} valid".format(args.outfile, len(values), len(inverse)))
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_ALIAS_H__
+#define __LIBARCH_ALIAS_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "instruction.h"
+
+/* Most operands an instruction can have and still have an alias */
+#define LIBARCH_ALIAS_MAX_OPERANDS              8
+
+/**
+ *  \brief  Rewrite a decoded instruction into it's preferred alias, e.g.
+ *          ORR Xd, XZR, Xm becomes MOV Xd, Xm and SUBS XZR, Xn, #imm becomes
+ *          CMP Xn, #imm.
+ *
+ *          The decoders always produce the canonical instruction, and this is
+ *          run afterwards by libarch_disass_ctx unless LIBARCH_OPT_RAW is set,
+ *          or by libarch_format_instruction on a copy of a raw instruction. It
+ *          covers the general purpose data processing instructions, and works
+ *          from the opcode so it's safe to run more than once.
+ *
+ *          Operands are only ever replaced or removed, never added, so this
+ *          never allocates and works on any operand array large enough for
+ *          the canonical instruction.
+ *
+ *  \param      instr       Decoded instruction.
+ *
+ *  \return LIBARCH_RETURN_SUCCESS if the instruction was rewritten.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_alias_instruction (instruction_t *instr);
+
+
+#endif /* __libarch_alias_h__ */
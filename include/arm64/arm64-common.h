@@ -156,8 +156,8 @@ arm64_zero_extend_ones (unsigned M, unsigned N);
  * 
  */
 LIBARCH_API ARM64_COMMON
-unsigned int
-arm64_ror_extend_ones (unsigned M, unsigned N, unsigned R);
+uint64_t
+arm64_ror_zero_extend_ones (unsigned M, unsigned N, unsigned R);
 
 
 /**
@@ -171,8 +171,8 @@ arm64_ror_extend_ones (unsigned M, unsigned N, unsigned R);
  * 
  */
 LIBARCH_API ARM64_COMMON
-unsigned int
-arm64_replicate (unsigned int val, unsigned bits);
+uint64_t
+arm64_replicate (uint64_t val, unsigned bits);
 
 
 /**
@@ -180,6 +180,9 @@ arm64_replicate (unsigned int val, unsigned bits);
  *          value based on the decoded bitmask parameters. This function is 
  *          defined in the AArch64 Architecture Reference Manual.
  * 
+ *          Immediate bitmasks are read from the precomputed
+ *          A64_LOGICAL_IMMEDIATES table.
+ * 
  *  \param      immN        The 6-bit immediate value specifying the number of bits 
  *                          to set in the result bitmask.
  *  \param      imms        The 6-bit immediate value specifying the starting bit 
@@ -195,16 +198,46 @@ arm64_replicate (unsigned int val, unsigned bits);
  * 
  */
 LIBARCH_API ARM64_COMMON
-unsigned int
+int
 arm64_decode_bitmasks (unsigned immN, unsigned imms, unsigned immr, int immediate, uint64_t *newval);
 
 
 /**
+ *  \brief  Find the N, immr and imms fields that encode `imm` as a logical
+ *          immediate. This is the inverse of arm64_decode_bitmasks, and is
+ *          a binary search of A64_LOGICAL_IMMEDIATE_ENCODINGS.
+ * 
+ *  \param      imm         Value to encode. For 32-bit forms only the low
+ *                          32 bits are used.
+ *  \param      size        Register width, 32 or 64.
+ *  \param      immN        Set to the N field.
+ *  \param      immr        Set to the immr field.
+ *  \param      imms        Set to the imms field.
+ * 
+ *  \return Returns 0 if success, or -1 if `imm` cannot be encoded.
  * 
  */
 LIBARCH_API ARM64_COMMON
 int
-arm64_move_wide_preferred (unsigned int sf, unsigned int immN, unsigned int immr, unsigned int imms);
+arm64_encode_bitmasks (uint64_t imm, unsigned size, unsigned *immN, unsigned *immr, unsigned *imms);
+
+
+/**
+ *  \brief  Determine whether a logical immediate ORR with the zero register
+ *          is better printed as MOVZ/MOVN than as MOV (bitmask immediate).
+ *          Based on MoveWidePreferred() from the AArch64 Reference Manual.
+ * 
+ *  \param      sf          Register width, 1 for 64-bit.
+ *  \param      immN        The N field.
+ *  \param      imms        The imms field.
+ *  \param      immr        The immr field.
+ * 
+ *  \return Returns 1 if a move wide instruction can encode the value.
+ * 
+ */
+LIBARCH_API ARM64_COMMON
+int
+arm64_move_wide_preferred (unsigned int sf, unsigned int immN, unsigned int imms, unsigned int immr);
 
 
 /**
@@ -263,6 +296,16 @@ int
 arm64_bfx_preferred (unsigned sf, unsigned uns, unsigned imms, unsigned immr);
 
 
+/**
+ *  \brief  Expand an 8-bit floating-point immediate (VFPExpandImm) to the bit
+ *          pattern of the equivalent double. The value is exact in every
+ *          precision, so a double is used regardless of the register width.
+ */
+LIBARCH_API ARM64_COMMON
+uint64_t
+arm64_fp_expand_imm (unsigned imm8);
+
+
 int 
 SysOp (unsigned op1, unsigned CRn, unsigned CRm, unsigned op2);
 
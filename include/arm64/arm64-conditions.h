@@ -17,6 +17,9 @@
 #define __LIBARCH_ARM64_CONDITIONS_H__
 
 #include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
 
 /******************************************************************************
 *       General Branch Conditions
@@ -50,17 +53,12 @@ typedef enum arm64_cond_t
 /**
  *  \brief  String representation for each Branch Condition. 
  */
-static const char *A64_CONDITIONS_STR[] =
-{
-    "eq", "ne", "hs", "lo", "mi", "pl",
-    "vs", "vc", "hi", "ls", "ge", "lt",
-    "gt", "le", "al", "nv",
-};
+LIBARCH_EXPORT const char *const A64_CONDITIONS_STR[];
 
 /**
  *  \brief  Length of the A64_CONDITIONS_STR array.
  */
-static uint64_t A64_CONDITIONS_STR_LEN = sizeof (A64_CONDITIONS_STR) / sizeof (*A64_CONDITIONS_STR);
+LIBARCH_EXPORT const uint64_t A64_CONDITIONS_STR_LEN;
 
 /******************************************************************************
 *       Memory Barrier Conditions
@@ -69,16 +67,11 @@ static uint64_t A64_CONDITIONS_STR_LEN = sizeof (A64_CONDITIONS_STR) / sizeof (*
 /**
  *  \brief  String representation for each Memory Barrier Condition. 
  */
-static const char *A64_MEM_BARRIER_CONDITIONS_STR[] =
-{
-    "#0x0", "oshld", "oshst", "osh", "#0x4",
-    "nshld", "nshst", "nsh", "#0x8", "ishld", 
-    "ishst", "ish", "#0xb", "ld", "st", "sy",
-};
+LIBARCH_EXPORT const char *const A64_MEM_BARRIER_CONDITIONS_STR[];
 
 /**
  *  \brief  Length of the A64_MEM_BARRIER_CONDITIONS_STR array.
  */
-static uint64_t A64_MEM_BARRIER_CONDITIONS_STR_LEN = sizeof (A64_MEM_BARRIER_CONDITIONS_STR) / sizeof (*A64_MEM_BARRIER_CONDITIONS_STR);
+LIBARCH_EXPORT const uint64_t A64_MEM_BARRIER_CONDITIONS_STR_LEN;
 
 #endif /* __libarch_arm64_conditions_h__ */
\ No newline at end of file
@@ -17,19 +17,29 @@
 #define __LIBARCH_ARM64_INDEX_EXTEND_H__
 
 #include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
 
 /**
  *  \brief  AArch64 Index Extend Specifier
  * 
  *          ** Type **
- *           - UXTW
- *           - SXTW
- *           - SXTX
+ *           - UXTB, UXTH, UXTW, UXTX
+ *           - SXTB, SXTH, SXTW, SXTX
  * 
- *          Index shift amount can be either 0 or 1.
+ *          The value is the `option` field of the encoding. Register offset
+ *          loads and stores only allow UXTW, SXTW and SXTX, with option 3
+ *          meaning LSL, while the extended register forms of add/sub allow
+ *          all eight.
  */
 enum {
+    ARM64_INDEX_EXTEND_UXTB = 0,
+    ARM64_INDEX_EXTEND_UXTH = 1,
     ARM64_INDEX_EXTEND_UXTW = 2,
+    ARM64_INDEX_EXTEND_UXTX = 3,
+    ARM64_INDEX_EXTEND_SXTB = 4,
+    ARM64_INDEX_EXTEND_SXTH = 5,
     ARM64_INDEX_EXTEND_SXTW = 6,
     ARM64_INDEX_EXTEND_SXTX = 7,
 };
@@ -38,15 +48,12 @@ enum {
  *  \brief  String representations of the Index Extend Specifiers.
  * 
  */
-static const char *A64_INDEX_EXTEND_STR[] =
-{
-    "#0", "#0", "uxtw", "#0", "#0", "#0", "sxtw", "sxtx",
-};
+LIBARCH_EXPORT const char *const A64_INDEX_EXTEND_STR[];
 
 /**
  *  \brief  Length of the A64_INDEX_EXTEND_STR array.
 */
-static uint64_t A64_INDEX_EXTEND_LEN = sizeof (A64_INDEX_EXTEND_STR) / sizeof (*A64_INDEX_EXTEND_STR);
+LIBARCH_EXPORT const uint64_t A64_INDEX_EXTEND_LEN;
 
 
 
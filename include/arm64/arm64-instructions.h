@@ -16,6 +16,10 @@
 #ifndef __LIBARCH_ARM64_INSTRUCTIONS_H__
 #define __LIBARCH_ARM64_INSTRUCTIONS_H__
 
+#include <stdint.h>
+
+#include "libarch.h"
+
 /* Instruction Decode Groups */
 #define ARM64_DECODE_GROUP_RESERVED                         0
 #define ARM64_DECODE_GROUP_UNKNOWN                          1
@@ -24,6 +28,7 @@
 #define ARM64_DECODE_GROUP_DATA_PROCESS_FLOATING            4
 #define ARM64_DECODE_GROUP_BRANCH_EXCEPTION_SYSREG          5
 #define ARM64_DECODE_GROUP_LOAD_AND_STORE                   6
+#define ARM64_DECODE_GROUP_SVE                              7
 
 /* Data Processing Subgroups */
 #define ARM64_DECODE_SUBGROUP_UNKNOWN                       0
@@ -36,6 +41,18 @@
 #define ARM64_DECODE_SUBGROUP_BITFIELD                      6
 #define ARM64_DECODE_SUBGROUP_EXTRACT                       7
 
+#define ARM64_DECODE_SUBGROUP_DATA_PROCESSING_2_SOURCE          1
+#define ARM64_DECODE_SUBGROUP_DATA_PROCESSING_1_SOURCE          2
+#define ARM64_DECODE_SUBGROUP_LOGICAL_SHIFTED_REGISTER          3
+#define ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_SHIFTED_REGISTER     4
+#define ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_EXTENDED_REGISTER    5
+#define ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_WITH_CARRY           6
+#define ARM64_DECODE_SUBGROUP_ROTATE_RIGHT_INTO_FLAGS           7
+#define ARM64_DECODE_SUBGROUP_EVALUATE_INTO_FLAGS               8
+#define ARM64_DECODE_SUBGROUP_CONDITIONAL_COMPARE               9
+#define ARM64_DECODE_SUBGROUP_CONDITIONAL_SELECT                10
+#define ARM64_DECODE_SUBGROUP_DATA_PROCESSING_3_SOURCE          11
+
 #define ARM64_DECODE_SUBGROUP_CONDITIONAL_BRANCH                1
 #define ARM64_DECODE_SUBGROUP_EXCEPTION_GENERATION              2
 #define ARM64_DECODE_SUBGROUP_SYS_INSTRUCTION_WITH_REGISTER     3    
@@ -59,6 +76,48 @@
 #define ARM64_DECODE_SUBGROUP_LOAD_REGISTER_LITERAL                     8
 #define ARM64_DECODE_SUBGROUP_LOAD_REGISTER_PAIR                        9
 #define ARM64_DECODE_SUBGROUP_LOAD_REGISTER                             10
+#define ARM64_DECODE_SUBGROUP_COMPARE_AND_SWAP                          11
+#define ARM64_DECODE_SUBGROUP_ATOMIC_MEMORY_OPERATION                   12
+#define ARM64_DECODE_SUBGROUP_LOAD_STORE_RCPC_UNSCALED                  13
+#define ARM64_DECODE_SUBGROUP_MEMORY_COPY_SET                           14
+
+#define ARM64_DECODE_SUBGROUP_FP_CONVERT_FIXED                  1
+#define ARM64_DECODE_SUBGROUP_FP_CONVERT_INTEGER                2
+#define ARM64_DECODE_SUBGROUP_FP_DATA_PROCESSING_1_SOURCE       3
+#define ARM64_DECODE_SUBGROUP_FP_COMPARE                        4
+#define ARM64_DECODE_SUBGROUP_FP_IMMEDIATE                      5
+#define ARM64_DECODE_SUBGROUP_FP_CONDITIONAL_COMPARE            6
+#define ARM64_DECODE_SUBGROUP_FP_DATA_PROCESSING_2_SOURCE       7
+#define ARM64_DECODE_SUBGROUP_FP_CONDITIONAL_SELECT             8
+#define ARM64_DECODE_SUBGROUP_FP_DATA_PROCESSING_3_SOURCE       9
+#define ARM64_DECODE_SUBGROUP_SIMD_THREE_SAME                   10
+#define ARM64_DECODE_SUBGROUP_SIMD_THREE_DIFFERENT              11
+#define ARM64_DECODE_SUBGROUP_SIMD_TWO_REGISTER_MISC            12
+#define ARM64_DECODE_SUBGROUP_SIMD_ACROSS_LANES                 13
+#define ARM64_DECODE_SUBGROUP_SIMD_COPY                         14
+#define ARM64_DECODE_SUBGROUP_SIMD_MODIFIED_IMMEDIATE           15
+#define ARM64_DECODE_SUBGROUP_SIMD_SHIFT_IMMEDIATE              16
+#define ARM64_DECODE_SUBGROUP_SIMD_INDEXED_ELEMENT              17
+#define ARM64_DECODE_SUBGROUP_SIMD_PERMUTE                      18
+#define ARM64_DECODE_SUBGROUP_SIMD_EXTRACT                      19
+#define ARM64_DECODE_SUBGROUP_SIMD_TABLE_LOOKUP                 20
+#define ARM64_DECODE_SUBGROUP_SIMD_SCALAR_PAIRWISE              21
+#define ARM64_DECODE_SUBGROUP_CRYPTO_AES                        22
+#define ARM64_DECODE_SUBGROUP_CRYPTO_SHA_THREE_REGISTER         23
+#define ARM64_DECODE_SUBGROUP_CRYPTO_SHA_TWO_REGISTER           24
+#define ARM64_DECODE_SUBGROUP_SIMD_THREE_SAME_EXTRA             25
+#define ARM64_DECODE_SUBGROUP_SIMD_TWO_REGISTER_MISC_FP16       26
+
+#define ARM64_DECODE_SUBGROUP_SVE_INTEGER_PREDICATED            1
+#define ARM64_DECODE_SUBGROUP_SVE_INTEGER_UNPREDICATED          2
+#define ARM64_DECODE_SUBGROUP_SVE_STACK_ALLOCATION              3
+#define ARM64_DECODE_SUBGROUP_SVE_ELEMENT_COUNT                 4
+#define ARM64_DECODE_SUBGROUP_SVE_PREDICATE                     5
+#define ARM64_DECODE_SUBGROUP_SVE_WHILE                         6
+#define ARM64_DECODE_SUBGROUP_SVE_COMPARE                       7
+#define ARM64_DECODE_SUBGROUP_SVE_PERMUTE                       8
+#define ARM64_DECODE_SUBGROUP_SVE_FLOATING_POINT                9
+#define ARM64_DECODE_SUBGROUP_SVE_MEMORY                        10
 
 /**
  *  NOTE:   This header contains definitions of arm64 instructions. The actual
@@ -850,797 +909,309 @@ typedef enum arm64_instr_t
     ARM64_INSTRUCTION_WFIT,
     ARM64_INSTRUCTION_DGH,
     ARM64_INSTRUCTION_TCOMMIT,
+
+    /* SVE */
+    ARM64_INSTRUCTION_ADDPL,
+    ARM64_INSTRUCTION_ADDVL,
+    ARM64_INSTRUCTION_ANDV,
+    ARM64_INSTRUCTION_ASRD,
+    ARM64_INSTRUCTION_ASRR,
+    ARM64_INSTRUCTION_CMPEQ,
+    ARM64_INSTRUCTION_CMPGE,
+    ARM64_INSTRUCTION_CMPGT,
+    ARM64_INSTRUCTION_CMPHI,
+    ARM64_INSTRUCTION_CMPHS,
+    ARM64_INSTRUCTION_CMPLE,
+    ARM64_INSTRUCTION_CMPLO,
+    ARM64_INSTRUCTION_CMPLS,
+    ARM64_INSTRUCTION_CMPLT,
+    ARM64_INSTRUCTION_CMPNE,
+    ARM64_INSTRUCTION_CNOT,
+    ARM64_INSTRUCTION_CNTB,
+    ARM64_INSTRUCTION_CNTD,
+    ARM64_INSTRUCTION_CNTH,
+    ARM64_INSTRUCTION_CNTP,
+    ARM64_INSTRUCTION_CNTW,
+    ARM64_INSTRUCTION_DECB,
+    ARM64_INSTRUCTION_DECD,
+    ARM64_INSTRUCTION_DECH,
+    ARM64_INSTRUCTION_DECW,
+    ARM64_INSTRUCTION_EORS,
+    ARM64_INSTRUCTION_EORV,
+    ARM64_INSTRUCTION_FADDV,
+    ARM64_INSTRUCTION_FCMNE,
+    ARM64_INSTRUCTION_FCMUO,
+    ARM64_INSTRUCTION_FDIVR,
+    ARM64_INSTRUCTION_FMAD,
+    ARM64_INSTRUCTION_FMSB,
+    ARM64_INSTRUCTION_FNMAD,
+    ARM64_INSTRUCTION_FNMLA,
+    ARM64_INSTRUCTION_FNMLS,
+    ARM64_INSTRUCTION_FNMSB,
+    ARM64_INSTRUCTION_FSCALE,
+    ARM64_INSTRUCTION_FSUBR,
+    ARM64_INSTRUCTION_FTSMUL,
+    ARM64_INSTRUCTION_INCB,
+    ARM64_INSTRUCTION_INCD,
+    ARM64_INSTRUCTION_INCH,
+    ARM64_INSTRUCTION_INCW,
+    ARM64_INSTRUCTION_INDEX,
+    ARM64_INSTRUCTION_LD1B,
+    ARM64_INSTRUCTION_LD1D,
+    ARM64_INSTRUCTION_LD1H,
+    ARM64_INSTRUCTION_LD1SB,
+    ARM64_INSTRUCTION_LD1SH,
+    ARM64_INSTRUCTION_LD1SW,
+    ARM64_INSTRUCTION_LD1W,
+    ARM64_INSTRUCTION_LD2B,
+    ARM64_INSTRUCTION_LD2D,
+    ARM64_INSTRUCTION_LD2H,
+    ARM64_INSTRUCTION_LD2W,
+    ARM64_INSTRUCTION_LD3B,
+    ARM64_INSTRUCTION_LD3D,
+    ARM64_INSTRUCTION_LD3H,
+    ARM64_INSTRUCTION_LD3W,
+    ARM64_INSTRUCTION_LD4B,
+    ARM64_INSTRUCTION_LD4D,
+    ARM64_INSTRUCTION_LD4H,
+    ARM64_INSTRUCTION_LD4W,
+    ARM64_INSTRUCTION_LDFF1B,
+    ARM64_INSTRUCTION_LDFF1D,
+    ARM64_INSTRUCTION_LDFF1H,
+    ARM64_INSTRUCTION_LDFF1SB,
+    ARM64_INSTRUCTION_LDFF1SH,
+    ARM64_INSTRUCTION_LDFF1SW,
+    ARM64_INSTRUCTION_LDFF1W,
+    ARM64_INSTRUCTION_LDNF1B,
+    ARM64_INSTRUCTION_LDNF1D,
+    ARM64_INSTRUCTION_LDNF1H,
+    ARM64_INSTRUCTION_LDNF1SB,
+    ARM64_INSTRUCTION_LDNF1SH,
+    ARM64_INSTRUCTION_LDNF1SW,
+    ARM64_INSTRUCTION_LDNF1W,
+    ARM64_INSTRUCTION_LDNT1B,
+    ARM64_INSTRUCTION_LDNT1D,
+    ARM64_INSTRUCTION_LDNT1H,
+    ARM64_INSTRUCTION_LDNT1W,
+    ARM64_INSTRUCTION_LSLR,
+    ARM64_INSTRUCTION_LSRR,
+    ARM64_INSTRUCTION_MAD,
+    ARM64_INSTRUCTION_MOVPRFX,
+    ARM64_INSTRUCTION_MOVS,
+    ARM64_INSTRUCTION_MSB,
+    ARM64_INSTRUCTION_NAND,
+    ARM64_INSTRUCTION_NANDS,
+    ARM64_INSTRUCTION_NOR,
+    ARM64_INSTRUCTION_NORS,
+    ARM64_INSTRUCTION_NOTS,
+    ARM64_INSTRUCTION_ORNS,
+    ARM64_INSTRUCTION_ORRS,
+    ARM64_INSTRUCTION_ORV,
+    ARM64_INSTRUCTION_PFALSE,
+    ARM64_INSTRUCTION_PTEST,
+    ARM64_INSTRUCTION_PTRUE,
+    ARM64_INSTRUCTION_PTRUES,
+    ARM64_INSTRUCTION_RDVL,
+    ARM64_INSTRUCTION_SADDV,
+    ARM64_INSTRUCTION_SDIVR,
+    ARM64_INSTRUCTION_SEL,
+    ARM64_INSTRUCTION_ST1B,
+    ARM64_INSTRUCTION_ST1D,
+    ARM64_INSTRUCTION_ST1H,
+    ARM64_INSTRUCTION_ST1W,
+    ARM64_INSTRUCTION_ST2B,
+    ARM64_INSTRUCTION_ST2D,
+    ARM64_INSTRUCTION_ST2H,
+    ARM64_INSTRUCTION_ST2W,
+    ARM64_INSTRUCTION_ST3B,
+    ARM64_INSTRUCTION_ST3D,
+    ARM64_INSTRUCTION_ST3H,
+    ARM64_INSTRUCTION_ST3W,
+    ARM64_INSTRUCTION_ST4B,
+    ARM64_INSTRUCTION_ST4D,
+    ARM64_INSTRUCTION_ST4H,
+    ARM64_INSTRUCTION_ST4W,
+    ARM64_INSTRUCTION_STNT1B,
+    ARM64_INSTRUCTION_STNT1D,
+    ARM64_INSTRUCTION_STNT1H,
+    ARM64_INSTRUCTION_STNT1W,
+    ARM64_INSTRUCTION_SUBR,
+    ARM64_INSTRUCTION_UADDV,
+    ARM64_INSTRUCTION_UDIVR,
+    ARM64_INSTRUCTION_UXTW,
+    ARM64_INSTRUCTION_WHILEGE,
+    ARM64_INSTRUCTION_WHILEGT,
+    ARM64_INSTRUCTION_WHILEHI,
+    ARM64_INSTRUCTION_WHILEHS,
+    ARM64_INSTRUCTION_WHILELE,
+    ARM64_INSTRUCTION_WHILELO,
+    ARM64_INSTRUCTION_WHILELS,
+    ARM64_INSTRUCTION_WHILELT,
+
+    /* SVE2 widening integer arithmetic and histogram */
+    ARM64_INSTRUCTION_HISTCNT,
+    ARM64_INSTRUCTION_SABDLB,
+    ARM64_INSTRUCTION_SABDLT,
+    ARM64_INSTRUCTION_SADDLB,
+    ARM64_INSTRUCTION_SADDLT,
+    ARM64_INSTRUCTION_SMLALB,
+    ARM64_INSTRUCTION_SMLALT,
+    ARM64_INSTRUCTION_SMLSLB,
+    ARM64_INSTRUCTION_SMLSLT,
+    ARM64_INSTRUCTION_SMULLB,
+    ARM64_INSTRUCTION_SMULLT,
+    ARM64_INSTRUCTION_SQDMULLB,
+    ARM64_INSTRUCTION_SQDMULLT,
+    ARM64_INSTRUCTION_SSUBLB,
+    ARM64_INSTRUCTION_SSUBLT,
+    ARM64_INSTRUCTION_UABDLB,
+    ARM64_INSTRUCTION_UABDLT,
+    ARM64_INSTRUCTION_UADDLB,
+    ARM64_INSTRUCTION_UADDLT,
+    ARM64_INSTRUCTION_UMLALB,
+    ARM64_INSTRUCTION_UMLALT,
+    ARM64_INSTRUCTION_UMLSLB,
+    ARM64_INSTRUCTION_UMLSLT,
+    ARM64_INSTRUCTION_UMULLB,
+    ARM64_INSTRUCTION_UMULLT,
+    ARM64_INSTRUCTION_USUBLB,
+    ARM64_INSTRUCTION_USUBLT,
+
+    /* Memory Copy and Memory Set, in encoding order */
+    ARM64_INSTRUCTION_CPYFP,
+    ARM64_INSTRUCTION_CPYFPWT,
+    ARM64_INSTRUCTION_CPYFPRT,
+    ARM64_INSTRUCTION_CPYFPT,
+    ARM64_INSTRUCTION_CPYFPWN,
+    ARM64_INSTRUCTION_CPYFPWTWN,
+    ARM64_INSTRUCTION_CPYFPRTWN,
+    ARM64_INSTRUCTION_CPYFPTWN,
+    ARM64_INSTRUCTION_CPYFPRN,
+    ARM64_INSTRUCTION_CPYFPWTRN,
+    ARM64_INSTRUCTION_CPYFPRTRN,
+    ARM64_INSTRUCTION_CPYFPTRN,
+    ARM64_INSTRUCTION_CPYFPN,
+    ARM64_INSTRUCTION_CPYFPWTN,
+    ARM64_INSTRUCTION_CPYFPRTN,
+    ARM64_INSTRUCTION_CPYFPTN,
+    ARM64_INSTRUCTION_CPYFM,
+    ARM64_INSTRUCTION_CPYFMWT,
+    ARM64_INSTRUCTION_CPYFMRT,
+    ARM64_INSTRUCTION_CPYFMT,
+    ARM64_INSTRUCTION_CPYFMWN,
+    ARM64_INSTRUCTION_CPYFMWTWN,
+    ARM64_INSTRUCTION_CPYFMRTWN,
+    ARM64_INSTRUCTION_CPYFMTWN,
+    ARM64_INSTRUCTION_CPYFMRN,
+    ARM64_INSTRUCTION_CPYFMWTRN,
+    ARM64_INSTRUCTION_CPYFMRTRN,
+    ARM64_INSTRUCTION_CPYFMTRN,
+    ARM64_INSTRUCTION_CPYFMN,
+    ARM64_INSTRUCTION_CPYFMWTN,
+    ARM64_INSTRUCTION_CPYFMRTN,
+    ARM64_INSTRUCTION_CPYFMTN,
+    ARM64_INSTRUCTION_CPYFE,
+    ARM64_INSTRUCTION_CPYFEWT,
+    ARM64_INSTRUCTION_CPYFERT,
+    ARM64_INSTRUCTION_CPYFET,
+    ARM64_INSTRUCTION_CPYFEWN,
+    ARM64_INSTRUCTION_CPYFEWTWN,
+    ARM64_INSTRUCTION_CPYFERTWN,
+    ARM64_INSTRUCTION_CPYFETWN,
+    ARM64_INSTRUCTION_CPYFERN,
+    ARM64_INSTRUCTION_CPYFEWTRN,
+    ARM64_INSTRUCTION_CPYFERTRN,
+    ARM64_INSTRUCTION_CPYFETRN,
+    ARM64_INSTRUCTION_CPYFEN,
+    ARM64_INSTRUCTION_CPYFEWTN,
+    ARM64_INSTRUCTION_CPYFERTN,
+    ARM64_INSTRUCTION_CPYFETN,
+    ARM64_INSTRUCTION_CPYP,
+    ARM64_INSTRUCTION_CPYPWT,
+    ARM64_INSTRUCTION_CPYPRT,
+    ARM64_INSTRUCTION_CPYPT,
+    ARM64_INSTRUCTION_CPYPWN,
+    ARM64_INSTRUCTION_CPYPWTWN,
+    ARM64_INSTRUCTION_CPYPRTWN,
+    ARM64_INSTRUCTION_CPYPTWN,
+    ARM64_INSTRUCTION_CPYPRN,
+    ARM64_INSTRUCTION_CPYPWTRN,
+    ARM64_INSTRUCTION_CPYPRTRN,
+    ARM64_INSTRUCTION_CPYPTRN,
+    ARM64_INSTRUCTION_CPYPN,
+    ARM64_INSTRUCTION_CPYPWTN,
+    ARM64_INSTRUCTION_CPYPRTN,
+    ARM64_INSTRUCTION_CPYPTN,
+    ARM64_INSTRUCTION_CPYM,
+    ARM64_INSTRUCTION_CPYMWT,
+    ARM64_INSTRUCTION_CPYMRT,
+    ARM64_INSTRUCTION_CPYMT,
+    ARM64_INSTRUCTION_CPYMWN,
+    ARM64_INSTRUCTION_CPYMWTWN,
+    ARM64_INSTRUCTION_CPYMRTWN,
+    ARM64_INSTRUCTION_CPYMTWN,
+    ARM64_INSTRUCTION_CPYMRN,
+    ARM64_INSTRUCTION_CPYMWTRN,
+    ARM64_INSTRUCTION_CPYMRTRN,
+    ARM64_INSTRUCTION_CPYMTRN,
+    ARM64_INSTRUCTION_CPYMN,
+    ARM64_INSTRUCTION_CPYMWTN,
+    ARM64_INSTRUCTION_CPYMRTN,
+    ARM64_INSTRUCTION_CPYMTN,
+    ARM64_INSTRUCTION_CPYE,
+    ARM64_INSTRUCTION_CPYEWT,
+    ARM64_INSTRUCTION_CPYERT,
+    ARM64_INSTRUCTION_CPYET,
+    ARM64_INSTRUCTION_CPYEWN,
+    ARM64_INSTRUCTION_CPYEWTWN,
+    ARM64_INSTRUCTION_CPYERTWN,
+    ARM64_INSTRUCTION_CPYETWN,
+    ARM64_INSTRUCTION_CPYERN,
+    ARM64_INSTRUCTION_CPYEWTRN,
+    ARM64_INSTRUCTION_CPYERTRN,
+    ARM64_INSTRUCTION_CPYETRN,
+    ARM64_INSTRUCTION_CPYEN,
+    ARM64_INSTRUCTION_CPYEWTN,
+    ARM64_INSTRUCTION_CPYERTN,
+    ARM64_INSTRUCTION_CPYETN,
+    ARM64_INSTRUCTION_SETP,
+    ARM64_INSTRUCTION_SETPT,
+    ARM64_INSTRUCTION_SETPN,
+    ARM64_INSTRUCTION_SETPTN,
+    ARM64_INSTRUCTION_SETM,
+    ARM64_INSTRUCTION_SETMT,
+    ARM64_INSTRUCTION_SETMN,
+    ARM64_INSTRUCTION_SETMTN,
+    ARM64_INSTRUCTION_SETE,
+    ARM64_INSTRUCTION_SETET,
+    ARM64_INSTRUCTION_SETEN,
+    ARM64_INSTRUCTION_SETETN,
+    ARM64_INSTRUCTION_SETGP,
+    ARM64_INSTRUCTION_SETGPT,
+    ARM64_INSTRUCTION_SETGPN,
+    ARM64_INSTRUCTION_SETGPTN,
+    ARM64_INSTRUCTION_SETGM,
+    ARM64_INSTRUCTION_SETGMT,
+    ARM64_INSTRUCTION_SETGMN,
+    ARM64_INSTRUCTION_SETGMTN,
+    ARM64_INSTRUCTION_SETGE,
+    ARM64_INSTRUCTION_SETGET,
+    ARM64_INSTRUCTION_SETGEN,
+    ARM64_INSTRUCTION_SETGETN,
 } arm64_instr_t;
 
 /**
  *  \brief  AArch64 Instruction Strings. 
  * 
 */
-static const char *A64_INSTRUCTIONS_STR[] = 
-{
-    "unk",
-    "adc",
-    "adcs",
-    "add",
-    "addg",
-    "adds",
-    "adr",
-    "adrp",
-    "and",
-    "ands",
-    "asr",
-    "asrv",
-    "at",
-    "autda",
-    "autdza",
-    "autdb",
-    "autdzb",
-    "autia",
-    "autiza",
-    "autia1716",
-    "autiasp",
-    "autiaz",
-    "autib",
-    "autizb",
-    "autib1716",
-    "autibsp",
-    "autibz",
-    "axflag",
-    "arm_ddi",
-    "b",
-    "bfc",
-    "bfi",
-    "bfm",
-    "bfxil",
-    "bic",
-    "bics",
-    "bl",
-    "blr",
-    "blraaz",
-    "blraa",
-    "blrabz",
-    "blrab",
-    "br",
-    "braaz",
-    "braa",
-    "brabz",
-    "brab",
-    "brk",
-    "bti",
-    "casab",
-    "casalb",
-    "casb",
-    "caslb",
-    "casah",
-    "casalh",
-    "cash",
-    "caslh",
-    "casp",
-    "caspa",
-    "caspal",
-    "caspl",
-    "cas",
-    "casa",
-    "casal",
-    "casl",
-    "cbnz",
-    "cbz",
-    "ccmn",
-    "ccmp",
-    "cfinv",
-    "cfp",
-    "cinc",
-    "cinv",
-    "clrex",
-    "cls",
-    "clz",
-    "cmn",
-    "cmp",
-    "cmpp",
-    "cneg",
-    "cpp",
-    "crc32b",
-    "crc32h",
-    "crc32w",
-    "crc32x",
-    "crc32cb",
-    "crc32ch",
-    "crc32cw",
-    "crc32cx",
-    "csdb",
-    "csel",
-    "cset",
-    "csetm",
-    "csinc",
-    "csinv",
-    "csneg",
-    "dc",
-    "dcps1",
-    "dcps2",
-    "dcps3",
-    "dmb",
-    "drps",
-    "dsb",
-    "dvp",
-    "eon",
-    "eor",
-    "eret",
-    "eretaa",
-    "eretab",
-    "esb",
-    "extr",
-    "gmi",
-    "hint",
-    "hlt",
-    "hvc",
-    "ic",
-    "irg",
-    "isb",
-    "ldaddab",
-    "ldaddalb",
-    "ldaddb",
-    "ldaddlb",
-    "ldaddah",
-    "ldaddalh",
-    "ldaddh",
-    "ldaddlh",
-    "ldadd",
-    "ldadda",
-    "ldaddal",
-    "ldaddl",
-    "ldapr",
-    "ldaprb",
-    "ldaprh",
-    "ldapur",
-    "ldapurb",
-    "ldapurh",
-    "ldapursb",
-    "ldapursh",
-    "ldapursw",
-    "ldar",
-    "ldarb",
-    "ldarh",
-    "ldaxp",
-    "ldaxr",
-    "ldaxrb",
-    "ldaxrh",
-    "ldclrab",
-    "ldclralb",
-    "ldclrb",
-    "ldclrlb",
-    "ldclrah",
-    "ldclralh",
-    "ldclrh",
-    "ldclrlh",
-    "ldclr",
-    "ldclra",
-    "ldclral",
-    "ldclrl",
-    "ldeorab",
-    "ldeoralb",
-    "ldeorb",
-    "ldeorlb",
-    "ldeorah",
-    "ldeoralh",
-    "ldeorh",
-    "ldeorlh",
-    "ldeor",
-    "ldeora",
-    "ldeoral",
-    "ldeorl",
-    "ldg",
-    "ldgm",
-    "ldlarb",
-    "ldlarh",
-    "ldlar",
-    "ldnp",
-    "ldp",
-    "ldpsw",
-    "ldr",
-    "ldraa",
-    "ldrab",
-    "ldrb",
-    "ldrh",
-    "ldrsb",
-    "ldrsh",
-    "ldrsw",
-    "ldsetab",
-    "ldsetalb",
-    "ldsetb",
-    "ldsetlb",
-    "ldsetah",
-    "ldsetalh",
-    "ldseth",
-    "ldsetlh",
-    "ldset",
-    "ldseta",
-    "ldsetal",
-    "ldsetl",
-    "ldsmaxab",
-    "ldsmaxalb",
-    "ldsmaxb",
-    "ldsmaxlb",
-    "ldsmaxah",
-    "ldsmaxalh",
-    "ldsmaxh",
-    "ldsmaxlh",
-    "ldsmax",
-    "ldsmaxa",
-    "ldsmaxal",
-    "ldsmaxl",
-    "ldsminab",
-    "ldsminalb",
-    "ldsminb",
-    "ldsminlb",
-    "ldsminah",
-    "ldsminalh",
-    "ldsminh",
-    "ldsminlh",
-    "ldsmin",
-    "ldsmina",
-    "ldsminal",
-    "ldsminl",
-    "ldtr",
-    "ldtrb",
-    "ldtrh",
-    "ldtrsb",
-    "ldtrsh",
-    "ldtrsw",
-    "ldumaxab",
-    "ldumaxalb",
-    "ldumaxb",
-    "ldumaxlb",
-    "ldumaxah",
-    "ldumaxalh",
-    "ldumaxh",
-    "ldumaxlh",
-    "ldumax",
-    "ldumaxa",
-    "ldumaxal",
-    "ldumaxl",
-    "lduminab",
-    "lduminalb",
-    "lduminb",
-    "lduminlb",
-    "lduminah",
-    "lduminalh",
-    "lduminh",
-    "lduminlh",
-    "ldumin",
-    "ldumina",
-    "lduminal",
-    "lduminl",
-    "ldur",
-    "ldurb",
-    "ldurh",
-    "ldursb",
-    "ldursh",
-    "ldursw",
-    "ldxp",
-    "ldxr",
-    "ldxrb",
-    "ldxrh",
-    "lsl",
-    "lslv",
-    "lsr",
-    "lsrv",
-    "madd",
-    "mneg",
-    "mov",
-    "movk",
-    "movn",
-    "movz",
-    "mrs",
-    "msr",
-    "msub",
-    "mul",
-    "mvn",
-    "neg",
-    "negs",
-    "ngc",
-    "ngcs",
-    "nop",
-    "orn",
-    "orr",
-    "pacda",
-    "pacdza",
-    "pacdb",
-    "pacdzb",
-    "pacga",
-    "pacia",
-    "paciza",
-    "pacia1716",
-    "paciasp",
-    "paciaz",
-    "pacib",
-    "pacizb",
-    "pacib1716",
-    "pacibsp",
-    "pacibz",
-    "prfm",
-    "prfum",
-    "psb_csync",
-    "pssbb",
-    "rbit",
-    "ret",
-    "retaa",
-    "retab",
-    "rev",
-    "rev16",
-    "rev32",
-    "rev64",
-    "rmif",
-    "ror",
-    "rorv",
-    "sb",
-    "sbc",
-    "sbcs",
-    "sbfiz",
-    "sbfm",
-    "sbfx",
-    "sdiv",
-    "setf8",
-    "setf16",
-    "sev",
-    "sevl",
-    "smaddl",
-    "smc",
-    "smnegl",
-    "smsubl",
-    "smulh",
-    "smull",
-    "ssbb",
-    "st2g",
-    "staddb",
-    "staddlb",
-    "staddh",
-    "staddlh",
-    "stadd",
-    "staddl",
-    "stclrb",
-    "stclrlb",
-    "stclrh",
-    "stclrlh",
-    "stclr",
-    "stclrl",
-    "steorb",
-    "steorlb",
-    "steorh",
-    "steorlh",
-    "steor",
-    "steorl",
-    "stg",
-    "stgm",
-    "stgp",
-    "stllrb",
-    "stllrh",
-    "stllr",
-    "stlr",
-    "stlrb",
-    "stlrh",
-    "stlur",
-    "stlurb",
-    "stlurh",
-    "stlxp",
-    "stlxr",
-    "stlxrb",
-    "stlxrh",
-    "stnp",
-    "stp",
-    "str",
-    "strb",
-    "strh",
-    "stsetb",
-    "stsetlb",
-    "stseth",
-    "stsetlh",
-    "stset",
-    "stsetl",
-    "stsmaxb",
-    "stsmaxlb",
-    "stsmaxh",
-    "stsmaxlh",
-    "stsmax",
-    "stsmaxl",
-    "stsminb",
-    "stsminlb",
-    "stsminh",
-    "stsminlh",
-    "stsmin",
-    "stsminl",
-    "sttr",
-    "sttrb",
-    "sttrh",
-    "stumaxb",
-    "stumaxlb",
-    "stumaxh",
-    "stumaxlh",
-    "stumax",
-    "stumaxl",
-    "stuminb",
-    "stuminlb",
-    "stuminh",
-    "stuminlh",
-    "stumin",
-    "stuminl",
-    "stur",
-    "sturb",
-    "sturh",
-    "stxp",
-    "stxr",
-    "stxrb",
-    "stxrh",
-    "stz2g",
-    "stzg",
-    "stzgm",
-    "sub",
-    "subg",
-    "subp",
-    "subps",
-    "subs",
-    "svc",
-    "swpab",
-    "swpalb",
-    "swpb",
-    "swplb",
-    "swpah",
-    "swpalh",
-    "swph",
-    "swplh",
-    "swp",
-    "swpa",
-    "swpal",
-    "swpl",
-    "sxtb",
-    "sxth",
-    "sxtw",
-    "sys",
-    "sysl",
-    "tbnz",
-    "tbz",
-    "tlbi",
-    "tsb_csync",
-    "tst",
-    "ubfiz",
-    "ubfm",
-    "ubfx",
-    "udf",
-    "udiv",
-    "umaddl",
-    "umnegl",
-    "umsubl",
-    "umulh",
-    "umull",
-    "uxtb",
-    "uxth",
-    "wfe",
-    "wfi",
-    "xaflag",
-    "xpacd",
-    "xpaci",
-    "xpaclri",
-    "yield",
-    "abs",
-    "addhn",
-    "addhn2",
-    "addp",
-    "addv",
-    "aesd",
-    "aese",
-    "aesimc",
-    "aesmc",
-    "bcax",
-    "bif",
-    "bit",
-    "bsl",
-    "cmeq",
-    "cmge",
-    "cmgt",
-    "cmhi",
-    "cmhs",
-    "cmle",
-    "cmlt",
-    "cmtst",
-    "cnt",
-    "dup",
-    "eor3",
-    "ext",
-    "fabd",
-    "fabs",
-    "facge",
-    "facgt",
-    "fadd",
-    "faddp",
-    "fcadd",
-    "fccmp",
-    "fccmpe",
-    "fcmeq",
-    "fcmge",
-    "fcmgt",
-    "fcmla",
-    "fcmle",
-    "fcmlt",
-    "fcmp",
-    "fcmpe",
-    "fcsel",
-    "fcvt",
-    "fcvtas",
-    "fcvtau",
-    "fcvtl",
-    "fcvtl2",
-    "fcvtms",
-    "fcvtmu",
-    "fcvtn",
-    "fcvtn2",
-    "fcvtns",
-    "fcvtnu",
-    "fcvtps",
-    "fcvtpu",
-    "fcvtxn",
-    "fcvtxn2",
-    "fcvtzs",
-    "fcvtzu",
-    "fdiv",
-    "fjcvtzs",
-    "fmadd",
-    "fmax",
-    "fmaxnm",
-    "fmaxnmp",
-    "fmaxnmv",
-    "fmaxp",
-    "fmaxv",
-    "fmin",
-    "fminnm",
-    "fminnmp",
-    "fminnmv",
-    "fminp",
-    "fminv",
-    "fmla",
-    "fmlal",
-    "fmlal2",
-    "fmls",
-    "fmlsl",
-    "fmlsl2",
-    "fmov",
-    "fmsub",
-    "fmul",
-    "fmulx",
-    "fneg",
-    "fnmadd",
-    "fnmsub",
-    "fnmul",
-    "frecpe",
-    "frecps",
-    "frecpx",
-    "frint32x",
-    "frint32z",
-    "frint64x",
-    "frint64z",
-    "frinta",
-    "frinti",
-    "frintm",
-    "frintn",
-    "frintp",
-    "frintx",
-    "frintz",
-    "frsqrte",
-    "frsqrts",
-    "fsqrt",
-    "fsub",
-    "ins",
-    "ld1",
-    "ld1r",
-    "ld2",
-    "ld2r",
-    "ld3",
-    "ld3r",
-    "ld4",
-    "ld4r",
-    "mla",
-    "mls",
-    "movi",
-    "mvni",
-    "not",
-    "pmul",
-    "pmull",
-    "pmull2",
-    "raddhn",
-    "raddhn2",
-    "rax1",
-    "rshrn",
-    "rshrn2",
-    "rsubhn",
-    "rsubhn2",
-    "saba",
-    "sabal",
-    "sabal2",
-    "sabd",
-    "sabdl",
-    "sabdl2",
-    "sadalp",
-    "saddl",
-    "saddl2",
-    "saddlp",
-    "saddlv",
-    "saddw",
-    "saddw2",
-    "scvtf",
-    "sdot",
-    "sha1c",
-    "sha1h",
-    "sha1m",
-    "sha1p",
-    "sha1su0",
-    "sha1su1",
-    "sha256h2",
-    "sha256h",
-    "sha256su0",
-    "sha256su1",
-    "sha512h",
-    "sha512h2",
-    "sha512su0",
-    "sha512su1",
-    "shadd",
-    "shl",
-    "shll",
-    "shll2",
-    "shrn",
-    "shrn2",
-    "shsub",
-    "sli",
-    "sm3partw1",
-    "sm3partw2",
-    "sm3ss1",
-    "sm3tt1a",
-    "sm3tt1b",
-    "sm3tt2a",
-    "sm3tt2b",
-    "sm4e",
-    "sm4ekey",
-    "smax",
-    "smaxp",
-    "smaxv",
-    "smin",
-    "sminp",
-    "sminv",
-    "smlal",
-    "smlal2",
-    "smlsl",
-    "smlsl2",
-    "smov",
-    "smull2",
-    "sqabs",
-    "sqadd",
-    "sqdmlal",
-    "sqdmlal2",
-    "sqdmlsl",
-    "sqdmlsl2",
-    "sqdmulh",
-    "sqdmull",
-    "sqdmull2",
-    "sqneg",
-    "sqrdmlah",
-    "sqrdmlsh",
-    "sqrdmulh",
-    "sqrshl",
-    "sqrshrn",
-    "sqrshrn2",
-    "sqrshrun",
-    "sqrshrun2",
-    "sqshl",
-    "sqshlu",
-    "sqshrn",
-    "sqshrn2",
-    "sqshrun",
-    "sqshrun2",
-    "sqsub",
-    "sqxtn",
-    "sqxtn2",
-    "sqxtun",
-    "sqxtun2",
-    "srhadd",
-    "sri",
-    "srshl",
-    "srshr",
-    "srsra",
-    "sshl",
-    "sshll",
-    "sshll2",
-    "sshr",
-    "ssra",
-    "ssubl",
-    "ssubl2",
-    "ssubw",
-    "ssubw2",
-    "st1",
-    "st2",
-    "st3",
-    "st4",
-    "subhn",
-    "subhn2",
-    "suqadd",
-    "sxtl",
-    "sxtl2",
-    "tbl",
-    "tbx",
-    "trn1",
-    "trn2",
-    "uaba",
-    "uabal",
-    "uabal2",
-    "uabd",
-    "uabdl",
-    "uabdl2",
-    "uadalp",
-    "uaddl",
-    "uaddl2",
-    "uaddlp",
-    "uaddlv",
-    "uaddw",
-    "uaddw2",
-    "ucvtf",
-    "udot",
-    "uhadd",
-    "uhsub",
-    "umax",
-    "umaxp",
-    "umaxv",
-    "umin",
-    "uminp",
-    "uminv",
-    "umlal",
-    "umlal2",
-    "umlsl",
-    "umlsl2",
-    "umov",
-    "umull2",
-    "uqadd",
-    "uqrshl",
-    "uqrshrn",
-    "uqrshrn2",
-    "uqshl",
-    "uqshrn",
-    "uqshrn2",
-    "uqsub",
-    "uqxtn",
-    "uqxtn2",
-    "urecpe",
-    "urhadd",
-    "urshl",
-    "urshr",
-    "ursqrte",
-    "ursra",
-    "ushl",
-    "ushll",
-    "ushll2",
-    "ushr",
-    "usqadd",
-    "usra",
-    "usubl",
-    "usubl2",
-    "usubw",
-    "usubw2",
-    "uxtl",
-    "uxtl2",
-    "uzp1",
-    "uzp2",
-    "xar",
-    "xtn",
-    "xtn2",
-    "zip1",
-    "zip2",
-    "wfet",
-    "wfit",
-    "dgh",
-    "tcommit",
-};
+LIBARCH_EXPORT const char *const A64_INSTRUCTIONS_STR[];
 
 /**
  *  \brief  Length of the A64_INSTRUCTIONS_STR array containing all the supported
  *          AArch64 instructions.
  * 
 */
-static uint64_t A64_INSTRUCTIONS_STR_LEN = sizeof (A64_INSTRUCTIONS_STR) / sizeof (*A64_INSTRUCTIONS_STR);
+LIBARCH_EXPORT const uint64_t A64_INSTRUCTIONS_STR_LEN;
 
 
 #endif /* __libarch_arm64_instructions_h__ */
\ No newline at end of file
@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_ARM64_LOGICAL_IMMEDIATES_H__
+#define __LIBARCH_ARM64_LOGICAL_IMMEDIATES_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+
+/**
+ *  \brief  Index into A64_LOGICAL_IMMEDIATES for a given N:immr:imms.
+ */
+#define ARM64_LOGICAL_IMMEDIATE_INDEX(N, immr, imms)    (((N) << 12) | ((immr) << 6) | (imms))
+
+/**
+ *  \brief  Value to encoding entry of the inverse logical immediate map. The
+ *          encoding is packed as N:immr:imms.
+ */
+typedef struct arm64_logical_immediate {
+    uint64_t    value;
+    uint16_t    encoding;
+} arm64_logical_immediate_t;
+
+/**
+ *  \brief  Decoded 64-bit value of every N:immr:imms logical immediate
+ *          encoding. Values are replicated across 64 bits, so the 32-bit
+ *          forms use the low 32 bits. Reserved encodings hold zero.
+ */
+LIBARCH_EXPORT const uint64_t A64_LOGICAL_IMMEDIATES[];
+
+/**
+ *  \brief  Length of the A64_LOGICAL_IMMEDIATES array.
+ */
+LIBARCH_EXPORT const uint64_t A64_LOGICAL_IMMEDIATES_LEN;
+
+/**
+ *  \brief  Every valid logical immediate and its encoding, sorted by value.
+ */
+LIBARCH_EXPORT const arm64_logical_immediate_t A64_LOGICAL_IMMEDIATE_ENCODINGS[];
+
+/**
+ *  \brief  Length of the A64_LOGICAL_IMMEDIATE_ENCODINGS array.
+ */
+LIBARCH_EXPORT const uint64_t A64_LOGICAL_IMMEDIATE_ENCODINGS_LEN;
+
+
+#endif /* __libarch_arm64_logical_immediates_h__ */
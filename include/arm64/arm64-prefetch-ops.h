@@ -17,6 +17,9 @@
 #define __LIBARCH_ARM64_PREFETCH_OPS_H__
 
 #include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
 
 /**
  *  \brief  AArch64 Prefetch Operations used when decoding the `prfm` instruction
@@ -66,17 +69,12 @@ enum {
  *  \brief  String representations of the Prefetch Operations.
  * 
  */
-static const char *A64_PRFOP_STR[] =
-{
-    "pldl1keep", "pldl2keep", "pldl3keep", "pldl1strm", "pldl2strm", "pldl3strm",
-    "plil1keep", "plil2keep", "plil3keep", "plil1strm", "plil2strm", "plil3strm",
-    "pstl1keep", "pstl2keep", "pstl3keep", "pstl1strm", "pstl2strm", "pstl3strm", 
-};
+LIBARCH_EXPORT const char *const A64_PRFOP_STR[];
 
 /**
  *  \brief  Length of the A64_PRFOP_STR array.
 */
-static uint64_t A64_PRFOP_STR_LEN = sizeof (A64_PRFOP_STR) / sizeof (*A64_PRFOP_STR);
+LIBARCH_EXPORT const uint64_t A64_PRFOP_STR_LEN;
 
 
 
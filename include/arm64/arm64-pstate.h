@@ -17,6 +17,9 @@
 #define __LIBARCH_ARM64_PSTATE_H__
 
 #include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
 
 /**
  *  \brief  AArch64 PSTATE Fields
@@ -45,16 +48,11 @@ typedef enum arm64_pstate_t
 /**
  *  \brief  String representations of the PSTATE Fields. 
  */
-static const char *A64_PSTATE_STR[] =
-{
-    "SPSel", "DAIFSet", "DAIFClr", "UAO",
-    "PAN", "ALLINT", "SSBS", "DIT", "SVCRSM",
-    "SVCRZA", "SVCRSMZA", "TC0",
-};
+LIBARCH_EXPORT const char *const A64_PSTATE_STR[];
 
 /**
  *  \brief  Length of the A64_PSTATE_STR array.
  */
-static uint64_t A64_PSTATE_STR_LEN = sizeof (A64_PSTATE_STR) / sizeof (*A64_PSTATE_STR);
+LIBARCH_EXPORT const uint64_t A64_PSTATE_STR_LEN;
 
 #endif /* __libarch_arm64_pstate_h__ */
\ No newline at end of file
@@ -18,6 +18,8 @@
 
 #include <stdint.h>
 
+#include "libarch.h"
+
 /**
  *  NOTE:   This header contains definitions of general-purpose and system registers
  *          for the AArch64/arm64 architecture. Register definitions can be found in
@@ -880,33 +882,34 @@ enum {
 };
 
 
-static const char *A64_REGISTERS_GP_64[] = {
-    "x0",  "x1",  "x2",  "x3",  "x4",  "x5",  "x6",  "x7",
-    "x8",  "x9",  "x10", "x11", "x12", "x13", "x14", "x15",
-    "x16", "x17", "x18", "x19", "x20", "x21", "x22", "x23",
-    "x24", "x25", "x26", "x27", "x28", "x29", "x30",
-    "sp",  "xzr"
-};
-
-static const char *A64_REGISTERS_GP_32[] = {
-    "w0",  "w1",  "w2",  "w3",  "w4",  "w5",  "w6",  "w7",
-    "w8",  "w9",  "w10", "w11", "w12", "w13", "w14", "w15",
-    "w16", "w17", "w18", "w19", "w20", "w21", "w22", "w23",
-    "w24", "w25", "w26", "w27", "w28", "w29", "w30",
-    "wsp",  "wzr"
-};
-
-static const char *A64_REGISTERS_FP_128[] = {
-    "v0",  "v1",  "v2",  "v3",  "v4",  "v5",  "v6",  "v7",
-    "v8",  "v9",  "v10", "v11", "v12", "v13", "v14", "v15",
-    "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23",
-    "v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31",
-};
+/**
+ *  \brief  String representation of the 64-bit, 32-bit and 128-bit vector
+ *          general registers, and the b/h/s/d/q scalar views of the SIMD&FP
+ *          registers, and the SVE scalable vector and predicate registers.
+ *          Defined once in src/tables.c.
+ */
+LIBARCH_EXPORT const char *const A64_REGISTERS_GP_64[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_GP_32[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_FP_128[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_FP_8[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_FP_16[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_FP_32[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_FP_64[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_FP_Q[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_SVE_Z[];
+LIBARCH_EXPORT const char *const A64_REGISTERS_SVE_P[];
 
 /* add others */
 
-static uint64_t A64_REGISTERS_GP_64_LEN = sizeof (A64_REGISTERS_GP_64) / sizeof (*A64_REGISTERS_GP_64);
-static uint64_t A64_REGISTERS_GP_32_LEN = sizeof (A64_REGISTERS_GP_32) / sizeof (*A64_REGISTERS_GP_32);
-static uint64_t A64_REGISTERS_FP_128_LEN = sizeof (A64_REGISTERS_FP_128) / sizeof (*A64_REGISTERS_FP_128);
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_GP_64_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_GP_32_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_FP_128_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_FP_8_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_FP_16_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_FP_32_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_FP_64_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_FP_Q_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_SVE_Z_LEN;
+LIBARCH_EXPORT const uint64_t A64_REGISTERS_SVE_P_LEN;
 
 #endif /* __libarch_arm64_registers_h__ */
\ No newline at end of file
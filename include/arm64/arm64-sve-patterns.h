@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_ARM64_SVE_PATTERNS_H__
+#define __LIBARCH_ARM64_SVE_PATTERNS_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+
+/**
+ *  \brief  AArch64 SVE Predicate Constraint Patterns.
+ * 
+ *          Element count and predicate initialisation instructions, e.g.
+ *          `cntd` and `ptrue`, take a 5-bit pattern that limits the number of
+ *          active elements. The encodings 14 to 28 are unallocated and are
+ *          printed as an immediate, e.g. #14.
+ */
+enum {
+    ARM64_SVE_PATTERN_POW2 = 0,
+    ARM64_SVE_PATTERN_VL1,
+    ARM64_SVE_PATTERN_VL2,
+    ARM64_SVE_PATTERN_VL3,
+    ARM64_SVE_PATTERN_VL4,
+    ARM64_SVE_PATTERN_VL5,
+    ARM64_SVE_PATTERN_VL6,
+    ARM64_SVE_PATTERN_VL7,
+    ARM64_SVE_PATTERN_VL8,
+    ARM64_SVE_PATTERN_VL16,
+    ARM64_SVE_PATTERN_VL32,
+    ARM64_SVE_PATTERN_VL64,
+    ARM64_SVE_PATTERN_VL128,
+    ARM64_SVE_PATTERN_VL256,
+
+    ARM64_SVE_PATTERN_MUL4 = 29,
+    ARM64_SVE_PATTERN_MUL3,
+    ARM64_SVE_PATTERN_ALL,
+};
+
+/**
+ *  \brief  String representations of the SVE Predicate Constraint Patterns.
+ * 
+ */
+LIBARCH_EXPORT const char *const A64_SVE_PATTERN_STR[];
+
+/**
+ *  \brief  Length of the A64_SVE_PATTERN_STR array.
+*/
+LIBARCH_EXPORT const uint64_t A64_SVE_PATTERN_STR_LEN;
+
+
+#endif /* __libarch_arm64_sve_patterns_h__ */
@@ -17,50 +17,33 @@
 #define __LIBARCH_ARM64_TLBI_OPS_H__
 
 #include <stdlib.h>
+#include <stdint.h>
 #include "libarch.h"
 
 LIBARCH_API int
 get_tlbi (unsigned op1, unsigned CRn, unsigned CRm, unsigned op2);
 
+/**
+ *  \brief  Fetch the op1:CRm:op2 encoding of a TLBI operation, packed as
+ *          (op1 << 7) | (CRm << 3) | op2. CRn is always 8.
+ *
+ *  \return Encoding, or -1 if the operation is not known.
+ */
+LIBARCH_API int
+arm64_tlbi_encoding (int op);
+
 /**
  *  \brief  AArch64 TLBI Operation names, indexed by the `arm64_tlbi_op_t` values.
  *  
  */
-static const char *A64_TLBI_OPS_STR[] =
-{
-    "vmalle1is", "vae1is", "aside1is", "vaae1is", "vale1is", "vaale1is",
-    "vmalle1", "vae1", "aside1", "vaae1", "vale1", "vaale1", "ipas2e1is", 
-    "ipas2le1is", "alle2is", "vae2is", "alle1is", "vale2is", "vmalls12e1is", 
-    "ipas2e1", "ipas2le1", "alle2", "vae2", "alle1", "vale2", "vmalls12e1", 
-    "alle3is", "vae3is", "vale3is", "alle3", "vae3", "vale3", "vmalle1os",
-    "vae1os", "aside1os", "vaae1os", "vale1os", "vaale1os", "alle2os", "vae2os",
-    "alle1os", "vale2os", "vmalls12e1os", "ipas2e1os", "ipas2le1os", "alle3os", 
-    "vae3os", "vale3os", "rvae1is", "rvaae1is", "rvale1is", "rvaale1is", "rvae1os",
-    "rvaae1os", "rvale1os", "rvaale1os", "rvae1", "rvaae1", "rvale1", "rvaale1",
-    "ripas2e1is", "ripas2le1is", "rvae2is", "rvale2is", "ripas2e1", "ripas2e1os", 
-    "ripas2le1", "ripas2le1os", "rvae2os", "rvale2os", "rvae2", "rvale2", "rvae3is",
-    "rvale3is", "rvae3os", "rvale3os", "rvae3", "rvale3", "vmalle1osnxs", "vae1osnxs",
-    "aside1osnxs", "vaae1osnxs", "vale1osnxs", "vaale1osnxs", "rvae1isnxs", "rvaae1isnxs",
-    "rvale1isnxs","rvaale1isnxs","vmalle1isnxs","vae1isnxs","aside1isnxs","vaae1isnxs",
-    "vale1isnxs", "vaale1isnxs", "rvae1osnxs", "rvaae1osnxs", "rvale1osnxs", "rvaale1osnxs",
-    "rvae1nxs", "rvaae1nxs", "rvale1nxs", "rvaale1nxs", "vmalle1nxs", "vae1nxs",
-    "aside1nxs", "vaae1nxs", "vale1nxs", "vaale1nxs", "ipas2e1isnxs", "ripas2e1isnxs",
-    "ipas2le1isnxs", "ripas2le1isnxs", "alle2osnxs", "vae2osnxs", "alle1osnxs", "vale2osnxs",
-    "vmalls12e1osnxs", "rvae2isnxs", "rvale2isnxs", "alle2isnxs", "vae2isnxs", "alle1isnxs",
-    "vale2isnxs", "vmalls12e1isnxs", "ipas2e1osnxs", "ipas2e1nxs", "ripas2e1nxs", "ripas2e1osnxs",
-    "ipas2le1osnxs", "ipas2le1nxs", "ripas2le1nxs", "ripas2le1osnxs", "rvae2osnxs",
-    "rvale2osnxs", "rvae2nxs", "rvale2nxs", "alle2nxs", "vae2nxs", "alle1nxs",
-    "vale2nxs", "vmalls12e1nxs", "alle3osnxs", "vae3osnxs", "vale3osnxs", "rvae3isnxs",
-    "rvale3isnxs", "alle3isnxs", "vae3isnxs", "vale3isnxs", "rvae3osnxs", "rvale3osnxs",
-    "rvae3nxs", "rvale3nxs", "alle3nxs", "vae3nxs", "vale3nxs", "unknown",
-};
+LIBARCH_EXPORT const char *const A64_TLBI_OPS_STR[];
 
 /**
  *  \brief  Length of the A64_TLBI_OPS_STR array containing all the supported TLBI
  *          Operations.
  * 
 */
-static uint64_t A64_TLBI_OPS_STR_LEN = sizeof (A64_TLBI_OPS_STR) / sizeof (*A64_TLBI_OPS_STR);
+LIBARCH_EXPORT const uint64_t A64_TLBI_OPS_STR_LEN;
 
 /**
  *  \brief  AArch64 TLBI Operation values, with corresponding strings in the A64_TLBI_OPS_STR
@@ -17,6 +17,9 @@
 #define __LIBARCH_ARM64_TRANSLATION_H__
 
 #include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
 
 /**
  *  \brief  AArch64 Address Translation Operations.
@@ -47,17 +50,29 @@ typedef enum arm64_addr_trans_t
 /**
  *  \brief  String representations of the Address Translation Operations.
  */
-static const char *A64_AT_NAMES_STR[] =
-{
-    "S1E1R", "S1E1W", "S1E0R", "S1E0W",
-    "S1E2R", "S1E2W", "S12E1R", "S12E1W",
-    "S12E0R", "S12E0W", "S1E3R", "S1E3W",
-    "S1E1RP", "S1E1WP",
-};
+LIBARCH_EXPORT const char *const A64_AT_NAMES_STR[];
 
 /**
  *  \brief  Length of teh A64_AT_NAMES_STR array.
  */
-static uint64_t A64_AT_NAMES_STR_LEN = sizeof (A64_AT_NAMES_STR) / sizeof (*A64_AT_NAMES_STR);
+LIBARCH_EXPORT const uint64_t A64_AT_NAMES_STR_LEN;
+
+/**
+ *  \brief  Fetch the Address Translation operation for the given op1, CRm
+ *          and op2 fields of an AT instruction.
+ *
+ *  \return arm64_addr_trans_t value, or -1 if the operation is not known.
+ */
+LIBARCH_API int
+get_at_name (unsigned op1, unsigned CRm, unsigned op2);
+
+/**
+ *  \brief  Fetch the op1:CRm:op2 encoding of an Address Translation operation,
+ *          packed as (op1 << 7) | (CRm << 3) | op2. CRn is always 7.
+ *
+ *  \return Encoding, or -1 if the operation is not known.
+ */
+LIBARCH_API int
+arm64_at_encoding (int name);
 
 #endif /* __libarch_arm64_translation_h__ */
\ No newline at end of file
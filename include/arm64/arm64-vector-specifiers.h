@@ -17,6 +17,9 @@
 #define __LIBARCH_ARM64_VECTOR_SPECIFIERS_H__
 
 #include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
 
 /**
  *  \brief  AArch64 Vector Arrangement Specifiers.
@@ -39,21 +42,20 @@ typedef enum arm64_vec_specifier_t
     ARM64_VEC_ARRANGEMENT_4S,
     ARM64_VEC_ARRANGEMENT_D,
     ARM64_VEC_ARRANGEMENT_2D,
+    ARM64_VEC_ARRANGEMENT_1D,
+    ARM64_VEC_ARRANGEMENT_Q,
+    ARM64_VEC_ARRANGEMENT_1Q,
 } arm64_vec_specifier_t;
 
 /**
  *  \brief  String representatios of the Vector Arrangement Specifiers.
  * 
  */
-static const char *A64_VEC_SPECIFIER_STR[] =
-{
-    "b", "8b", "16b", "h", "4h", "8h", "s", "2s",
-    "4s", "d", "2d",
-};
+LIBARCH_EXPORT const char *const A64_VEC_SPECIFIER_STR[];
 
 /**
  *  \brief  Length of the A64_VEC_SPECIFIER_STR array.
  */
-static uint64_t A64_VEC_SPECIFIER_STR_LEN = sizeof (A64_VEC_SPECIFIER_STR) / sizeof (*A64_VEC_SPECIFIER_STR);
+LIBARCH_EXPORT const uint64_t A64_VEC_SPECIFIER_STR_LEN;
 
 #endif /* __libarch_arm64_vector_specifiers_h__ */
\ No newline at end of file
@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_ASSEMBLER_H__
+#define __LIBARCH_ASSEMBLER_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "instruction.h"
+
+/* Longest MOVZ/MOVN + MOVK sequence needed to load a 64-bit value */
+#define LIBARCH_ASSEMBLE_MOVE_MAX_LEN           4
+
+/**
+ *  \brief  Encode an instruction into it's 32-bit opcode.
+ *
+ *          The instruction uses the same operand model the decoder produces,
+ *          so it can either come straight from libarch_disass, or be built
+ *          with libarch_instruction_create and the add_operand functions.
+ *          Branch and PC-relative labels are absolute addresses, and are
+ *          encoded relative to `instr->addr`. A B.cond is a B with `cond` set.
+ *
+ *          The following are supported:
+ *
+ *              B, B.cond, BL, CBZ, CBNZ, TBZ, TBNZ, BR, BLR, RET
+ *              ADR, ADRP, ADD, ADDS, SUB, SUBS, CMP, CMN (immediate)
+ *              AND, ORR, EOR, ANDS, TST (immediate)
+ *              MOVZ, MOVN, MOVK, MOV (wide, bitmask and register)
+ *              MSR (register), MRS, SYS, SYSL, TLBI, AT
+ *              NOP, HINT and the other hints, BTI, DSB, DMB, ISB
+ *              SVC, HVC, SMC, BRK, HLT
+ *
+ *  \param      instr       Instruction to encode.
+ *  \param      opcode      Set to the encoded instruction.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if the instruction is not supported, or the
+ *          operands cannot be encoded, e.g. a branch target is out of range.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_assemble (const instruction_t *instr, uint32_t *opcode);
+
+
+/**
+ *  \brief  Encode the shortest sequence of instructions that loads `value`
+ *          into a general purpose register. This is a single MOV where
+ *          possible, otherwise a MOVZ or MOVN followed by MOVKs.
+ *
+ *  \param      reg         Register number, 0-30 or 31 for the zero register.
+ *  \param      size        Register width, 32 or 64.
+ *  \param      value       Value to load.
+ *  \param      opcodes     Output array, with room for at least
+ *                          LIBARCH_ASSEMBLE_MOVE_MAX_LEN opcodes.
+ *
+ *  \return Number of opcodes written, or 0 if the register is invalid.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_assemble_move_immediate (arm64_reg_t reg,
+                                 uint8_t size,
+                                 uint64_t value,
+                                 uint32_t *opcodes);
+
+
+#endif /* __libarch_assembler_h__ */
@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_BUFFER_H__
+#define __LIBARCH_BUFFER_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "context.h"
+#include "instruction.h"
+
+
+/**
+ *  \brief  Count the words at the start of a buffer that are the same as the
+ *          first, e.g. for runs of NOP or zero padding.
+ *
+ *          The words are compared with AVX2 or SSE2 (picked at runtime) on
+ *          x86, NEON on arm64, or one at a time elsewhere. The second word is
+ *          checked on it's own first, so a buffer that doesn't start with a
+ *          run returns without touching the vector units.
+ *
+ *  \param      words       Host-endian words.
+ *  \param      len         Number of words.
+ *
+ *  \return Length of the run, 0 if `len` is 0.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_run_length (const uint32_t *words, size_t len);
+
+
+/**
+ *  \brief  Decode a buffer of opcodes into an array of records.
+ *
+ *          Records already in `instrs` are reset and reused, and empty slots
+ *          are filled with records created without a context, so the array
+ *          can be handed between threads. Free them with
+ *          libarch_instruction_free().
+ *
+ *          With LIBARCH_OPT_COLLAPSE_RUNS set in the context, a run of
+ *          identical words is decoded once into a single record, with the
+ *          length of the run in it's `run`. Runs of PC-relative instructions,
+ *          e.g. branches and literal loads, aren't collapsed, as each one
+ *          decodes to a different target.
+ *
+ *  \param      ctx         Context providing decode options, or NULL for the
+ *                          defaults.
+ *  \param      opcodes     Host-endian opcodes.
+ *  \param      addr        Address of the first opcode.
+ *  \param      len         Number of opcodes.
+ *  \param      instrs      Array of records, which may be NULL or recycled.
+ *  \param      max         Number of slots in `instrs`.
+ *  \param      used        Set to the number of opcodes decoded, which is
+ *                          less than `len` if the records ran out, or NULL.
+ *
+ *  \return Number of records filled in.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_disass_buffer (libarch_ctx_t *ctx,
+                       const uint32_t *opcodes,
+                       uint64_t addr,
+                       size_t len,
+                       instruction_t **instrs,
+                       size_t max,
+                       size_t *used);
+
+
+#endif /* __libarch_buffer_h__ */
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_BYTEORDER_H__
+#define __LIBARCH_BYTEORDER_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+
+/* Byte order of an input buffer */
+#define LIBARCH_BYTE_ORDER_LITTLE               0
+#define LIBARCH_BYTE_ORDER_BIG                  1
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#   define LIBARCH_BYTE_ORDER_HOST              LIBARCH_BYTE_ORDER_BIG
+#else
+#   define LIBARCH_BYTE_ORDER_HOST              LIBARCH_BYTE_ORDER_LITTLE
+#endif
+
+
+/**
+ *  \brief  Load a single opcode from a buffer of any alignment.
+ *
+ *  \param      src         Four bytes of input.
+ *  \param      order       Byte order of the input, LIBARCH_BYTE_ORDER_*.
+ *
+ *  \return The opcode, in host byte order.
+ */
+LIBARCH_EXPORT LIBARCH_API
+uint32_t
+libarch_load_opcode (const void *src, int order);
+
+
+/**
+ *  \brief  Load a buffer of opcodes into an array of host-order words, ready
+ *          to be passed to libarch_instruction_create.
+ *
+ *          `src` can have any alignment. When the byte order matches the host
+ *          this is a copy, otherwise the words are swapped with SSSE3 or AVX2
+ *          shuffles (picked at runtime) on x86, NEON on arm64, or one at a time
+ *          elsewhere. Trailing bytes that don't make up a full word are left
+ *          alone.
+ *
+ *  \param      dst         Output array, with room for `len / 4` words. It
+ *                          may be the same as `src` to convert in place, but
+ *                          must not otherwise overlap it.
+ *  \param      src         Input bytes.
+ *  \param      len         Length of the input, in bytes.
+ *  \param      order       Byte order of the input, LIBARCH_BYTE_ORDER_*.
+ *
+ *  \return Number of words written.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_load_opcodes (uint32_t *dst, const void *src, size_t len, int order);
+
+
+#endif /* __libarch_byteorder_h__ */
@@ -0,0 +1,179 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_CONTEXT_H__
+#define __LIBARCH_CONTEXT_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "symbol.h"
+
+struct instruction_t;
+
+/******************************************************************************
+*       Options and Features
+*******************************************************************************/
+
+/* Decode and format options */
+#define LIBARCH_OPT_NONE                        0
+#define LIBARCH_OPT_IMMEDIATE_DECIMAL           (1 << 0)
+#define LIBARCH_OPT_IMMEDIATE_HEX               (1 << 1)
+#define LIBARCH_OPT_COLLECT_STATS               (1 << 2)
+#define LIBARCH_OPT_RAW                         (1 << 3)
+#define LIBARCH_OPT_COLLAPSE_RUNS               (1 << 4)
+
+/**
+ *  Architecture features. Disabled features decode as unknown, except for the
+ *  pointer authentication hints, which decode as HINT like on older cores.
+ */
+#define LIBARCH_FEATURE_FP                      (1ULL << 0)
+#define LIBARCH_FEATURE_SIMD                    (1ULL << 1)
+#define LIBARCH_FEATURE_SVE                     (1ULL << 2)
+#define LIBARCH_FEATURE_SVE2                    (1ULL << 3)
+#define LIBARCH_FEATURE_LSE                     (1ULL << 4)     // Atomics, CAS and CASP
+#define LIBARCH_FEATURE_MOPS                    (1ULL << 5)     // Memory copy and set
+#define LIBARCH_FEATURE_PAUTH                   (1ULL << 6)
+#define LIBARCH_FEATURE_MTE                     (1ULL << 7)
+#define LIBARCH_FEATURE_ALL                     (~0ULL)
+
+/* Number of instruction_t records a context keeps for reuse */
+#define LIBARCH_CTX_CACHE_SIZE                  64
+
+/******************************************************************************
+*       Context
+*******************************************************************************/
+
+/**
+ *  \brief  Allocator used for instructions, operands and fields. The defaults
+ *          are the standard malloc, realloc and free.
+ */
+typedef struct libarch_allocator_t
+{
+    void               *(*alloc)   (size_t size);
+    void               *(*resize)  (void *ptr, size_t size);
+    void                (*release) (void *ptr);
+} libarch_allocator_t;
+
+/**
+ *  \brief  Decode statistics, only collected when LIBARCH_OPT_COLLECT_STATS
+ *          is set. Indexed by ARM64_DECODE_GROUP_*.
+ */
+typedef struct libarch_stats_t
+{
+    uint64_t            decoded;
+    uint64_t            unknown;
+    uint64_t            groups[16];
+} libarch_stats_t;
+
+/**
+ *  \brief  Decoder Context.
+ *
+ *          Carries everything the decoder and formatter would otherwise need
+ *          from global state: decode/format options, the set of enabled
+ *          architecture features, the allocator, a cache of released
+ *          instruction records, statistics, and the symbolizer used to name
+ *          branch and literal targets when formatting.
+ *
+ *          A context is not thread-safe. Each thread should use it's own, at
+ *          which point decoding shares no mutable state between threads.
+ */
+typedef struct libarch_ctx_t
+{
+    uint32_t                options;
+    uint64_t                features;
+    libarch_allocator_t     allocator;
+
+    /* Released instructions, reused by libarch_instruction_create_ctx */
+    struct instruction_t   *cache[LIBARCH_CTX_CACHE_SIZE];
+    uint32_t                cache_len;
+
+    libarch_stats_t         stats;
+
+    /* Names targets when formatting, called with `symbolizer_arg`, if set */
+    libarch_symbolizer_t    symbolizer;
+    void                   *symbolizer_arg;
+} libarch_ctx_t;
+
+
+/**
+ *  \brief  Initialise a context with the default options, all features enabled
+ *          and the standard allocator. Use this for contexts on the stack.
+ *
+ *  \param      ctx         Context to initialise.
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_ctx_init (libarch_ctx_t *ctx);
+
+
+/**
+ *  \brief  Allocate and initialise a new context.
+ *
+ *  \return A new context, or NULL if allocation failed.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_ctx_t *
+libarch_ctx_create (void);
+
+
+/**
+ *  \brief  Release any cached instructions held by a context. The context
+ *          itself is not freed.
+ *
+ *  \param      ctx         Context to clean up.
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_ctx_cleanup (libarch_ctx_t *ctx);
+
+
+/**
+ *  \brief  Clean up and free a context created with libarch_ctx_create.
+ *
+ *  \param      ctx         Context to free.
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_ctx_free (libarch_ctx_t *ctx);
+
+
+/**
+ *  \brief  Check whether an architecture feature is enabled. A NULL context
+ *          has all features enabled.
+ *
+ *  \param      ctx         Context to check.
+ *  \param      feature     LIBARCH_FEATURE_* flag(s).
+ *
+ *  \return Non-zero if all of the given features are enabled.
+ */
+LIBARCH_EXPORT LIBARCH_API
+int
+libarch_ctx_has_feature (const libarch_ctx_t *ctx, uint64_t feature);
+
+
+/**
+ *  \brief  Fetch the read-only default context. This is used by the APIs that
+ *          do not take a context, e.g. libarch_disass.
+ *
+ *  \return The default context.
+ */
+LIBARCH_EXPORT LIBARCH_API
+const libarch_ctx_t *
+libarch_ctx_default (void);
+
+
+#endif /* __libarch_context_h__ */
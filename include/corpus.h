@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_CORPUS_H__
+#define __LIBARCH_CORPUS_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+
+/**
+ *  \brief  Opcode corpus, loaded from the .arm64 text format used by the
+ *          tests, one entry per line:
+ *
+ *              <opcode bytes>    -    <expected disassembly>
+ *
+ *          The opcode is eight hex digits with the bytes in memory order,
+ *          e.g. 1f2003d5 for a nop. Lines that don't start with an opcode
+ *          followed by a '-', like headers and blank lines, are skipped.
+ *
+ *          Entry i has it's opcode, in host byte order, at `opcodes[i]`, and
+ *          it's expected text at `expected[i]`, `expected_len[i]` bytes long
+ *          with surrounding whitespace trimmed. The expected text points into
+ *          the corpus file and is not NUL-terminated. `lines[i]` is the line
+ *          number, from 1, for error messages.
+ */
+typedef struct libarch_corpus_t
+{
+    uint32_t           *opcodes;
+    const char        **expected;
+    uint32_t           *expected_len;
+    uint32_t           *lines;
+    size_t              len;
+
+    /* Mapping of the corpus file, or NULL if parsed from memory */
+    void               *map;
+    size_t              map_size;
+} libarch_corpus_t;
+
+
+/**
+ *  \brief  Map a corpus file and parse it.
+ *
+ *  \param      corpus      Corpus to load into.
+ *  \param      path        Path to the .arm64 file.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if the file can't be read, or memory for the
+ *          entries can't be allocated.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_corpus_load (libarch_corpus_t *corpus, const char *path);
+
+
+/**
+ *  \brief  Parse a corpus that is already in memory. The expected text points
+ *          into `text`, so it must outlive the corpus.
+ *
+ *  \param      corpus      Corpus to load into.
+ *  \param      text        Corpus text.
+ *  \param      len         Length of the text.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if memory for the entries can't be
+ *          allocated.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_corpus_parse (libarch_corpus_t *corpus, const char *text, size_t len);
+
+
+/**
+ *  \brief  Free the entries of a corpus and unmap it's file.
+ *
+ *  \param      corpus      Corpus to free.
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_corpus_free (libarch_corpus_t *corpus);
+
+
+#endif /* __libarch_corpus_h__ */
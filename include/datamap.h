@@ -0,0 +1,120 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_DATAMAP_H__
+#define __LIBARCH_DATAMAP_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "descent.h"
+
+/* Words in the sliding window used to find runs of undecodable words */
+#define LIBARCH_DATAMAP_WINDOW                  8
+
+/* Undecodable words in a window for it to be treated as data */
+#define LIBARCH_DATAMAP_DENSITY                 6
+
+/* Why a range was treated as data */
+#define LIBARCH_DATAMAP_LITERAL                 (1 << 0)
+#define LIBARCH_DATAMAP_JUMPTABLE               (1 << 1)
+#define LIBARCH_DATAMAP_UNDECODABLE             (1 << 2)
+
+/**
+ *  \brief  Range of an image that holds data rather than code. `unit` is the
+ *          size of the values in the range, 8 where it was loaded as 64-bit
+ *          literals and 4 otherwise, and `reasons` is a mask of the
+ *          LIBARCH_DATAMAP_* reasons it was found.
+ */
+typedef struct libarch_data_range_t
+{
+    uint64_t            addr;
+    uint64_t            size;
+    uint32_t            reasons;
+    uint32_t            unit;
+} libarch_data_range_t;
+
+/**
+ *  \brief  Data found between the code of an image, e.g. literal pools, jump
+ *          tables and padding, so a linear sweep can skip it rather than
+ *          decode it as instructions.
+ *
+ *          The ranges are sorted by address and don't overlap.
+ */
+typedef struct libarch_datamap_t
+{
+    libarch_data_range_t   *ranges;
+    size_t                  len;
+} libarch_datamap_t;
+
+
+/**
+ *  \brief  Find the data in an image.
+ *
+ *          Every word is decoded once. The targets of LDR (literal) loads
+ *          are data, and so is every jump table that can be recovered at a
+ *          `br`. A literal pool is grown over the undecodable words either
+ *          side of it, and a window in which most words are undecodable is
+ *          data too, which catches padding and pools that are never loaded
+ *          from directly. Loads and tables found inside that data are
+ *          ignored.
+ *
+ *          If a descent of the image is given, literal loads only count if
+ *          they were reached as code, it's jump tables are used as well, and
+ *          code it found is never treated as data because it doesn't decode.
+ *
+ *  \param      map         Data map to fill in.
+ *  \param      opcodes     Host-endian words of the image.
+ *  \param      addr        Load address of the first word.
+ *  \param      len         Number of words.
+ *  \param      descent     Finished descent of the same image, or NULL.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if memory can't be allocated.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_datamap_detect (libarch_datamap_t *map,
+                        const uint32_t *opcodes,
+                        uint64_t addr,
+                        size_t len,
+                        const libarch_descent_t *descent);
+
+
+/**
+ *  \brief  Find the data range containing an address, or the first one after
+ *          it, so a sweep can walk the ranges alongside the image.
+ *
+ *  \param      map         Data map.
+ *  \param      addr        Address to look up.
+ *
+ *  \return The range, or NULL if there are no ranges at or after `addr`.
+ */
+LIBARCH_EXPORT LIBARCH_API
+const libarch_data_range_t *
+libarch_datamap_find (const libarch_datamap_t *map, uint64_t addr);
+
+
+/**
+ *  \brief  Free the ranges of a data map.
+ *
+ *  \param      map         Data map to free.
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_datamap_free (libarch_datamap_t *map);
+
+
+#endif /* __libarch_datamap_h__ */
@@ -23,11 +23,13 @@
 
 #include "arm64/arm64-instructions.h"
 #include "arm64/arm64-registers.h"
+#include "arm64/arm64-conditions.h"
+#include "arm64/arm64-index-extend.h"
 #include "arm64/arm64-common.h"
 
 
 /**
- * \brief   Decoder function for the Data Processing Immediate AArch64 
+ * \brief   Decoder function for the Data Processing Register AArch64 
  *          Decode Group.
  * 
  * \param       instr       Instruction containing an opcode to
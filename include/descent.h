@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_DESCENT_H__
+#define __LIBARCH_DESCENT_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "context.h"
+#include "symbol.h"
+#include "jumptable.h"
+
+/**
+ *  \brief  Recursive-descent disassembly of an image.
+ *
+ *          Starting from entry points, and optionally every symbol in a symbol
+ *          table, code is found by following control flow rather than
+ *          decoding every word in turn, so literal pools and other data
+ *          between functions are never decoded as instructions.
+ *
+ *          Each word of the image has a bit in `code`, set if it was reached
+ *          as an instruction, and a bit in `functions`, set if it's an entry
+ *          point or the target of a call. Use libarch_descent_is_code and
+ *          libarch_descent_is_function to read them.
+ *
+ *          A `br` through a jump table is followed to every entry, and the
+ *          tables are kept in `tables`, in no particular order.
+ *
+ *          The opcodes are host-endian, and are not copied.
+ */
+typedef struct libarch_descent_t
+{
+    const uint32_t     *opcodes;
+    uint64_t            addr;
+    size_t              len;
+
+    /* One bit per word, set atomically by the workers */
+    uint64_t           *code;
+    uint64_t           *functions;
+
+    /* Jump tables found at `br` instructions */
+    libarch_jumptable_t    *tables;
+    size_t                  tables_len;
+
+    /* Number of instructions and functions found */
+    size_t              instructions;
+    size_t              function_count;
+} libarch_descent_t;
+
+
+/**
+ *  \brief  Prepare an image for descent.
+ *
+ *  \param      descent     Descent state to initialise.
+ *  \param      opcodes     Host-endian opcodes of the image.
+ *  \param      addr        Load address of the first opcode.
+ *  \param      len         Number of opcodes.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if the bitmaps can't be allocated.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_descent_init (libarch_descent_t *descent, const uint32_t *opcodes, uint64_t addr, size_t len);
+
+
+/**
+ *  \brief  Follow control flow from a set of entry points, across a number of
+ *          threads.
+ *
+ *          Each thread runs basic blocks from it's own deque of block starts,
+ *          pushing the branch and call targets it finds, and steals from the
+ *          other threads when it runs out. An address is claimed by setting
+ *          it's bit in the code bitmap, so no address is decoded twice and
+ *          there is no shared queue or lock. Addresses outside the image are
+ *          ignored.
+ *
+ *          Calling this again continues from the new entry points, without
+ *          revisiting code that was already found.
+ *
+ *  \param      descent     Initialised descent state.
+ *  \param      entries     Entry point addresses.
+ *  \param      count       Number of entry points.
+ *  \param      symtab      Finalised symbol table whose symbols are used as
+ *                          entry points as well, or NULL.
+ *  \param      threads     Number of threads, or 0 for one per CPU.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if memory for the work queues can't be
+ *          allocated.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_descent_run (libarch_descent_t *descent,
+                     const uint64_t *entries,
+                     size_t count,
+                     const libarch_symtab_t *symtab,
+                     unsigned threads);
+
+
+/**
+ *  \brief  Check whether an address was reached as an instruction.
+ *
+ *  \param      descent     Descent state.
+ *  \param      addr        Address to check.
+ *
+ *  \return Non-zero if `addr` is code.
+ */
+LIBARCH_EXPORT LIBARCH_API
+int
+libarch_descent_is_code (const libarch_descent_t *descent, uint64_t addr);
+
+
+/**
+ *  \brief  Check whether an address is an entry point or a call target.
+ *
+ *  \param      descent     Descent state.
+ *  \param      addr        Address to check.
+ *
+ *  \return Non-zero if a function starts at `addr`.
+ */
+LIBARCH_EXPORT LIBARCH_API
+int
+libarch_descent_is_function (const libarch_descent_t *descent, uint64_t addr);
+
+
+/**
+ *  \brief  Free the bitmaps and jump tables of a descent.
+ *
+ *  \param      descent     Descent state to free.
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_descent_free (libarch_descent_t *descent);
+
+
+#endif /* __libarch_descent_h__ */
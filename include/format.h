@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_FORMAT_H__
+#define __LIBARCH_FORMAT_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "context.h"
+#include "instruction.h"
+
+/* Large enough for any single formatted instruction */
+#define LIBARCH_FORMAT_MAX_LEN                  256
+
+/**
+ *  \brief  Format a decoded instruction as assembly text, e.g.
+ *          "stp\tx29, x30, [sp, #-16]!". No trailing newline is written.
+ *
+ *          The output follows snprintf semantics: at most `len` bytes are
+ *          written including the NUL terminator, and the return value is the
+ *          length the full string would have had.
+ *
+ *          With LIBARCH_OPT_COLLAPSE_RUNS set in the context, a record that
+ *          stands for a run of identical words is prefixed with the length of
+ *          the run, e.g. "... 4096 x nop".
+ *
+ *  \param      ctx         Context providing format options, or NULL for the
+ *                          defaults.
+ *  \param      instr       Decoded instruction.
+ *  \param      buf         Output buffer.
+ *  \param      len         Size of the output buffer.
+ *
+ *  \return Length of the formatted instruction, excluding the terminator.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_format_instruction (const libarch_ctx_t *ctx,
+                            const instruction_t *instr,
+                            char *buf,
+                            size_t len);
+
+
+/**
+ *  \brief  Format a value found in data as a directive, ".word\t0x..." for 4
+ *          bytes or ".quad\t0x..." for 8, with the symbol it points to if the
+ *          context has a symbolizer and the value is 64-bit. Output follows
+ *          the same snprintf semantics as libarch_format_instruction.
+ *
+ *  \param      ctx         Context providing format options, or NULL for the
+ *                          defaults.
+ *  \param      value       Value, in host order.
+ *  \param      size        Size of the value in bytes, 4 or 8.
+ *  \param      buf         Output buffer.
+ *  \param      len         Size of the output buffer.
+ *
+ *  \return Length of the formatted directive, excluding the terminator.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_format_data (const libarch_ctx_t *ctx,
+                     uint64_t value,
+                     unsigned size,
+                     char *buf,
+                     size_t len);
+
+#endif /* __libarch_format_h__ */
@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_FUNCTION_H__
+#define __LIBARCH_FUNCTION_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "context.h"
+#include "instruction.h"
+
+/**
+ *  \brief  A function, as a range of opcodes starting at `addr`. The opcodes
+ *          are host-endian, and are not copied.
+ *
+ *          Jump tables are read from `image`, the words of the whole image
+ *          the function is in, if it's set, and from the function's own
+ *          opcodes otherwise.
+ */
+typedef struct libarch_function_t
+{
+    const uint32_t     *code;
+    uint64_t            addr;
+    size_t              len;
+
+    /* Image containing the function, for jump tables. Optional */
+    const uint32_t     *image;
+    uint64_t            image_addr;
+    size_t              image_len;
+} libarch_function_t;
+
+/**
+ *  \brief  Fuzzy hash of a function.
+ *
+ *          `hash` is built from the instruction types, conditions and operand
+ *          kinds, and the shape of the control flow graph. Register numbers,
+ *          immediate values and branch displacements are left out, so the
+ *          hash doesn't change when a function is moved, re-linked or has
+ *          it's registers allocated differently. The counts are kept to help
+ *          tell apart functions with the same hash.
+ */
+typedef struct libarch_function_hash_t
+{
+    uint64_t            hash;
+    uint32_t            instructions;
+    uint32_t            blocks;
+    uint32_t            edges;
+    uint32_t            calls;
+} libarch_function_hash_t;
+
+/**
+ *  \brief  A pair of matching functions, as indexes into the two arrays given
+ *          to libarch_function_hash_match.
+ */
+typedef struct libarch_function_match_t
+{
+    size_t              a;
+    size_t              b;
+} libarch_function_match_t;
+
+
+/**
+ *  \brief  Hash a function that has already been decoded.
+ *
+ *  \param      instrs      Decoded instructions, in address order.
+ *  \param      len         Number of instructions.
+ *  \param      hash        Set to the function's hash.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if the range is empty, or memory for the
+ *          block list can't be allocated.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_function_hash_instructions (instruction_t **instrs, size_t len, libarch_function_hash_t *hash);
+
+
+/**
+ *  \brief  Decode and hash a function.
+ *
+ *  \param      ctx         Decoder context, or NULL for the default.
+ *  \param      func        Function to hash.
+ *  \param      hash        Set to the function's hash.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if the function can't be hashed.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_function_hash (libarch_ctx_t *ctx, const libarch_function_t *func, libarch_function_hash_t *hash);
+
+
+/**
+ *  \brief  Hash an array of functions across a number of threads. Each
+ *          thread has it's own decoder context, and takes functions from a
+ *          shared counter in small batches so large functions don't hold up
+ *          the rest.
+ *
+ *  \param      funcs       Functions to hash.
+ *  \param      count       Number of functions.
+ *  \param      hashes      Output array of `count` hashes.
+ *  \param      threads     Number of threads, or 0 for one per CPU.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if any function couldn't be hashed. It's
+ *          hash is left zeroed.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_function_hash_parallel (const libarch_function_t *funcs,
+                                size_t count,
+                                libarch_function_hash_t *hashes,
+                                unsigned threads);
+
+
+/**
+ *  \brief  Pair up the functions in `a` and `b` whose hash and counts appear
+ *          exactly once in each. Functions with duplicate hashes, e.g. small
+ *          stubs, are left unmatched.
+ *
+ *  \param      a           Hashes from the first image.
+ *  \param      a_len       Number of hashes in `a`.
+ *  \param      b           Hashes from the second image.
+ *  \param      b_len       Number of hashes in `b`.
+ *  \param      matches     Output array, with room for the smaller of `a_len`
+ *                          and `b_len` pairs.
+ *
+ *  \return Number of pairs written.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_function_hash_match (const libarch_function_hash_t *a, size_t a_len,
+                             const libarch_function_hash_t *b, size_t b_len,
+                             libarch_function_match_t *matches);
+
+
+#endif /* __libarch_function_h__ */
@@ -21,6 +21,7 @@
 #include <string.h>
 
 #include "libarch.h"
+#include "context.h"
 #include "arm64/arm64-instructions.h"
 #include "arm64/arm64-registers.h"
 #include "arm64/arm64-common.h"
@@ -37,6 +38,14 @@
 #define ARM64_REGISTER_TYPE_FLOATING_POINT      2
 #define ARM64_REGISTER_TYPE_SYSTEM              3
 #define ARM64_REGISTER_TYPE_ZERO                4
+#define ARM64_REGISTER_TYPE_VECTOR              5
+#define ARM64_REGISTER_TYPE_SCALABLE_VECTOR     6
+#define ARM64_REGISTER_TYPE_PREDICATE           7
+
+/* Predicate qualifier flags, e.g. p0/m or p0/z */
+#define ARM64_PREDICATE_QUALIFIER_NONE          0
+#define ARM64_PREDICATE_QUALIFIER_MERGING       1
+#define ARM64_PREDICATE_QUALIFIER_ZEROING       2
 
 /* Shift type flags */
 #define ARM64_SHIFT_TYPE_LSL                    4
@@ -45,6 +54,7 @@
 #define ARM64_SHIFT_TYPE_ROR                    7
 #define ARM64_SHIFT_TYPE_ROR                    8
 #define ARM64_SHIFT_TYPE_MSL                    9
+#define ARM64_SHIFT_TYPE_MUL                    30
 
 /* Immediate type flags */
 #define ARM64_IMMEDIATE_TYPE_INT                10
@@ -68,6 +78,9 @@
 #define ARM64_OPERAND_TYPE_PRFOP                24
 #define ARM64_OPERAND_TYPE_MEMORY_BARRIER       25
 #define ARM64_OPERAND_TYPE_INDEX_EXTEND         26
+#define ARM64_OPERAND_TYPE_CONDITION            27
+#define ARM64_OPERAND_TYPE_SVE_PATTERN          28
+#define ARM64_OPERAND_TYPE_MUL_VL               29
 
 /* Operand Options */
 #define ARM64_REGISTER_OPERAND_OPT_NONE             0
@@ -82,22 +95,34 @@
  *  \brief  Operand Structure.
  * 
  *          This structure represents all types of operands for an instruction
- *          by having an `op_type` to determine which group of values to look
- *          at.
+ *          as a 16-byte tagged union, with `op_type` determining which members
+ *          are valid. Clients should use the libarch_operand_get_* functions
+ *          rather than reading the members directly, so the layout is free to
+ *          change.
  * 
  *          * Registers *
  *          An arm64_reg_t value, which is just a typedef'd integer, holds the
  *          actual register number, with the size determining whether it's an
  *          X, W, V, etc. The type can be a General, Floating Point, System or
- *          Zero register.
+ *          Zero register. System register encodings are 16 bits wide, so the
+ *          register number is stored as a uint16_t.
  * 
  *          Some registers need a prefix and/or suffix, e.g. stlrb	w8, [x9],
- *          so these characters can be set. These are set to NULL by default
- *          so when printing instructions, verify the prefix and suffix.
+ *          so these characters can be set. These are zero by default so when
+ *          printing instructions, verify the prefix and suffix.
+ * 
+ *          Vector registers (ARM64_REGISTER_TYPE_VECTOR) can also carry an
+ *          arrangement specifier and an element index, e.g. v1.4s or v2.s[1].
+ *          SVE scalable vector (z) and predicate (p) registers use the same
+ *          fields, with predicates also carrying a qualifier, e.g. p0/m.
  * 
  *          * Shift and Immediate *
  *          Shift's and Immediates are simple, they have a type and a value.
  * 
+ *          * Target *
+ *          Targets are static strings, e.g. the "jc" of BTI, so an operand
+ *          never owns heap memory.
+ * 
  *          * Extra *
  *          Some operands are neither a Register, Shift or Immediate, so they
  *          can be set in the `extra` field.
@@ -105,41 +130,60 @@
  */
 typedef struct operand_t
 {
-    /* Operand type */
+    /* Operand type, and the prefix and suffix characters */
     uint8_t             op_type;
-
-    /* op_type == ARM64_OPERAND_TYPE_REGISTER */
-    arm64_reg_t         reg;
-    uint8_t             reg_size;
-    uint8_t             reg_type;
-
-    /* op_type == ARM64_OPERAND_TYPE_SHIFT */
-    uint32_t            shift;
-    uint8_t             shift_type;
-
-    /* op_type == ARM64_OPERAND_TYPE_IMMEDIATE */
-    uint64_t            imm_bits; 
-    uint8_t             imm_type;
-    uint32_t            imm_opts;
-
-    /* op_type == ARM64_OPERAND_TYPE_TARGET */
-    char               *target;
-    
-    /**
-     *  op_type == ARM64_OPERAND_TYPE_PSTATE
-     *  op_type == ARM64_OPERAND_TYPE_AT_NAME
-     *  op_type == ARM64_OPERAND_TYPE_TLBI_OP
-    */
-    int                 extra;
-    int                 extra_val;
-
-    /* Prefix and Suffix */
     char                prefix;
     char                suffix;
     char                suffix_extra;
 
+    /* Per-type metadata */
+    union {
+        /* op_type == ARM64_OPERAND_TYPE_REGISTER */
+        struct {
+            uint16_t    reg;
+            uint8_t     size;
+            uint8_t     type;
+        } reg;
+
+        /* op_type == ARM64_OPERAND_TYPE_IMMEDIATE */
+        struct {
+            uint8_t     type;
+            uint8_t     __pad;
+            uint16_t    opts;
+        } imm;
+
+        /* op_type == ARM64_OPERAND_TYPE_SHIFT */
+        uint8_t         shift_type;
+
+        /* op_type == ARM64_OPERAND_TYPE_INDEX_EXTEND */
+        int32_t         extra_val;
+    };
+
+    /* Operand value */
+    union {
+        /* op_type == ARM64_OPERAND_TYPE_REGISTER, vector registers */
+        struct {
+            uint8_t     arrangement;    // arm64_vec_specifier_t + 1, 0 if none
+            uint8_t     index;          // Element index + 1, 0 if none
+            uint8_t     qualifier;      // ARM64_PREDICATE_QUALIFIER_*
+        } vec;
+
+        uint64_t        imm_bits;
+        uint32_t        shift;
+        const char     *target;
+
+        /**
+         *  op_type == ARM64_OPERAND_TYPE_PSTATE
+         *  op_type == ARM64_OPERAND_TYPE_AT_NAME
+         *  op_type == ARM64_OPERAND_TYPE_TLBI_OP
+         */
+        int32_t         extra;
+    } val;
+
 } operand_t;
 
+_Static_assert (sizeof (operand_t) <= 16, "operand_t must fit in 16 bytes");
+
 
 /******************************************************************************
 *       Instructions
@@ -164,7 +208,24 @@ typedef struct operand_t
  *          assigned to `spec`.
  * 
  *          Each operand is appended to the `operands` array, and each bit field
- *          that is checked is added to `fields`.
+ *          that is checked is added to `fields`. Both arrays grow geometrically
+ *          and `operands_cap` / `fields_cap` hold their allocated sizes, which
+ *          libarch_instruction_reset() keeps so a recycled record stops
+ *          allocating once it has seen its largest instruction.
+ * 
+ *          Decoding with LIBARCH_OPT_RAW leaves the instruction in it's
+ *          canonical form, e.g. ORR rather than MOV, and sets `raw` so the
+ *          formatter knows the preferred alias still has to be picked. See
+ *          libarch_alias_instruction().
+ * 
+ *          If the instruction was created with a context, `ctx` points to it
+ *          and is used for allocation, and by libarch_disass(). Otherwise it's
+ *          NULL and the read-only default context is used. Decoding with
+ *          another context doesn't change it.
+ * 
+ *          `run` is the number of identical words the record stands for,
+ *          starting at `addr`. It's always 1, except for records decoded by
+ *          libarch_disass_buffer() with LIBARCH_OPT_COLLAPSE_RUNS.
  */
 typedef struct instruction_t
 {
@@ -179,16 +240,22 @@ typedef struct instruction_t
     arm64_instr_t       type;
     int                 cond;           // Branch condition
     int                 spec;           // Vector Arrangement Specifier
+    uint32_t            raw;            // Set if aliases haven't been applied
+    uint32_t            run;            // Identical words from `addr`
 
     /* Operands */
     operand_t          *operands;
     uint32_t            operands_len;
+    uint32_t            operands_cap;
 
     /* Fields, left to right */
-    uint64_t           *fields;
+    uint32_t           *fields;
     uint32_t            fields_len;
+    uint32_t            fields_cap;
+
+    /* Decoder context, or NULL */
+    libarch_ctx_t      *ctx;
 
-        
 } instruction_t;
 
 /**
@@ -221,6 +288,102 @@ decode_status_t
 libarch_disass (instruction_t **instr);
 
 
+/**
+ *  \brief  Create a new instruction_t structure using the given context. The
+ *          record is taken from the context's cache where possible, and is
+ *          allocated with the context's allocator otherwise.
+ * 
+ *  \param      ctx         Decoder context.
+ *  \param      opcode      32-bit opcode for the instruction.
+ *  \param      addr        Address of the instruction.
+ * 
+ *  \return An initialised instruction_t for the given opcode, not disassembled.
+ *  
+ */
+LIBARCH_EXPORT LIBARCH_API
+instruction_t *
+libarch_instruction_create_ctx (libarch_ctx_t *ctx, uint32_t opcode, uint64_t addr);
+
+
+/**
+ *  \brief  Disassemble a given instruction with the given context. Features
+ *          disabled in the context decode as unknown, and statistics are
+ *          recorded if enabled.
+ * 
+ *          The record keeps the context it was created with, if any, which
+ *          owns it's memory, so a record created without a context can be
+ *          decoded with one and still be passed between threads.
+ * 
+ *  \param      ctx         Decoder context, or NULL for the default.
+ *  \param      instr       Instruction to disassemble.
+ * 
+ *  \return A libarch return code depending on the result of the disassembly
+ *          operation.
+ * 
+ */
+LIBARCH_EXPORT LIBARCH_API
+decode_status_t
+libarch_disass_ctx (libarch_ctx_t *ctx, instruction_t **instr);
+
+
+/**
+ *  \brief  Check whether a feature is enabled in the context an instruction is
+ *          being decoded with. For the decoders, while in libarch_disass_ctx().
+ * 
+ *  \param      instr       Instruction being decoded.
+ *  \param      feature     LIBARCH_FEATURE_* bits to check.
+ * 
+ *  \return Non-zero if every bit in `feature` is enabled.
+ */
+LIBARCH_API
+int
+libarch_decode_has_feature (const instruction_t *instr, uint64_t feature);
+
+
+/**
+ *  \brief  Free an instruction and it's operands and fields. If the instruction
+ *          has a context with room in it's cache, the record is returned there
+ *          for reuse instead.
+ * 
+ *  \param      instr       Instruction to free.
+ * 
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_instruction_free (instruction_t *instr);
+
+
+/**
+ *  \brief  Reset an instruction so it can be disassembled again with a new
+ *          opcode and address, as if it had just been created. The operands
+ *          and fields arrays, and the context, are kept, and only their
+ *          lengths are zeroed, so decoding into a reused record doesn't
+ *          allocate once the arrays have grown large enough.
+ * 
+ *  \param      instr       Instruction to reset.
+ *  \param      opcode      32-bit opcode for the instruction.
+ *  \param      addr        Address of the instruction.
+ * 
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_instruction_reset (instruction_t *instr, uint32_t opcode, uint64_t addr);
+
+
+/**
+ *  \brief  Check whether a decoded instruction encodes an offset from it's own
+ *          address: the immediate branches, ADR and ADRP, and literal loads.
+ *          These decode to a different target at each address.
+ * 
+ *  \param      instr       Decoded instruction.
+ * 
+ *  \return Non-zero if the instruction is PC-relative.
+ */
+LIBARCH_EXPORT LIBARCH_API
+int
+libarch_instruction_is_pc_relative (const instruction_t *instr);
+
+
 /******************************************************************************
 *       Instruction API
 *******************************************************************************/
@@ -351,7 +514,91 @@ libarch_instruction_add_operand_register_with_fix (instruction_t **instr,
 
 
 /**
- * \brief   Add a Target Operand to the given instruction.
+ * \brief   Add a Register Operand with a prefix/suffix and a trailing '!'
+ *          to the given instruction, e.g. the [x0]! operands of CPYP.
+ * 
+ * \param       instr       Instruction to add the Operand to.
+ * \param       a64reg      ARM64 Register code of the instruction.
+ * \param       size        Register width.
+ * \param       type        Register type.
+ * \param       opts        Register Operand options.
+ * \param       prefix      Register prefix.
+ * \param       suffix      Register suffix.
+ */
+LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_register_with_fix_extra (instruction_t **instr, 
+                                                         arm64_reg_t a64reg, 
+                                                         uint8_t size, 
+                                                         uint8_t type, 
+                                                         uint32_t opts, 
+                                                         char prefix, 
+                                                         char suffix);
+
+
+/**
+ * \brief   Add a Vector Register Operand to the given instruction, with an
+ *          optional arrangement specifier and element index, e.g. v1.4s or
+ *          v2.s[1].
+ * 
+ * \param       instr       Instruction to add the Operand to.
+ * \param       a64reg      Vector register number.
+ * \param       arrangement Arrangement specifier (arm64_vec_specifier_t), or -1.
+ * \param       index       Element index, or -1.
+ * \param       prefix      Register prefix.
+ * \param       suffix      Register suffix.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_vector (instruction_t **instr, 
+                                        arm64_reg_t a64reg, 
+                                        int arrangement, 
+                                        int index, 
+                                        char prefix, 
+                                        char suffix);
+
+
+/**
+ * \brief   Add an SVE Scalable Vector Register Operand to the given instruction,
+ *          with an optional element size and index, e.g. z1.s or z2.d[1].
+ * 
+ * \param       instr       Instruction to add the Operand to.
+ * \param       a64reg      Scalable vector register number.
+ * \param       arrangement Element size (arm64_vec_specifier_t), or -1.
+ * \param       index       Element index, or -1.
+ * \param       prefix      Register prefix.
+ * \param       suffix      Register suffix.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_scalable (instruction_t **instr, 
+                                          arm64_reg_t a64reg, 
+                                          int arrangement, 
+                                          int index, 
+                                          char prefix, 
+                                          char suffix);
+
+
+/**
+ * \brief   Add an SVE Predicate Register Operand to the given instruction,
+ *          with an optional element size or qualifier, e.g. p1.b or p0/z.
+ * 
+ * \param       instr       Instruction to add the Operand to.
+ * \param       a64reg      Predicate register number.
+ * \param       arrangement Element size (arm64_vec_specifier_t), or -1.
+ * \param       qualifier   ARM64_PREDICATE_QUALIFIER_* flag.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_predicate (instruction_t **instr, 
+                                           arm64_reg_t a64reg, 
+                                           int arrangement, 
+                                           uint8_t qualifier);
+
+
+/**
+ * \brief   Add a Target Operand to the given instruction. The string is not
+ *          copied, so it must outlive the instruction, e.g. a literal.
  * 
  * \param       instr       Instruction to add the Operand to.
  * \param       target      Target value.
@@ -359,7 +606,7 @@ libarch_instruction_add_operand_register_with_fix (instruction_t **instr,
 LIBARCH_EXPORT LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_target (instruction_t **instr, 
-                                        char *target);
+                                        const char *target);
 
 
 /**
@@ -395,6 +642,43 @@ libarch_instruction_add_operand_extra_with_fix (instruction_t **instr,
                                                 char suffix);
 
 
+/**
+ * \brief   Add a Register Extend Operand to the given instruction, e.g.
+ *          the "sxtw #2" of add x0, x1, w2, sxtw #2.
+ * 
+ * \param       instr       Instruction to add the Operand to.
+ * \param       extend      Extend type (ARM64_INDEX_EXTEND_*), the option
+ *                          field of the encoding.
+ * \param       amount      Left shift applied after extending, or -1 to
+ *                          leave it out.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_extend (instruction_t **instr, 
+                                        int extend, 
+                                        int amount);
+
+
+/**
+ * \brief   Add a Register Extend Operand with a prefix/suffix to the given
+ *          instruction, e.g. the "sxtw #3]" of ldr x0, [x1, w2, sxtw #3].
+ * 
+ * \param       instr       Instruction to add the Operand to.
+ * \param       extend      Extend type (ARM64_INDEX_EXTEND_*).
+ * \param       amount      Left shift applied after extending, or -1 to
+ *                          leave it out.
+ * \param       prefix      Extend prefix.
+ * \param       suffix      Extend suffix.
+ */
+LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_extend_with_fix (instruction_t **instr, 
+                                                 int extend, 
+                                                 int amount, 
+                                                 char prefix, 
+                                                 char suffix);
+
+
 /**
  * \brief   Add a bitfield to the given instruction.
  * 
@@ -403,7 +687,83 @@ libarch_instruction_add_operand_extra_with_fix (instruction_t **instr,
  */
 LIBARCH_EXPORT LIBARCH_API
 libarch_return_t
-libarch_instruction_add_field (instruction_t **instr, int field);
+libarch_instruction_add_field (instruction_t **instr, uint32_t field);
+
+
+/******************************************************************************
+*       Operand API
+*******************************************************************************/
+
+/**
+ * \brief   Fetch an operand from the given instruction.
+ * 
+ * \param       instr       Instruction to fetch the Operand from.
+ * \param       idx         Index of the Operand.
+ * 
+ * \return  Pointer to the operand, or NULL if `idx` is out of range.
+ */
+LIBARCH_EXPORT LIBARCH_API
+const operand_t *
+libarch_instruction_get_operand (const instruction_t *instr, uint32_t idx);
+
+/**
+ * \brief   Operand accessors. Each of these is only meaningful for operands
+ *          of the matching `op_type`, e.g. libarch_operand_get_register for
+ *          ARM64_OPERAND_TYPE_REGISTER.
+ */
+LIBARCH_EXPORT LIBARCH_API uint8_t
+libarch_operand_get_type (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API arm64_reg_t
+libarch_operand_get_register (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API uint8_t
+libarch_operand_get_register_size (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API uint8_t
+libarch_operand_get_register_type (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API int
+libarch_operand_get_arrangement (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API int
+libarch_operand_get_index (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API uint8_t
+libarch_operand_get_predicate_qualifier (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API uint64_t
+libarch_operand_get_immediate (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API uint8_t
+libarch_operand_get_immediate_type (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API uint32_t
+libarch_operand_get_immediate_opts (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API uint32_t
+libarch_operand_get_shift (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API uint8_t
+libarch_operand_get_shift_type (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API const char *
+libarch_operand_get_target (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API int
+libarch_operand_get_extra (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API int
+libarch_operand_get_extra_val (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API char
+libarch_operand_get_prefix (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API char
+libarch_operand_get_suffix (const operand_t *op);
+
+LIBARCH_EXPORT LIBARCH_API char
+libarch_operand_get_suffix_extra (const operand_t *op);
 
 
 #endif /* __libarch_disassembler_h__ */
@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_JUMPTABLE_H__
+#define __LIBARCH_JUMPTABLE_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "instruction.h"
+
+/* Instructions before a `br` that are searched for the dispatch sequence */
+#define LIBARCH_JUMPTABLE_WINDOW                16
+
+/* Tables with more entries than this are assumed to be a misread bound */
+#define LIBARCH_JUMPTABLE_MAX_ENTRIES           65536
+
+/**
+ *  \brief  Jump table, recovered from the code that dispatches through it.
+ *
+ *          Compilers lower a switch to a bounds check, a load of the case's
+ *          entry from a table, and a `br` to the entry added to a base:
+ *
+ *              cmp     w8, #5
+ *              b.hi    default
+ *              adrp    x9, table@PAGE
+ *              add     x9, x9, table@PAGEOFF
+ *              adr     x10, base
+ *              ldrb    w11, [x9, x8]
+ *              add     x10, x10, x11, lsl #2
+ *              br      x10
+ *
+ *          Entry i is at `table + i * entry_size`, and branches to `base +
+ *          (entry << shift)`, with the entry sign-extended if `is_signed` is
+ *          set. A table of absolute addresses, loaded straight into the
+ *          branch register, has a `base` and `shift` of zero.
+ */
+typedef struct libarch_jumptable_t
+{
+    uint64_t            branch;
+    uint64_t            table;
+    uint64_t            base;
+    uint32_t            count;
+    uint8_t             entry_size;
+    uint8_t             shift;
+    uint8_t             is_signed;
+} libarch_jumptable_t;
+
+
+/**
+ *  \brief  Recover a jump table from a window of decoded instructions ending
+ *          with a `br`.
+ *
+ *          The window is searched backwards from the `br` for the entry load,
+ *          the add that applies it to the base, and the compare and `b.hi` or
+ *          `b.hs` that bound the index. Only the instructions after the last
+ *          one that can't fall through are used. The table and base addresses
+ *          must be constants built in the window, e.g. by ADRP/ADD or ADR.
+ *
+ *  \param      instrs      Decoded instructions, in address order, ending with
+ *                          the `br`.
+ *  \param      len         Number of instructions.
+ *  \param      table       Set to the recovered table.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if the window doesn't dispatch through a
+ *          bounded jump table.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_jumptable_recover (instruction_t **instrs, size_t len, libarch_jumptable_t *table);
+
+
+/**
+ *  \brief  Read a jump table's entries from an image and compute the branch
+ *          targets.
+ *
+ *  \param      table       Recovered jump table.
+ *  \param      opcodes     Host-endian words of the image.
+ *  \param      addr        Load address of the first word.
+ *  \param      len         Number of words.
+ *  \param      targets     Output array for the targets.
+ *  \param      max         Capacity of `targets`.
+ *
+ *  \return Number of targets written. Reading stops at the first entry that
+ *          isn't in the image, or after `max` targets.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_jumptable_targets (const libarch_jumptable_t *table,
+                           const uint32_t *opcodes,
+                           uint64_t addr,
+                           size_t len,
+                           uint64_t *targets,
+                           size_t max);
+
+
+#endif /* __libarch_jumptable_h__ */
@@ -21,9 +21,19 @@
 
 /* General definitions to make the code nicer to read */
 #define LIBARCH_API
-#define LIBARCH_EXPORT      extern
 #define LIBARCH_PRIVATE     static
 
+/**
+ *  The static library is built with hidden visibility so that LTO can
+ *  internalise the decoder helpers, so anything declared as part of the public
+ *  interface must be marked as default visibility explicitly.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#   define LIBARCH_EXPORT   extern __attribute__ ((visibility ("default")))
+#else
+#   define LIBARCH_EXPORT   extern
+#endif
+
 
 typedef enum libarch_return_t
 {
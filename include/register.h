@@ -28,8 +28,8 @@
  * 
  * \return  String representation for the specified `reg`.
  */
-extern const char *
-libarch_get_general_register (arm64_reg_t reg, const char **list, uint64_t len);
+LIBARCH_EXPORT const char *
+libarch_get_general_register (arm64_reg_t reg, const char *const *list, uint64_t len);
 
 
 /**
@@ -39,7 +39,7 @@ libarch_get_general_register (arm64_reg_t reg, const char **list, uint64_t len);
  * 
  * \return  String representation for the specified sytem `reg`.
 */
-extern const char *
+LIBARCH_EXPORT const char *
 libarch_get_system_register (arm64_reg_t reg);
 
 
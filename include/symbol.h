@@ -0,0 +1,168 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_SYMBOL_H__
+#define __LIBARCH_SYMBOL_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+
+/**
+ *  \brief  Symbolizer callback. Given an address, return the name of the
+ *          symbol containing it and set `offset` to the address' offset from
+ *          the start of the symbol, or return NULL if there isn't one.
+ *
+ *          The formatter calls this for branch targets, ADR/ADRP and literal
+ *          loads, so it must be safe to call from every thread that formats
+ *          with the same context.
+ */
+typedef const char *(*libarch_symbolizer_t) (void *arg, uint64_t addr, uint64_t *offset);
+
+/**
+ *  \brief  Symbol, as stored in a symbol table. A `size` of zero means the
+ *          symbol extends up to the next one.
+ */
+typedef struct libarch_symbol_t
+{
+    uint64_t            addr;
+    uint64_t            size;
+    const char         *name;
+} libarch_symbol_t;
+
+/**
+ *  \brief  Sorted symbol table.
+ *
+ *          Symbols are added in any order, then the table is finalised, which
+ *          sorts them by address and builds the search index. Lookups are only
+ *          valid after finalising, and a finalised table is read-only, so it
+ *          can be shared between threads.
+ *
+ *          Names are interned into a single arena, so a name shared by several
+ *          symbols is stored once, and none of them are allocated separately.
+ *
+ *          The index is the symbol addresses in Eytzinger (breadth-first
+ *          binary tree) order, so the first levels of every search share the
+ *          same few cache lines. A per-thread cache of the last symbol found
+ *          answers runs of lookups within one function without searching.
+ */
+typedef struct libarch_symtab_t
+{
+    libarch_symbol_t   *symbols;
+    size_t              len;
+    size_t              cap;
+
+    /* Name arena. Names are stored as offsets until the table is finalised */
+    char               *names;
+    size_t              names_len;
+    size_t              names_cap;
+
+    /* Name hash table, of arena offsets + 1, used to intern names */
+    uint32_t           *hash;
+    size_t              hash_len;
+    size_t              hash_cap;
+
+    /* Eytzinger index, 1-based, and the symbol each index entry refers to */
+    uint64_t           *index;
+    uint32_t           *index_symbol;
+
+    uint64_t            generation;
+    int                 finalised;
+} libarch_symtab_t;
+
+
+/**
+ *  \brief  Initialise an empty symbol table.
+ *
+ *  \param      symtab      Symbol table to initialise.
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_symtab_init (libarch_symtab_t *symtab);
+
+
+/**
+ *  \brief  Add a symbol. The name is copied, so it needn't outlive the table.
+ *          Adding to a finalised table un-finalises it.
+ *
+ *  \param      symtab      Symbol table.
+ *  \param      addr        Start address of the symbol.
+ *  \param      size        Size of the symbol, or zero if unknown.
+ *  \param      name        Symbol name.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if memory can't be allocated.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_symtab_add (libarch_symtab_t *symtab, uint64_t addr, uint64_t size, const char *name);
+
+
+/**
+ *  \brief  Sort the symbols and build the search index. Of several symbols at
+ *          the same address, the first one added is kept.
+ *
+ *  \param      symtab      Symbol table.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if memory can't be allocated.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_symtab_finalise (libarch_symtab_t *symtab);
+
+
+/**
+ *  \brief  Find the symbol containing an address: the symbol with the highest
+ *          start address at or below `addr`, provided `addr` is within it's
+ *          size.
+ *
+ *  \param      symtab      Finalised symbol table.
+ *  \param      addr        Address to look up.
+ *  \param      offset      Set to the offset of `addr` into the symbol. May be
+ *                          NULL.
+ *
+ *  \return The symbol, or NULL if no symbol contains `addr`.
+ */
+LIBARCH_EXPORT LIBARCH_API
+const libarch_symbol_t *
+libarch_symtab_lookup (const libarch_symtab_t *symtab, uint64_t addr, uint64_t *offset);
+
+
+/**
+ *  \brief  Symbolizer callback backed by a symbol table, for use as a context
+ *          symbolizer with the table as it's argument.
+ *
+ *  \param      arg         Finalised libarch_symtab_t.
+ *  \param      addr        Address to look up.
+ *  \param      offset      Set to the offset of `addr` into the symbol.
+ *
+ *  \return The symbol name, or NULL if no symbol contains `addr`.
+ */
+LIBARCH_EXPORT LIBARCH_API
+const char *
+libarch_symtab_symbolize (void *arg, uint64_t addr, uint64_t *offset);
+
+
+/**
+ *  \brief  Free a symbol table's symbols, names and index.
+ *
+ *  \param      symtab      Symbol table to free.
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_symtab_free (libarch_symtab_t *symtab);
+
+
+#endif /* __libarch_symbol_h__ */
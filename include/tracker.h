@@ -0,0 +1,160 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_TRACKER_H__
+#define __LIBARCH_TRACKER_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "libarch.h"
+#include "instruction.h"
+
+/* Number of tracked registers, x0-x30 and the stack pointer */
+#define LIBARCH_TRACKER_REGISTERS               32
+
+/* Index of the stack pointer in the register lattice */
+#define LIBARCH_TRACKER_REG_SP                  31
+
+/* Tracker event types */
+#define LIBARCH_TRACKER_EVENT_CONSTANT          1
+#define LIBARCH_TRACKER_EVENT_BRANCH_TARGET     2
+
+/**
+ *  \brief  Register value tracker.
+ *
+ *          Each of the 32 registers is either unknown, or holds a constant in
+ *          `values`. Bit n of `known` is set if register n is a constant, and
+ *          index 31 is the stack pointer. The zero register always reads as
+ *          zero, so it isn't tracked.
+ *
+ *          The tracker is a plain structure so it can live on the stack, be
+ *          copied to fork the state at a branch, or be seeded by setting
+ *          registers before the first instruction.
+ */
+typedef struct libarch_tracker_t
+{
+    uint64_t            values[LIBARCH_TRACKER_REGISTERS];
+    uint32_t            known;
+} libarch_tracker_t;
+
+/**
+ *  \brief  Tracker event, produced when an instruction writes a constant to
+ *          a register, or branches to a register holding a constant.
+ *
+ *          `addr` is the address of the instruction, `reg` the register that
+ *          was written or branched through, and `value` it's value. For a
+ *          branch, `value` is the target.
+ */
+typedef struct libarch_tracker_event_t
+{
+    uint64_t            addr;
+    uint64_t            value;
+    uint8_t             type;
+    uint8_t             reg;
+} libarch_tracker_event_t;
+
+
+/**
+ *  \brief  Reset every register in the tracker to unknown.
+ *
+ *  \param      tracker     Tracker to initialise.
+ *
+ */
+LIBARCH_EXPORT LIBARCH_API
+void
+libarch_tracker_init (libarch_tracker_t *tracker);
+
+
+/**
+ *  \brief  Set a register to a known value, e.g. a function argument.
+ *
+ *  \param      tracker     Tracker to update.
+ *  \param      reg         Register number, 0-30 or LIBARCH_TRACKER_REG_SP.
+ *  \param      value       Value of the register.
+ *
+ *  \return LIBARCH_RETURN_FAILURE if the register number is invalid.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_tracker_set (libarch_tracker_t *tracker, unsigned reg, uint64_t value);
+
+
+/**
+ *  \brief  Fetch the value of a register.
+ *
+ *  \param      tracker     Tracker to read from.
+ *  \param      reg         Register number, 0-30 or LIBARCH_TRACKER_REG_SP.
+ *  \param      value       Set to the value of the register, if it's known.
+ *
+ *  \return LIBARCH_RETURN_SUCCESS if the register holds a constant.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_tracker_get (const libarch_tracker_t *tracker, unsigned reg, uint64_t *value);
+
+
+/**
+ *  \brief  Update the tracker with a single decoded instruction.
+ *
+ *          The data processing (immediate) and (register) instructions are
+ *          evaluated from their encoding, so every alias is covered. Calls
+ *          clobber the caller-saved registers and set the link register.
+ *          Anything else that writes a general purpose register marks it as
+ *          unknown, and an instruction that failed to decode resets the
+ *          whole tracker.
+ *
+ *  \param      tracker     Tracker to update.
+ *  \param      instr       Decoded instruction.
+ *  \param      event       Set to the event the instruction produced, if
+ *                          there is one (optional).
+ *
+ *  \return LIBARCH_RETURN_SUCCESS if an event was produced.
+ */
+LIBARCH_EXPORT LIBARCH_API
+libarch_return_t
+libarch_tracker_step (libarch_tracker_t *tracker,
+                      const instruction_t *instr,
+                      libarch_tracker_event_t *event);
+
+
+/**
+ *  \brief  Run the tracker forward over a sequence of decoded instructions,
+ *          e.g. a basic block or function, in a single pass.
+ *
+ *          A constant built up over several instructions in the same register,
+ *          like MOVZ/MOVK or ADRP/ADD, is reported once, by the instruction
+ *          that completes it.
+ *
+ *  \param      tracker     Tracker to update. The state carries over, so it
+ *                          can be seeded first or reused across blocks.
+ *  \param      instrs      Decoded instructions, in execution order.
+ *  \param      len         Number of instructions.
+ *  \param      events      Output array for the events (optional).
+ *  \param      max         Capacity of `events`.
+ *
+ *  \return Number of events produced. Only the first `max` are written, so a
+ *          return value greater than `max` means the array was too small.
+ */
+LIBARCH_EXPORT LIBARCH_API
+size_t
+libarch_tracker_run (libarch_tracker_t *tracker,
+                     instruction_t **instrs,
+                     size_t len,
+                     libarch_tracker_event_t *events,
+                     size_t max);
+
+
+#endif /* __libarch_tracker_h__ */
@@ -0,0 +1,70 @@
+##===----------------------------------------------------------------------===//
+##
+##                                 Libarch
+##
+##  This  document  is the property of "Is This On?" It is considered to be
+##  confidential and proprietary and may not be, in any form, reproduced or
+##  transmitted, in whole or in part, without express permission of Is This
+##  On?.
+##
+##  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+##
+##  Harry Moulton <me@h3adsh0tzz.com>
+##
+##===----------------------------------------------------------------------===//
+
+"""
+Libarch AArch64 disassembler.
+
+decode() takes any buffer-protocol object (bytes, mmap, memoryview, numpy
+array) and decodes it in a single call, without copying it. The result is a
+dict of columns:
+
+    addr, opcode, type, group, subgroup, cond, spec, status
+        One entry per instruction.
+
+    operand_start
+        One entry per instruction, plus one. The operands of instruction i
+        are entries operand_start[i] to operand_start[i + 1] of the op_*
+        columns.
+
+    op_type, op_reg, op_size, op_reg_type, op_spec, op_value, op_extra
+        One entry per operand. op_value holds an immediate, shift amount or
+        operand specific value (e.g. a condition code), and op_extra the
+        immediate/shift type, vector element index or extend amount.
+
+With numpy installed the columns are numpy arrays sharing the decoder's
+memory, otherwise they are memoryviews.
+"""
+
+from . import _libarch
+from ._libarch import (
+    Column,
+    MNEMONICS,
+    OPERAND_TYPE_REGISTER,
+    OPERAND_TYPE_SHIFT,
+    OPERAND_TYPE_IMMEDIATE,
+    OPERAND_TYPE_TARGET,
+    DECODE_STATUS_SUCCESS,
+    disassemble,
+)
+
+try:
+    import numpy as _np
+except ImportError:
+    _np = None
+
+__all__ = ["decode", "disassemble", "mnemonic", "MNEMONICS", "Column"]
+
+
+def decode(buffer, addr=0):
+    """Decode every 4-byte little-endian word of `buffer`, numbering them from
+    `addr`. Trailing bytes are ignored."""
+    cols = _libarch.decode(buffer, addr)
+    wrap = _np.asarray if _np is not None else memoryview
+    return {name: wrap(col) for name, col in cols.items()}
+
+
+def mnemonic(type):
+    """Mnemonic for a value from the `type` column."""
+    return MNEMONICS[type]
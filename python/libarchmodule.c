@@ -0,0 +1,508 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <libarch.h>
+#include <context.h>
+#include <instruction.h>
+#include <format.h>
+#include <byteorder.h>
+
+#include "arm64/arm64-instructions.h"
+
+/**
+ *  CPython bindings.
+ *
+ *  decode() takes any object supporting the buffer protocol - bytes, mmap,
+ *  memoryview, numpy arrays - and decodes it in place, without copying it or
+ *  creating an object per instruction. The results come back as a set of
+ *  Column objects, one per field, each a flat C array exposed through the
+ *  buffer protocol so numpy.asarray() wraps it without a copy.
+ *
+ *  Operands are stored flattened: the operands of instruction i are entries
+ *  operand_start[i] to operand_start[i + 1] of the op_* columns.
+ */
+
+/******************************************************************************
+*       Column
+*******************************************************************************/
+
+typedef struct column_t
+{
+    PyObject_HEAD
+    void               *data;
+    Py_ssize_t          len;
+    Py_ssize_t          itemsize;
+    char               *format;
+} column_t;
+
+static void
+column_dealloc (column_t *self)
+{
+    free (self->data);
+    Py_TYPE (self)->tp_free ((PyObject *) self);
+}
+
+static int
+column_getbuffer (column_t *self, Py_buffer *view, int flags)
+{
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString (PyExc_BufferError, "column is read-only");
+        view->obj = NULL;
+        return -1;
+    }
+
+    view->obj = (PyObject *) self;
+    view->buf = self->data;
+    view->len = self->len * self->itemsize;
+    view->itemsize = self->itemsize;
+    view->readonly = 1;
+    view->ndim = 1;
+    view->format = (flags & PyBUF_FORMAT) ? self->format : NULL;
+    view->shape = (flags & PyBUF_ND) ? &self->len : NULL;
+    view->strides = (flags & PyBUF_STRIDES) ? &self->itemsize : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+
+    Py_INCREF (self);
+    return 0;
+}
+
+static Py_ssize_t
+column_length (column_t *self)
+{
+    return self->len;
+}
+
+static PyObject *
+column_repr (column_t *self)
+{
+    return PyUnicode_FromFormat ("<libarch column '%s' of %zd>", self->format, self->len);
+}
+
+static PyBufferProcs column_as_buffer = {
+    .bf_getbuffer = (getbufferproc) column_getbuffer,
+};
+
+static PySequenceMethods column_as_sequence = {
+    .sq_length = (lenfunc) column_length,
+};
+
+static PyTypeObject column_type = {
+    PyVarObject_HEAD_INIT (NULL, 0)
+    .tp_name = "libarch._libarch.Column",
+    .tp_doc = "Read-only array of decoded values, exposed through the buffer protocol.",
+    .tp_basicsize = sizeof (column_t),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor) column_dealloc,
+    .tp_repr = (reprfunc) column_repr,
+    .tp_as_buffer = &column_as_buffer,
+    .tp_as_sequence = &column_as_sequence,
+};
+
+/* Wrap `data`, taking ownership of it */
+static PyObject *
+column_new (void *data, Py_ssize_t len, Py_ssize_t itemsize, const char *format)
+{
+    column_t *col = PyObject_New (column_t, &column_type);
+    if (!col) {
+        free (data);
+        return NULL;
+    }
+
+    col->data = data;
+    col->len = len;
+    col->itemsize = itemsize;
+    col->format = (char *) format;
+    return (PyObject *) col;
+}
+
+
+/******************************************************************************
+*       Decoding
+*******************************************************************************/
+
+/* Instruction columns */
+typedef struct decode_columns_t
+{
+    uint64_t           *addr;
+    uint32_t           *opcode;
+    uint32_t           *type;
+    uint8_t            *group;
+    uint16_t           *subgroup;
+    int8_t             *cond;
+    int8_t             *spec;
+    uint8_t            *status;
+    uint32_t           *operand_start;
+
+    /* Operand columns, grown as the instructions are decoded */
+    uint8_t            *op_type;
+    uint16_t           *op_reg;
+    uint8_t            *op_size;
+    uint8_t            *op_reg_type;
+    int8_t             *op_spec;
+    uint64_t           *op_value;
+    int32_t            *op_extra;
+    size_t              op_len;
+    size_t              op_cap;
+} decode_columns_t;
+
+static const struct {
+    const char         *name;
+    size_t              offset;
+    Py_ssize_t          itemsize;
+    const char         *format;
+    int                 operand;
+} column_list[] = {
+    { "addr",           offsetof (decode_columns_t, addr),          8, "Q", 0 },
+    { "opcode",         offsetof (decode_columns_t, opcode),        4, "I", 0 },
+    { "type",           offsetof (decode_columns_t, type),          4, "I", 0 },
+    { "group",          offsetof (decode_columns_t, group),         1, "B", 0 },
+    { "subgroup",       offsetof (decode_columns_t, subgroup),      2, "H", 0 },
+    { "cond",           offsetof (decode_columns_t, cond),          1, "b", 0 },
+    { "spec",           offsetof (decode_columns_t, spec),          1, "b", 0 },
+    { "status",         offsetof (decode_columns_t, status),        1, "B", 0 },
+    { "op_type",        offsetof (decode_columns_t, op_type),       1, "B", 1 },
+    { "op_reg",         offsetof (decode_columns_t, op_reg),        2, "H", 1 },
+    { "op_size",        offsetof (decode_columns_t, op_size),       1, "B", 1 },
+    { "op_reg_type",    offsetof (decode_columns_t, op_reg_type),   1, "B", 1 },
+    { "op_spec",        offsetof (decode_columns_t, op_spec),       1, "b", 1 },
+    { "op_value",       offsetof (decode_columns_t, op_value),      8, "Q", 1 },
+    { "op_extra",       offsetof (decode_columns_t, op_extra),      4, "i", 1 },
+};
+
+#define COLUMN_COUNT            (sizeof (column_list) / sizeof (column_list[0]))
+#define COLUMN_PTR(c, i)        ((void **) ((char *) (c) + column_list[i].offset))
+
+static void
+decode_columns_free (decode_columns_t *cols)
+{
+    for (size_t i = 0; i < COLUMN_COUNT; i++)
+        free (*COLUMN_PTR (cols, i));
+    free (cols->operand_start);
+}
+
+static int
+decode_columns_alloc (decode_columns_t *cols, size_t count)
+{
+    memset (cols, 0, sizeof (*cols));
+    cols->op_cap = count * 3 + 16;
+
+    for (size_t i = 0; i < COLUMN_COUNT; i++) {
+        size_t n = column_list[i].operand ? cols->op_cap : count;
+        if (!(*COLUMN_PTR (cols, i) = malloc ((n ? n : 1) * column_list[i].itemsize)))
+            return 0;
+    }
+    return (cols->operand_start = malloc ((count + 1) * sizeof (uint32_t))) != NULL;
+}
+
+static int
+decode_columns_grow (decode_columns_t *cols)
+{
+    size_t cap = cols->op_cap * 2;
+
+    for (size_t i = 0; i < COLUMN_COUNT; i++) {
+        if (!column_list[i].operand) continue;
+
+        void *p = realloc (*COLUMN_PTR (cols, i), cap * column_list[i].itemsize);
+        if (!p) return 0;
+        *COLUMN_PTR (cols, i) = p;
+    }
+    cols->op_cap = cap;
+    return 1;
+}
+
+/* Little-endian opcode at word `i` of the buffer */
+static inline uint32_t
+_read_opcode (const uint8_t *buf, size_t i)
+{
+    return libarch_load_opcode (buf + i * 4, LIBARCH_BYTE_ORDER_LITTLE);
+}
+
+static int
+decode_into (decode_columns_t *cols, const uint8_t *buf, size_t count, uint64_t addr)
+{
+    libarch_ctx_t ctx;
+    int ret = 1;
+
+    libarch_ctx_init (&ctx);
+
+    for (size_t i = 0; i < count; i++) {
+        uint64_t pc = addr + i * 4;
+        instruction_t *instr = libarch_instruction_create_ctx (&ctx, _read_opcode (buf, i), pc);
+        if (!instr) {
+            ret = 0;
+            break;
+        }
+
+        cols->status[i] = (uint8_t) libarch_disass_ctx (&ctx, &instr);
+        cols->addr[i] = pc;
+        cols->opcode[i] = instr->opcode;
+        cols->type[i] = (uint32_t) instr->type;
+        cols->group[i] = (uint8_t) instr->group;
+        cols->subgroup[i] = (uint16_t) instr->subgroup;
+        cols->cond[i] = (int8_t) instr->cond;
+        cols->spec[i] = (int8_t) instr->spec;
+        cols->operand_start[i] = (uint32_t) cols->op_len;
+
+        while (cols->op_len + instr->operands_len > cols->op_cap)
+            if (!decode_columns_grow (cols)) {
+                libarch_instruction_free (instr);
+                ret = 0;
+                goto done;
+            }
+
+        for (uint32_t k = 0; k < instr->operands_len; k++) {
+            const operand_t *op = &instr->operands[k];
+            size_t j = cols->op_len++;
+
+            cols->op_type[j] = op->op_type;
+            cols->op_reg[j] = 0;
+            cols->op_size[j] = 0;
+            cols->op_reg_type[j] = 0;
+            cols->op_spec[j] = -1;
+            cols->op_value[j] = 0;
+            cols->op_extra[j] = 0;
+
+            switch (op->op_type) {
+                case ARM64_OPERAND_TYPE_REGISTER:
+                    cols->op_reg[j] = libarch_operand_get_register (op);
+                    cols->op_size[j] = libarch_operand_get_register_size (op);
+                    cols->op_reg_type[j] = libarch_operand_get_register_type (op);
+                    cols->op_spec[j] = (int8_t) libarch_operand_get_arrangement (op);
+                    cols->op_extra[j] = libarch_operand_get_index (op);
+                    break;
+                case ARM64_OPERAND_TYPE_IMMEDIATE:
+                    cols->op_value[j] = libarch_operand_get_immediate (op);
+                    cols->op_extra[j] = libarch_operand_get_immediate_type (op);
+                    break;
+                case ARM64_OPERAND_TYPE_SHIFT:
+                    cols->op_value[j] = libarch_operand_get_shift (op);
+                    cols->op_extra[j] = libarch_operand_get_shift_type (op);
+                    break;
+                case ARM64_OPERAND_TYPE_TARGET:
+                    break;
+                default:
+                    cols->op_value[j] = (uint64_t) (int64_t) libarch_operand_get_extra (op);
+                    cols->op_extra[j] = libarch_operand_get_extra_val (op);
+                    break;
+            }
+        }
+        libarch_instruction_free (instr);
+    }
+
+done:
+    cols->operand_start[count] = (uint32_t) cols->op_len;
+    libarch_ctx_cleanup (&ctx);
+    return ret;
+}
+
+PyDoc_STRVAR (decode_doc,
+"decode(buffer, addr=0) -> dict\n\n"
+"Decode every 4-byte little-endian word of `buffer`, numbering them from\n"
+"`addr`. Any trailing bytes are ignored. The buffer is read in place, with\n"
+"the GIL released. Returns a dict of Column objects.");
+
+static PyObject *
+libarch_py_decode (PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = { "buffer", "addr", NULL };
+    unsigned long long addr = 0;
+    decode_columns_t cols;
+    PyObject *obj, *result;
+    Py_buffer view;
+    int ok;
+
+    if (!PyArg_ParseTupleAndKeywords (args, kwargs, "O|K", kwlist, &obj, &addr))
+        return NULL;
+    if (PyObject_GetBuffer (obj, &view, PyBUF_C_CONTIGUOUS) < 0)
+        return NULL;
+
+    size_t count = (size_t) view.len / 4;
+
+    if (!decode_columns_alloc (&cols, count)) {
+        decode_columns_free (&cols);
+        PyBuffer_Release (&view);
+        return PyErr_NoMemory ();
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = decode_into (&cols, (const uint8_t *) view.buf, count, (uint64_t) addr);
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release (&view);
+
+    if (!ok) {
+        decode_columns_free (&cols);
+        return PyErr_NoMemory ();
+    }
+
+    /* Each column takes ownership of it's array as it's added */
+    if (!(result = PyDict_New ())) {
+        decode_columns_free (&cols);
+        return NULL;
+    }
+
+    PyObject *start = column_new (cols.operand_start, (Py_ssize_t) count + 1, 4, "I");
+    cols.operand_start = NULL;
+    ok = start && PyDict_SetItemString (result, "operand_start", start) == 0;
+    Py_XDECREF (start);
+
+    for (size_t i = 0; i < COLUMN_COUNT; i++) {
+        void **data = COLUMN_PTR (&cols, i);
+        Py_ssize_t len = column_list[i].operand ? (Py_ssize_t) cols.op_len : (Py_ssize_t) count;
+
+        if (!ok) break;
+
+        PyObject *col = column_new (*data, len, column_list[i].itemsize, column_list[i].format);
+        *data = NULL;
+        ok = col && PyDict_SetItemString (result, column_list[i].name, col) == 0;
+        Py_XDECREF (col);
+    }
+
+    decode_columns_free (&cols);
+    if (!ok) {
+        Py_DECREF (result);
+        return NULL;
+    }
+    return result;
+}
+
+
+PyDoc_STRVAR (disassemble_doc,
+"disassemble(buffer, addr=0) -> list\n\n"
+"Decode and format every 4-byte little-endian word of `buffer`, returning\n"
+"a list of strings.");
+
+static PyObject *
+libarch_py_disassemble (PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = { "buffer", "addr", NULL };
+    unsigned long long addr = 0;
+    char text[LIBARCH_FORMAT_MAX_LEN];
+    libarch_ctx_t ctx;
+    PyObject *obj, *list;
+    Py_buffer view;
+
+    if (!PyArg_ParseTupleAndKeywords (args, kwargs, "O|K", kwlist, &obj, &addr))
+        return NULL;
+    if (PyObject_GetBuffer (obj, &view, PyBUF_C_CONTIGUOUS) < 0)
+        return NULL;
+
+    size_t count = (size_t) view.len / 4;
+    if (!(list = PyList_New ((Py_ssize_t) count))) {
+        PyBuffer_Release (&view);
+        return NULL;
+    }
+
+    libarch_ctx_init (&ctx);
+    for (size_t i = 0; i < count; i++) {
+        instruction_t *instr = libarch_instruction_create_ctx (&ctx, _read_opcode (view.buf, i), addr + i * 4);
+        if (!instr) {
+            PyErr_NoMemory ();
+            goto fail;
+        }
+
+        libarch_disass_ctx (&ctx, &instr);
+        libarch_format_instruction (&ctx, instr, text, sizeof (text));
+        libarch_instruction_free (instr);
+
+        PyObject *str = PyUnicode_FromString (text);
+        if (!str) goto fail;
+        PyList_SET_ITEM (list, (Py_ssize_t) i, str);
+    }
+
+    libarch_ctx_cleanup (&ctx);
+    PyBuffer_Release (&view);
+    return list;
+
+fail:
+    libarch_ctx_cleanup (&ctx);
+    PyBuffer_Release (&view);
+    Py_DECREF (list);
+    return NULL;
+}
+
+
+/******************************************************************************
+*       Module
+*******************************************************************************/
+
+static PyMethodDef libarch_methods[] = {
+    { "decode", (PyCFunction) (void (*) (void)) libarch_py_decode, METH_VARARGS | METH_KEYWORDS, decode_doc },
+    { "disassemble", (PyCFunction) (void (*) (void)) libarch_py_disassemble, METH_VARARGS | METH_KEYWORDS, disassemble_doc },
+    { NULL, NULL, 0, NULL },
+};
+
+static struct PyModuleDef libarch_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "libarch._libarch",
+    .m_doc = "Libarch AArch64 disassembler bindings.",
+    .m_size = -1,
+    .m_methods = libarch_methods,
+};
+
+PyMODINIT_FUNC
+PyInit__libarch (void)
+{
+    PyObject *m, *names;
+
+    if (PyType_Ready (&column_type) < 0)
+        return NULL;
+    if (!(m = PyModule_Create (&libarch_module)))
+        return NULL;
+
+    Py_INCREF (&column_type);
+    if (PyModule_AddObject (m, "Column", (PyObject *) &column_type) < 0) {
+        Py_DECREF (&column_type);
+        goto fail;
+    }
+
+    /* Mnemonics, indexed by the `type` column */
+    if (!(names = PyTuple_New ((Py_ssize_t) A64_INSTRUCTIONS_STR_LEN)))
+        goto fail;
+    for (uint64_t i = 0; i < A64_INSTRUCTIONS_STR_LEN; i++) {
+        PyObject *s = PyUnicode_FromString (A64_INSTRUCTIONS_STR[i] ? A64_INSTRUCTIONS_STR[i] : "");
+        if (!s) {
+            Py_DECREF (names);
+            goto fail;
+        }
+        PyTuple_SET_ITEM (names, (Py_ssize_t) i, s);
+    }
+    if (PyModule_AddObject (m, "MNEMONICS", names) < 0) {
+        Py_DECREF (names);
+        goto fail;
+    }
+
+    if (PyModule_AddIntConstant (m, "OPERAND_TYPE_REGISTER", ARM64_OPERAND_TYPE_REGISTER) < 0 ||
+        PyModule_AddIntConstant (m, "OPERAND_TYPE_SHIFT", ARM64_OPERAND_TYPE_SHIFT) < 0 ||
+        PyModule_AddIntConstant (m, "OPERAND_TYPE_IMMEDIATE", ARM64_OPERAND_TYPE_IMMEDIATE) < 0 ||
+        PyModule_AddIntConstant (m, "OPERAND_TYPE_TARGET", ARM64_OPERAND_TYPE_TARGET) < 0 ||
+        PyModule_AddIntConstant (m, "DECODE_STATUS_SUCCESS", LIBARCH_DECODE_STATUS_SUCCESS) < 0)
+        goto fail;
+
+    return m;
+
+fail:
+    Py_DECREF (m);
+    return NULL;
+}
@@ -0,0 +1,458 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "alias.h"
+
+/**
+ *  Preferred aliases are picked after decoding, from the canonical instruction
+ *  the decoder produced. Each rule checks the opcode fields, changes the type
+ *  and then removes or rewrites the operands that differ, so the operands that
+ *  both forms share are never rebuilt.
+ */
+
+/* Width of the general purpose registers, from the sf bit */
+#define ALIAS_SIZE(sf)          ((sf) ? 64 : 32)
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_remove_operand (instruction_t *instr, uint32_t i)
+{
+    memmove (&instr->operands[i], &instr->operands[i + 1], (instr->operands_len - i - 1) * sizeof (operand_t));
+    instr->operands_len--;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_set_immediate (operand_t *op, uint64_t bits, uint8_t type, uint16_t opts)
+{
+    op->imm.type = type;
+    op->imm.opts = opts;
+    op->val.imm_bits = bits;
+}
+
+/* Replace the last two immediates of a bitfield instruction with lsb and width */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_set_lsb_width (instruction_t *instr, unsigned lsb, unsigned width)
+{
+    operand_t *op = &instr->operands[instr->operands_len - 2];
+
+    _set_immediate (&op[0], lsb, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    _set_immediate (&op[1], width, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+}
+
+
+/******************************************************************************
+*       Data Processing (Immediate)
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_add_subtract_immediate (instruction_t *instr)
+{
+    unsigned sh = select_bits (instr->opcode, 22, 22);
+    unsigned imm12 = select_bits (instr->opcode, 10, 21);
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+    unsigned Rd = select_bits (instr->opcode, 0, 4);
+
+    /* MOV (to/from SP) */
+    if (instr->type == ARM64_INSTRUCTION_ADD && sh == 0 && imm12 == 0 && (Rd == 0x1f || Rn == 0x1f)) {
+        instr->type = ARM64_INSTRUCTION_MOV;
+        instr->operands_len = 2;
+
+    /* CMN / CMP */
+    } else if ((instr->type == ARM64_INSTRUCTION_ADDS || instr->type == ARM64_INSTRUCTION_SUBS) && Rd == 0x1f) {
+        instr->type = (instr->type == ARM64_INSTRUCTION_ADDS) ? ARM64_INSTRUCTION_CMN : ARM64_INSTRUCTION_CMP;
+        _remove_operand (instr, 0);
+
+    } else {
+        return LIBARCH_RETURN_FAILURE;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_logical_immediate (instruction_t *instr)
+{
+    unsigned sf = select_bits (instr->opcode, 31, 31);
+    unsigned N = select_bits (instr->opcode, 22, 22);
+    unsigned immr = select_bits (instr->opcode, 16, 21);
+    unsigned imms = select_bits (instr->opcode, 10, 15);
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+    unsigned Rd = select_bits (instr->opcode, 0, 4);
+
+    /* MOV (bitmask immediate), unless MOVZ or MOVN could encode it */
+    if (instr->type == ARM64_INSTRUCTION_ORR && Rn == 0x1f && !arm64_move_wide_preferred (sf, N, imms, immr)) {
+        instr->type = ARM64_INSTRUCTION_MOV;
+        _remove_operand (instr, 1);
+        instr->operands[1].imm.opts = ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL;
+
+    /* TST (immediate) */
+    } else if (instr->type == ARM64_INSTRUCTION_ANDS && Rd == 0x1f) {
+        instr->type = ARM64_INSTRUCTION_TST;
+        _remove_operand (instr, 0);
+
+    } else {
+        return LIBARCH_RETURN_FAILURE;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_move_wide_immediate (instruction_t *instr)
+{
+    unsigned sf = select_bits (instr->opcode, 31, 31);
+    unsigned hw = select_bits (instr->opcode, 21, 22);
+    unsigned imm16 = select_bits (instr->opcode, 5, 20);
+
+    /**
+     *  MOVZ and MOVN are written as MOV unless the immediate is zero with a
+     *  shift, which MOV can't tell apart from the unshifted form. A 32-bit
+     *  MOVN of 0xffff is also left alone, as it's the same as MOVZ #0xffff0000.
+     */
+    if (instr->type == ARM64_INSTRUCTION_MOVZ) {
+        if (imm16 == 0 && hw != 0) return LIBARCH_RETURN_FAILURE;
+    } else if (instr->type == ARM64_INSTRUCTION_MOVN) {
+        if ((imm16 == 0 && hw != 0) || (sf == 0 && imm16 == 0xffff)) return LIBARCH_RETURN_FAILURE;
+    } else {
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    uint64_t imm = (uint64_t) imm16 << (hw << 4);
+    if (instr->type == ARM64_INSTRUCTION_MOVN) imm = ~imm;
+
+    /* The decoder widens the 32-bit forms to 64 bits if hw is out of range */
+    int imm_type = ARM64_IMMEDIATE_TYPE_LONG;
+    if (instr->operands[0].reg.size == 32) {
+        imm = (uint64_t) (int64_t) (int32_t) imm;
+        imm_type = ARM64_IMMEDIATE_TYPE_INT;
+    }
+
+    instr->type = ARM64_INSTRUCTION_MOV;
+    instr->operands_len = 2;
+    _set_immediate (&instr->operands[1], imm, imm_type, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_bitfield (instruction_t *instr)
+{
+    unsigned sf = select_bits (instr->opcode, 31, 31);
+    unsigned immr = select_bits (instr->opcode, 16, 21);
+    unsigned imms = select_bits (instr->opcode, 10, 15);
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+    unsigned size = ALIAS_SIZE (sf);
+
+    /**
+     *  Bitfield aliases in the order the Arm ARM checks them. The insert
+     *  forms, where imms < immr, take the lsb and width of the destination,
+     *  and the extract forms the lsb and width of the source.
+     */
+    unsigned ins_lsb = (size - immr) & (size - 1), ins_width = imms + 1;
+    unsigned ext_lsb = immr, ext_width = imms + 1 - immr;
+
+    if (instr->type == ARM64_INSTRUCTION_SBFM) {
+
+        /* ASR (immediate) */
+        if (imms == size - 1) {
+            instr->type = ARM64_INSTRUCTION_ASR;
+            instr->operands_len = 3;
+
+        /* SBFIZ */
+        } else if (imms < immr) {
+            instr->type = ARM64_INSTRUCTION_SBFIZ;
+            _set_lsb_width (instr, ins_lsb, ins_width);
+
+        /* SBFX */
+        } else if (arm64_bfx_preferred (sf, 0, imms, immr)) {
+            instr->type = ARM64_INSTRUCTION_SBFX;
+            _set_lsb_width (instr, ext_lsb, ext_width);
+
+        /* SXTB / SXTH / SXTW, which always extend a W register */
+        } else if (immr == 0 && (imms == 7 || imms == 15 || imms == 31)) {
+            instr->type = (imms == 7) ? ARM64_INSTRUCTION_SXTB : (imms == 15) ? ARM64_INSTRUCTION_SXTH : ARM64_INSTRUCTION_SXTW;
+            instr->operands[1].reg.size = 32;
+            instr->operands_len = 2;
+
+        } else {
+            return LIBARCH_RETURN_FAILURE;
+        }
+
+    } else if (instr->type == ARM64_INSTRUCTION_BFM) {
+
+        /* BFC / BFI */
+        if (imms < immr) {
+            instr->type = (Rn == 0x1f) ? ARM64_INSTRUCTION_BFC : ARM64_INSTRUCTION_BFI;
+            if (Rn == 0x1f) _remove_operand (instr, 1);
+            _set_lsb_width (instr, ins_lsb, ins_width);
+
+        /* BFXIL */
+        } else {
+            instr->type = ARM64_INSTRUCTION_BFXIL;
+            _set_lsb_width (instr, ext_lsb, ext_width);
+        }
+
+    } else if (instr->type == ARM64_INSTRUCTION_UBFM) {
+
+        /* LSL (immediate) */
+        if (imms != size - 1 && imms + 1 == immr) {
+            instr->type = ARM64_INSTRUCTION_LSL;
+            _set_immediate (&instr->operands[2], size - 1 - imms, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+            instr->operands_len = 3;
+
+        /* LSR (immediate) */
+        } else if (imms == size - 1) {
+            instr->type = ARM64_INSTRUCTION_LSR;
+            instr->operands_len = 3;
+
+        /* UBFIZ */
+        } else if (imms < immr) {
+            instr->type = ARM64_INSTRUCTION_UBFIZ;
+            _set_lsb_width (instr, ins_lsb, ins_width);
+
+        /* UBFX */
+        } else if (arm64_bfx_preferred (sf, 1, imms, immr)) {
+            instr->type = ARM64_INSTRUCTION_UBFX;
+            _set_lsb_width (instr, ext_lsb, ext_width);
+
+        /* UXTB / UXTH */
+        } else if (immr == 0 && (imms == 7 || imms == 15)) {
+            instr->type = (imms == 7) ? ARM64_INSTRUCTION_UXTB : ARM64_INSTRUCTION_UXTH;
+            instr->operands_len = 2;
+
+        } else {
+            return LIBARCH_RETURN_FAILURE;
+        }
+
+    } else {
+        return LIBARCH_RETURN_FAILURE;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_extract (instruction_t *instr)
+{
+    unsigned Rm = select_bits (instr->opcode, 16, 20);
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+
+    /* ROR (immediate), where both sources are the same register */
+    if (instr->type != ARM64_INSTRUCTION_EXTR || Rn != Rm) return LIBARCH_RETURN_FAILURE;
+    instr->type = ARM64_INSTRUCTION_ROR;
+    _remove_operand (instr, 2);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+/******************************************************************************
+*       Data Processing (Register)
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_logical_shifted_register (instruction_t *instr)
+{
+    unsigned shift = select_bits (instr->opcode, 22, 23);
+    unsigned imm6 = select_bits (instr->opcode, 10, 15);
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+    unsigned Rd = select_bits (instr->opcode, 0, 4);
+
+    /* MOV (register) */
+    if (instr->type == ARM64_INSTRUCTION_ORR && Rn == 0x1f && shift == 0 && imm6 == 0) {
+        instr->type = ARM64_INSTRUCTION_MOV;
+        _remove_operand (instr, 1);
+
+    /* MVN */
+    } else if (instr->type == ARM64_INSTRUCTION_ORN && Rn == 0x1f) {
+        instr->type = ARM64_INSTRUCTION_MVN;
+        _remove_operand (instr, 1);
+
+    /* TST (shifted register) */
+    } else if (instr->type == ARM64_INSTRUCTION_ANDS && Rd == 0x1f) {
+        instr->type = ARM64_INSTRUCTION_TST;
+        _remove_operand (instr, 0);
+
+    } else {
+        return LIBARCH_RETURN_FAILURE;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_add_subtract_register (instruction_t *instr)
+{
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+    unsigned Rd = select_bits (instr->opcode, 0, 4);
+    int shifted = (instr->subgroup == ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_SHIFTED_REGISTER);
+
+    /* CMN / CMP, for both the shifted and extended register forms */
+    if ((instr->type == ARM64_INSTRUCTION_ADDS || instr->type == ARM64_INSTRUCTION_SUBS) && Rd == 0x1f) {
+        instr->type = (instr->type == ARM64_INSTRUCTION_ADDS) ? ARM64_INSTRUCTION_CMN : ARM64_INSTRUCTION_CMP;
+        _remove_operand (instr, 0);
+
+    /* NEG / NEGS, where Rn is the zero register */
+    } else if (shifted && (instr->type == ARM64_INSTRUCTION_SUB || instr->type == ARM64_INSTRUCTION_SUBS) && Rn == 0x1f) {
+        instr->type = (instr->type == ARM64_INSTRUCTION_SUB) ? ARM64_INSTRUCTION_NEG : ARM64_INSTRUCTION_NEGS;
+        _remove_operand (instr, 1);
+
+    } else {
+        return LIBARCH_RETURN_FAILURE;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_add_subtract_with_carry (instruction_t *instr)
+{
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+
+    /* NGC / NGCS */
+    if ((instr->type == ARM64_INSTRUCTION_SBC || instr->type == ARM64_INSTRUCTION_SBCS) && Rn == 0x1f) {
+        instr->type = (instr->type == ARM64_INSTRUCTION_SBC) ? ARM64_INSTRUCTION_NGC : ARM64_INSTRUCTION_NGCS;
+        _remove_operand (instr, 1);
+        return LIBARCH_RETURN_SUCCESS;
+    }
+    return LIBARCH_RETURN_FAILURE;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_conditional_select (instruction_t *instr)
+{
+    unsigned Rm = select_bits (instr->opcode, 16, 20);
+    unsigned cond = select_bits (instr->opcode, 12, 15);
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+
+    /**
+     *  The aliases are used when both sources are the same register, and
+     *  apply the inverted condition. They aren't used for AL/NV, as those
+     *  can't be inverted.
+     */
+    typedef struct { arm64_instr_t type, same_src, zero_src; } alias_t;
+    static const alias_t alias_table[] = {
+        { ARM64_INSTRUCTION_CSINC, ARM64_INSTRUCTION_CINC, ARM64_INSTRUCTION_CSET },
+        { ARM64_INSTRUCTION_CSINV, ARM64_INSTRUCTION_CINV, ARM64_INSTRUCTION_CSETM },
+        { ARM64_INSTRUCTION_CSNEG, ARM64_INSTRUCTION_CNEG, ARM64_INSTRUCTION_UNK },
+    };
+    const alias_t *entry = NULL;
+
+    for (size_t i = 0; i < sizeof (alias_table) / sizeof (alias_t); i++)
+        if (alias_table[i].type == instr->type) entry = &alias_table[i];
+
+    if (!entry || Rn != Rm || (cond >> 1) == 7) return LIBARCH_RETURN_FAILURE;
+
+    /* CSET / CSETM */
+    if (entry->zero_src != ARM64_INSTRUCTION_UNK && Rn == 0x1f) {
+        instr->type = entry->zero_src;
+        _remove_operand (instr, 1);
+
+    /* CINC / CINV / CNEG */
+    } else {
+        instr->type = entry->same_src;
+    }
+    _remove_operand (instr, instr->operands_len - 2);
+    instr->operands[instr->operands_len - 1].val.extra = cond ^ 1;
+
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_alias_data_processing_3_source (instruction_t *instr)
+{
+    unsigned Ra = select_bits (instr->opcode, 10, 14);
+
+    typedef struct { arm64_instr_t type, alias; } alias_t;
+    static const alias_t alias_table[] = {
+        { ARM64_INSTRUCTION_MADD, ARM64_INSTRUCTION_MUL },
+        { ARM64_INSTRUCTION_MSUB, ARM64_INSTRUCTION_MNEG },
+        { ARM64_INSTRUCTION_SMADDL, ARM64_INSTRUCTION_SMULL },
+        { ARM64_INSTRUCTION_SMSUBL, ARM64_INSTRUCTION_SMNEGL },
+        { ARM64_INSTRUCTION_UMADDL, ARM64_INSTRUCTION_UMULL },
+        { ARM64_INSTRUCTION_UMSUBL, ARM64_INSTRUCTION_UMNEGL },
+    };
+
+    /* MUL / MNEG / SMULL / SMNEGL / UMULL / UMNEGL, without the accumulator */
+    if (Ra != 0x1f) return LIBARCH_RETURN_FAILURE;
+    for (size_t i = 0; i < sizeof (alias_table) / sizeof (alias_t); i++) {
+        if (alias_table[i].type == instr->type) {
+            instr->type = alias_table[i].alias;
+            instr->operands_len = 3;
+            return LIBARCH_RETURN_SUCCESS;
+        }
+    }
+    return LIBARCH_RETURN_FAILURE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+libarch_return_t
+libarch_alias_instruction (instruction_t *instr)
+{
+    libarch_return_t ret = LIBARCH_RETURN_FAILURE;
+
+    if (instr->group == ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE) {
+        switch (instr->subgroup) {
+            case ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_IMMEDIATE:
+                ret = _alias_add_subtract_immediate (instr);
+                break;
+            case ARM64_DECODE_SUBGROUP_LOGICAL_IMMEDIATE:
+                ret = _alias_logical_immediate (instr);
+                break;
+            case ARM64_DECODE_SUBGROUP_MOVE_WIDE_IMMEDIATE:
+                ret = _alias_move_wide_immediate (instr);
+                break;
+            case ARM64_DECODE_SUBGROUP_BITFIELD:
+                ret = _alias_bitfield (instr);
+                break;
+            case ARM64_DECODE_SUBGROUP_EXTRACT:
+                ret = _alias_extract (instr);
+                break;
+        }
+
+    } else if (instr->group == ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER) {
+        switch (instr->subgroup) {
+            case ARM64_DECODE_SUBGROUP_LOGICAL_SHIFTED_REGISTER:
+                ret = _alias_logical_shifted_register (instr);
+                break;
+            case ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_SHIFTED_REGISTER:
+            case ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_EXTENDED_REGISTER:
+                ret = _alias_add_subtract_register (instr);
+                break;
+            case ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_WITH_CARRY:
+                ret = _alias_add_subtract_with_carry (instr);
+                break;
+            case ARM64_DECODE_SUBGROUP_CONDITIONAL_SELECT:
+                ret = _alias_conditional_select (instr);
+                break;
+            case ARM64_DECODE_SUBGROUP_DATA_PROCESSING_3_SOURCE:
+                ret = _alias_data_processing_3_source (instr);
+                break;
+        }
+    }
+
+    instr->raw = 0;
+    return ret;
+}
@@ -0,0 +1,774 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "assembler.h"
+
+#include "arm64/arm64-common.h"
+#include "arm64/arm64-instructions.h"
+#include "arm64/arm64-registers.h"
+#include "arm64/arm64-tlbi-ops.h"
+#include "arm64/arm64-translation.h"
+
+/**
+ *  The encoders mirror the decoders in src/decoder/. Each one reads the
+ *  operands in the order the decoder adds them and packs the fields back in
+ *  left-right order. An encoder returns LIBARCH_RETURN_FAILURE if the operands
+ *  don't match the shape it expects, so several encoders can be listed for the
+ *  same instruction type, e.g. the different forms of MOV.
+ */
+typedef libarch_return_t (*encode_func_t) (const instruction_t *instr, uint32_t *opcode);
+
+
+/******************************************************************************
+*       Operand Helpers
+*******************************************************************************/
+
+/* Fetch operand `idx` if it exists and has the given type */
+LIBARCH_PRIVATE LIBARCH_API
+const operand_t *
+_operand (const instruction_t *instr, uint32_t idx, uint8_t type)
+{
+    const operand_t *op = libarch_instruction_get_operand (instr, idx);
+    return (op && libarch_operand_get_type (op) == type) ? op : NULL;
+}
+
+/**
+ *  Fetch a general purpose register operand, setting `reg` to it's encoding
+ *  and `sf` to 1 for a 64-bit register. Both the stack pointer and the zero
+ *  register are encoded as 31, so `sp` is set if the caller needs to tell
+ *  them apart.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_gp_register (const instruction_t *instr, uint32_t idx, unsigned *reg, unsigned *sf, int *sp)
+{
+    const operand_t *op = _operand (instr, idx, ARM64_OPERAND_TYPE_REGISTER);
+    if (!op) return LIBARCH_RETURN_FAILURE;
+
+    arm64_reg_t r = libarch_operand_get_register (op);
+    uint8_t size = libarch_operand_get_register_size (op);
+    uint8_t type = libarch_operand_get_register_type (op);
+
+    if (type != ARM64_REGISTER_TYPE_GENERAL && type != ARM64_REGISTER_TYPE_ZERO) return LIBARCH_RETURN_FAILURE;
+    if ((size != 32 && size != 64) || r > ARM64_REG_XZR) return LIBARCH_RETURN_FAILURE;
+
+    *reg = (r > 31) ? 31 : r;
+    if (sf) *sf = (size == 64);
+    if (sp) *sp = (r == ARM64_REG_SP && type == ARM64_REGISTER_TYPE_GENERAL);
+
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+/* Fetch an immediate operand of any type */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_immediate (const instruction_t *instr, uint32_t idx, uint64_t *imm)
+{
+    const operand_t *op = _operand (instr, idx, ARM64_OPERAND_TYPE_IMMEDIATE);
+    if (!op) return LIBARCH_RETURN_FAILURE;
+
+    *imm = libarch_operand_get_immediate (op);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+/**
+ *  Fetch an optional LSL operand. `shift` is left at zero if there is no
+ *  operand at `idx`.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_lsl (const instruction_t *instr, uint32_t idx, unsigned *shift)
+{
+    const operand_t *op = libarch_instruction_get_operand (instr, idx);
+
+    *shift = 0;
+    if (!op) return LIBARCH_RETURN_SUCCESS;
+
+    if (libarch_operand_get_type (op) != ARM64_OPERAND_TYPE_SHIFT ||
+        libarch_operand_get_shift_type (op) != ARM64_SHIFT_TYPE_LSL)
+        return LIBARCH_RETURN_FAILURE;
+
+    *shift = libarch_operand_get_shift (op);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+/**
+ *  Calculate the word offset from the instruction to the label at operand
+ *  `idx`, checking it's aligned and fits in a signed field of `bits` bits.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_label (const instruction_t *instr, uint32_t idx, unsigned bits, uint32_t *field)
+{
+    uint64_t target;
+    if (!_immediate (instr, idx, &target)) return LIBARCH_RETURN_FAILURE;
+
+    int64_t offset = (int64_t) (target - instr->addr);
+    int64_t limit = (int64_t) 1 << (bits - 1);
+
+    if (offset & 3) return LIBARCH_RETURN_FAILURE;
+    if ((offset >> 2) < -limit || (offset >> 2) >= limit) return LIBARCH_RETURN_FAILURE;
+
+    *field = (uint32_t) (offset >> 2) & ((1U << bits) - 1);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+/******************************************************************************
+*       Branches, Exception Generating and System Instructions
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_branch_immediate (const instruction_t *instr, uint32_t *opcode)
+{
+    uint32_t imm;
+
+    if (instr->operands_len != 1) return LIBARCH_RETURN_FAILURE;
+
+    /* B.cond */
+    if (instr->type == ARM64_INSTRUCTION_B && instr->cond != -1) {
+        if (instr->cond > 15 || !_label (instr, 0, 19, &imm)) return LIBARCH_RETURN_FAILURE;
+        *opcode = 0x54000000 | (imm << 5) | instr->cond;
+
+    /* B / BL */
+    } else {
+        if (!_label (instr, 0, 26, &imm)) return LIBARCH_RETURN_FAILURE;
+        *opcode = ((instr->type == ARM64_INSTRUCTION_BL) ? 0x94000000 : 0x14000000) | imm;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_compare_and_branch_immediate (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned sf, Rt, op = (instr->type == ARM64_INSTRUCTION_CBNZ);
+    uint32_t imm19;
+
+    if (instr->operands_len != 2) return LIBARCH_RETURN_FAILURE;
+    if (!_gp_register (instr, 0, &Rt, &sf, NULL) || !_label (instr, 1, 19, &imm19))
+        return LIBARCH_RETURN_FAILURE;
+
+    *opcode = (sf << 31) | 0x34000000 | (op << 24) | (imm19 << 5) | Rt;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_test_and_branch_immediate (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned sf, Rt, op = (instr->type == ARM64_INSTRUCTION_TBNZ);
+    uint64_t bit;
+    uint32_t imm14;
+
+    if (instr->operands_len != 3) return LIBARCH_RETURN_FAILURE;
+    if (!_gp_register (instr, 0, &Rt, &sf, NULL) || !_immediate (instr, 1, &bit) || !_label (instr, 2, 14, &imm14))
+        return LIBARCH_RETURN_FAILURE;
+
+    /* The bit number has to fit in the register */
+    if (bit >= (sf ? 64 : 32)) return LIBARCH_RETURN_FAILURE;
+
+    *opcode = ((bit >> 5) << 31) | 0x36000000 | (op << 24) | ((bit & 0x1f) << 19) | (imm14 << 5) | Rt;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_unconditional_branch_register (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned sf, Rn = 30;
+
+    /* RET defaults to x30, and the decoder omits the operand in that case */
+    if (instr->operands_len > 1 || (instr->operands_len == 0 && instr->type != ARM64_INSTRUCTION_RET))
+        return LIBARCH_RETURN_FAILURE;
+    if (instr->operands_len == 1 && (!_gp_register (instr, 0, &Rn, &sf, NULL) || !sf))
+        return LIBARCH_RETURN_FAILURE;
+
+    unsigned opc = (instr->type == ARM64_INSTRUCTION_BR) ? 0 : (instr->type == ARM64_INSTRUCTION_BLR) ? 1 : 2;
+    *opcode = 0xd61f0000 | (opc << 21) | (Rn << 5);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_exception_generation (const instruction_t *instr, uint32_t *opcode)
+{
+    /* opc:LL for each instruction, with imm16 between them */
+    struct {
+        arm64_instr_t   type;
+        uint32_t        base;
+    } opcode_table[] = {
+        { ARM64_INSTRUCTION_SVC, 0xd4000001 },
+        { ARM64_INSTRUCTION_HVC, 0xd4000002 },
+        { ARM64_INSTRUCTION_SMC, 0xd4000003 },
+        { ARM64_INSTRUCTION_BRK, 0xd4200000 },
+        { ARM64_INSTRUCTION_HLT, 0xd4400000 },
+    };
+    uint64_t imm16;
+
+    if (instr->operands_len != 1 || !_immediate (instr, 0, &imm16) || imm16 > 0xffff)
+        return LIBARCH_RETURN_FAILURE;
+
+    for (int i = 0; i < sizeof (opcode_table) / sizeof (opcode_table[0]); i++) {
+        if (opcode_table[i].type == instr->type) {
+            *opcode = opcode_table[i].base | ((uint32_t) imm16 << 5);
+            return LIBARCH_RETURN_SUCCESS;
+        }
+    }
+    return LIBARCH_RETURN_FAILURE;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_hints (const instruction_t *instr, uint32_t *opcode)
+{
+    /* CRm:op2 for the hints without operands, see decode_hints */
+    struct {
+        arm64_instr_t   type;
+        unsigned        imm;
+    } opcode_table[] = {
+        { ARM64_INSTRUCTION_NOP, 0 },
+        { ARM64_INSTRUCTION_YIELD, 1 },
+        { ARM64_INSTRUCTION_WFE, 2 },
+        { ARM64_INSTRUCTION_WFI, 3 },
+        { ARM64_INSTRUCTION_SEV, 4 },
+        { ARM64_INSTRUCTION_SEVL, 5 },
+        { ARM64_INSTRUCTION_DGH, 6 },
+        { ARM64_INSTRUCTION_XPACLRI, 7 },
+        { ARM64_INSTRUCTION_PACIA1716, 8 },
+        { ARM64_INSTRUCTION_PACIB1716, 10 },
+        { ARM64_INSTRUCTION_AUTIA1716, 12 },
+        { ARM64_INSTRUCTION_AUTIB1716, 14 },
+        { ARM64_INSTRUCTION_ESB, 16 },
+        { ARM64_INSTRUCTION_PSB_CSYNC, 17 },
+        { ARM64_INSTRUCTION_TSB_CSYNC, 18 },
+        { ARM64_INSTRUCTION_CSDB, 20 },
+        { ARM64_INSTRUCTION_PACIAZ, 24 },
+        { ARM64_INSTRUCTION_PACIASP, 25 },
+        { ARM64_INSTRUCTION_PACIBZ, 26 },
+        { ARM64_INSTRUCTION_PACIBSP, 27 },
+        { ARM64_INSTRUCTION_AUTIAZ, 28 },
+        { ARM64_INSTRUCTION_AUTIASP, 29 },
+        { ARM64_INSTRUCTION_AUTIBZ, 30 },
+        { ARM64_INSTRUCTION_AUTIBSP, 31 },
+    };
+    uint64_t imm = 0;
+
+    /* HINT #imm */
+    if (instr->type == ARM64_INSTRUCTION_HINT) {
+        if (instr->operands_len != 1 || !_immediate (instr, 0, &imm) || imm > 0x7f)
+            return LIBARCH_RETURN_FAILURE;
+
+    /* BTI {c|j|jc} */
+    } else if (instr->type == ARM64_INSTRUCTION_BTI) {
+        const char *targets[] = { "", "c", "j", "jc" };
+        const char *target = "";
+
+        if (instr->operands_len == 1) {
+            const operand_t *op = _operand (instr, 0, ARM64_OPERAND_TYPE_TARGET);
+            if (!op) return LIBARCH_RETURN_FAILURE;
+            target = libarch_operand_get_target (op);
+        }
+
+        for (imm = 0; imm < 4 && strcmp (targets[imm], target); imm++);
+        if (imm == 4) return LIBARCH_RETURN_FAILURE;
+        imm = 32 | (imm << 1);
+
+    } else {
+        int i;
+        for (i = 0; i < sizeof (opcode_table) / sizeof (opcode_table[0]); i++)
+            if (opcode_table[i].type == instr->type) break;
+
+        if (i == sizeof (opcode_table) / sizeof (opcode_table[0]) || instr->operands_len)
+            return LIBARCH_RETURN_FAILURE;
+        imm = opcode_table[i].imm;
+    }
+
+    *opcode = 0xd503201f | ((uint32_t) imm << 5);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_barriers (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned op2, CRm = 0b1111;
+
+    if (instr->type == ARM64_INSTRUCTION_DSB) op2 = 4;
+    else if (instr->type == ARM64_INSTRUCTION_DMB) op2 = 5;
+    else op2 = 6;
+
+    /* DSB and DMB take the barrier option, ISB is always 'sy' */
+    if (op2 != 6) {
+        const operand_t *op = _operand (instr, 0, ARM64_OPERAND_TYPE_MEMORY_BARRIER);
+        if (!op || instr->operands_len != 1) return LIBARCH_RETURN_FAILURE;
+        CRm = libarch_operand_get_extra (op) & 0xf;
+    } else if (instr->operands_len) {
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    *opcode = 0xd503301f | (CRm << 8) | (op2 << 5);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_system_register_move (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned L = (instr->type == ARM64_INSTRUCTION_MRS);
+    unsigned Rt, sf;
+    uint32_t sysreg;
+
+    /* MRS has Rt first, MSR has it last */
+    uint32_t rt_idx = (L) ? 0 : instr->operands_len - 1;
+    uint32_t sys_idx = (L) ? 1 : 0;
+
+    if (instr->operands_len < 2 || !_gp_register (instr, rt_idx, &Rt, &sf, NULL) || !sf)
+        return LIBARCH_RETURN_FAILURE;
+
+    /* Either a known system register, or S<op0>_<op1>_<Cn>_<Cm>_<op2> */
+    const operand_t *op = _operand (instr, sys_idx, ARM64_OPERAND_TYPE_REGISTER);
+    if (op && instr->operands_len == 2) {
+        if (libarch_operand_get_register_type (op) != ARM64_REGISTER_TYPE_SYSTEM)
+            return LIBARCH_RETURN_FAILURE;
+        sysreg = libarch_operand_get_register (op);
+
+    } else if (instr->operands_len == 6) {
+        uint64_t f[5];
+        for (int i = 0; i < 5; i++)
+            if (!_immediate (instr, sys_idx + i, &f[i])) return LIBARCH_RETURN_FAILURE;
+
+        if (f[0] < 2 || f[0] > 3 || f[1] > 7 || f[2] > 15 || f[3] > 15 || f[4] > 7)
+            return LIBARCH_RETURN_FAILURE;
+        sysreg = (f[0] << 14) | (f[1] << 11) | (f[2] << 7) | (f[3] << 3) | f[4];
+
+    } else {
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    /* op0 is 2 or 3, so bit 15 of the system register is always set */
+    if (!(sysreg & 0x8000) || sysreg > 0xffff) return LIBARCH_RETURN_FAILURE;
+
+    *opcode = 0xd5000000 | (L << 21) | (sysreg << 5) | Rt;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_system_instruction (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned L = 0, op1, CRn, CRm, op2, Rt = 0b11111, sf;
+    uint32_t idx = 0;
+    int encoding;
+
+    /* AT <at_op>, <Xt> */
+    if (instr->type == ARM64_INSTRUCTION_AT) {
+        const operand_t *op = _operand (instr, 0, ARM64_OPERAND_TYPE_AT_NAME);
+        if (!op || (encoding = arm64_at_encoding (libarch_operand_get_extra (op))) == -1)
+            return LIBARCH_RETURN_FAILURE;
+
+        CRn = 7;
+        idx = 1;
+
+    /* TLBI <tlbi_op>{, <Xt>} */
+    } else if (instr->type == ARM64_INSTRUCTION_TLBI) {
+        const operand_t *op = _operand (instr, 0, ARM64_OPERAND_TYPE_TLBI_OP);
+        if (!op || (encoding = arm64_tlbi_encoding (libarch_operand_get_extra (op))) == -1)
+            return LIBARCH_RETURN_FAILURE;
+
+        CRn = 8;
+        idx = 1;
+
+    /* SYS #<op1>, <Cn>, <Cm>, #<op2>{, <Xt>} and SYSL <Xt>, #<op1>, <Cn>, <Cm>, #<op2> */
+    } else {
+        uint64_t f[4];
+
+        if (instr->type == ARM64_INSTRUCTION_SYSL) {
+            if (!_gp_register (instr, idx++, &Rt, &sf, NULL)) return LIBARCH_RETURN_FAILURE;
+            L = 1;
+        }
+        for (int i = 0; i < 4; i++)
+            if (!_immediate (instr, idx++, &f[i])) return LIBARCH_RETURN_FAILURE;
+
+        if (f[0] > 7 || f[1] > 15 || f[2] > 15 || f[3] > 7) return LIBARCH_RETURN_FAILURE;
+        encoding = (f[0] << 7) | (f[2] << 3) | f[3];
+        CRn = f[1];
+    }
+
+    op1 = (encoding >> 7) & 0x7;
+    CRm = (encoding >> 3) & 0xf;
+    op2 = encoding & 0x7;
+
+    /* Optional trailing Xt */
+    if (!L && idx < instr->operands_len && !_gp_register (instr, idx++, &Rt, &sf, NULL))
+        return LIBARCH_RETURN_FAILURE;
+    if (idx != instr->operands_len) return LIBARCH_RETURN_FAILURE;
+
+    *opcode = 0xd5080000 | (L << 21) | (op1 << 16) | (CRn << 12) | (CRm << 8) | (op2 << 5) | Rt;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+/******************************************************************************
+*       Data Processing (Immediate)
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_pc_relative_addressing (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned op = (instr->type == ARM64_INSTRUCTION_ADRP);
+    unsigned Rd, sf;
+    uint64_t target;
+
+    if (instr->operands_len != 2 || !_gp_register (instr, 0, &Rd, &sf, NULL) || !sf || !_immediate (instr, 1, &target))
+        return LIBARCH_RETURN_FAILURE;
+
+    /* ADRP works in 4KB pages */
+    int64_t offset = (op) ? (int64_t) ((target & ~0xfffULL) - (instr->addr & ~0xfffULL)) >> 12
+                          : (int64_t) (target - instr->addr);
+    if (offset < -(1 << 20) || offset >= (1 << 20)) return LIBARCH_RETURN_FAILURE;
+
+    uint32_t immlo = offset & 0x3;
+    uint32_t immhi = (offset >> 2) & 0x7ffff;
+
+    *opcode = (op << 31) | (immlo << 29) | 0x10000000 | (immhi << 5) | Rd;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_add_subtract_immediate (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned op, S, Rd = 0b11111, Rn, sf, sf_n, sh;
+    uint32_t idx = 0;
+    uint64_t imm;
+
+    switch (instr->type) {
+        case ARM64_INSTRUCTION_ADD:  op = 0; S = 0; break;
+        case ARM64_INSTRUCTION_ADDS: op = 0; S = 1; break;
+        case ARM64_INSTRUCTION_CMN:  op = 0; S = 1; break;
+        case ARM64_INSTRUCTION_SUB:  op = 1; S = 0; break;
+        case ARM64_INSTRUCTION_SUBS: op = 1; S = 1; break;
+        case ARM64_INSTRUCTION_CMP:  op = 1; S = 1; break;
+        default: return LIBARCH_RETURN_FAILURE;
+    }
+
+    /* CMP and CMN have no destination */
+    int compare = (instr->type == ARM64_INSTRUCTION_CMP || instr->type == ARM64_INSTRUCTION_CMN);
+    if (!compare && !_gp_register (instr, idx++, &Rd, &sf, NULL)) return LIBARCH_RETURN_FAILURE;
+
+    if (!_gp_register (instr, idx++, &Rn, &sf_n, NULL) || !_immediate (instr, idx++, &imm) || !_lsl (instr, idx, &sh))
+        return LIBARCH_RETURN_FAILURE;
+    if (compare) sf = sf_n;
+
+    if (sf != sf_n || (sh != 0 && sh != 12) || instr->operands_len > idx + 1) return LIBARCH_RETURN_FAILURE;
+
+    /* Shift a 4KB aligned immediate down if no shift was given */
+    if (!sh && imm > 0xfff && !(imm & 0xfff)) {
+        imm >>= 12;
+        sh = 12;
+    }
+    if (imm > 0xfff) return LIBARCH_RETURN_FAILURE;
+
+    *opcode = (sf << 31) | (op << 30) | (S << 29) | 0x11000000 | ((sh == 12) << 22) | ((uint32_t) imm << 10) | (Rn << 5) | Rd;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_logical_immediate (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned opc, Rd = 0b11111, Rn = 0b11111, sf, sf_n, immN, immr, imms;
+    uint32_t idx = 0;
+    uint64_t imm;
+
+    switch (instr->type) {
+        case ARM64_INSTRUCTION_AND:  opc = 0; break;
+        case ARM64_INSTRUCTION_ORR:  opc = 1; break;
+        case ARM64_INSTRUCTION_MOV:  opc = 1; break;
+        case ARM64_INSTRUCTION_EOR:  opc = 2; break;
+        case ARM64_INSTRUCTION_ANDS: opc = 3; break;
+        case ARM64_INSTRUCTION_TST:  opc = 3; break;
+        default: return LIBARCH_RETURN_FAILURE;
+    }
+
+    /* TST has no destination, and MOV has no source */
+    if (instr->type != ARM64_INSTRUCTION_TST)
+        if (!_gp_register (instr, idx++, &Rd, &sf, NULL)) return LIBARCH_RETURN_FAILURE;
+    if (instr->type != ARM64_INSTRUCTION_MOV) {
+        if (!_gp_register (instr, idx++, &Rn, &sf_n, NULL)) return LIBARCH_RETURN_FAILURE;
+        if (instr->type == ARM64_INSTRUCTION_TST) sf = sf_n;
+        else if (sf != sf_n) return LIBARCH_RETURN_FAILURE;
+    }
+    if (!_immediate (instr, idx++, &imm) || idx != instr->operands_len) return LIBARCH_RETURN_FAILURE;
+
+    /* The inverse logical immediate table gives N:immr:imms for the value */
+    if (!sf) imm &= 0xffffffff;
+    if (arm64_encode_bitmasks (imm, (sf) ? 64 : 32, &immN, &immr, &imms) != 0)
+        return LIBARCH_RETURN_FAILURE;
+
+    *opcode = (sf << 31) | (opc << 29) | 0x12000000 | (immN << 22) | (immr << 16) | (imms << 10) | (Rn << 5) | Rd;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+uint32_t
+_move_wide (unsigned sf, unsigned opc, unsigned hw, unsigned imm16, unsigned Rd)
+{
+    return (sf << 31) | (opc << 29) | 0x12800000 | (hw << 21) | (imm16 << 5) | Rd;
+}
+
+
+/**
+ *  Find a single MOVZ or MOVN that loads `value`, preferring MOVZ, which is
+ *  the order the decoder picks the MOV alias in.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_move_wide_single (unsigned sf, uint64_t value, unsigned Rd, uint32_t *opcode)
+{
+    uint64_t mask = (sf) ? ~0ULL : 0xffffffffULL;
+    unsigned halfwords = (sf) ? 4 : 2;
+
+    /* MOVZ (opc 2) loads the value, MOVN (opc 0) loads it's inverse */
+    unsigned opcs[] = { 2, 0 };
+
+    value &= mask;
+    for (int i = 0; i < 2; i++) {
+        uint64_t v = (opcs[i] == 2) ? value : ~value & mask;
+
+        for (unsigned hw = 0; hw < halfwords; hw++) {
+            if ((v & ~(0xffffULL << (hw * 16))) == 0) {
+                *opcode = _move_wide (sf, opcs[i], hw, (v >> (hw * 16)) & 0xffff, Rd);
+                return LIBARCH_RETURN_SUCCESS;
+            }
+        }
+    }
+    return LIBARCH_RETURN_FAILURE;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_move_wide_immediate (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned opc, Rd, sf, shift;
+    uint64_t imm;
+    int sp;
+
+    if (instr->operands_len < 2 || !_gp_register (instr, 0, &Rd, &sf, &sp) || !_immediate (instr, 1, &imm))
+        return LIBARCH_RETURN_FAILURE;
+
+    /* MOV (wide immediate), Rd is the zero register so SP has to use ORR */
+    if (instr->type == ARM64_INSTRUCTION_MOV) {
+        if (sp || instr->operands_len != 2) return LIBARCH_RETURN_FAILURE;
+        return _move_wide_single (sf, imm, Rd, opcode);
+    }
+
+    if (instr->type == ARM64_INSTRUCTION_MOVN) opc = 0;
+    else if (instr->type == ARM64_INSTRUCTION_MOVZ) opc = 2;
+    else opc = 3;
+
+    if (!_lsl (instr, 2, &shift) || instr->operands_len > 3) return LIBARCH_RETURN_FAILURE;
+    if (imm > 0xffff || (shift & 0xf) || shift >= ((sf) ? 64 : 32)) return LIBARCH_RETURN_FAILURE;
+
+    *opcode = _move_wide (sf, opc, shift >> 4, imm, Rd);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+/******************************************************************************
+*       Data Processing (Register)
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+encode_move_register (const instruction_t *instr, uint32_t *opcode)
+{
+    unsigned Rd, Rm, sf, sf_m;
+    int sp_d, sp_m;
+
+    if (instr->operands_len != 2 || !_gp_register (instr, 0, &Rd, &sf, &sp_d) || !_gp_register (instr, 1, &Rm, &sf_m, &sp_m))
+        return LIBARCH_RETURN_FAILURE;
+    if (sf != sf_m) return LIBARCH_RETURN_FAILURE;
+
+    /* MOV to or from SP is ADD #0, otherwise ORR with the zero register */
+    if (sp_d || sp_m) *opcode = (sf << 31) | 0x11000000 | (Rm << 5) | Rd;
+    else *opcode = (sf << 31) | 0x2a0003e0 | (Rm << 16) | Rd;
+
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+/******************************************************************************
+*       Encoder Table
+*******************************************************************************/
+
+/**
+ *  Encoders for each supported instruction type. Types with more than one
+ *  form are listed once per form, and the first encoder that accepts the
+ *  operands is used.
+ */
+static const struct {
+    arm64_instr_t   type;
+    encode_func_t   encode;
+} encode_table[] = {
+    /* Branches */
+    { ARM64_INSTRUCTION_B,          encode_branch_immediate },
+    { ARM64_INSTRUCTION_BL,         encode_branch_immediate },
+    { ARM64_INSTRUCTION_CBZ,        encode_compare_and_branch_immediate },
+    { ARM64_INSTRUCTION_CBNZ,       encode_compare_and_branch_immediate },
+    { ARM64_INSTRUCTION_TBZ,        encode_test_and_branch_immediate },
+    { ARM64_INSTRUCTION_TBNZ,       encode_test_and_branch_immediate },
+    { ARM64_INSTRUCTION_BR,         encode_unconditional_branch_register },
+    { ARM64_INSTRUCTION_BLR,        encode_unconditional_branch_register },
+    { ARM64_INSTRUCTION_RET,        encode_unconditional_branch_register },
+
+    /* Exception generation */
+    { ARM64_INSTRUCTION_SVC,        encode_exception_generation },
+    { ARM64_INSTRUCTION_HVC,        encode_exception_generation },
+    { ARM64_INSTRUCTION_SMC,        encode_exception_generation },
+    { ARM64_INSTRUCTION_BRK,        encode_exception_generation },
+    { ARM64_INSTRUCTION_HLT,        encode_exception_generation },
+
+    /* Hints and barriers */
+    { ARM64_INSTRUCTION_NOP,        encode_hints },
+    { ARM64_INSTRUCTION_YIELD,      encode_hints },
+    { ARM64_INSTRUCTION_WFE,        encode_hints },
+    { ARM64_INSTRUCTION_WFI,        encode_hints },
+    { ARM64_INSTRUCTION_SEV,        encode_hints },
+    { ARM64_INSTRUCTION_SEVL,       encode_hints },
+    { ARM64_INSTRUCTION_DGH,        encode_hints },
+    { ARM64_INSTRUCTION_XPACLRI,    encode_hints },
+    { ARM64_INSTRUCTION_PACIA1716,  encode_hints },
+    { ARM64_INSTRUCTION_PACIB1716,  encode_hints },
+    { ARM64_INSTRUCTION_AUTIA1716,  encode_hints },
+    { ARM64_INSTRUCTION_AUTIB1716,  encode_hints },
+    { ARM64_INSTRUCTION_ESB,        encode_hints },
+    { ARM64_INSTRUCTION_PSB_CSYNC,  encode_hints },
+    { ARM64_INSTRUCTION_TSB_CSYNC,  encode_hints },
+    { ARM64_INSTRUCTION_CSDB,       encode_hints },
+    { ARM64_INSTRUCTION_PACIAZ,     encode_hints },
+    { ARM64_INSTRUCTION_PACIASP,    encode_hints },
+    { ARM64_INSTRUCTION_PACIBZ,     encode_hints },
+    { ARM64_INSTRUCTION_PACIBSP,    encode_hints },
+    { ARM64_INSTRUCTION_AUTIAZ,     encode_hints },
+    { ARM64_INSTRUCTION_AUTIASP,    encode_hints },
+    { ARM64_INSTRUCTION_AUTIBZ,     encode_hints },
+    { ARM64_INSTRUCTION_AUTIBSP,    encode_hints },
+    { ARM64_INSTRUCTION_BTI,        encode_hints },
+    { ARM64_INSTRUCTION_HINT,       encode_hints },
+    { ARM64_INSTRUCTION_DSB,        encode_barriers },
+    { ARM64_INSTRUCTION_DMB,        encode_barriers },
+    { ARM64_INSTRUCTION_ISB,        encode_barriers },
+
+    /* System instructions */
+    { ARM64_INSTRUCTION_MSR,        encode_system_register_move },
+    { ARM64_INSTRUCTION_MRS,        encode_system_register_move },
+    { ARM64_INSTRUCTION_SYS,        encode_system_instruction },
+    { ARM64_INSTRUCTION_SYSL,       encode_system_instruction },
+    { ARM64_INSTRUCTION_TLBI,       encode_system_instruction },
+    { ARM64_INSTRUCTION_AT,         encode_system_instruction },
+
+    /* Data processing */
+    { ARM64_INSTRUCTION_ADR,        encode_pc_relative_addressing },
+    { ARM64_INSTRUCTION_ADRP,       encode_pc_relative_addressing },
+    { ARM64_INSTRUCTION_ADD,        encode_add_subtract_immediate },
+    { ARM64_INSTRUCTION_ADDS,       encode_add_subtract_immediate },
+    { ARM64_INSTRUCTION_SUB,        encode_add_subtract_immediate },
+    { ARM64_INSTRUCTION_SUBS,       encode_add_subtract_immediate },
+    { ARM64_INSTRUCTION_CMP,        encode_add_subtract_immediate },
+    { ARM64_INSTRUCTION_CMN,        encode_add_subtract_immediate },
+    { ARM64_INSTRUCTION_AND,        encode_logical_immediate },
+    { ARM64_INSTRUCTION_ORR,        encode_logical_immediate },
+    { ARM64_INSTRUCTION_EOR,        encode_logical_immediate },
+    { ARM64_INSTRUCTION_ANDS,       encode_logical_immediate },
+    { ARM64_INSTRUCTION_TST,        encode_logical_immediate },
+    { ARM64_INSTRUCTION_MOVZ,       encode_move_wide_immediate },
+    { ARM64_INSTRUCTION_MOVN,       encode_move_wide_immediate },
+    { ARM64_INSTRUCTION_MOVK,       encode_move_wide_immediate },
+
+    /* MOV, in the order the decoder prefers the aliases */
+    { ARM64_INSTRUCTION_MOV,        encode_move_register },
+    { ARM64_INSTRUCTION_MOV,        encode_move_wide_immediate },
+    { ARM64_INSTRUCTION_MOV,        encode_logical_immediate },
+};
+
+
+LIBARCH_API
+libarch_return_t
+libarch_assemble (const instruction_t *instr, uint32_t *opcode)
+{
+    if (!instr || !opcode) return LIBARCH_RETURN_FAILURE;
+
+    for (int i = 0; i < sizeof (encode_table) / sizeof (encode_table[0]); i++) {
+        if (encode_table[i].type == instr->type && encode_table[i].encode (instr, opcode))
+            return LIBARCH_RETURN_SUCCESS;
+    }
+    return LIBARCH_RETURN_FAILURE;
+}
+
+
+LIBARCH_API
+size_t
+libarch_assemble_move_immediate (arm64_reg_t reg, uint8_t size, uint64_t value, uint32_t *opcodes)
+{
+    unsigned sf = (size == 64), immN, immr, imms;
+    unsigned halfwords = (sf) ? 4 : 2;
+    size_t len = 0;
+
+    if ((size != 32 && size != 64) || reg > 31 || !opcodes) return 0;
+    if (!sf) value &= 0xffffffff;
+
+    /* A single MOVZ, MOVN or ORR (bitmask immediate) */
+    if (_move_wide_single (sf, value, reg, &opcodes[0])) return 1;
+    if (reg != 31 && arm64_encode_bitmasks (value, size, &immN, &immr, &imms) == 0) {
+        opcodes[0] = (sf << 31) | 0x32000000 | (immN << 22) | (immr << 16) | (imms << 10) | (0b11111 << 5) | reg;
+        return 1;
+    }
+
+    /* Start from all-ones if that leaves fewer halfwords to patch with MOVK */
+    unsigned zeros = 0, ones = 0;
+    for (unsigned hw = 0; hw < halfwords; hw++) {
+        unsigned h = (value >> (hw * 16)) & 0xffff;
+        zeros += (h == 0);
+        ones += (h == 0xffff);
+    }
+    unsigned skip = (ones > zeros) ? 0xffff : 0;
+
+    for (unsigned hw = 0; hw < halfwords; hw++) {
+        unsigned h = (value >> (hw * 16)) & 0xffff;
+
+        if (h == skip) continue;
+        if (len == 0) opcodes[len++] = _move_wide (sf, (skip) ? 0 : 2, hw, (skip) ? ~h & 0xffff : h, reg);
+        else opcodes[len++] = _move_wide (sf, 3, hw, h, reg);
+    }
+    return len;
+}
@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "buffer.h"
+
+#include "arm64/arm64-instructions.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#   include <immintrin.h>
+#   define LIBARCH_RUN_X86          1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#   include <arm_neon.h>
+#   define LIBARCH_RUN_NEON         1
+#endif
+
+/**
+ *  Every run routine compares words [i, n) against `value` and returns the
+ *  index of the first one that differs, or `n`. The vector versions compare
+ *  whole vectors until one has a mismatch, and leave the scalar loop to find
+ *  it within that vector and to finish the tail. Loads are always unaligned.
+ */
+
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_run_scalar (const uint32_t *words, size_t i, size_t n, uint32_t value)
+{
+    while (i < n && words[i] == value) i++;
+    return i;
+}
+
+#if LIBARCH_RUN_X86
+
+__attribute__ ((target ("sse2")))
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_run_sse2 (const uint32_t *words, size_t i, size_t n, uint32_t value)
+{
+    const __m128i v = _mm_set1_epi32 ((int) value);
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i a = _mm_loadu_si128 ((const __m128i *) (words + i));
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (a, v)) != 0xffff) break;
+    }
+    return _run_scalar (words, i, n, value);
+}
+
+__attribute__ ((target ("avx2")))
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_run_avx2 (const uint32_t *words, size_t i, size_t n, uint32_t value)
+{
+    const __m256i v = _mm256_set1_epi32 ((int) value);
+
+    for (; i + 16 <= n; i += 16) {
+        __m256i a = _mm256_cmpeq_epi32 (_mm256_loadu_si256 ((const __m256i *) (words + i)), v);
+        __m256i b = _mm256_cmpeq_epi32 (_mm256_loadu_si256 ((const __m256i *) (words + i + 8)), v);
+        if (_mm256_movemask_epi8 (_mm256_and_si256 (a, b)) != -1) break;
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256i a = _mm256_loadu_si256 ((const __m256i *) (words + i));
+        if (_mm256_movemask_epi8 (_mm256_cmpeq_epi32 (a, v)) != -1) break;
+    }
+    return _run_scalar (words, i, n, value);
+}
+
+#elif LIBARCH_RUN_NEON
+
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_run_neon (const uint32_t *words, size_t i, size_t n, uint32_t value)
+{
+    const uint32x4_t v = vdupq_n_u32 (value);
+
+    for (; i + 8 <= n; i += 8) {
+        uint32x4_t a = vceqq_u32 (vld1q_u32 (words + i), v);
+        uint32x4_t b = vceqq_u32 (vld1q_u32 (words + i + 4), v);
+        if (vminvq_u32 (vandq_u32 (a, b)) != UINT32_MAX) break;
+    }
+    return _run_scalar (words, i, n, value);
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+size_t
+libarch_run_length (const uint32_t *words, size_t len)
+{
+    if (len < 2 || words[1] != words[0]) return len < 2 ? len : 1;
+
+#if LIBARCH_RUN_X86
+    if (__builtin_cpu_supports ("avx2"))
+        return _run_avx2 (words, 2, len, words[0]);
+    return _run_sse2 (words, 2, len, words[0]);
+#elif LIBARCH_RUN_NEON
+    return _run_neon (words, 2, len, words[0]);
+#endif
+    return _run_scalar (words, 2, len, words[0]);
+}
+
+LIBARCH_API
+size_t
+libarch_disass_buffer (libarch_ctx_t *ctx, const uint32_t *opcodes, uint64_t addr, size_t len,
+                       instruction_t **instrs, size_t max, size_t *used)
+{
+    const libarch_ctx_t *opts = (ctx) ? ctx : libarch_ctx_default ();
+    int collapse = (opts->options & LIBARCH_OPT_COLLAPSE_RUNS) != 0;
+    size_t i = 0, n = 0;
+
+    for (; i < len && n < max; n++) {
+        instruction_t **instr = &instrs[n];
+
+        if (*instr) libarch_instruction_reset (*instr, opcodes[i], addr + i * 4);
+        else if (!(*instr = libarch_instruction_create (opcodes[i], addr + i * 4))) break;
+        libarch_disass_ctx (ctx, instr);
+
+        /* The record stands for the whole run, so it's only decoded once */
+        if (collapse && i + 1 < len && opcodes[i + 1] == opcodes[i] && !libarch_instruction_is_pc_relative (*instr)) {
+            size_t run = libarch_run_length (opcodes + i, len - i);
+            (*instr)->run = (run < UINT32_MAX) ? (uint32_t) run : UINT32_MAX;
+        }
+        i += (*instr)->run;
+    }
+
+    if (used) *used = i;
+    return n;
+}
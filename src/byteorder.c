@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "byteorder.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#   include <immintrin.h>
+#   define LIBARCH_SWAP_X86         1
+#elif defined(__ARM_NEON)
+#   include <arm_neon.h>
+#   define LIBARCH_SWAP_NEON        1
+#endif
+
+/**
+ *  Every swap routine converts `n` whole words. The vector versions first
+ *  swap single words until `dst` is aligned to the vector width, so the
+ *  stores are aligned wherever `src` starts, then finish any partial tail one
+ *  word at a time. Loads are always unaligned.
+ */
+
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_swap_scalar (uint32_t *dst, const uint8_t *src, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint32_t w;
+        memcpy (&w, src + i * 4, sizeof (w));
+        dst[i] = __builtin_bswap32 (w);
+    }
+    return n;
+}
+
+/* Words to swap one at a time before `dst` is aligned to `align` bytes */
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_swap_head (const uint32_t *dst, size_t n, size_t align)
+{
+    size_t head = ((align - ((uintptr_t) dst & (align - 1))) & (align - 1)) / 4;
+    return (head < n) ? head : n;
+}
+
+#if LIBARCH_SWAP_X86
+
+__attribute__ ((target ("ssse3")))
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_swap_ssse3 (uint32_t *dst, const uint8_t *src, size_t n)
+{
+    const __m128i mask = _mm_setr_epi8 (3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    size_t i = _swap_scalar (dst, src, _swap_head (dst, n, 16));
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128 ((const __m128i *) (src + i * 4));
+        _mm_store_si128 ((__m128i *) (dst + i), _mm_shuffle_epi8 (v, mask));
+    }
+    return i + _swap_scalar (dst + i, src + i * 4, n - i);
+}
+
+__attribute__ ((target ("avx2")))
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_swap_avx2 (uint32_t *dst, const uint8_t *src, size_t n)
+{
+    const __m256i mask = _mm256_setr_epi8 (3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    size_t i = _swap_scalar (dst, src, _swap_head (dst, n, 32));
+
+    for (; i + 16 <= n; i += 16) {
+        __m256i a = _mm256_loadu_si256 ((const __m256i *) (src + i * 4));
+        __m256i b = _mm256_loadu_si256 ((const __m256i *) (src + i * 4 + 32));
+        _mm256_store_si256 ((__m256i *) (dst + i), _mm256_shuffle_epi8 (a, mask));
+        _mm256_store_si256 ((__m256i *) (dst + i + 8), _mm256_shuffle_epi8 (b, mask));
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256i a = _mm256_loadu_si256 ((const __m256i *) (src + i * 4));
+        _mm256_store_si256 ((__m256i *) (dst + i), _mm256_shuffle_epi8 (a, mask));
+    }
+    return i + _swap_scalar (dst + i, src + i * 4, n - i);
+}
+
+#elif LIBARCH_SWAP_NEON
+
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_swap_neon (uint32_t *dst, const uint8_t *src, size_t n)
+{
+    size_t i = _swap_scalar (dst, src, _swap_head (dst, n, 16));
+
+    for (; i + 4 <= n; i += 4)
+        vst1q_u8 ((uint8_t *) (dst + i), vrev32q_u8 (vld1q_u8 (src + i * 4)));
+    return i + _swap_scalar (dst + i, src + i * 4, n - i);
+}
+
+#endif
+
+
+LIBARCH_API
+uint32_t
+libarch_load_opcode (const void *src, int order)
+{
+    uint32_t w;
+
+    memcpy (&w, src, sizeof (w));
+    return (order == LIBARCH_BYTE_ORDER_HOST) ? w : __builtin_bswap32 (w);
+}
+
+
+LIBARCH_API
+size_t
+libarch_load_opcodes (uint32_t *dst, const void *src, size_t len, int order)
+{
+    size_t n = len / sizeof (uint32_t);
+
+    if (order == LIBARCH_BYTE_ORDER_HOST) {
+        if ((const void *) dst != src) memcpy (dst, src, n * sizeof (uint32_t));
+        return n;
+    }
+
+#if LIBARCH_SWAP_X86
+    if (__builtin_cpu_supports ("avx2"))
+        return _swap_avx2 (dst, (const uint8_t *) src, n);
+    if (__builtin_cpu_supports ("ssse3"))
+        return _swap_ssse3 (dst, (const uint8_t *) src, n);
+#elif LIBARCH_SWAP_NEON
+    return _swap_neon (dst, (const uint8_t *) src, n);
+#endif
+    return _swap_scalar (dst, (const uint8_t *) src, n);
+}
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "context.h"
+#include "instruction.h"
+
+/**
+ *  Default context, used whenever an API is called without one. This is never
+ *  written to, so it's safe to share between threads.
+ */
+static const libarch_ctx_t libarch_default_ctx =
+{
+    .options = LIBARCH_OPT_NONE,
+    .features = LIBARCH_FEATURE_ALL,
+    .allocator = { malloc, realloc, free },
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+void
+libarch_ctx_init (libarch_ctx_t *ctx)
+{
+    memcpy (ctx, &libarch_default_ctx, sizeof (libarch_ctx_t));
+}
+
+
+LIBARCH_API
+libarch_ctx_t *
+libarch_ctx_create (void)
+{
+    libarch_ctx_t *ctx = malloc (sizeof (libarch_ctx_t));
+    if (ctx) libarch_ctx_init (ctx);
+    return ctx;
+}
+
+
+LIBARCH_API
+void
+libarch_ctx_cleanup (libarch_ctx_t *ctx)
+{
+    while (ctx->cache_len) {
+        instruction_t *instr = ctx->cache[--ctx->cache_len];
+        if (instr->operands) ctx->allocator.release (instr->operands);
+        if (instr->fields) ctx->allocator.release (instr->fields);
+        ctx->allocator.release (instr);
+    }
+}
+
+
+LIBARCH_API
+void
+libarch_ctx_free (libarch_ctx_t *ctx)
+{
+    if (!ctx) return;
+    libarch_ctx_cleanup (ctx);
+    free (ctx);
+}
+
+
+LIBARCH_API
+int
+libarch_ctx_has_feature (const libarch_ctx_t *ctx, uint64_t feature)
+{
+    if (!ctx) ctx = &libarch_default_ctx;
+    return (ctx->features & feature) == feature;
+}
+
+
+LIBARCH_API
+const libarch_ctx_t *
+libarch_ctx_default (void)
+{
+    return &libarch_default_ctx;
+}
@@ -0,0 +1,208 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "corpus.h"
+#include "byteorder.h"
+
+/**
+ *  The corpus is parsed in a single pass over the file. Lines are found with
+ *  memchr, and each opcode's eight hex digits are checked and converted
+ *  together as one 64-bit word, a byte per digit, rather than one character
+ *  at a time.
+ */
+
+#define ONES            0x0101010101010101ULL
+#define HIGH            0x8080808080808080ULL
+
+/* High bit of each byte set if the byte is >= `lo`. Bytes must be < 0x80 */
+#define BYTES_GE(v, lo)     (((v) + (0x80 - (lo)) * ONES) & HIGH)
+
+/* High bit of each byte set if the byte is > `hi`. Bytes must be < 0x80 */
+#define BYTES_GT(v, hi)     (((v) + (0x7f - (hi)) * ONES) & HIGH)
+
+/**
+ *  Convert eight hex digits, the bytes of an opcode in memory order, to the
+ *  opcode. Returns LIBARCH_RETURN_FAILURE if any of them isn't a hex digit.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_parse_hex8 (const char *p, uint32_t *opcode)
+{
+    uint64_t v;
+
+    memcpy (&v, p, sizeof (v));
+#if LIBARCH_BYTE_ORDER_HOST == LIBARCH_BYTE_ORDER_BIG
+    v = __builtin_bswap64 (v);
+#endif
+
+    /* Each byte must be 0-9, a-f or A-F */
+    if (v & HIGH) return LIBARCH_RETURN_FAILURE;
+
+    uint64_t lower = v | (0x20 * ONES);
+    uint64_t digit = BYTES_GE (v, '0') & ~BYTES_GT (v, '9');
+    uint64_t alpha = BYTES_GE (lower, 'a') & ~BYTES_GT (lower, 'f');
+    if ((digit | alpha) != HIGH) return LIBARCH_RETURN_FAILURE;
+
+    /* Nibble values, with 9 added for letters */
+    uint64_t nib = (v & (0x0f * ONES)) + (alpha >> 7) * 9;
+
+    /* Pair the nibbles into bytes, then pack the bytes together */
+    uint64_t x = ((nib & 0x000f000f000f000fULL) << 4) | ((nib >> 8) & 0x000f000f000f000fULL);
+    x = (x | (x >> 8)) & 0x0000ffff0000ffffULL;
+    x = (x | (x >> 16)) & 0x00000000ffffffffULL;
+
+    /* The first byte is now the lowest, as for a little-endian load */
+    *opcode = (uint32_t) x;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_corpus_grow (libarch_corpus_t *corpus, size_t *cap)
+{
+    size_t n = (*cap) ? *cap * 2 : 256;
+    uint32_t *opcodes = realloc (corpus->opcodes, n * sizeof (uint32_t));
+    if (opcodes) corpus->opcodes = opcodes;
+    const char **expected = realloc (corpus->expected, n * sizeof (char *));
+    if (expected) corpus->expected = expected;
+    uint32_t *expected_len = realloc (corpus->expected_len, n * sizeof (uint32_t));
+    if (expected_len) corpus->expected_len = expected_len;
+    uint32_t *lines = realloc (corpus->lines, n * sizeof (uint32_t));
+    if (lines) corpus->lines = lines;
+
+    if (!opcodes || !expected || !expected_len || !lines)
+        return LIBARCH_RETURN_FAILURE;
+    *cap = n;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+int
+_is_blank (char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_corpus_parse (libarch_corpus_t *corpus, const char *text, size_t len)
+{
+    const char *p = text, *end = text + len;
+    size_t cap = 0;
+    uint32_t line = 0;
+
+    memset (corpus, 0, sizeof (libarch_corpus_t));
+
+    /* Lines are around 40 bytes, so start with room for most of them */
+    if (len / 64 > 128) cap = len / 64;
+    if (!_corpus_grow (corpus, &cap)) goto fail;
+
+    while (p < end) {
+        const char *eol = memchr (p, '\n', end - p);
+        const char *next = (eol) ? eol + 1 : end;
+        const char *q = p + 8;
+        uint32_t opcode;
+
+        if (!eol) eol = end;
+        line++;
+
+        /* "<8 hex digits><blanks>-" */
+        if (eol - p < 9 || !_is_blank (*q) || !_parse_hex8 (p, &opcode)) {
+            p = next;
+            continue;
+        }
+        while (q < eol && _is_blank (*q)) q++;
+        if (q == eol || *q != '-') {
+            p = next;
+            continue;
+        }
+        for (q++; q < eol && _is_blank (*q); q++);
+
+        const char *e = eol;
+        while (e > q && _is_blank (e[-1])) e--;
+
+        if (corpus->len == cap && !_corpus_grow (corpus, &cap)) goto fail;
+
+        corpus->opcodes[corpus->len] = opcode;
+        corpus->expected[corpus->len] = q;
+        corpus->expected_len[corpus->len] = (uint32_t) (e - q);
+        corpus->lines[corpus->len] = line;
+        corpus->len++;
+
+        p = next;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+
+fail:
+    libarch_corpus_free (corpus);
+    return LIBARCH_RETURN_FAILURE;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_corpus_load (libarch_corpus_t *corpus, const char *path)
+{
+    struct stat st;
+    void *map = NULL;
+    int fd;
+
+    memset (corpus, 0, sizeof (libarch_corpus_t));
+
+    if ((fd = open (path, O_RDONLY)) < 0)
+        return LIBARCH_RETURN_FAILURE;
+    if (fstat (fd, &st) < 0) {
+        close (fd);
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    if (st.st_size) {
+        map = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            close (fd);
+            return LIBARCH_RETURN_FAILURE;
+        }
+        madvise (map, st.st_size, MADV_SEQUENTIAL);
+    }
+    close (fd);
+
+    if (!libarch_corpus_parse (corpus, (const char *) map, st.st_size)) {
+        if (map) munmap (map, st.st_size);
+        return LIBARCH_RETURN_FAILURE;
+    }
+    corpus->map = map;
+    corpus->map_size = st.st_size;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+void
+libarch_corpus_free (libarch_corpus_t *corpus)
+{
+    free (corpus->opcodes);
+    free (corpus->expected);
+    free (corpus->expected_len);
+    free (corpus->lines);
+    if (corpus->map) munmap (corpus->map, corpus->map_size);
+    memset (corpus, 0, sizeof (libarch_corpus_t));
+}
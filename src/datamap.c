@@ -0,0 +1,272 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "datamap.h"
+#include "instruction.h"
+#include "jumptable.h"
+
+#include "arm64/arm64-common.h"
+#include "arm64/arm64-instructions.h"
+
+/**
+ *  Detection keeps one byte of flags per word. The decode pass marks the
+ *  undecodable words and the literal loads, and recovers jump tables at each
+ *  `br` from a ring of the last few records. Later passes mark the dense runs
+ *  of undecodable words, then the literal targets, which are grown over the
+ *  undecodable words next to them, and the marked words are finally gathered
+ *  into ranges.
+ */
+
+/* Word flags. The reasons share the bits of the public LIBARCH_DATAMAP_* */
+#define WORD_DATA               (LIBARCH_DATAMAP_LITERAL | LIBARCH_DATAMAP_JUMPTABLE | LIBARCH_DATAMAP_UNDECODABLE)
+#define WORD_INVALID            (1 << 3)        // Doesn't decode
+#define WORD_LOAD               (1 << 4)        // LDR (literal)
+#define WORD_QUAD               (1 << 5)        // Part of a 64-bit literal
+#define WORD_CODE               (1 << 6)        // Reached by the descent
+
+/* Mark `size` bytes from `target` as data, if they're in the image */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_mark (uint8_t *flags, uint64_t addr, size_t len, uint64_t target, uint64_t size, uint8_t reason)
+{
+    if (target < addr || (target - addr) / 4 >= len || !size) return;
+
+    size_t first = (target - addr) / 4;
+    size_t last = (target - addr + size - 1) / 4;
+    if (last >= len) last = len - 1;
+
+    for (size_t i = first; i <= last; i++) flags[i] |= reason;
+}
+
+/* Size of the value an LDR (literal) loads, or 0 for PRFM */
+LIBARCH_PRIVATE LIBARCH_API
+unsigned
+_literal_size (uint32_t op)
+{
+    unsigned opc = select_bits (op, 30, 31);
+
+    if (select_bits (op, 26, 26)) return (opc < 3) ? 4 << opc : 0;
+    return (opc == 1) ? 8 : (opc == 3) ? 0 : 4;
+}
+
+/* Decode every word, noting the ones that don't decode and the literal loads */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_decode_pass (uint8_t *flags, const uint32_t *opcodes, uint64_t addr, size_t len)
+{
+    const size_t ring = LIBARCH_JUMPTABLE_WINDOW + 1;
+    instruction_t *records[LIBARCH_JUMPTABLE_WINDOW + 1] = { NULL };
+    instruction_t *window[LIBARCH_JUMPTABLE_WINDOW + 1];
+    libarch_return_t ret = LIBARCH_RETURN_SUCCESS;
+    libarch_jumptable_t table;
+    libarch_ctx_t ctx;
+
+    libarch_ctx_init (&ctx);
+    ctx.options |= LIBARCH_OPT_RAW;
+
+    for (size_t i = 0; i < ring; i++) {
+        if (!(records[i] = libarch_instruction_create_ctx (&ctx, 0, 0))) {
+            ret = LIBARCH_RETURN_FAILURE;
+            goto done;
+        }
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        instruction_t **instr = &records[i % ring];
+
+        libarch_instruction_reset (*instr, opcodes[i], addr + i * 4);
+        libarch_disass_ctx (&ctx, instr);
+
+        if ((*instr)->type == ARM64_INSTRUCTION_UNK || (*instr)->type == ARM64_INSTRUCTION_UDF) {
+            flags[i] |= WORD_INVALID;
+        } else if ((*instr)->group == ARM64_DECODE_GROUP_LOAD_AND_STORE &&
+                   (*instr)->subgroup == ARM64_DECODE_SUBGROUP_LOAD_REGISTER_LITERAL) {
+            if (_literal_size (opcodes[i])) flags[i] |= WORD_LOAD;
+        } else if ((*instr)->type == ARM64_INSTRUCTION_BR) {
+            size_t n = (i + 1 < ring) ? i + 1 : ring;
+            for (size_t k = 0; k < n; k++) window[k] = records[(i + 1 - n + k) % ring];
+
+            if (libarch_jumptable_recover (window, n, &table))
+                _mark (flags, addr, len, table.table, (uint64_t) table.count * table.entry_size,
+                       LIBARCH_DATAMAP_JUMPTABLE);
+        }
+    }
+
+done:
+    for (size_t i = 0; i < ring; i++)
+        if (records[i]) libarch_instruction_free (records[i]);
+    libarch_ctx_cleanup (&ctx);
+    return ret;
+}
+
+/**
+ *  Mark the undecodable words in every window of LIBARCH_DATAMAP_WINDOW words
+ *  with at least LIBARCH_DATAMAP_DENSITY of them, then any single word between
+ *  two marked ones, which is almost always a value that happens to decode.
+ *  Code the descent found is left alone.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_density_pass (uint8_t *flags, size_t len)
+{
+    const size_t w = LIBARCH_DATAMAP_WINDOW;
+    size_t count = 0;
+
+    if (len < w) return;
+    for (size_t i = 0; i < w - 1; i++) count += (flags[i] & WORD_INVALID) != 0;
+
+    for (size_t s = 0; s + w <= len; s++) {
+        count += (flags[s + w - 1] & WORD_INVALID) != 0;
+
+        if (count >= LIBARCH_DATAMAP_DENSITY)
+            for (size_t i = s; i < s + w; i++)
+                if ((flags[i] & WORD_INVALID) && !(flags[i] & WORD_CODE)) flags[i] |= LIBARCH_DATAMAP_UNDECODABLE;
+
+        count -= (flags[s] & WORD_INVALID) != 0;
+    }
+
+    for (size_t i = 1; i + 1 < len; i++)
+        if ((flags[i - 1] & flags[i + 1] & LIBARCH_DATAMAP_UNDECODABLE) && !(flags[i] & WORD_CODE))
+            flags[i] |= LIBARCH_DATAMAP_UNDECODABLE;
+}
+
+/**
+ *  Mark the target of every literal load that isn't itself in data, then grow
+ *  each pool over the undecodable words either side of it.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_literal_pass (uint8_t *flags, const uint32_t *opcodes, uint64_t addr, size_t len, int have_code)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (!(flags[i] & WORD_LOAD) || (flags[i] & WORD_DATA)) continue;
+        if (have_code && !(flags[i] & WORD_CODE)) continue;
+
+        uint32_t op = opcodes[i];
+        int64_t offset = (int) arm64_sign_extend (select_bits (op, 5, 23), 19);
+        uint64_t target = addr + i * 4 + offset * 4;
+        unsigned size = _literal_size (op);
+
+        _mark (flags, addr, len, target, size, LIBARCH_DATAMAP_LITERAL);
+        if (size >= 8 && !(target & 7)) _mark (flags, addr, len, target, size, WORD_QUAD);
+    }
+
+    for (size_t i = 1; i < len; i++)
+        if ((flags[i - 1] & LIBARCH_DATAMAP_LITERAL) && (flags[i] & WORD_INVALID) && !(flags[i] & WORD_CODE))
+            flags[i] |= LIBARCH_DATAMAP_LITERAL;
+    for (size_t i = len - 1; i > 0; i--)
+        if ((flags[i] & LIBARCH_DATAMAP_LITERAL) && (flags[i - 1] & WORD_INVALID) && !(flags[i - 1] & WORD_CODE))
+            flags[i - 1] |= LIBARCH_DATAMAP_LITERAL;
+}
+
+/**
+ *  Gather runs of data words into ranges. A run of 64-bit literals is a range
+ *  of it's own, so it can be shown as 64-bit values.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_gather (libarch_datamap_t *map, const uint8_t *flags, uint64_t addr, size_t len)
+{
+    size_t cap = 0;
+
+    for (size_t i = 0; i < len;) {
+        if (!(flags[i] & WORD_DATA)) {
+            i++;
+            continue;
+        }
+
+        uint32_t reasons = 0;
+        uint8_t quad = flags[i] & WORD_QUAD;
+        size_t start = i;
+
+        for (; i < len && (flags[i] & WORD_DATA) && (flags[i] & WORD_QUAD) == quad; i++)
+            reasons |= flags[i] & WORD_DATA;
+
+        if (map->len == cap) {
+            cap = (cap) ? cap * 2 : 64;
+            libarch_data_range_t *ranges = realloc (map->ranges, cap * sizeof (libarch_data_range_t));
+            if (!ranges) return LIBARCH_RETURN_FAILURE;
+            map->ranges = ranges;
+        }
+
+        libarch_data_range_t *r = &map->ranges[map->len++];
+        r->addr = addr + start * 4;
+        r->size = (i - start) * 4;
+        r->reasons = reasons;
+        r->unit = (quad && !(r->addr & 7) && !(r->size & 7)) ? 8 : 4;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+libarch_return_t
+libarch_datamap_detect (libarch_datamap_t *map, const uint32_t *opcodes, uint64_t addr, size_t len,
+                        const libarch_descent_t *descent)
+{
+    memset (map, 0, sizeof (libarch_datamap_t));
+    if (!len) return LIBARCH_RETURN_SUCCESS;
+
+    uint8_t *flags = calloc (len, sizeof (uint8_t));
+    if (!flags) return LIBARCH_RETURN_FAILURE;
+
+    if (descent) {
+        for (size_t i = 0; i < len; i++)
+            if (libarch_descent_is_code (descent, addr + i * 4)) flags[i] |= WORD_CODE;
+
+        for (size_t i = 0; i < descent->tables_len; i++) {
+            const libarch_jumptable_t *t = &descent->tables[i];
+            _mark (flags, addr, len, t->table, (uint64_t) t->count * t->entry_size, LIBARCH_DATAMAP_JUMPTABLE);
+        }
+    }
+
+    libarch_return_t ret = _decode_pass (flags, opcodes, addr, len);
+    if (ret) {
+        _density_pass (flags, len);
+        _literal_pass (flags, opcodes, addr, len, descent != NULL);
+        ret = _gather (map, flags, addr, len);
+    }
+
+    free (flags);
+    if (!ret) libarch_datamap_free (map);
+    return ret;
+}
+
+LIBARCH_API
+const libarch_data_range_t *
+libarch_datamap_find (const libarch_datamap_t *map, uint64_t addr)
+{
+    size_t lo = 0, hi = map->len;
+
+    /* First range that ends after `addr` */
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (map->ranges[mid].addr + map->ranges[mid].size <= addr) lo = mid + 1;
+        else hi = mid;
+    }
+    return (lo < map->len) ? &map->ranges[lo] : NULL;
+}
+
+LIBARCH_API
+void
+libarch_datamap_free (libarch_datamap_t *map)
+{
+    free (map->ranges);
+    map->ranges = NULL;
+    map->len = 0;
+}
@@ -35,8 +35,10 @@ decode_conditional_branch (instruction_t **instr)
     (*instr)->type = ARM64_INSTRUCTION_B;
     (*instr)->cond = cond;
 
-    uint64_t imm = arm64_sign_extend(imm19 << 2, 64) + (*instr)->addr;
+    uint64_t imm = (signed) arm64_sign_extend (imm19 << 2, 21) + (*instr)->addr;
     libarch_instruction_add_operand_immediate (instr, *(unsigned long *) &imm, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
 }
 
 
@@ -62,13 +64,10 @@ decode_exception_generation (instruction_t **instr)
         { 0, ARM64_INSTRUCTION_DCPS1, ARM64_INSTRUCTION_DCPS2, ARM64_INSTRUCTION_DCPS3 },
     };
 
-    printf ("opc: %d, LL: %d\n", opc, LL);
-
     /* Work out the correct instruction */
-    if (opc >= 0 && opc <= 2) {
-        if (LL >= 1 && LL <= 3) (*instr)->type = opcode_table[opc][LL - 1];
-        else (*instr)->type = opcode_table[1][opc - 1];
-    } else if (opc == 5 && LL >= 1 && LL <= 3) (*instr)->type = opcode_table[2][LL];
+    if (opc == 0 && LL >= 1 && LL <= 3) (*instr)->type = opcode_table[0][LL - 1];
+    else if ((opc == 1 || opc == 2) && LL == 0) (*instr)->type = opcode_table[1][opc - 1];
+    else if (opc == 5 && LL >= 1 && LL <= 3) (*instr)->type = opcode_table[2][LL];
     else return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
     /* Add the operand */
@@ -101,6 +100,49 @@ decode_system_instruction_with_register (instruction_t **instr)
 }
 
 
+/**
+ *  Hints, indexed by CRm:op2. Anything not listed is printed as HINT #imm.
+ */
+static const arm64_instr_t hint_table[128] = {
+    /* CRm == 0 */
+    [0x00] = ARM64_INSTRUCTION_NOP,
+    [0x01] = ARM64_INSTRUCTION_YIELD,
+    [0x02] = ARM64_INSTRUCTION_WFE,
+    [0x03] = ARM64_INSTRUCTION_WFI,
+    [0x04] = ARM64_INSTRUCTION_SEV,
+    [0x05] = ARM64_INSTRUCTION_SEVL,
+    [0x06] = ARM64_INSTRUCTION_DGH,
+    [0x07] = ARM64_INSTRUCTION_XPACLRI,
+
+    /* CRm == 1 */
+    [0x08] = ARM64_INSTRUCTION_PACIA1716,
+    [0x0a] = ARM64_INSTRUCTION_PACIB1716,
+    [0x0c] = ARM64_INSTRUCTION_AUTIA1716,
+    [0x0e] = ARM64_INSTRUCTION_AUTIB1716,
+
+    /* CRm == 2 */
+    [0x10] = ARM64_INSTRUCTION_ESB,
+    [0x11] = ARM64_INSTRUCTION_PSB_CSYNC,
+    [0x12] = ARM64_INSTRUCTION_TSB_CSYNC,
+    [0x14] = ARM64_INSTRUCTION_CSDB,
+
+    /* CRm == 3 */
+    [0x18] = ARM64_INSTRUCTION_PACIAZ,
+    [0x19] = ARM64_INSTRUCTION_PACIASP,
+    [0x1a] = ARM64_INSTRUCTION_PACIBZ,
+    [0x1b] = ARM64_INSTRUCTION_PACIBSP,
+    [0x1c] = ARM64_INSTRUCTION_AUTIAZ,
+    [0x1d] = ARM64_INSTRUCTION_AUTIASP,
+    [0x1e] = ARM64_INSTRUCTION_AUTIBZ,
+    [0x1f] = ARM64_INSTRUCTION_AUTIBSP,
+
+    /* CRm == 4, BTI with the target in op2 */
+    [0x20] = ARM64_INSTRUCTION_BTI,
+    [0x22] = ARM64_INSTRUCTION_BTI,
+    [0x24] = ARM64_INSTRUCTION_BTI,
+    [0x26] = ARM64_INSTRUCTION_BTI,
+};
+
 LIBARCH_PRIVATE LIBARCH_API
 decode_status_t
 decode_hints (instruction_t **instr)
@@ -120,90 +162,24 @@ decode_hints (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rd);
 
-    /**
-     *  NOTE:   To try and cut down the amount of if-else blocks, I decided to go with this
-     *          approach of creating an array of all the instructions to parse in this
-     *          subgroup, along with the CRm, op2 and D/Z values, and register operands,
-     *          and iterate through it to determine which one it is.
-     * 
-     *          The original can be found here, and should be discussed as an optimisation
-     *          in the final project report:
-     *          https://github.com/h3adshotzz/libarch/blob/f0218715a29b36ee91e12e55724d19c6fbb8b00b/src/decoder/branch.c
-    */
-    typedef struct {
-        unsigned CRm;
-        unsigned op2;
-        unsigned xtra;
-        arm64_instr_t type;
-        int Rd; // -1
-        int Rn; // -1
-    } opcode;
+    (*instr)->type = hint_table[(CRm << 3) | op2];
 
-    
-    /* opcode table */
-    opcode opcode_table[] = {
-        /* CRm == 0 */
-        { 0, 0, -1, ARM64_INSTRUCTION_NOP, -1, -1 },
-        { 0, 1, -1, ARM64_INSTRUCTION_YIELD, -1, -1 },
-        { 0, 2, -1, ARM64_INSTRUCTION_WFE, -1, -1 },
-        { 0, 3, -1, ARM64_INSTRUCTION_WFI, -1, -1 },
-        { 0, 4, -1, ARM64_INSTRUCTION_SEV, -1, -1 },
-        { 0, 5, -1, ARM64_INSTRUCTION_SEVL, -1, -1 },
-        { 0, 6, -1, ARM64_INSTRUCTION_DGH, -1, -1 },
-        { 0, 7, 0, ARM64_INSTRUCTION_XPACI, Rd, -1 },
-        { 0, 7, 1, ARM64_INSTRUCTION_XPACD, Rd, -1 },
-
-        /* CRm == 1 */
-        { 1, 0, 0, ARM64_INSTRUCTION_PACIZA, Rd, Rn },
-        { 1, 0, 1, ARM64_INSTRUCTION_PACIA1716, -1, -1 },
-        { 1, 1, 0, ARM64_INSTRUCTION_PACIZA, Rd, Rn },
-        { 1, 1, 1, ARM64_INSTRUCTION_PACIB1716, -1, -1 },
-        { 1, 4, 0, ARM64_INSTRUCTION_AUTIZA, Rd, Rn },
-        { 1, 4, 1, ARM64_INSTRUCTION_AUTIA1716, -1, -1 },
-        { 1, 6, 0, ARM64_INSTRUCTION_AUTIZB, Rd, Rn },
-        { 1, 6, 1, ARM64_INSTRUCTION_AUTIB1716, -1, -1 },
-
-        /* CRm == 2 */
-        { 2, 0, -1, ARM64_INSTRUCTION_ESB, -1, -1 },
-        { 2, 1, -1, ARM64_INSTRUCTION_PSB_CSYNC, -1, -1 },
-        { 2, 2, -1, ARM64_INSTRUCTION_TSB_CSYNC, -1, -1 },
-        { 2, 4, -1, ARM64_INSTRUCTION_CSDB, -1, -1 },
-
-        /* CRm == 3 */
-        { 3, 0, -1, ARM64_INSTRUCTION_PACIAZ, -1, -1 },
-        { 3, 1, -1, ARM64_INSTRUCTION_PACIASP, -1, -1 },
-        { 3, 2, -1, ARM64_INSTRUCTION_PACIBZ, -1, -1 },
-        { 3, 3, -1, ARM64_INSTRUCTION_PACIBSP, -1, -1 },
-        { 3, 4, -1, ARM64_INSTRUCTION_AUTIAZ, -1, -1 },
-        { 3, 5, -1, ARM64_INSTRUCTION_AUTIASP, -1, -1 },
-        { 3, 6, -1, ARM64_INSTRUCTION_AUTIAZ, -1, -1 },
-        { 3, 7, -1, ARM64_INSTRUCTION_AUTIASP, -1, -1 },
-
-    };
-
-    /* Only CRm == 0 instructions check 'D' */
-    unsigned xtra = (CRm == 0) ? D : Z;
-
-    /* Determine which one instruction it is */
-    for (int i = 0; i < sizeof (opcode_table) / sizeof (opcode); i++) {
-        if (opcode_table[i].CRm == CRm && opcode_table[i].op2 == op2 &&
-        (opcode_table[i].xtra == -1 || opcode_table[i].xtra == xtra)) {
-            (*instr)->type = opcode_table[i].type;
-
-            if (opcode_table[i].Rd != -1)
-                libarch_instruction_add_operand_register (instr, Rd, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-
-            if (opcode_table[i].Rn != -1)
-                libarch_instruction_add_operand_register (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        } 
-    }
+    /* Without pointer authentication, the PAC hints are only printed as HINT #imm */
+    if (((CRm == 0 && op2 == 7) || (CRm == 1 && !(op2 & 1)) || CRm == 3) &&
+        !libarch_decode_has_feature (*instr, LIBARCH_FEATURE_PAUTH))
+        (*instr)->type = ARM64_INSTRUCTION_UNK;
 
     /* BTI is annoying and is completely different to the others */
-    if (CRm == 4 && (op2 & ~6) == 0) {
-        (*instr)->type = ARM64_INSTRUCTION_BTI;
-
-        const char *targets[] = { "", "c", "j", "jc" };
+    if ((*instr)->type == ARM64_INSTRUCTION_BTI) {
+        static const char *const targets[] = { "", "c", "j", "jc" };
         libarch_instruction_add_operand_target (instr, targets[op2 >> 1]);
+
+    /* Anything else in the hint space is printed as HINT #imm */
+    } else if ((*instr)->type == ARM64_INSTRUCTION_UNK) {
+        (*instr)->type = ARM64_INSTRUCTION_HINT;
+
+        unsigned imm = (CRm << 3) | op2;
+        libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imm, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
     }
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
@@ -242,6 +218,7 @@ decode_barriers (instruction_t **instr)
             libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_MEMORY_BARRIER, CRm);
         } else if (op2 == 5) {
             (*instr)->type = ARM64_INSTRUCTION_DMB;
+            libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_MEMORY_BARRIER, CRm);
         } else if (op2 == 6) {
             (*instr)->type = ARM64_INSTRUCTION_ISB;
         } else if (op2 == 7) {
@@ -339,44 +316,23 @@ decode_system_instruction (instruction_t **instr)
     libarch_instruction_add_field (instr, op2);
     libarch_instruction_add_field (instr, Rt);
 
+    /* AT, DC, IC and TLBI are only SYS, never SYSL */
+    int sysop = (L == 0) ? SysOp (op1, CRn, CRm, op2) : ARM64_SYSOP_SYS;
+
     /**
-     * NOTE:    As much as I would like to use the opcode_table thing I've been
-     *          doing, I think here it would be too messy. But I'll use it for
-     *          the Address Translation names though.
+     *  The operation names for AT and TLBI are looked up from the table in
+     *  utils.c, indexed by the same fields.
      */
 
     /* AT */
-    if (L == 0 && CRn == 7 && (CRm == 8 || CRm == 9) && SysOp (op1, 0b0111, CRm, op2) == ARM64_SYSOP_AT) {
+    if (sysop == ARM64_SYSOP_AT) {
         (*instr)->type = ARM64_INSTRUCTION_AT;
 
-        int at_table[][4] = {
-            { 0, 0, 0, ARM64_AT_NAME_S1E1R },
-            { 0, 0, 1, ARM64_AT_NAME_S1E1W },
-            { 0, 0, 2, ARM64_AT_NAME_S1E0R },
-            { 0, 0, 3, ARM64_AT_NAME_S1E0W },
-
-            { 0, 1, 0, ARM64_AT_NAME_S1E1RP },
-            { 0, 1, 1, ARM64_AT_NAME_S1E1WP },
-
-            { 4, 0, 0, ARM64_AT_NAME_S1E2R },
-            { 4, 0, 1, ARM64_AT_NAME_S1E2W },
-            { 4, 0, 4, ARM64_AT_NAME_S12E1R },
-            { 4, 0, 5, ARM64_AT_NAME_S12E1W },
-            { 4, 0, 6, ARM64_AT_NAME_S12E0R },
-            { 4, 0, 7, ARM64_AT_NAME_S12E0W },
-
-            { 6, 1, 0, ARM64_AT_NAME_S1E3R },
-            { 6, 1, 1, ARM64_AT_NAME_S1E3W },
-        };
-
-        for (int i = 0; i < sizeof (at_table) / sizeof (at_table[0]); i++) {
-            if (at_table[i][0] == op1 && at_table[i][1] == select_bits (CRm, 0, 0) && at_table[i][2] == op2)
-                libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_AT_NAME, at_table[i][3]);
-        }
+        libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_AT_NAME, get_at_name (op1, CRm, op2));
         libarch_instruction_add_operand_register (instr, Rt, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
 
     /* TLBI */
-    } else if ((CRn >> 1) == 4 && SysOp (op1, CRn, CRm, op2) == ARM64_SYSOP_TLBI) {
+    } else if (sysop == ARM64_SYSOP_TLBI) {
         (*instr)->type = ARM64_INSTRUCTION_TLBI;
 
         libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_TLBI_OP, get_tlbi (op1, CRn, CRm, op2));
@@ -410,7 +366,7 @@ decode_system_instruction (instruction_t **instr)
             libarch_instruction_add_operand_register (instr, Rt, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
 
     }
-
+    return LIBARCH_DECODE_STATUS_SUCCESS;
 }
 
 
@@ -485,6 +441,10 @@ decode_unconditional_branch_register (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, op4);
 
+    /* op3 of 2 and 3 are the authenticated branches and returns */
+    if ((op3 >> 1) == 1 && !libarch_decode_has_feature (*instr, LIBARCH_FEATURE_PAUTH))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
     // Special bits for these instructions
     unsigned Z = select_bits ((*instr)->opcode, 24, 24);
     unsigned M = select_bits ((*instr)->opcode, 10, 10);
@@ -594,7 +554,7 @@ decode_compare_and_branch_immediate (instruction_t **instr)
     /* Determine instruction size, and register width */
     uint32_t len;
     unsigned size;
-    const char **regs;
+    const char *const *regs;
 
     if (sf == 1) _SET_64 (size, regs, len);
     else _SET_32 (size, regs, len);
@@ -633,14 +593,14 @@ decode_test_and_branch_immediate (instruction_t **instr)
     /* Determine instruction size, and register width */
     uint32_t len;
     unsigned size;
-    const char **regs;
+    const char *const *regs;
 
     if (b5 == 1) _SET_64 (size, regs, len);
     else _SET_32 (size, regs, len);
 
     /* Extend the pc-relative immediate value */
     long label = (signed) arm64_sign_extend (imm14 << 2, 16) + (*instr)->addr;
-    unsigned imm = (b5 << 6) | b40;
+    unsigned imm = (b5 << 5) | b40;
 
     /* TBZ / TBNZ */
     if (op == 0) (*instr)->type = ARM64_INSTRUCTION_TBZ;
@@ -697,7 +657,7 @@ disass_branch_exception_sys_instruction (instruction_t *instr)
             instr->subgroup = ARM64_DECODE_SUBGROUP_SYSTEM_REGISTER_MOVE;
 
     } else if (op0 == 6 && ((op1 >> 13) == 1)) {
-        if (decode_unconditional_branch_register (&instr))
+        if (decode_unconditional_branch_register (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
             instr->subgroup = ARM64_DECODE_SUBGROUP_UNCONDITIONAL_BRANCH_REGISTER;
 
     } else if ((op0 & ~4) == 0) {
@@ -0,0 +1,1879 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include "decoder/data-processing-floating.h"
+
+/******************************************************************************
+*       Decode Tables
+*******************************************************************************/
+
+/**
+ *  Vector arrangement for an element size (0 = B, 1 = H, 2 = S, 3 = D) and
+ *  the Q bit, e.g. simd_arrangement[2][1] is 4S.
+ */
+static const int simd_arrangement[4][2] =
+{
+    { ARM64_VEC_ARRANGEMENT_8B, ARM64_VEC_ARRANGEMENT_16B },
+    { ARM64_VEC_ARRANGEMENT_4H, ARM64_VEC_ARRANGEMENT_8H },
+    { ARM64_VEC_ARRANGEMENT_2S, ARM64_VEC_ARRANGEMENT_4S },
+    { ARM64_VEC_ARRANGEMENT_1D, ARM64_VEC_ARRANGEMENT_2D },
+};
+
+/* Element specifier for an element size, e.g. v1.s[2] */
+static const int simd_element[4] =
+{
+    ARM64_VEC_ARRANGEMENT_B, ARM64_VEC_ARRANGEMENT_H,
+    ARM64_VEC_ARRANGEMENT_S, ARM64_VEC_ARRANGEMENT_D,
+};
+
+/* Scalar floating-point register width for each ftype, zero if reserved */
+static const uint8_t fp_width[4] = { 32, 64, 0, 16 };
+
+/**
+ *  Operand layout of an Advanced SIMD instruction. Ta is the wide arrangement
+ *  and Tb the narrow one, e.g. saddl v0.8h, v1.8b, v2.8b is SIMD_KIND_LONG.
+ */
+typedef enum simd_kind_t
+{
+    SIMD_KIND_NONE = 0,         // Unallocated
+    SIMD_KIND_SAME,             // Vd.T, Vn.T[, Vm.T]
+    SIMD_KIND_BYTES,            // Vd.8B, Vn.8B[, Vm.8B], size selects the op
+    SIMD_KIND_ZERO,             // Vd.T, Vn.T, #0
+    SIMD_KIND_LONG,             // Vd.Ta, Vn.Tb[, Vm.Tb]
+    SIMD_KIND_WIDE,             // Vd.Ta, Vn.Ta, Vm.Tb
+    SIMD_KIND_NARROW,           // Vd.Tb, Vn.Ta[, Vm.Ta]
+    SIMD_KIND_PAIR_LONG,        // Vd.Ta, Vn.Tb with half as many elements
+    SIMD_KIND_SHLL,             // Vd.Ta, Vn.Tb, #esize
+    SIMD_KIND_FP,               // Vd.T, Vn.T[, Vm.T], T from sz:Q
+    SIMD_KIND_FP_ZERO,          // Vd.T, Vn.T, #0.0
+    SIMD_KIND_FP_LONG,          // fcvtl
+    SIMD_KIND_FP_NARROW,        // fcvtn, fcvtxn
+
+    /* Shift by immediate */
+    SIMD_KIND_SHIFT_RIGHT,      // Vd.T, Vn.T, #shift
+    SIMD_KIND_SHIFT_LEFT,       // Vd.T, Vn.T, #shift
+    SIMD_KIND_SHIFT_NARROW,     // Vd.Tb, Vn.Ta, #shift
+    SIMD_KIND_SHIFT_LONG,       // Vd.Ta, Vn.Tb, #shift
+    SIMD_KIND_SHIFT_FIXED,      // Vd.T, Vn.T, #fbits
+} simd_kind_t;
+
+/* Which forms an opcode is allocated for */
+#define SIMD_VECTOR             (1 << 0)
+#define SIMD_SCALAR             (1 << 1)
+#define SIMD_NO_64              (1 << 2)    // Vector form has no 64-bit elements
+#define SIMD_SCALAR_64          (1 << 3)    // Scalar form only has 64-bit elements
+
+/**
+ *  Advanced SIMD decode table entry. `type2` is the mnemonic for the upper
+ *  half forms used when Q is set, e.g. xtn2, or zero if there isn't one.
+ */
+typedef struct simd_opcode_t
+{
+    arm64_instr_t       type;
+    arm64_instr_t       type2;
+    uint8_t             kind;
+    uint8_t             flags;
+} simd_opcode_t;
+
+#define V(t, k)         { ARM64_INSTRUCTION_##t, 0, SIMD_KIND_##k, SIMD_VECTOR }
+#define S(t, k)         { ARM64_INSTRUCTION_##t, 0, SIMD_KIND_##k, SIMD_SCALAR }
+#define VS(t, k)        { ARM64_INSTRUCTION_##t, 0, SIMD_KIND_##k, SIMD_VECTOR | SIMD_SCALAR }
+#define V2(t, k)        { ARM64_INSTRUCTION_##t, ARM64_INSTRUCTION_##t##2, SIMD_KIND_##k, SIMD_VECTOR }
+#define VS2(t, k)       { ARM64_INSTRUCTION_##t, ARM64_INSTRUCTION_##t##2, SIMD_KIND_##k, SIMD_VECTOR | SIMD_SCALAR }
+#define VN(t, k)        { ARM64_INSTRUCTION_##t, 0, SIMD_KIND_##k, SIMD_VECTOR | SIMD_NO_64 }
+#define VSD(t, k)       { ARM64_INSTRUCTION_##t, 0, SIMD_KIND_##k, SIMD_VECTOR | SIMD_SCALAR | SIMD_SCALAR_64 }
+
+/**
+ *  Three same, indexed by [U][opcode]. The logical operations at opcode 0x03
+ *  are selected by size and handled separately.
+ */
+static const simd_opcode_t simd_three_same[2][24] =
+{
+    {
+        [0x00] = VN(SHADD, SAME),        [0x01] = VS(SQADD, SAME),
+        [0x02] = VN(SRHADD, SAME),       [0x04] = VN(SHSUB, SAME),
+        [0x05] = VS(SQSUB, SAME),       [0x06] = VSD(CMGT, SAME),
+        [0x07] = VSD(CMGE, SAME),        [0x08] = VSD(SSHL, SAME),
+        [0x09] = VS(SQSHL, SAME),       [0x0a] = VSD(SRSHL, SAME),
+        [0x0b] = VS(SQRSHL, SAME),      [0x0c] = VN(SMAX, SAME),
+        [0x0d] = VN(SMIN, SAME),         [0x0e] = VN(SABD, SAME),
+        [0x0f] = VN(SABA, SAME),         [0x10] = VSD(ADD, SAME),
+        [0x11] = VSD(CMTST, SAME),       [0x12] = VN(MLA, SAME),
+        [0x13] = VN(MUL, SAME),          [0x14] = VN(SMAXP, SAME),
+        [0x15] = VN(SMINP, SAME),        [0x16] = VS(SQDMULH, SAME),
+        [0x17] = V(ADDP, SAME),
+    },
+    {
+        [0x00] = VN(UHADD, SAME),        [0x01] = VS(UQADD, SAME),
+        [0x02] = VN(URHADD, SAME),       [0x04] = VN(UHSUB, SAME),
+        [0x05] = VS(UQSUB, SAME),       [0x06] = VSD(CMHI, SAME),
+        [0x07] = VSD(CMHS, SAME),        [0x08] = VSD(USHL, SAME),
+        [0x09] = VS(UQSHL, SAME),       [0x0a] = VSD(URSHL, SAME),
+        [0x0b] = VS(UQRSHL, SAME),      [0x0c] = VN(UMAX, SAME),
+        [0x0d] = VN(UMIN, SAME),         [0x0e] = VN(UABD, SAME),
+        [0x0f] = VN(UABA, SAME),         [0x10] = VSD(SUB, SAME),
+        [0x11] = VSD(CMEQ, SAME),        [0x12] = VN(MLS, SAME),
+        [0x13] = VN(PMUL, SAME),         [0x14] = VN(UMAXP, SAME),
+        [0x15] = VN(UMINP, SAME),        [0x16] = VS(SQRDMULH, SAME),
+    },
+};
+
+/* Three same floating-point, indexed by [U][size<1>][opcode - 0x18] */
+static const simd_opcode_t simd_three_same_fp[2][2][8] =
+{
+    {
+        {
+            [0x0] = V(FMAXNM, FP),      [0x1] = V(FMLA, FP),
+            [0x2] = V(FADD, FP),        [0x3] = VS(FMULX, FP),
+            [0x4] = VS(FCMEQ, FP),      [0x6] = V(FMAX, FP),
+            [0x7] = VS(FRECPS, FP),
+        },
+        {
+            [0x0] = V(FMINNM, FP),      [0x1] = V(FMLS, FP),
+            [0x2] = V(FSUB, FP),        [0x6] = V(FMIN, FP),
+            [0x7] = VS(FRSQRTS, FP),
+        },
+    },
+    {
+        {
+            [0x0] = V(FMAXNMP, FP),     [0x2] = V(FADDP, FP),
+            [0x3] = V(FMUL, FP),        [0x4] = VS(FCMGE, FP),
+            [0x5] = VS(FACGE, FP),      [0x6] = V(FMAXP, FP),
+            [0x7] = V(FDIV, FP),
+        },
+        {
+            [0x0] = V(FMINNMP, FP),     [0x2] = VS(FABD, FP),
+            [0x4] = VS(FCMGT, FP),      [0x5] = VS(FACGT, FP),
+            [0x6] = V(FMINP, FP),
+        },
+    },
+};
+
+/* Three same logical operations, indexed by [U][size] */
+static const arm64_instr_t simd_three_same_logical[2][4] =
+{
+    { ARM64_INSTRUCTION_AND, ARM64_INSTRUCTION_BIC, ARM64_INSTRUCTION_ORR, ARM64_INSTRUCTION_ORN },
+    { ARM64_INSTRUCTION_EOR, ARM64_INSTRUCTION_BSL, ARM64_INSTRUCTION_BIT, ARM64_INSTRUCTION_BIF },
+};
+
+/* Three different, indexed by [U][opcode] */
+static const simd_opcode_t simd_three_different[2][16] =
+{
+    {
+        [0x0] = V2(SADDL, LONG),        [0x1] = V2(SADDW, WIDE),
+        [0x2] = V2(SSUBL, LONG),        [0x3] = V2(SSUBW, WIDE),
+        [0x4] = V2(ADDHN, NARROW),      [0x5] = V2(SABAL, LONG),
+        [0x6] = V2(SUBHN, NARROW),      [0x7] = V2(SABDL, LONG),
+        [0x8] = V2(SMLAL, LONG),        [0x9] = VS2(SQDMLAL, LONG),
+        [0xa] = V2(SMLSL, LONG),        [0xb] = VS2(SQDMLSL, LONG),
+        [0xc] = V2(SMULL, LONG),        [0xd] = VS2(SQDMULL, LONG),
+        [0xe] = V2(PMULL, LONG),
+    },
+    {
+        [0x0] = V2(UADDL, LONG),        [0x1] = V2(UADDW, WIDE),
+        [0x2] = V2(USUBL, LONG),        [0x3] = V2(USUBW, WIDE),
+        [0x4] = V2(RADDHN, NARROW),     [0x5] = V2(UABAL, LONG),
+        [0x6] = V2(RSUBHN, NARROW),     [0x7] = V2(UABDL, LONG),
+        [0x8] = V2(UMLAL, LONG),        [0xa] = V2(UMLSL, LONG),
+        [0xc] = V2(UMULL, LONG),
+    },
+};
+
+/**
+ *  Three same (extra), indexed by [U][opcode]. Only the rounding doubling
+ *  multiply-accumulates are decoded, the dot product, complex and BFloat16
+ *  forms are left unallocated.
+ */
+static const simd_opcode_t simd_three_same_extra[2][16] =
+{
+    [1] = {
+        [0x0] = VS(SQRDMLAH, SAME),     [0x1] = VS(SQRDMLSH, SAME),
+    },
+};
+
+/**
+ *  Two-register miscellaneous, indexed by [U][a][opcode]. `a` is size<1> for
+ *  the floating-point opcodes (0x0c - 0x0f, 0x16 - 0x1f) and zero otherwise.
+ *  NOT and RBIT share opcode 0x05 and are selected by size.
+ */
+static const simd_opcode_t simd_two_reg_misc[2][2][32] =
+{
+    {
+        {
+            [0x00] = VN(REV64, SAME),        [0x01] = VN(REV16, SAME),
+            [0x02] = V(SADDLP, PAIR_LONG),  [0x03] = VS(SUQADD, SAME),
+            [0x04] = VN(CLS, SAME),          [0x05] = VN(CNT, SAME),
+            [0x06] = V(SADALP, PAIR_LONG),  [0x07] = VS(SQABS, SAME),
+            [0x08] = VSD(CMGT, ZERO),        [0x09] = VSD(CMEQ, ZERO),
+            [0x0a] = VSD(CMLT, ZERO),        [0x0b] = VSD(ABS, SAME),
+            [0x12] = V2(XTN, NARROW),       [0x14] = VS2(SQXTN, NARROW),
+            [0x16] = V2(FCVTN, FP_NARROW),  [0x17] = V2(FCVTL, FP_LONG),
+            [0x18] = V(FRINTN, FP),         [0x19] = V(FRINTM, FP),
+            [0x1a] = VS(FCVTNS, FP),        [0x1b] = VS(FCVTMS, FP),
+            [0x1c] = VS(FCVTAS, FP),        [0x1d] = VS(SCVTF, FP),
+            [0x1e] = V(FRINT32Z, FP),       [0x1f] = V(FRINT64Z, FP),
+        },
+        {
+            [0x0c] = VS(FCMGT, FP_ZERO),    [0x0d] = VS(FCMEQ, FP_ZERO),
+            [0x0e] = VS(FCMLT, FP_ZERO),    [0x0f] = V(FABS, FP),
+            [0x18] = V(FRINTP, FP),         [0x19] = V(FRINTZ, FP),
+            [0x1a] = VS(FCVTPS, FP),        [0x1b] = VS(FCVTZS, FP),
+            [0x1c] = V(URECPE, FP),         [0x1d] = VS(FRECPE, FP),
+            [0x1f] = S(FRECPX, FP),
+        },
+    },
+    {
+        {
+            [0x00] = VN(REV32, SAME),        [0x02] = V(UADDLP, PAIR_LONG),
+            [0x03] = VS(USQADD, SAME),      [0x04] = VN(CLZ, SAME),
+            [0x05] = V(NOT, BYTES),         [0x06] = V(UADALP, PAIR_LONG),
+            [0x07] = VS(SQNEG, SAME),       [0x08] = VSD(CMGE, ZERO),
+            [0x09] = VSD(CMLE, ZERO),        [0x0b] = VSD(NEG, SAME),
+            [0x12] = VS2(SQXTUN, NARROW),   [0x13] = V2(SHLL, SHLL),
+            [0x14] = VS2(UQXTN, NARROW),    [0x16] = VS2(FCVTXN, FP_NARROW),
+            [0x18] = V(FRINTA, FP),         [0x19] = V(FRINTX, FP),
+            [0x1a] = VS(FCVTNU, FP),        [0x1b] = VS(FCVTMU, FP),
+            [0x1c] = VS(FCVTAU, FP),        [0x1d] = VS(UCVTF, FP),
+            [0x1e] = V(FRINT32X, FP),       [0x1f] = V(FRINT64X, FP),
+        },
+        {
+            [0x0c] = VS(FCMGE, FP_ZERO),    [0x0d] = VS(FCMLE, FP_ZERO),
+            [0x0f] = V(FNEG, FP),           [0x19] = V(FRINTI, FP),
+            [0x1a] = VS(FCVTPU, FP),        [0x1b] = VS(FCVTZU, FP),
+            [0x1c] = V(URSQRTE, FP),        [0x1d] = VS(FRSQRTE, FP),
+            [0x1f] = V(FSQRT, FP),
+        },
+    },
+};
+
+/* Shift by immediate, indexed by [U][opcode] */
+static const simd_opcode_t simd_shift_immediate[2][32] =
+{
+    {
+        [0x00] = VSD(SSHR, SHIFT_RIGHT),         [0x02] = VSD(SSRA, SHIFT_RIGHT),
+        [0x04] = VSD(SRSHR, SHIFT_RIGHT),        [0x06] = VSD(SRSRA, SHIFT_RIGHT),
+        [0x0a] = VSD(SHL, SHIFT_LEFT),           [0x0e] = VS(SQSHL, SHIFT_LEFT),
+        [0x10] = V2(SHRN, SHIFT_NARROW),        [0x11] = V2(RSHRN, SHIFT_NARROW),
+        [0x12] = VS2(SQSHRN, SHIFT_NARROW),     [0x13] = VS2(SQRSHRN, SHIFT_NARROW),
+        [0x14] = V2(SSHLL, SHIFT_LONG),         [0x1c] = VS(SCVTF, SHIFT_FIXED),
+        [0x1f] = VS(FCVTZS, SHIFT_FIXED),
+    },
+    {
+        [0x00] = VSD(USHR, SHIFT_RIGHT),         [0x02] = VSD(USRA, SHIFT_RIGHT),
+        [0x04] = VSD(URSHR, SHIFT_RIGHT),        [0x06] = VSD(URSRA, SHIFT_RIGHT),
+        [0x08] = VSD(SRI, SHIFT_RIGHT),          [0x0a] = VSD(SLI, SHIFT_LEFT),
+        [0x0c] = VS(SQSHLU, SHIFT_LEFT),        [0x0e] = VS(UQSHL, SHIFT_LEFT),
+        [0x10] = VS2(SQSHRUN, SHIFT_NARROW),    [0x11] = VS2(SQRSHRUN, SHIFT_NARROW),
+        [0x12] = VS2(UQSHRN, SHIFT_NARROW),     [0x13] = VS2(UQRSHRN, SHIFT_NARROW),
+        [0x14] = V2(USHLL, SHIFT_LONG),         [0x1c] = VS(UCVTF, SHIFT_FIXED),
+        [0x1f] = VS(FCVTZU, SHIFT_FIXED),
+    },
+};
+
+/* Vector x indexed element, indexed by [U][opcode] */
+static const simd_opcode_t simd_indexed_element[2][16] =
+{
+    {
+        [0x1] = VS(FMLA, FP),           [0x2] = V2(SMLAL, LONG),
+        [0x3] = VS2(SQDMLAL, LONG),     [0x5] = VS(FMLS, FP),
+        [0x6] = V2(SMLSL, LONG),        [0x7] = VS2(SQDMLSL, LONG),
+        [0x8] = V(MUL, SAME),           [0x9] = VS(FMUL, FP),
+        [0xa] = V2(SMULL, LONG),        [0xb] = VS2(SQDMULL, LONG),
+        [0xc] = VS(SQDMULH, SAME),      [0xd] = VS(SQRDMULH, SAME),
+    },
+    {
+        [0x0] = V(MLA, SAME),           [0x2] = V2(UMLAL, LONG),
+        [0x4] = V(MLS, SAME),           [0x6] = V2(UMLSL, LONG),
+        [0x9] = VS(FMULX, FP),          [0xa] = V2(UMULL, LONG),
+        [0xd] = VS(SQRDMLAH, SAME),     [0xf] = VS(SQRDMLSH, SAME),
+    },
+};
+
+/* Across lanes, indexed by [U][a][opcode], `a` as for two-register misc */
+static const simd_opcode_t simd_across_lanes[2][2][32] =
+{
+    {
+        {
+            [0x03] = V(SADDLV, LONG),       [0x0a] = V(SMAXV, SAME),
+            [0x1a] = V(SMINV, SAME),        [0x1b] = V(ADDV, SAME),
+        },
+    },
+    {
+        {
+            [0x03] = V(UADDLV, LONG),       [0x0a] = V(UMAXV, SAME),
+            [0x1a] = V(UMINV, SAME),        [0x0c] = V(FMAXNMV, FP),
+            [0x0f] = V(FMAXV, FP),
+        },
+        {
+            [0x0c] = V(FMINNMV, FP),        [0x0f] = V(FMINV, FP),
+        },
+    },
+};
+
+#undef V
+#undef S
+#undef VS
+#undef V2
+#undef VS2
+#undef VN
+#undef VSD
+
+/* Permute, indexed by opcode */
+static const arm64_instr_t simd_permute[8] =
+{
+    [1] = ARM64_INSTRUCTION_UZP1,   [2] = ARM64_INSTRUCTION_TRN1,
+    [3] = ARM64_INSTRUCTION_ZIP1,   [5] = ARM64_INSTRUCTION_UZP2,
+    [6] = ARM64_INSTRUCTION_TRN2,   [7] = ARM64_INSTRUCTION_ZIP2,
+};
+
+/* Floating-point data-processing (1 source), indexed by opcode */
+static const arm64_instr_t fp_one_source[32] =
+{
+    [0x00] = ARM64_INSTRUCTION_FMOV,        [0x01] = ARM64_INSTRUCTION_FABS,
+    [0x02] = ARM64_INSTRUCTION_FNEG,        [0x03] = ARM64_INSTRUCTION_FSQRT,
+    [0x04] = ARM64_INSTRUCTION_FCVT,        [0x05] = ARM64_INSTRUCTION_FCVT,
+    [0x07] = ARM64_INSTRUCTION_FCVT,        [0x08] = ARM64_INSTRUCTION_FRINTN,
+    [0x09] = ARM64_INSTRUCTION_FRINTP,      [0x0a] = ARM64_INSTRUCTION_FRINTM,
+    [0x0b] = ARM64_INSTRUCTION_FRINTZ,      [0x0c] = ARM64_INSTRUCTION_FRINTA,
+    [0x0e] = ARM64_INSTRUCTION_FRINTX,      [0x0f] = ARM64_INSTRUCTION_FRINTI,
+    [0x10] = ARM64_INSTRUCTION_FRINT32Z,    [0x11] = ARM64_INSTRUCTION_FRINT32X,
+    [0x12] = ARM64_INSTRUCTION_FRINT64Z,    [0x13] = ARM64_INSTRUCTION_FRINT64X,
+};
+
+/* Floating-point data-processing (2 source), indexed by opcode */
+static const arm64_instr_t fp_two_source[16] =
+{
+    [0x0] = ARM64_INSTRUCTION_FMUL,     [0x1] = ARM64_INSTRUCTION_FDIV,
+    [0x2] = ARM64_INSTRUCTION_FADD,     [0x3] = ARM64_INSTRUCTION_FSUB,
+    [0x4] = ARM64_INSTRUCTION_FMAX,     [0x5] = ARM64_INSTRUCTION_FMIN,
+    [0x6] = ARM64_INSTRUCTION_FMAXNM,   [0x7] = ARM64_INSTRUCTION_FMINNM,
+    [0x8] = ARM64_INSTRUCTION_FNMUL,
+};
+
+/* Floating-point data-processing (3 source), indexed by o1:o0 */
+static const arm64_instr_t fp_three_source[4] =
+{
+    ARM64_INSTRUCTION_FMADD, ARM64_INSTRUCTION_FMSUB,
+    ARM64_INSTRUCTION_FNMADD, ARM64_INSTRUCTION_FNMSUB,
+};
+
+/**
+ *  Direction of a conversion between floating-point and integer. The "top"
+ *  forms move the upper 64-bits of a 128-bit register, e.g. fmov x0, v1.d[1].
+ */
+#define FP_CONVERT_TO_GENERAL       1
+#define FP_CONVERT_TO_FP            2
+#define FP_CONVERT_TO_GENERAL_TOP   3
+#define FP_CONVERT_TO_FP_TOP        4
+
+typedef struct fp_convert_t
+{
+    arm64_instr_t       type;
+    uint8_t             dir;
+} fp_convert_t;
+
+/* Conversion between floating-point and integer, indexed by rmode:opcode */
+static const fp_convert_t fp_convert_integer[32] =
+{
+    [0x00] = { ARM64_INSTRUCTION_FCVTNS, FP_CONVERT_TO_GENERAL },
+    [0x01] = { ARM64_INSTRUCTION_FCVTNU, FP_CONVERT_TO_GENERAL },
+    [0x02] = { ARM64_INSTRUCTION_SCVTF, FP_CONVERT_TO_FP },
+    [0x03] = { ARM64_INSTRUCTION_UCVTF, FP_CONVERT_TO_FP },
+    [0x04] = { ARM64_INSTRUCTION_FCVTAS, FP_CONVERT_TO_GENERAL },
+    [0x05] = { ARM64_INSTRUCTION_FCVTAU, FP_CONVERT_TO_GENERAL },
+    [0x06] = { ARM64_INSTRUCTION_FMOV, FP_CONVERT_TO_GENERAL },
+    [0x07] = { ARM64_INSTRUCTION_FMOV, FP_CONVERT_TO_FP },
+    [0x08] = { ARM64_INSTRUCTION_FCVTPS, FP_CONVERT_TO_GENERAL },
+    [0x09] = { ARM64_INSTRUCTION_FCVTPU, FP_CONVERT_TO_GENERAL },
+    [0x0e] = { ARM64_INSTRUCTION_FMOV, FP_CONVERT_TO_GENERAL_TOP },
+    [0x0f] = { ARM64_INSTRUCTION_FMOV, FP_CONVERT_TO_FP_TOP },
+    [0x10] = { ARM64_INSTRUCTION_FCVTMS, FP_CONVERT_TO_GENERAL },
+    [0x11] = { ARM64_INSTRUCTION_FCVTMU, FP_CONVERT_TO_GENERAL },
+    [0x18] = { ARM64_INSTRUCTION_FCVTZS, FP_CONVERT_TO_GENERAL },
+    [0x19] = { ARM64_INSTRUCTION_FCVTZU, FP_CONVERT_TO_GENERAL },
+    [0x1e] = { ARM64_INSTRUCTION_FJCVTZS, FP_CONVERT_TO_GENERAL },
+};
+
+/******************************************************************************
+*       Operand Helpers
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_vector (instruction_t **instr, unsigned reg, int arrangement)
+{
+    libarch_instruction_add_operand_vector (instr, reg, arrangement, -1, 0, 0);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_element (instruction_t **instr, unsigned reg, unsigned esize, int index)
+{
+    libarch_instruction_add_operand_vector (instr, reg, simd_element[esize], index, 0, 0);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_fp (instruction_t **instr, unsigned reg, unsigned width)
+{
+    libarch_instruction_add_operand_register (instr, reg, width, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_REGISTER_OPERAND_OPT_NONE);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_gp (instruction_t **instr, unsigned reg, unsigned width)
+{
+    libarch_instruction_add_operand_register (instr, reg, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_decimal (instruction_t **instr, uint64_t imm)
+{
+    libarch_instruction_add_operand_immediate (instr, imm, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+}
+
+/**
+ *  \brief  Check a decode table entry is allocated for the given form and
+ *          element size.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_simd_allocated (const simd_opcode_t *op, unsigned scalar, unsigned size)
+{
+    if (!(op->flags & ((scalar) ? SIMD_SCALAR : SIMD_VECTOR))) return 0;
+    if (scalar && (op->flags & SIMD_SCALAR_64) && size != 3) return 0;
+    if (!scalar && (op->flags & SIMD_NO_64) && size == 3) return 0;
+    return 1;
+}
+
+/**
+ *  \brief  Add the operands for a table driven Advanced SIMD instruction,
+ *          working out each register's arrangement from the table kind.
+ *
+ *  \param      instr       Instruction to add the operands to.
+ *  \param      op          Decode table entry.
+ *  \param      scalar      Scalar form, registers are b/h/s/d rather than vectors.
+ *  \param      Q           Q bit.
+ *  \param      size        Size field.
+ *  \param      regs        Rd, Rn and Rm.
+ *  \param      nregs       Number of registers used from `regs`.
+ *
+ *  \return SOFT_FAIL if the size/Q combination is reserved.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+_simd_add_operands (instruction_t **instr, const simd_opcode_t *op, unsigned scalar,
+                    unsigned Q, unsigned size, const unsigned *regs, unsigned nregs)
+{
+    /* Element size (log2 bytes) and Q for each of Rd, Rn and Rm */
+    unsigned esize[3] = { size, size, size };
+    unsigned q[3] = { Q, Q, Q };
+    unsigned sz = size & 1;
+
+    switch (op->kind) {
+        case SIMD_KIND_SAME:
+        case SIMD_KIND_ZERO:
+            if (size == 3 && !Q && !scalar) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            break;
+
+        case SIMD_KIND_BYTES:
+            esize[0] = esize[1] = esize[2] = 0;
+            break;
+
+        case SIMD_KIND_LONG:
+        case SIMD_KIND_SHLL:
+            esize[0] = size + 1; q[0] = 1;
+            break;
+
+        case SIMD_KIND_WIDE:
+            esize[0] = esize[1] = size + 1; q[0] = q[1] = 1;
+            break;
+
+        case SIMD_KIND_NARROW:
+            esize[1] = esize[2] = size + 1; q[1] = q[2] = 1;
+            break;
+
+        case SIMD_KIND_PAIR_LONG:
+            esize[0] = size + 1;
+            break;
+
+        case SIMD_KIND_FP:
+        case SIMD_KIND_FP_ZERO:
+            if (sz && !Q && !scalar) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            esize[0] = esize[1] = esize[2] = 2 + sz;
+            break;
+
+        case SIMD_KIND_FP_LONG:
+            esize[0] = 2 + sz; q[0] = 1;
+            esize[1] = 1 + sz;
+            break;
+
+        case SIMD_KIND_FP_NARROW:
+            esize[0] = 1 + sz;
+            esize[1] = 2 + sz; q[1] = 1;
+            break;
+
+        default:
+            return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    }
+
+    for (unsigned i = 0; i < nregs; i++)
+        if (esize[i] > 3) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = (Q && op->type2 && !scalar) ? op->type2 : op->type;
+
+    for (unsigned i = 0; i < nregs; i++) {
+        if (scalar) _add_fp (instr, regs[i], 8 << esize[i]);
+        else _add_vector (instr, regs[i], simd_arrangement[esize[i]][q[i]]);
+    }
+
+    /* Trailing immediates */
+    if (op->kind == SIMD_KIND_ZERO)
+        _add_decimal (instr, 0);
+    else if (op->kind == SIMD_KIND_FP_ZERO)
+        libarch_instruction_add_operand_immediate (instr, 0, ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    else if (op->kind == SIMD_KIND_SHLL)
+        _add_decimal (instr, 8 << size);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+*       Scalar Floating-Point
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_convert_fixed (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned rmode = select_bits ((*instr)->opcode, 19, 20);
+    unsigned opcode = select_bits ((*instr)->opcode, 16, 18);
+    unsigned scale = select_bits ((*instr)->opcode, 10, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, rmode);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, scale);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned width = fp_width[ftype];
+    unsigned gp = (sf) ? 64 : 32;
+    if (S || !width || (!sf && scale < 32)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    if (rmode == 0 && (opcode == 2 || opcode == 3)) {
+        (*instr)->type = (opcode == 2) ? ARM64_INSTRUCTION_SCVTF : ARM64_INSTRUCTION_UCVTF;
+        _add_fp (instr, Rd, width);
+        _add_gp (instr, Rn, gp);
+    } else if (rmode == 3 && (opcode == 0 || opcode == 1)) {
+        (*instr)->type = (opcode == 0) ? ARM64_INSTRUCTION_FCVTZS : ARM64_INSTRUCTION_FCVTZU;
+        _add_gp (instr, Rd, gp);
+        _add_fp (instr, Rn, width);
+    } else {
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    }
+
+    /* fbits */
+    _add_decimal (instr, 64 - scale);
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_convert_integer (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned rmode = select_bits ((*instr)->opcode, 19, 20);
+    unsigned opcode = select_bits ((*instr)->opcode, 16, 18);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, rmode);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    const fp_convert_t *conv = &fp_convert_integer[(rmode << 3) | opcode];
+    unsigned width = fp_width[ftype];
+    unsigned gp = (sf) ? 64 : 32;
+
+    if (S || !conv->dir) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* The top half moves only exist as fmov x, v.d[1] and fmov v.d[1], x */
+    if (conv->dir == FP_CONVERT_TO_GENERAL_TOP || conv->dir == FP_CONVERT_TO_FP_TOP) {
+        if (!sf || ftype != 2) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+        (*instr)->type = conv->type;
+
+        if (conv->dir == FP_CONVERT_TO_GENERAL_TOP) {
+            _add_gp (instr, Rd, 64);
+            _add_element (instr, Rn, 3, 1);
+        } else {
+            _add_element (instr, Rd, 3, 1);
+            _add_gp (instr, Rn, 64);
+        }
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    if (!width) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* fmov between registers of the same width, or a half-precision register */
+    if (conv->type == ARM64_INSTRUCTION_FMOV && width != 16 && width != gp)
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* fjcvtzs w, d only */
+    if (conv->type == ARM64_INSTRUCTION_FJCVTZS && (sf || ftype != 1))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = conv->type;
+    if (conv->dir == FP_CONVERT_TO_GENERAL) {
+        _add_gp (instr, Rd, gp);
+        _add_fp (instr, Rn, width);
+    } else {
+        _add_fp (instr, Rd, width);
+        _add_gp (instr, Rn, gp);
+    }
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_data_processing_1_source (instruction_t **instr)
+{
+    unsigned M = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned opcode = select_bits ((*instr)->opcode, 15, 20);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, M);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned width = fp_width[ftype];
+    unsigned dest = width;
+
+    if (M || S || !width || opcode >= 32 || !fp_one_source[opcode])
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* fcvt encodes the destination precision in opcode<1:0> */
+    if (fp_one_source[opcode] == ARM64_INSTRUCTION_FCVT) {
+        dest = fp_width[opcode & 3];
+        if (dest == width) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    }
+
+    (*instr)->type = fp_one_source[opcode];
+    _add_fp (instr, Rd, dest);
+    _add_fp (instr, Rn, width);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_compare (instruction_t **instr)
+{
+    unsigned M = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned op = select_bits ((*instr)->opcode, 14, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned opcode2 = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, M);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, opcode2);
+
+    unsigned width = fp_width[ftype];
+    if (M || S || op || !width || (opcode2 & 7)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* opcode2<4> is fcmpe, opcode2<3> compares against zero */
+    (*instr)->type = (opcode2 & 0x10) ? ARM64_INSTRUCTION_FCMPE : ARM64_INSTRUCTION_FCMP;
+    _add_fp (instr, Rn, width);
+
+    if (opcode2 & 0x8) libarch_instruction_add_operand_immediate (instr, 0, ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    else _add_fp (instr, Rm, width);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_immediate (instruction_t **instr)
+{
+    unsigned M = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned imm8 = select_bits ((*instr)->opcode, 13, 20);
+    unsigned imm5 = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, M);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, imm8);
+    libarch_instruction_add_field (instr, imm5);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned width = fp_width[ftype];
+    if (M || S || imm5 || !width) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = ARM64_INSTRUCTION_FMOV;
+    _add_fp (instr, Rd, width);
+    libarch_instruction_add_operand_immediate (instr, arm64_fp_expand_imm (imm8), ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_conditional_compare (instruction_t **instr)
+{
+    unsigned M = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned cond = select_bits ((*instr)->opcode, 12, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned op = select_bits ((*instr)->opcode, 4, 4);
+    unsigned nzcv = select_bits ((*instr)->opcode, 0, 3);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, M);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, cond);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, nzcv);
+
+    unsigned width = fp_width[ftype];
+    if (M || S || !width) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = (op) ? ARM64_INSTRUCTION_FCCMPE : ARM64_INSTRUCTION_FCCMP;
+    _add_fp (instr, Rn, width);
+    _add_fp (instr, Rm, width);
+    _add_decimal (instr, nzcv);
+    libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_CONDITION, cond);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_data_processing_2_source (instruction_t **instr)
+{
+    unsigned M = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, M);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned width = fp_width[ftype];
+    if (M || S || !width || !fp_two_source[opcode]) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = fp_two_source[opcode];
+    _add_fp (instr, Rd, width);
+    _add_fp (instr, Rn, width);
+    _add_fp (instr, Rm, width);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_conditional_select (instruction_t **instr)
+{
+    unsigned M = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned cond = select_bits ((*instr)->opcode, 12, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, M);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, cond);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned width = fp_width[ftype];
+    if (M || S || !width) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = ARM64_INSTRUCTION_FCSEL;
+    _add_fp (instr, Rd, width);
+    _add_fp (instr, Rn, width);
+    _add_fp (instr, Rm, width);
+    libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_CONDITION, cond);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_fp_data_processing_3_source (instruction_t **instr)
+{
+    unsigned M = select_bits ((*instr)->opcode, 31, 31);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned ftype = select_bits ((*instr)->opcode, 22, 23);
+    unsigned o1 = select_bits ((*instr)->opcode, 21, 21);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned o0 = select_bits ((*instr)->opcode, 15, 15);
+    unsigned Ra = select_bits ((*instr)->opcode, 10, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, M);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, ftype);
+    libarch_instruction_add_field (instr, o1);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, o0);
+    libarch_instruction_add_field (instr, Ra);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned width = fp_width[ftype];
+    if (M || S || !width) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = fp_three_source[(o1 << 1) | o0];
+    _add_fp (instr, Rd, width);
+    _add_fp (instr, Rn, width);
+    _add_fp (instr, Rm, width);
+    _add_fp (instr, Ra, width);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+*       Advanced SIMD
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_three_same (instruction_t **instr, unsigned scalar)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned opcode = select_bits ((*instr)->opcode, 11, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned regs[3] = { Rd, Rn, Rm };
+    const simd_opcode_t *op;
+
+    /* Logical operations, with orr v, v, v as the mov alias */
+    if (opcode == 0x03) {
+        if (scalar) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+        if (!U && size == 2 && Rn == Rm) {
+            (*instr)->type = ARM64_INSTRUCTION_MOV;
+            _add_vector (instr, Rd, simd_arrangement[0][Q]);
+            _add_vector (instr, Rn, simd_arrangement[0][Q]);
+            return LIBARCH_DECODE_STATUS_SUCCESS;
+        }
+
+        (*instr)->type = simd_three_same_logical[U][size];
+        for (unsigned i = 0; i < 3; i++) _add_vector (instr, regs[i], simd_arrangement[0][Q]);
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    if (opcode >= 0x18) op = &simd_three_same_fp[U][size >> 1][opcode - 0x18];
+    else op = &simd_three_same[U][opcode];
+
+    if (!_simd_allocated (op, scalar, size)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* pmul is bytes only, the doubling multiplies halfwords and words only */
+    if (op->type == ARM64_INSTRUCTION_PMUL && size) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    if ((op->type == ARM64_INSTRUCTION_SQDMULH || op->type == ARM64_INSTRUCTION_SQRDMULH) && (size == 0 || size == 3))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    return _simd_add_operands (instr, op, scalar, Q, size, regs, 3);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_three_different (instruction_t **instr, unsigned scalar)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned regs[3] = { Rd, Rn, Rm };
+    const simd_opcode_t *op = &simd_three_different[U][opcode];
+
+    /* The scalar forms are just sqdmlal, sqdmlsl and sqdmull */
+    if (scalar && !(op->flags & SIMD_SCALAR)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    if (!op->type || size == 3) {
+        /* pmull v.1q, v.1d, v.1d is the only 64-bit element form */
+        if (op->type != ARM64_INSTRUCTION_PMULL) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+        (*instr)->type = (Q) ? op->type2 : op->type;
+        _add_vector (instr, Rd, ARM64_VEC_ARRANGEMENT_1Q);
+        _add_vector (instr, Rn, simd_arrangement[3][Q]);
+        _add_vector (instr, Rm, simd_arrangement[3][Q]);
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    /* The saturating doubling forms only have halfword and word elements */
+    if ((opcode == 0x9 || opcode == 0xb || opcode == 0xd) && size == 0) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    if (op->type == ARM64_INSTRUCTION_PMULL && size) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    return _simd_add_operands (instr, op, scalar, Q, size, regs, 3);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_three_same_extra (instruction_t **instr, unsigned scalar)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned opcode = select_bits ((*instr)->opcode, 11, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned regs[3] = { Rd, Rn, Rm };
+    const simd_opcode_t *op = &simd_three_same_extra[U][opcode];
+
+    if (!_simd_allocated (op, scalar, size)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* sqrdmlah and sqrdmlsh only have halfword and word elements */
+    if (size == 0 || size == 3) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    return _simd_add_operands (instr, op, scalar, Q, size, regs, 3);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_two_register_misc (instruction_t **instr, unsigned scalar)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 16);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned regs[2] = { Rd, Rn };
+    unsigned fp = (opcode >= 0x16 || (opcode & 0x1c) == 0x0c);
+    const simd_opcode_t *op = &simd_two_reg_misc[U][(fp) ? size >> 1 : 0][opcode];
+
+    if (!_simd_allocated (op, scalar, size)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* The byte reversals and cnt are limited by the container size */
+    if ((op->type == ARM64_INSTRUCTION_REV16 || op->type == ARM64_INSTRUCTION_CNT) && size) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    if (op->type == ARM64_INSTRUCTION_REV32 && size > 1) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* not (written as mvn) and rbit share an opcode, selected by size */
+    if (op->kind == SIMD_KIND_BYTES && size > 1) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    decode_status_t res = _simd_add_operands (instr, op, scalar, Q, size, regs, 2);
+    if (op->kind == SIMD_KIND_BYTES) (*instr)->type = (size) ? ARM64_INSTRUCTION_RBIT : ARM64_INSTRUCTION_MVN;
+    return res;
+}
+
+/**
+ *  Half-precision two-register miscellaneous. The opcodes match the single and
+ *  double precision forms with `a` as bit 23, less the conversions and
+ *  roundings that have no half-precision variant.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_two_register_misc_fp16 (instruction_t **instr, unsigned scalar)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned a = select_bits ((*instr)->opcode, 23, 23);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 16);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, a);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    const simd_opcode_t *op = &simd_two_reg_misc[U][a][opcode];
+
+    if (op->kind != SIMD_KIND_FP && op->kind != SIMD_KIND_FP_ZERO) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    if (!_simd_allocated (op, scalar, 1)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    switch (op->type) {
+        case ARM64_INSTRUCTION_URECPE:
+        case ARM64_INSTRUCTION_URSQRTE:
+        case ARM64_INSTRUCTION_FRINT32Z:
+        case ARM64_INSTRUCTION_FRINT32X:
+        case ARM64_INSTRUCTION_FRINT64Z:
+        case ARM64_INSTRUCTION_FRINT64X:
+            return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+        default:
+            break;
+    }
+
+    (*instr)->type = op->type;
+    if (scalar) {
+        _add_fp (instr, Rd, 16);
+        _add_fp (instr, Rn, 16);
+    } else {
+        _add_vector (instr, Rd, simd_arrangement[1][Q]);
+        _add_vector (instr, Rn, simd_arrangement[1][Q]);
+    }
+
+    if (op->kind == SIMD_KIND_FP_ZERO)
+        libarch_instruction_add_operand_immediate (instr, 0, ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_across_lanes (instruction_t **instr)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 16);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned fp = ((opcode & 0x1c) == 0x0c);
+    const simd_opcode_t *op = &simd_across_lanes[U][(fp) ? size >> 1 : 0][opcode];
+
+    if (!op->type) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* Floating-point reductions only have a 4S form */
+    if (op->kind == SIMD_KIND_FP) {
+        if ((size & 1) || !Q) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+        (*instr)->type = op->type;
+        _add_fp (instr, Rd, 32);
+        _add_vector (instr, Rn, ARM64_VEC_ARRANGEMENT_4S);
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    if (size == 3 || (size == 2 && !Q)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    (*instr)->type = op->type;
+    _add_fp (instr, Rd, (op->kind == SIMD_KIND_LONG) ? 16 << size : 8 << size);
+    _add_vector (instr, Rn, simd_arrangement[size][Q]);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_copy (instruction_t **instr, unsigned scalar)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned op = select_bits ((*instr)->opcode, 29, 29);
+    unsigned imm5 = select_bits ((*instr)->opcode, 16, 20);
+    unsigned imm4 = select_bits ((*instr)->opcode, 11, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, imm5);
+    libarch_instruction_add_field (instr, imm4);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    /* The lowest set bit of imm5 is the element size, the bits above the index */
+    if (!(imm5 & 15)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    unsigned esize = 0;
+    while (!(imm5 & (1 << esize))) esize++;
+    unsigned index = imm5 >> (esize + 1);
+
+    /* Scalar dup is always written as mov b0, v1.b[1] */
+    if (scalar) {
+        if (op || imm4) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+        (*instr)->type = ARM64_INSTRUCTION_MOV;
+        _add_fp (instr, Rd, 8 << esize);
+        _add_element (instr, Rn, esize, index);
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    /* ins (element), written as mov v0.s[1], v1.s[0] */
+    if (op) {
+        if (!Q) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+        (*instr)->type = ARM64_INSTRUCTION_MOV;
+        _add_element (instr, Rd, esize, index);
+        _add_element (instr, Rn, esize, imm4 >> esize);
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    switch (imm4) {
+        case 0x0:
+        case 0x1:
+            /* dup (element) and dup (general) */
+            if (esize == 3 && !Q) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            (*instr)->type = ARM64_INSTRUCTION_DUP;
+            _add_vector (instr, Rd, simd_arrangement[esize][Q]);
+            if (imm4) _add_gp (instr, Rn, (esize == 3) ? 64 : 32);
+            else _add_element (instr, Rn, esize, index);
+            break;
+
+        case 0x3:
+            /* ins (general), written as mov v0.s[1], w0 */
+            if (!Q) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            (*instr)->type = ARM64_INSTRUCTION_MOV;
+            _add_element (instr, Rd, esize, index);
+            _add_gp (instr, Rn, (esize == 3) ? 64 : 32);
+            break;
+
+        case 0x5:
+            /* smov, w for b/h and x for b/h/s */
+            if (esize >= ((Q) ? 3 : 2)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            (*instr)->type = ARM64_INSTRUCTION_SMOV;
+            _add_gp (instr, Rd, (Q) ? 64 : 32);
+            _add_element (instr, Rn, esize, index);
+            break;
+
+        case 0x7:
+            /* umov, with mov as the alias for the full width w/x forms */
+            if ((Q && esize != 3) || (!Q && esize == 3)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            (*instr)->type = (esize >= 2) ? ARM64_INSTRUCTION_MOV : ARM64_INSTRUCTION_UMOV;
+            _add_gp (instr, Rd, (Q) ? 64 : 32);
+            _add_element (instr, Rn, esize, index);
+            break;
+
+        default:
+            return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    }
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_modified_immediate (instruction_t **instr)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned op = select_bits ((*instr)->opcode, 29, 29);
+    unsigned abc = select_bits ((*instr)->opcode, 16, 18);
+    unsigned cmode = select_bits ((*instr)->opcode, 12, 15);
+    unsigned o2 = select_bits ((*instr)->opcode, 11, 11);
+    unsigned defgh = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, abc);
+    libarch_instruction_add_field (instr, cmode);
+    libarch_instruction_add_field (instr, o2);
+    libarch_instruction_add_field (instr, defgh);
+    libarch_instruction_add_field (instr, Rd);
+
+    unsigned imm8 = (abc << 5) | defgh;
+    if (o2 && cmode != 15) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    if (cmode < 12) {
+        /* 32-bit (cmode 0xxx) and 16-bit (cmode 10xx) shifted immediates */
+        unsigned esize = (cmode < 8) ? 2 : 1;
+        unsigned shift = (cmode >> 1) & ((esize == 2) ? 3 : 1);
+
+        if (cmode & 1) (*instr)->type = (op) ? ARM64_INSTRUCTION_BIC : ARM64_INSTRUCTION_ORR;
+        else (*instr)->type = (op) ? ARM64_INSTRUCTION_MVNI : ARM64_INSTRUCTION_MOVI;
+
+        _add_vector (instr, Rd, simd_arrangement[esize][Q]);
+        libarch_instruction_add_operand_immediate (instr, imm8, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+        if (shift) libarch_instruction_add_operand_shift (instr, shift * 8, ARM64_SHIFT_TYPE_LSL);
+
+    } else if (cmode < 14) {
+        /* 32-bit shifting ones */
+        (*instr)->type = (op) ? ARM64_INSTRUCTION_MVNI : ARM64_INSTRUCTION_MOVI;
+        _add_vector (instr, Rd, simd_arrangement[2][Q]);
+        libarch_instruction_add_operand_immediate (instr, imm8, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+        libarch_instruction_add_operand_shift (instr, (cmode & 1) ? 16 : 8, ARM64_SHIFT_TYPE_MSL);
+
+    } else if (cmode == 14 && !op) {
+        /* 8-bit */
+        (*instr)->type = ARM64_INSTRUCTION_MOVI;
+        _add_vector (instr, Rd, simd_arrangement[0][Q]);
+        libarch_instruction_add_operand_immediate (instr, imm8, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+
+    } else if (cmode == 14) {
+        /* 64-bit, each bit of imm8 expands to a byte */
+        uint64_t imm = 0;
+        for (unsigned i = 0; i < 8; i++)
+            if (imm8 & (1 << i)) imm |= 0xffULL << (i * 8);
+
+        (*instr)->type = ARM64_INSTRUCTION_MOVI;
+        if (Q) _add_vector (instr, Rd, ARM64_VEC_ARRANGEMENT_2D);
+        else _add_fp (instr, Rd, 64);
+        libarch_instruction_add_operand_immediate (instr, imm, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+
+    } else {
+        /* fmov, single (op 0) or double (op 1) precision, or half with o2 */
+        if (op && (!Q || o2)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+        (*instr)->type = ARM64_INSTRUCTION_FMOV;
+        _add_vector (instr, Rd, simd_arrangement[(o2) ? 1 : 2 + op][Q]);
+        libarch_instruction_add_operand_immediate (instr, arm64_fp_expand_imm (imm8), ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    }
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_shift_immediate (instruction_t **instr, unsigned scalar)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned immh = select_bits ((*instr)->opcode, 19, 22);
+    unsigned immb = select_bits ((*instr)->opcode, 16, 18);
+    unsigned opcode = select_bits ((*instr)->opcode, 11, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, immh);
+    libarch_instruction_add_field (instr, immb);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    const simd_opcode_t *op = &simd_shift_immediate[U][opcode];
+    if (!immh) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* The highest set bit of immh is the element size */
+    unsigned esize = 3;
+    while (!(immh & (1 << esize))) esize--;
+
+    if (!_simd_allocated (op, scalar, esize)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    unsigned shift = (immh << 3) | immb;
+    unsigned right = (16 << esize) - shift;
+    unsigned left = shift - (8 << esize);
+    unsigned wide = esize + 1;
+
+    switch (op->kind) {
+        case SIMD_KIND_SHIFT_NARROW:
+        case SIMD_KIND_SHIFT_LONG:
+            if (esize == 3) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            break;
+
+        case SIMD_KIND_SHIFT_FIXED:
+            if (esize < 2) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            /* fall through */
+        default:
+            if (esize == 3 && !Q && !scalar) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            break;
+    }
+
+    (*instr)->type = (Q && op->type2 && !scalar) ? op->type2 : op->type;
+
+    if (op->kind == SIMD_KIND_SHIFT_NARROW) {
+        if (scalar) {
+            _add_fp (instr, Rd, 8 << esize);
+            _add_fp (instr, Rn, 8 << wide);
+        } else {
+            _add_vector (instr, Rd, simd_arrangement[esize][Q]);
+            _add_vector (instr, Rn, simd_arrangement[wide][1]);
+        }
+        _add_decimal (instr, right);
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    if (op->kind == SIMD_KIND_SHIFT_LONG) {
+        _add_vector (instr, Rd, simd_arrangement[wide][1]);
+        _add_vector (instr, Rn, simd_arrangement[esize][Q]);
+
+        /* sshll/ushll with no shift are sxtl/uxtl */
+        if (left == 0) {
+            if (U) (*instr)->type = (Q) ? ARM64_INSTRUCTION_UXTL2 : ARM64_INSTRUCTION_UXTL;
+            else (*instr)->type = (Q) ? ARM64_INSTRUCTION_SXTL2 : ARM64_INSTRUCTION_SXTL;
+        } else {
+            _add_decimal (instr, left);
+        }
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    if (scalar) {
+        _add_fp (instr, Rd, 8 << esize);
+        _add_fp (instr, Rn, 8 << esize);
+    } else {
+        _add_vector (instr, Rd, simd_arrangement[esize][Q]);
+        _add_vector (instr, Rn, simd_arrangement[esize][Q]);
+    }
+
+    /* Right shifts and fbits are encoded as (2 * esize) - shift */
+    _add_decimal (instr, (op->kind == SIMD_KIND_SHIFT_LEFT) ? left : right);
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_indexed_element (instruction_t **instr, unsigned scalar)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned L = select_bits ((*instr)->opcode, 21, 21);
+    unsigned M = select_bits ((*instr)->opcode, 20, 20);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 19);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 15);
+    unsigned H = select_bits ((*instr)->opcode, 11, 11);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, L);
+    libarch_instruction_add_field (instr, M);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, H);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    const simd_opcode_t *op = &simd_indexed_element[U][opcode];
+    unsigned index;
+
+    if (!(op->flags & ((scalar) ? SIMD_SCALAR : SIMD_VECTOR))) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* Floating-point half-precision uses size 00, 01 is reserved */
+    if (op->kind == SIMD_KIND_FP && size == 1) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /**
+     *  16-bit elements can only use v0-v15 and take the index from H:L:M, 32-bit
+     *  elements use M as the top bit of Rm, 64-bit (floating-point only) just H.
+     */
+    if (size == 1 || (size == 0 && op->kind == SIMD_KIND_FP)) {
+        size = 1;
+        index = (H << 2) | (L << 1) | M;
+    } else if (size == 2) {
+        index = (H << 1) | L;
+        Rm |= M << 4;
+    } else if (size == 3 && op->kind == SIMD_KIND_FP && !L) {
+        index = H;
+        Rm |= M << 4;
+    } else {
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    }
+
+    unsigned wide = (op->kind == SIMD_KIND_LONG) ? size + 1 : size;
+    if (!scalar && size == 3 && !Q) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = (Q && op->type2 && !scalar) ? op->type2 : op->type;
+
+    if (scalar) {
+        _add_fp (instr, Rd, 8 << wide);
+        _add_fp (instr, Rn, 8 << size);
+    } else {
+        _add_vector (instr, Rd, simd_arrangement[wide][(wide != size) ? 1 : Q]);
+        _add_vector (instr, Rn, simd_arrangement[size][Q]);
+    }
+    _add_element (instr, Rm, size, index);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_scalar_pairwise (instruction_t **instr)
+{
+    unsigned U = select_bits ((*instr)->opcode, 29, 29);
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 16);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, U);
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    /* addp d0, v1.2d */
+    if (!U) {
+        if (opcode != 0x1b || size != 3) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+        (*instr)->type = ARM64_INSTRUCTION_ADDP;
+        _add_fp (instr, Rd, 64);
+        _add_vector (instr, Rn, ARM64_VEC_ARRANGEMENT_2D);
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    /* Floating-point, indexed by size<1>:opcode<1:0> */
+    static const arm64_instr_t fp_pairwise[8] =
+    {
+        [0] = ARM64_INSTRUCTION_FMAXNMP,    [1] = ARM64_INSTRUCTION_FADDP,
+        [3] = ARM64_INSTRUCTION_FMAXP,      [4] = ARM64_INSTRUCTION_FMINNMP,
+        [7] = ARM64_INSTRUCTION_FMINP,
+    };
+
+    unsigned type = ((size >> 1) << 2) | (opcode & 3);
+    if ((opcode & 0x1c) != 0x0c || !fp_pairwise[type]) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = fp_pairwise[type];
+    _add_fp (instr, Rd, (size & 1) ? 64 : 32);
+    _add_vector (instr, Rn, (size & 1) ? ARM64_VEC_ARRANGEMENT_2D : ARM64_VEC_ARRANGEMENT_2S);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_permute (instruction_t **instr)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    if (!simd_permute[opcode] || (size == 3 && !Q)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = simd_permute[opcode];
+    _add_vector (instr, Rd, simd_arrangement[size][Q]);
+    _add_vector (instr, Rn, simd_arrangement[size][Q]);
+    _add_vector (instr, Rm, simd_arrangement[size][Q]);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_extract (instruction_t **instr)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned op2 = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned imm4 = select_bits ((*instr)->opcode, 11, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, op2);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, imm4);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    if (op2 || (!Q && imm4 >= 8)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = ARM64_INSTRUCTION_EXT;
+    _add_vector (instr, Rd, simd_arrangement[0][Q]);
+    _add_vector (instr, Rn, simd_arrangement[0][Q]);
+    _add_vector (instr, Rm, simd_arrangement[0][Q]);
+    _add_decimal (instr, imm4);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_simd_table_lookup (instruction_t **instr)
+{
+    unsigned Q = select_bits ((*instr)->opcode, 30, 30);
+    unsigned op2 = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned len = select_bits ((*instr)->opcode, 13, 14);
+    unsigned op = select_bits ((*instr)->opcode, 12, 12);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, Q);
+    libarch_instruction_add_field (instr, op2);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, len);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    if (op2) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = (op) ? ARM64_INSTRUCTION_TBX : ARM64_INSTRUCTION_TBL;
+    _add_vector (instr, Rd, simd_arrangement[0][Q]);
+
+    /* Table register list, wrapping around from v31 to v0 */
+    for (unsigned i = 0; i <= len; i++)
+        libarch_instruction_add_operand_vector (instr, (Rn + i) & 31, ARM64_VEC_ARRANGEMENT_16B, -1,
+            (i == 0) ? '{' : 0, (i == len) ? '}' : 0);
+
+    _add_vector (instr, Rm, simd_arrangement[0][Q]);
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+*       Cryptographic
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_crypto_aes (instruction_t **instr)
+{
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 16);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    static const arm64_instr_t aes[4] =
+    {
+        ARM64_INSTRUCTION_AESE, ARM64_INSTRUCTION_AESD,
+        ARM64_INSTRUCTION_AESMC, ARM64_INSTRUCTION_AESIMC,
+    };
+
+    if (size || (opcode & 0x1c) != 0x04) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = aes[opcode & 3];
+    _add_vector (instr, Rd, ARM64_VEC_ARRANGEMENT_16B);
+    _add_vector (instr, Rn, ARM64_VEC_ARRANGEMENT_16B);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_crypto_sha_three_register (instruction_t **instr)
+{
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    static const arm64_instr_t sha[7] =
+    {
+        ARM64_INSTRUCTION_SHA1C, ARM64_INSTRUCTION_SHA1P, ARM64_INSTRUCTION_SHA1M,
+        ARM64_INSTRUCTION_SHA1SU0, ARM64_INSTRUCTION_SHA256H, ARM64_INSTRUCTION_SHA256H2,
+        ARM64_INSTRUCTION_SHA256SU1,
+    };
+
+    if (size || opcode == 7) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    (*instr)->type = sha[opcode];
+
+    if (opcode <= 2) {
+        /* sha1c/p/m q0, s1, v2.4s */
+        _add_fp (instr, Rd, 128);
+        _add_fp (instr, Rn, 32);
+    } else if (opcode == 4 || opcode == 5) {
+        /* sha256h/h2 q0, q1, v2.4s */
+        _add_fp (instr, Rd, 128);
+        _add_fp (instr, Rn, 128);
+    } else {
+        _add_vector (instr, Rd, ARM64_VEC_ARRANGEMENT_4S);
+        _add_vector (instr, Rn, ARM64_VEC_ARRANGEMENT_4S);
+    }
+    _add_vector (instr, Rm, ARM64_VEC_ARRANGEMENT_4S);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_crypto_sha_two_register (instruction_t **instr)
+{
+    unsigned size = select_bits ((*instr)->opcode, 22, 23);
+    unsigned opcode = select_bits ((*instr)->opcode, 12, 16);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, opcode);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    if (size || opcode > 2) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    if (opcode == 0) {
+        /* sha1h s0, s1 */
+        (*instr)->type = ARM64_INSTRUCTION_SHA1H;
+        _add_fp (instr, Rd, 32);
+        _add_fp (instr, Rn, 32);
+    } else {
+        (*instr)->type = (opcode == 1) ? ARM64_INSTRUCTION_SHA1SU1 : ARM64_INSTRUCTION_SHA256SU0;
+        _add_vector (instr, Rd, ARM64_VEC_ARRANGEMENT_4S);
+        _add_vector (instr, Rn, ARM64_VEC_ARRANGEMENT_4S);
+    }
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+disass_fp_instruction (instruction_t *instr)
+{
+    unsigned op1 = select_bits (instr->opcode, 23, 24);
+    unsigned op2 = select_bits (instr->opcode, 19, 22);
+    unsigned op3 = select_bits (instr->opcode, 10, 18);
+
+    if (op1 & 2) {
+        if (decode_fp_data_processing_3_source (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_DATA_PROCESSING_3_SOURCE;
+    } else if (!(op2 & 4)) {
+        if (decode_fp_convert_fixed (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_CONVERT_FIXED;
+    } else if ((op3 & 0x3f) == 0) {
+        if (decode_fp_convert_integer (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_CONVERT_INTEGER;
+    } else if ((op3 & 0x1f) == 0x10) {
+        if (decode_fp_data_processing_1_source (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_DATA_PROCESSING_1_SOURCE;
+    } else if ((op3 & 0xf) == 0x8) {
+        if (decode_fp_compare (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_COMPARE;
+    } else if ((op3 & 0x7) == 0x4) {
+        if (decode_fp_immediate (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_IMMEDIATE;
+    } else if ((op3 & 0x3) == 0x1) {
+        if (decode_fp_conditional_compare (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_CONDITIONAL_COMPARE;
+    } else if ((op3 & 0x3) == 0x2) {
+        if (decode_fp_data_processing_2_source (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_DATA_PROCESSING_2_SOURCE;
+    } else {
+        if (decode_fp_conditional_select (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_FP_CONDITIONAL_SELECT;
+    }
+
+    return (instr->subgroup != ARM64_DECODE_SUBGROUP_UNKNOWN) ? LIBARCH_DECODE_STATUS_SUCCESS : LIBARCH_DECODE_STATUS_SOFT_FAIL;
+}
+
+/**
+ *  Advanced SIMD, both the vector (op0 0xx0) and scalar (op0 01x1) forms. The
+ *  scalar classes mirror the vector ones, so both share a decoder and `scalar`
+ *  only changes which table entries are allowed and how registers are named.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+disass_simd_instruction (instruction_t *instr, unsigned scalar)
+{
+    unsigned op0 = select_bits (instr->opcode, 28, 31);
+    unsigned op1 = select_bits (instr->opcode, 23, 24);
+    unsigned op2 = select_bits (instr->opcode, 19, 22);
+    unsigned op3 = select_bits (instr->opcode, 10, 18);
+
+    if (op1 == 2 && (op3 & 1)) {
+        if (!scalar && op2 == 0) {
+            if (decode_simd_modified_immediate (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+                instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_MODIFIED_IMMEDIATE;
+        } else if (decode_simd_shift_immediate (&instr, scalar) == LIBARCH_DECODE_STATUS_SUCCESS) {
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_SHIFT_IMMEDIATE;
+        }
+    } else if (op1 & 2) {
+        if (!(op3 & 1) && decode_simd_indexed_element (&instr, scalar) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_INDEXED_ELEMENT;
+    } else if (op1 == 0 && (op2 >> 2) == 0 && !(op3 & 0x20) && (op3 & 1)) {
+        if (decode_simd_copy (&instr, scalar) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_COPY;
+    } else if (!scalar && !(op2 & 4) && !(op3 & 0x21) && !(op0 & 2)) {
+        if ((op3 & 2) == 0) {
+            if (decode_simd_table_lookup (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+                instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_TABLE_LOOKUP;
+        } else if (decode_simd_permute (&instr) == LIBARCH_DECODE_STATUS_SUCCESS) {
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_PERMUTE;
+        }
+    } else if (!scalar && !(op2 & 4) && !(op3 & 0x21) && (op0 & 2)) {
+        if (decode_simd_extract (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_EXTRACT;
+    } else if ((op2 & 7) == 4 && (op3 & 0x183) == 0x002) {
+        if (decode_simd_two_register_misc (&instr, scalar) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_TWO_REGISTER_MISC;
+    } else if ((op2 & 7) == 7 && (op3 & 0x183) == 0x002) {
+        if (decode_simd_two_register_misc_fp16 (&instr, scalar) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_TWO_REGISTER_MISC_FP16;
+    } else if (!(op2 & 4) && (op3 & 0x21) == 0x21) {
+        if (decode_simd_three_same_extra (&instr, scalar) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_THREE_SAME_EXTRA;
+    } else if ((op2 & 7) == 6 && (op3 & 0x183) == 0x002) {
+        if (scalar) {
+            if (decode_simd_scalar_pairwise (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+                instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_SCALAR_PAIRWISE;
+        } else if (decode_simd_across_lanes (&instr) == LIBARCH_DECODE_STATUS_SUCCESS) {
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_ACROSS_LANES;
+        }
+    } else if ((op2 & 4) && (op3 & 3) == 0) {
+        if (decode_simd_three_different (&instr, scalar) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_THREE_DIFFERENT;
+    } else if ((op2 & 4) && (op3 & 1)) {
+        if (decode_simd_three_same (&instr, scalar) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_SIMD_THREE_SAME;
+    }
+
+    return (instr->subgroup != ARM64_DECODE_SUBGROUP_UNKNOWN) ? LIBARCH_DECODE_STATUS_SUCCESS : LIBARCH_DECODE_STATUS_SOFT_FAIL;
+}
+
+LIBARCH_API
+decode_status_t
+disass_data_processing_floating_instruction (instruction_t *instr)
+{
+    /**
+     *  The Data Processing - Scalar Floating-Point and Advanced SIMD group is
+     *  split by op0[28:31], op1[23:24], op2[19:22] and op3[10:18]. The crypto
+     *  classes are carved out of the Advanced SIMD space, so check them first.
+     */
+    unsigned op0 = select_bits (instr->opcode, 28, 31);
+    unsigned op1 = select_bits (instr->opcode, 23, 24);
+    unsigned op2 = select_bits (instr->opcode, 19, 22);
+    unsigned op3 = select_bits (instr->opcode, 10, 18);
+
+    if (op0 == 4 && op1 == 0 && (op2 & 7) == 5 && (op3 & 0x183) == 0x002) {
+        if (decode_crypto_aes (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_CRYPTO_AES;
+    } else if (op0 == 5 && op1 == 0 && !(op2 & 4) && (op3 & 0x23) == 0) {
+        if (decode_crypto_sha_three_register (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_CRYPTO_SHA_THREE_REGISTER;
+    } else if (op0 == 5 && op1 == 0 && (op2 & 7) == 5 && (op3 & 0x183) == 0x002) {
+        if (decode_crypto_sha_two_register (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_CRYPTO_SHA_TWO_REGISTER;
+    } else if ((op0 & 5) == 1) {
+        /* Scalar Floating-Point, op0 x0x1 */
+        if (libarch_decode_has_feature (instr, LIBARCH_FEATURE_FP))
+            disass_fp_instruction (instr);
+    } else if ((op0 & 0xd) == 5) {
+        /* Advanced SIMD scalar, op0 01x1 */
+        if (libarch_decode_has_feature (instr, LIBARCH_FEATURE_SIMD))
+            disass_simd_instruction (instr, 1);
+    } else if ((op0 & 9) == 0) {
+        /* Advanced SIMD vector, op0 0xx0 */
+        if (libarch_decode_has_feature (instr, LIBARCH_FEATURE_SIMD))
+            disass_simd_instruction (instr, 0);
+    }
+
+    return (instr->subgroup != ARM64_DECODE_SUBGROUP_UNKNOWN) ? LIBARCH_DECODE_STATUS_SUCCESS : LIBARCH_DECODE_STATUS_SOFT_FAIL;
+}
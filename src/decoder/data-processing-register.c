@@ -34,6 +34,12 @@ decode_data_processing_2_source (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rd);
 
+    /* SUBP, SUBPS, IRG and GMI are MTE, PACGA is pointer authentication */
+    if (sf && (op == 0 || op == 4 || op == 5) && !libarch_decode_has_feature (*instr, LIBARCH_FEATURE_MTE))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    if (sf && op == 12 && !libarch_decode_has_feature (*instr, LIBARCH_FEATURE_PAUTH))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
     typedef struct { unsigned sf, S, opcode; arm64_instr_t type; } opcode;
 
     opcode opcode_table[] = {
@@ -43,6 +49,12 @@ decode_data_processing_2_source (instruction_t **instr)
         { 0, 0, 9, ARM64_INSTRUCTION_LSRV },
         { 0, 0, 10, ARM64_INSTRUCTION_ASRV },
         { 0, 0, 11, ARM64_INSTRUCTION_RORV },
+        { 0, 0, 16, ARM64_INSTRUCTION_CRC32B },
+        { 0, 0, 17, ARM64_INSTRUCTION_CRC32H },
+        { 0, 0, 18, ARM64_INSTRUCTION_CRC32W },
+        { 0, 0, 20, ARM64_INSTRUCTION_CRC32CB },
+        { 0, 0, 21, ARM64_INSTRUCTION_CRC32CH },
+        { 0, 0, 22, ARM64_INSTRUCTION_CRC32CW },
 
         { 1, 0, 0, ARM64_INSTRUCTION_SUBP },
         { 1, 0, 2, ARM64_INSTRUCTION_UDIV },
@@ -54,17 +66,22 @@ decode_data_processing_2_source (instruction_t **instr)
         { 1, 0, 10, ARM64_INSTRUCTION_ASRV },
         { 1, 0, 11, ARM64_INSTRUCTION_RORV },
         { 1, 0, 12, ARM64_INSTRUCTION_PACGA },
+        { 1, 0, 19, ARM64_INSTRUCTION_CRC32X },
+        { 1, 0, 23, ARM64_INSTRUCTION_CRC32CX },
         { 1, 1, 0, ARM64_INSTRUCTION_SUBPS },
     };
     int table_size = sizeof (opcode_table) / sizeof (opcode);
 
     for (int i = 0; i < table_size; i++) {
         if (opcode_table[i].sf == sf && opcode_table[i].S == S && opcode_table[i].opcode == op) {
+            /* CRC32 always accumulates into a W register, sf only widens the data in Rm */
+            unsigned width = (sf == 1 && (op & 0x30) != 0x10) ? 64 : 32;
             (*instr)->type = opcode_table[i].type;
 
-            libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-            libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rd, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rn, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
             libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            break;
         }
     }
 
@@ -93,6 +110,10 @@ decode_data_processing_1_source (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rd);
 
+    /* op2 of 1 is the pointer authentication instructions */
+    if (op2 == 1 && !libarch_decode_has_feature (*instr, LIBARCH_FEATURE_PAUTH))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
     typedef struct opcode { unsigned sf, S, op2, op; arm64_instr_t type; } opcode;
     opcode opcode_table[] = {
         { 0, 0, 0, 0, ARM64_INSTRUCTION_RBIT },
@@ -104,7 +125,7 @@ decode_data_processing_1_source (instruction_t **instr)
         { 1, 0, 0, 0, ARM64_INSTRUCTION_RBIT },
         { 1, 0, 0, 1, ARM64_INSTRUCTION_REV16 },
         { 1, 0, 0, 2, ARM64_INSTRUCTION_REV32 },
-        { 1, 0, 0, 3, ARM64_INSTRUCTION_REV32 },
+        { 1, 0, 0, 3, ARM64_INSTRUCTION_REV },
         { 1, 0, 0, 4, ARM64_INSTRUCTION_CLZ },
         { 1, 0, 0, 5, ARM64_INSTRUCTION_CLS },
 
@@ -128,17 +149,10 @@ decode_data_processing_1_source (instruction_t **instr)
         if (opcode_table[i].sf == sf && opcode_table[i].S == S && opcode_table[i].op2 == op2 && opcode_table[i].op == op) {
             (*instr)->type = opcode_table[i].type;
 
-            libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, opcode_table[i].type, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-
-            if (opcode_table[i].type == ARM64_INSTRUCTION_PACIA) {
-                if (Z == 1 && Rn == 0x1f) {
-                    (*instr)->type = ARM64_INSTRUCTION_PACIZA;
-                } else{
-                    libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, opcode_table[i].type, ARM64_REGISTER_OPERAND_OPT_NONE);
-                }
-            } else {
-                libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, opcode_table[i].type, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-            }
+            /* The pointer authentication modifier is Xn|SP, everything else uses the zero register */
+            libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL,
+                (op2 == 1) ? ARM64_REGISTER_OPERAND_OPT_NONE : ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
             break;
         }
     }
@@ -169,7 +183,10 @@ decode_logical_shift_register (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rd);
 
-    typedef struct { unsigned sf, opc, N; int width; arm64_instr_t type } opcode;
+    /* 32-bit shifts of 32 or more are reserved */
+    if (sf == 0 && (imm6 >> 5)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    typedef struct { unsigned sf, opc, N; int width; arm64_instr_t type; } opcode;
     opcode opcode_table[] = {
         { 0, 0, 0, 32, ARM64_INSTRUCTION_AND },
         { 0, 0, 1, 32, ARM64_INSTRUCTION_BIC },
@@ -195,38 +212,12 @@ decode_logical_shift_register (instruction_t **instr)
         if (opcode_table[i].sf == sf && opcode_table[i].opc == opc && opcode_table[i].N == N) {
             int shift_table[] = { ARM64_SHIFT_TYPE_LSL, ARM64_SHIFT_TYPE_LSR, ARM64_SHIFT_TYPE_ASR, ARM64_SHIFT_TYPE_ROR };
 
-            /* Check for the MOV alias */
-            if ((shift == 0 && imm6 == 0 && Rn == 0x1f) && opcode_table[i].type == ARM64_INSTRUCTION_ORR) {
-                (*instr)->type = ARM64_INSTRUCTION_MOV;
-
-                libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-
-            /* Check for the MVN alias */
-            } else if (Rn == 0x1f && opcode_table[i].type == ARM64_INSTRUCTION_ORN) {
-                (*instr)->type = ARM64_INSTRUCTION_MVN;
-
-                libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
-
-            /* Check for the TST alias */
-            } else if (Rd == 0x1f && opcode_table[i].type == ARM64_INSTRUCTION_ANDS) {
-                (*instr)->type = ARM64_INSTRUCTION_TST;
-
-                libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
-
-            /* The rest of the opcode_table instructions */
-            } else {
-                (*instr)->type = opcode_table[i].type;
+            (*instr)->type = opcode_table[i].type;
 
-                libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
-            }
+            libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            if (imm6 || shift) libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
             break;
         }
     }
@@ -258,6 +249,9 @@ decode_add_subtract_shifted_register (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rd);
 
+    /* ROR, and 32-bit shifts of 32 or more, are reserved */
+    if (shift == 3 || (sf == 0 && (imm6 >> 5))) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
     typedef struct { unsigned sf, op, S; int width; arm64_instr_t type; } opcode;
     opcode opcode_table[] = {
         { 0, 0, 0, 32, ARM64_INSTRUCTION_ADD },
@@ -275,55 +269,333 @@ decode_add_subtract_shifted_register (instruction_t **instr)
         if (opcode_table[i].sf == sf && opcode_table[i].op == op && opcode_table[i].S == S) {
             int shift_table[] = { ARM64_SHIFT_TYPE_LSL, ARM64_SHIFT_TYPE_LSR, ARM64_SHIFT_TYPE_ASR, ARM64_SHIFT_TYPE_ROR };
 
-            /* Check for the CMN alias */
-            if (opcode_table[i].type == ARM64_INSTRUCTION_ADDS && Rd == 0x1f) {
-                (*instr)->type = ARM64_INSTRUCTION_CMN;
+            (*instr)->type = opcode_table[i].type;
 
-                libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
+            libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            if (imm6 || shift) libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
 
-            /* Check for the NEG alias */
-            } else if (opcode_table[i].type == ARM64_INSTRUCTION_SUB && Rn == 0x1f) {
-                (*instr)->type = ARM64_INSTRUCTION_NEG;
+            break;
+        }
+    }
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
 
-                libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
-        
-            /* Check for the CMP alias */
-            } else if (opcode_table[i].type == ARM64_INSTRUCTION_SUBS && Rd == 0x1f) {
-                (*instr)->type = ARM64_INSTRUCTION_CMP;
 
-                libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_add_subtract_extended_register (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned op = select_bits ((*instr)->opcode, 30, 30);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned opt = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned option = select_bits ((*instr)->opcode, 13, 15);
+    unsigned imm3 = select_bits ((*instr)->opcode, 10, 12);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
 
-            /* Check for the NEGS alias */
-            } else if (opcode_table[i].type == ARM64_INSTRUCTION_SUBS && Rn == 0x1f && Rd != 0x1f) {
-                (*instr)->type = ARM64_INSTRUCTION_NEGS;
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, opt);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, option);
+    libarch_instruction_add_field (instr, imm3);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
 
-                libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
+    /* Shifts of more than 4 are reserved */
+    if (opt != 0 || imm3 > 4) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-            /* Regular instructions */
-            } else {
-                (*instr)->type = opcode_table[i].type;
+    arm64_instr_t opcode_table[] = {
+        ARM64_INSTRUCTION_ADD, ARM64_INSTRUCTION_ADDS,
+        ARM64_INSTRUCTION_SUB, ARM64_INSTRUCTION_SUBS,
+    };
+    int width = (sf == 1) ? 64 : 32;
 
-                libarch_instruction_add_operand_register (instr, Rd, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                libarch_instruction_add_operand_shift (instr, *(unsigned int *) &imm6, shift_table[shift]);
-            }
+    /* Rm is only an X register for the 64-bit UXTX/SXTX extends */
+    int rm_width = (sf == 1 && (option & 3) == 3) ? 64 : 32;
 
-            break;
-        }
+    /* The flag setting forms write to the zero register rather than SP */
+    int rd_opt = (S == 1) ? ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO : ARM64_REGISTER_OPERAND_OPT_NONE;
+
+    (*instr)->type = opcode_table[(op << 1) | S];
+
+    libarch_instruction_add_operand_register (instr, Rd, width, ARM64_REGISTER_TYPE_GENERAL, rd_opt);
+    libarch_instruction_add_operand_register (instr, Rn, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+    libarch_instruction_add_operand_register (instr, Rm, rm_width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+
+    /**
+     *  When SP is involved, a UXTW/UXTX extend that matches the register
+     *  width is written as LSL, and left out entirely if the shift is zero.
+     */
+    if ((Rn == 0x1f || (S == 0 && Rd == 0x1f)) && option == ((sf == 1) ? ARM64_INDEX_EXTEND_UXTX : ARM64_INDEX_EXTEND_UXTW)) {
+        if (imm3) libarch_instruction_add_operand_shift (instr, imm3, ARM64_SHIFT_TYPE_LSL);
+    } else {
+        libarch_instruction_add_operand_extend (instr, option, (imm3) ? (int) imm3 : -1);
     }
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_add_subtract_with_carry (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned op = select_bits ((*instr)->opcode, 30, 30);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    arm64_instr_t opcode_table[] = {
+        ARM64_INSTRUCTION_ADC, ARM64_INSTRUCTION_ADCS,
+        ARM64_INSTRUCTION_SBC, ARM64_INSTRUCTION_SBCS,
+    };
+    int width = (sf == 1) ? 64 : 32;
+
+    (*instr)->type = opcode_table[(op << 1) | S];
+    libarch_instruction_add_operand_register (instr, Rd, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rn, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rm, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_rotate_right_into_flags (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned op = select_bits ((*instr)->opcode, 30, 30);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned imm6 = select_bits ((*instr)->opcode, 15, 20);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned o2 = select_bits ((*instr)->opcode, 4, 4);
+    unsigned mask = select_bits ((*instr)->opcode, 0, 3);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, imm6);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, o2);
+    libarch_instruction_add_field (instr, mask);
+
+    /* RMIF */
+    if (sf != 1 || op != 0 || S != 1 || o2 != 0) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = ARM64_INSTRUCTION_RMIF;
+    libarch_instruction_add_operand_register (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_immediate (instr, imm6, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+    libarch_instruction_add_operand_immediate (instr, mask, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_evaluate_into_flags (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned op = select_bits ((*instr)->opcode, 30, 30);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned opcode2 = select_bits ((*instr)->opcode, 15, 20);
+    unsigned sz = select_bits ((*instr)->opcode, 14, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned o3 = select_bits ((*instr)->opcode, 4, 4);
+    unsigned mask = select_bits ((*instr)->opcode, 0, 3);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, opcode2);
+    libarch_instruction_add_field (instr, sz);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, o3);
+    libarch_instruction_add_field (instr, mask);
+
+    /* SETF8 / SETF16 */
+    if (sf != 0 || op != 0 || S != 1 || opcode2 != 0 || o3 != 0 || mask != 0xd)
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = (sz == 0) ? ARM64_INSTRUCTION_SETF8 : ARM64_INSTRUCTION_SETF16;
+    libarch_instruction_add_operand_register (instr, Rn, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_conditional_compare (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned op = select_bits ((*instr)->opcode, 30, 30);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned cond = select_bits ((*instr)->opcode, 12, 15);
+    unsigned imm = select_bits ((*instr)->opcode, 11, 11);
+    unsigned o2 = select_bits ((*instr)->opcode, 10, 10);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned o3 = select_bits ((*instr)->opcode, 4, 4);
+    unsigned nzcv = select_bits ((*instr)->opcode, 0, 3);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, cond);
+    libarch_instruction_add_field (instr, imm);
+    libarch_instruction_add_field (instr, o2);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, o3);
+    libarch_instruction_add_field (instr, nzcv);
+
+    if (S != 1 || o2 != 0 || o3 != 0) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* CCMN / CCMP */
+    (*instr)->type = (op == 0) ? ARM64_INSTRUCTION_CCMN : ARM64_INSTRUCTION_CCMP;
+
+    libarch_instruction_add_operand_register (instr, Rn, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+
+    /* The Rm field holds a 5-bit unsigned immediate in the immediate form */
+    if (imm == 1) libarch_instruction_add_operand_immediate (instr, Rm, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+    else libarch_instruction_add_operand_register (instr, Rm, (sf == 1) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+
+    libarch_instruction_add_operand_immediate (instr, nzcv, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+    libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_CONDITION, cond);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_conditional_select (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned op = select_bits ((*instr)->opcode, 30, 30);
+    unsigned S = select_bits ((*instr)->opcode, 29, 29);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned cond = select_bits ((*instr)->opcode, 12, 15);
+    unsigned op2 = select_bits ((*instr)->opcode, 10, 11);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, op);
+    libarch_instruction_add_field (instr, S);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, cond);
+    libarch_instruction_add_field (instr, op2);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    if (S != 0 || op2 > 1) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    arm64_instr_t opcode_table[] = {
+        ARM64_INSTRUCTION_CSEL, ARM64_INSTRUCTION_CSINC,
+        ARM64_INSTRUCTION_CSINV, ARM64_INSTRUCTION_CSNEG,
+    };
+    int width = (sf == 1) ? 64 : 32;
+
+    (*instr)->type = opcode_table[(op << 1) | op2];
+    libarch_instruction_add_operand_register (instr, Rd, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rn, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rm, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_CONDITION, cond);
+
     return LIBARCH_DECODE_STATUS_SUCCESS;
 }
 
 
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_data_processing_3_source (instruction_t **instr)
+{
+    unsigned sf = select_bits ((*instr)->opcode, 31, 31);
+    unsigned op54 = select_bits ((*instr)->opcode, 29, 30);
+    unsigned op31 = select_bits ((*instr)->opcode, 21, 23);
+    unsigned Rm = select_bits ((*instr)->opcode, 16, 20);
+    unsigned o0 = select_bits ((*instr)->opcode, 15, 15);
+    unsigned Ra = select_bits ((*instr)->opcode, 10, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sf);
+    libarch_instruction_add_field (instr, op54);
+    libarch_instruction_add_field (instr, op31);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, o0);
+    libarch_instruction_add_field (instr, Ra);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    /**
+     *  `src_width` is the width of Rn and Rm, which are 32-bit for the long
+     *  multiplies. The high multiplies have no accumulator.
+     */
+    typedef struct { unsigned sf, op31, o0; int src_width; arm64_instr_t type; } opcode;
+    opcode opcode_table[] = {
+        { 0, 0, 0, 32, ARM64_INSTRUCTION_MADD },
+        { 0, 0, 1, 32, ARM64_INSTRUCTION_MSUB },
+
+        { 1, 0, 0, 64, ARM64_INSTRUCTION_MADD },
+        { 1, 0, 1, 64, ARM64_INSTRUCTION_MSUB },
+        { 1, 1, 0, 32, ARM64_INSTRUCTION_SMADDL },
+        { 1, 1, 1, 32, ARM64_INSTRUCTION_SMSUBL },
+        { 1, 2, 0, 64, ARM64_INSTRUCTION_SMULH },
+        { 1, 5, 0, 32, ARM64_INSTRUCTION_UMADDL },
+        { 1, 5, 1, 32, ARM64_INSTRUCTION_UMSUBL },
+        { 1, 6, 0, 64, ARM64_INSTRUCTION_UMULH },
+    };
+    int table_size = sizeof (opcode_table) / sizeof (opcode);
+
+    if (op54 != 0) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    for (int i = 0; i < table_size; i++) {
+        if (opcode_table[i].sf == sf && opcode_table[i].op31 == op31 && opcode_table[i].o0 == o0) {
+            int width = (sf == 1) ? 64 : 32;
+            int src_width = opcode_table[i].src_width;
+
+            libarch_instruction_add_operand_register (instr, Rd, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rn, src_width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            libarch_instruction_add_operand_register (instr, Rm, src_width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+
+            /* SMULH / UMULH have no Ra */
+            (*instr)->type = opcode_table[i].type;
+            if (op31 != 2 && op31 != 6)
+                libarch_instruction_add_operand_register (instr, Ra, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+            return LIBARCH_DECODE_STATUS_SUCCESS;
+        }
+    }
+
+    return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 
 LIBARCH_API
@@ -336,16 +608,48 @@ disass_data_processing_register_instruction (instruction_t *instr)
     unsigned op3 = select_bits (instr->opcode, 10, 15);
 
     if (op0 == 0 && op1 == 1 && op2 == 6) {
-        decode_data_processing_2_source (&instr);
+        if (decode_data_processing_2_source (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_DATA_PROCESSING_2_SOURCE;
 
     } else if (op0 == 1 && op1 == 1 && op2 == 6) {
-        decode_data_processing_1_source (&instr);
+        if (decode_data_processing_1_source (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_DATA_PROCESSING_1_SOURCE;
 
     } else if (op1 == 0 && (op2 >> 3) == 0) {
-        decode_logical_shift_register (&instr);
+        if (decode_logical_shift_register (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_LOGICAL_SHIFTED_REGISTER;
+
+    } else if (op1 == 0 && (op2 & 9) == 8) {
+        if (decode_add_subtract_shifted_register (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_SHIFTED_REGISTER;
+
+    } else if (op1 == 0 && (op2 & 9) == 9) {
+        if (decode_add_subtract_extended_register (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_EXTENDED_REGISTER;
+
+    } else if (op1 == 1 && op2 == 0 && op3 == 0) {
+        if (decode_add_subtract_with_carry (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_WITH_CARRY;
+
+    } else if (op1 == 1 && op2 == 0 && (op3 & 0x1f) == 1) {
+        if (decode_rotate_right_into_flags (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_ROTATE_RIGHT_INTO_FLAGS;
+
+    } else if (op1 == 1 && op2 == 0 && (op3 & 0xf) == 2) {
+        if (decode_evaluate_into_flags (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_EVALUATE_INTO_FLAGS;
+
+    } else if (op1 == 1 && op2 == 2) {
+        if (decode_conditional_compare (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_CONDITIONAL_COMPARE;
+
+    } else if (op1 == 1 && op2 == 4) {
+        if (decode_conditional_select (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_CONDITIONAL_SELECT;
 
-    } else if (op1 == 0 && ((op2 & ~6) == 8 || (op2 & ~6) == 9)) {
-        decode_add_subtract_shifted_register (&instr);
+    } else if (op1 == 1 && (op2 >> 3) == 1) {
+        if (decode_data_processing_3_source (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_DATA_PROCESSING_3_SOURCE;
     }
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
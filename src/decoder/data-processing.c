@@ -40,7 +40,7 @@ decode_pc_relative_addressing (instruction_t **instr)
         (*instr)->type = ARM64_INSTRUCTION_ADR;
 
         imm = ((immhi << 2) | immlo);
-        imm = arm64_sign_extend (imm, 21);
+        imm = (int) arm64_sign_extend (imm, 21);
         imm += (*instr)->addr;
 
         imm_type |= ARM64_IMMEDIATE_FLAG_OUTPUT_DECIMAL;
@@ -48,9 +48,10 @@ decode_pc_relative_addressing (instruction_t **instr)
     } else {
         (*instr)->type = ARM64_INSTRUCTION_ADRP;
 
-        imm = ((immhi << 2) | immlo) << 12;
-        imm = arm64_sign_extend (imm, 32);
-        imm += (*instr)->addr;
+        /* The page offset is 33 bits, so sign-extend it before shifting */
+        imm = (int) arm64_sign_extend ((immhi << 2) | immlo, 21);
+        imm <<= 12;
+        imm += (*instr)->addr & ~0xfffULL;
     }
 
     /* Add operands */
@@ -85,98 +86,27 @@ decode_add_subtract_immediate (instruction_t **instr)
     /* Determine instruction size, and register width */
     uint32_t len;
     unsigned size;
-    const char **regs;
+    const char *const *regs;
 
     if (sf == 1) _SET_64 (size, regs, len);
     else _SET_32 (size, regs, len);
 
-    /* Determine the instruction type and add the register operands */
-    if (op == 0 && S == 0) {
-
-        /* Common operands */
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-
-        /* MOV */
-        if (sh == 0 && imm12 == 0 && (Rd == 0b11111 || Rn == 0b11111)) {
-            (*instr)->type = ARM64_INSTRUCTION_MOV;
-
-        /* ADD (immediate) */
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_ADD;
-            libarch_instruction_add_operand_immediate (instr, imm12, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-            /* Add the left-shift if present */
-            if (sh) libarch_instruction_add_operand_shift (instr, 12, ARM64_SHIFT_TYPE_LSL);
-        }
-
-    } else if (op == 0 && S == 1) {
-
-        /**
-         * While there are common operands with CMD and ADDS (immediate), 
-         * they're not in the same order. 
-         */
-        /* CMN */
-        if (Rd == 0b11111) {
-            (*instr)->type = ARM64_INSTRUCTION_CMN;
-
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, imm12, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-            /* Add the left-shift if present */
-            if (sh) libarch_instruction_add_operand_shift (instr, 12, ARM64_SHIFT_TYPE_LSL);
-
-        /* ADDS (immediate) */
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_ADDS;
-
-            libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, imm12, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-            /* Add the left-shift if present */
-            if (sh) libarch_instruction_add_operand_shift (instr, 12, ARM64_SHIFT_TYPE_LSL);
-        }
-
-    } else if (op == 1 && S == 0) {
-
-        /* SUB */
-        (*instr)->type = ARM64_INSTRUCTION_SUB;
+    arm64_instr_t opcode_table[] = {
+        ARM64_INSTRUCTION_ADD, ARM64_INSTRUCTION_ADDS,
+        ARM64_INSTRUCTION_SUB, ARM64_INSTRUCTION_SUBS,
+    };
 
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        libarch_instruction_add_operand_immediate (instr, imm12, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    /* The flag setting forms write to the zero register rather than SP */
+    uint32_t rd_opt = (S == 1) ? ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO : ARM64_REGISTER_OPERAND_OPT_NONE;
 
-        /* Add the left-shift if present */
-        if (sh) libarch_instruction_add_operand_shift (instr, 12, ARM64_SHIFT_TYPE_LSL);
+    (*instr)->type = opcode_table[(op << 1) | S];
 
-    } else if (op == 1 && S == 1) {
+    libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, rd_opt);
+    libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+    libarch_instruction_add_operand_immediate (instr, imm12, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
 
-        /* CMP */
-        if (Rd == 0b11111) {
-            (*instr)->type = ARM64_INSTRUCTION_CMP;
-
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, imm12, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-            /* Add the left-shift if present */
-            if (sh) libarch_instruction_add_operand_shift (instr, 12, ARM64_SHIFT_TYPE_LSL);
-
-        /* SUBS (immediate) */
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_SUBS;
-
-            libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, imm12, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-            /* Add the left-shift if present */
-            if (sh) libarch_instruction_add_operand_shift (instr, 12, ARM64_SHIFT_TYPE_LSL);
-        }
-
-    } else {
-        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
-    }
+    /* Add the left-shift if present */
+    if (sh) libarch_instruction_add_operand_shift (instr, 12, ARM64_SHIFT_TYPE_LSL);
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
 }
@@ -256,57 +186,36 @@ decode_logical_immediate (instruction_t **instr)
     /* Determine instruction size, and register width */
     uint32_t len;
     unsigned size;
-    const char **regs;
+    const char *const *regs;
 
     if (sf == 0 && N == 0) _SET_32 (size, regs, len);
     else _SET_64 (size, regs, len);
 
-    /* Work out the immediate type and value */
+    /* Work out the immediate type and value, reserved encodings are unallocated */
     int imm_type = (size == 64) ? ARM64_IMMEDIATE_TYPE_LONG : ARM64_IMMEDIATE_TYPE_INT; 
-    unsigned long imm = 0;
-    arm64_decode_bitmasks (N, imms, immr, 1, &imm);
-
-    /* Everything apart from `tst` has an Rd register as the first operand */
-    if (!(opc == 3 && Rd == 0b11111))
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-
-    /* Determine the instruction type and add the register operands */
-    if (opc == 0) {
-        (*instr)->type = ARM64_INSTRUCTION_AND;
-        libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-
-    } else if (opc == 1) {
-
-        if (Rn == 0b11111 && !arm64_move_wide_preferred (sf, N, imms, immr)) {
-            (*instr)->type = ARM64_INSTRUCTION_MOV;
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_ORR;
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        }
+    uint64_t imm = 0;
+    if (arm64_decode_bitmasks (N, imms, immr, 1, &imm) != 0)
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-    } else if (opc == 2) {
-        (*instr)->type = ARM64_INSTRUCTION_EOR;
-        libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+    /* The 32-bit forms only use the low half of the replicated value */
+    if (size == 32) imm &= 0xffffffff;
 
-    } else if (opc == 3) {
+    /**
+     *  Rd is the stack pointer for AND, ORR and EOR, but the zero register
+     *  for ANDS. Rn is always the zero register.
+     */
+    uint32_t rd_opt = (opc == 3) ? ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO : ARM64_REGISTER_OPERAND_OPT_NONE;
 
-        if (Rd == 0b11111) {
-            (*instr)->type = ARM64_INSTRUCTION_TST;
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_ANDS;
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        }
+    arm64_instr_t opcode_table[] = {
+        ARM64_INSTRUCTION_AND, ARM64_INSTRUCTION_ORR,
+        ARM64_INSTRUCTION_EOR, ARM64_INSTRUCTION_ANDS,
+    };
 
-    } else {
-        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
-    }
+    (*instr)->type = opcode_table[opc];
 
-    /* Add the immediate operand */
-    libarch_instruction_add_operand_immediate (instr, 
-        (imm_type == ARM64_IMMEDIATE_TYPE_LONG) ? *(long *)&imm : *(int *)&imm,
-         imm_type, 
-         ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, rd_opt);
+    libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_immediate (instr, imm, imm_type, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
 }
@@ -335,77 +244,26 @@ decode_move_wide_immediate (instruction_t **instr)
     /* Determine instruction size */
     uint32_t len;
     unsigned size;
-    const char **regs;
+    const char *const *regs;
 
     if (sf == 0 && (hw >> 1) == 0) _SET_32 (size, regs, len);
     else _SET_64 (size, regs, len);
 
-    if (opc == 0) {
-
-        /* Add common operands */
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-
-        /* MOV (inverted wide immediate) */
-        if (!(arm64_is_zero (imm16) && hw != 0)) {
-            (*instr)->type = ARM64_INSTRUCTION_MOV;
-
-            /* Calculate immediate value */
-            int imm_type = (size == 64) ? ARM64_IMMEDIATE_TYPE_LONG : ARM64_IMMEDIATE_TYPE_INT;
-            long imm = ~((long) imm16 << shift);
-
-            libarch_instruction_add_operand_immediate (instr, 
-                (imm_type == ARM64_IMMEDIATE_TYPE_LONG) ? *(long *) &imm : *(int *) &imm,
-                imm_type, 
-                ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-        /* MOVN */
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_MOVN;
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imm16, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-            /* Add the left-shift if present */
-            if (shift) libarch_instruction_add_operand_shift (instr, shift, ARM64_SHIFT_TYPE_LSL);
-        }
-    } else if (opc == 2) {
-
-        /* Add common operands */
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-
-        /* MOV (wide immediate) */
-        if (!arm64_is_zero (imm16) && hw != 0b00) {
-            (*instr)->type = ARM64_INSTRUCTION_MOV;
+    arm64_instr_t opcode_table[] = {
+        ARM64_INSTRUCTION_MOVN, ARM64_INSTRUCTION_UNK,
+        ARM64_INSTRUCTION_MOVZ, ARM64_INSTRUCTION_MOVK,
+    };
 
-            /* Calculate immediate value */
-            int imm_type = (size == 64) ? ARM64_IMMEDIATE_TYPE_LONG : ARM64_IMMEDIATE_TYPE_INT;
-            long imm = ~((long) imm16 << shift);
+    (*instr)->type = opcode_table[opc];
+    if ((*instr)->type == ARM64_INSTRUCTION_UNK) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-            libarch_instruction_add_operand_immediate (instr, 
-                (imm_type == ARM64_IMMEDIATE_TYPE_LONG) ? *(long *) &imm : *(int *) &imm,
-                imm_type, 
-                ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-        /* MOVZ */
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_MOVZ;
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imm16, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-            /* Add the left-shift if present */
-            if (shift) libarch_instruction_add_operand_shift (instr, shift, ARM64_SHIFT_TYPE_LSL);
-        }
-    } else if (opc == 3) {
-
-        /* MOVK */
-        (*instr)->type = ARM64_INSTRUCTION_MOVK;
+    libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_immediate (instr, imm16, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
 
-        /* Add operands */
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imm16, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    /* Add the left-shift if present */
+    if (shift) libarch_instruction_add_operand_shift (instr, shift, ARM64_SHIFT_TYPE_LSL);
 
-        /* Add the left-shift if present */
-        if (shift) libarch_instruction_add_operand_shift (instr, shift, ARM64_SHIFT_TYPE_LSL);
-    } 
-    
-    return ((*instr)->type) ? LIBARCH_DECODE_STATUS_SUCCESS : LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    return LIBARCH_DECODE_STATUS_SUCCESS;
 }
 
 
@@ -433,150 +291,24 @@ decode_bitfield (instruction_t **instr)
     /* Determine instruction size, and register width */
     uint32_t len;
     unsigned size;
-    const char **regs;
+    const char *const *regs;
 
     if (sf == 1) _SET_64 (size, regs, len);
     else _SET_32 (size, regs, len);
 
-    if (opc == 0) {
+    arm64_instr_t opcode_table[] = {
+        ARM64_INSTRUCTION_SBFM, ARM64_INSTRUCTION_BFM,
+        ARM64_INSTRUCTION_UBFM, ARM64_INSTRUCTION_UNK,
+    };
 
-        /* Add common operands */
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+    (*instr)->type = opcode_table[opc];
+    if ((*instr)->type == ARM64_INSTRUCTION_UNK) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-        /* ADR */
-        if ((sf == 0 && imms == 0b011111) || (sf == 1 && imms == 0b111111)) {
-            (*instr)->type = ARM64_INSTRUCTION_ADR;
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &immr, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-        /* SXTB / SXTH / SXTW */
-        } else if (immr == 0 && (imms == 0b000111 || imms == 0b001111 || imms == 0b011111)) {
-
-            /* Work out which one it is */
-            if (imms == 0b000111) (*instr)->type = ARM64_INSTRUCTION_SXTB;
-            else if (imms == 0b001111) (*instr)->type = ARM64_INSTRUCTION_SXTH;
-            else if (imms == 0b011111) (*instr)->type = ARM64_INSTRUCTION_SXTW;
-        
-        /* SBFX / SBFIZ */
-        } else if (imms < immr || arm64_bfx_preferred (sf, (opc >> 1), imms, immr)) {
-
-            unsigned lsb, width;
-
-            /* Choose the correct SBF_ instruction */
-            if (arm64_bfx_preferred (sf, (opc >> 1), imms, immr)) {
-                (*instr)->type = ARM64_INSTRUCTION_SBFX;
-                lsb = immr;
-                width = imms + 1 - lsb;
-            
-            } else {
-                (*instr)->type = ARM64_INSTRUCTION_SBFIZ;
-                lsb = (size - immr) & (size - 1);
-                width = imms + 1;
-            }
-
-            /* Add operands */
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &lsb, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &width, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-        /* SBFM */
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_SBFM;
-
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &immr, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imms, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-        }
-
-    } else if (opc == 1) {
-
-        /* Add common operand */
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-
-        /* BFC */
-        if (Rn == 0b11111 && (imms < immr)) {
-            (*instr)->type = ARM64_INSTRUCTION_BFC;
-
-            /* Calculate lsb and width */
-            unsigned lsb = (size - immr) & (size - 1);
-            unsigned width = imms + 1;
-
-            /* Add operands */
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &lsb, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &width, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-        /* BFI / BFXIL */
-        } else if ((Rn != 0b11111 && (imms < immr)) || (imms >= immr)) {
-
-            /* Work out which one it is */
-            if ((Rn != 0b11111 && (imms < immr))) (*instr)->type = ARM64_INSTRUCTION_BFI;
-            else if (imms >= immr) (*instr)->type = ARM64_INSTRUCTION_BFXIL;
-            else return LIBARCH_DECODE_STATUS_FAIL;
-
-            /* Calculate lsb and width */
-            unsigned lsb = immr;
-            unsigned width = imms + 1 - lsb;
-
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &lsb, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &width, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-        /* BFM */
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_BFM;
-
-            libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &immr, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imms, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-        }
-
-    } else if (opc == 2) {
-
-        /* Add common operands */
-        libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-        libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-
-        /* LSL / LSR (immediate) */
-        if (((imms != 0b11111) && imms + 1 == immr) || imms == 0b11111) {
-
-            unsigned imm;
-
-            if (imms == 0b11111) {
-                (*instr)->type = ARM64_INSTRUCTION_LSR;
-                imm = immr;
-            } else {
-                (*instr)->type = ARM64_INSTRUCTION_LSL;
-                imm = (size - 1) - imms;
-            }
-            libarch_instruction_add_operand_immediate (instr, imm, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-        /* UBFX / UBFIZ */
-        } else if (imms < immr || arm64_bfx_preferred (sf, (opc >> 1), imms, immr)) {
-            if (arm64_bfx_preferred (sf, (opc >> 1), imms, immr)) (*instr)->type = ARM64_INSTRUCTION_UBFX;
-            else (*instr)->type = ARM64_INSTRUCTION_UBFIZ;
-
-            /* Calculate lsb and width */
-            unsigned lsb = (size - immr) & (size - 1);
-            unsigned width = imms + 1;
-
-            /* Add operands */
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &lsb, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &width, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-           
-        /* UXTB / UXTH */
-        } else if (immr == 0 && (imms == 0b000111 || imms == 0b001111)) {
-            if (imms == 0b000111) (*instr)->type = ARM64_INSTRUCTION_UXTB;
-            else (*instr)->type = ARM64_INSTRUCTION_UXTH;
-
-        /* UBFM */
-        } else {
-            (*instr)->type = ARM64_INSTRUCTION_UBFM;
-
-            /* Add Operands */
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int*) &immr, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            libarch_instruction_add_operand_immediate (instr, *(unsigned int*) &imms, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-        }
-    } else {
-        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
-    }
+    /* Almost every bitfield instruction has an alias, see alias.c */
+    libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_immediate (instr, immr, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    libarch_instruction_add_operand_immediate (instr, imms, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
 }
@@ -609,26 +341,17 @@ decode_extract (instruction_t **instr)
     /* Determine instruction size, and register width */
     uint32_t len;
     unsigned size;
-    const char **regs;
+    const char *const *regs;
 
     if (sf == 1 && N == 1) _SET_64 (size, regs, len);
     else _SET_32 (size, regs, len);
 
-    /* Common operands */
+    /* EXTR. ROR (immediate) is picked as an alias */
+    (*instr)->type = ARM64_INSTRUCTION_EXTR;
     libarch_instruction_add_operand_register (instr, Rd, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
     libarch_instruction_add_operand_register (instr, Rn, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-
-    /* ROR (immediate ) */
-    if (Rn == Rm) {
-        (*instr)->type = ARM64_INSTRUCTION_ROR;
-        libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imms, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-
-    /* EXTR */
-    } else {
-        (*instr)->type == ARM64_INSTRUCTION_EXTR;
-        libarch_instruction_add_operand_register (instr, Rm, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-        libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imms, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-    }
+    libarch_instruction_add_operand_register (instr, Rm, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_immediate (instr, *(unsigned int *) &imms, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
 }
@@ -649,7 +372,7 @@ disass_data_processing_instruction (instruction_t *instr)
         if (decode_add_subtract_immediate (&instr))
             instr->subgroup = ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_IMMEDIATE;
     } else if (op0 == 3) {
-        if (decode_add_subtract_immediate_tags (&instr))
+        if (libarch_decode_has_feature (instr, LIBARCH_FEATURE_MTE) && decode_add_subtract_immediate_tags (&instr))
             instr->subgroup = ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_IMMEDIATE_TAGS;
     } else if (op0 == 4) {
         if (decode_logical_immediate (&instr))
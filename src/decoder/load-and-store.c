@@ -57,14 +57,45 @@ LIBARCH_PRIVATE LIBARCH_API
 decode_status_t
 decode_compare_and_swap_pair (instruction_t **instr)
 {
-    /**
-     *  NOTE:   These instructions belong to the FEAT_LSE instruction set
-     *          extension, and these aren't supported on Apple platforms.
-     * 
-     *          For now, these wont be implemented. See more on page 549
-     *          of the ARM reference manual.
-    */
-    return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    unsigned sz = select_bits ((*instr)->opcode, 30, 30);
+    unsigned L = select_bits ((*instr)->opcode, 22, 22);
+    unsigned Rs = select_bits ((*instr)->opcode, 16, 20);
+    unsigned o0 = select_bits ((*instr)->opcode, 15, 15);
+    unsigned Rt2 = select_bits ((*instr)->opcode, 10, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rt = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sz);
+    libarch_instruction_add_field (instr, L);
+    libarch_instruction_add_field (instr, Rs);
+    libarch_instruction_add_field (instr, o0);
+    libarch_instruction_add_field (instr, Rt2);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rt);
+
+    /* Both register pairs must start on an even register */
+    if (Rt2 != 31 || (Rs & 1) || (Rt & 1))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* Indexed by L:o0 - CASP, CASPL, CASPA, CASPAL */
+    int opcode_table[] = {
+        ARM64_INSTRUCTION_CASP,
+        ARM64_INSTRUCTION_CASPL,
+        ARM64_INSTRUCTION_CASPA,
+        ARM64_INSTRUCTION_CASPAL,
+    };
+    unsigned size = (sz) ? 64 : 32;
+
+    (*instr)->type = opcode_table[(L << 1) | o0];
+
+    libarch_instruction_add_operand_register (instr, Rs, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rs + 1, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rt, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rt + 1, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
 }
 
 
@@ -153,6 +184,7 @@ decode_advanced_simd_load_store_multiple_structures (instruction_t **instr)
     else (*instr)->type = (ARM64_INSTRUCTION_LD1 - 1) + ((elem * 2) - 1);
 
     /* Work out the arrangement specifier */
+    int spec = -1;
     int vec_table[][3] = {
         { 0, 0, ARM64_VEC_ARRANGEMENT_8B },
         { 0, 1, ARM64_VEC_ARRANGEMENT_16B },
@@ -160,23 +192,18 @@ decode_advanced_simd_load_store_multiple_structures (instruction_t **instr)
         { 1, 1, ARM64_VEC_ARRANGEMENT_8H },
         { 2, 0, ARM64_VEC_ARRANGEMENT_2S },
         { 2, 1, ARM64_VEC_ARRANGEMENT_4S },
+        { 3, 0, ARM64_VEC_ARRANGEMENT_1D },
         { 3, 1, ARM64_VEC_ARRANGEMENT_2D },
     };
     for (int i = 0; i < sizeof (vec_table) / sizeof (vec_table[0]); i++) {
         if (vec_table[i][0] == size && vec_table[i][1] == Q)
-            (*instr)->spec = vec_table[i][2];
+            spec = vec_table[i][2];
     }
 
-    /* Set the register operands */
-    if (reg_count == 1) {
-        libarch_instruction_add_operand_register_with_fix (instr, Rt, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, '{', '}');
-    } else {
-        for (int i = Rt; i < Rt + reg_count; i++) {
-            if (i == Rt) libarch_instruction_add_operand_register_with_fix (instr, i, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, '{', NULL);
-            else if (i == Rt + reg_count - 1) libarch_instruction_add_operand_register_with_fix (instr, i, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, NULL, '}');
-            else libarch_instruction_add_operand_register (instr, i, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_REGISTER_OPERAND_OPT_NONE);
-        }
-    }
+    /* Set the register operands, the list wraps around from v31 to v0 */
+    for (int i = 0; i < reg_count; i++)
+        libarch_instruction_add_operand_vector (instr, (Rt + i) & 31, spec, -1,
+            (i == 0) ? '{' : 0, (i == reg_count - 1) ? '}' : 0);
 
     libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');  
 
@@ -227,69 +254,70 @@ decode_advanced_simd_load_store_single_structure (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rt);
 
+    /* opcode<0>:R gives the number of registers in the list */
     unsigned elem = (((opcode & 1) << 1) | R) + 1;
-    int index = 0;
+    int index = -1, spec = -1, esize = 0;
 
-    /* Determine the Vector Arrangement */
-    int arm64_replicate = 0;
+    /* Work out the element size and the lane index from Q:S:size */
     switch ((opcode >> 1))
     {
-        case 3: arm64_replicate = 1; break;
         case 0:
             index = (Q << 3) | (S << 2) | size;
-            (*instr)->spec = ARM64_VEC_ARRANGEMENT_B;
+            spec = ARM64_VEC_ARRANGEMENT_B;
+            esize = 1;
             break;
 
         case 1:
+            if (size & 1) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
             index = (Q << 2) | (S << 1) | (size >> 1);
-            (*instr)->spec = ARM64_VEC_ARRANGEMENT_H;
+            spec = ARM64_VEC_ARRANGEMENT_H;
+            esize = 2;
             break;
-        
+
         case 2:
-            if ((size & 1) == 0) {
+            if (size == 0) {
                 index = (Q << 1) | S;
-                (*instr)->spec = ARM64_VEC_ARRANGEMENT_S;
-            } else {
+                spec = ARM64_VEC_ARRANGEMENT_S;
+                esize = 4;
+            } else if (size == 1 && S == 0) {
                 index = Q;
-                (*instr)->spec = ARM64_VEC_ARRANGEMENT_D;
-            }
-        default: LIBARCH_RETURN_VOID;
-    }
-
-    /* Select correct instruction type */
-    int reg_count = 0;
-    if (arm64_replicate) {
-        reg_count = ((elem * 2) - 1);
-        (*instr)->type = (ARM64_INSTRUCTION_LD1R - 1) + reg_count;
-    } else if (L == 0) {
-        reg_count = elem;
-        (*instr)->type = (ARM64_INSTRUCTION_ST1 - 1) + reg_count;
-    } else if (L == 1) {
-        reg_count = ((elem * 2) - 1);
-        (*instr)->type = (ARM64_INSTRUCTION_LD1 - 1) + reg_count;
-    }
+                spec = ARM64_VEC_ARRANGEMENT_D;
+                esize = 8;
+            } else return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            break;
 
-    /* Set the register operands */
-    if (reg_count == 1) {
-        libarch_instruction_add_operand_register_with_fix (instr, Rt, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, '{', '}');
-    } else {
-        for (int i = 0; i < reg_count; i++) {
-            if (i == 0) libarch_instruction_add_operand_register_with_fix (instr, i, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, '{', NULL);
-            else if (i == reg_count - 1) libarch_instruction_add_operand_register_with_fix (instr, i, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, NULL, '}');
-            else libarch_instruction_add_operand_register (instr, i, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_REGISTER_OPERAND_OPT_NONE);
+        /* Load and replicate, the arrangement comes from size:Q */
+        case 3: {
+            int rep_table[] = {
+                ARM64_VEC_ARRANGEMENT_8B, ARM64_VEC_ARRANGEMENT_16B,
+                ARM64_VEC_ARRANGEMENT_4H, ARM64_VEC_ARRANGEMENT_8H,
+                ARM64_VEC_ARRANGEMENT_2S, ARM64_VEC_ARRANGEMENT_4S,
+                ARM64_VEC_ARRANGEMENT_1D, ARM64_VEC_ARRANGEMENT_2D,
+            };
+            if (L == 0 || S == 1) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            spec = rep_table[(size << 1) | Q];
+            esize = 1 << size;
+            break;
         }
     }
 
-    /* Add the index */
-    libarch_instruction_add_operand_immediate_with_fix (instr, *(unsigned int *) &index, ARM64_IMMEDIATE_TYPE_UINT, '[', ']');
+    /* Select correct instruction type, LDn and LDnR are interleaved */
+    if ((opcode >> 1) == 3) (*instr)->type = ARM64_INSTRUCTION_LD1R + ((elem - 1) * 2);
+    else if (L == 0) (*instr)->type = ARM64_INSTRUCTION_ST1 + (elem - 1);
+    else (*instr)->type = ARM64_INSTRUCTION_LD1 + ((elem - 1) * 2);
+
+    /* Set the register operands, the list wraps around from v31 to v0 and the lane index follows it */
+    for (unsigned i = 0; i < elem; i++)
+        libarch_instruction_add_operand_vector (instr, (Rt + i) & 31, spec, (i == elem - 1) ? index : -1,
+            (i == 0) ? '{' : 0, (i == elem - 1) ? '}' : 0);
 
     /* Add base register */
-    libarch_instruction_add_operand_register (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+    libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
 
-    /* Is the instruction post-indexed? */
+    /* Is the instruction post-indexed? The immediate form moves past every element transferred */
     if (op2 == 3) {
         if (Rm != 0b11111) libarch_instruction_add_operand_register (instr, Rm, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
-        else libarch_instruction_add_operand_immediate (instr, (Q == 0) ? 32 : 64, ARM64_IMMEDIATE_TYPE_INT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+        else libarch_instruction_add_operand_immediate (instr, elem * esize, ARM64_IMMEDIATE_TYPE_INT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
     }
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
@@ -374,7 +402,7 @@ decode_load_store_exclusive_pair (instruction_t **instr)
     /* Determine instruction size, and register width */
     uint32_t len;
     unsigned size;
-    const char **regs;
+    const char *const *regs;
 
     if (sz == 1) _SET_64 (size, regs, len);
     else _SET_32 (size, regs, len);
@@ -392,9 +420,9 @@ decode_load_store_exclusive_pair (instruction_t **instr)
 
             /* The ST_ instructions have a 32-bit Rs register operand first */
             if (opcode_table[i][3])
-                libarch_instruction_add_operand_register (instr, Rs, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+                libarch_instruction_add_operand_register (instr, Rs, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
 
-            libarch_instruction_add_operand_register (instr, Rt, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+            libarch_instruction_add_operand_register (instr, Rt, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
             libarch_instruction_add_operand_register (instr, Rt2, size, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
         }
     }
@@ -445,10 +473,10 @@ decode_load_store_exclusive_register (instruction_t **instr)
         { 3, 0, 0, 1, 64, ARM64_INSTRUCTION_STXR },
         { 3, 0, 1, 1, 64, ARM64_INSTRUCTION_STLXR },
 
-        { 2, 1, 0, 1, 32, ARM64_INSTRUCTION_LDXR },
-        { 2, 1, 1, 1, 32, ARM64_INSTRUCTION_LDAXR },
-        { 3, 1, 0, 1, 64, ARM64_INSTRUCTION_LDXR },
-        { 3, 1, 1, 1, 64, ARM64_INSTRUCTION_LDAXR },
+        { 2, 1, 0, -1, 32, ARM64_INSTRUCTION_LDXR },
+        { 2, 1, 1, -1, 32, ARM64_INSTRUCTION_LDAXR },
+        { 3, 1, 0, -1, 64, ARM64_INSTRUCTION_LDXR },
+        { 3, 1, 1, -1, 64, ARM64_INSTRUCTION_LDAXR },
     };
 
     for (int i = 0; i < sizeof (opcode_table) / sizeof (opcode_table[0]); i++) {
@@ -456,10 +484,10 @@ decode_load_store_exclusive_register (instruction_t **instr)
             (*instr)->type = opcode_table[i][5];
 
             /* Does this instruction use the Rs register? */
-            if (opcode_table[i][3])
+            if (opcode_table[i][3] == 1)
                 libarch_instruction_add_operand_register (instr, Rs, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
 
-            libarch_instruction_add_operand_register (instr, Rt, opcode_table[i][4], ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+            libarch_instruction_add_operand_register (instr, Rt, opcode_table[i][4], ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
             libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
         }
     }
@@ -526,6 +554,111 @@ decode_load_store_ordered (instruction_t **instr)
 }
 
 
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_compare_and_swap (instruction_t **instr)
+{
+    unsigned size = select_bits ((*instr)->opcode, 30, 31);
+    unsigned L = select_bits ((*instr)->opcode, 22, 22);
+    unsigned Rs = select_bits ((*instr)->opcode, 16, 20);
+    unsigned o0 = select_bits ((*instr)->opcode, 15, 15);
+    unsigned Rt2 = select_bits ((*instr)->opcode, 10, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rt = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, L);
+    libarch_instruction_add_field (instr, Rs);
+    libarch_instruction_add_field (instr, o0);
+    libarch_instruction_add_field (instr, Rt2);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rt);
+
+    if (Rt2 != 31) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /**
+     *  The CAS mnemonics are laid out in the same order as the atomic memory
+     *  operations, starting from CASAB. Index by size, then L:o0.
+     */
+    _Static_assert (ARM64_INSTRUCTION_CASAH == ARM64_INSTRUCTION_CASAB + 4, "CAS halfword mnemonics out of order");
+    _Static_assert (ARM64_INSTRUCTION_CAS == ARM64_INSTRUCTION_CASAB + 12, "CAS word mnemonics out of order");
+
+    int offset_table[][4] = {
+        { 2, 3, 0, 1 },             /* CASB, CASLB, CASAB, CASALB */
+        { 6, 7, 4, 5 },             /* CASH, CASLH, CASAH, CASALH */
+        { 12, 15, 13, 14 },         /* CAS, CASL, CASA, CASAL */
+    };
+    unsigned width = (size == 3) ? 64 : 32;
+
+    (*instr)->type = ARM64_INSTRUCTION_CASAB + offset_table[(size > 2) ? 2 : size][(L << 1) | o0];
+
+    libarch_instruction_add_operand_register (instr, Rs, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rt, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_load_store_rcpc_unscaled (instruction_t **instr)
+{
+    unsigned size = select_bits ((*instr)->opcode, 30, 31);
+    unsigned opc = select_bits ((*instr)->opcode, 22, 23);
+    unsigned imm9 = select_bits ((*instr)->opcode, 12, 20);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rt = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, opc);
+    libarch_instruction_add_field (instr, imm9);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rt);
+
+    int opcode_table[][4] = {
+        { 0, 0, 32, ARM64_INSTRUCTION_STLURB },
+        { 0, 1, 32, ARM64_INSTRUCTION_LDAPURB },
+        { 0, 2, 64, ARM64_INSTRUCTION_LDAPURSB },
+        { 0, 3, 32, ARM64_INSTRUCTION_LDAPURSB },
+
+        { 1, 0, 32, ARM64_INSTRUCTION_STLURH },
+        { 1, 1, 32, ARM64_INSTRUCTION_LDAPURH },
+        { 1, 2, 64, ARM64_INSTRUCTION_LDAPURSH },
+        { 1, 3, 32, ARM64_INSTRUCTION_LDAPURSH },
+
+        { 2, 0, 32, ARM64_INSTRUCTION_STLUR },
+        { 2, 1, 32, ARM64_INSTRUCTION_LDAPUR },
+        { 2, 2, 64, ARM64_INSTRUCTION_LDAPURSW },
+
+        { 3, 0, 64, ARM64_INSTRUCTION_STLUR },
+        { 3, 1, 64, ARM64_INSTRUCTION_LDAPUR },
+    };
+
+    for (int i = 0; i < sizeof (opcode_table) / sizeof (opcode_table[0]); i++) {
+        if (opcode_table[i][0] == size && opcode_table[i][1] == opc) {
+            int imm = arm64_sign_extend (imm9, 9);
+
+            (*instr)->type = opcode_table[i][3];
+            libarch_instruction_add_operand_register (instr, Rt, opcode_table[i][2], ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+
+            /* The offset is omitted when zero, e.g. [x1] */
+            if (imm) {
+                libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', 0);
+                libarch_instruction_add_operand_immediate_with_fix (instr, *(unsigned int *) &imm, ARM64_IMMEDIATE_TYPE_INT, 0, ']');
+            } else {
+                libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
+            }
+            return LIBARCH_DECODE_STATUS_SUCCESS;
+        }
+    }
+
+    return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+}
+
+
 LIBARCH_PRIVATE LIBARCH_API
 decode_status_t
 decode_load_register_literal (instruction_t **instr)
@@ -552,7 +685,7 @@ decode_load_register_literal (instruction_t **instr)
 
         /* If there was a prefetch op, add it as an extra operand */
         if (prfop >= 0) libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_PRFOP, prfop);
-        else libarch_instruction_add_operand_immediate (instr, *(long *) &Rt, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+        else libarch_instruction_add_operand_immediate (instr, Rt, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
 
         libarch_instruction_add_operand_immediate (instr, *(long *) &label, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
 
@@ -582,6 +715,128 @@ decode_load_register_literal (instruction_t **instr)
     return LIBARCH_DECODE_STATUS_SUCCESS;
 }
 
+/**
+ *  Load/Store register pair, indexed by LS_PAIR_INDEX (select, opc, V, L),
+ *  where `select` is bits 23-25: no-allocate offset, post-indexed, signed
+ *  offset and pre-indexed. Unallocated encodings are left zeroed, so their
+ *  type is ARM64_INSTRUCTION_UNK.
+ */
+#define LS_PAIR_INDEX(select, opc, V, L)    (((select) << 4) | ((opc) << 2) | ((V) << 1) | (L))
+
+typedef struct {
+    arm64_instr_t   type;
+    uint8_t         width;
+    uint8_t         simd_fp;
+} ls_pair_t;
+
+static const ls_pair_t ls_pair_table[64] = {
+    /* Load/Store no-allocate pair (offset) */
+    [LS_PAIR_INDEX (0, 0, 0, 0)] = { ARM64_INSTRUCTION_STNP, 32, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (0, 0, 0, 1)] = { ARM64_INSTRUCTION_LDNP, 32, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (0, 0, 1, 0)] = { ARM64_INSTRUCTION_STNP, 32, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (0, 0, 1, 1)] = { ARM64_INSTRUCTION_LDNP, 32, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (0, 1, 1, 0)] = { ARM64_INSTRUCTION_STNP, 64, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (0, 1, 1, 1)] = { ARM64_INSTRUCTION_LDNP, 64, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (0, 2, 0, 0)] = { ARM64_INSTRUCTION_STNP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (0, 2, 0, 1)] = { ARM64_INSTRUCTION_LDNP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (0, 2, 1, 0)] = { ARM64_INSTRUCTION_STNP, 128, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (0, 2, 1, 1)] = { ARM64_INSTRUCTION_LDNP, 128, ARM64_REGISTER_TYPE_FLOATING_POINT },
+
+    /* Load/Store register pair (post-indexed) */
+    [LS_PAIR_INDEX (1, 0, 0, 0)] = { ARM64_INSTRUCTION_STP, 32, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (1, 0, 0, 1)] = { ARM64_INSTRUCTION_LDP, 32, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (1, 0, 1, 0)] = { ARM64_INSTRUCTION_STP, 32, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (1, 0, 1, 1)] = { ARM64_INSTRUCTION_LDP, 32, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (1, 1, 0, 0)] = { ARM64_INSTRUCTION_STGP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (1, 1, 0, 1)] = { ARM64_INSTRUCTION_LDPSW, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (1, 1, 1, 0)] = { ARM64_INSTRUCTION_STP, 64, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (1, 1, 1, 1)] = { ARM64_INSTRUCTION_LDP, 64, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (1, 2, 0, 0)] = { ARM64_INSTRUCTION_STP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (1, 2, 0, 1)] = { ARM64_INSTRUCTION_LDP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (1, 2, 1, 0)] = { ARM64_INSTRUCTION_STP, 128, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (1, 2, 1, 1)] = { ARM64_INSTRUCTION_LDP, 128, ARM64_REGISTER_TYPE_FLOATING_POINT },
+
+    /* Load/Store register pair (offset) */
+    [LS_PAIR_INDEX (2, 0, 0, 0)] = { ARM64_INSTRUCTION_STP, 32, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (2, 0, 0, 1)] = { ARM64_INSTRUCTION_LDP, 32, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (2, 0, 1, 0)] = { ARM64_INSTRUCTION_STP, 32, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (2, 0, 1, 1)] = { ARM64_INSTRUCTION_LDP, 32, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (2, 1, 0, 0)] = { ARM64_INSTRUCTION_STGP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (2, 1, 0, 1)] = { ARM64_INSTRUCTION_LDPSW, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (2, 1, 1, 0)] = { ARM64_INSTRUCTION_STP, 64, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (2, 1, 1, 1)] = { ARM64_INSTRUCTION_LDP, 64, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (2, 2, 0, 0)] = { ARM64_INSTRUCTION_STP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (2, 2, 0, 1)] = { ARM64_INSTRUCTION_LDP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (2, 2, 1, 0)] = { ARM64_INSTRUCTION_STP, 128, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (2, 2, 1, 1)] = { ARM64_INSTRUCTION_LDP, 128, ARM64_REGISTER_TYPE_FLOATING_POINT },
+
+    /* Load/Store register pair (pre-indexed) */
+    [LS_PAIR_INDEX (3, 0, 0, 0)] = { ARM64_INSTRUCTION_STP, 32, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (3, 0, 0, 1)] = { ARM64_INSTRUCTION_LDP, 32, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (3, 0, 1, 0)] = { ARM64_INSTRUCTION_STP, 32, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (3, 0, 1, 1)] = { ARM64_INSTRUCTION_LDP, 32, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (3, 1, 0, 0)] = { ARM64_INSTRUCTION_STGP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (3, 1, 0, 1)] = { ARM64_INSTRUCTION_LDPSW, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (3, 1, 1, 0)] = { ARM64_INSTRUCTION_STP, 64, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (3, 1, 1, 1)] = { ARM64_INSTRUCTION_LDP, 64, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (3, 2, 0, 0)] = { ARM64_INSTRUCTION_STP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (3, 2, 0, 1)] = { ARM64_INSTRUCTION_LDP, 64, ARM64_REGISTER_TYPE_GENERAL },
+    [LS_PAIR_INDEX (3, 2, 1, 0)] = { ARM64_INSTRUCTION_STP, 128, ARM64_REGISTER_TYPE_FLOATING_POINT },
+    [LS_PAIR_INDEX (3, 2, 1, 1)] = { ARM64_INSTRUCTION_LDP, 128, ARM64_REGISTER_TYPE_FLOATING_POINT },
+};
+
+/**
+ *  Load/Store register, indexed by LS_REGISTER_INDEX (size, V, opc). Each
+ *  encoding has a mnemonic per addressing mode, in the order of the
+ *  LS_REGISTER_MODE_* values, and the register offset variants use the same
+ *  mnemonics as unsigned offset. `scale` is log2 of the access size, which the
+ *  unsigned and register offsets are scaled by.
+ */
+#define LS_REGISTER_INDEX(size, V, opc)     (((size) << 3) | ((V) << 2) | (opc))
+
+#define LS_REGISTER_MODE_UNSCALED           0       // op4 == 0
+#define LS_REGISTER_MODE_POST_INDEXED       1       // op4 == 1
+#define LS_REGISTER_MODE_UNPRIVILEGED       2       // op4 == 2
+#define LS_REGISTER_MODE_PRE_INDEXED        3       // op4 == 3
+#define LS_REGISTER_MODE_UNSIGNED_OFFSET    4
+
+typedef struct {
+    arm64_instr_t   type[5];
+    uint8_t         width;
+    uint8_t         simd_fp;
+    uint8_t         scale;
+} ls_register_t;
+
+static const ls_register_t ls_register_table[32] = {
+    [LS_REGISTER_INDEX (0, 0, 0)] = { { ARM64_INSTRUCTION_STURB, ARM64_INSTRUCTION_STRB, ARM64_INSTRUCTION_STTRB, ARM64_INSTRUCTION_STRB, ARM64_INSTRUCTION_STRB }, 32, ARM64_REGISTER_TYPE_GENERAL, 0 },
+    [LS_REGISTER_INDEX (0, 0, 1)] = { { ARM64_INSTRUCTION_LDURB, ARM64_INSTRUCTION_LDRB, ARM64_INSTRUCTION_LDTRB, ARM64_INSTRUCTION_LDRB, ARM64_INSTRUCTION_LDRB }, 32, ARM64_REGISTER_TYPE_GENERAL, 0 },
+    [LS_REGISTER_INDEX (0, 0, 2)] = { { ARM64_INSTRUCTION_LDURSB, ARM64_INSTRUCTION_LDRSB, ARM64_INSTRUCTION_LDTRSB, ARM64_INSTRUCTION_LDRSB, ARM64_INSTRUCTION_LDRSB }, 64, ARM64_REGISTER_TYPE_GENERAL, 0 },
+    [LS_REGISTER_INDEX (0, 0, 3)] = { { ARM64_INSTRUCTION_LDURSB, ARM64_INSTRUCTION_LDRSB, ARM64_INSTRUCTION_LDTRSB, ARM64_INSTRUCTION_LDRSB, ARM64_INSTRUCTION_LDRSB }, 32, ARM64_REGISTER_TYPE_GENERAL, 0 },
+    [LS_REGISTER_INDEX (0, 1, 0)] = { { ARM64_INSTRUCTION_STUR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STR }, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, 0 },
+    [LS_REGISTER_INDEX (0, 1, 1)] = { { ARM64_INSTRUCTION_LDUR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDR }, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, 0 },
+    [LS_REGISTER_INDEX (0, 1, 2)] = { { ARM64_INSTRUCTION_STUR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STR }, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, 4 },
+    [LS_REGISTER_INDEX (0, 1, 3)] = { { ARM64_INSTRUCTION_LDUR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDR }, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, 4 },
+
+    [LS_REGISTER_INDEX (1, 0, 0)] = { { ARM64_INSTRUCTION_STURH, ARM64_INSTRUCTION_STRH, ARM64_INSTRUCTION_STTRH, ARM64_INSTRUCTION_STRH, ARM64_INSTRUCTION_STRH }, 32, ARM64_REGISTER_TYPE_GENERAL, 1 },
+    [LS_REGISTER_INDEX (1, 0, 1)] = { { ARM64_INSTRUCTION_LDURH, ARM64_INSTRUCTION_LDRH, ARM64_INSTRUCTION_LDTRH, ARM64_INSTRUCTION_LDRH, ARM64_INSTRUCTION_LDRH }, 32, ARM64_REGISTER_TYPE_GENERAL, 1 },
+    [LS_REGISTER_INDEX (1, 0, 2)] = { { ARM64_INSTRUCTION_LDURSH, ARM64_INSTRUCTION_LDRSH, ARM64_INSTRUCTION_LDTRSH, ARM64_INSTRUCTION_LDRSH, ARM64_INSTRUCTION_LDRSH }, 64, ARM64_REGISTER_TYPE_GENERAL, 1 },
+    [LS_REGISTER_INDEX (1, 0, 3)] = { { ARM64_INSTRUCTION_LDURSH, ARM64_INSTRUCTION_LDRSH, ARM64_INSTRUCTION_LDTRSH, ARM64_INSTRUCTION_LDRSH, ARM64_INSTRUCTION_LDRSH }, 32, ARM64_REGISTER_TYPE_GENERAL, 1 },
+    [LS_REGISTER_INDEX (1, 1, 0)] = { { ARM64_INSTRUCTION_STUR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STR }, 16, ARM64_REGISTER_TYPE_FLOATING_POINT, 1 },
+    [LS_REGISTER_INDEX (1, 1, 1)] = { { ARM64_INSTRUCTION_LDUR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDR }, 16, ARM64_REGISTER_TYPE_FLOATING_POINT, 1 },
+
+    [LS_REGISTER_INDEX (2, 0, 0)] = { { ARM64_INSTRUCTION_STUR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STTR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STR }, 32, ARM64_REGISTER_TYPE_GENERAL, 2 },
+    [LS_REGISTER_INDEX (2, 0, 1)] = { { ARM64_INSTRUCTION_LDUR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDTR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDR }, 32, ARM64_REGISTER_TYPE_GENERAL, 2 },
+    [LS_REGISTER_INDEX (2, 0, 2)] = { { ARM64_INSTRUCTION_LDURSW, ARM64_INSTRUCTION_LDRSW, ARM64_INSTRUCTION_LDTRSW, ARM64_INSTRUCTION_LDRSW, ARM64_INSTRUCTION_LDRSW }, 64, ARM64_REGISTER_TYPE_GENERAL, 2 },
+    [LS_REGISTER_INDEX (2, 1, 0)] = { { ARM64_INSTRUCTION_STUR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STR }, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, 2 },
+    [LS_REGISTER_INDEX (2, 1, 1)] = { { ARM64_INSTRUCTION_LDUR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDR }, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, 2 },
+
+    [LS_REGISTER_INDEX (3, 0, 0)] = { { ARM64_INSTRUCTION_STUR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STTR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STR }, 64, ARM64_REGISTER_TYPE_GENERAL, 3 },
+    [LS_REGISTER_INDEX (3, 0, 1)] = { { ARM64_INSTRUCTION_LDUR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDTR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDR }, 64, ARM64_REGISTER_TYPE_GENERAL, 3 },
+    [LS_REGISTER_INDEX (3, 0, 2)] = { { ARM64_INSTRUCTION_PRFUM, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_PRFM }, 64, ARM64_REGISTER_TYPE_GENERAL, 3 },
+    [LS_REGISTER_INDEX (3, 1, 0)] = { { ARM64_INSTRUCTION_STUR, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_STR, ARM64_INSTRUCTION_STR }, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, 3 },
+    [LS_REGISTER_INDEX (3, 1, 1)] = { { ARM64_INSTRUCTION_LDUR, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_UNK, ARM64_INSTRUCTION_LDR, ARM64_INSTRUCTION_LDR }, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, 3 },
+};
+
 LIBARCH_PRIVATE LIBARCH_API
 decode_status_t
 decode_load_store_register_pair (instruction_t **instr)
@@ -605,99 +860,43 @@ decode_load_store_register_pair (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rt);
 
-    typedef struct {
-        unsigned select, opc, V, L;
-        int width;
-        int simd_fp;
-        arm64_instr_t type;
-    } opcode;
-
-    opcode opcode_table[] = {
-        /* Load/Store no-allocate pair (offset) */
-        { 0, 0, 0, 0, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STNP },
-        { 0, 0, 0, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDNP },
-        { 0, 0, 1, 0, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STNP },
-        { 0, 0, 1, 1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDNP },
-        { 0, 1, 1, 0, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STNP },
-        { 0, 1, 1, 1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDNP },
-        { 0, 2, 0, 0, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STNP },
-        { 0, 2, 0, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDNP },
-
-        /* Load/Store register pair (post-indexed) */
-        { 1, 0, 0, 0, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STP },
-        { 1, 0, 0, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDP },
-        { 1, 0, 1, 0, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 1, 0, 1, 1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-        { 1, 1, 1, 0, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 1, 1, 1, 1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-        { 1, 2, 1, 0, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 1, 2, 1, 1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-        { 1, 1, 0, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDPSW },
-
-        /* Load/Store register pair (offset) */
-        { 2, 0, 0, 0, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STP },
-        { 2, 0, 0, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDP },
-        { 2, 0, 1, 0, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 2, 0, 1, 1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-        { 2, 1, 0, 0, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STP },
-        { 2, 1, 0, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDP },
-        { 2, 1, 1, 0, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 2, 1, 1, 1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-        { 2, 2, 1, 0, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 2, 2, 1, 1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-        { 2, 1, 0, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDPSW },
-
-        /* Load/Store register pair (pre-indexed) */
-        { 3, 0, 0, 0, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STP },
-        { 3, 0, 0, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDP },
-        { 3, 0, 1, 0, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 3, 0, 1, 1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-
-        { 3, 2, 0, 0, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STP },
-        { 3, 2, 0, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDP },
-        { 3, 1, 1, 0, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 3, 1, 1, 1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-
-        { 3, 2, 1, 0, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STP },
-        { 3, 2, 1, 1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDP },
-        { 3, 1, 0, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDPSW },
+    /* Bit 25 is clear for every pair encoding */
+    if (select > 3) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    const ls_pair_t *entry = &ls_pair_table[LS_PAIR_INDEX (select, opc, V, L)];
+    if (entry->type == ARM64_INSTRUCTION_UNK) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-    };
-    int opc_len = sizeof (opcode_table) / sizeof (opcode*);
+    /* STGP stores an allocation tag, which needs MTE */
+    if (entry->type == ARM64_INSTRUCTION_STGP && !libarch_decode_has_feature (*instr, LIBARCH_FEATURE_MTE))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-    for (int i = 0; i < opc_len; i++) {
-        if (opcode_table[i].select == select && opcode_table[i].opc == opc && opcode_table[i].V == V && opcode_table[i].L == L) {
-            (*instr)->type = opcode_table[i].type;
+    (*instr)->type = entry->type;
 
-            /* Common register operands */
-            libarch_instruction_add_operand_register (instr, Rt, opcode_table[i].width, opcode_table[i].simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-            libarch_instruction_add_operand_register (instr, Rt2, opcode_table[i].width, opcode_table[i].simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    /* Common register operands */
+    libarch_instruction_add_operand_register (instr, Rt, entry->width, entry->simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rt2, entry->width, entry->simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
 
-            /* Fixup immediate value */
-            unsigned int scale, imm;
-            scale = (opcode_table[i].V == 0) ? 2 + (opc >> 1) : 2 + opc;
-            imm = arm64_sign_extend (imm7, 7) << scale;
+    /* Fixup immediate value */
+    unsigned int scale, imm;
+    if (entry->type == ARM64_INSTRUCTION_STGP) scale = 4;
+    else scale = (V == 0) ? 2 + (opc >> 1) : 2 + opc;
+    imm = arm64_sign_extend (imm7, 7) << scale;
 
-            /* Load/Store no-allocated pair (offset) */
-            if (opcode_table[i].select == 0 || opcode_table[i].select == 2) {
-                libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', (imm7 >= 1) ? NULL : ']');
+    /* Load/Store no-allocated pair (offset) */
+    if (select == 0 || select == 2) {
+        libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', (imm7 >= 1) ? 0 : ']');
 
-                if (imm7)
-                    libarch_instruction_add_operand_immediate_with_fix (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, NULL, ']');
+        if (imm7)
+            libarch_instruction_add_operand_immediate_with_fix (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, 0, ']');
 
-            /* Load/Store register pair (post-indexed) */
-            } else if (opcode_table[i].select == 1) {
-                libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
-                libarch_instruction_add_operand_immediate (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            
-            /* Load/Store register pair (pre-indexed) */
-            } else if (opcode_table[i].select == 3) {
-                libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', NULL);
-                libarch_instruction_add_operand_immediate_with_fix_extra (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, NULL, ']');
-            }
+    /* Load/Store register pair (post-indexed) */
+    } else if (select == 1) {
+        libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
+        libarch_instruction_add_operand_immediate_with_fix (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, 0, 0);
 
-            break;
-        }
+    /* Load/Store register pair (pre-indexed) */
+    } else if (select == 3) {
+        libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', 0);
+        libarch_instruction_add_operand_immediate_with_fix_extra (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, 0, ']');
     }
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
@@ -708,7 +907,6 @@ decode_status_t
 decode_load_store_register (instruction_t **instr, int uimm_opt)
 {
     /* Decode subgroup options */
-    unsigned op2 = select_bits ((*instr)->opcode, 23, 24) >> 1;
     unsigned op3 = select_bits ((*instr)->opcode, 16, 21) >> 5;
     unsigned op4 = select_bits ((*instr)->opcode, 10, 11);
 
@@ -728,237 +926,58 @@ decode_load_store_register (instruction_t **instr, int uimm_opt)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rt);
 
-    typedef struct {
-        unsigned op2, op3, op4;
-        unsigned size, V, opc;
-        int opt, width;
-        int simd_fp; 
-        arm64_instr_t type;
-    } opcode;
-
-    opcode opcode_table[] = {
-        /* Load/Store register (Unscaled immediate) */
-        { 0, 0, 0, 0, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STURB },
-        { 0, 0, 0, 0, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDURB },
-
-        { 0, 0, 0, 0, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDURSB },
-        { 0, 0, 0, 0, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDURSB },
-
-        { 0, 0, 0, 0, 1, 0, -1, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STUR },
-        { 0, 0, 0, 0, 1, 1, -1, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDUR },
-        { 0, 0, 0, 0, 1, 2, -1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STUR },
-        { 0, 0, 0, 0, 1, 3, -1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDUR },
-
-        { 0, 0, 0, 1, 0, 0, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STURH },
-        { 0, 0, 0, 1, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDURH },
-
-        { 0, 0, 0, 1, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDURSH },
-        { 0, 0, 0, 1, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDURSH },
-
-        { 0, 0, 0, 1, 1, 0, -1, 16, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STUR },
-        { 0, 0, 0, 1, 1, 1, -1, 16, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDUR },
-
-        { 0, 0, 0, 2, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STUR },
-        { 0, 0, 0, 2, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDUR },
-
-        { 0, 0, 0, 2, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDURSW },
-        { 0, 0, 0, 3, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_PRFUM },
-
-        { 0, 0, 0, 2, 1, 0, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STUR },
-        { 0, 0, 0, 2, 1, 1, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDUR },
-
-        { 0, 0, 0, 3, 0, 0, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STUR },
-        { 0, 0, 0, 3, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDUR },
-
-        { 0, 0, 0, 3, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_PRFUM },
-        { 0, 0, 0, 3, 1, 0, -1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STUR },
-        { 0, 0, 0, 3, 1, 1, -1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STUR },
-
-        /* Load/Store register (immediate post-indexed) */
-        { 0, 0, 1, 0, 0, 0, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRB },
-        { 0, 0, 1, 0, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRB },
-        { 0, 0, 1, 0, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-        { 0, 0, 1, 0, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-
-        { 0, 0, 1, 0, 1, 0, -1, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 1, 0, 1, 1, -1, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-        { 0, 0, 1, 0, 1, 2, -1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 1, 0, 1, 3, -1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 1, 1, 0, 0, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRH },
-        { 0, 0, 1, 1, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRH },
-        { 0, 0, 1, 1, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSH },
-        { 0, 0, 1, 1, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSH },
-
-        { 0, 0, 1, 1, 1, 0, -1, 16, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 1, 1, 1, 1, -1, 16, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 1, 2, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STR },
-        { 0, 0, 1, 2, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDR },
-        { 0, 0, 1, 2, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSW },
-        { 0, 0, 1, 2, 1, 0, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 1, 2, 1, 1, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 1, 3, 0, 0, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STR },
-        { 0, 0, 1, 3, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDR },
-        { 0, 0, 1, 3, 1, 0, -1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 1, 3, 1, 1, -1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        /* Load/Store register (unprivileged) */
-        { 0, 0, 2, 0, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STTRB },
-        { 0, 0, 2, 0, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTRB },
-        { 0, 0, 2, 0, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTRSB },
-        { 0, 0, 2, 0, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTRSB },
-
-        { 0, 0, 2, 1, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STTRH },
-        { 0, 0, 2, 1, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTRH },
-        { 0, 0, 2, 1, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTRSH },
-        { 0, 0, 2, 1, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTRSH },
-
-        { 0, 0, 2, 2, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STTR },
-        { 0, 0, 2, 2, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTR },
-        { 0, 0, 2, 2, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTRSW },
-
-        { 0, 0, 2, 3, 0, 0, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STTR },
-        { 0, 0, 2, 3, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDTR },
-
-        /* Load/Store register (immediate pre-indexed) */
-        { 0, 0, 3, 0, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRB },
-        { 0, 0, 3, 0, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRB },
-        { 0, 0, 3, 0, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-        { 0, 0, 3, 0, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-
-        { 0, 0, 3, 0, 1, 0, -1, 8, ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 3, 0, 1, 1, -1, 8, ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_INSTRUCTION_LDR },
-        { 0, 0, 3, 0, 1, 2, -1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 3, 0, 1, 3, -1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 3, 1, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRH },
-        { 0, 0, 3, 1, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRH },
-        { 0, 0, 3, 1, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSH },
-        { 0, 0, 3, 1, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSH },
-
-        { 0, 0, 3, 1, 1, 0, -1, 16, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 3, 1, 1, 1, -1, 16, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
+    /* Outside of unsigned offset, bit 21 set is the PAC loads, which aren't handled here */
+    if (uimm_opt != 1 && op3) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-        { 0, 0, 3, 2, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STR },
-        { 0, 0, 3, 2, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDR },
-        { 0, 0, 3, 2, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSW },
-
-        { 0, 0, 3, 2, 1, 0, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 3, 2, 1, 1, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 3, 3, 0, 0, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STR },
-        { 0, 0, 3, 3, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 3, 3, 1, 0, -1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 3, 3, 1, 1, -1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        /* Unsigned immediate */
-        { 0, 0, 0, 0, 0, 0, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRB },
-        { 0, 0, 0, 0, 0, 1, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRB },
-        { 0, 0, 0, 0, 0, 2, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-        { 0, 0, 0, 0, 0, 3, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-
-        { 0, 0, 0, 0, 1, 0, 1, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 0, 0, 1, 1, 1, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-        { 0, 0, 0, 0, 1, 2, 1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 0, 0, 1, 3, 1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 0, 1, 0, 0, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRH },
-        { 0, 0, 0, 1, 0, 1, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRH },
-        { 0, 0, 0, 1, 0, 2, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSH },
-        { 0, 0, 0, 1, 0, 3, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSH },
-
-        { 0, 0, 0, 1, 1, 0, 1, 16, ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 0, 1, 1, 1, 1, 16, ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 0, 2, 0, 0, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STR },
-        { 0, 0, 0, 2, 0, 1, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDR },
-        { 0, 0, 0, 2, 0, 2, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSW },
-
-        { 0, 0, 0, 2, 1, 0, 1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 0, 2, 1, 1, 1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 0, 0, 0, 3, 0, 0, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STR },
-        { 0, 0, 0, 3, 0, 1, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDR },
-        { 0, 0, 0, 3, 0, 2, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_PRFM },
-
-        { 0, 0, 0, 3, 1, 0, 1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 0, 0, 3, 1, 0, 1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-        
-    };
-    int table_size = sizeof (opcode_table) / sizeof (opcode);
-
-    for (int i = 0; i < table_size; i++) {
-        if (opcode_table[i].opt == uimm_opt && uimm_opt == 1 && opcode_table[i].size == size && opcode_table[i].V == V && opcode_table[i].opc == opc) {
-            (*instr)->type = opcode_table[i].type;
-
-            if (opcode_table[i].type == ARM64_INSTRUCTION_PRFM) {
-                /* Add the prefetch operation as an extra operand */
-                int prfop = get_prefetch_operation (Rt);
-                if (prfop >= 0) libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_PRFOP, prfop);
-                else libarch_instruction_add_operand_immediate (instr, *(long *) &Rt, ARM64_IMMEDIATE_TYPE_INT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-            
-            /* Add the rest of the common operands */
-            } else {
-                libarch_instruction_add_operand_register (instr, Rt, opcode_table[i].width, opcode_table[i].simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-            }
+    unsigned mode = (uimm_opt == 1) ? LS_REGISTER_MODE_UNSIGNED_OFFSET : op4;
+    const ls_register_t *entry = &ls_register_table[LS_REGISTER_INDEX (size, V, opc)];
+    if (entry->type[mode] == ARM64_INSTRUCTION_UNK) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-            unsigned imm12 = select_bits ((*instr)->opcode, 10, 21);
-            unsigned int pimm = arm64_sign_extend(imm12, 12) * (opcode_table[i].width / 8);
-
-            libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', NULL);
-            libarch_instruction_add_operand_immediate_with_fix (instr, *(unsigned int *) &pimm, ARM64_IMMEDIATE_TYPE_INT, NULL, ']');
-
-        } else if (opcode_table[i].op2 == op2 && opcode_table[i].op3 == op3 && opcode_table[i].op4 == op4) {
-            if (opcode_table[i].size == size && opcode_table[i].V == V && opcode_table[i].opc == opc) {
-                (*instr)->type = opcode_table[i].type;
-
-                /**
-                 *  Most of these instructions have the same operand synatx, with the exception of
-                 *  the signing and width of the imemdiate values. Makes it a bit cleaner to add
-                 *  the operands.
-                 *
-                 *  First, we'll check if `instr` is any of the types that has a different operand
-                 *  order to the rest of the instructions in the subgroup.
-                 */
-                if (opcode_table[i].type == ARM64_INSTRUCTION_PRFUM) {
-                    /* Add the prefetch operation as an extra operand */
-                    int prfop = get_prefetch_operation (Rt);
-                    if (prfop >= 0) libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_PRFOP, prfop);
-                    else libarch_instruction_add_operand_immediate (instr, *(long *) &Rt, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
-                
-                /* Add the rest of the common operands */
-                } else {
-                    libarch_instruction_add_operand_register (instr, Rt, opcode_table[i].width, opcode_table[i].simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-                }
-                
-
-                /* Unscaled immediate / immediate post-indexed */
-                if (op2 == 0 && op3 == 0 && (op4 == 0 || op4 == 1)) {
-                    unsigned int imm = arm64_sign_extend (imm9, 9);
-
-                    libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', (imm >= 1 && op4 == 0) ? NULL : ']');
-                    libarch_instruction_add_operand_immediate_with_fix (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, NULL, (op4 == 0) ? ']' : NULL);
-
-                /* unprivileged, immediate pre-indexed */
-                } else if (op2 == 0 && op3 == 0 && (op4 == 2 || op4 == 3)) {
-                    unsigned int imm = arm64_sign_extend (imm9, 9);
-                    libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', NULL);
-
-                    if (op4 == 3) 
-                        libarch_instruction_add_operand_immediate_with_fix_extra (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, NULL, ']');
-                    else
-                        libarch_instruction_add_operand_immediate_with_fix (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, NULL, ']');
-                
-                /* Unsigned immediate */
-                } else if (op2 == 1) {
-                    
-                }
-                break;
-            }
-        }
+    (*instr)->type = entry->type[mode];
+
+    /**
+     *  Most of these instructions have the same operand synatx, with the exception of
+     *  the signing and width of the imemdiate values. Makes it a bit cleaner to add
+     *  the operands.
+     *
+     *  First, we'll check if `instr` is any of the types that has a different operand
+     *  order to the rest of the instructions in the subgroup.
+     */
+    if ((*instr)->type == ARM64_INSTRUCTION_PRFM || (*instr)->type == ARM64_INSTRUCTION_PRFUM) {
+        /* Add the prefetch operation as an extra operand */
+        int prfop = get_prefetch_operation (Rt);
+        if (prfop >= 0) libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_PRFOP, prfop);
+        else libarch_instruction_add_operand_immediate (instr, Rt, (mode == LS_REGISTER_MODE_UNSIGNED_OFFSET) ? ARM64_IMMEDIATE_TYPE_INT : ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+
+    /* Add the rest of the common operands */
+    } else {
+        libarch_instruction_add_operand_register (instr, Rt, entry->width, entry->simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    }
+
+    /* Unsigned immediate */
+    if (mode == LS_REGISTER_MODE_UNSIGNED_OFFSET) {
+        unsigned imm12 = select_bits ((*instr)->opcode, 10, 21);
+        unsigned int pimm = imm12 << entry->scale;
+
+        libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', 0);
+        libarch_instruction_add_operand_immediate_with_fix (instr, *(unsigned int *) &pimm, ARM64_IMMEDIATE_TYPE_INT, 0, ']');
+
+    /* Unscaled immediate / immediate post-indexed */
+    } else if (op4 == 0 || op4 == 1) {
+        unsigned int imm = arm64_sign_extend (imm9, 9);
+
+        libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', (imm >= 1 && op4 == 0) ? 0 : ']');
+        libarch_instruction_add_operand_immediate_with_fix (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, 0, (op4 == 0) ? ']' : 0);
+
+    /* unprivileged, immediate pre-indexed */
+    } else {
+        unsigned int imm = arm64_sign_extend (imm9, 9);
+        libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', 0);
+
+        if (op4 == 3)
+            libarch_instruction_add_operand_immediate_with_fix_extra (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, 0, ']');
+        else
+            libarch_instruction_add_operand_immediate_with_fix (instr, *(int *) &imm, ARM64_IMMEDIATE_TYPE_INT, 0, ']');
     }
 
     return LIBARCH_DECODE_STATUS_SUCCESS;
@@ -988,96 +1007,195 @@ decode_load_store_register_reg_offset (instruction_t **instr)
     libarch_instruction_add_field (instr, Rn);
     libarch_instruction_add_field (instr, Rt);
 
-    typedef struct {
-        unsigned size, V, opc;
-        int extend, width, simd_fp;
-        arm64_instr_t type;
-    } opcode;
-
-    opcode opcode_table[] = {
-        { 0, 0, 0, 0, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRB },
-        { 0, 0, 0, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRB },
-        { 0, 0, 1, 0, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRB },
-        { 0, 0, 1, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRB },
-        { 0, 0, 2, 0, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-        { 0, 0, 2, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-        { 0, 0, 3, 0, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-        { 0, 0, 3, 1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSB },
-
-        { 0, 1, 0, 0, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 1, 0, 1, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 1, 1, 0, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-        { 0, 1, 1, 1, 8, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-        { 0, 1, 2, -1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 0, 1, 3, -1, 128, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 1, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STRH },
-        { 1, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRH },
-        { 1, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSH },
-        { 1, 0, 3, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSH },
-        { 1, 1, 0, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 1, 1, 1, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 2, 0, 0, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STR },
-        { 2, 0, 1, -1, 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDR },
-        { 2, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDRSW },
-        { 2, 1, 0, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 2, 1, 1, -1, 32, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
-
-        { 3, 0, 0, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_STR },
-        { 3, 0, 1, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_LDR },
-        { 3, 0, 2, -1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_INSTRUCTION_PRFM },
-        { 3, 1, 0 -1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_STR },
-        { 3, 1, 1 -1, 64, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_INSTRUCTION_LDR },
+    /* Register offset shares the unsigned offset mnemonics */
+    const ls_register_t *entry = &ls_register_table[LS_REGISTER_INDEX (size, V, opc)];
+    if (entry->type[LS_REGISTER_MODE_UNSIGNED_OFFSET] == ARM64_INSTRUCTION_UNK) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
 
-    };
-    int table_size = sizeof (opcode_table) / sizeof (opcode);
+    (*instr)->type = entry->type[LS_REGISTER_MODE_UNSIGNED_OFFSET];
 
-    for (int i = 0; i < table_size; i++) {
-        if (opcode_table[i].size == size && opcode_table[i].V == V && opcode_table[i].opc == opc) {
-            (*instr)->type = opcode_table[i].type;
-            int use_extend = 1;
+    /**
+     *  Rm is an X register for the UXTX/SXTX options, and UXTX is written as
+     *  LSL, or left out if S is clear. S scales the index by the access size,
+     *  which is printed even when it's zero for byte accesses.
+     */
+    unsigned rm_width = (option & 1) ? 64 : 32;
+    unsigned rm_reg = (Rm == 31) ? ((rm_width == 64) ? ARM64_REG_XZR : ARM64_32_REG_WZR) : Rm;
 
-            /* Check if this instruction is an extended/shift register variant */
-            if (opcode_table[i].extend != -1) {
-                /* If `option` is set to 3, then we need to use the shift register variant */
-                if (option == 3) use_extend = 0;
-            }
+    libarch_instruction_add_operand_register (instr, Rt, entry->width, entry->simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', 0);
 
-            libarch_instruction_add_operand_register (instr, Rt, opcode_table[i].width, opcode_table[i].simd_fp, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
-            libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', NULL);
-            libarch_instruction_add_operand_register (instr, Rm, (use_extend) ? 32 : 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    if (option == ARM64_INDEX_EXTEND_UXTX && !S) {
+        libarch_instruction_add_operand_register_with_fix (instr, rm_reg, rm_width, ARM64_REGISTER_TYPE_GENERAL, 0, ']');
+    } else if (option == ARM64_INDEX_EXTEND_UXTX) {
+        libarch_instruction_add_operand_register (instr, Rm, rm_width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+        libarch_instruction_add_operand_shift_with_fix (instr, entry->scale, ARM64_SHIFT_TYPE_LSL, 0, ']');
+    } else {
+        libarch_instruction_add_operand_register (instr, Rm, rm_width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+        libarch_instruction_add_operand_extend_with_fix (instr, option, (S) ? (int) entry->scale : -1, 0, ']');
+    }
 
-            if (use_extend) {
-                libarch_instruction_add_operand_extra_with_fix (instr, ARM64_OPERAND_TYPE_INDEX_EXTEND, option, NULL, ']');
-            } else {
-                int shift_table[] = {0, 1, 2, 3, 4};
-                int shift = 0;
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
 
-                /**
-                 *  Perform a lookup in the shift table to determine how much the instruction is left-shifting by. 
-                 */
-                if (opcode_table[i].width >= 16 && opcode_table[i].width <= 128 && opcode_table[i].simd_fp == ARM64_REGISTER_TYPE_FLOATING_POINT)
-                    shift = shift_table[(opcode_table[i].width / 16) - 1];
 
-                libarch_instruction_add_operand_shift_with_fix (instr, shift, ARM64_SHIFT_TYPE_LSL, NULL, ']');
-            }
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_atomic_memory_operation (instruction_t **instr)
+{
+    unsigned size = select_bits ((*instr)->opcode, 30, 31);
+    unsigned V = select_bits ((*instr)->opcode, 26, 26);
+    unsigned A = select_bits ((*instr)->opcode, 23, 23);
+    unsigned R = select_bits ((*instr)->opcode, 22, 22);
+    unsigned Rs = select_bits ((*instr)->opcode, 16, 20);
+    unsigned o3 = select_bits ((*instr)->opcode, 15, 15);
+    unsigned opc = select_bits ((*instr)->opcode, 12, 14);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rt = select_bits ((*instr)->opcode, 0, 4);
 
-            break;
-        }
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, V);
+    libarch_instruction_add_field (instr, A);
+    libarch_instruction_add_field (instr, R);
+    libarch_instruction_add_field (instr, Rs);
+    libarch_instruction_add_field (instr, o3);
+    libarch_instruction_add_field (instr, opc);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rt);
+
+    unsigned width = (size == 3) ? 64 : 32;
+
+    if (V) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* Everything but SWP with o3 set is outside of LSE */
+    if ((o3 == 0 || opc == 0) && !libarch_decode_has_feature (*instr, LIBARCH_FEATURE_LSE))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* LDAPR, LDAPRB, LDAPRH */
+    if (o3 == 1 && opc == 4) {
+        if (A != 1 || R != 0 || Rs != 31) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+        if (size == 0) (*instr)->type = ARM64_INSTRUCTION_LDAPRB;
+        else if (size == 1) (*instr)->type = ARM64_INSTRUCTION_LDAPRH;
+        else (*instr)->type = ARM64_INSTRUCTION_LDAPR;
+
+        libarch_instruction_add_operand_register (instr, Rt, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+        libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
+        return LIBARCH_DECODE_STATUS_SUCCESS;
     }
 
+    /* Only SWP is allocated in the remaining o3 == 1 space */
+    if (o3 == 1 && opc != 0) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /**
+     *  Each operation has twelve LD mnemonics, ordered xAB, xALB, xB, xLB,
+     *  xAH, xALH, xH, xLH, x, xA, xAL, xL, and all but SWP have six ST
+     *  aliases ordered STxB, STxLB, STxH, STxLH, STx, STxL. The mnemonic is
+     *  found by offsetting from the first of these.
+     */
+    int op_table[][2] = {
+        { ARM64_INSTRUCTION_LDADDAB, ARM64_INSTRUCTION_STADDB },
+        { ARM64_INSTRUCTION_LDCLRAB, ARM64_INSTRUCTION_STCLRB },
+        { ARM64_INSTRUCTION_LDEORAB, ARM64_INSTRUCTION_STEORB },
+        { ARM64_INSTRUCTION_LDSETAB, ARM64_INSTRUCTION_STSETB },
+        { ARM64_INSTRUCTION_LDSMAXAB, ARM64_INSTRUCTION_STSMAXB },
+        { ARM64_INSTRUCTION_LDSMINAB, ARM64_INSTRUCTION_STSMINB },
+        { ARM64_INSTRUCTION_LDUMAXAB, ARM64_INSTRUCTION_STUMAXB },
+        { ARM64_INSTRUCTION_LDUMINAB, ARM64_INSTRUCTION_STUMINB },
+        { ARM64_INSTRUCTION_SWPAB, -1 },
+    };
+
+    _Static_assert (ARM64_INSTRUCTION_LDADDL == ARM64_INSTRUCTION_LDADDAB + 11, "LDADD mnemonics out of order");
+    _Static_assert (ARM64_INSTRUCTION_LDUMINL == ARM64_INSTRUCTION_LDUMINAB + 11, "LDUMIN mnemonics out of order");
+    _Static_assert (ARM64_INSTRUCTION_SWPL == ARM64_INSTRUCTION_SWPAB + 11, "SWP mnemonics out of order");
+    _Static_assert (ARM64_INSTRUCTION_STADDL == ARM64_INSTRUCTION_STADDB + 5, "STADD mnemonics out of order");
+    _Static_assert (ARM64_INSTRUCTION_STUMINL == ARM64_INSTRUCTION_STUMINB + 5, "STUMIN mnemonics out of order");
+
+    /* Indexed by size, then A:R */
+    int offset_table[][4] = {
+        { 2, 3, 0, 1 },
+        { 6, 7, 4, 5 },
+        { 8, 11, 9, 10 },
+    };
+
+    unsigned op = (o3) ? 8 : opc;
+    unsigned sz = (size > 2) ? 2 : size;
+
+    /* Non-acquiring operations that discard the result use the ST alias */
+    if (A == 0 && Rt == 31 && op_table[op][1] != -1) {
+        (*instr)->type = op_table[op][1] + (sz << 1) + R;
+
+        libarch_instruction_add_operand_register (instr, Rs, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+        libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    (*instr)->type = op_table[op][0] + offset_table[sz][(A << 1) | R];
+
+    libarch_instruction_add_operand_register (instr, Rs, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (instr, Rt, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', ']');
+
     return LIBARCH_DECODE_STATUS_SUCCESS;
 }
 
 
 LIBARCH_PRIVATE LIBARCH_API
 decode_status_t
-decode_atomic_memory_operation (instruction_t **instr)
+decode_memory_copy_set (instruction_t **instr)
 {
-    /* Not implemented */
-    (*instr)->type = ARM64_INSTRUCTION_UNK;
-    return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    unsigned sz = select_bits ((*instr)->opcode, 30, 31);
+    unsigned o0 = select_bits ((*instr)->opcode, 26, 26);
+    unsigned op1 = select_bits ((*instr)->opcode, 22, 23);
+    unsigned Rs = select_bits ((*instr)->opcode, 16, 20);
+    unsigned op2 = select_bits ((*instr)->opcode, 12, 15);
+    unsigned Rn = select_bits ((*instr)->opcode, 5, 9);
+    unsigned Rd = select_bits ((*instr)->opcode, 0, 4);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, sz);
+    libarch_instruction_add_field (instr, o0);
+    libarch_instruction_add_field (instr, op1);
+    libarch_instruction_add_field (instr, Rs);
+    libarch_instruction_add_field (instr, op2);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    if (sz != 0 || Rd == 31) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /**
+     *  The CPY and SET mnemonics are declared in encoding order. CPYF/CPY
+     *  have sixteen options per prologue/main/epilogue, selected by op2,
+     *  while SET/SETG have four, selected by op2<1:0>.
+     */
+    _Static_assert (ARM64_INSTRUCTION_CPYP == ARM64_INSTRUCTION_CPYFP + 48, "CPY mnemonics out of order");
+    _Static_assert (ARM64_INSTRUCTION_SETP == ARM64_INSTRUCTION_CPYFP + 96, "SET mnemonics out of order");
+    _Static_assert (ARM64_INSTRUCTION_SETGP == ARM64_INSTRUCTION_SETP + 12, "SETG mnemonics out of order");
+
+    if (op1 == 3) {
+        unsigned stage = op2 >> 2;
+
+        if (stage == 3 || Rd == Rn || Rd == Rs || Rn == Rs)
+            return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+        (*instr)->type = ARM64_INSTRUCTION_SETP + (o0 * 12) + (stage * 4) + (op2 & 3);
+
+        libarch_instruction_add_operand_register_with_fix_extra (instr, Rd, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO, '[', ']');
+        libarch_instruction_add_operand_register_with_fix_extra (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO, 0, 0);
+        libarch_instruction_add_operand_register (instr, Rs, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+        return LIBARCH_DECODE_STATUS_SUCCESS;
+    }
+
+    if (Rs == 31 || Rd == Rn || Rd == Rs || Rn == Rs)
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = ARM64_INSTRUCTION_CPYFP + ((o0 * 3 + op1) * 16) + op2;
+
+    libarch_instruction_add_operand_register_with_fix_extra (instr, Rd, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO, '[', ']');
+    libarch_instruction_add_operand_register_with_fix_extra (instr, Rs, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO, '[', ']');
+    libarch_instruction_add_operand_register_with_fix_extra (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO, 0, 0);
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1098,8 +1216,12 @@ disass_load_and_store_instruction (instruction_t *instr)
      *  Load and Store Multiple structures
      *  Load and Store Single structures
      *  Load and Store Memory Tags
+     *  Compare and Swap Pair
      *  Load and Store Exclusive
-     *  LDAPR STLR
+     *  Load and Store Ordered
+     *  Compare and Swap
+     *  LDAPR STLR (Unscaled Immediate)
+     *  Memory Copy and Memory Set
      *  Load and Store Literal
      *  Load and store Register Pair
      *  
@@ -1120,21 +1242,41 @@ disass_load_and_store_instruction (instruction_t *instr)
             instr->subgroup = ARM64_DECODE_SUBGROUP_ADVANCED_SIMD_LOAD_STORE_SINGLE_STRUCT;
 
     } else if (op0 == 13 && op1 == 0 && (op2 >> 1) == 1 && (op3 >> 5) == 1) {
-        if (decode_load_store_memory_tags (&instr))
+        if (libarch_decode_has_feature (instr, LIBARCH_FEATURE_MTE) && decode_load_store_memory_tags (&instr))
             instr->subgroup = ARM64_DECODE_SUBGROUP_LOAD_STORE_MEMORY_TAGS;
 
+    } else if ((op0 & ~12) == 0 && op1 == 0 && op2 == 0 && (op3 >> 5) == 1) {
+        /* Compare and Swap Pair shares its encoding with the 32-bit exclusive pairs */
+        if ((op0 >> 3) == 0) {
+            if (libarch_decode_has_feature (instr, LIBARCH_FEATURE_LSE) &&
+                decode_compare_and_swap_pair (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+                instr->subgroup = ARM64_DECODE_SUBGROUP_COMPARE_AND_SWAP_PAIR;
+        } else {
+            if (decode_load_store_exclusive_pair (&instr))
+                instr->subgroup = ARM64_DECODE_SUBGROUP_LOAD_STORE_EXCL_PAIR;
+        }
+
+    } else if ((op0 & ~12) == 0 && op1 == 0 && op2 == 0 && (op3 >> 5) == 0) {
+        if (decode_load_store_exclusive_register (&instr))
+            instr->subgroup = ARM64_DECODE_SUBGROUP_LOAD_STORE_EXCL_REGISTER;
+
     } else if ((op0 & ~12) == 0 && op1 == 0 && op2 == 1 && (op3 >> 5) == 0) {
         if (decode_load_store_ordered (&instr))
             instr->subgroup = ARM64_DECODE_SUBGROUP_LOAD_STORE_ORDERED;
 
-    } else if ((op0 & ~12) == 0 && op1 == 0 && (op2 >> 1) == 0) {
-        if ((op3 >> 5) == 1) {
-            if (decode_load_store_exclusive_pair (&instr))
-                instr->subgroup = ARM64_DECODE_SUBGROUP_LOAD_STORE_EXCL_PAIR;
-        } else {
-            if (decode_load_store_exclusive_register (&instr))
-                instr->subgroup = ARM64_DECODE_SUBGROUP_LOAD_STORE_EXCL_REGISTER;
-        }
+    } else if ((op0 & ~12) == 0 && op1 == 0 && op2 == 1 && (op3 >> 5) == 1) {
+        if (libarch_decode_has_feature (instr, LIBARCH_FEATURE_LSE) &&
+            decode_compare_and_swap (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_COMPARE_AND_SWAP;
+
+    } else if ((op0 & ~12) == 1 && op1 == 0 && (op2 >> 1) == 1 && (op3 >> 5) == 0 && op4 == 0) {
+        if (decode_load_store_rcpc_unscaled (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_LOAD_STORE_RCPC_UNSCALED;
+
+    } else if ((op0 & ~12) == 1 && (op2 >> 1) == 1 && (op3 >> 5) == 0 && op4 == 1) {
+        if (libarch_decode_has_feature (instr, LIBARCH_FEATURE_MOPS) &&
+            decode_memory_copy_set (&instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = ARM64_DECODE_SUBGROUP_MEMORY_COPY_SET;
 
     } else if ((op0 & ~12) == 1 && (op2 >> 1) == 0) {
         if (decode_load_register_literal (&instr))
@@ -1147,25 +1289,21 @@ disass_load_and_store_instruction (instruction_t *instr)
     } else if ((op0 & ~12) == 3) {
         /* Unsigned Immediate */
         decode_status_t res;
+        unsigned subgroup = ARM64_DECODE_SUBGROUP_LOAD_REGISTER;
+
         if (op2 >> 1 == 1)
             res = decode_load_store_register (&instr, 1);
         else if ((op2 >> 1) == 0 && (op3 >> 5) == 1 && op4 == 2) 
             res = decode_load_store_register_reg_offset (&instr);
-        else if ((op2 >> 1) == 0 && (op3 >> 5) == 1 && op4 == 0)
+        else if ((op2 >> 1) == 0 && (op3 >> 5) == 1 && op4 == 0) {
             res = decode_atomic_memory_operation (&instr);
-        else
+            subgroup = ARM64_DECODE_SUBGROUP_ATOMIC_MEMORY_OPERATION;
+        } else
             res = decode_load_store_register (&instr, -1);
 
-        instr->subgroup = res;
-
-    } else {
-        /**
-         *  The following instruction subgroups have not been implemented:
-         *  - Compare and Swap
-         *  - LDAPR/STLR (Unscaled Immediate)
-         *  - Memory Copy and Memory Set
-         */
+        if (res == LIBARCH_DECODE_STATUS_SUCCESS)
+            instr->subgroup = subgroup;
     }
 
-    return LIBARCH_RETURN_SUCCESS;
+    return (instr->subgroup != ARM64_DECODE_SUBGROUP_UNKNOWN) ? LIBARCH_DECODE_STATUS_SUCCESS : LIBARCH_DECODE_STATUS_SOFT_FAIL;
 }
\ No newline at end of file
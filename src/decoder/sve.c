@@ -0,0 +1,1049 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <pthread.h>
+
+#include "decoder/sve.h"
+
+/******************************************************************************
+*       Decode Tables
+*******************************************************************************/
+
+/**
+ *  Operand layout of an SVE instruction. Unless noted, T is the element size
+ *  from size[22:23], Zd/Pd is [0:4], Zn [5:9], Zm [16:20] and Pg [10:12].
+ */
+typedef enum sve_form_t
+{
+    SVE_FORM_NONE = 0,
+
+    /* Integer and floating-point data processing */
+    SVE_FORM_ZDN_PG_ZM,         // Zdn.T, Pg/M, Zdn.T, Zm.T
+    SVE_FORM_ZDA_PG_ZN_ZM,      // Zda.T, Pg/M, Zn.T, Zm.T
+    SVE_FORM_ZDN_PG_ZM_ZA,      // Zdn.T, Pg/M, Zm.T, Za.T, Za is [5:9]
+    SVE_FORM_ZD_PG_ZN,          // Zd.T, Pg/M, Zn.T
+    SVE_FORM_ZDN_PG_SHIFT,      // Zdn.T, Pg/M, Zdn.T, #shift
+    SVE_FORM_VD_PG_ZN,          // Vd, Pg, Zn.T
+    SVE_FORM_ZD_ZN_ZM,          // Zd.T, Zn.T, Zm.T
+    SVE_FORM_ZD_ZN_SHIFT,       // Zd.T, Zn.T, #shift
+    SVE_FORM_ZD_ZN,             // Zd.T, Zn.T
+    SVE_FORM_ZDN_IMM,           // Zdn.T, Zdn.T, #imm{, lsl #8}
+    SVE_FORM_INDEX,             // Zd.T, <imm|Rn>, <imm|Rm>
+    SVE_FORM_ADR,               // Zd.T, [Zn.T, Zm.T{, <lsl|sxtw|uxtw> #msz}]
+    SVE_FORM_ZD_ZN_ZM_LONG,     // Zd.T, Zn.Tb, Zm.Tb, Tb is half the size of T
+    SVE_FORM_ZD_PG_ZN_ZM,       // Zd.T, Pg/Z, Zn.T, Zm.T
+
+    /* Scalar results */
+    SVE_FORM_XD_XN_IMM,         // Xd|SP, Xn|SP, #imm
+    SVE_FORM_XD_IMM,            // Xd, #imm
+    SVE_FORM_XD_PATTERN,        // Xd{, pattern{, mul #imm}}
+    SVE_FORM_XD_PG_PN,          // Xd, Pg, Pn.T
+
+    /* Predicates */
+    SVE_FORM_PD_PATTERN,        // Pd.T{, pattern}
+    SVE_FORM_PD,                // Pd.B
+    SVE_FORM_PD_RN_RM,          // Pd.T, Rn, Rm
+    SVE_FORM_PG_PN,             // Pg, Pn.B
+    SVE_FORM_PD_PG_PN_PM,       // Pd.B, Pg/Z, Pn.B, Pm.B
+    SVE_FORM_PD_PG_ZN_ZM,       // Pd.T, Pg/Z, Zn.T, Zm.T
+    SVE_FORM_PD_PG_ZN_SIMM,     // Pd.T, Pg/Z, Zn.T, #simm5
+    SVE_FORM_PD_PG_ZN_UIMM,     // Pd.T, Pg/Z, Zn.T, #uimm7
+
+    /* Moves and permutes */
+    SVE_FORM_DUP_IMM,           // Zd.T, #imm{, lsl #8}
+    SVE_FORM_FDUP,              // Zd.T, #fpimm
+    SVE_FORM_DUP_SCALAR,        // Zd.T, Rn|SP
+    SVE_FORM_DUP_INDEXED,       // Zd.T, Zn.T[imm]
+    SVE_FORM_CPY_IMM,           // Zd.T, Pg/<Z|M>, #imm{, lsl #8}, Pg is [16:19]
+    SVE_FORM_FCPY,              // Zd.T, Pg/M, #fpimm, Pg is [16:19]
+    SVE_FORM_CPY_SCALAR,        // Zd.T, Pg/M, Rn|SP
+    SVE_FORM_CPY_SIMD,          // Zd.T, Pg/M, Vn
+    SVE_FORM_EXT,               // Zdn.B, Zdn.B, Zm.B, #imm, Zm is [5:9]
+    SVE_FORM_SEL,               // Zd.T, Pg, Zn.T, Zm.T
+    SVE_FORM_MOVPRFX,           // Zd, Zn
+    SVE_FORM_TBL,               // Zd.T, { Zn.T }, Zm.T
+
+    /* Memory */
+    SVE_FORM_LD1_IMM,           // { Zt.T }, Pg/Z, [Xn|SP{, #imm, mul vl}]
+    SVE_FORM_LD1_REG,           // { Zt.T }, Pg/Z, [Xn|SP, Xm{, lsl #msize}]
+    SVE_FORM_ST1_IMM,           // { Zt.T }, Pg, [Xn|SP{, #imm, mul vl}]
+    SVE_FORM_ST1_REG,           // { Zt.T }, Pg, [Xn|SP, Xm{, lsl #msize}]
+    SVE_FORM_LDNF1_IMM,         // { Zt.T }, Pg/Z, [Xn|SP{, #imm, mul vl}]
+    SVE_FORM_LDFF1_REG,         // { Zt.T }, Pg/Z, [Xn|SP{, Xm{, lsl #msize}}]
+    SVE_FORM_LDN_IMM,           // { Zt1.T, .. }, Pg{/Z}, [Xn|SP{, #imm, mul vl}]
+    SVE_FORM_LDN_REG,           // { Zt1.T, .. }, Pg{/Z}, [Xn|SP, Xm{, lsl #msize}]
+    SVE_FORM_LDR_Z,             // Zt, [Xn|SP{, #imm, mul vl}]
+    SVE_FORM_LDR_P,             // Pt, [Xn|SP{, #imm, mul vl}]
+} sve_form_t;
+
+/* Smallest allocated element size, in the low two bits of the flags */
+#define SVE_MIN_H               1
+#define SVE_MIN_S               2
+#define SVE_ONLY_D              3
+#define SVE_MIN_SIZE(flags)     ((flags) & 3)
+
+#define SVE_NO_D                (1 << 2)    // 64-bit elements are reserved
+#define SVE_SVE2                (1 << 3)    // Requires LIBARCH_FEATURE_SVE2
+#define SVE_WIDE                (1 << 4)    // Reduction result is always 64-bit
+#define SVE_FIXED_D             (1 << 5)    // Elements are always 64-bit
+#define SVE_LEFT                (1 << 6)    // Left shift rather than right
+#define SVE_UNSIGNED            (1 << 7)    // Unsigned immediate
+
+/**
+ *  SVE decode table entry. An opcode matches when (opcode & mask) == value,
+ *  with the remaining bits decoded according to `form`.
+ */
+typedef struct sve_opcode_t
+{
+    uint32_t            mask;
+    uint32_t            value;
+    arm64_instr_t       type;
+    uint8_t             form;
+    uint8_t             subgroup;
+    uint8_t             flags;
+} sve_opcode_t;
+
+#define E(m, v, t, f, g, fl)    { m, v, ARM64_INSTRUCTION_##t, SVE_FORM_##f, ARM64_DECODE_SUBGROUP_SVE_##g, fl }
+
+static const sve_opcode_t sve_opcodes[] =
+{
+    /* Integer binary arithmetic, predicated */
+    E(0xff3fe000, 0x04000000, ADD,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04010000, SUB,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04030000, SUBR,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04080000, SMAX,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04090000, UMAX,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x040a0000, SMIN,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x040b0000, UMIN,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x040c0000, SABD,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x040d0000, UABD,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04100000, MUL,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04120000, SMULH,    ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04130000, UMULH,    ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04140000, SDIV,     ZDN_PG_ZM,          INTEGER_PREDICATED, SVE_MIN_S),
+    E(0xff3fe000, 0x04150000, UDIV,     ZDN_PG_ZM,          INTEGER_PREDICATED, SVE_MIN_S),
+    E(0xff3fe000, 0x04160000, SDIVR,    ZDN_PG_ZM,          INTEGER_PREDICATED, SVE_MIN_S),
+    E(0xff3fe000, 0x04170000, UDIVR,    ZDN_PG_ZM,          INTEGER_PREDICATED, SVE_MIN_S),
+    E(0xff3fe000, 0x04180000, ORR,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04190000, EOR,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x041a0000, AND,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x041b0000, BIC,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+
+    /* Integer reductions */
+    E(0xff3fe000, 0x04002000, SADDV,    VD_PG_ZN,           INTEGER_PREDICATED, SVE_WIDE | SVE_NO_D),
+    E(0xff3fe000, 0x04012000, UADDV,    VD_PG_ZN,           INTEGER_PREDICATED, SVE_WIDE),
+    E(0xff3fe000, 0x04082000, SMAXV,    VD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04092000, UMAXV,    VD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x040a2000, SMINV,    VD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x040b2000, UMINV,    VD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04182000, ORV,      VD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04192000, EORV,     VD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x041a2000, ANDV,     VD_PG_ZN,           INTEGER_PREDICATED, 0),
+
+    /* Integer multiply-add, predicated */
+    E(0xff20e000, 0x04004000, MLA,      ZDA_PG_ZN_ZM,       INTEGER_PREDICATED, 0),
+    E(0xff20e000, 0x04006000, MLS,      ZDA_PG_ZN_ZM,       INTEGER_PREDICATED, 0),
+    E(0xff20e000, 0x0400c000, MAD,      ZDN_PG_ZM_ZA,       INTEGER_PREDICATED, 0),
+    E(0xff20e000, 0x0400e000, MSB,      ZDN_PG_ZM_ZA,       INTEGER_PREDICATED, 0),
+
+    /* Bitwise shifts, predicated */
+    E(0xff3fe000, 0x04008000, ASR,      ZDN_PG_SHIFT,       INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04018000, LSR,      ZDN_PG_SHIFT,       INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04038000, LSL,      ZDN_PG_SHIFT,       INTEGER_PREDICATED, SVE_LEFT),
+    E(0xff3fe000, 0x04048000, ASRD,     ZDN_PG_SHIFT,       INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04108000, ASR,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04118000, LSR,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04138000, LSL,      ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04148000, ASRR,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04158000, LSRR,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x04178000, LSLR,     ZDN_PG_ZM,          INTEGER_PREDICATED, 0),
+
+    /* Integer unary operations, predicated */
+    E(0xff3fe000, 0x0410a000, SXTB,     ZD_PG_ZN,           INTEGER_PREDICATED, SVE_MIN_H),
+    E(0xff3fe000, 0x0411a000, UXTB,     ZD_PG_ZN,           INTEGER_PREDICATED, SVE_MIN_H),
+    E(0xff3fe000, 0x0412a000, SXTH,     ZD_PG_ZN,           INTEGER_PREDICATED, SVE_MIN_S),
+    E(0xff3fe000, 0x0413a000, UXTH,     ZD_PG_ZN,           INTEGER_PREDICATED, SVE_MIN_S),
+    E(0xff3fe000, 0x0414a000, SXTW,     ZD_PG_ZN,           INTEGER_PREDICATED, SVE_ONLY_D),
+    E(0xff3fe000, 0x0415a000, UXTW,     ZD_PG_ZN,           INTEGER_PREDICATED, SVE_ONLY_D),
+    E(0xff3fe000, 0x0416a000, ABS,      ZD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x0417a000, NEG,      ZD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x0418a000, CLS,      ZD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x0419a000, CLZ,      ZD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x041aa000, CNT,      ZD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x041ba000, CNOT,     ZD_PG_ZN,           INTEGER_PREDICATED, 0),
+    E(0xff3fe000, 0x041ca000, FABS,     ZD_PG_ZN,           INTEGER_PREDICATED, SVE_MIN_H),
+    E(0xff3fe000, 0x041da000, FNEG,     ZD_PG_ZN,           INTEGER_PREDICATED, SVE_MIN_H),
+    E(0xff3fe000, 0x041ea000, NOT,      ZD_PG_ZN,           INTEGER_PREDICATED, 0),
+
+    /* Integer arithmetic and logical, unpredicated */
+    E(0xff20fc00, 0x04200000, ADD,      ZD_ZN_ZM,           INTEGER_UNPREDICATED, 0),
+    E(0xff20fc00, 0x04200400, SUB,      ZD_ZN_ZM,           INTEGER_UNPREDICATED, 0),
+    E(0xff20fc00, 0x04201000, SQADD,    ZD_ZN_ZM,           INTEGER_UNPREDICATED, 0),
+    E(0xff20fc00, 0x04201400, UQADD,    ZD_ZN_ZM,           INTEGER_UNPREDICATED, 0),
+    E(0xff20fc00, 0x04201800, SQSUB,    ZD_ZN_ZM,           INTEGER_UNPREDICATED, 0),
+    E(0xff20fc00, 0x04201c00, UQSUB,    ZD_ZN_ZM,           INTEGER_UNPREDICATED, 0),
+    E(0xffe0fc00, 0x04203000, AND,      ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_FIXED_D),
+    E(0xffe0fc00, 0x04603000, ORR,      ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_FIXED_D),
+    E(0xffe0fc00, 0x04a03000, EOR,      ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_FIXED_D),
+    E(0xffe0fc00, 0x04e03000, BIC,      ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_FIXED_D),
+    E(0xff20fc00, 0x04206000, MUL,      ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_SVE2),
+    E(0xff20fc00, 0x04206400, PMUL,     ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_SVE2),
+    E(0xff20fc00, 0x04206800, SMULH,    ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_SVE2),
+    E(0xff20fc00, 0x04206c00, UMULH,    ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_SVE2),
+    E(0xff20fc00, 0x04209000, ASR,      ZD_ZN_SHIFT,        INTEGER_UNPREDICATED, 0),
+    E(0xff20fc00, 0x04209400, LSR,      ZD_ZN_SHIFT,        INTEGER_UNPREDICATED, 0),
+    E(0xff20fc00, 0x04209c00, LSL,      ZD_ZN_SHIFT,        INTEGER_UNPREDICATED, SVE_LEFT),
+    E(0xff20f000, 0x04204000, INDEX,    INDEX,              INTEGER_UNPREDICATED, 0),
+    E(0xff3fc000, 0x2520c000, ADD,      ZDN_IMM,            INTEGER_UNPREDICATED, SVE_UNSIGNED),
+    E(0xff3fc000, 0x2521c000, SUB,      ZDN_IMM,            INTEGER_UNPREDICATED, SVE_UNSIGNED),
+    E(0xff3fc000, 0x2523c000, SUBR,     ZDN_IMM,            INTEGER_UNPREDICATED, SVE_UNSIGNED),
+    E(0xff3fc000, 0x2524c000, SQADD,    ZDN_IMM,            INTEGER_UNPREDICATED, SVE_UNSIGNED),
+    E(0xff3fc000, 0x2525c000, UQADD,    ZDN_IMM,            INTEGER_UNPREDICATED, SVE_UNSIGNED),
+    E(0xff3fc000, 0x2526c000, SQSUB,    ZDN_IMM,            INTEGER_UNPREDICATED, SVE_UNSIGNED),
+    E(0xff3fc000, 0x2527c000, UQSUB,    ZDN_IMM,            INTEGER_UNPREDICATED, SVE_UNSIGNED),
+    E(0xffa0f000, 0x04a0a000, ADR,      ADR,                INTEGER_UNPREDICATED, 0),
+    E(0xffe0f000, 0x0420a000, ADR,      ADR,                INTEGER_UNPREDICATED, SVE_FIXED_D),
+    E(0xffe0f000, 0x0460a000, ADR,      ADR,                INTEGER_UNPREDICATED, SVE_FIXED_D),
+
+    /* SVE2 widening integer arithmetic, absolute difference and histogram */
+    E(0xff20fc00, 0x45000000, SADDLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45000400, SADDLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45000800, UADDLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45000c00, UADDLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45001000, SSUBLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45001400, SSUBLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45001800, USUBLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45001c00, USUBLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45003000, SABDLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45003400, SABDLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45003800, UABDLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45003c00, UABDLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45006000, SQDMULLB, ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45006400, SQDMULLT, ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45007000, SMULLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45007400, SMULLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45007800, UMULLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x45007c00, UMULLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x44004000, SMLALB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x44004400, SMLALT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x44004800, UMLALB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x44004c00, UMLALT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x44005000, SMLSLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x44005400, SMLSLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x44005800, UMLSLB,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x44005c00, UMLSLT,   ZD_ZN_ZM_LONG,      INTEGER_UNPREDICATED, SVE_MIN_H | SVE_SVE2),
+    E(0xff20fc00, 0x4500f800, SABA,     ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_SVE2),
+    E(0xff20fc00, 0x4500fc00, UABA,     ZD_ZN_ZM,           INTEGER_UNPREDICATED, SVE_SVE2),
+    E(0xff20e000, 0x4520c000, HISTCNT,  ZD_PG_ZN_ZM,        INTEGER_UNPREDICATED, SVE_MIN_S | SVE_SVE2),
+
+    /* Stack allocation */
+    E(0xffe0f800, 0x04205000, ADDVL,    XD_XN_IMM,          STACK_ALLOCATION, 0),
+    E(0xffe0f800, 0x04605000, ADDPL,    XD_XN_IMM,          STACK_ALLOCATION, 0),
+    E(0xfffff800, 0x04bf5000, RDVL,     XD_IMM,             STACK_ALLOCATION, 0),
+
+    /* Element count */
+    E(0xfff0fc00, 0x0420e000, CNTB,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x0460e000, CNTH,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x04a0e000, CNTW,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x04e0e000, CNTD,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x0430e000, INCB,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x0430e400, DECB,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x0470e000, INCH,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x0470e400, DECH,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x04b0e000, INCW,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x04b0e400, DECW,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x04f0e000, INCD,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xfff0fc00, 0x04f0e400, DECD,     XD_PATTERN,         ELEMENT_COUNT, 0),
+    E(0xff3fc200, 0x25208000, CNTP,     XD_PG_PN,           ELEMENT_COUNT, 0),
+
+    /* Predicate initialisation, logical operations and test */
+    E(0xff3ffc10, 0x2518e000, PTRUE,    PD_PATTERN,         PREDICATE, 0),
+    E(0xff3ffc10, 0x2519e000, PTRUES,   PD_PATTERN,         PREDICATE, 0),
+    E(0xfffffff0, 0x2518e400, PFALSE,   PD,                 PREDICATE, 0),
+    E(0xffffc21f, 0x2550c000, PTEST,    PG_PN,              PREDICATE, 0),
+    E(0xfff0c210, 0x25004000, AND,      PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25004010, BIC,      PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25004200, EOR,      PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25004210, SEL,      PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25404000, ANDS,     PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25404010, BICS,     PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25404200, EORS,     PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25804000, ORR,      PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25804010, ORN,      PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25804200, NOR,      PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25804210, NAND,     PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25c04000, ORRS,     PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25c04010, ORNS,     PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25c04200, NORS,     PD_PG_PN_PM,        PREDICATE, 0),
+    E(0xfff0c210, 0x25c04210, NANDS,    PD_PG_PN_PM,        PREDICATE, 0),
+
+    /* While */
+    E(0xff20ec10, 0x25200000, WHILEGE,  PD_RN_RM,           WHILE, SVE_SVE2),
+    E(0xff20ec10, 0x25200010, WHILEGT,  PD_RN_RM,           WHILE, SVE_SVE2),
+    E(0xff20ec10, 0x25200400, WHILELT,  PD_RN_RM,           WHILE, 0),
+    E(0xff20ec10, 0x25200410, WHILELE,  PD_RN_RM,           WHILE, 0),
+    E(0xff20ec10, 0x25200800, WHILEHS,  PD_RN_RM,           WHILE, SVE_SVE2),
+    E(0xff20ec10, 0x25200810, WHILEHI,  PD_RN_RM,           WHILE, SVE_SVE2),
+    E(0xff20ec10, 0x25200c00, WHILELO,  PD_RN_RM,           WHILE, 0),
+    E(0xff20ec10, 0x25200c10, WHILELS,  PD_RN_RM,           WHILE, 0),
+
+    /* Integer and floating-point compares */
+    E(0xff20e010, 0x24000000, CMPHS,    PD_PG_ZN_ZM,        COMPARE, 0),
+    E(0xff20e010, 0x24000010, CMPHI,    PD_PG_ZN_ZM,        COMPARE, 0),
+    E(0xff20e010, 0x24008000, CMPGE,    PD_PG_ZN_ZM,        COMPARE, 0),
+    E(0xff20e010, 0x24008010, CMPGT,    PD_PG_ZN_ZM,        COMPARE, 0),
+    E(0xff20e010, 0x2400a000, CMPEQ,    PD_PG_ZN_ZM,        COMPARE, 0),
+    E(0xff20e010, 0x2400a010, CMPNE,    PD_PG_ZN_ZM,        COMPARE, 0),
+    E(0xff20e010, 0x25000000, CMPGE,    PD_PG_ZN_SIMM,      COMPARE, 0),
+    E(0xff20e010, 0x25000010, CMPGT,    PD_PG_ZN_SIMM,      COMPARE, 0),
+    E(0xff20e010, 0x25002000, CMPLT,    PD_PG_ZN_SIMM,      COMPARE, 0),
+    E(0xff20e010, 0x25002010, CMPLE,    PD_PG_ZN_SIMM,      COMPARE, 0),
+    E(0xff20e010, 0x25008000, CMPEQ,    PD_PG_ZN_SIMM,      COMPARE, 0),
+    E(0xff20e010, 0x25008010, CMPNE,    PD_PG_ZN_SIMM,      COMPARE, 0),
+    E(0xff202010, 0x24200000, CMPHS,    PD_PG_ZN_UIMM,      COMPARE, 0),
+    E(0xff202010, 0x24200010, CMPHI,    PD_PG_ZN_UIMM,      COMPARE, 0),
+    E(0xff202010, 0x24202000, CMPLO,    PD_PG_ZN_UIMM,      COMPARE, 0),
+    E(0xff202010, 0x24202010, CMPLS,    PD_PG_ZN_UIMM,      COMPARE, 0),
+    E(0xff20e010, 0x65004000, FCMGE,    PD_PG_ZN_ZM,        COMPARE, SVE_MIN_H),
+    E(0xff20e010, 0x65004010, FCMGT,    PD_PG_ZN_ZM,        COMPARE, SVE_MIN_H),
+    E(0xff20e010, 0x65006000, FCMEQ,    PD_PG_ZN_ZM,        COMPARE, SVE_MIN_H),
+    E(0xff20e010, 0x65006010, FCMNE,    PD_PG_ZN_ZM,        COMPARE, SVE_MIN_H),
+    E(0xff20e010, 0x6500c000, FCMUO,    PD_PG_ZN_ZM,        COMPARE, SVE_MIN_H),
+    E(0xff20e010, 0x6500c010, FACGE,    PD_PG_ZN_ZM,        COMPARE, SVE_MIN_H),
+    E(0xff20e010, 0x6500e010, FACGT,    PD_PG_ZN_ZM,        COMPARE, SVE_MIN_H),
+
+    /* Moves and permutes */
+    E(0xff3fc000, 0x2538c000, MOV,      DUP_IMM,            PERMUTE, 0),
+    E(0xff3fe000, 0x2539c000, FMOV,     FDUP,               PERMUTE, SVE_MIN_H),
+    E(0xff3ffc00, 0x05203800, MOV,      DUP_SCALAR,         PERMUTE, 0),
+    E(0xff20fc00, 0x05202000, MOV,      DUP_INDEXED,        PERMUTE, 0),
+    E(0xff308000, 0x05100000, MOV,      CPY_IMM,            PERMUTE, 0),
+    E(0xff30e000, 0x0510c000, FMOV,     FCPY,               PERMUTE, SVE_MIN_H),
+    E(0xff3fe000, 0x0528a000, MOV,      CPY_SCALAR,         PERMUTE, 0),
+    E(0xff3fe000, 0x05208000, MOV,      CPY_SIMD,           PERMUTE, 0),
+    E(0xffe0e000, 0x05200000, EXT,      EXT,                PERMUTE, 0),
+    E(0xff20c000, 0x0520c000, SEL,      SEL,                PERMUTE, 0),
+    E(0xfffffc00, 0x0420bc00, MOVPRFX,  MOVPRFX,            PERMUTE, 0),
+    E(0xff20fc00, 0x05203000, TBL,      TBL,                PERMUTE, 0),
+    E(0xff3ffc00, 0x05383800, REV,      ZD_ZN,              PERMUTE, 0),
+    E(0xff20fc00, 0x05206000, ZIP1,     ZD_ZN_ZM,           PERMUTE, 0),
+    E(0xff20fc00, 0x05206400, ZIP2,     ZD_ZN_ZM,           PERMUTE, 0),
+    E(0xff20fc00, 0x05206800, UZP1,     ZD_ZN_ZM,           PERMUTE, 0),
+    E(0xff20fc00, 0x05206c00, UZP2,     ZD_ZN_ZM,           PERMUTE, 0),
+    E(0xff20fc00, 0x05207000, TRN1,     ZD_ZN_ZM,           PERMUTE, 0),
+    E(0xff20fc00, 0x05207400, TRN2,     ZD_ZN_ZM,           PERMUTE, 0),
+
+    /* Floating-point arithmetic */
+    E(0xff20fc00, 0x65000000, FADD,     ZD_ZN_ZM,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff20fc00, 0x65000400, FSUB,     ZD_ZN_ZM,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff20fc00, 0x65000800, FMUL,     ZD_ZN_ZM,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff20fc00, 0x65000c00, FTSMUL,   ZD_ZN_ZM,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff20fc00, 0x65001800, FRECPS,   ZD_ZN_ZM,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff20fc00, 0x65001c00, FRSQRTS,  ZD_ZN_ZM,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65008000, FADD,     ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65018000, FSUB,     ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65028000, FMUL,     ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65038000, FSUBR,    ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65048000, FMAXNM,   ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65058000, FMINNM,   ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65068000, FMAX,     ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65078000, FMIN,     ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65088000, FABD,     ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65098000, FSCALE,   ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x650a8000, FMULX,    ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x650c8000, FDIVR,    ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x650d8000, FDIV,     ZDN_PG_ZM,          FLOATING_POINT, SVE_MIN_H),
+    E(0xff20e000, 0x65200000, FMLA,     ZDA_PG_ZN_ZM,       FLOATING_POINT, SVE_MIN_H),
+    E(0xff20e000, 0x65202000, FMLS,     ZDA_PG_ZN_ZM,       FLOATING_POINT, SVE_MIN_H),
+    E(0xff20e000, 0x65204000, FNMLA,    ZDA_PG_ZN_ZM,       FLOATING_POINT, SVE_MIN_H),
+    E(0xff20e000, 0x65206000, FNMLS,    ZDA_PG_ZN_ZM,       FLOATING_POINT, SVE_MIN_H),
+    E(0xff20e000, 0x65208000, FMAD,     ZDA_PG_ZN_ZM,       FLOATING_POINT, SVE_MIN_H),
+    E(0xff20e000, 0x6520a000, FMSB,     ZDA_PG_ZN_ZM,       FLOATING_POINT, SVE_MIN_H),
+    E(0xff20e000, 0x6520c000, FNMAD,    ZDA_PG_ZN_ZM,       FLOATING_POINT, SVE_MIN_H),
+    E(0xff20e000, 0x6520e000, FNMSB,    ZDA_PG_ZN_ZM,       FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65002000, FADDV,    VD_PG_ZN,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65042000, FMAXNMV,  VD_PG_ZN,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65052000, FMINNMV,  VD_PG_ZN,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65062000, FMAXV,    VD_PG_ZN,           FLOATING_POINT, SVE_MIN_H),
+    E(0xff3fe000, 0x65072000, FMINV,    VD_PG_ZN,           FLOATING_POINT, SVE_MIN_H),
+
+    /* Floating-point conversions between elements of the same size */
+    E(0xffffe000, 0x6552a000, SCVTF,    ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x6553a000, UCVTF,    ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x655aa000, FCVTZS,   ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x655ba000, FCVTZU,   ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x6594a000, SCVTF,    ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x6595a000, UCVTF,    ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x659ca000, FCVTZS,   ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x659da000, FCVTZU,   ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x65d6a000, SCVTF,    ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x65d7a000, UCVTF,    ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x65dea000, FCVTZS,   ZD_PG_ZN,           FLOATING_POINT, 0),
+    E(0xffffe000, 0x65dfa000, FCVTZU,   ZD_PG_ZN,           FLOATING_POINT, 0),
+
+    /* Vector/predicate register fills and spills, then contiguous and structure loads and stores */
+    E(0xffc0e000, 0x85804000, LDR,      LDR_Z,              MEMORY, 0),
+    E(0xffc0e010, 0x85800000, LDR,      LDR_P,              MEMORY, 0),
+    E(0xffc0e000, 0xe5804000, STR,      LDR_Z,              MEMORY, 0),
+    E(0xffc0e010, 0xe5800000, STR,      LDR_P,              MEMORY, 0),
+    E(0xfe10e000, 0xa400a000, UNK,      LD1_IMM,            MEMORY, 0),
+    E(0xfe00e000, 0xa4004000, UNK,      LD1_REG,            MEMORY, 0),
+    E(0xfe10e000, 0xe400e000, UNK,      ST1_IMM,            MEMORY, 0),
+    E(0xfe00e000, 0xe4004000, UNK,      ST1_REG,            MEMORY, 0),
+    E(0xfe10e000, 0xa410a000, UNK,      LDNF1_IMM,          MEMORY, 0),
+    E(0xfe00e000, 0xa4006000, UNK,      LDFF1_REG,          MEMORY, 0),
+    E(0xfe10e000, 0xa400e000, UNK,      LDN_IMM,            MEMORY, 0),
+    E(0xfe00e000, 0xa400c000, UNK,      LDN_REG,            MEMORY, 0),
+    E(0xfe10e000, 0xe410e000, UNK,      LDN_IMM,            MEMORY, 0),
+    E(0xfe00e000, 0xe4006000, UNK,      LDN_REG,            MEMORY, 0),
+};
+
+#undef E
+
+#define SVE_OPCODES_LEN         (sizeof (sve_opcodes) / sizeof (*sve_opcodes))
+
+/* Element specifier for an element size, e.g. z1.s */
+static const int sve_element[5] =
+{
+    ARM64_VEC_ARRANGEMENT_B, ARM64_VEC_ARRANGEMENT_H,
+    ARM64_VEC_ARRANGEMENT_S, ARM64_VEC_ARRANGEMENT_D,
+    ARM64_VEC_ARRANGEMENT_Q,
+};
+
+/* Contiguous load mnemonics, for plain, first-fault and non-fault loads */
+enum { SVE_LD_B, SVE_LD_H, SVE_LD_W, SVE_LD_D, SVE_LD_SB, SVE_LD_SH, SVE_LD_SW };
+
+static const arm64_instr_t sve_ld1_type[3][7] =
+{
+    { ARM64_INSTRUCTION_LD1B, ARM64_INSTRUCTION_LD1H, ARM64_INSTRUCTION_LD1W, ARM64_INSTRUCTION_LD1D,
+      ARM64_INSTRUCTION_LD1SB, ARM64_INSTRUCTION_LD1SH, ARM64_INSTRUCTION_LD1SW },
+    { ARM64_INSTRUCTION_LDFF1B, ARM64_INSTRUCTION_LDFF1H, ARM64_INSTRUCTION_LDFF1W, ARM64_INSTRUCTION_LDFF1D,
+      ARM64_INSTRUCTION_LDFF1SB, ARM64_INSTRUCTION_LDFF1SH, ARM64_INSTRUCTION_LDFF1SW },
+    { ARM64_INSTRUCTION_LDNF1B, ARM64_INSTRUCTION_LDNF1H, ARM64_INSTRUCTION_LDNF1W, ARM64_INSTRUCTION_LDNF1D,
+      ARM64_INSTRUCTION_LDNF1SB, ARM64_INSTRUCTION_LDNF1SH, ARM64_INSTRUCTION_LDNF1SW },
+};
+
+/**
+ *  Contiguous load by dtype[21:24]: the mnemonic, element size and memory
+ *  access size. The sign-extending loads have msize < esize.
+ */
+static const struct { uint8_t load; uint8_t esize; uint8_t msize; } sve_ld1_dtype[16] =
+{
+    { SVE_LD_B, 0, 0 },     { SVE_LD_B, 1, 0 },     { SVE_LD_B, 2, 0 },     { SVE_LD_B, 3, 0 },
+    { SVE_LD_SW, 3, 2 },    { SVE_LD_H, 1, 1 },     { SVE_LD_H, 2, 1 },     { SVE_LD_H, 3, 1 },
+    { SVE_LD_SH, 3, 1 },    { SVE_LD_SH, 2, 1 },    { SVE_LD_W, 2, 2 },     { SVE_LD_W, 3, 2 },
+    { SVE_LD_SB, 3, 0 },    { SVE_LD_SB, 2, 0 },    { SVE_LD_SB, 1, 0 },    { SVE_LD_D, 3, 3 },
+};
+
+/* Contiguous store by msize[23:24] */
+static const arm64_instr_t sve_st1_msize[4] =
+{
+    ARM64_INSTRUCTION_ST1B, ARM64_INSTRUCTION_ST1H,
+    ARM64_INSTRUCTION_ST1W, ARM64_INSTRUCTION_ST1D,
+};
+
+/**
+ *  Non-temporal and structure loads and stores, by load/store, the register
+ *  count field [21:22] and msize[23:24]. A register count of zero is the
+ *  non-temporal form of the single register load or store.
+ */
+static const arm64_instr_t sve_ldn_type[2][4][4] =
+{
+    {
+        { ARM64_INSTRUCTION_LDNT1B, ARM64_INSTRUCTION_LDNT1H, ARM64_INSTRUCTION_LDNT1W, ARM64_INSTRUCTION_LDNT1D },
+        { ARM64_INSTRUCTION_LD2B, ARM64_INSTRUCTION_LD2H, ARM64_INSTRUCTION_LD2W, ARM64_INSTRUCTION_LD2D },
+        { ARM64_INSTRUCTION_LD3B, ARM64_INSTRUCTION_LD3H, ARM64_INSTRUCTION_LD3W, ARM64_INSTRUCTION_LD3D },
+        { ARM64_INSTRUCTION_LD4B, ARM64_INSTRUCTION_LD4H, ARM64_INSTRUCTION_LD4W, ARM64_INSTRUCTION_LD4D },
+    },
+    {
+        { ARM64_INSTRUCTION_STNT1B, ARM64_INSTRUCTION_STNT1H, ARM64_INSTRUCTION_STNT1W, ARM64_INSTRUCTION_STNT1D },
+        { ARM64_INSTRUCTION_ST2B, ARM64_INSTRUCTION_ST2H, ARM64_INSTRUCTION_ST2W, ARM64_INSTRUCTION_ST2D },
+        { ARM64_INSTRUCTION_ST3B, ARM64_INSTRUCTION_ST3H, ARM64_INSTRUCTION_ST3W, ARM64_INSTRUCTION_ST3D },
+        { ARM64_INSTRUCTION_ST4B, ARM64_INSTRUCTION_ST4H, ARM64_INSTRUCTION_ST4W, ARM64_INSTRUCTION_ST4D },
+    },
+};
+
+/******************************************************************************
+*       Decode Index
+*******************************************************************************/
+
+/**
+ *  Rather than scanning the whole opcode table for every instruction, the
+ *  table is bucketed by the bits that split the SVE encoding space the most:
+ *  [29:31], [21:24] and [13:15]. An entry is placed in every bucket its
+ *  mask and value are compatible with, so each lookup only tests the handful
+ *  of entries that could possibly match. The index is built once, on first
+ *  use, and never written again.
+ */
+#define SVE_INDEX_KEY_BITS      10
+#define SVE_INDEX_BUCKETS       (1 << SVE_INDEX_KEY_BITS)
+#define SVE_INDEX_MAX           2048
+
+static uint16_t         sve_index_start[SVE_INDEX_BUCKETS + 1];
+static uint16_t         sve_index_entries[SVE_INDEX_MAX];
+static pthread_once_t   sve_index_once = PTHREAD_ONCE_INIT;
+
+_Static_assert (SVE_OPCODES_LEN <= 65536, "sve_index_entries holds uint16_t table indexes");
+
+LIBARCH_PRIVATE LIBARCH_API
+unsigned
+_sve_index_key (uint32_t opcode)
+{
+    return (select_bits (opcode, 29, 31) << 7) | (select_bits (opcode, 21, 24) << 3) | select_bits (opcode, 13, 15);
+}
+
+/* Expand an index key back into the opcode bits it was built from */
+LIBARCH_PRIVATE LIBARCH_API
+uint32_t
+_sve_index_bits (unsigned key)
+{
+    return ((uint32_t) (key >> 7) << 29) | ((uint32_t) ((key >> 3) & 15) << 21) | ((uint32_t) (key & 7) << 13);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_sve_build_index (void)
+{
+    const uint32_t key_mask = _sve_index_bits (SVE_INDEX_BUCKETS - 1);
+    unsigned len = 0;
+
+    for (unsigned key = 0; key < SVE_INDEX_BUCKETS; key++) {
+        uint32_t bits = _sve_index_bits (key);
+
+        sve_index_start[key] = len;
+        for (unsigned i = 0; i < SVE_OPCODES_LEN; i++) {
+            const sve_opcode_t *op = &sve_opcodes[i];
+            if (((bits ^ op->value) & op->mask & key_mask) == 0 && len < SVE_INDEX_MAX)
+                sve_index_entries[len++] = i;
+        }
+    }
+    sve_index_start[SVE_INDEX_BUCKETS] = len;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+const sve_opcode_t *
+_sve_lookup (uint32_t opcode)
+{
+    unsigned key = _sve_index_key (opcode);
+
+    pthread_once (&sve_index_once, _sve_build_index);
+    for (unsigned i = sve_index_start[key]; i < sve_index_start[key + 1]; i++) {
+        const sve_opcode_t *op = &sve_opcodes[sve_index_entries[i]];
+        if ((opcode & op->mask) == op->value) return op;
+    }
+    return NULL;
+}
+
+/******************************************************************************
+*       Operand Helpers
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_z (instruction_t **instr, unsigned reg, unsigned esize)
+{
+    libarch_instruction_add_operand_scalable (instr, reg, sve_element[esize], -1, 0, 0);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_p (instruction_t **instr, unsigned reg, int esize, uint8_t qualifier)
+{
+    libarch_instruction_add_operand_predicate (instr, reg, (esize >= 0) ? sve_element[esize] : -1, qualifier);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_gp (instruction_t **instr, unsigned reg, unsigned width)
+{
+    libarch_instruction_add_operand_register (instr, reg, width, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_decimal (instruction_t **instr, int64_t imm)
+{
+    libarch_instruction_add_operand_immediate (instr, (uint64_t) imm, ARM64_IMMEDIATE_TYPE_INT, ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+}
+
+/**
+ *  \brief  Add a [Xn|SP, #imm, mul vl] address, leaving out the offset when
+ *          it's zero.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_add_address_mul_vl (instruction_t **instr, unsigned Rn, int imm)
+{
+    libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', (imm) ? 0 : ']');
+    if (!imm) return;
+
+    _add_decimal (instr, imm);
+    libarch_instruction_add_operand_extra_with_fix (instr, ARM64_OPERAND_TYPE_MUL_VL, 0, 0, ']');
+}
+
+/**
+ *  \brief  Element size of a shift by immediate from the tsz field, the
+ *          highest set bit. Returns -1 if tsz is zero, which is reserved.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_sve_shift_esize (unsigned tsz)
+{
+    for (int i = 3; i >= 0; i--)
+        if (tsz & (1 << i)) return i;
+    return -1;
+}
+
+/******************************************************************************
+*       Decoder
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+decode_status_t
+decode_sve_operands (instruction_t **instr, const sve_opcode_t *op)
+{
+    uint32_t opcode = (*instr)->opcode;
+    unsigned size = select_bits (opcode, 22, 23);
+    unsigned Rd = select_bits (opcode, 0, 4);
+    unsigned Rn = select_bits (opcode, 5, 9);
+    unsigned Rm = select_bits (opcode, 16, 20);
+    unsigned Pg = select_bits (opcode, 10, 12);
+
+    /* Add fields in left-right order */
+    libarch_instruction_add_field (instr, size);
+    libarch_instruction_add_field (instr, Rm);
+    libarch_instruction_add_field (instr, Pg);
+    libarch_instruction_add_field (instr, Rn);
+    libarch_instruction_add_field (instr, Rd);
+
+    if (size < SVE_MIN_SIZE (op->flags)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    if ((op->flags & SVE_NO_D) && size == 3) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    if (op->flags & SVE_FIXED_D) size = 3;
+    if (op->type == ARM64_INSTRUCTION_PMUL && size) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    (*instr)->type = op->type;
+
+    switch (op->form) {
+        case SVE_FORM_ZDN_PG_ZM:
+            _add_z (instr, Rd, size);
+            _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+            _add_z (instr, Rd, size);
+            _add_z (instr, Rn, size);
+            break;
+
+        case SVE_FORM_ZDA_PG_ZN_ZM:
+            _add_z (instr, Rd, size);
+            _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+            _add_z (instr, Rn, size);
+            _add_z (instr, Rm, size);
+            break;
+
+        case SVE_FORM_ZDN_PG_ZM_ZA:
+            _add_z (instr, Rd, size);
+            _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+            _add_z (instr, Rm, size);
+            _add_z (instr, Rn, size);
+            break;
+
+        case SVE_FORM_ZD_PG_ZN:
+            _add_z (instr, Rd, size);
+            _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+            _add_z (instr, Rn, size);
+            break;
+
+        case SVE_FORM_ZDN_PG_SHIFT:
+        case SVE_FORM_ZD_ZN_SHIFT: {
+            /* The element size and shift are both encoded in tsz:imm3 */
+            unsigned tszl = (op->form == SVE_FORM_ZDN_PG_SHIFT) ? select_bits (opcode, 8, 9) : select_bits (opcode, 19, 20);
+            unsigned imm3 = (op->form == SVE_FORM_ZDN_PG_SHIFT) ? select_bits (opcode, 5, 7) : select_bits (opcode, 16, 18);
+            unsigned imm = (((size << 2) | tszl) << 3) | imm3;
+            int esize = _sve_shift_esize ((size << 2) | tszl);
+
+            if (esize < 0) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+            _add_z (instr, Rd, esize);
+            if (op->form == SVE_FORM_ZDN_PG_SHIFT) {
+                _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+                _add_z (instr, Rd, esize);
+            } else {
+                _add_z (instr, Rn, esize);
+            }
+            _add_decimal (instr, (op->flags & SVE_LEFT) ? imm - (8 << esize) : (16 << esize) - imm);
+            break;
+        }
+
+        case SVE_FORM_VD_PG_ZN:
+            libarch_instruction_add_operand_register (instr, Rd, (op->flags & SVE_WIDE) ? 64 : 8 << size,
+                ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_REGISTER_OPERAND_OPT_NONE);
+            _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_z (instr, Rn, size);
+            break;
+
+        case SVE_FORM_ZD_ZN_ZM:
+            /* orr with the same source twice is the preferred disassembly of mov */
+            if (op->type == ARM64_INSTRUCTION_ORR && (op->flags & SVE_FIXED_D) && Rn == Rm) {
+                (*instr)->type = ARM64_INSTRUCTION_MOV;
+                _add_z (instr, Rd, size);
+                _add_z (instr, Rn, size);
+                break;
+            }
+            _add_z (instr, Rd, size);
+            _add_z (instr, Rn, size);
+            _add_z (instr, Rm, size);
+            break;
+
+        case SVE_FORM_ZD_ZN:
+            _add_z (instr, Rd, size);
+            _add_z (instr, Rn, size);
+            break;
+
+        case SVE_FORM_ZD_ZN_ZM_LONG:
+            _add_z (instr, Rd, size);
+            _add_z (instr, Rn, size - 1);
+            _add_z (instr, Rm, size - 1);
+            break;
+
+        case SVE_FORM_ZD_PG_ZN_ZM:
+            _add_z (instr, Rd, size);
+            _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_ZEROING);
+            _add_z (instr, Rn, size);
+            _add_z (instr, Rm, size);
+            break;
+
+        case SVE_FORM_ADR: {
+            /* Packed offsets take their element size from bit 22, unpacked ones are sign or zero-extended words */
+            unsigned msz = select_bits (opcode, 10, 11);
+            unsigned packed = select_bits (opcode, 23, 23);
+            unsigned esize = (packed) ? 2 + select_bits (opcode, 22, 22) : 3;
+
+            _add_z (instr, Rd, esize);
+            libarch_instruction_add_operand_scalable (instr, Rn, sve_element[esize], -1, '[', 0);
+            libarch_instruction_add_operand_scalable (instr, Rm, sve_element[esize], -1, 0, (packed && !msz) ? ']' : 0);
+            if (!packed)
+                libarch_instruction_add_operand_extend_with_fix (instr, select_bits (opcode, 22, 22) ? ARM64_INDEX_EXTEND_UXTW : ARM64_INDEX_EXTEND_SXTW,
+                    (msz) ? (int) msz : -1, 0, ']');
+            else if (msz)
+                libarch_instruction_add_operand_shift_with_fix (instr, msz, ARM64_SHIFT_TYPE_LSL, 0, ']');
+            break;
+        }
+
+        case SVE_FORM_ZDN_IMM:
+        case SVE_FORM_DUP_IMM:
+        case SVE_FORM_CPY_IMM: {
+            unsigned sh = select_bits (opcode, 13, 13);
+            unsigned imm8 = select_bits (opcode, 5, 12);
+
+            /* Byte elements cannot be shifted */
+            if (size == 0 && sh) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+            _add_z (instr, Rd, size);
+            if (op->form == SVE_FORM_ZDN_IMM) _add_z (instr, Rd, size);
+            if (op->form == SVE_FORM_CPY_IMM)
+                _add_p (instr, select_bits (opcode, 16, 19), -1,
+                    select_bits (opcode, 14, 14) ? ARM64_PREDICATE_QUALIFIER_MERGING : ARM64_PREDICATE_QUALIFIER_ZEROING);
+            _add_decimal (instr, (op->flags & SVE_UNSIGNED) ? (int) imm8 : (int) arm64_sign_extend (imm8, 8));
+            if (sh) libarch_instruction_add_operand_shift (instr, 8, ARM64_SHIFT_TYPE_LSL);
+            break;
+        }
+
+        case SVE_FORM_FDUP:
+        case SVE_FORM_FCPY:
+            _add_z (instr, Rd, size);
+            if (op->form == SVE_FORM_FCPY) _add_p (instr, select_bits (opcode, 16, 19), -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+            libarch_instruction_add_operand_immediate (instr, arm64_fp_expand_imm (select_bits (opcode, 5, 12)),
+                ARM64_IMMEDIATE_TYPE_FLOAT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+            break;
+
+        case SVE_FORM_INDEX: {
+            /* Bits [10:11] select an immediate or register for each operand */
+            unsigned mode = select_bits (opcode, 10, 11);
+            unsigned width = (size == 3) ? 64 : 32;
+
+            _add_z (instr, Rd, size);
+            if (mode & 1) _add_gp (instr, Rn, width);
+            else _add_decimal (instr, (int) arm64_sign_extend (Rn, 5));
+            if (mode & 2) _add_gp (instr, Rm, width);
+            else _add_decimal (instr, (int) arm64_sign_extend (Rm, 5));
+            break;
+        }
+
+        case SVE_FORM_XD_XN_IMM:
+            libarch_instruction_add_operand_register (instr, Rd, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+            libarch_instruction_add_operand_register (instr, Rm, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+            _add_decimal (instr, (int) arm64_sign_extend (select_bits (opcode, 5, 10), 6));
+            break;
+
+        case SVE_FORM_XD_IMM:
+            _add_gp (instr, Rd, 64);
+            _add_decimal (instr, (int) arm64_sign_extend (select_bits (opcode, 5, 10), 6));
+            break;
+
+        case SVE_FORM_XD_PATTERN: {
+            /* The pattern and multiplier are left out when they're the defaults */
+            unsigned mul = select_bits (opcode, 16, 19) + 1;
+
+            _add_gp (instr, Rd, 64);
+            if (Rn != ARM64_SVE_PATTERN_ALL || mul > 1)
+                libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_SVE_PATTERN, Rn);
+            if (mul > 1)
+                libarch_instruction_add_operand_shift (instr, mul, ARM64_SHIFT_TYPE_MUL);
+            break;
+        }
+
+        case SVE_FORM_XD_PG_PN:
+            _add_gp (instr, Rd, 64);
+            _add_p (instr, select_bits (opcode, 10, 13), -1, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_p (instr, select_bits (opcode, 5, 8), size, ARM64_PREDICATE_QUALIFIER_NONE);
+            break;
+
+        case SVE_FORM_PD_PATTERN:
+            _add_p (instr, Rd, size, ARM64_PREDICATE_QUALIFIER_NONE);
+            if (Rn != ARM64_SVE_PATTERN_ALL)
+                libarch_instruction_add_operand_extra (instr, ARM64_OPERAND_TYPE_SVE_PATTERN, Rn);
+            break;
+
+        case SVE_FORM_PD:
+            _add_p (instr, Rd, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+            break;
+
+        case SVE_FORM_PD_RN_RM: {
+            unsigned width = select_bits (opcode, 12, 12) ? 64 : 32;
+
+            _add_p (instr, Rd, size, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_gp (instr, Rn, width);
+            _add_gp (instr, Rm, width);
+            break;
+        }
+
+        case SVE_FORM_PG_PN:
+            _add_p (instr, select_bits (opcode, 10, 13), -1, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_p (instr, select_bits (opcode, 5, 8), 0, ARM64_PREDICATE_QUALIFIER_NONE);
+            break;
+
+        case SVE_FORM_PD_PG_PN_PM: {
+            unsigned Pd = select_bits (opcode, 0, 3);
+            unsigned Pn = select_bits (opcode, 5, 8);
+            unsigned Pm = select_bits (opcode, 16, 19);
+            unsigned Pg4 = select_bits (opcode, 10, 13);
+
+            /* orr{s} of a predicate with itself is the preferred disassembly of mov{s} */
+            if ((op->type == ARM64_INSTRUCTION_ORR || op->type == ARM64_INSTRUCTION_ORRS) && Pn == Pm && Pn == Pg4) {
+                (*instr)->type = (op->type == ARM64_INSTRUCTION_ORR) ? ARM64_INSTRUCTION_MOV : ARM64_INSTRUCTION_MOVS;
+                _add_p (instr, Pd, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+                _add_p (instr, Pn, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+                break;
+            }
+
+            /* and{s} with itself is mov{s}, eor{s} with the governing predicate is not{s} */
+            if (((op->type == ARM64_INSTRUCTION_AND || op->type == ARM64_INSTRUCTION_ANDS) && Pn == Pm) ||
+                ((op->type == ARM64_INSTRUCTION_EOR || op->type == ARM64_INSTRUCTION_EORS) && Pm == Pg4)) {
+                switch (op->type) {
+                    case ARM64_INSTRUCTION_AND: (*instr)->type = ARM64_INSTRUCTION_MOV; break;
+                    case ARM64_INSTRUCTION_ANDS: (*instr)->type = ARM64_INSTRUCTION_MOVS; break;
+                    case ARM64_INSTRUCTION_EOR: (*instr)->type = ARM64_INSTRUCTION_NOT; break;
+                    default: (*instr)->type = ARM64_INSTRUCTION_NOTS; break;
+                }
+                _add_p (instr, Pd, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+                _add_p (instr, Pg4, -1, ARM64_PREDICATE_QUALIFIER_ZEROING);
+                _add_p (instr, Pn, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+                break;
+            }
+
+            /* sel with the destination as the second source is mov, merging */
+            if (op->type == ARM64_INSTRUCTION_SEL && Pd == Pm) {
+                (*instr)->type = ARM64_INSTRUCTION_MOV;
+                _add_p (instr, Pd, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+                _add_p (instr, Pg4, -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+                _add_p (instr, Pn, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+                break;
+            }
+
+            _add_p (instr, Pd, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_p (instr, Pg4, -1, (op->type == ARM64_INSTRUCTION_SEL) ? ARM64_PREDICATE_QUALIFIER_NONE : ARM64_PREDICATE_QUALIFIER_ZEROING);
+            _add_p (instr, Pn, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_p (instr, Pm, 0, ARM64_PREDICATE_QUALIFIER_NONE);
+            break;
+        }
+
+        case SVE_FORM_PD_PG_ZN_ZM:
+        case SVE_FORM_PD_PG_ZN_SIMM:
+        case SVE_FORM_PD_PG_ZN_UIMM:
+            _add_p (instr, select_bits (opcode, 0, 3), size, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_ZEROING);
+            _add_z (instr, Rn, size);
+
+            if (op->form == SVE_FORM_PD_PG_ZN_ZM) _add_z (instr, Rm, size);
+            else if (op->form == SVE_FORM_PD_PG_ZN_SIMM) _add_decimal (instr, (int) arm64_sign_extend (Rm, 5));
+            else _add_decimal (instr, select_bits (opcode, 14, 20));
+            break;
+
+        case SVE_FORM_DUP_SCALAR:
+            _add_z (instr, Rd, size);
+            libarch_instruction_add_operand_register (instr, Rn, (size == 3) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+            break;
+
+        case SVE_FORM_CPY_SCALAR:
+        case SVE_FORM_CPY_SIMD:
+            _add_z (instr, Rd, size);
+            _add_p (instr, Pg, -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+            if (op->form == SVE_FORM_CPY_SCALAR)
+                libarch_instruction_add_operand_register (instr, Rn, (size == 3) ? 64 : 32, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+            else
+                libarch_instruction_add_operand_register (instr, Rn, 8 << size, ARM64_REGISTER_TYPE_FLOATING_POINT, ARM64_REGISTER_OPERAND_OPT_NONE);
+            break;
+
+        case SVE_FORM_EXT:
+            _add_z (instr, Rd, 0);
+            _add_z (instr, Rd, 0);
+            _add_z (instr, Rn, 0);
+            _add_decimal (instr, (Rm << 3) | select_bits (opcode, 10, 12));
+            break;
+
+        case SVE_FORM_DUP_INDEXED: {
+            /* The lowest set bit of tsz gives the element size, the bits above it the index */
+            unsigned imm = (size << 5) | Rm;
+            int esize = 0;
+
+            if (!Rm) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            while (!(Rm & (1 << esize))) esize++;
+
+            libarch_instruction_add_operand_scalable (instr, Rd, sve_element[esize], -1, 0, 0);
+            libarch_instruction_add_operand_scalable (instr, Rn, sve_element[esize], imm >> (esize + 1), 0, 0);
+            break;
+        }
+
+        case SVE_FORM_SEL: {
+            unsigned Pg4 = select_bits (opcode, 10, 13);
+
+            /* sel with the destination as the second source is the preferred disassembly of mov */
+            if (Rd == Rm) {
+                (*instr)->type = ARM64_INSTRUCTION_MOV;
+                _add_z (instr, Rd, size);
+                _add_p (instr, Pg4, -1, ARM64_PREDICATE_QUALIFIER_MERGING);
+                _add_z (instr, Rn, size);
+                break;
+            }
+
+            _add_z (instr, Rd, size);
+            _add_p (instr, Pg4, -1, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_z (instr, Rn, size);
+            _add_z (instr, Rm, size);
+            break;
+        }
+
+        case SVE_FORM_MOVPRFX:
+            libarch_instruction_add_operand_scalable (instr, Rd, -1, -1, 0, 0);
+            libarch_instruction_add_operand_scalable (instr, Rn, -1, -1, 0, 0);
+            break;
+
+        case SVE_FORM_TBL:
+            _add_z (instr, Rd, size);
+            libarch_instruction_add_operand_scalable (instr, Rn, sve_element[size], -1, '{', '}');
+            _add_z (instr, Rm, size);
+            break;
+
+        case SVE_FORM_LD1_IMM:
+        case SVE_FORM_LD1_REG:
+        case SVE_FORM_ST1_IMM:
+        case SVE_FORM_ST1_REG:
+        case SVE_FORM_LDNF1_IMM:
+        case SVE_FORM_LDFF1_REG:
+        case SVE_FORM_LDN_IMM:
+        case SVE_FORM_LDN_REG: {
+            /* Loads and stores differ only in bit 30 */
+            unsigned load = !select_bits (opcode, 30, 30);
+            unsigned dtype = select_bits (opcode, 21, 24);
+            unsigned imm_offset = (op->form == SVE_FORM_LD1_IMM || op->form == SVE_FORM_ST1_IMM ||
+                                   op->form == SVE_FORM_LDNF1_IMM || op->form == SVE_FORM_LDN_IMM);
+            unsigned esize, msize, nregs = 1;
+
+            /* A register offset of XZR is reserved, other than for first-fault loads */
+            if (!imm_offset && op->form != SVE_FORM_LDFF1_REG && Rm == 31)
+                return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+            if (op->form == SVE_FORM_LDN_IMM || op->form == SVE_FORM_LDN_REG) {
+                (*instr)->type = sve_ldn_type[!load][dtype & 3][dtype >> 2];
+                esize = msize = dtype >> 2;
+                nregs = (dtype & 3) ? (dtype & 3) + 1 : 1;
+            } else if (load) {
+                unsigned kind = (op->form == SVE_FORM_LDFF1_REG) ? 1 : (op->form == SVE_FORM_LDNF1_IMM) ? 2 : 0;
+                (*instr)->type = sve_ld1_type[kind][sve_ld1_dtype[dtype].load];
+                esize = sve_ld1_dtype[dtype].esize;
+                msize = sve_ld1_dtype[dtype].msize;
+            } else {
+                (*instr)->type = sve_st1_msize[dtype >> 2];
+                esize = dtype & 3;
+                msize = dtype >> 2;
+                if (esize < msize) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+            }
+
+            /* Register lists wrap around from z31 to z0 */
+            for (unsigned i = 0; i < nregs; i++)
+                libarch_instruction_add_operand_scalable (instr, (Rd + i) & 31, sve_element[esize], -1,
+                    (i == 0) ? '{' : 0, (i == nregs - 1) ? '}' : 0);
+            _add_p (instr, Pg, -1, (load) ? ARM64_PREDICATE_QUALIFIER_ZEROING : ARM64_PREDICATE_QUALIFIER_NONE);
+
+            /* Immediate offsets count whole register lists */
+            if (imm_offset) {
+                _add_address_mul_vl (instr, Rn, (int) arm64_sign_extend (select_bits (opcode, 16, 19), 4) * (int) nregs);
+                break;
+            }
+
+            /* Register offsets are scaled by the access size */
+            libarch_instruction_add_operand_register_with_fix (instr, Rn, 64, ARM64_REGISTER_TYPE_GENERAL, '[', (Rm == 31) ? ']' : 0);
+            if (Rm == 31) break;
+            libarch_instruction_add_operand_register_with_fix (instr, Rm, 64, ARM64_REGISTER_TYPE_GENERAL, 0, (msize) ? 0 : ']');
+            if (msize) libarch_instruction_add_operand_shift_with_fix (instr, msize, ARM64_SHIFT_TYPE_LSL, 0, ']');
+            break;
+        }
+
+        case SVE_FORM_LDR_Z:
+        case SVE_FORM_LDR_P: {
+            int imm = (int) arm64_sign_extend ((select_bits (opcode, 16, 21) << 3) | select_bits (opcode, 10, 12), 9);
+
+            if (op->form == SVE_FORM_LDR_Z) libarch_instruction_add_operand_scalable (instr, Rd, -1, -1, 0, 0);
+            else _add_p (instr, select_bits (opcode, 0, 3), -1, ARM64_PREDICATE_QUALIFIER_NONE);
+            _add_address_mul_vl (instr, Rn, imm);
+            break;
+        }
+
+        default:
+            (*instr)->type = ARM64_INSTRUCTION_UNK;
+            return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    }
+
+    return LIBARCH_DECODE_STATUS_SUCCESS;
+}
+
+LIBARCH_API
+decode_status_t
+disass_sve_instruction (instruction_t *instr)
+{
+    const sve_opcode_t *op;
+
+    if (!libarch_decode_has_feature (instr, LIBARCH_FEATURE_SVE)) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    op = _sve_lookup (instr->opcode);
+    if (!op) return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    if ((op->flags & SVE_SVE2) && !libarch_decode_has_feature (instr, LIBARCH_FEATURE_SVE2))
+        return LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    if (decode_sve_operands (&instr, op) == LIBARCH_DECODE_STATUS_SUCCESS)
+        instr->subgroup = op->subgroup;
+    else
+        instr->type = ARM64_INSTRUCTION_UNK;
+
+    return (instr->subgroup != ARM64_DECODE_SUBGROUP_UNKNOWN) ? LIBARCH_DECODE_STATUS_SUCCESS : LIBARCH_DECODE_STATUS_SOFT_FAIL;
+}
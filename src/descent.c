@@ -0,0 +1,554 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "descent.h"
+#include "instruction.h"
+
+#include "arm64/arm64-instructions.h"
+
+/**
+ *  Descent runs basic blocks, decoding from a block start until control flow
+ *  can't fall through, and pushing every branch and call target as a new
+ *  block start. Each thread keeps it's block starts in a Chase-Lev deque: the
+ *  owner pushes and takes at the bottom, so it works depth-first through
+ *  nearby code, and idle threads steal the oldest entries from the top.
+ *
+ *  Instructions are claimed by atomically setting their bit in the code
+ *  bitmap before they're decoded, so when two paths reach the same address
+ *  only one of them carries on. `pending` counts blocks that have been pushed
+ *  but not finished, and the threads stop once it reaches zero.
+ */
+
+/* Initial deque size, in block starts. Deques grow as needed */
+#define DESCENT_DEQUE_SIZE      1024
+
+/* Deque results other than a block start */
+#define DESCENT_EMPTY           UINT64_MAX
+#define DESCENT_ABORT           (UINT64_MAX - 1)
+
+#define BIT_WORD(i)             ((i) >> 6)
+#define BIT_MASK(i)             (1ULL << ((i) & 63))
+
+/* Deque storage. Replaced buffers are kept, as a thief may still read them */
+typedef struct deque_buf_t
+{
+    struct deque_buf_t     *prev;
+    int64_t                 size;
+    _Atomic uint64_t        items[];
+} deque_buf_t;
+
+typedef struct descent_deque_t
+{
+    _Alignas (64) atomic_llong      top;
+    _Alignas (64) atomic_llong      bottom;
+    _Atomic (deque_buf_t *)         buf;
+} descent_deque_t;
+
+typedef struct descent_job_t
+{
+    libarch_descent_t  *descent;
+    descent_deque_t    *deques;
+    unsigned            workers;
+
+    atomic_size_t       pending;
+    atomic_size_t       instructions;
+    atomic_size_t       functions;
+    atomic_int          failed;
+} descent_job_t;
+
+typedef struct descent_worker_t
+{
+    descent_job_t      *job;
+    unsigned            id;
+    uint64_t            rng;
+
+    /* The instructions up to a `br`, decoded to look for a jump table */
+    instruction_t      *window[LIBARCH_JUMPTABLE_WINDOW + 1];
+
+    /* Jump tables found, added to the descent at the end */
+    libarch_jumptable_t    *tables;
+    size_t                  tables_len;
+    size_t                  tables_cap;
+} descent_worker_t;
+
+
+/******************************************************************************
+*       Work-stealing Deque
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+deque_buf_t *
+_deque_buf_create (int64_t size, deque_buf_t *prev)
+{
+    deque_buf_t *buf = malloc (sizeof (deque_buf_t) + size * sizeof (uint64_t));
+    if (!buf) return NULL;
+    buf->prev = prev;
+    buf->size = size;
+    return buf;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_deque_init (descent_deque_t *deque)
+{
+    deque_buf_t *buf = _deque_buf_create (DESCENT_DEQUE_SIZE, NULL);
+    if (!buf) return LIBARCH_RETURN_FAILURE;
+
+    atomic_init (&deque->top, 0);
+    atomic_init (&deque->bottom, 0);
+    atomic_init (&deque->buf, buf);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_deque_free (descent_deque_t *deque)
+{
+    deque_buf_t *buf = atomic_load (&deque->buf);
+    while (buf) {
+        deque_buf_t *prev = buf->prev;
+        free (buf);
+        buf = prev;
+    }
+}
+
+/* Push at the bottom. Only called by the deque's owner */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_deque_push (descent_deque_t *deque, uint64_t item)
+{
+    int64_t b = atomic_load_explicit (&deque->bottom, memory_order_relaxed);
+    int64_t t = atomic_load_explicit (&deque->top, memory_order_acquire);
+    deque_buf_t *buf = atomic_load_explicit (&deque->buf, memory_order_relaxed);
+
+    if (b - t >= buf->size) {
+        deque_buf_t *grown = _deque_buf_create (buf->size * 2, buf);
+        if (!grown) return LIBARCH_RETURN_FAILURE;
+
+        for (int64_t i = t; i < b; i++)
+            atomic_store_explicit (&grown->items[i & (grown->size - 1)],
+                atomic_load_explicit (&buf->items[i & (buf->size - 1)], memory_order_relaxed),
+                memory_order_relaxed);
+        atomic_store_explicit (&deque->buf, grown, memory_order_release);
+        buf = grown;
+    }
+
+    atomic_store_explicit (&buf->items[b & (buf->size - 1)], item, memory_order_relaxed);
+    atomic_thread_fence (memory_order_release);
+    atomic_store_explicit (&deque->bottom, b + 1, memory_order_relaxed);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+/* Take from the bottom. Only called by the deque's owner */
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_deque_take (descent_deque_t *deque)
+{
+    int64_t b = atomic_load_explicit (&deque->bottom, memory_order_relaxed) - 1;
+    deque_buf_t *buf = atomic_load_explicit (&deque->buf, memory_order_relaxed);
+    uint64_t item = DESCENT_EMPTY;
+    int64_t t;
+
+    atomic_store_explicit (&deque->bottom, b, memory_order_relaxed);
+    atomic_thread_fence (memory_order_seq_cst);
+    t = atomic_load_explicit (&deque->top, memory_order_relaxed);
+
+    if (t <= b) {
+        item = atomic_load_explicit (&buf->items[b & (buf->size - 1)], memory_order_relaxed);
+
+        /* The last item, which a thief may be taking at the same time */
+        if (t == b) {
+            if (!atomic_compare_exchange_strong_explicit (&deque->top, &t, t + 1,
+                    memory_order_seq_cst, memory_order_relaxed))
+                item = DESCENT_EMPTY;
+            atomic_store_explicit (&deque->bottom, b + 1, memory_order_relaxed);
+        }
+    } else {
+        atomic_store_explicit (&deque->bottom, b + 1, memory_order_relaxed);
+    }
+    return item;
+}
+
+/* Steal from the top. Returns DESCENT_ABORT if another thread got there first */
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_deque_steal (descent_deque_t *deque)
+{
+    int64_t t = atomic_load_explicit (&deque->top, memory_order_acquire);
+    atomic_thread_fence (memory_order_seq_cst);
+    int64_t b = atomic_load_explicit (&deque->bottom, memory_order_acquire);
+
+    if (t >= b) return DESCENT_EMPTY;
+
+    deque_buf_t *buf = atomic_load_explicit (&deque->buf, memory_order_acquire);
+    uint64_t item = atomic_load_explicit (&buf->items[t & (buf->size - 1)], memory_order_relaxed);
+
+    if (!atomic_compare_exchange_strong_explicit (&deque->top, &t, t + 1,
+            memory_order_seq_cst, memory_order_relaxed))
+        return DESCENT_ABORT;
+    return item;
+}
+
+
+/******************************************************************************
+*       Descent
+*******************************************************************************/
+
+/* Set bit `i`. Returns non-zero if it was clear, i.e. this thread claimed it */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_claim (uint64_t *bitmap, size_t i)
+{
+    return !(__atomic_fetch_or (&bitmap[BIT_WORD (i)], BIT_MASK (i), __ATOMIC_RELAXED) & BIT_MASK (i));
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+int
+_test (const uint64_t *bitmap, size_t i)
+{
+    return !!(__atomic_load_n (&bitmap[BIT_WORD (i)], __ATOMIC_RELAXED) & BIT_MASK (i));
+}
+
+/* Queue the block at `addr` on this worker's deque, if it's in the image */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_push_target (descent_worker_t *w, uint64_t addr, int call)
+{
+    libarch_descent_t *d = w->job->descent;
+    uint64_t i = (addr - d->addr) / 4;
+
+    if (addr < d->addr || ((addr - d->addr) & 3) || i >= d->len) return;
+
+    if (call && _claim (d->functions, i)) atomic_fetch_add_explicit (&w->job->functions, 1, memory_order_relaxed);
+    if (_test (d->code, i)) return;
+
+    /* Count it first, so `pending` can't reach zero while it's queued */
+    atomic_fetch_add_explicit (&w->job->pending, 1, memory_order_relaxed);
+    if (!_deque_push (&w->job->deques[w->id], i)) {
+        atomic_fetch_sub_explicit (&w->job->pending, 1, memory_order_relaxed);
+        atomic_store (&w->job->failed, 1);
+    }
+}
+
+/* Address of a pc-relative branch's target, always it's last operand */
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_target (const instruction_t *instr)
+{
+    return libarch_operand_get_immediate (libarch_instruction_get_operand (instr, instr->operands_len - 1));
+}
+
+/* Decode the words up to the `br` at `i`, and follow it's jump table, if any */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_follow_jumptable (descent_worker_t *w, size_t i)
+{
+    libarch_descent_t *d = w->job->descent;
+    size_t first = (i > LIBARCH_JUMPTABLE_WINDOW) ? i - LIBARCH_JUMPTABLE_WINDOW : 0;
+    uint64_t targets[256];
+    libarch_jumptable_t table;
+    size_t n = 0;
+
+    for (size_t k = first; k <= i; k++) {
+        libarch_instruction_reset (w->window[n], d->opcodes[k], d->addr + k * 4);
+        libarch_disass_ctx (w->window[n]->ctx, &w->window[n]);
+        n++;
+    }
+    if (!libarch_jumptable_recover (w->window, n, &table)) return;
+
+    if (w->tables_len == w->tables_cap) {
+        size_t cap = (w->tables_cap) ? w->tables_cap * 2 : 16;
+        libarch_jumptable_t *tables = realloc (w->tables, cap * sizeof (libarch_jumptable_t));
+        if (!tables) {
+            atomic_store (&w->job->failed, 1);
+            return;
+        }
+        w->tables = tables;
+        w->tables_cap = cap;
+    }
+    w->tables[w->tables_len++] = table;
+
+    /* Read the entries in chunks, as tables can be large */
+    for (uint32_t done = 0; done < table.count;) {
+        libarch_jumptable_t chunk = table;
+        chunk.table += (uint64_t) done * table.entry_size;
+        chunk.count = table.count - done;
+
+        size_t got = libarch_jumptable_targets (&chunk, d->opcodes, d->addr, d->len, targets, 256);
+        for (size_t k = 0; k < got; k++) _push_target (w, targets[k], 0);
+        if (got < 256) break;
+        done += got;
+    }
+}
+
+/**
+ *  Follow an instruction's control flow, pushing any targets. Returns non-zero
+ *  if execution can fall through to the next instruction.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_follow (descent_worker_t *w, const instruction_t *instr, size_t i)
+{
+    if (instr->group != ARM64_DECODE_GROUP_BRANCH_EXCEPTION_SYSREG) return 1;
+
+    switch (instr->subgroup) {
+        case ARM64_DECODE_SUBGROUP_CONDITIONAL_BRANCH:
+        case ARM64_DECODE_SUBGROUP_COMPARE_AND_BRANCH_IMMEDIATE:
+        case ARM64_DECODE_SUBGROUP_TEST_AND_BRANCH_IMMEDIATE:
+            _push_target (w, _target (instr), 0);
+            return 1;
+
+        case ARM64_DECODE_SUBGROUP_UNCONDITIONAL_BRANCH_IMMEDIATE:
+            _push_target (w, _target (instr), instr->type == ARM64_INSTRUCTION_BL);
+            return instr->type == ARM64_INSTRUCTION_BL;
+
+        /* Calls return, everything else (br, ret, eret, ...) doesn't */
+        case ARM64_DECODE_SUBGROUP_UNCONDITIONAL_BRANCH_REGISTER:
+            if (instr->type == ARM64_INSTRUCTION_BR) _follow_jumptable (w, i);
+            return instr->type == ARM64_INSTRUCTION_BLR ||
+                   instr->type == ARM64_INSTRUCTION_BLRAA || instr->type == ARM64_INSTRUCTION_BLRAAZ ||
+                   instr->type == ARM64_INSTRUCTION_BLRAB || instr->type == ARM64_INSTRUCTION_BLRABZ;
+
+        /* A brk is how compilers end a path that can't return */
+        case ARM64_DECODE_SUBGROUP_EXCEPTION_GENERATION:
+            return instr->type != ARM64_INSTRUCTION_BRK;
+    }
+    return 1;
+}
+
+/* Decode from block start `i` until control flow stops, or reaches code that
+   another path has already claimed */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_run_block (descent_worker_t *w, instruction_t **instr, size_t i)
+{
+    libarch_descent_t *d = w->job->descent;
+    size_t count = 0;
+
+    for (; i < d->len && _claim (d->code, i); i++) {
+        libarch_instruction_reset (*instr, d->opcodes[i], d->addr + i * 4);
+        libarch_disass_ctx ((*instr)->ctx, instr);
+
+        /* Not an instruction, so give the word back */
+        if ((*instr)->type == ARM64_INSTRUCTION_UNK || (*instr)->type == ARM64_INSTRUCTION_UDF) {
+            __atomic_fetch_and (&d->code[BIT_WORD (i)], ~BIT_MASK (i), __ATOMIC_RELAXED);
+            break;
+        }
+
+        count++;
+        if (!_follow (w, *instr, i)) break;
+    }
+    atomic_fetch_add_explicit (&w->job->instructions, count, memory_order_relaxed);
+}
+
+/* Steal a block start from any other worker, starting at a random one */
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_steal (descent_worker_t *w)
+{
+    descent_job_t *job = w->job;
+
+    w->rng ^= w->rng << 13;
+    w->rng ^= w->rng >> 7;
+    w->rng ^= w->rng << 17;
+
+    for (unsigned n = 0, v = w->rng % job->workers; n < job->workers; n++, v = (v + 1) % job->workers) {
+        if (v == w->id) continue;
+
+        uint64_t item = _deque_steal (&job->deques[v]);
+        if (item != DESCENT_EMPTY && item != DESCENT_ABORT) return item;
+    }
+    return DESCENT_EMPTY;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void *
+_descent_worker (void *arg)
+{
+    descent_worker_t *w = (descent_worker_t *) arg;
+    descent_job_t *job = w->job;
+    instruction_t *instr;
+    libarch_ctx_t ctx;
+
+    /* Aliases don't change control flow, so don't spend time picking them */
+    libarch_ctx_init (&ctx);
+    ctx.options |= LIBARCH_OPT_RAW;
+
+    /* Without records, leave the work for the other threads to steal */
+    int ok = !!(instr = libarch_instruction_create_ctx (&ctx, 0, 0));
+    for (unsigned k = 0; k <= LIBARCH_JUMPTABLE_WINDOW; k++)
+        if (!(w->window[k] = libarch_instruction_create_ctx (&ctx, 0, 0))) ok = 0;
+    if (!ok) atomic_store (&job->failed, 1);
+
+    while (ok && atomic_load (&job->pending)) {
+        uint64_t i = _deque_take (&job->deques[w->id]);
+        if (i == DESCENT_EMPTY) i = _steal (w);
+        if (i == DESCENT_EMPTY) {
+            sched_yield ();
+            continue;
+        }
+
+        _run_block (w, &instr, i);
+        atomic_fetch_sub (&job->pending, 1);
+    }
+
+    for (unsigned k = 0; k <= LIBARCH_JUMPTABLE_WINDOW; k++)
+        if (w->window[k]) libarch_instruction_free (w->window[k]);
+    if (instr) libarch_instruction_free (instr);
+    libarch_ctx_cleanup (&ctx);
+    return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+libarch_return_t
+libarch_descent_init (libarch_descent_t *descent, const uint32_t *opcodes, uint64_t addr, size_t len)
+{
+    size_t words = BIT_WORD (len) + 1;
+
+    memset (descent, 0, sizeof (libarch_descent_t));
+    descent->opcodes = opcodes;
+    descent->addr = addr;
+    descent->len = len;
+    descent->code = calloc (words, sizeof (uint64_t));
+    descent->functions = calloc (words, sizeof (uint64_t));
+
+    if (!descent->code || !descent->functions) {
+        libarch_descent_free (descent);
+        return LIBARCH_RETURN_FAILURE;
+    }
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_descent_run (libarch_descent_t *descent, const uint64_t *entries, size_t count, const libarch_symtab_t *symtab, unsigned threads)
+{
+    descent_job_t job = { .descent = descent };
+    descent_worker_t *workers;
+    pthread_t *tids;
+    unsigned started = 0, ready = 0;
+
+    atomic_init (&job.pending, 0);
+    atomic_init (&job.instructions, 0);
+    atomic_init (&job.functions, 0);
+    atomic_init (&job.failed, 0);
+
+    if (!threads) {
+        long cpus = sysconf (_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (unsigned) cpus : 1;
+    }
+
+    job.workers = threads;
+    job.deques = aligned_alloc (_Alignof (descent_deque_t), threads * sizeof (descent_deque_t));
+    workers = calloc (threads, sizeof (descent_worker_t));
+    tids = calloc (threads, sizeof (pthread_t));
+
+    while (job.deques && ready < threads && _deque_init (&job.deques[ready])) ready++;
+    if (!workers || !tids || ready < threads) {
+        atomic_store (&job.failed, 1);
+        goto done;
+    }
+
+    for (unsigned i = 0; i < threads; i++) {
+        workers[i].job = &job;
+        workers[i].id = i;
+        workers[i].rng = 0x9e3779b97f4a7c15ULL * (i + 1);
+    }
+
+    /* Deal the entry points out between the workers, before they start */
+    for (size_t i = 0; i < count; i++)
+        _push_target (&workers[i % threads], entries[i], 1);
+    for (size_t i = 0; symtab && symtab->finalised && i < symtab->len; i++)
+        _push_target (&workers[(count + i) % threads], symtab->symbols[i].addr, 1);
+
+    /**
+     *  The calling thread is worker 0, so if any of the threads can't be
+     *  created, the descent still finishes with fewer. Their deques are
+     *  stolen from like any other.
+     */
+    for (unsigned i = 1; i < threads; i++)
+        if (!pthread_create (&tids[started], NULL, _descent_worker, &workers[i])) started++;
+
+    _descent_worker (&workers[0]);
+
+    for (unsigned i = 0; i < started; i++)
+        pthread_join (tids[i], NULL);
+
+    descent->instructions += atomic_load (&job.instructions);
+    descent->function_count += atomic_load (&job.functions);
+
+    /* Gather the jump tables each worker found */
+    for (unsigned i = 0; i < threads; i++) {
+        if (!workers[i].tables_len) continue;
+
+        libarch_jumptable_t *tables = realloc (descent->tables,
+            (descent->tables_len + workers[i].tables_len) * sizeof (libarch_jumptable_t));
+        if (!tables) {
+            atomic_store (&job.failed, 1);
+            break;
+        }
+        memcpy (tables + descent->tables_len, workers[i].tables, workers[i].tables_len * sizeof (libarch_jumptable_t));
+        descent->tables = tables;
+        descent->tables_len += workers[i].tables_len;
+    }
+
+done:
+    for (unsigned i = 0; i < ready; i++) _deque_free (&job.deques[i]);
+    for (unsigned i = 0; workers && i < threads; i++) free (workers[i].tables);
+    free (job.deques);
+    free (workers);
+    free (tids);
+    return (atomic_load (&job.failed)) ? LIBARCH_RETURN_FAILURE : LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+int
+libarch_descent_is_code (const libarch_descent_t *descent, uint64_t addr)
+{
+    uint64_t i = (addr - descent->addr) / 4;
+    if (addr < descent->addr || ((addr - descent->addr) & 3) || i >= descent->len) return 0;
+    return _test (descent->code, i);
+}
+
+
+LIBARCH_API
+int
+libarch_descent_is_function (const libarch_descent_t *descent, uint64_t addr)
+{
+    uint64_t i = (addr - descent->addr) / 4;
+    if (addr < descent->addr || ((addr - descent->addr) & 3) || i >= descent->len) return 0;
+    return _test (descent->functions, i);
+}
+
+
+LIBARCH_API
+void
+libarch_descent_free (libarch_descent_t *descent)
+{
+    free (descent->code);
+    free (descent->functions);
+    free (descent->tables);
+    memset (descent, 0, sizeof (libarch_descent_t));
+}
@@ -0,0 +1,369 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "format.h"
+#include "alias.h"
+#include "register.h"
+
+#include "arm64/arm64-conditions.h"
+#include "arm64/arm64-index-extend.h"
+#include "arm64/arm64-instructions.h"
+#include "arm64/arm64-prefetch-ops.h"
+#include "arm64/arm64-pstate.h"
+#include "arm64/arm64-sve-patterns.h"
+#include "arm64/arm64-registers.h"
+#include "arm64/arm64-tlbi-ops.h"
+#include "arm64/arm64-translation.h"
+#include "arm64/arm64-vector-specifiers.h"
+
+/**
+ *  \brief  Output buffer state. `pos` keeps counting past the end of the
+ *          buffer so the total length can be returned, like snprintf.
+ */
+typedef struct format_buf_t
+{
+    char       *buf;
+    size_t      len;
+    size_t      pos;
+} format_buf_t;
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_format_append (format_buf_t *out, const char *fmt, ...)
+{
+    va_list args;
+    size_t avail = (out->pos < out->len) ? out->len - out->pos : 0;
+
+    va_start (args, fmt);
+    int n = vsnprintf ((avail) ? out->buf + out->pos : NULL, avail, fmt, args);
+    va_end (args);
+
+    if (n > 0) out->pos += n;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_format_char (format_buf_t *out, char c)
+{
+    if (!c) return;
+    if (out->pos + 1 < out->len) {
+        out->buf[out->pos] = c;
+        out->buf[out->pos + 1] = '\0';
+    }
+    out->pos++;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+const char *
+_format_register_name (const operand_t *op)
+{
+    arm64_reg_t reg = libarch_operand_get_register (op);
+    uint8_t size = libarch_operand_get_register_size (op);
+
+    switch (libarch_operand_get_register_type (op)) {
+        case ARM64_REGISTER_TYPE_SYSTEM:
+            return libarch_get_system_register (reg);
+
+        case ARM64_REGISTER_TYPE_GENERAL:
+            if (size == 64) return libarch_get_general_register (reg, A64_REGISTERS_GP_64, A64_REGISTERS_GP_64_LEN);
+            return libarch_get_general_register (reg, A64_REGISTERS_GP_32, A64_REGISTERS_GP_32_LEN);
+
+        case ARM64_REGISTER_TYPE_FLOATING_POINT:
+            if (size == 8) return libarch_get_general_register (reg, A64_REGISTERS_FP_8, A64_REGISTERS_FP_8_LEN);
+            if (size == 16) return libarch_get_general_register (reg, A64_REGISTERS_FP_16, A64_REGISTERS_FP_16_LEN);
+            if (size == 32) return libarch_get_general_register (reg, A64_REGISTERS_FP_32, A64_REGISTERS_FP_32_LEN);
+            if (size == 64) return libarch_get_general_register (reg, A64_REGISTERS_FP_64, A64_REGISTERS_FP_64_LEN);
+            return libarch_get_general_register (reg, A64_REGISTERS_FP_Q, A64_REGISTERS_FP_Q_LEN);
+
+        case ARM64_REGISTER_TYPE_VECTOR:
+            return libarch_get_general_register (reg, A64_REGISTERS_FP_128, A64_REGISTERS_FP_128_LEN);
+
+        case ARM64_REGISTER_TYPE_SCALABLE_VECTOR:
+            return libarch_get_general_register (reg, A64_REGISTERS_SVE_Z, A64_REGISTERS_SVE_Z_LEN);
+
+        case ARM64_REGISTER_TYPE_PREDICATE:
+            return libarch_get_general_register (reg, A64_REGISTERS_SVE_P, A64_REGISTERS_SVE_P_LEN);
+
+        default:
+            return "unk";
+    }
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_format_register (format_buf_t *out, const operand_t *op)
+{
+    const char *name = _format_register_name (op);
+
+    _format_char (out, libarch_operand_get_prefix (op));
+    if (name) {
+        _format_append (out, "%s", name);
+    } else {
+        /* Unnamed system register, use the generic S<op0>_<op1>_C<n>_C<m>_<op2> form */
+        arm64_reg_t reg = libarch_operand_get_register (op);
+        _format_append (out, "s%d_%d_c%d_c%d_%d", (reg >> 14) & 3, (reg >> 11) & 7,
+            (reg >> 7) & 15, (reg >> 3) & 15, reg & 7);
+    }
+    _format_char (out, libarch_operand_get_suffix (op));
+    _format_char (out, libarch_operand_get_suffix_extra (op));
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_format_vector (format_buf_t *out, const operand_t *op)
+{
+    int arrangement = libarch_operand_get_arrangement (op);
+    int index = libarch_operand_get_index (op);
+
+    _format_char (out, libarch_operand_get_prefix (op));
+    _format_append (out, "%s", _format_register_name (op));
+    if (arrangement >= 0) _format_append (out, ".%s", A64_VEC_SPECIFIER_STR[arrangement]);
+
+    /* Governing predicates, e.g. p0/m */
+    switch (libarch_operand_get_predicate_qualifier (op)) {
+        case ARM64_PREDICATE_QUALIFIER_MERGING: _format_append (out, "/m"); break;
+        case ARM64_PREDICATE_QUALIFIER_ZEROING: _format_append (out, "/z"); break;
+    }
+
+    _format_char (out, libarch_operand_get_suffix (op));
+    if (index >= 0) _format_append (out, "[%d]", index);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_format_float (format_buf_t *out, uint64_t bits)
+{
+    char tmp[32];
+    double val;
+
+    /* Float immediates are stored as the bit pattern of a double */
+    memcpy (&val, &bits, sizeof (val));
+    snprintf (tmp, sizeof (tmp), "%g", val);
+
+    /* Always print a decimal point, e.g. #1.0 rather than #1 */
+    _format_append (out, "%s%s", tmp, strpbrk (tmp, ".en") ? "" : ".0");
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_format_immediate (format_buf_t *out, const libarch_ctx_t *ctx, const instruction_t *instr, const operand_t *op)
+{
+    uint64_t imm = libarch_operand_get_immediate (op);
+    uint8_t type = libarch_operand_get_immediate_type (op);
+    int is_long = (type == ARM64_IMMEDIATE_TYPE_LONG || type == ARM64_IMMEDIATE_TYPE_ULONG);
+    int decimal = (libarch_operand_get_immediate_opts (op) == ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL);
+
+    /* Context options override the operand's own preference */
+    if (ctx->options & LIBARCH_OPT_IMMEDIATE_DECIMAL) decimal = 1;
+    if (ctx->options & LIBARCH_OPT_IMMEDIATE_HEX) decimal = 0;
+
+    _format_char (out, libarch_operand_get_prefix (op));
+
+    if (type == ARM64_IMMEDIATE_TYPE_FLOAT)
+        _format_float (out, imm);
+    else if (type == ARM64_IMMEDIATE_TYPE_SYSC)
+        _format_append (out, "c%d", (int) imm);
+    else if (type == ARM64_IMMEDIATE_TYPE_SYSS)
+        _format_append (out, "s%d", (int) imm);
+    else if (instr->type == ARM64_INSTRUCTION_SYS || instr->type == ARM64_INSTRUCTION_SYSL)
+        _format_append (out, "%d", (int) imm);
+    else if (decimal && is_long)
+        _format_append (out, "%" PRId64, (int64_t) imm);
+    else if (decimal)
+        _format_append (out, "%d", (int) imm);
+    else if (is_long)
+        _format_append (out, "0x%" PRIx64, imm);
+    else
+        _format_append (out, "0x%x", (uint32_t) imm);
+
+    _format_char (out, libarch_operand_get_suffix (op));
+    _format_char (out, libarch_operand_get_suffix_extra (op));
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_format_shift (format_buf_t *out, const operand_t *op)
+{
+    const char *shift;
+
+    switch (libarch_operand_get_shift_type (op)) {
+        case ARM64_SHIFT_TYPE_LSL: shift = "lsl"; break;
+        case ARM64_SHIFT_TYPE_LSR: shift = "lsr"; break;
+        case ARM64_SHIFT_TYPE_ASR: shift = "asr"; break;
+        case ARM64_SHIFT_TYPE_ROR: shift = "ror"; break;
+        case ARM64_SHIFT_TYPE_MSL: shift = "msl"; break;
+        case ARM64_SHIFT_TYPE_MUL: shift = "mul"; break;
+        default: return;
+    }
+
+    _format_char (out, libarch_operand_get_prefix (op));
+    _format_append (out, "%s #%d", shift, libarch_operand_get_shift (op));
+    _format_char (out, libarch_operand_get_suffix (op));
+}
+
+/* Append the symbol for a target address, e.g. " <main+0x10>", if it has one */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_format_symbol (format_buf_t *out, const libarch_ctx_t *ctx, uint64_t addr)
+{
+    uint64_t offset = 0;
+    const char *name;
+
+    if (!(name = ctx->symbolizer (ctx->symbolizer_arg, addr, &offset))) return;
+
+    if (offset) _format_append (out, " <%s+0x%" PRIx64 ">", name, offset);
+    else _format_append (out, " <%s>", name);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+size_t
+libarch_format_instruction (const libarch_ctx_t *ctx, const instruction_t *instr, char *buf, size_t len)
+{
+    format_buf_t out = { buf, len, 0 };
+    if (len) buf[0] = '\0';
+    if (!ctx) ctx = libarch_ctx_default ();
+
+    /**
+     *  A raw instruction is formatted as it's alias unless the format context
+     *  is raw too. The alias is picked on a copy, which only ever loses
+     *  operands, so the instruction itself is left as it is.
+     */
+    instruction_t alias;
+    operand_t alias_operands[LIBARCH_ALIAS_MAX_OPERANDS];
+
+    if (instr->raw && !(ctx->options & LIBARCH_OPT_RAW) && instr->operands_len <= LIBARCH_ALIAS_MAX_OPERANDS) {
+        alias = *instr;
+        alias.operands = alias_operands;
+        /* operands may be NULL when there are none, and memcpy from NULL is undefined even for 0 bytes */
+        if (instr->operands_len) memcpy (alias_operands, instr->operands, instr->operands_len * sizeof (operand_t));
+        libarch_alias_instruction (&alias);
+        instr = &alias;
+    }
+
+    /* A run of identical instructions, e.g. "... 4096 x nop" */
+    if (instr->run > 1 && (ctx->options & LIBARCH_OPT_COLLAPSE_RUNS))
+        _format_append (&out, "... %" PRIu32 " x ", instr->run);
+
+    /* Handle Mnemonic */
+    const char *mnemonic = A64_INSTRUCTIONS_STR[instr->type];
+    if (instr->cond != -1) _format_append (&out, "%s.%s\t", mnemonic, A64_CONDITIONS_STR[instr->cond]);
+    else if (instr->spec != -1) _format_append (&out, "%s.%s\t", mnemonic, A64_VEC_SPECIFIER_STR[instr->spec]);
+    else _format_append (&out, "%s\t", mnemonic);
+
+    /* Handle Operands */
+    for (uint32_t i = 0; i < instr->operands_len; i++) {
+        const operand_t *op = libarch_instruction_get_operand (instr, i);
+        int extra = libarch_operand_get_extra (op);
+
+        switch (libarch_operand_get_type (op)) {
+            case ARM64_OPERAND_TYPE_REGISTER:
+                if (libarch_operand_get_register_type (op) >= ARM64_REGISTER_TYPE_VECTOR)
+                    _format_vector (&out, op);
+                else
+                    _format_register (&out, op);
+                break;
+
+            case ARM64_OPERAND_TYPE_IMMEDIATE:
+                _format_immediate (&out, ctx, instr, op);
+                break;
+
+            case ARM64_OPERAND_TYPE_SHIFT:
+                _format_shift (&out, op);
+                break;
+
+            case ARM64_OPERAND_TYPE_TARGET:
+                if (libarch_operand_get_target (op))
+                    _format_append (&out, "%s", libarch_operand_get_target (op));
+                break;
+
+            case ARM64_OPERAND_TYPE_PSTATE:
+                _format_append (&out, "%s", A64_PSTATE_STR[extra]);
+                break;
+
+            case ARM64_OPERAND_TYPE_AT_NAME:
+                _format_append (&out, "%s", A64_AT_NAMES_STR[extra]);
+                break;
+
+            case ARM64_OPERAND_TYPE_TLBI_OP:
+                _format_append (&out, "%s", A64_TLBI_OPS_STR[extra]);
+                break;
+
+            case ARM64_OPERAND_TYPE_PRFOP:
+                _format_append (&out, "%s", A64_PRFOP_STR[extra]);
+                break;
+
+            case ARM64_OPERAND_TYPE_MEMORY_BARRIER:
+                _format_append (&out, "%s", A64_MEM_BARRIER_CONDITIONS_STR[extra]);
+                break;
+
+            case ARM64_OPERAND_TYPE_CONDITION:
+                _format_append (&out, "%s", A64_CONDITIONS_STR[extra]);
+                break;
+
+            case ARM64_OPERAND_TYPE_SVE_PATTERN:
+                _format_append (&out, "%s", A64_SVE_PATTERN_STR[extra & 31]);
+                break;
+
+            case ARM64_OPERAND_TYPE_MUL_VL:
+                _format_char (&out, libarch_operand_get_prefix (op));
+                _format_append (&out, "mul vl");
+                _format_char (&out, libarch_operand_get_suffix (op));
+                break;
+
+            case ARM64_OPERAND_TYPE_INDEX_EXTEND:
+                _format_char (&out, libarch_operand_get_prefix (op));
+                _format_append (&out, "%s", A64_INDEX_EXTEND_STR[extra]);
+                if (libarch_operand_get_extra_val (op) >= 0)
+                    _format_append (&out, " #%d", libarch_operand_get_extra_val (op));
+                _format_char (&out, libarch_operand_get_suffix (op));
+                break;
+        }
+
+        if (i < instr->operands_len - 1) _format_append (&out, ", ");
+    }
+
+    /* Name the target, if there's a symbolizer */
+    if (ctx->symbolizer && instr->operands_len && libarch_instruction_is_pc_relative (instr)) {
+        const operand_t *op = libarch_instruction_get_operand (instr, instr->operands_len - 1);
+        if (libarch_operand_get_type (op) == ARM64_OPERAND_TYPE_IMMEDIATE)
+            _format_symbol (&out, ctx, libarch_operand_get_immediate (op));
+    }
+
+    return out.pos;
+}
+
+LIBARCH_API
+size_t
+libarch_format_data (const libarch_ctx_t *ctx, uint64_t value, unsigned size, char *buf, size_t len)
+{
+    format_buf_t out = { buf, len, 0 };
+    if (len) buf[0] = '\0';
+    if (!ctx) ctx = libarch_ctx_default ();
+
+    if (size == 8) {
+        _format_append (&out, ".quad\t0x%016" PRIx64, value);
+        if (ctx->symbolizer) _format_symbol (&out, ctx, value);
+    } else {
+        _format_append (&out, ".word\t0x%08" PRIx32, (uint32_t) value);
+    }
+    return out.pos;
+}
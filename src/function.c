@@ -0,0 +1,593 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "function.h"
+#include "jumptable.h"
+
+#include "arm64/arm64-common.h"
+#include "arm64/arm64-instructions.h"
+
+/**
+ *  A function is hashed in two passes. The first reduces each instruction to
+ *  a token and it's control flow, so the instruction records can be released
+ *  straight away. The second splits the tokens into basic blocks and hashes
+ *  each block along with it's successors, given as the distance in blocks
+ *  rather than an address.
+ *
+ *  A `br` through a jump table ends a block with an edge to each case, so
+ *  switch statements hash as the graph they are rather than a dead end.
+ */
+
+/* Control flow kinds */
+#define FLOW_NONE               0
+#define FLOW_BRANCH             1
+#define FLOW_CONDITIONAL        2
+#define FLOW_CALL               3
+#define FLOW_INDIRECT           4
+#define FLOW_RETURN             5
+#define FLOW_SWITCH             6
+
+/* Successor code for a branch that leaves the function, e.g. a tail call */
+#define EDGE_EXTERNAL           0x8000000000000000ULL
+
+/* Number of functions a thread takes from the shared counter at once */
+#define HASH_BATCH              16
+
+typedef struct flow_t
+{
+    uint64_t        token;
+    int64_t         target;         // Index of the branch target, or -1
+    uint32_t        cases;          // Number of switch cases, from `target`
+    uint8_t         kind;
+} flow_t;
+
+/* Per-thread scratch space, reused between functions */
+typedef struct hash_scratch_t
+{
+    flow_t         *flows;
+    uint32_t       *blocks;         // Block number of each instruction
+    size_t          cap;
+
+    /* Switch case indexes, referred to by FLOW_SWITCH flows */
+    uint32_t       *cases;
+    size_t          cases_len;
+    size_t          cases_cap;
+
+    /* The last few instructions decoded, to look for jump tables */
+    instruction_t  *window[LIBARCH_JUMPTABLE_WINDOW + 1];
+} hash_scratch_t;
+
+
+/******************************************************************************
+*       Hashing
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_mix (uint64_t h, uint64_t v)
+{
+    h = (h ^ v) * 0x9e3779b97f4a7c15ULL;
+    return h ^ (h >> 29);
+}
+
+/* Hash an instruction's type and operand kinds, leaving out anything that
+   depends on register allocation or the address */
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_token (const instruction_t *instr)
+{
+    uint64_t h = _mix (0, instr->type);
+
+    /* Data, or something the decoder doesn't know. Keep the raw bits */
+    if (instr->type == ARM64_INSTRUCTION_UNK) return _mix (h, instr->opcode);
+
+    h = _mix (h, (uint32_t) instr->cond);
+    h = _mix (h, (uint32_t) instr->spec);
+
+    for (uint32_t i = 0; i < instr->operands_len; i++) {
+        const operand_t *op = &instr->operands[i];
+        h = _mix (h, op->op_type);
+
+        switch (op->op_type) {
+            case ARM64_OPERAND_TYPE_REGISTER:
+                h = _mix (h, (op->reg.type << 8) | op->reg.size);
+                h = _mix (h, op->val.vec.arrangement | (op->val.vec.qualifier << 8));
+
+                /* The stack pointer, zero register and system registers are
+                   part of what the instruction does, so they're kept */
+                if (op->reg.type == ARM64_REGISTER_TYPE_SYSTEM ||
+                    (op->reg.type == ARM64_REGISTER_TYPE_GENERAL && op->reg.reg >= ARM64_REG_SP))
+                    h = _mix (h, op->reg.reg);
+                break;
+
+            case ARM64_OPERAND_TYPE_IMMEDIATE:
+                h = _mix (h, op->imm.type);
+                break;
+
+            case ARM64_OPERAND_TYPE_SHIFT:
+                h = _mix (h, op->shift_type);
+                break;
+
+            case ARM64_OPERAND_TYPE_INDEX_EXTEND:
+                h = _mix (h, (uint32_t) op->extra_val);
+                break;
+
+            case ARM64_OPERAND_TYPE_PSTATE:
+            case ARM64_OPERAND_TYPE_AT_NAME:
+            case ARM64_OPERAND_TYPE_TLBI_OP:
+            case ARM64_OPERAND_TYPE_PRFOP:
+            case ARM64_OPERAND_TYPE_MEMORY_BARRIER:
+            case ARM64_OPERAND_TYPE_CONDITION:
+            case ARM64_OPERAND_TYPE_SVE_PATTERN:
+                h = _mix (h, (uint32_t) op->val.extra);
+                break;
+
+            default:
+                break;
+        }
+    }
+    return h;
+}
+
+/* Fill in the token, control flow kind and branch target of `instr`, which is
+   at index `idx` in a function of `len` instructions */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_flow (const instruction_t *instr, size_t idx, size_t len, flow_t *flow)
+{
+    uint32_t op = instr->opcode;
+    int64_t offset = 0;
+
+    flow->token = _token (instr);
+    flow->kind = FLOW_NONE;
+    flow->target = -1;
+
+    switch (instr->type) {
+        case ARM64_INSTRUCTION_B:
+            if (instr->cond == -1) {
+                flow->kind = FLOW_BRANCH;
+                offset = (int) arm64_sign_extend (select_bits (op, 0, 25), 26);
+            } else {
+                flow->kind = FLOW_CONDITIONAL;
+                offset = (int) arm64_sign_extend (select_bits (op, 5, 23), 19);
+            }
+            break;
+
+        case ARM64_INSTRUCTION_CBZ: case ARM64_INSTRUCTION_CBNZ:
+            flow->kind = FLOW_CONDITIONAL;
+            offset = (int) arm64_sign_extend (select_bits (op, 5, 23), 19);
+            break;
+
+        case ARM64_INSTRUCTION_TBZ: case ARM64_INSTRUCTION_TBNZ:
+            flow->kind = FLOW_CONDITIONAL;
+            offset = (int) arm64_sign_extend (select_bits (op, 5, 18), 14);
+            break;
+
+        case ARM64_INSTRUCTION_BL:
+        case ARM64_INSTRUCTION_BLR: case ARM64_INSTRUCTION_BLRAA: case ARM64_INSTRUCTION_BLRAAZ:
+        case ARM64_INSTRUCTION_BLRAB: case ARM64_INSTRUCTION_BLRABZ:
+            flow->kind = FLOW_CALL;
+            return;
+
+        case ARM64_INSTRUCTION_BR: case ARM64_INSTRUCTION_BRAA: case ARM64_INSTRUCTION_BRAAZ:
+        case ARM64_INSTRUCTION_BRAB: case ARM64_INSTRUCTION_BRABZ:
+            flow->kind = FLOW_INDIRECT;
+            return;
+
+        case ARM64_INSTRUCTION_RET: case ARM64_INSTRUCTION_RETAA: case ARM64_INSTRUCTION_RETAB:
+        case ARM64_INSTRUCTION_ERET: case ARM64_INSTRUCTION_ERETAA: case ARM64_INSTRUCTION_ERETAB:
+            flow->kind = FLOW_RETURN;
+            return;
+
+        default:
+            return;
+    }
+
+    offset += (int64_t) idx;
+    if (offset >= 0 && offset < (int64_t) len) flow->target = offset;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_scratch_reserve (hash_scratch_t *scratch, size_t len)
+{
+    flow_t *flows;
+    uint32_t *blocks;
+
+    if (len <= scratch->cap) return LIBARCH_RETURN_SUCCESS;
+
+    if (!(flows = realloc (scratch->flows, len * sizeof (flow_t)))) return LIBARCH_RETURN_FAILURE;
+    scratch->flows = flows;
+    if (!(blocks = realloc (scratch->blocks, len * sizeof (uint32_t)))) return LIBARCH_RETURN_FAILURE;
+    scratch->blocks = blocks;
+
+    scratch->cap = len;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_scratch_release (hash_scratch_t *scratch)
+{
+    for (unsigned i = 0; i <= LIBARCH_JUMPTABLE_WINDOW; i++)
+        if (scratch->window[i]) libarch_instruction_free (scratch->window[i]);
+    free (scratch->flows);
+    free (scratch->blocks);
+    free (scratch->cases);
+    memset (scratch, 0, sizeof (hash_scratch_t));
+}
+
+/* Split the flows into basic blocks and hash the control flow graph */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_hash_flows (hash_scratch_t *scratch, size_t len, libarch_function_hash_t *out)
+{
+    const flow_t *flows = scratch->flows;
+    uint32_t *blocks = scratch->blocks;
+    uint64_t h = 0, block = 0;
+
+    memset (out, 0, sizeof (libarch_function_hash_t));
+    memset (blocks, 0, len * sizeof (uint32_t));
+
+    /* Mark the first instruction of each block */
+    blocks[0] = 1;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t kind = flows[i].kind;
+        if ((kind == FLOW_BRANCH || kind == FLOW_CONDITIONAL) && flows[i].target >= 0)
+            blocks[flows[i].target] = 1;
+        for (uint32_t c = 0; kind == FLOW_SWITCH && c < flows[i].cases; c++)
+            blocks[scratch->cases[flows[i].target + c]] = 1;
+        if (kind != FLOW_NONE && kind != FLOW_CALL && i + 1 < len)
+            blocks[i + 1] = 1;
+        if (kind == FLOW_CALL)
+            out->calls++;
+    }
+
+    /* Then turn the marks into the block number of each instruction */
+    for (size_t i = 1; i < len; i++)
+        blocks[i] += blocks[i - 1];
+
+    for (size_t i = 0; i < len; i++) {
+        const flow_t *f = &flows[i];
+
+        block = _mix (block, f->token);
+        if (i + 1 < len && blocks[i + 1] == blocks[i]) continue;
+
+        /* End of the block, hash it with it's successors */
+        h = _mix (h, block);
+        h = _mix (h, f->kind);
+        block = 0;
+
+        if (f->kind == FLOW_BRANCH || f->kind == FLOW_CONDITIONAL) {
+            if (f->target >= 0) {
+                h = _mix (h, (uint64_t) ((int64_t) blocks[f->target] - (int64_t) blocks[i]));
+                out->edges++;
+            } else {
+                h = _mix (h, EDGE_EXTERNAL);
+            }
+        }
+        for (uint32_t c = 0; f->kind == FLOW_SWITCH && c < f->cases; c++) {
+            h = _mix (h, (uint64_t) ((int64_t) blocks[scratch->cases[f->target + c]] - (int64_t) blocks[i]));
+            out->edges++;
+        }
+        if (f->kind != FLOW_BRANCH && f->kind != FLOW_INDIRECT && f->kind != FLOW_SWITCH &&
+            f->kind != FLOW_RETURN && i + 1 < len)
+            out->edges++;
+    }
+
+    out->hash = _mix (h, len);
+    out->instructions = (uint32_t) len;
+    out->blocks = blocks[len - 1];
+}
+
+/**
+ *  Turn the indirect branch at `idx` into a switch, if the window of
+ *  instructions ending with it dispatches through a jump table. Cases outside
+ *  the function, and repeats, are left out.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_switch (hash_scratch_t *scratch, const libarch_function_t *func, instruction_t **window, size_t n, size_t idx)
+{
+    const uint32_t *image = (func->image) ? func->image : func->code;
+    uint64_t image_addr = (func->image) ? func->image_addr : func->addr;
+    size_t image_len = (func->image) ? func->image_len : func->len;
+    flow_t *flow = &scratch->flows[idx];
+    libarch_jumptable_t table;
+    uint64_t targets[64];
+    size_t start = scratch->cases_len;
+
+    if (!libarch_jumptable_recover (window, n, &table)) return;
+
+    for (uint32_t done = 0; done < table.count;) {
+        libarch_jumptable_t chunk = table;
+        chunk.table += (uint64_t) done * table.entry_size;
+        chunk.count = table.count - done;
+
+        size_t got = libarch_jumptable_targets (&chunk, image, image_addr, image_len, targets, 64);
+        for (size_t k = 0; k < got; k++) {
+            uint64_t t = (targets[k] - func->addr) / 4;
+            if (targets[k] < func->addr || (targets[k] & 3) || t >= func->len) continue;
+
+            /* Several cases often share a target, so only keep the first */
+            int seen = 0;
+            for (size_t c = start; c < scratch->cases_len && !seen; c++) seen = (scratch->cases[c] == t);
+            if (seen) continue;
+
+            if (scratch->cases_len == scratch->cases_cap) {
+                size_t cap = (scratch->cases_cap) ? scratch->cases_cap * 2 : 64;
+                uint32_t *cases = realloc (scratch->cases, cap * sizeof (uint32_t));
+                if (!cases) return;
+                scratch->cases = cases;
+                scratch->cases_cap = cap;
+            }
+            scratch->cases[scratch->cases_len++] = (uint32_t) t;
+        }
+        if (got < 64) break;
+        done += got;
+    }
+
+    if (scratch->cases_len == start) return;
+    flow->kind = FLOW_SWITCH;
+    flow->target = start;
+    flow->cases = (uint32_t) (scratch->cases_len - start);
+}
+
+/* Decode and hash a single function */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_hash_function (libarch_ctx_t *ctx, hash_scratch_t *scratch, const libarch_function_t *func, libarch_function_hash_t *out)
+{
+    const size_t ring = LIBARCH_JUMPTABLE_WINDOW + 1;
+    instruction_t *window[LIBARCH_JUMPTABLE_WINDOW + 1];
+
+    if (!func->len || !_scratch_reserve (scratch, func->len)) return LIBARCH_RETURN_FAILURE;
+    scratch->cases_len = 0;
+
+    /* The records are kept in the scratch space and reused, as a ring */
+    for (size_t i = 0; i < ring; i++) {
+        if (!scratch->window[i]) scratch->window[i] = libarch_instruction_create_ctx (ctx, 0, 0);
+        if (!scratch->window[i]) return LIBARCH_RETURN_FAILURE;
+    }
+
+    for (size_t i = 0; i < func->len; i++) {
+        instruction_t **instr = &scratch->window[i % ring];
+
+        libarch_instruction_reset (*instr, func->code[i], func->addr + i * 4);
+        libarch_disass_ctx (ctx, instr);
+        _flow (*instr, i, func->len, &scratch->flows[i]);
+
+        if (scratch->flows[i].kind != FLOW_INDIRECT || (*instr)->type != ARM64_INSTRUCTION_BR) continue;
+
+        /* Put the window in address order, ending with the br */
+        size_t n = (i + 1 < ring) ? i + 1 : ring;
+        for (size_t k = 0; k < n; k++) window[k] = scratch->window[(i + 1 - n + k) % ring];
+        _switch (scratch, func, window, n, i);
+    }
+
+    _hash_flows (scratch, func->len, out);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+/******************************************************************************
+*       Parallel Hashing
+*******************************************************************************/
+
+typedef struct hash_job_t
+{
+    const libarch_function_t   *funcs;
+    libarch_function_hash_t    *hashes;
+    size_t                      count;
+
+    atomic_size_t               next;
+    atomic_int                  failed;
+} hash_job_t;
+
+LIBARCH_PRIVATE LIBARCH_API
+void *
+_hash_worker (void *arg)
+{
+    hash_job_t *job = (hash_job_t *) arg;
+    hash_scratch_t scratch = { 0 };
+    libarch_ctx_t ctx;
+    size_t start;
+
+    libarch_ctx_init (&ctx);
+
+    while ((start = atomic_fetch_add (&job->next, HASH_BATCH)) < job->count) {
+        size_t end = (start + HASH_BATCH < job->count) ? start + HASH_BATCH : job->count;
+
+        for (size_t i = start; i < end; i++) {
+            if (_hash_function (&ctx, &scratch, &job->funcs[i], &job->hashes[i])) continue;
+            memset (&job->hashes[i], 0, sizeof (libarch_function_hash_t));
+            atomic_store (&job->failed, 1);
+        }
+    }
+
+    _scratch_release (&scratch);
+    libarch_ctx_cleanup (&ctx);
+    return NULL;
+}
+
+
+/******************************************************************************
+*       Matching
+*******************************************************************************/
+
+typedef struct match_key_t
+{
+    libarch_function_hash_t     hash;
+    size_t                      idx;
+} match_key_t;
+
+LIBARCH_PRIVATE LIBARCH_API
+int
+_compare_hash (const libarch_function_hash_t *a, const libarch_function_hash_t *b)
+{
+    if (a->hash != b->hash) return (a->hash < b->hash) ? -1 : 1;
+    if (a->instructions != b->instructions) return (a->instructions < b->instructions) ? -1 : 1;
+    if (a->blocks != b->blocks) return (a->blocks < b->blocks) ? -1 : 1;
+    if (a->edges != b->edges) return (a->edges < b->edges) ? -1 : 1;
+    if (a->calls != b->calls) return (a->calls < b->calls) ? -1 : 1;
+    return 0;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+int
+_compare_key (const void *a, const void *b)
+{
+    return _compare_hash (&((const match_key_t *) a)->hash, &((const match_key_t *) b)->hash);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+match_key_t *
+_sorted_keys (const libarch_function_hash_t *hashes, size_t len)
+{
+    match_key_t *keys = malloc ((len) ? len * sizeof (match_key_t) : 1);
+    if (!keys) return NULL;
+
+    for (size_t i = 0; i < len; i++) {
+        keys[i].hash = hashes[i];
+        keys[i].idx = i;
+    }
+    qsort (keys, len, sizeof (match_key_t), _compare_key);
+    return keys;
+}
+
+/* Length of the run of equal keys starting at `i` */
+LIBARCH_PRIVATE LIBARCH_API
+size_t
+_run (const match_key_t *keys, size_t len, size_t i)
+{
+    size_t j = i + 1;
+    while (j < len && !_compare_key (&keys[i], &keys[j])) j++;
+    return j - i;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+libarch_return_t
+libarch_function_hash_instructions (instruction_t **instrs, size_t len, libarch_function_hash_t *hash)
+{
+    hash_scratch_t scratch = { 0 };
+
+    if (!len || !_scratch_reserve (&scratch, len)) {
+        _scratch_release (&scratch);
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    for (size_t i = 0; i < len; i++)
+        _flow (instrs[i], i, len, &scratch.flows[i]);
+    _hash_flows (&scratch, len, hash);
+
+    _scratch_release (&scratch);
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_function_hash (libarch_ctx_t *ctx, const libarch_function_t *func, libarch_function_hash_t *hash)
+{
+    hash_scratch_t scratch = { 0 };
+    libarch_ctx_t local;
+    libarch_return_t res;
+
+    if (!ctx) libarch_ctx_init (&local);
+
+    res = _hash_function ((ctx) ? ctx : &local, &scratch, func, hash);
+
+    /* The scratch records go back to the context, so release them first */
+    _scratch_release (&scratch);
+    if (!ctx) libarch_ctx_cleanup (&local);
+    return res;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_function_hash_parallel (const libarch_function_t *funcs, size_t count, libarch_function_hash_t *hashes, unsigned threads)
+{
+    hash_job_t job = { .funcs = funcs, .hashes = hashes, .count = count };
+    pthread_t *tids;
+    unsigned started = 0;
+
+    atomic_init (&job.next, 0);
+    atomic_init (&job.failed, 0);
+
+    if (!threads) {
+        long cpus = sysconf (_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (unsigned) cpus : 1;
+    }
+    if (threads > count / HASH_BATCH + 1) threads = count / HASH_BATCH + 1;
+
+    /**
+     *  The calling thread works through the functions as well, so if any of
+     *  the threads can't be created, the job still finishes with fewer.
+     */
+    tids = calloc (threads, sizeof (pthread_t));
+    for (unsigned i = 1; tids && i < threads; i++)
+        if (!pthread_create (&tids[started], NULL, _hash_worker, &job)) started++;
+
+    _hash_worker (&job);
+
+    for (unsigned i = 0; i < started; i++)
+        pthread_join (tids[i], NULL);
+    free (tids);
+
+    return (atomic_load (&job.failed)) ? LIBARCH_RETURN_FAILURE : LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+size_t
+libarch_function_hash_match (const libarch_function_hash_t *a, size_t a_len,
+                             const libarch_function_hash_t *b, size_t b_len,
+                             libarch_function_match_t *matches)
+{
+    match_key_t *ka = _sorted_keys (a, a_len);
+    match_key_t *kb = _sorted_keys (b, b_len);
+    size_t i = 0, j = 0, count = 0;
+
+    while (ka && kb && i < a_len && j < b_len) {
+        int cmp = _compare_hash (&ka[i].hash, &kb[j].hash);
+        size_t ra, rb;
+
+        if (cmp < 0) { i += _run (ka, a_len, i); continue; }
+        if (cmp > 0) { j += _run (kb, b_len, j); continue; }
+
+        ra = _run (ka, a_len, i);
+        rb = _run (kb, b_len, j);
+        if (ra == 1 && rb == 1) {
+            matches[count].a = ka[i].idx;
+            matches[count].b = kb[j].idx;
+            count++;
+        }
+        i += ra;
+        j += rb;
+    }
+
+    free (ka);
+    free (kb);
+    return count;
+}
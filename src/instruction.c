@@ -16,13 +16,41 @@
 #include <assert.h>
 
 #include "instruction.h"
+#include "alias.h"
 #include "decoder/branch.h"
 #include "decoder/load-and-store.h"
 #include "decoder/data-processing.h"
 #include "decoder/data-processing-register.h"
+#include "decoder/data-processing-floating.h"
+#include "decoder/sve.h"
+
+/* Initial size of the operands and fields arrays */
+#define LIBARCH_INSTRUCTION_MIN_CAP     4
+
+/**
+ *  Context of the decode running on this thread. It's kept apart from the
+ *  record's own context, which decides where it's memory comes from.
+ */
+static _Thread_local const libarch_ctx_t *_decode_ctx;
+
+/**
+ *  \brief  Fetch the allocator for an instruction, either from it's context or
+ *          the default context.
+ * 
+ *  \param      instr   Instruction to fetch the allocator for.
+ * 
+ *  \return Allocator.
+*/
+LIBARCH_PRIVATE LIBARCH_API
+const libarch_allocator_t *
+_libarch_instruction_allocator (instruction_t *instr)
+{
+    return (instr->ctx) ? &instr->ctx->allocator : &libarch_ctx_default ()->allocator;
+}
 
 /**
- *  \brief  Allocate / Reallocated memory in the operands array for a new element.
+ *  \brief  Make sure there is room in the operands array for a new element,
+ *          doubling it when it's full.
  * 
  *  \param      instr   Instruction to modify the operands array of.
  * 
@@ -32,16 +60,49 @@ LIBARCH_PRIVATE LIBARCH_API
 libarch_return_t
 _libarch_instruction_realloc_operand (instruction_t **instr)
 {
+    const libarch_allocator_t *alloc;
+    uint32_t cap = (*instr)->operands_cap;
+    operand_t *new;
+
+    if ((*instr)->operands_len < cap) goto done;
+    alloc = _libarch_instruction_allocator (*instr);
+
     /* Alloc / Realloc the operands array */
-    if ((*instr)->operands_len == 0) {
-        (*instr)->operands = malloc (sizeof (operand_t) * ++(*instr)->operands_len);
-    } else {
-        operand_t *new = (*instr)->operands = realloc ((*instr)->operands, sizeof (operand_t) * ++(*instr)->operands_len);
-        (*instr)->operands = new;
-    }
+    cap = (cap) ? cap * 2 : LIBARCH_INSTRUCTION_MIN_CAP;
+    if ((*instr)->operands) new = alloc->resize ((*instr)->operands, sizeof (operand_t) * cap);
+    else new = alloc->alloc (sizeof (operand_t) * cap);
 
-    assert ((*instr)->operands_len);
-    return ((*instr)->operands_len) ? LIBARCH_RETURN_SUCCESS : LIBARCH_RETURN_FAILURE;
+    assert (new);
+    if (!new) return LIBARCH_RETURN_FAILURE;
+    (*instr)->operands = new;
+    (*instr)->operands_cap = cap;
+
+done:
+    (*instr)->operands_len++;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+/**
+ *  \brief  Append a new, zeroed operand of the given type to the operands array.
+ *
+ *  \param      instr   Instruction to add the operand to.
+ *  \param      type    Operand type, one of ARM64_OPERAND_TYPE_*.
+ *
+ *  \return Pointer to the new operand.
+*/
+LIBARCH_PRIVATE LIBARCH_API
+operand_t *
+_libarch_instruction_new_operand (instruction_t **instr, uint8_t type)
+{
+    operand_t *op;
+
+    _libarch_instruction_realloc_operand (instr);
+
+    op = &(*instr)->operands[(*instr)->operands_len - 1];
+    memset (op, 0, sizeof (operand_t));
+    op->op_type = type;
+
+    return op;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,6 +114,7 @@ libarch_instruction_create (uint32_t opcode, uint64_t addr)
     instruction_t *instr = calloc (1, sizeof (instruction_t));
     instr->opcode = opcode;
     instr->addr = addr;
+    instr->run = 1;
 
     /* default extra values */
     instr->cond = -1;
@@ -62,22 +124,103 @@ libarch_instruction_create (uint32_t opcode, uint64_t addr)
 }
 
 
+LIBARCH_API
+instruction_t *
+libarch_instruction_create_ctx (libarch_ctx_t *ctx, uint32_t opcode, uint64_t addr)
+{
+    instruction_t *instr;
+
+    /* Reuse a released record, and it's arrays, if the context has one */
+    if (ctx->cache_len) instr = ctx->cache[--ctx->cache_len];
+    else if (!(instr = ctx->allocator.alloc (sizeof (instruction_t)))) return NULL;
+    else memset (instr, 0, sizeof (instruction_t));
+
+    instr->ctx = ctx;
+    libarch_instruction_reset (instr, opcode, addr);
+
+    return instr;
+}
+
+
+LIBARCH_API
+void
+libarch_instruction_reset (instruction_t *instr, uint32_t opcode, uint64_t addr)
+{
+    instr->parsed = NULL;
+    instr->opcode = opcode;
+    instr->addr = addr;
+
+    instr->group = 0;
+    instr->subgroup = 0;
+    instr->type = 0;
+    instr->raw = 0;
+    instr->run = 1;
+
+    /* default extra values */
+    instr->cond = -1;
+    instr->spec = -1;
+
+    /* Keep the arrays, only forget what's in them */
+    instr->operands_len = 0;
+    instr->fields_len = 0;
+}
+
+LIBARCH_API
+int
+libarch_instruction_is_pc_relative (const instruction_t *instr)
+{
+    switch (instr->group) {
+        case ARM64_DECODE_GROUP_BRANCH_EXCEPTION_SYSREG:
+            return instr->subgroup == ARM64_DECODE_SUBGROUP_CONDITIONAL_BRANCH ||
+                   instr->subgroup == ARM64_DECODE_SUBGROUP_UNCONDITIONAL_BRANCH_IMMEDIATE ||
+                   instr->subgroup == ARM64_DECODE_SUBGROUP_COMPARE_AND_BRANCH_IMMEDIATE ||
+                   instr->subgroup == ARM64_DECODE_SUBGROUP_TEST_AND_BRANCH_IMMEDIATE;
+
+        case ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE:
+            return instr->subgroup == ARM64_DECODE_SUBGROUP_PC_RELATIVE_ADDRESSING;
+
+        case ARM64_DECODE_GROUP_LOAD_AND_STORE:
+            return instr->subgroup == ARM64_DECODE_SUBGROUP_LOAD_REGISTER_LITERAL;
+    }
+    return 0;
+}
+
+
+LIBARCH_API
+void
+libarch_instruction_free (instruction_t *instr)
+{
+    const libarch_allocator_t *alloc;
+    libarch_ctx_t *ctx;
+
+    if (!instr) return;
+    alloc = _libarch_instruction_allocator (instr);
+    ctx = instr->ctx;
+
+    /* Cached records keep their arrays for the next create */
+    if (ctx && ctx->cache_len < LIBARCH_CTX_CACHE_SIZE) {
+        ctx->cache[ctx->cache_len++] = instr;
+        return;
+    }
+
+    if (instr->operands) alloc->release (instr->operands);
+    if (instr->fields) alloc->release (instr->fields);
+
+    /* Records created without a context came from calloc */
+    if (!ctx) free (instr);
+    else alloc->release (instr);
+}
+
+
 LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_immediate (instruction_t **instr, uint64_t bits, uint8_t type, uint32_t opts)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_IMMEDIATE);
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = ARM64_OPERAND_TYPE_IMMEDIATE;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_bits = bits;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_type = type;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_opts = opts;
-
-    /* Nullify unused prefix, suffix and suffix_extra when not used */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
+    op->imm.type = type;
+    op->imm.opts = opts;
+    op->val.imm_bits = bits;
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -86,18 +229,16 @@ LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_immediate_with_fix_extra (instruction_t **instr, uint64_t bits, uint8_t type, char prefix, char suffix)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_IMMEDIATE);
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = ARM64_OPERAND_TYPE_IMMEDIATE;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_bits = bits;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_type = type;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_opts |= ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL;
+    op->imm.type = type;
+    op->imm.opts = ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL;
+    op->val.imm_bits = bits;
 
     /* Immediate prefix/suffix, e.g. [12] has a prefix '[' and suffix ']' */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = prefix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = suffix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = '!';
+    op->prefix = prefix;
+    op->suffix = suffix;
+    op->suffix_extra = '!';
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -106,18 +247,15 @@ LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_immediate_with_fix (instruction_t **instr, uint64_t bits, uint8_t type, char prefix, char suffix)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_IMMEDIATE);
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = ARM64_OPERAND_TYPE_IMMEDIATE;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_bits = bits;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_type = type;
-    (*instr)->operands[(*instr)->operands_len - 1].imm_opts = ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL;
+    op->imm.type = type;
+    op->imm.opts = ARM64_IMMEDIATE_OPERAND_OPT_PREFER_DECIMAL;
+    op->val.imm_bits = bits;
 
     /* Immediate prefix/suffix, e.g. [12] has a prefix '[' and suffix ']' */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = prefix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = suffix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
+    op->prefix = prefix;
+    op->suffix = suffix;
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -127,17 +265,10 @@ LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_shift (instruction_t **instr, uint32_t shift, uint8_t type)
 {
-    _libarch_instruction_realloc_operand (instr);
-
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = ARM64_OPERAND_TYPE_SHIFT;
-    (*instr)->operands[(*instr)->operands_len - 1].shift = shift;
-    (*instr)->operands[(*instr)->operands_len - 1].shift_type = type;
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_SHIFT);
 
-    /* Nullify unused prefix, suffix and suffix_extra when not used */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
+    op->shift_type = type;
+    op->val.shift = shift;
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -147,17 +278,14 @@ LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_shift_with_fix (instruction_t **instr, uint32_t shift, uint8_t type, char prefix, char suffix)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_SHIFT);
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = ARM64_OPERAND_TYPE_SHIFT;
-    (*instr)->operands[(*instr)->operands_len - 1].shift = shift;
-    (*instr)->operands[(*instr)->operands_len - 1].shift_type = type;
+    op->shift_type = type;
+    op->val.shift = shift;
 
     /* Shift prefix/suffix, e.g. [lsl #2] has a prefix '[' and suffix ']' */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = prefix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = suffix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
+    op->prefix = prefix;
+    op->suffix = suffix;
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -167,24 +295,18 @@ LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_register (instruction_t **instr, arm64_reg_t a64reg, uint8_t size, uint8_t type, uint32_t opts)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_REGISTER);
 
-    if (a64reg == 31 && (size == 64 || size == 32))
+    if (a64reg == 31 && (size == 64 || size == 32) && type == ARM64_REGISTER_TYPE_GENERAL)
         if (opts == ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO) a64reg = (size == 64) ? ARM64_REG_XZR : ARM64_32_REG_WZR;
         else a64reg = (size == 64) ? ARM64_REG_SP : ARM64_32_REG_SP;
 
     /* Prevent overflows with vector registers */
     if (a64reg > 31 && size > 64) a64reg = (a64reg - 32);
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = ARM64_OPERAND_TYPE_REGISTER;
-    (*instr)->operands[(*instr)->operands_len - 1].reg = a64reg;
-    (*instr)->operands[(*instr)->operands_len - 1].reg_size = size;
-    (*instr)->operands[(*instr)->operands_len - 1].reg_type = type;
-
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
+    op->reg.reg = a64reg;
+    op->reg.size = size;
+    op->reg.type = type;
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -194,21 +316,18 @@ LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_register_with_fix (instruction_t **instr, arm64_reg_t a64reg, uint8_t size, uint8_t type, char prefix, char suffix)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_REGISTER);
 
     /* Prevent overflows */
     if (a64reg > 31) a64reg = (a64reg - 32);
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = ARM64_OPERAND_TYPE_REGISTER;
-    (*instr)->operands[(*instr)->operands_len - 1].reg = a64reg;
-    (*instr)->operands[(*instr)->operands_len - 1].reg_size = size;
-    (*instr)->operands[(*instr)->operands_len - 1].reg_type = type;
+    op->reg.reg = a64reg;
+    op->reg.size = size;
+    op->reg.type = type;
 
     /* Register prefix/suffix, e.g. [x12] has a prefix '[' and suffix ']' */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = prefix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = suffix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
+    op->prefix = prefix;
+    op->suffix = suffix;
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -216,18 +335,22 @@ libarch_instruction_add_operand_register_with_fix (instruction_t **instr, arm64_
 
 LIBARCH_API
 libarch_return_t
-libarch_instruction_add_operand_target (instruction_t **instr, char *target)
+libarch_instruction_add_operand_register_with_fix_extra (instruction_t **instr, arm64_reg_t a64reg, uint8_t size, uint8_t type, uint32_t opts, char prefix, char suffix)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_REGISTER);
+
+    if (a64reg == 31 && (size == 64 || size == 32) && type == ARM64_REGISTER_TYPE_GENERAL)
+        if (opts == ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO) a64reg = (size == 64) ? ARM64_REG_XZR : ARM64_32_REG_WZR;
+        else a64reg = (size == 64) ? ARM64_REG_SP : ARM64_32_REG_SP;
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = ARM64_OPERAND_TYPE_TARGET;
-    (*instr)->operands[(*instr)->operands_len - 1].target = strdup (target);
+    op->reg.reg = a64reg;
+    op->reg.size = size;
+    op->reg.type = type;
 
-    /* Nullify unused prefix, suffix and suffix_extra when not used */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
+    /* Writeback registers, e.g. [x0]! has a prefix '[', suffix ']' and a trailing '!' */
+    op->prefix = prefix;
+    op->suffix = suffix;
+    op->suffix_extra = '!';
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -235,18 +358,82 @@ libarch_instruction_add_operand_target (instruction_t **instr, char *target)
 
 LIBARCH_API
 libarch_return_t
-libarch_instruction_add_operand_extra (instruction_t **instr, int type, int val)
+libarch_instruction_add_operand_vector (instruction_t **instr, arm64_reg_t a64reg, int arrangement, int index, char prefix, char suffix)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_REGISTER);
+
+    op->reg.reg = a64reg & 31;
+    op->reg.size = 128;
+    op->reg.type = ARM64_REGISTER_TYPE_VECTOR;
+
+    /* Stored with a bias of one so a zeroed operand has neither */
+    op->val.vec.arrangement = (arrangement >= 0) ? arrangement + 1 : 0;
+    op->val.vec.index = (index >= 0) ? index + 1 : 0;
+
+    op->prefix = prefix;
+    op->suffix = suffix;
+
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_scalable (instruction_t **instr, arm64_reg_t a64reg, int arrangement, int index, char prefix, char suffix)
+{
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_REGISTER);
+
+    op->reg.reg = a64reg & 31;
+    op->reg.size = 128;
+    op->reg.type = ARM64_REGISTER_TYPE_SCALABLE_VECTOR;
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = type;
-    (*instr)->operands[(*instr)->operands_len - 1].extra = val;
+    op->val.vec.arrangement = (arrangement >= 0) ? arrangement + 1 : 0;
+    op->val.vec.index = (index >= 0) ? index + 1 : 0;
 
-    /* Nullify unused prefix, suffix and suffix_extra when not used */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = NULL;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
+    op->prefix = prefix;
+    op->suffix = suffix;
+
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_predicate (instruction_t **instr, arm64_reg_t a64reg, int arrangement, uint8_t qualifier)
+{
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_REGISTER);
+
+    op->reg.reg = a64reg & 15;
+    op->reg.size = 16;
+    op->reg.type = ARM64_REGISTER_TYPE_PREDICATE;
+
+    op->val.vec.arrangement = (arrangement >= 0) ? arrangement + 1 : 0;
+    op->val.vec.qualifier = qualifier;
+
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_target (instruction_t **instr, const char *target)
+{
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_TARGET);
+
+    /* Targets are static strings, so the operand does not own the string */
+    op->val.target = target;
+
+    return (op->val.target) ? LIBARCH_RETURN_SUCCESS : LIBARCH_RETURN_FAILURE;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_extra (instruction_t **instr, int type, int val)
+{
+    operand_t *op = _libarch_instruction_new_operand (instr, type);
+
+    op->val.extra = val;
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -256,17 +443,38 @@ LIBARCH_API
 libarch_return_t
 libarch_instruction_add_operand_extra_with_fix (instruction_t **instr, int type, int val, char prefix, char suffix)
 {
-    _libarch_instruction_realloc_operand (instr);
+    operand_t *op = _libarch_instruction_new_operand (instr, type);
 
-    /* Add the new operand */
-    (*instr)->operands[(*instr)->operands_len - 1].op_type = type;
-    (*instr)->operands[(*instr)->operands_len - 1].extra = val;
+    op->val.extra = val;
 
     /* Extra prefix/suffix, e.g. [x12] has a prefix '[' and suffix ']' */
-    (*instr)->operands[(*instr)->operands_len - 1].prefix = prefix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix = suffix;
-    (*instr)->operands[(*instr)->operands_len - 1].suffix_extra = NULL;
-    
+    op->prefix = prefix;
+    op->suffix = suffix;
+
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_extend (instruction_t **instr, int extend, int amount)
+{
+    return libarch_instruction_add_operand_extend_with_fix (instr, extend, amount, 0, 0);
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_instruction_add_operand_extend_with_fix (instruction_t **instr, int extend, int amount, char prefix, char suffix)
+{
+    operand_t *op = _libarch_instruction_new_operand (instr, ARM64_OPERAND_TYPE_INDEX_EXTEND);
+
+    op->val.extra = extend;
+    op->extra_val = amount;
+
+    /* Extend prefix/suffix, e.g. the "uxtw #2]" of a register offset */
+    op->prefix = prefix;
+    op->suffix = suffix;
 
     return LIBARCH_RETURN_SUCCESS;
 }
@@ -274,26 +482,103 @@ libarch_instruction_add_operand_extra_with_fix (instruction_t **instr, int type,
 
 LIBARCH_API
 libarch_return_t
-libarch_instruction_add_field (instruction_t **instr, int field)
+libarch_instruction_add_field (instruction_t **instr, uint32_t field)
 {
+    uint32_t cap = (*instr)->fields_cap;
+
     /* Alloc/Realloc fields array */
-    if ((*instr)->fields_len == 0) {
-        (*instr)->fields = malloc (sizeof (int) * ++(*instr)->fields_len);
-    } else {
-        int *new = (*instr)->fields = realloc ((*instr)->fields, sizeof (int) * ++(*instr)->fields_len);
+    if ((*instr)->fields_len == cap) {
+        const libarch_allocator_t *alloc = _libarch_instruction_allocator (*instr);
+        uint32_t *new;
+
+        cap = (cap) ? cap * 2 : LIBARCH_INSTRUCTION_MIN_CAP;
+        if ((*instr)->fields) new = alloc->resize ((*instr)->fields, sizeof (uint32_t) * cap);
+        else new = alloc->alloc (sizeof (uint32_t) * cap);
+
+        if (!new) return LIBARCH_RETURN_FAILURE;
         (*instr)->fields = new;
+        (*instr)->fields_cap = cap;
     }
 
     /* Add the new field */
-    (*instr)->fields[(*instr)->fields_len - 1] = field;
+    (*instr)->fields[(*instr)->fields_len++] = field;
 
     return LIBARCH_RETURN_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API uint8_t
+libarch_operand_get_type (const operand_t *op) { return op->op_type; }
+
+LIBARCH_API arm64_reg_t
+libarch_operand_get_register (const operand_t *op) { return op->reg.reg; }
+
+LIBARCH_API uint8_t
+libarch_operand_get_register_size (const operand_t *op) { return op->reg.size; }
+
+LIBARCH_API uint8_t
+libarch_operand_get_register_type (const operand_t *op) { return op->reg.type; }
+
+LIBARCH_API int
+libarch_operand_get_arrangement (const operand_t *op) { return (int) op->val.vec.arrangement - 1; }
+
+LIBARCH_API int
+libarch_operand_get_index (const operand_t *op) { return (int) op->val.vec.index - 1; }
+
+LIBARCH_API uint8_t
+libarch_operand_get_predicate_qualifier (const operand_t *op) { return op->val.vec.qualifier; }
+
+LIBARCH_API uint64_t
+libarch_operand_get_immediate (const operand_t *op) { return op->val.imm_bits; }
+
+LIBARCH_API uint8_t
+libarch_operand_get_immediate_type (const operand_t *op) { return op->imm.type; }
+
+LIBARCH_API uint32_t
+libarch_operand_get_immediate_opts (const operand_t *op) { return op->imm.opts; }
+
+LIBARCH_API uint32_t
+libarch_operand_get_shift (const operand_t *op) { return op->val.shift; }
+
+LIBARCH_API uint8_t
+libarch_operand_get_shift_type (const operand_t *op) { return op->shift_type; }
+
+LIBARCH_API const char *
+libarch_operand_get_target (const operand_t *op) { return op->val.target; }
+
+LIBARCH_API int
+libarch_operand_get_extra (const operand_t *op) { return op->val.extra; }
+
+LIBARCH_API int
+libarch_operand_get_extra_val (const operand_t *op) { return op->extra_val; }
+
+LIBARCH_API char
+libarch_operand_get_prefix (const operand_t *op) { return op->prefix; }
+
+LIBARCH_API char
+libarch_operand_get_suffix (const operand_t *op) { return op->suffix; }
+
+LIBARCH_API char
+libarch_operand_get_suffix_extra (const operand_t *op) { return op->suffix_extra; }
+
+LIBARCH_API const operand_t *
+libarch_instruction_get_operand (const instruction_t *instr, uint32_t idx)
+{
+    return (idx < instr->operands_len) ? &instr->operands[idx] : NULL;
+}
 
 LIBARCH_API
 decode_status_t
 libarch_disass (instruction_t **instr)
+{
+    return libarch_disass_ctx ((*instr)->ctx, instr);
+}
+
+
+LIBARCH_API
+decode_status_t
+libarch_disass_ctx (libarch_ctx_t *ctx, instruction_t **instr)
 {
     /**
      *  ** AArch64 Instruction Set Encoding **
@@ -312,6 +597,10 @@ libarch_disass (instruction_t **instr)
      */
     unsigned op0 = select_bits ((*instr)->opcode, 31, 31);
     unsigned op1 = select_bits ((*instr)->opcode, 25, 28);
+    const libarch_ctx_t *outer = _decode_ctx;
+    decode_status_t res;
+
+    _decode_ctx = (ctx) ? ctx : libarch_ctx_default ();
 
     if (op0 == 0 && op1 == 0) {
         // Reserved
@@ -320,6 +609,10 @@ libarch_disass (instruction_t **instr)
         // SME
     } else if (op1 == 2) {
         // SVE
+        if (disass_sve_instruction (*instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            (*instr)->group = ARM64_DECODE_GROUP_SVE;
+        else
+            (*instr)->group = ARM64_DECODE_GROUP_UNKNOWN;
     } else if ((op1 >> 1) == 4) {
         // Data Processing - Immediate
         if (disass_data_processing_instruction (*instr) == LIBARCH_DECODE_STATUS_SUCCESS)
@@ -341,11 +634,36 @@ libarch_disass (instruction_t **instr)
             (*instr)->group = ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER;
     } else if ((op1 & ~8) == 7) {
         // Data Processing - Floating
-        (*instr)->group = ARM64_DECODE_GROUP_DATA_PROCESS_FLOATING;
+        if (disass_data_processing_floating_instruction (*instr) == LIBARCH_DECODE_STATUS_SUCCESS)
+            (*instr)->group = ARM64_DECODE_GROUP_DATA_PROCESS_FLOATING;
+        else
+            (*instr)->group = ARM64_DECODE_GROUP_UNKNOWN;
     } else {
         // Unknown
         (*instr)->group = ARM64_DECODE_GROUP_UNKNOWN;
     }
 
-    return ((*instr)->group != ARM64_DECODE_GROUP_UNKNOWN) ? LIBARCH_DECODE_STATUS_SUCCESS : LIBARCH_DECODE_STATUS_SOFT_FAIL;
+    res = ((*instr)->group != ARM64_DECODE_GROUP_UNKNOWN) ? LIBARCH_DECODE_STATUS_SUCCESS : LIBARCH_DECODE_STATUS_SOFT_FAIL;
+
+    /* Pick the preferred alias now, unless the caller wants the raw instruction */
+    if (ctx && (ctx->options & LIBARCH_OPT_RAW)) (*instr)->raw = 1;
+    else libarch_alias_instruction (*instr);
+
+    /* Record statistics */
+    if (ctx && (ctx->options & LIBARCH_OPT_COLLECT_STATS)) {
+        ctx->stats.decoded++;
+        if (res != LIBARCH_DECODE_STATUS_SUCCESS) ctx->stats.unknown++;
+        ctx->stats.groups[(*instr)->group & 15]++;
+    }
+
+    _decode_ctx = outer;
+    return res;
+}
+
+
+LIBARCH_API
+int
+libarch_decode_has_feature (const instruction_t *instr, uint64_t feature)
+{
+    return libarch_ctx_has_feature ((_decode_ctx) ? _decode_ctx : instr->ctx, feature);
 }
\ No newline at end of file
@@ -0,0 +1,303 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "jumptable.h"
+#include "tracker.h"
+
+#include "arm64/arm64-common.h"
+#include "arm64/arm64-conditions.h"
+#include "arm64/arm64-instructions.h"
+
+/**
+ *  The dispatch sequence is matched from the opcodes, like the tracker, so it
+ *  doesn't matter which alias the decoder picked, e.g. CMP or SUBS. The
+ *  search works backwards from the `br`: the register it branches through is
+ *  defined by either a load of an absolute entry, or an add of a loaded entry
+ *  to a base. The load gives the table register, the entry size and the index
+ *  register, and the index register leads back to the bounds check. Once the
+ *  instructions are found, one tracker pass gives the table and base.
+ */
+
+#define IS_BR(op)               (((op) & 0xfffffc1f) == 0xd61f0000)
+#define IS_ADD_SHIFTED(op)      (((op) & 0x7f200000) == 0x0b000000)
+#define IS_ADD_EXTENDED(op)     (((op) & 0x7fe00000) == 0x0b200000)
+#define IS_LOAD_REGISTER(op)    (((op) & 0x3f200c00) == 0x38200800)
+#define IS_CMP_IMMEDIATE(op)    (((op) & 0x7f80001f) == 0x7100001f)
+#define IS_CMP_REGISTER(op)     (((op) & 0x7fe0fc1f) == 0x6b00001f)
+#define IS_B_COND(op)           (((op) & 0xff000010) == 0x54000000)
+#define IS_MOV_REGISTER(op)     (((op) & 0x7fe0ffe0) == 0x2a0003e0)
+#define IS_SXTW(op)             (((op) & 0xfffffc00) == 0x93407c00)
+
+#define RD(op)                  ((op) & 0x1f)
+#define RN(op)                  (((op) >> 5) & 0x1f)
+#define RM(op)                  (((op) >> 16) & 0x1f)
+
+/* Add extend options, as encoded */
+#define EXTEND_NONE             (-1)
+#define EXTEND_UXTX             3
+#define EXTEND_SXTX             7
+
+/* Instructions found in the window, as indexes */
+typedef struct jumptable_match_t
+{
+    size_t              load;
+    long                add;
+    long                cmp;
+    unsigned            base_reg;
+} jumptable_match_t;
+
+/* Check whether control can't fall through `instr` to the next instruction */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_ends_flow (const instruction_t *instr)
+{
+    if (instr->type == ARM64_INSTRUCTION_UNK || instr->type == ARM64_INSTRUCTION_UDF) return 1;
+    if (instr->group != ARM64_DECODE_GROUP_BRANCH_EXCEPTION_SYSREG) return 0;
+
+    switch (instr->subgroup) {
+        case ARM64_DECODE_SUBGROUP_UNCONDITIONAL_BRANCH_IMMEDIATE:
+            return instr->type == ARM64_INSTRUCTION_B;
+        case ARM64_DECODE_SUBGROUP_UNCONDITIONAL_BRANCH_REGISTER:
+            return select_bits (instr->opcode, 21, 22) != 1;
+        case ARM64_DECODE_SUBGROUP_EXCEPTION_GENERATION:
+            return instr->type == ARM64_INSTRUCTION_BRK;
+    }
+    return 0;
+}
+
+/**
+ *  Check whether `instr` may write general purpose register `r`. This only
+ *  needs to be exact for the instructions in a dispatch sequence, so anything
+ *  unusual errs on the side of a write.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_writes (const instruction_t *instr, unsigned r)
+{
+    uint32_t op = instr->opcode;
+
+    switch (instr->group) {
+        case ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE:
+        case ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER:
+            return RD (op) == r;
+
+        /* Rt, Rt2 for pairs, and Rn for the pre/post-indexed forms */
+        case ARM64_DECODE_GROUP_LOAD_AND_STORE:
+            if (RD (op) == r) return 1;
+            if (select_bits (op, 27, 29) == 5)
+                return select_bits (op, 10, 14) == r ||
+                       (select_bits (op, 23, 23) && RN (op) == r);
+            return select_bits (op, 27, 29) == 7 && !select_bits (op, 24, 24) && !select_bits (op, 21, 21) &&
+                   select_bits (op, 10, 10) && RN (op) == r;
+
+        case ARM64_DECODE_GROUP_DATA_PROCESS_FLOATING:
+            return instr->subgroup == ARM64_DECODE_SUBGROUP_FP_CONVERT_INTEGER ||
+                   instr->subgroup == ARM64_DECODE_SUBGROUP_SIMD_COPY;
+
+        /* Calls clobber x0-x18 and the link register */
+        case ARM64_DECODE_GROUP_BRANCH_EXCEPTION_SYSREG:
+            if (instr->type == ARM64_INSTRUCTION_BL ||
+                (instr->subgroup == ARM64_DECODE_SUBGROUP_UNCONDITIONAL_BRANCH_REGISTER &&
+                 select_bits (op, 21, 22) == 1))
+                return r <= 18 || r == 30;
+            return instr->type == ARM64_INSTRUCTION_MRS || instr->type == ARM64_INSTRUCTION_SYSL ?
+                RD (op) == r : 0;
+    }
+    return 0;
+}
+
+/* Index of the last instruction in [start, end) that writes `r`, or -1 */
+LIBARCH_PRIVATE LIBARCH_API
+long
+_find_def (instruction_t **instrs, size_t start, size_t end, unsigned r)
+{
+    while (end-- > start)
+        if (_writes (instrs[end], r)) return (long) end;
+    return -1;
+}
+
+/* Check for a load of a table entry, LDR(B|H|SB|SH|SW) Rt, [Rn, Rm{, extend}] */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_is_entry_load (uint32_t op)
+{
+    unsigned size = select_bits (op, 30, 31);
+    unsigned opc = select_bits (op, 22, 23);
+    unsigned option = select_bits (op, 13, 15);
+
+    if (!IS_LOAD_REGISTER (op) || opc == 0) return 0;
+    if (size == 3 && opc != 1) return 0;                    // PRFM, unallocated
+    if (size == 2 && opc == 3) return 0;                    // unallocated
+    if (!(option & 2)) return 0;                            // index must be 32 or 64-bit
+
+    /* The index must be scaled by the entry size */
+    return select_bits (op, 12, 12) || size == 0;
+}
+
+/**
+ *  Find the compare that bounds index register `idx` before the load at
+ *  `load`, followed by a b.hi, setting `inclusive`, or a b.hs. Returns the
+ *  index of the compare, or -1 if the index isn't bounded.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+long
+_find_bound (instruction_t **instrs, size_t start, size_t load, unsigned idx, int *inclusive)
+{
+    for (size_t j = load; j-- > start;) {
+        uint32_t op = instrs[j]->opcode;
+
+        if (IS_B_COND (op) && ((op & 0xf) == ARM64_BRANCH_CONDITION_HI || (op & 0xf) == ARM64_BRANCH_CONDITION_HS)) {
+            uint32_t c = (j > start) ? instrs[j - 1]->opcode : 0;
+
+            *inclusive = (op & 0xf) == ARM64_BRANCH_CONDITION_HI;
+            return ((IS_CMP_IMMEDIATE (c) || IS_CMP_REGISTER (c)) && RN (c) == idx) ? (long) j - 1 : -1;
+        }
+
+        /* Follow copies of the index, e.g. a zero-extending mov */
+        if (IS_MOV_REGISTER (op) && RD (op) == idx) idx = RM (op);
+        else if (IS_SXTW (op) && RD (op) == idx) idx = RN (op);
+        else if (_writes (instrs[j], idx)) return -1;
+    }
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+libarch_return_t
+libarch_jumptable_recover (instruction_t **instrs, size_t len, libarch_jumptable_t *table)
+{
+    jumptable_match_t m = { .add = -1, .cmp = -1 };
+    size_t start, end = len - 1;
+    int extend = EXTEND_NONE;
+    unsigned shift = 0;
+    long def;
+
+    if (!len || !IS_BR (instrs[end]->opcode)) return LIBARCH_RETURN_FAILURE;
+
+    /* Only the instructions that run straight into the br */
+    for (start = end; start > 0 && !_ends_flow (instrs[start - 1]); start--);
+
+    /* The branch register is a loaded absolute entry, or an entry plus a base */
+    if ((def = _find_def (instrs, start, end, RN (instrs[end]->opcode))) < 0) return LIBARCH_RETURN_FAILURE;
+    uint32_t op = instrs[def]->opcode;
+
+    if (_is_entry_load (op) && select_bits (op, 30, 31) == 3) {
+        m.load = def;
+    } else if (IS_ADD_SHIFTED (op) && select_bits (op, 22, 23) == 0 && select_bits (op, 31, 31)) {
+        long a = _find_def (instrs, start, def, RM (op));
+        long b = _find_def (instrs, start, def, RN (op));
+
+        /* The shift applies to Rm, so without one either could be the entry */
+        m.add = def;
+        shift = select_bits (op, 10, 15);
+        if (a >= 0 && _is_entry_load (instrs[a]->opcode)) {
+            m.load = a;
+            m.base_reg = RN (op);
+        } else if (!shift && b >= 0 && _is_entry_load (instrs[b]->opcode)) {
+            m.load = b;
+            m.base_reg = RM (op);
+        } else {
+            return LIBARCH_RETURN_FAILURE;
+        }
+    } else if (IS_ADD_EXTENDED (op) && select_bits (op, 31, 31)) {
+        long a = _find_def (instrs, start, def, RM (op));
+        if (a < 0 || !_is_entry_load (instrs[a]->opcode)) return LIBARCH_RETURN_FAILURE;
+
+        m.add = def;
+        m.load = a;
+        m.base_reg = RN (op);
+        extend = select_bits (op, 13, 15);
+        shift = select_bits (op, 10, 12);
+    } else {
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    if (shift > 4) return LIBARCH_RETURN_FAILURE;
+
+    /* The entry, as loaded then extended by the add */
+    uint32_t load = instrs[m.load]->opcode;
+    unsigned size = select_bits (load, 30, 31);
+    int is_signed = select_bits (load, 22, 23) >= 2;
+
+    if (extend != EXTEND_NONE && extend != EXTEND_UXTX && extend != EXTEND_SXTX) {
+        if ((extend & 3) < size) return LIBARCH_RETURN_FAILURE;
+        if ((extend & 3) == size) is_signed = (extend & 4) != 0;
+    }
+
+    int inclusive = 0;
+    if ((m.cmp = _find_bound (instrs, start, m.load, RM (load), &inclusive)) < 0) return LIBARCH_RETURN_FAILURE;
+    uint32_t cmp = instrs[m.cmp]->opcode;
+
+    /**
+     *  Run the tracker up to each of the instructions, reading the table and
+     *  base registers as they are used, and the register compared against if
+     *  the bound isn't an immediate.
+     */
+    libarch_tracker_t tracker;
+    uint64_t table_addr = 0, base = 0, bound = select_bits (cmp, 10, 21) << (select_bits (cmp, 22, 22) * 12);
+    int have_table = 0, have_base = (m.add < 0), have_bound = IS_CMP_IMMEDIATE (cmp);
+
+    libarch_tracker_init (&tracker);
+    for (size_t k = start; k < end; k++) {
+        if (k == m.load && libarch_tracker_get (&tracker, RN (load), &table_addr))
+            have_table = 1;
+        if ((long) k == m.add && libarch_tracker_get (&tracker, m.base_reg, &base))
+            have_base = 1;
+        if ((long) k == m.cmp && !have_bound && libarch_tracker_get (&tracker, RM (cmp), &bound))
+            have_bound = 1;
+        libarch_tracker_step (&tracker, instrs[k], NULL);
+    }
+
+    uint64_t count = (inclusive) ? bound + 1 : bound;
+    if (!have_table || !have_base || !have_bound || !count || count > LIBARCH_JUMPTABLE_MAX_ENTRIES)
+        return LIBARCH_RETURN_FAILURE;
+
+    table->branch = instrs[end]->addr;
+    table->table = table_addr;
+    table->base = base;
+    table->count = (uint32_t) count;
+    table->entry_size = 1 << size;
+    table->shift = shift;
+    table->is_signed = is_signed;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+size_t
+libarch_jumptable_targets (const libarch_jumptable_t *table, const uint32_t *opcodes, uint64_t addr, size_t len, uint64_t *targets, size_t max)
+{
+    size_t n = 0;
+
+    for (; n < table->count && n < max; n++) {
+        uint64_t entry = table->table + (uint64_t) n * table->entry_size - addr;
+        uint64_t value = 0;
+
+        /* Entries are little-endian, in words that have been made host-endian */
+        if (table->table < addr || entry / 4 >= len || (entry + table->entry_size - 1) / 4 >= len) break;
+        for (unsigned b = 0; b < table->entry_size; b++, entry++)
+            value |= (uint64_t) ((opcodes[entry / 4] >> ((entry & 3) * 8)) & 0xff) << (b * 8);
+
+        if (table->is_signed && table->entry_size < 8) {
+            uint64_t m = 1ULL << (table->entry_size * 8 - 1);
+            value = (value ^ m) - m;
+        }
+        targets[n] = table->base + (value << table->shift);
+    }
+    return n;
+}
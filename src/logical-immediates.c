@@ -0,0 +1,4746 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ *  This file is generated by config/logical_immediate_generator.py. Do not
+ *  edit it by hand.
+ */
+
+#include "arm64/arm64-logical-immediates.h"
+
+const uint64_t A64_LOGICAL_IMMEDIATES[] = {
+    0x0000000100000001ULL, 0x0000000300000003ULL, 0x0000000700000007ULL, 0x0000000f0000000fULL,
+    0x0000001f0000001fULL, 0x0000003f0000003fULL, 0x0000007f0000007fULL, 0x000000ff000000ffULL,
+    0x000001ff000001ffULL, 0x000003ff000003ffULL, 0x000007ff000007ffULL, 0x00000fff00000fffULL,
+    0x00001fff00001fffULL, 0x00003fff00003fffULL, 0x00007fff00007fffULL, 0x0000ffff0000ffffULL,
+    0x0001ffff0001ffffULL, 0x0003ffff0003ffffULL, 0x0007ffff0007ffffULL, 0x000fffff000fffffULL,
+    0x001fffff001fffffULL, 0x003fffff003fffffULL, 0x007fffff007fffffULL, 0x00ffffff00ffffffULL,
+    0x01ffffff01ffffffULL, 0x03ffffff03ffffffULL, 0x07ffffff07ffffffULL, 0x0fffffff0fffffffULL,
+    0x1fffffff1fffffffULL, 0x3fffffff3fffffffULL, 0x7fffffff7fffffffULL, 0x0000000000000000ULL,
+    0x0001000100010001ULL, 0x0003000300030003ULL, 0x0007000700070007ULL, 0x000f000f000f000fULL,
+    0x001f001f001f001fULL, 0x003f003f003f003fULL, 0x007f007f007f007fULL, 0x00ff00ff00ff00ffULL,
+    0x01ff01ff01ff01ffULL, 0x03ff03ff03ff03ffULL, 0x07ff07ff07ff07ffULL, 0x0fff0fff0fff0fffULL,
+    0x1fff1fff1fff1fffULL, 0x3fff3fff3fff3fffULL, 0x7fff7fff7fff7fffULL, 0x0000000000000000ULL,
+    0x0101010101010101ULL, 0x0303030303030303ULL, 0x0707070707070707ULL, 0x0f0f0f0f0f0f0f0fULL,
+    0x1f1f1f1f1f1f1f1fULL, 0x3f3f3f3f3f3f3f3fULL, 0x7f7f7f7f7f7f7f7fULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8000000080000000ULL, 0x8000000180000001ULL, 0x8000000380000003ULL, 0x8000000780000007ULL,
+    0x8000000f8000000fULL, 0x8000001f8000001fULL, 0x8000003f8000003fULL, 0x8000007f8000007fULL,
+    0x800000ff800000ffULL, 0x800001ff800001ffULL, 0x800003ff800003ffULL, 0x800007ff800007ffULL,
+    0x80000fff80000fffULL, 0x80001fff80001fffULL, 0x80003fff80003fffULL, 0x80007fff80007fffULL,
+    0x8000ffff8000ffffULL, 0x8001ffff8001ffffULL, 0x8003ffff8003ffffULL, 0x8007ffff8007ffffULL,
+    0x800fffff800fffffULL, 0x801fffff801fffffULL, 0x803fffff803fffffULL, 0x807fffff807fffffULL,
+    0x80ffffff80ffffffULL, 0x81ffffff81ffffffULL, 0x83ffffff83ffffffULL, 0x87ffffff87ffffffULL,
+    0x8fffffff8fffffffULL, 0x9fffffff9fffffffULL, 0xbfffffffbfffffffULL, 0x0000000000000000ULL,
+    0x8000800080008000ULL, 0x8001800180018001ULL, 0x8003800380038003ULL, 0x8007800780078007ULL,
+    0x800f800f800f800fULL, 0x801f801f801f801fULL, 0x803f803f803f803fULL, 0x807f807f807f807fULL,
+    0x80ff80ff80ff80ffULL, 0x81ff81ff81ff81ffULL, 0x83ff83ff83ff83ffULL, 0x87ff87ff87ff87ffULL,
+    0x8fff8fff8fff8fffULL, 0x9fff9fff9fff9fffULL, 0xbfffbfffbfffbfffULL, 0x0000000000000000ULL,
+    0x8080808080808080ULL, 0x8181818181818181ULL, 0x8383838383838383ULL, 0x8787878787878787ULL,
+    0x8f8f8f8f8f8f8f8fULL, 0x9f9f9f9f9f9f9f9fULL, 0xbfbfbfbfbfbfbfbfULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4000000040000000ULL, 0xc0000000c0000000ULL, 0xc0000001c0000001ULL, 0xc0000003c0000003ULL,
+    0xc0000007c0000007ULL, 0xc000000fc000000fULL, 0xc000001fc000001fULL, 0xc000003fc000003fULL,
+    0xc000007fc000007fULL, 0xc00000ffc00000ffULL, 0xc00001ffc00001ffULL, 0xc00003ffc00003ffULL,
+    0xc00007ffc00007ffULL, 0xc0000fffc0000fffULL, 0xc0001fffc0001fffULL, 0xc0003fffc0003fffULL,
+    0xc0007fffc0007fffULL, 0xc000ffffc000ffffULL, 0xc001ffffc001ffffULL, 0xc003ffffc003ffffULL,
+    0xc007ffffc007ffffULL, 0xc00fffffc00fffffULL, 0xc01fffffc01fffffULL, 0xc03fffffc03fffffULL,
+    0xc07fffffc07fffffULL, 0xc0ffffffc0ffffffULL, 0xc1ffffffc1ffffffULL, 0xc3ffffffc3ffffffULL,
+    0xc7ffffffc7ffffffULL, 0xcfffffffcfffffffULL, 0xdfffffffdfffffffULL, 0x0000000000000000ULL,
+    0x4000400040004000ULL, 0xc000c000c000c000ULL, 0xc001c001c001c001ULL, 0xc003c003c003c003ULL,
+    0xc007c007c007c007ULL, 0xc00fc00fc00fc00fULL, 0xc01fc01fc01fc01fULL, 0xc03fc03fc03fc03fULL,
+    0xc07fc07fc07fc07fULL, 0xc0ffc0ffc0ffc0ffULL, 0xc1ffc1ffc1ffc1ffULL, 0xc3ffc3ffc3ffc3ffULL,
+    0xc7ffc7ffc7ffc7ffULL, 0xcfffcfffcfffcfffULL, 0xdfffdfffdfffdfffULL, 0x0000000000000000ULL,
+    0x4040404040404040ULL, 0xc0c0c0c0c0c0c0c0ULL, 0xc1c1c1c1c1c1c1c1ULL, 0xc3c3c3c3c3c3c3c3ULL,
+    0xc7c7c7c7c7c7c7c7ULL, 0xcfcfcfcfcfcfcfcfULL, 0xdfdfdfdfdfdfdfdfULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x2000000020000000ULL, 0x6000000060000000ULL, 0xe0000000e0000000ULL, 0xe0000001e0000001ULL,
+    0xe0000003e0000003ULL, 0xe0000007e0000007ULL, 0xe000000fe000000fULL, 0xe000001fe000001fULL,
+    0xe000003fe000003fULL, 0xe000007fe000007fULL, 0xe00000ffe00000ffULL, 0xe00001ffe00001ffULL,
+    0xe00003ffe00003ffULL, 0xe00007ffe00007ffULL, 0xe0000fffe0000fffULL, 0xe0001fffe0001fffULL,
+    0xe0003fffe0003fffULL, 0xe0007fffe0007fffULL, 0xe000ffffe000ffffULL, 0xe001ffffe001ffffULL,
+    0xe003ffffe003ffffULL, 0xe007ffffe007ffffULL, 0xe00fffffe00fffffULL, 0xe01fffffe01fffffULL,
+    0xe03fffffe03fffffULL, 0xe07fffffe07fffffULL, 0xe0ffffffe0ffffffULL, 0xe1ffffffe1ffffffULL,
+    0xe3ffffffe3ffffffULL, 0xe7ffffffe7ffffffULL, 0xefffffffefffffffULL, 0x0000000000000000ULL,
+    0x2000200020002000ULL, 0x6000600060006000ULL, 0xe000e000e000e000ULL, 0xe001e001e001e001ULL,
+    0xe003e003e003e003ULL, 0xe007e007e007e007ULL, 0xe00fe00fe00fe00fULL, 0xe01fe01fe01fe01fULL,
+    0xe03fe03fe03fe03fULL, 0xe07fe07fe07fe07fULL, 0xe0ffe0ffe0ffe0ffULL, 0xe1ffe1ffe1ffe1ffULL,
+    0xe3ffe3ffe3ffe3ffULL, 0xe7ffe7ffe7ffe7ffULL, 0xefffefffefffefffULL, 0x0000000000000000ULL,
+    0x2020202020202020ULL, 0x6060606060606060ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xe1e1e1e1e1e1e1e1ULL,
+    0xe3e3e3e3e3e3e3e3ULL, 0xe7e7e7e7e7e7e7e7ULL, 0xefefefefefefefefULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1000000010000000ULL, 0x3000000030000000ULL, 0x7000000070000000ULL, 0xf0000000f0000000ULL,
+    0xf0000001f0000001ULL, 0xf0000003f0000003ULL, 0xf0000007f0000007ULL, 0xf000000ff000000fULL,
+    0xf000001ff000001fULL, 0xf000003ff000003fULL, 0xf000007ff000007fULL, 0xf00000fff00000ffULL,
+    0xf00001fff00001ffULL, 0xf00003fff00003ffULL, 0xf00007fff00007ffULL, 0xf0000ffff0000fffULL,
+    0xf0001ffff0001fffULL, 0xf0003ffff0003fffULL, 0xf0007ffff0007fffULL, 0xf000fffff000ffffULL,
+    0xf001fffff001ffffULL, 0xf003fffff003ffffULL, 0xf007fffff007ffffULL, 0xf00ffffff00fffffULL,
+    0xf01ffffff01fffffULL, 0xf03ffffff03fffffULL, 0xf07ffffff07fffffULL, 0xf0fffffff0ffffffULL,
+    0xf1fffffff1ffffffULL, 0xf3fffffff3ffffffULL, 0xf7fffffff7ffffffULL, 0x0000000000000000ULL,
+    0x1000100010001000ULL, 0x3000300030003000ULL, 0x7000700070007000ULL, 0xf000f000f000f000ULL,
+    0xf001f001f001f001ULL, 0xf003f003f003f003ULL, 0xf007f007f007f007ULL, 0xf00ff00ff00ff00fULL,
+    0xf01ff01ff01ff01fULL, 0xf03ff03ff03ff03fULL, 0xf07ff07ff07ff07fULL, 0xf0fff0fff0fff0ffULL,
+    0xf1fff1fff1fff1ffULL, 0xf3fff3fff3fff3ffULL, 0xf7fff7fff7fff7ffULL, 0x0000000000000000ULL,
+    0x1010101010101010ULL, 0x3030303030303030ULL, 0x7070707070707070ULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xf1f1f1f1f1f1f1f1ULL, 0xf3f3f3f3f3f3f3f3ULL, 0xf7f7f7f7f7f7f7f7ULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0800000008000000ULL, 0x1800000018000000ULL, 0x3800000038000000ULL, 0x7800000078000000ULL,
+    0xf8000000f8000000ULL, 0xf8000001f8000001ULL, 0xf8000003f8000003ULL, 0xf8000007f8000007ULL,
+    0xf800000ff800000fULL, 0xf800001ff800001fULL, 0xf800003ff800003fULL, 0xf800007ff800007fULL,
+    0xf80000fff80000ffULL, 0xf80001fff80001ffULL, 0xf80003fff80003ffULL, 0xf80007fff80007ffULL,
+    0xf8000ffff8000fffULL, 0xf8001ffff8001fffULL, 0xf8003ffff8003fffULL, 0xf8007ffff8007fffULL,
+    0xf800fffff800ffffULL, 0xf801fffff801ffffULL, 0xf803fffff803ffffULL, 0xf807fffff807ffffULL,
+    0xf80ffffff80fffffULL, 0xf81ffffff81fffffULL, 0xf83ffffff83fffffULL, 0xf87ffffff87fffffULL,
+    0xf8fffffff8ffffffULL, 0xf9fffffff9ffffffULL, 0xfbfffffffbffffffULL, 0x0000000000000000ULL,
+    0x0800080008000800ULL, 0x1800180018001800ULL, 0x3800380038003800ULL, 0x7800780078007800ULL,
+    0xf800f800f800f800ULL, 0xf801f801f801f801ULL, 0xf803f803f803f803ULL, 0xf807f807f807f807ULL,
+    0xf80ff80ff80ff80fULL, 0xf81ff81ff81ff81fULL, 0xf83ff83ff83ff83fULL, 0xf87ff87ff87ff87fULL,
+    0xf8fff8fff8fff8ffULL, 0xf9fff9fff9fff9ffULL, 0xfbfffbfffbfffbffULL, 0x0000000000000000ULL,
+    0x0808080808080808ULL, 0x1818181818181818ULL, 0x3838383838383838ULL, 0x7878787878787878ULL,
+    0xf8f8f8f8f8f8f8f8ULL, 0xf9f9f9f9f9f9f9f9ULL, 0xfbfbfbfbfbfbfbfbULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0400000004000000ULL, 0x0c0000000c000000ULL, 0x1c0000001c000000ULL, 0x3c0000003c000000ULL,
+    0x7c0000007c000000ULL, 0xfc000000fc000000ULL, 0xfc000001fc000001ULL, 0xfc000003fc000003ULL,
+    0xfc000007fc000007ULL, 0xfc00000ffc00000fULL, 0xfc00001ffc00001fULL, 0xfc00003ffc00003fULL,
+    0xfc00007ffc00007fULL, 0xfc0000fffc0000ffULL, 0xfc0001fffc0001ffULL, 0xfc0003fffc0003ffULL,
+    0xfc0007fffc0007ffULL, 0xfc000ffffc000fffULL, 0xfc001ffffc001fffULL, 0xfc003ffffc003fffULL,
+    0xfc007ffffc007fffULL, 0xfc00fffffc00ffffULL, 0xfc01fffffc01ffffULL, 0xfc03fffffc03ffffULL,
+    0xfc07fffffc07ffffULL, 0xfc0ffffffc0fffffULL, 0xfc1ffffffc1fffffULL, 0xfc3ffffffc3fffffULL,
+    0xfc7ffffffc7fffffULL, 0xfcfffffffcffffffULL, 0xfdfffffffdffffffULL, 0x0000000000000000ULL,
+    0x0400040004000400ULL, 0x0c000c000c000c00ULL, 0x1c001c001c001c00ULL, 0x3c003c003c003c00ULL,
+    0x7c007c007c007c00ULL, 0xfc00fc00fc00fc00ULL, 0xfc01fc01fc01fc01ULL, 0xfc03fc03fc03fc03ULL,
+    0xfc07fc07fc07fc07ULL, 0xfc0ffc0ffc0ffc0fULL, 0xfc1ffc1ffc1ffc1fULL, 0xfc3ffc3ffc3ffc3fULL,
+    0xfc7ffc7ffc7ffc7fULL, 0xfcfffcfffcfffcffULL, 0xfdfffdfffdfffdffULL, 0x0000000000000000ULL,
+    0x0404040404040404ULL, 0x0c0c0c0c0c0c0c0cULL, 0x1c1c1c1c1c1c1c1cULL, 0x3c3c3c3c3c3c3c3cULL,
+    0x7c7c7c7c7c7c7c7cULL, 0xfcfcfcfcfcfcfcfcULL, 0xfdfdfdfdfdfdfdfdULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0200000002000000ULL, 0x0600000006000000ULL, 0x0e0000000e000000ULL, 0x1e0000001e000000ULL,
+    0x3e0000003e000000ULL, 0x7e0000007e000000ULL, 0xfe000000fe000000ULL, 0xfe000001fe000001ULL,
+    0xfe000003fe000003ULL, 0xfe000007fe000007ULL, 0xfe00000ffe00000fULL, 0xfe00001ffe00001fULL,
+    0xfe00003ffe00003fULL, 0xfe00007ffe00007fULL, 0xfe0000fffe0000ffULL, 0xfe0001fffe0001ffULL,
+    0xfe0003fffe0003ffULL, 0xfe0007fffe0007ffULL, 0xfe000ffffe000fffULL, 0xfe001ffffe001fffULL,
+    0xfe003ffffe003fffULL, 0xfe007ffffe007fffULL, 0xfe00fffffe00ffffULL, 0xfe01fffffe01ffffULL,
+    0xfe03fffffe03ffffULL, 0xfe07fffffe07ffffULL, 0xfe0ffffffe0fffffULL, 0xfe1ffffffe1fffffULL,
+    0xfe3ffffffe3fffffULL, 0xfe7ffffffe7fffffULL, 0xfefffffffeffffffULL, 0x0000000000000000ULL,
+    0x0200020002000200ULL, 0x0600060006000600ULL, 0x0e000e000e000e00ULL, 0x1e001e001e001e00ULL,
+    0x3e003e003e003e00ULL, 0x7e007e007e007e00ULL, 0xfe00fe00fe00fe00ULL, 0xfe01fe01fe01fe01ULL,
+    0xfe03fe03fe03fe03ULL, 0xfe07fe07fe07fe07ULL, 0xfe0ffe0ffe0ffe0fULL, 0xfe1ffe1ffe1ffe1fULL,
+    0xfe3ffe3ffe3ffe3fULL, 0xfe7ffe7ffe7ffe7fULL, 0xfefffefffefffeffULL, 0x0000000000000000ULL,
+    0x0202020202020202ULL, 0x0606060606060606ULL, 0x0e0e0e0e0e0e0e0eULL, 0x1e1e1e1e1e1e1e1eULL,
+    0x3e3e3e3e3e3e3e3eULL, 0x7e7e7e7e7e7e7e7eULL, 0xfefefefefefefefeULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0100000001000000ULL, 0x0300000003000000ULL, 0x0700000007000000ULL, 0x0f0000000f000000ULL,
+    0x1f0000001f000000ULL, 0x3f0000003f000000ULL, 0x7f0000007f000000ULL, 0xff000000ff000000ULL,
+    0xff000001ff000001ULL, 0xff000003ff000003ULL, 0xff000007ff000007ULL, 0xff00000fff00000fULL,
+    0xff00001fff00001fULL, 0xff00003fff00003fULL, 0xff00007fff00007fULL, 0xff0000ffff0000ffULL,
+    0xff0001ffff0001ffULL, 0xff0003ffff0003ffULL, 0xff0007ffff0007ffULL, 0xff000fffff000fffULL,
+    0xff001fffff001fffULL, 0xff003fffff003fffULL, 0xff007fffff007fffULL, 0xff00ffffff00ffffULL,
+    0xff01ffffff01ffffULL, 0xff03ffffff03ffffULL, 0xff07ffffff07ffffULL, 0xff0fffffff0fffffULL,
+    0xff1fffffff1fffffULL, 0xff3fffffff3fffffULL, 0xff7fffffff7fffffULL, 0x0000000000000000ULL,
+    0x0100010001000100ULL, 0x0300030003000300ULL, 0x0700070007000700ULL, 0x0f000f000f000f00ULL,
+    0x1f001f001f001f00ULL, 0x3f003f003f003f00ULL, 0x7f007f007f007f00ULL, 0xff00ff00ff00ff00ULL,
+    0xff01ff01ff01ff01ULL, 0xff03ff03ff03ff03ULL, 0xff07ff07ff07ff07ULL, 0xff0fff0fff0fff0fULL,
+    0xff1fff1fff1fff1fULL, 0xff3fff3fff3fff3fULL, 0xff7fff7fff7fff7fULL, 0x0000000000000000ULL,
+    0x0101010101010101ULL, 0x0303030303030303ULL, 0x0707070707070707ULL, 0x0f0f0f0f0f0f0f0fULL,
+    0x1f1f1f1f1f1f1f1fULL, 0x3f3f3f3f3f3f3f3fULL, 0x7f7f7f7f7f7f7f7fULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0080000000800000ULL, 0x0180000001800000ULL, 0x0380000003800000ULL, 0x0780000007800000ULL,
+    0x0f8000000f800000ULL, 0x1f8000001f800000ULL, 0x3f8000003f800000ULL, 0x7f8000007f800000ULL,
+    0xff800000ff800000ULL, 0xff800001ff800001ULL, 0xff800003ff800003ULL, 0xff800007ff800007ULL,
+    0xff80000fff80000fULL, 0xff80001fff80001fULL, 0xff80003fff80003fULL, 0xff80007fff80007fULL,
+    0xff8000ffff8000ffULL, 0xff8001ffff8001ffULL, 0xff8003ffff8003ffULL, 0xff8007ffff8007ffULL,
+    0xff800fffff800fffULL, 0xff801fffff801fffULL, 0xff803fffff803fffULL, 0xff807fffff807fffULL,
+    0xff80ffffff80ffffULL, 0xff81ffffff81ffffULL, 0xff83ffffff83ffffULL, 0xff87ffffff87ffffULL,
+    0xff8fffffff8fffffULL, 0xff9fffffff9fffffULL, 0xffbfffffffbfffffULL, 0x0000000000000000ULL,
+    0x0080008000800080ULL, 0x0180018001800180ULL, 0x0380038003800380ULL, 0x0780078007800780ULL,
+    0x0f800f800f800f80ULL, 0x1f801f801f801f80ULL, 0x3f803f803f803f80ULL, 0x7f807f807f807f80ULL,
+    0xff80ff80ff80ff80ULL, 0xff81ff81ff81ff81ULL, 0xff83ff83ff83ff83ULL, 0xff87ff87ff87ff87ULL,
+    0xff8fff8fff8fff8fULL, 0xff9fff9fff9fff9fULL, 0xffbfffbfffbfffbfULL, 0x0000000000000000ULL,
+    0x8080808080808080ULL, 0x8181818181818181ULL, 0x8383838383838383ULL, 0x8787878787878787ULL,
+    0x8f8f8f8f8f8f8f8fULL, 0x9f9f9f9f9f9f9f9fULL, 0xbfbfbfbfbfbfbfbfULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0040000000400000ULL, 0x00c0000000c00000ULL, 0x01c0000001c00000ULL, 0x03c0000003c00000ULL,
+    0x07c0000007c00000ULL, 0x0fc000000fc00000ULL, 0x1fc000001fc00000ULL, 0x3fc000003fc00000ULL,
+    0x7fc000007fc00000ULL, 0xffc00000ffc00000ULL, 0xffc00001ffc00001ULL, 0xffc00003ffc00003ULL,
+    0xffc00007ffc00007ULL, 0xffc0000fffc0000fULL, 0xffc0001fffc0001fULL, 0xffc0003fffc0003fULL,
+    0xffc0007fffc0007fULL, 0xffc000ffffc000ffULL, 0xffc001ffffc001ffULL, 0xffc003ffffc003ffULL,
+    0xffc007ffffc007ffULL, 0xffc00fffffc00fffULL, 0xffc01fffffc01fffULL, 0xffc03fffffc03fffULL,
+    0xffc07fffffc07fffULL, 0xffc0ffffffc0ffffULL, 0xffc1ffffffc1ffffULL, 0xffc3ffffffc3ffffULL,
+    0xffc7ffffffc7ffffULL, 0xffcfffffffcfffffULL, 0xffdfffffffdfffffULL, 0x0000000000000000ULL,
+    0x0040004000400040ULL, 0x00c000c000c000c0ULL, 0x01c001c001c001c0ULL, 0x03c003c003c003c0ULL,
+    0x07c007c007c007c0ULL, 0x0fc00fc00fc00fc0ULL, 0x1fc01fc01fc01fc0ULL, 0x3fc03fc03fc03fc0ULL,
+    0x7fc07fc07fc07fc0ULL, 0xffc0ffc0ffc0ffc0ULL, 0xffc1ffc1ffc1ffc1ULL, 0xffc3ffc3ffc3ffc3ULL,
+    0xffc7ffc7ffc7ffc7ULL, 0xffcfffcfffcfffcfULL, 0xffdfffdfffdfffdfULL, 0x0000000000000000ULL,
+    0x4040404040404040ULL, 0xc0c0c0c0c0c0c0c0ULL, 0xc1c1c1c1c1c1c1c1ULL, 0xc3c3c3c3c3c3c3c3ULL,
+    0xc7c7c7c7c7c7c7c7ULL, 0xcfcfcfcfcfcfcfcfULL, 0xdfdfdfdfdfdfdfdfULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0020000000200000ULL, 0x0060000000600000ULL, 0x00e0000000e00000ULL, 0x01e0000001e00000ULL,
+    0x03e0000003e00000ULL, 0x07e0000007e00000ULL, 0x0fe000000fe00000ULL, 0x1fe000001fe00000ULL,
+    0x3fe000003fe00000ULL, 0x7fe000007fe00000ULL, 0xffe00000ffe00000ULL, 0xffe00001ffe00001ULL,
+    0xffe00003ffe00003ULL, 0xffe00007ffe00007ULL, 0xffe0000fffe0000fULL, 0xffe0001fffe0001fULL,
+    0xffe0003fffe0003fULL, 0xffe0007fffe0007fULL, 0xffe000ffffe000ffULL, 0xffe001ffffe001ffULL,
+    0xffe003ffffe003ffULL, 0xffe007ffffe007ffULL, 0xffe00fffffe00fffULL, 0xffe01fffffe01fffULL,
+    0xffe03fffffe03fffULL, 0xffe07fffffe07fffULL, 0xffe0ffffffe0ffffULL, 0xffe1ffffffe1ffffULL,
+    0xffe3ffffffe3ffffULL, 0xffe7ffffffe7ffffULL, 0xffefffffffefffffULL, 0x0000000000000000ULL,
+    0x0020002000200020ULL, 0x0060006000600060ULL, 0x00e000e000e000e0ULL, 0x01e001e001e001e0ULL,
+    0x03e003e003e003e0ULL, 0x07e007e007e007e0ULL, 0x0fe00fe00fe00fe0ULL, 0x1fe01fe01fe01fe0ULL,
+    0x3fe03fe03fe03fe0ULL, 0x7fe07fe07fe07fe0ULL, 0xffe0ffe0ffe0ffe0ULL, 0xffe1ffe1ffe1ffe1ULL,
+    0xffe3ffe3ffe3ffe3ULL, 0xffe7ffe7ffe7ffe7ULL, 0xffefffefffefffefULL, 0x0000000000000000ULL,
+    0x2020202020202020ULL, 0x6060606060606060ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xe1e1e1e1e1e1e1e1ULL,
+    0xe3e3e3e3e3e3e3e3ULL, 0xe7e7e7e7e7e7e7e7ULL, 0xefefefefefefefefULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0010000000100000ULL, 0x0030000000300000ULL, 0x0070000000700000ULL, 0x00f0000000f00000ULL,
+    0x01f0000001f00000ULL, 0x03f0000003f00000ULL, 0x07f0000007f00000ULL, 0x0ff000000ff00000ULL,
+    0x1ff000001ff00000ULL, 0x3ff000003ff00000ULL, 0x7ff000007ff00000ULL, 0xfff00000fff00000ULL,
+    0xfff00001fff00001ULL, 0xfff00003fff00003ULL, 0xfff00007fff00007ULL, 0xfff0000ffff0000fULL,
+    0xfff0001ffff0001fULL, 0xfff0003ffff0003fULL, 0xfff0007ffff0007fULL, 0xfff000fffff000ffULL,
+    0xfff001fffff001ffULL, 0xfff003fffff003ffULL, 0xfff007fffff007ffULL, 0xfff00ffffff00fffULL,
+    0xfff01ffffff01fffULL, 0xfff03ffffff03fffULL, 0xfff07ffffff07fffULL, 0xfff0fffffff0ffffULL,
+    0xfff1fffffff1ffffULL, 0xfff3fffffff3ffffULL, 0xfff7fffffff7ffffULL, 0x0000000000000000ULL,
+    0x0010001000100010ULL, 0x0030003000300030ULL, 0x0070007000700070ULL, 0x00f000f000f000f0ULL,
+    0x01f001f001f001f0ULL, 0x03f003f003f003f0ULL, 0x07f007f007f007f0ULL, 0x0ff00ff00ff00ff0ULL,
+    0x1ff01ff01ff01ff0ULL, 0x3ff03ff03ff03ff0ULL, 0x7ff07ff07ff07ff0ULL, 0xfff0fff0fff0fff0ULL,
+    0xfff1fff1fff1fff1ULL, 0xfff3fff3fff3fff3ULL, 0xfff7fff7fff7fff7ULL, 0x0000000000000000ULL,
+    0x1010101010101010ULL, 0x3030303030303030ULL, 0x7070707070707070ULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xf1f1f1f1f1f1f1f1ULL, 0xf3f3f3f3f3f3f3f3ULL, 0xf7f7f7f7f7f7f7f7ULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0008000000080000ULL, 0x0018000000180000ULL, 0x0038000000380000ULL, 0x0078000000780000ULL,
+    0x00f8000000f80000ULL, 0x01f8000001f80000ULL, 0x03f8000003f80000ULL, 0x07f8000007f80000ULL,
+    0x0ff800000ff80000ULL, 0x1ff800001ff80000ULL, 0x3ff800003ff80000ULL, 0x7ff800007ff80000ULL,
+    0xfff80000fff80000ULL, 0xfff80001fff80001ULL, 0xfff80003fff80003ULL, 0xfff80007fff80007ULL,
+    0xfff8000ffff8000fULL, 0xfff8001ffff8001fULL, 0xfff8003ffff8003fULL, 0xfff8007ffff8007fULL,
+    0xfff800fffff800ffULL, 0xfff801fffff801ffULL, 0xfff803fffff803ffULL, 0xfff807fffff807ffULL,
+    0xfff80ffffff80fffULL, 0xfff81ffffff81fffULL, 0xfff83ffffff83fffULL, 0xfff87ffffff87fffULL,
+    0xfff8fffffff8ffffULL, 0xfff9fffffff9ffffULL, 0xfffbfffffffbffffULL, 0x0000000000000000ULL,
+    0x0008000800080008ULL, 0x0018001800180018ULL, 0x0038003800380038ULL, 0x0078007800780078ULL,
+    0x00f800f800f800f8ULL, 0x01f801f801f801f8ULL, 0x03f803f803f803f8ULL, 0x07f807f807f807f8ULL,
+    0x0ff80ff80ff80ff8ULL, 0x1ff81ff81ff81ff8ULL, 0x3ff83ff83ff83ff8ULL, 0x7ff87ff87ff87ff8ULL,
+    0xfff8fff8fff8fff8ULL, 0xfff9fff9fff9fff9ULL, 0xfffbfffbfffbfffbULL, 0x0000000000000000ULL,
+    0x0808080808080808ULL, 0x1818181818181818ULL, 0x3838383838383838ULL, 0x7878787878787878ULL,
+    0xf8f8f8f8f8f8f8f8ULL, 0xf9f9f9f9f9f9f9f9ULL, 0xfbfbfbfbfbfbfbfbULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0004000000040000ULL, 0x000c0000000c0000ULL, 0x001c0000001c0000ULL, 0x003c0000003c0000ULL,
+    0x007c0000007c0000ULL, 0x00fc000000fc0000ULL, 0x01fc000001fc0000ULL, 0x03fc000003fc0000ULL,
+    0x07fc000007fc0000ULL, 0x0ffc00000ffc0000ULL, 0x1ffc00001ffc0000ULL, 0x3ffc00003ffc0000ULL,
+    0x7ffc00007ffc0000ULL, 0xfffc0000fffc0000ULL, 0xfffc0001fffc0001ULL, 0xfffc0003fffc0003ULL,
+    0xfffc0007fffc0007ULL, 0xfffc000ffffc000fULL, 0xfffc001ffffc001fULL, 0xfffc003ffffc003fULL,
+    0xfffc007ffffc007fULL, 0xfffc00fffffc00ffULL, 0xfffc01fffffc01ffULL, 0xfffc03fffffc03ffULL,
+    0xfffc07fffffc07ffULL, 0xfffc0ffffffc0fffULL, 0xfffc1ffffffc1fffULL, 0xfffc3ffffffc3fffULL,
+    0xfffc7ffffffc7fffULL, 0xfffcfffffffcffffULL, 0xfffdfffffffdffffULL, 0x0000000000000000ULL,
+    0x0004000400040004ULL, 0x000c000c000c000cULL, 0x001c001c001c001cULL, 0x003c003c003c003cULL,
+    0x007c007c007c007cULL, 0x00fc00fc00fc00fcULL, 0x01fc01fc01fc01fcULL, 0x03fc03fc03fc03fcULL,
+    0x07fc07fc07fc07fcULL, 0x0ffc0ffc0ffc0ffcULL, 0x1ffc1ffc1ffc1ffcULL, 0x3ffc3ffc3ffc3ffcULL,
+    0x7ffc7ffc7ffc7ffcULL, 0xfffcfffcfffcfffcULL, 0xfffdfffdfffdfffdULL, 0x0000000000000000ULL,
+    0x0404040404040404ULL, 0x0c0c0c0c0c0c0c0cULL, 0x1c1c1c1c1c1c1c1cULL, 0x3c3c3c3c3c3c3c3cULL,
+    0x7c7c7c7c7c7c7c7cULL, 0xfcfcfcfcfcfcfcfcULL, 0xfdfdfdfdfdfdfdfdULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0002000000020000ULL, 0x0006000000060000ULL, 0x000e0000000e0000ULL, 0x001e0000001e0000ULL,
+    0x003e0000003e0000ULL, 0x007e0000007e0000ULL, 0x00fe000000fe0000ULL, 0x01fe000001fe0000ULL,
+    0x03fe000003fe0000ULL, 0x07fe000007fe0000ULL, 0x0ffe00000ffe0000ULL, 0x1ffe00001ffe0000ULL,
+    0x3ffe00003ffe0000ULL, 0x7ffe00007ffe0000ULL, 0xfffe0000fffe0000ULL, 0xfffe0001fffe0001ULL,
+    0xfffe0003fffe0003ULL, 0xfffe0007fffe0007ULL, 0xfffe000ffffe000fULL, 0xfffe001ffffe001fULL,
+    0xfffe003ffffe003fULL, 0xfffe007ffffe007fULL, 0xfffe00fffffe00ffULL, 0xfffe01fffffe01ffULL,
+    0xfffe03fffffe03ffULL, 0xfffe07fffffe07ffULL, 0xfffe0ffffffe0fffULL, 0xfffe1ffffffe1fffULL,
+    0xfffe3ffffffe3fffULL, 0xfffe7ffffffe7fffULL, 0xfffefffffffeffffULL, 0x0000000000000000ULL,
+    0x0002000200020002ULL, 0x0006000600060006ULL, 0x000e000e000e000eULL, 0x001e001e001e001eULL,
+    0x003e003e003e003eULL, 0x007e007e007e007eULL, 0x00fe00fe00fe00feULL, 0x01fe01fe01fe01feULL,
+    0x03fe03fe03fe03feULL, 0x07fe07fe07fe07feULL, 0x0ffe0ffe0ffe0ffeULL, 0x1ffe1ffe1ffe1ffeULL,
+    0x3ffe3ffe3ffe3ffeULL, 0x7ffe7ffe7ffe7ffeULL, 0xfffefffefffefffeULL, 0x0000000000000000ULL,
+    0x0202020202020202ULL, 0x0606060606060606ULL, 0x0e0e0e0e0e0e0e0eULL, 0x1e1e1e1e1e1e1e1eULL,
+    0x3e3e3e3e3e3e3e3eULL, 0x7e7e7e7e7e7e7e7eULL, 0xfefefefefefefefeULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0001000000010000ULL, 0x0003000000030000ULL, 0x0007000000070000ULL, 0x000f0000000f0000ULL,
+    0x001f0000001f0000ULL, 0x003f0000003f0000ULL, 0x007f0000007f0000ULL, 0x00ff000000ff0000ULL,
+    0x01ff000001ff0000ULL, 0x03ff000003ff0000ULL, 0x07ff000007ff0000ULL, 0x0fff00000fff0000ULL,
+    0x1fff00001fff0000ULL, 0x3fff00003fff0000ULL, 0x7fff00007fff0000ULL, 0xffff0000ffff0000ULL,
+    0xffff0001ffff0001ULL, 0xffff0003ffff0003ULL, 0xffff0007ffff0007ULL, 0xffff000fffff000fULL,
+    0xffff001fffff001fULL, 0xffff003fffff003fULL, 0xffff007fffff007fULL, 0xffff00ffffff00ffULL,
+    0xffff01ffffff01ffULL, 0xffff03ffffff03ffULL, 0xffff07ffffff07ffULL, 0xffff0fffffff0fffULL,
+    0xffff1fffffff1fffULL, 0xffff3fffffff3fffULL, 0xffff7fffffff7fffULL, 0x0000000000000000ULL,
+    0x0001000100010001ULL, 0x0003000300030003ULL, 0x0007000700070007ULL, 0x000f000f000f000fULL,
+    0x001f001f001f001fULL, 0x003f003f003f003fULL, 0x007f007f007f007fULL, 0x00ff00ff00ff00ffULL,
+    0x01ff01ff01ff01ffULL, 0x03ff03ff03ff03ffULL, 0x07ff07ff07ff07ffULL, 0x0fff0fff0fff0fffULL,
+    0x1fff1fff1fff1fffULL, 0x3fff3fff3fff3fffULL, 0x7fff7fff7fff7fffULL, 0x0000000000000000ULL,
+    0x0101010101010101ULL, 0x0303030303030303ULL, 0x0707070707070707ULL, 0x0f0f0f0f0f0f0f0fULL,
+    0x1f1f1f1f1f1f1f1fULL, 0x3f3f3f3f3f3f3f3fULL, 0x7f7f7f7f7f7f7f7fULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000800000008000ULL, 0x0001800000018000ULL, 0x0003800000038000ULL, 0x0007800000078000ULL,
+    0x000f8000000f8000ULL, 0x001f8000001f8000ULL, 0x003f8000003f8000ULL, 0x007f8000007f8000ULL,
+    0x00ff800000ff8000ULL, 0x01ff800001ff8000ULL, 0x03ff800003ff8000ULL, 0x07ff800007ff8000ULL,
+    0x0fff80000fff8000ULL, 0x1fff80001fff8000ULL, 0x3fff80003fff8000ULL, 0x7fff80007fff8000ULL,
+    0xffff8000ffff8000ULL, 0xffff8001ffff8001ULL, 0xffff8003ffff8003ULL, 0xffff8007ffff8007ULL,
+    0xffff800fffff800fULL, 0xffff801fffff801fULL, 0xffff803fffff803fULL, 0xffff807fffff807fULL,
+    0xffff80ffffff80ffULL, 0xffff81ffffff81ffULL, 0xffff83ffffff83ffULL, 0xffff87ffffff87ffULL,
+    0xffff8fffffff8fffULL, 0xffff9fffffff9fffULL, 0xffffbfffffffbfffULL, 0x0000000000000000ULL,
+    0x8000800080008000ULL, 0x8001800180018001ULL, 0x8003800380038003ULL, 0x8007800780078007ULL,
+    0x800f800f800f800fULL, 0x801f801f801f801fULL, 0x803f803f803f803fULL, 0x807f807f807f807fULL,
+    0x80ff80ff80ff80ffULL, 0x81ff81ff81ff81ffULL, 0x83ff83ff83ff83ffULL, 0x87ff87ff87ff87ffULL,
+    0x8fff8fff8fff8fffULL, 0x9fff9fff9fff9fffULL, 0xbfffbfffbfffbfffULL, 0x0000000000000000ULL,
+    0x8080808080808080ULL, 0x8181818181818181ULL, 0x8383838383838383ULL, 0x8787878787878787ULL,
+    0x8f8f8f8f8f8f8f8fULL, 0x9f9f9f9f9f9f9f9fULL, 0xbfbfbfbfbfbfbfbfULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000400000004000ULL, 0x0000c0000000c000ULL, 0x0001c0000001c000ULL, 0x0003c0000003c000ULL,
+    0x0007c0000007c000ULL, 0x000fc000000fc000ULL, 0x001fc000001fc000ULL, 0x003fc000003fc000ULL,
+    0x007fc000007fc000ULL, 0x00ffc00000ffc000ULL, 0x01ffc00001ffc000ULL, 0x03ffc00003ffc000ULL,
+    0x07ffc00007ffc000ULL, 0x0fffc0000fffc000ULL, 0x1fffc0001fffc000ULL, 0x3fffc0003fffc000ULL,
+    0x7fffc0007fffc000ULL, 0xffffc000ffffc000ULL, 0xffffc001ffffc001ULL, 0xffffc003ffffc003ULL,
+    0xffffc007ffffc007ULL, 0xffffc00fffffc00fULL, 0xffffc01fffffc01fULL, 0xffffc03fffffc03fULL,
+    0xffffc07fffffc07fULL, 0xffffc0ffffffc0ffULL, 0xffffc1ffffffc1ffULL, 0xffffc3ffffffc3ffULL,
+    0xffffc7ffffffc7ffULL, 0xffffcfffffffcfffULL, 0xffffdfffffffdfffULL, 0x0000000000000000ULL,
+    0x4000400040004000ULL, 0xc000c000c000c000ULL, 0xc001c001c001c001ULL, 0xc003c003c003c003ULL,
+    0xc007c007c007c007ULL, 0xc00fc00fc00fc00fULL, 0xc01fc01fc01fc01fULL, 0xc03fc03fc03fc03fULL,
+    0xc07fc07fc07fc07fULL, 0xc0ffc0ffc0ffc0ffULL, 0xc1ffc1ffc1ffc1ffULL, 0xc3ffc3ffc3ffc3ffULL,
+    0xc7ffc7ffc7ffc7ffULL, 0xcfffcfffcfffcfffULL, 0xdfffdfffdfffdfffULL, 0x0000000000000000ULL,
+    0x4040404040404040ULL, 0xc0c0c0c0c0c0c0c0ULL, 0xc1c1c1c1c1c1c1c1ULL, 0xc3c3c3c3c3c3c3c3ULL,
+    0xc7c7c7c7c7c7c7c7ULL, 0xcfcfcfcfcfcfcfcfULL, 0xdfdfdfdfdfdfdfdfULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000200000002000ULL, 0x0000600000006000ULL, 0x0000e0000000e000ULL, 0x0001e0000001e000ULL,
+    0x0003e0000003e000ULL, 0x0007e0000007e000ULL, 0x000fe000000fe000ULL, 0x001fe000001fe000ULL,
+    0x003fe000003fe000ULL, 0x007fe000007fe000ULL, 0x00ffe00000ffe000ULL, 0x01ffe00001ffe000ULL,
+    0x03ffe00003ffe000ULL, 0x07ffe00007ffe000ULL, 0x0fffe0000fffe000ULL, 0x1fffe0001fffe000ULL,
+    0x3fffe0003fffe000ULL, 0x7fffe0007fffe000ULL, 0xffffe000ffffe000ULL, 0xffffe001ffffe001ULL,
+    0xffffe003ffffe003ULL, 0xffffe007ffffe007ULL, 0xffffe00fffffe00fULL, 0xffffe01fffffe01fULL,
+    0xffffe03fffffe03fULL, 0xffffe07fffffe07fULL, 0xffffe0ffffffe0ffULL, 0xffffe1ffffffe1ffULL,
+    0xffffe3ffffffe3ffULL, 0xffffe7ffffffe7ffULL, 0xffffefffffffefffULL, 0x0000000000000000ULL,
+    0x2000200020002000ULL, 0x6000600060006000ULL, 0xe000e000e000e000ULL, 0xe001e001e001e001ULL,
+    0xe003e003e003e003ULL, 0xe007e007e007e007ULL, 0xe00fe00fe00fe00fULL, 0xe01fe01fe01fe01fULL,
+    0xe03fe03fe03fe03fULL, 0xe07fe07fe07fe07fULL, 0xe0ffe0ffe0ffe0ffULL, 0xe1ffe1ffe1ffe1ffULL,
+    0xe3ffe3ffe3ffe3ffULL, 0xe7ffe7ffe7ffe7ffULL, 0xefffefffefffefffULL, 0x0000000000000000ULL,
+    0x2020202020202020ULL, 0x6060606060606060ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xe1e1e1e1e1e1e1e1ULL,
+    0xe3e3e3e3e3e3e3e3ULL, 0xe7e7e7e7e7e7e7e7ULL, 0xefefefefefefefefULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000100000001000ULL, 0x0000300000003000ULL, 0x0000700000007000ULL, 0x0000f0000000f000ULL,
+    0x0001f0000001f000ULL, 0x0003f0000003f000ULL, 0x0007f0000007f000ULL, 0x000ff000000ff000ULL,
+    0x001ff000001ff000ULL, 0x003ff000003ff000ULL, 0x007ff000007ff000ULL, 0x00fff00000fff000ULL,
+    0x01fff00001fff000ULL, 0x03fff00003fff000ULL, 0x07fff00007fff000ULL, 0x0ffff0000ffff000ULL,
+    0x1ffff0001ffff000ULL, 0x3ffff0003ffff000ULL, 0x7ffff0007ffff000ULL, 0xfffff000fffff000ULL,
+    0xfffff001fffff001ULL, 0xfffff003fffff003ULL, 0xfffff007fffff007ULL, 0xfffff00ffffff00fULL,
+    0xfffff01ffffff01fULL, 0xfffff03ffffff03fULL, 0xfffff07ffffff07fULL, 0xfffff0fffffff0ffULL,
+    0xfffff1fffffff1ffULL, 0xfffff3fffffff3ffULL, 0xfffff7fffffff7ffULL, 0x0000000000000000ULL,
+    0x1000100010001000ULL, 0x3000300030003000ULL, 0x7000700070007000ULL, 0xf000f000f000f000ULL,
+    0xf001f001f001f001ULL, 0xf003f003f003f003ULL, 0xf007f007f007f007ULL, 0xf00ff00ff00ff00fULL,
+    0xf01ff01ff01ff01fULL, 0xf03ff03ff03ff03fULL, 0xf07ff07ff07ff07fULL, 0xf0fff0fff0fff0ffULL,
+    0xf1fff1fff1fff1ffULL, 0xf3fff3fff3fff3ffULL, 0xf7fff7fff7fff7ffULL, 0x0000000000000000ULL,
+    0x1010101010101010ULL, 0x3030303030303030ULL, 0x7070707070707070ULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xf1f1f1f1f1f1f1f1ULL, 0xf3f3f3f3f3f3f3f3ULL, 0xf7f7f7f7f7f7f7f7ULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000080000000800ULL, 0x0000180000001800ULL, 0x0000380000003800ULL, 0x0000780000007800ULL,
+    0x0000f8000000f800ULL, 0x0001f8000001f800ULL, 0x0003f8000003f800ULL, 0x0007f8000007f800ULL,
+    0x000ff800000ff800ULL, 0x001ff800001ff800ULL, 0x003ff800003ff800ULL, 0x007ff800007ff800ULL,
+    0x00fff80000fff800ULL, 0x01fff80001fff800ULL, 0x03fff80003fff800ULL, 0x07fff80007fff800ULL,
+    0x0ffff8000ffff800ULL, 0x1ffff8001ffff800ULL, 0x3ffff8003ffff800ULL, 0x7ffff8007ffff800ULL,
+    0xfffff800fffff800ULL, 0xfffff801fffff801ULL, 0xfffff803fffff803ULL, 0xfffff807fffff807ULL,
+    0xfffff80ffffff80fULL, 0xfffff81ffffff81fULL, 0xfffff83ffffff83fULL, 0xfffff87ffffff87fULL,
+    0xfffff8fffffff8ffULL, 0xfffff9fffffff9ffULL, 0xfffffbfffffffbffULL, 0x0000000000000000ULL,
+    0x0800080008000800ULL, 0x1800180018001800ULL, 0x3800380038003800ULL, 0x7800780078007800ULL,
+    0xf800f800f800f800ULL, 0xf801f801f801f801ULL, 0xf803f803f803f803ULL, 0xf807f807f807f807ULL,
+    0xf80ff80ff80ff80fULL, 0xf81ff81ff81ff81fULL, 0xf83ff83ff83ff83fULL, 0xf87ff87ff87ff87fULL,
+    0xf8fff8fff8fff8ffULL, 0xf9fff9fff9fff9ffULL, 0xfbfffbfffbfffbffULL, 0x0000000000000000ULL,
+    0x0808080808080808ULL, 0x1818181818181818ULL, 0x3838383838383838ULL, 0x7878787878787878ULL,
+    0xf8f8f8f8f8f8f8f8ULL, 0xf9f9f9f9f9f9f9f9ULL, 0xfbfbfbfbfbfbfbfbULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000040000000400ULL, 0x00000c0000000c00ULL, 0x00001c0000001c00ULL, 0x00003c0000003c00ULL,
+    0x00007c0000007c00ULL, 0x0000fc000000fc00ULL, 0x0001fc000001fc00ULL, 0x0003fc000003fc00ULL,
+    0x0007fc000007fc00ULL, 0x000ffc00000ffc00ULL, 0x001ffc00001ffc00ULL, 0x003ffc00003ffc00ULL,
+    0x007ffc00007ffc00ULL, 0x00fffc0000fffc00ULL, 0x01fffc0001fffc00ULL, 0x03fffc0003fffc00ULL,
+    0x07fffc0007fffc00ULL, 0x0ffffc000ffffc00ULL, 0x1ffffc001ffffc00ULL, 0x3ffffc003ffffc00ULL,
+    0x7ffffc007ffffc00ULL, 0xfffffc00fffffc00ULL, 0xfffffc01fffffc01ULL, 0xfffffc03fffffc03ULL,
+    0xfffffc07fffffc07ULL, 0xfffffc0ffffffc0fULL, 0xfffffc1ffffffc1fULL, 0xfffffc3ffffffc3fULL,
+    0xfffffc7ffffffc7fULL, 0xfffffcfffffffcffULL, 0xfffffdfffffffdffULL, 0x0000000000000000ULL,
+    0x0400040004000400ULL, 0x0c000c000c000c00ULL, 0x1c001c001c001c00ULL, 0x3c003c003c003c00ULL,
+    0x7c007c007c007c00ULL, 0xfc00fc00fc00fc00ULL, 0xfc01fc01fc01fc01ULL, 0xfc03fc03fc03fc03ULL,
+    0xfc07fc07fc07fc07ULL, 0xfc0ffc0ffc0ffc0fULL, 0xfc1ffc1ffc1ffc1fULL, 0xfc3ffc3ffc3ffc3fULL,
+    0xfc7ffc7ffc7ffc7fULL, 0xfcfffcfffcfffcffULL, 0xfdfffdfffdfffdffULL, 0x0000000000000000ULL,
+    0x0404040404040404ULL, 0x0c0c0c0c0c0c0c0cULL, 0x1c1c1c1c1c1c1c1cULL, 0x3c3c3c3c3c3c3c3cULL,
+    0x7c7c7c7c7c7c7c7cULL, 0xfcfcfcfcfcfcfcfcULL, 0xfdfdfdfdfdfdfdfdULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000020000000200ULL, 0x0000060000000600ULL, 0x00000e0000000e00ULL, 0x00001e0000001e00ULL,
+    0x00003e0000003e00ULL, 0x00007e0000007e00ULL, 0x0000fe000000fe00ULL, 0x0001fe000001fe00ULL,
+    0x0003fe000003fe00ULL, 0x0007fe000007fe00ULL, 0x000ffe00000ffe00ULL, 0x001ffe00001ffe00ULL,
+    0x003ffe00003ffe00ULL, 0x007ffe00007ffe00ULL, 0x00fffe0000fffe00ULL, 0x01fffe0001fffe00ULL,
+    0x03fffe0003fffe00ULL, 0x07fffe0007fffe00ULL, 0x0ffffe000ffffe00ULL, 0x1ffffe001ffffe00ULL,
+    0x3ffffe003ffffe00ULL, 0x7ffffe007ffffe00ULL, 0xfffffe00fffffe00ULL, 0xfffffe01fffffe01ULL,
+    0xfffffe03fffffe03ULL, 0xfffffe07fffffe07ULL, 0xfffffe0ffffffe0fULL, 0xfffffe1ffffffe1fULL,
+    0xfffffe3ffffffe3fULL, 0xfffffe7ffffffe7fULL, 0xfffffefffffffeffULL, 0x0000000000000000ULL,
+    0x0200020002000200ULL, 0x0600060006000600ULL, 0x0e000e000e000e00ULL, 0x1e001e001e001e00ULL,
+    0x3e003e003e003e00ULL, 0x7e007e007e007e00ULL, 0xfe00fe00fe00fe00ULL, 0xfe01fe01fe01fe01ULL,
+    0xfe03fe03fe03fe03ULL, 0xfe07fe07fe07fe07ULL, 0xfe0ffe0ffe0ffe0fULL, 0xfe1ffe1ffe1ffe1fULL,
+    0xfe3ffe3ffe3ffe3fULL, 0xfe7ffe7ffe7ffe7fULL, 0xfefffefffefffeffULL, 0x0000000000000000ULL,
+    0x0202020202020202ULL, 0x0606060606060606ULL, 0x0e0e0e0e0e0e0e0eULL, 0x1e1e1e1e1e1e1e1eULL,
+    0x3e3e3e3e3e3e3e3eULL, 0x7e7e7e7e7e7e7e7eULL, 0xfefefefefefefefeULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000010000000100ULL, 0x0000030000000300ULL, 0x0000070000000700ULL, 0x00000f0000000f00ULL,
+    0x00001f0000001f00ULL, 0x00003f0000003f00ULL, 0x00007f0000007f00ULL, 0x0000ff000000ff00ULL,
+    0x0001ff000001ff00ULL, 0x0003ff000003ff00ULL, 0x0007ff000007ff00ULL, 0x000fff00000fff00ULL,
+    0x001fff00001fff00ULL, 0x003fff00003fff00ULL, 0x007fff00007fff00ULL, 0x00ffff0000ffff00ULL,
+    0x01ffff0001ffff00ULL, 0x03ffff0003ffff00ULL, 0x07ffff0007ffff00ULL, 0x0fffff000fffff00ULL,
+    0x1fffff001fffff00ULL, 0x3fffff003fffff00ULL, 0x7fffff007fffff00ULL, 0xffffff00ffffff00ULL,
+    0xffffff01ffffff01ULL, 0xffffff03ffffff03ULL, 0xffffff07ffffff07ULL, 0xffffff0fffffff0fULL,
+    0xffffff1fffffff1fULL, 0xffffff3fffffff3fULL, 0xffffff7fffffff7fULL, 0x0000000000000000ULL,
+    0x0100010001000100ULL, 0x0300030003000300ULL, 0x0700070007000700ULL, 0x0f000f000f000f00ULL,
+    0x1f001f001f001f00ULL, 0x3f003f003f003f00ULL, 0x7f007f007f007f00ULL, 0xff00ff00ff00ff00ULL,
+    0xff01ff01ff01ff01ULL, 0xff03ff03ff03ff03ULL, 0xff07ff07ff07ff07ULL, 0xff0fff0fff0fff0fULL,
+    0xff1fff1fff1fff1fULL, 0xff3fff3fff3fff3fULL, 0xff7fff7fff7fff7fULL, 0x0000000000000000ULL,
+    0x0101010101010101ULL, 0x0303030303030303ULL, 0x0707070707070707ULL, 0x0f0f0f0f0f0f0f0fULL,
+    0x1f1f1f1f1f1f1f1fULL, 0x3f3f3f3f3f3f3f3fULL, 0x7f7f7f7f7f7f7f7fULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000008000000080ULL, 0x0000018000000180ULL, 0x0000038000000380ULL, 0x0000078000000780ULL,
+    0x00000f8000000f80ULL, 0x00001f8000001f80ULL, 0x00003f8000003f80ULL, 0x00007f8000007f80ULL,
+    0x0000ff800000ff80ULL, 0x0001ff800001ff80ULL, 0x0003ff800003ff80ULL, 0x0007ff800007ff80ULL,
+    0x000fff80000fff80ULL, 0x001fff80001fff80ULL, 0x003fff80003fff80ULL, 0x007fff80007fff80ULL,
+    0x00ffff8000ffff80ULL, 0x01ffff8001ffff80ULL, 0x03ffff8003ffff80ULL, 0x07ffff8007ffff80ULL,
+    0x0fffff800fffff80ULL, 0x1fffff801fffff80ULL, 0x3fffff803fffff80ULL, 0x7fffff807fffff80ULL,
+    0xffffff80ffffff80ULL, 0xffffff81ffffff81ULL, 0xffffff83ffffff83ULL, 0xffffff87ffffff87ULL,
+    0xffffff8fffffff8fULL, 0xffffff9fffffff9fULL, 0xffffffbfffffffbfULL, 0x0000000000000000ULL,
+    0x0080008000800080ULL, 0x0180018001800180ULL, 0x0380038003800380ULL, 0x0780078007800780ULL,
+    0x0f800f800f800f80ULL, 0x1f801f801f801f80ULL, 0x3f803f803f803f80ULL, 0x7f807f807f807f80ULL,
+    0xff80ff80ff80ff80ULL, 0xff81ff81ff81ff81ULL, 0xff83ff83ff83ff83ULL, 0xff87ff87ff87ff87ULL,
+    0xff8fff8fff8fff8fULL, 0xff9fff9fff9fff9fULL, 0xffbfffbfffbfffbfULL, 0x0000000000000000ULL,
+    0x8080808080808080ULL, 0x8181818181818181ULL, 0x8383838383838383ULL, 0x8787878787878787ULL,
+    0x8f8f8f8f8f8f8f8fULL, 0x9f9f9f9f9f9f9f9fULL, 0xbfbfbfbfbfbfbfbfULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000004000000040ULL, 0x000000c0000000c0ULL, 0x000001c0000001c0ULL, 0x000003c0000003c0ULL,
+    0x000007c0000007c0ULL, 0x00000fc000000fc0ULL, 0x00001fc000001fc0ULL, 0x00003fc000003fc0ULL,
+    0x00007fc000007fc0ULL, 0x0000ffc00000ffc0ULL, 0x0001ffc00001ffc0ULL, 0x0003ffc00003ffc0ULL,
+    0x0007ffc00007ffc0ULL, 0x000fffc0000fffc0ULL, 0x001fffc0001fffc0ULL, 0x003fffc0003fffc0ULL,
+    0x007fffc0007fffc0ULL, 0x00ffffc000ffffc0ULL, 0x01ffffc001ffffc0ULL, 0x03ffffc003ffffc0ULL,
+    0x07ffffc007ffffc0ULL, 0x0fffffc00fffffc0ULL, 0x1fffffc01fffffc0ULL, 0x3fffffc03fffffc0ULL,
+    0x7fffffc07fffffc0ULL, 0xffffffc0ffffffc0ULL, 0xffffffc1ffffffc1ULL, 0xffffffc3ffffffc3ULL,
+    0xffffffc7ffffffc7ULL, 0xffffffcfffffffcfULL, 0xffffffdfffffffdfULL, 0x0000000000000000ULL,
+    0x0040004000400040ULL, 0x00c000c000c000c0ULL, 0x01c001c001c001c0ULL, 0x03c003c003c003c0ULL,
+    0x07c007c007c007c0ULL, 0x0fc00fc00fc00fc0ULL, 0x1fc01fc01fc01fc0ULL, 0x3fc03fc03fc03fc0ULL,
+    0x7fc07fc07fc07fc0ULL, 0xffc0ffc0ffc0ffc0ULL, 0xffc1ffc1ffc1ffc1ULL, 0xffc3ffc3ffc3ffc3ULL,
+    0xffc7ffc7ffc7ffc7ULL, 0xffcfffcfffcfffcfULL, 0xffdfffdfffdfffdfULL, 0x0000000000000000ULL,
+    0x4040404040404040ULL, 0xc0c0c0c0c0c0c0c0ULL, 0xc1c1c1c1c1c1c1c1ULL, 0xc3c3c3c3c3c3c3c3ULL,
+    0xc7c7c7c7c7c7c7c7ULL, 0xcfcfcfcfcfcfcfcfULL, 0xdfdfdfdfdfdfdfdfULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000002000000020ULL, 0x0000006000000060ULL, 0x000000e0000000e0ULL, 0x000001e0000001e0ULL,
+    0x000003e0000003e0ULL, 0x000007e0000007e0ULL, 0x00000fe000000fe0ULL, 0x00001fe000001fe0ULL,
+    0x00003fe000003fe0ULL, 0x00007fe000007fe0ULL, 0x0000ffe00000ffe0ULL, 0x0001ffe00001ffe0ULL,
+    0x0003ffe00003ffe0ULL, 0x0007ffe00007ffe0ULL, 0x000fffe0000fffe0ULL, 0x001fffe0001fffe0ULL,
+    0x003fffe0003fffe0ULL, 0x007fffe0007fffe0ULL, 0x00ffffe000ffffe0ULL, 0x01ffffe001ffffe0ULL,
+    0x03ffffe003ffffe0ULL, 0x07ffffe007ffffe0ULL, 0x0fffffe00fffffe0ULL, 0x1fffffe01fffffe0ULL,
+    0x3fffffe03fffffe0ULL, 0x7fffffe07fffffe0ULL, 0xffffffe0ffffffe0ULL, 0xffffffe1ffffffe1ULL,
+    0xffffffe3ffffffe3ULL, 0xffffffe7ffffffe7ULL, 0xffffffefffffffefULL, 0x0000000000000000ULL,
+    0x0020002000200020ULL, 0x0060006000600060ULL, 0x00e000e000e000e0ULL, 0x01e001e001e001e0ULL,
+    0x03e003e003e003e0ULL, 0x07e007e007e007e0ULL, 0x0fe00fe00fe00fe0ULL, 0x1fe01fe01fe01fe0ULL,
+    0x3fe03fe03fe03fe0ULL, 0x7fe07fe07fe07fe0ULL, 0xffe0ffe0ffe0ffe0ULL, 0xffe1ffe1ffe1ffe1ULL,
+    0xffe3ffe3ffe3ffe3ULL, 0xffe7ffe7ffe7ffe7ULL, 0xffefffefffefffefULL, 0x0000000000000000ULL,
+    0x2020202020202020ULL, 0x6060606060606060ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xe1e1e1e1e1e1e1e1ULL,
+    0xe3e3e3e3e3e3e3e3ULL, 0xe7e7e7e7e7e7e7e7ULL, 0xefefefefefefefefULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000001000000010ULL, 0x0000003000000030ULL, 0x0000007000000070ULL, 0x000000f0000000f0ULL,
+    0x000001f0000001f0ULL, 0x000003f0000003f0ULL, 0x000007f0000007f0ULL, 0x00000ff000000ff0ULL,
+    0x00001ff000001ff0ULL, 0x00003ff000003ff0ULL, 0x00007ff000007ff0ULL, 0x0000fff00000fff0ULL,
+    0x0001fff00001fff0ULL, 0x0003fff00003fff0ULL, 0x0007fff00007fff0ULL, 0x000ffff0000ffff0ULL,
+    0x001ffff0001ffff0ULL, 0x003ffff0003ffff0ULL, 0x007ffff0007ffff0ULL, 0x00fffff000fffff0ULL,
+    0x01fffff001fffff0ULL, 0x03fffff003fffff0ULL, 0x07fffff007fffff0ULL, 0x0ffffff00ffffff0ULL,
+    0x1ffffff01ffffff0ULL, 0x3ffffff03ffffff0ULL, 0x7ffffff07ffffff0ULL, 0xfffffff0fffffff0ULL,
+    0xfffffff1fffffff1ULL, 0xfffffff3fffffff3ULL, 0xfffffff7fffffff7ULL, 0x0000000000000000ULL,
+    0x0010001000100010ULL, 0x0030003000300030ULL, 0x0070007000700070ULL, 0x00f000f000f000f0ULL,
+    0x01f001f001f001f0ULL, 0x03f003f003f003f0ULL, 0x07f007f007f007f0ULL, 0x0ff00ff00ff00ff0ULL,
+    0x1ff01ff01ff01ff0ULL, 0x3ff03ff03ff03ff0ULL, 0x7ff07ff07ff07ff0ULL, 0xfff0fff0fff0fff0ULL,
+    0xfff1fff1fff1fff1ULL, 0xfff3fff3fff3fff3ULL, 0xfff7fff7fff7fff7ULL, 0x0000000000000000ULL,
+    0x1010101010101010ULL, 0x3030303030303030ULL, 0x7070707070707070ULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xf1f1f1f1f1f1f1f1ULL, 0xf3f3f3f3f3f3f3f3ULL, 0xf7f7f7f7f7f7f7f7ULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000800000008ULL, 0x0000001800000018ULL, 0x0000003800000038ULL, 0x0000007800000078ULL,
+    0x000000f8000000f8ULL, 0x000001f8000001f8ULL, 0x000003f8000003f8ULL, 0x000007f8000007f8ULL,
+    0x00000ff800000ff8ULL, 0x00001ff800001ff8ULL, 0x00003ff800003ff8ULL, 0x00007ff800007ff8ULL,
+    0x0000fff80000fff8ULL, 0x0001fff80001fff8ULL, 0x0003fff80003fff8ULL, 0x0007fff80007fff8ULL,
+    0x000ffff8000ffff8ULL, 0x001ffff8001ffff8ULL, 0x003ffff8003ffff8ULL, 0x007ffff8007ffff8ULL,
+    0x00fffff800fffff8ULL, 0x01fffff801fffff8ULL, 0x03fffff803fffff8ULL, 0x07fffff807fffff8ULL,
+    0x0ffffff80ffffff8ULL, 0x1ffffff81ffffff8ULL, 0x3ffffff83ffffff8ULL, 0x7ffffff87ffffff8ULL,
+    0xfffffff8fffffff8ULL, 0xfffffff9fffffff9ULL, 0xfffffffbfffffffbULL, 0x0000000000000000ULL,
+    0x0008000800080008ULL, 0x0018001800180018ULL, 0x0038003800380038ULL, 0x0078007800780078ULL,
+    0x00f800f800f800f8ULL, 0x01f801f801f801f8ULL, 0x03f803f803f803f8ULL, 0x07f807f807f807f8ULL,
+    0x0ff80ff80ff80ff8ULL, 0x1ff81ff81ff81ff8ULL, 0x3ff83ff83ff83ff8ULL, 0x7ff87ff87ff87ff8ULL,
+    0xfff8fff8fff8fff8ULL, 0xfff9fff9fff9fff9ULL, 0xfffbfffbfffbfffbULL, 0x0000000000000000ULL,
+    0x0808080808080808ULL, 0x1818181818181818ULL, 0x3838383838383838ULL, 0x7878787878787878ULL,
+    0xf8f8f8f8f8f8f8f8ULL, 0xf9f9f9f9f9f9f9f9ULL, 0xfbfbfbfbfbfbfbfbULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000400000004ULL, 0x0000000c0000000cULL, 0x0000001c0000001cULL, 0x0000003c0000003cULL,
+    0x0000007c0000007cULL, 0x000000fc000000fcULL, 0x000001fc000001fcULL, 0x000003fc000003fcULL,
+    0x000007fc000007fcULL, 0x00000ffc00000ffcULL, 0x00001ffc00001ffcULL, 0x00003ffc00003ffcULL,
+    0x00007ffc00007ffcULL, 0x0000fffc0000fffcULL, 0x0001fffc0001fffcULL, 0x0003fffc0003fffcULL,
+    0x0007fffc0007fffcULL, 0x000ffffc000ffffcULL, 0x001ffffc001ffffcULL, 0x003ffffc003ffffcULL,
+    0x007ffffc007ffffcULL, 0x00fffffc00fffffcULL, 0x01fffffc01fffffcULL, 0x03fffffc03fffffcULL,
+    0x07fffffc07fffffcULL, 0x0ffffffc0ffffffcULL, 0x1ffffffc1ffffffcULL, 0x3ffffffc3ffffffcULL,
+    0x7ffffffc7ffffffcULL, 0xfffffffcfffffffcULL, 0xfffffffdfffffffdULL, 0x0000000000000000ULL,
+    0x0004000400040004ULL, 0x000c000c000c000cULL, 0x001c001c001c001cULL, 0x003c003c003c003cULL,
+    0x007c007c007c007cULL, 0x00fc00fc00fc00fcULL, 0x01fc01fc01fc01fcULL, 0x03fc03fc03fc03fcULL,
+    0x07fc07fc07fc07fcULL, 0x0ffc0ffc0ffc0ffcULL, 0x1ffc1ffc1ffc1ffcULL, 0x3ffc3ffc3ffc3ffcULL,
+    0x7ffc7ffc7ffc7ffcULL, 0xfffcfffcfffcfffcULL, 0xfffdfffdfffdfffdULL, 0x0000000000000000ULL,
+    0x0404040404040404ULL, 0x0c0c0c0c0c0c0c0cULL, 0x1c1c1c1c1c1c1c1cULL, 0x3c3c3c3c3c3c3c3cULL,
+    0x7c7c7c7c7c7c7c7cULL, 0xfcfcfcfcfcfcfcfcULL, 0xfdfdfdfdfdfdfdfdULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000200000002ULL, 0x0000000600000006ULL, 0x0000000e0000000eULL, 0x0000001e0000001eULL,
+    0x0000003e0000003eULL, 0x0000007e0000007eULL, 0x000000fe000000feULL, 0x000001fe000001feULL,
+    0x000003fe000003feULL, 0x000007fe000007feULL, 0x00000ffe00000ffeULL, 0x00001ffe00001ffeULL,
+    0x00003ffe00003ffeULL, 0x00007ffe00007ffeULL, 0x0000fffe0000fffeULL, 0x0001fffe0001fffeULL,
+    0x0003fffe0003fffeULL, 0x0007fffe0007fffeULL, 0x000ffffe000ffffeULL, 0x001ffffe001ffffeULL,
+    0x003ffffe003ffffeULL, 0x007ffffe007ffffeULL, 0x00fffffe00fffffeULL, 0x01fffffe01fffffeULL,
+    0x03fffffe03fffffeULL, 0x07fffffe07fffffeULL, 0x0ffffffe0ffffffeULL, 0x1ffffffe1ffffffeULL,
+    0x3ffffffe3ffffffeULL, 0x7ffffffe7ffffffeULL, 0xfffffffefffffffeULL, 0x0000000000000000ULL,
+    0x0002000200020002ULL, 0x0006000600060006ULL, 0x000e000e000e000eULL, 0x001e001e001e001eULL,
+    0x003e003e003e003eULL, 0x007e007e007e007eULL, 0x00fe00fe00fe00feULL, 0x01fe01fe01fe01feULL,
+    0x03fe03fe03fe03feULL, 0x07fe07fe07fe07feULL, 0x0ffe0ffe0ffe0ffeULL, 0x1ffe1ffe1ffe1ffeULL,
+    0x3ffe3ffe3ffe3ffeULL, 0x7ffe7ffe7ffe7ffeULL, 0xfffefffefffefffeULL, 0x0000000000000000ULL,
+    0x0202020202020202ULL, 0x0606060606060606ULL, 0x0e0e0e0e0e0e0e0eULL, 0x1e1e1e1e1e1e1e1eULL,
+    0x3e3e3e3e3e3e3e3eULL, 0x7e7e7e7e7e7e7e7eULL, 0xfefefefefefefefeULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000100000001ULL, 0x0000000300000003ULL, 0x0000000700000007ULL, 0x0000000f0000000fULL,
+    0x0000001f0000001fULL, 0x0000003f0000003fULL, 0x0000007f0000007fULL, 0x000000ff000000ffULL,
+    0x000001ff000001ffULL, 0x000003ff000003ffULL, 0x000007ff000007ffULL, 0x00000fff00000fffULL,
+    0x00001fff00001fffULL, 0x00003fff00003fffULL, 0x00007fff00007fffULL, 0x0000ffff0000ffffULL,
+    0x0001ffff0001ffffULL, 0x0003ffff0003ffffULL, 0x0007ffff0007ffffULL, 0x000fffff000fffffULL,
+    0x001fffff001fffffULL, 0x003fffff003fffffULL, 0x007fffff007fffffULL, 0x00ffffff00ffffffULL,
+    0x01ffffff01ffffffULL, 0x03ffffff03ffffffULL, 0x07ffffff07ffffffULL, 0x0fffffff0fffffffULL,
+    0x1fffffff1fffffffULL, 0x3fffffff3fffffffULL, 0x7fffffff7fffffffULL, 0x0000000000000000ULL,
+    0x0001000100010001ULL, 0x0003000300030003ULL, 0x0007000700070007ULL, 0x000f000f000f000fULL,
+    0x001f001f001f001fULL, 0x003f003f003f003fULL, 0x007f007f007f007fULL, 0x00ff00ff00ff00ffULL,
+    0x01ff01ff01ff01ffULL, 0x03ff03ff03ff03ffULL, 0x07ff07ff07ff07ffULL, 0x0fff0fff0fff0fffULL,
+    0x1fff1fff1fff1fffULL, 0x3fff3fff3fff3fffULL, 0x7fff7fff7fff7fffULL, 0x0000000000000000ULL,
+    0x0101010101010101ULL, 0x0303030303030303ULL, 0x0707070707070707ULL, 0x0f0f0f0f0f0f0f0fULL,
+    0x1f1f1f1f1f1f1f1fULL, 0x3f3f3f3f3f3f3f3fULL, 0x7f7f7f7f7f7f7f7fULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8000000080000000ULL, 0x8000000180000001ULL, 0x8000000380000003ULL, 0x8000000780000007ULL,
+    0x8000000f8000000fULL, 0x8000001f8000001fULL, 0x8000003f8000003fULL, 0x8000007f8000007fULL,
+    0x800000ff800000ffULL, 0x800001ff800001ffULL, 0x800003ff800003ffULL, 0x800007ff800007ffULL,
+    0x80000fff80000fffULL, 0x80001fff80001fffULL, 0x80003fff80003fffULL, 0x80007fff80007fffULL,
+    0x8000ffff8000ffffULL, 0x8001ffff8001ffffULL, 0x8003ffff8003ffffULL, 0x8007ffff8007ffffULL,
+    0x800fffff800fffffULL, 0x801fffff801fffffULL, 0x803fffff803fffffULL, 0x807fffff807fffffULL,
+    0x80ffffff80ffffffULL, 0x81ffffff81ffffffULL, 0x83ffffff83ffffffULL, 0x87ffffff87ffffffULL,
+    0x8fffffff8fffffffULL, 0x9fffffff9fffffffULL, 0xbfffffffbfffffffULL, 0x0000000000000000ULL,
+    0x8000800080008000ULL, 0x8001800180018001ULL, 0x8003800380038003ULL, 0x8007800780078007ULL,
+    0x800f800f800f800fULL, 0x801f801f801f801fULL, 0x803f803f803f803fULL, 0x807f807f807f807fULL,
+    0x80ff80ff80ff80ffULL, 0x81ff81ff81ff81ffULL, 0x83ff83ff83ff83ffULL, 0x87ff87ff87ff87ffULL,
+    0x8fff8fff8fff8fffULL, 0x9fff9fff9fff9fffULL, 0xbfffbfffbfffbfffULL, 0x0000000000000000ULL,
+    0x8080808080808080ULL, 0x8181818181818181ULL, 0x8383838383838383ULL, 0x8787878787878787ULL,
+    0x8f8f8f8f8f8f8f8fULL, 0x9f9f9f9f9f9f9f9fULL, 0xbfbfbfbfbfbfbfbfULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4000000040000000ULL, 0xc0000000c0000000ULL, 0xc0000001c0000001ULL, 0xc0000003c0000003ULL,
+    0xc0000007c0000007ULL, 0xc000000fc000000fULL, 0xc000001fc000001fULL, 0xc000003fc000003fULL,
+    0xc000007fc000007fULL, 0xc00000ffc00000ffULL, 0xc00001ffc00001ffULL, 0xc00003ffc00003ffULL,
+    0xc00007ffc00007ffULL, 0xc0000fffc0000fffULL, 0xc0001fffc0001fffULL, 0xc0003fffc0003fffULL,
+    0xc0007fffc0007fffULL, 0xc000ffffc000ffffULL, 0xc001ffffc001ffffULL, 0xc003ffffc003ffffULL,
+    0xc007ffffc007ffffULL, 0xc00fffffc00fffffULL, 0xc01fffffc01fffffULL, 0xc03fffffc03fffffULL,
+    0xc07fffffc07fffffULL, 0xc0ffffffc0ffffffULL, 0xc1ffffffc1ffffffULL, 0xc3ffffffc3ffffffULL,
+    0xc7ffffffc7ffffffULL, 0xcfffffffcfffffffULL, 0xdfffffffdfffffffULL, 0x0000000000000000ULL,
+    0x4000400040004000ULL, 0xc000c000c000c000ULL, 0xc001c001c001c001ULL, 0xc003c003c003c003ULL,
+    0xc007c007c007c007ULL, 0xc00fc00fc00fc00fULL, 0xc01fc01fc01fc01fULL, 0xc03fc03fc03fc03fULL,
+    0xc07fc07fc07fc07fULL, 0xc0ffc0ffc0ffc0ffULL, 0xc1ffc1ffc1ffc1ffULL, 0xc3ffc3ffc3ffc3ffULL,
+    0xc7ffc7ffc7ffc7ffULL, 0xcfffcfffcfffcfffULL, 0xdfffdfffdfffdfffULL, 0x0000000000000000ULL,
+    0x4040404040404040ULL, 0xc0c0c0c0c0c0c0c0ULL, 0xc1c1c1c1c1c1c1c1ULL, 0xc3c3c3c3c3c3c3c3ULL,
+    0xc7c7c7c7c7c7c7c7ULL, 0xcfcfcfcfcfcfcfcfULL, 0xdfdfdfdfdfdfdfdfULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x2000000020000000ULL, 0x6000000060000000ULL, 0xe0000000e0000000ULL, 0xe0000001e0000001ULL,
+    0xe0000003e0000003ULL, 0xe0000007e0000007ULL, 0xe000000fe000000fULL, 0xe000001fe000001fULL,
+    0xe000003fe000003fULL, 0xe000007fe000007fULL, 0xe00000ffe00000ffULL, 0xe00001ffe00001ffULL,
+    0xe00003ffe00003ffULL, 0xe00007ffe00007ffULL, 0xe0000fffe0000fffULL, 0xe0001fffe0001fffULL,
+    0xe0003fffe0003fffULL, 0xe0007fffe0007fffULL, 0xe000ffffe000ffffULL, 0xe001ffffe001ffffULL,
+    0xe003ffffe003ffffULL, 0xe007ffffe007ffffULL, 0xe00fffffe00fffffULL, 0xe01fffffe01fffffULL,
+    0xe03fffffe03fffffULL, 0xe07fffffe07fffffULL, 0xe0ffffffe0ffffffULL, 0xe1ffffffe1ffffffULL,
+    0xe3ffffffe3ffffffULL, 0xe7ffffffe7ffffffULL, 0xefffffffefffffffULL, 0x0000000000000000ULL,
+    0x2000200020002000ULL, 0x6000600060006000ULL, 0xe000e000e000e000ULL, 0xe001e001e001e001ULL,
+    0xe003e003e003e003ULL, 0xe007e007e007e007ULL, 0xe00fe00fe00fe00fULL, 0xe01fe01fe01fe01fULL,
+    0xe03fe03fe03fe03fULL, 0xe07fe07fe07fe07fULL, 0xe0ffe0ffe0ffe0ffULL, 0xe1ffe1ffe1ffe1ffULL,
+    0xe3ffe3ffe3ffe3ffULL, 0xe7ffe7ffe7ffe7ffULL, 0xefffefffefffefffULL, 0x0000000000000000ULL,
+    0x2020202020202020ULL, 0x6060606060606060ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xe1e1e1e1e1e1e1e1ULL,
+    0xe3e3e3e3e3e3e3e3ULL, 0xe7e7e7e7e7e7e7e7ULL, 0xefefefefefefefefULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1000000010000000ULL, 0x3000000030000000ULL, 0x7000000070000000ULL, 0xf0000000f0000000ULL,
+    0xf0000001f0000001ULL, 0xf0000003f0000003ULL, 0xf0000007f0000007ULL, 0xf000000ff000000fULL,
+    0xf000001ff000001fULL, 0xf000003ff000003fULL, 0xf000007ff000007fULL, 0xf00000fff00000ffULL,
+    0xf00001fff00001ffULL, 0xf00003fff00003ffULL, 0xf00007fff00007ffULL, 0xf0000ffff0000fffULL,
+    0xf0001ffff0001fffULL, 0xf0003ffff0003fffULL, 0xf0007ffff0007fffULL, 0xf000fffff000ffffULL,
+    0xf001fffff001ffffULL, 0xf003fffff003ffffULL, 0xf007fffff007ffffULL, 0xf00ffffff00fffffULL,
+    0xf01ffffff01fffffULL, 0xf03ffffff03fffffULL, 0xf07ffffff07fffffULL, 0xf0fffffff0ffffffULL,
+    0xf1fffffff1ffffffULL, 0xf3fffffff3ffffffULL, 0xf7fffffff7ffffffULL, 0x0000000000000000ULL,
+    0x1000100010001000ULL, 0x3000300030003000ULL, 0x7000700070007000ULL, 0xf000f000f000f000ULL,
+    0xf001f001f001f001ULL, 0xf003f003f003f003ULL, 0xf007f007f007f007ULL, 0xf00ff00ff00ff00fULL,
+    0xf01ff01ff01ff01fULL, 0xf03ff03ff03ff03fULL, 0xf07ff07ff07ff07fULL, 0xf0fff0fff0fff0ffULL,
+    0xf1fff1fff1fff1ffULL, 0xf3fff3fff3fff3ffULL, 0xf7fff7fff7fff7ffULL, 0x0000000000000000ULL,
+    0x1010101010101010ULL, 0x3030303030303030ULL, 0x7070707070707070ULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xf1f1f1f1f1f1f1f1ULL, 0xf3f3f3f3f3f3f3f3ULL, 0xf7f7f7f7f7f7f7f7ULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0800000008000000ULL, 0x1800000018000000ULL, 0x3800000038000000ULL, 0x7800000078000000ULL,
+    0xf8000000f8000000ULL, 0xf8000001f8000001ULL, 0xf8000003f8000003ULL, 0xf8000007f8000007ULL,
+    0xf800000ff800000fULL, 0xf800001ff800001fULL, 0xf800003ff800003fULL, 0xf800007ff800007fULL,
+    0xf80000fff80000ffULL, 0xf80001fff80001ffULL, 0xf80003fff80003ffULL, 0xf80007fff80007ffULL,
+    0xf8000ffff8000fffULL, 0xf8001ffff8001fffULL, 0xf8003ffff8003fffULL, 0xf8007ffff8007fffULL,
+    0xf800fffff800ffffULL, 0xf801fffff801ffffULL, 0xf803fffff803ffffULL, 0xf807fffff807ffffULL,
+    0xf80ffffff80fffffULL, 0xf81ffffff81fffffULL, 0xf83ffffff83fffffULL, 0xf87ffffff87fffffULL,
+    0xf8fffffff8ffffffULL, 0xf9fffffff9ffffffULL, 0xfbfffffffbffffffULL, 0x0000000000000000ULL,
+    0x0800080008000800ULL, 0x1800180018001800ULL, 0x3800380038003800ULL, 0x7800780078007800ULL,
+    0xf800f800f800f800ULL, 0xf801f801f801f801ULL, 0xf803f803f803f803ULL, 0xf807f807f807f807ULL,
+    0xf80ff80ff80ff80fULL, 0xf81ff81ff81ff81fULL, 0xf83ff83ff83ff83fULL, 0xf87ff87ff87ff87fULL,
+    0xf8fff8fff8fff8ffULL, 0xf9fff9fff9fff9ffULL, 0xfbfffbfffbfffbffULL, 0x0000000000000000ULL,
+    0x0808080808080808ULL, 0x1818181818181818ULL, 0x3838383838383838ULL, 0x7878787878787878ULL,
+    0xf8f8f8f8f8f8f8f8ULL, 0xf9f9f9f9f9f9f9f9ULL, 0xfbfbfbfbfbfbfbfbULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0400000004000000ULL, 0x0c0000000c000000ULL, 0x1c0000001c000000ULL, 0x3c0000003c000000ULL,
+    0x7c0000007c000000ULL, 0xfc000000fc000000ULL, 0xfc000001fc000001ULL, 0xfc000003fc000003ULL,
+    0xfc000007fc000007ULL, 0xfc00000ffc00000fULL, 0xfc00001ffc00001fULL, 0xfc00003ffc00003fULL,
+    0xfc00007ffc00007fULL, 0xfc0000fffc0000ffULL, 0xfc0001fffc0001ffULL, 0xfc0003fffc0003ffULL,
+    0xfc0007fffc0007ffULL, 0xfc000ffffc000fffULL, 0xfc001ffffc001fffULL, 0xfc003ffffc003fffULL,
+    0xfc007ffffc007fffULL, 0xfc00fffffc00ffffULL, 0xfc01fffffc01ffffULL, 0xfc03fffffc03ffffULL,
+    0xfc07fffffc07ffffULL, 0xfc0ffffffc0fffffULL, 0xfc1ffffffc1fffffULL, 0xfc3ffffffc3fffffULL,
+    0xfc7ffffffc7fffffULL, 0xfcfffffffcffffffULL, 0xfdfffffffdffffffULL, 0x0000000000000000ULL,
+    0x0400040004000400ULL, 0x0c000c000c000c00ULL, 0x1c001c001c001c00ULL, 0x3c003c003c003c00ULL,
+    0x7c007c007c007c00ULL, 0xfc00fc00fc00fc00ULL, 0xfc01fc01fc01fc01ULL, 0xfc03fc03fc03fc03ULL,
+    0xfc07fc07fc07fc07ULL, 0xfc0ffc0ffc0ffc0fULL, 0xfc1ffc1ffc1ffc1fULL, 0xfc3ffc3ffc3ffc3fULL,
+    0xfc7ffc7ffc7ffc7fULL, 0xfcfffcfffcfffcffULL, 0xfdfffdfffdfffdffULL, 0x0000000000000000ULL,
+    0x0404040404040404ULL, 0x0c0c0c0c0c0c0c0cULL, 0x1c1c1c1c1c1c1c1cULL, 0x3c3c3c3c3c3c3c3cULL,
+    0x7c7c7c7c7c7c7c7cULL, 0xfcfcfcfcfcfcfcfcULL, 0xfdfdfdfdfdfdfdfdULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0200000002000000ULL, 0x0600000006000000ULL, 0x0e0000000e000000ULL, 0x1e0000001e000000ULL,
+    0x3e0000003e000000ULL, 0x7e0000007e000000ULL, 0xfe000000fe000000ULL, 0xfe000001fe000001ULL,
+    0xfe000003fe000003ULL, 0xfe000007fe000007ULL, 0xfe00000ffe00000fULL, 0xfe00001ffe00001fULL,
+    0xfe00003ffe00003fULL, 0xfe00007ffe00007fULL, 0xfe0000fffe0000ffULL, 0xfe0001fffe0001ffULL,
+    0xfe0003fffe0003ffULL, 0xfe0007fffe0007ffULL, 0xfe000ffffe000fffULL, 0xfe001ffffe001fffULL,
+    0xfe003ffffe003fffULL, 0xfe007ffffe007fffULL, 0xfe00fffffe00ffffULL, 0xfe01fffffe01ffffULL,
+    0xfe03fffffe03ffffULL, 0xfe07fffffe07ffffULL, 0xfe0ffffffe0fffffULL, 0xfe1ffffffe1fffffULL,
+    0xfe3ffffffe3fffffULL, 0xfe7ffffffe7fffffULL, 0xfefffffffeffffffULL, 0x0000000000000000ULL,
+    0x0200020002000200ULL, 0x0600060006000600ULL, 0x0e000e000e000e00ULL, 0x1e001e001e001e00ULL,
+    0x3e003e003e003e00ULL, 0x7e007e007e007e00ULL, 0xfe00fe00fe00fe00ULL, 0xfe01fe01fe01fe01ULL,
+    0xfe03fe03fe03fe03ULL, 0xfe07fe07fe07fe07ULL, 0xfe0ffe0ffe0ffe0fULL, 0xfe1ffe1ffe1ffe1fULL,
+    0xfe3ffe3ffe3ffe3fULL, 0xfe7ffe7ffe7ffe7fULL, 0xfefffefffefffeffULL, 0x0000000000000000ULL,
+    0x0202020202020202ULL, 0x0606060606060606ULL, 0x0e0e0e0e0e0e0e0eULL, 0x1e1e1e1e1e1e1e1eULL,
+    0x3e3e3e3e3e3e3e3eULL, 0x7e7e7e7e7e7e7e7eULL, 0xfefefefefefefefeULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0100000001000000ULL, 0x0300000003000000ULL, 0x0700000007000000ULL, 0x0f0000000f000000ULL,
+    0x1f0000001f000000ULL, 0x3f0000003f000000ULL, 0x7f0000007f000000ULL, 0xff000000ff000000ULL,
+    0xff000001ff000001ULL, 0xff000003ff000003ULL, 0xff000007ff000007ULL, 0xff00000fff00000fULL,
+    0xff00001fff00001fULL, 0xff00003fff00003fULL, 0xff00007fff00007fULL, 0xff0000ffff0000ffULL,
+    0xff0001ffff0001ffULL, 0xff0003ffff0003ffULL, 0xff0007ffff0007ffULL, 0xff000fffff000fffULL,
+    0xff001fffff001fffULL, 0xff003fffff003fffULL, 0xff007fffff007fffULL, 0xff00ffffff00ffffULL,
+    0xff01ffffff01ffffULL, 0xff03ffffff03ffffULL, 0xff07ffffff07ffffULL, 0xff0fffffff0fffffULL,
+    0xff1fffffff1fffffULL, 0xff3fffffff3fffffULL, 0xff7fffffff7fffffULL, 0x0000000000000000ULL,
+    0x0100010001000100ULL, 0x0300030003000300ULL, 0x0700070007000700ULL, 0x0f000f000f000f00ULL,
+    0x1f001f001f001f00ULL, 0x3f003f003f003f00ULL, 0x7f007f007f007f00ULL, 0xff00ff00ff00ff00ULL,
+    0xff01ff01ff01ff01ULL, 0xff03ff03ff03ff03ULL, 0xff07ff07ff07ff07ULL, 0xff0fff0fff0fff0fULL,
+    0xff1fff1fff1fff1fULL, 0xff3fff3fff3fff3fULL, 0xff7fff7fff7fff7fULL, 0x0000000000000000ULL,
+    0x0101010101010101ULL, 0x0303030303030303ULL, 0x0707070707070707ULL, 0x0f0f0f0f0f0f0f0fULL,
+    0x1f1f1f1f1f1f1f1fULL, 0x3f3f3f3f3f3f3f3fULL, 0x7f7f7f7f7f7f7f7fULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0080000000800000ULL, 0x0180000001800000ULL, 0x0380000003800000ULL, 0x0780000007800000ULL,
+    0x0f8000000f800000ULL, 0x1f8000001f800000ULL, 0x3f8000003f800000ULL, 0x7f8000007f800000ULL,
+    0xff800000ff800000ULL, 0xff800001ff800001ULL, 0xff800003ff800003ULL, 0xff800007ff800007ULL,
+    0xff80000fff80000fULL, 0xff80001fff80001fULL, 0xff80003fff80003fULL, 0xff80007fff80007fULL,
+    0xff8000ffff8000ffULL, 0xff8001ffff8001ffULL, 0xff8003ffff8003ffULL, 0xff8007ffff8007ffULL,
+    0xff800fffff800fffULL, 0xff801fffff801fffULL, 0xff803fffff803fffULL, 0xff807fffff807fffULL,
+    0xff80ffffff80ffffULL, 0xff81ffffff81ffffULL, 0xff83ffffff83ffffULL, 0xff87ffffff87ffffULL,
+    0xff8fffffff8fffffULL, 0xff9fffffff9fffffULL, 0xffbfffffffbfffffULL, 0x0000000000000000ULL,
+    0x0080008000800080ULL, 0x0180018001800180ULL, 0x0380038003800380ULL, 0x0780078007800780ULL,
+    0x0f800f800f800f80ULL, 0x1f801f801f801f80ULL, 0x3f803f803f803f80ULL, 0x7f807f807f807f80ULL,
+    0xff80ff80ff80ff80ULL, 0xff81ff81ff81ff81ULL, 0xff83ff83ff83ff83ULL, 0xff87ff87ff87ff87ULL,
+    0xff8fff8fff8fff8fULL, 0xff9fff9fff9fff9fULL, 0xffbfffbfffbfffbfULL, 0x0000000000000000ULL,
+    0x8080808080808080ULL, 0x8181818181818181ULL, 0x8383838383838383ULL, 0x8787878787878787ULL,
+    0x8f8f8f8f8f8f8f8fULL, 0x9f9f9f9f9f9f9f9fULL, 0xbfbfbfbfbfbfbfbfULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0040000000400000ULL, 0x00c0000000c00000ULL, 0x01c0000001c00000ULL, 0x03c0000003c00000ULL,
+    0x07c0000007c00000ULL, 0x0fc000000fc00000ULL, 0x1fc000001fc00000ULL, 0x3fc000003fc00000ULL,
+    0x7fc000007fc00000ULL, 0xffc00000ffc00000ULL, 0xffc00001ffc00001ULL, 0xffc00003ffc00003ULL,
+    0xffc00007ffc00007ULL, 0xffc0000fffc0000fULL, 0xffc0001fffc0001fULL, 0xffc0003fffc0003fULL,
+    0xffc0007fffc0007fULL, 0xffc000ffffc000ffULL, 0xffc001ffffc001ffULL, 0xffc003ffffc003ffULL,
+    0xffc007ffffc007ffULL, 0xffc00fffffc00fffULL, 0xffc01fffffc01fffULL, 0xffc03fffffc03fffULL,
+    0xffc07fffffc07fffULL, 0xffc0ffffffc0ffffULL, 0xffc1ffffffc1ffffULL, 0xffc3ffffffc3ffffULL,
+    0xffc7ffffffc7ffffULL, 0xffcfffffffcfffffULL, 0xffdfffffffdfffffULL, 0x0000000000000000ULL,
+    0x0040004000400040ULL, 0x00c000c000c000c0ULL, 0x01c001c001c001c0ULL, 0x03c003c003c003c0ULL,
+    0x07c007c007c007c0ULL, 0x0fc00fc00fc00fc0ULL, 0x1fc01fc01fc01fc0ULL, 0x3fc03fc03fc03fc0ULL,
+    0x7fc07fc07fc07fc0ULL, 0xffc0ffc0ffc0ffc0ULL, 0xffc1ffc1ffc1ffc1ULL, 0xffc3ffc3ffc3ffc3ULL,
+    0xffc7ffc7ffc7ffc7ULL, 0xffcfffcfffcfffcfULL, 0xffdfffdfffdfffdfULL, 0x0000000000000000ULL,
+    0x4040404040404040ULL, 0xc0c0c0c0c0c0c0c0ULL, 0xc1c1c1c1c1c1c1c1ULL, 0xc3c3c3c3c3c3c3c3ULL,
+    0xc7c7c7c7c7c7c7c7ULL, 0xcfcfcfcfcfcfcfcfULL, 0xdfdfdfdfdfdfdfdfULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0020000000200000ULL, 0x0060000000600000ULL, 0x00e0000000e00000ULL, 0x01e0000001e00000ULL,
+    0x03e0000003e00000ULL, 0x07e0000007e00000ULL, 0x0fe000000fe00000ULL, 0x1fe000001fe00000ULL,
+    0x3fe000003fe00000ULL, 0x7fe000007fe00000ULL, 0xffe00000ffe00000ULL, 0xffe00001ffe00001ULL,
+    0xffe00003ffe00003ULL, 0xffe00007ffe00007ULL, 0xffe0000fffe0000fULL, 0xffe0001fffe0001fULL,
+    0xffe0003fffe0003fULL, 0xffe0007fffe0007fULL, 0xffe000ffffe000ffULL, 0xffe001ffffe001ffULL,
+    0xffe003ffffe003ffULL, 0xffe007ffffe007ffULL, 0xffe00fffffe00fffULL, 0xffe01fffffe01fffULL,
+    0xffe03fffffe03fffULL, 0xffe07fffffe07fffULL, 0xffe0ffffffe0ffffULL, 0xffe1ffffffe1ffffULL,
+    0xffe3ffffffe3ffffULL, 0xffe7ffffffe7ffffULL, 0xffefffffffefffffULL, 0x0000000000000000ULL,
+    0x0020002000200020ULL, 0x0060006000600060ULL, 0x00e000e000e000e0ULL, 0x01e001e001e001e0ULL,
+    0x03e003e003e003e0ULL, 0x07e007e007e007e0ULL, 0x0fe00fe00fe00fe0ULL, 0x1fe01fe01fe01fe0ULL,
+    0x3fe03fe03fe03fe0ULL, 0x7fe07fe07fe07fe0ULL, 0xffe0ffe0ffe0ffe0ULL, 0xffe1ffe1ffe1ffe1ULL,
+    0xffe3ffe3ffe3ffe3ULL, 0xffe7ffe7ffe7ffe7ULL, 0xffefffefffefffefULL, 0x0000000000000000ULL,
+    0x2020202020202020ULL, 0x6060606060606060ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xe1e1e1e1e1e1e1e1ULL,
+    0xe3e3e3e3e3e3e3e3ULL, 0xe7e7e7e7e7e7e7e7ULL, 0xefefefefefefefefULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0010000000100000ULL, 0x0030000000300000ULL, 0x0070000000700000ULL, 0x00f0000000f00000ULL,
+    0x01f0000001f00000ULL, 0x03f0000003f00000ULL, 0x07f0000007f00000ULL, 0x0ff000000ff00000ULL,
+    0x1ff000001ff00000ULL, 0x3ff000003ff00000ULL, 0x7ff000007ff00000ULL, 0xfff00000fff00000ULL,
+    0xfff00001fff00001ULL, 0xfff00003fff00003ULL, 0xfff00007fff00007ULL, 0xfff0000ffff0000fULL,
+    0xfff0001ffff0001fULL, 0xfff0003ffff0003fULL, 0xfff0007ffff0007fULL, 0xfff000fffff000ffULL,
+    0xfff001fffff001ffULL, 0xfff003fffff003ffULL, 0xfff007fffff007ffULL, 0xfff00ffffff00fffULL,
+    0xfff01ffffff01fffULL, 0xfff03ffffff03fffULL, 0xfff07ffffff07fffULL, 0xfff0fffffff0ffffULL,
+    0xfff1fffffff1ffffULL, 0xfff3fffffff3ffffULL, 0xfff7fffffff7ffffULL, 0x0000000000000000ULL,
+    0x0010001000100010ULL, 0x0030003000300030ULL, 0x0070007000700070ULL, 0x00f000f000f000f0ULL,
+    0x01f001f001f001f0ULL, 0x03f003f003f003f0ULL, 0x07f007f007f007f0ULL, 0x0ff00ff00ff00ff0ULL,
+    0x1ff01ff01ff01ff0ULL, 0x3ff03ff03ff03ff0ULL, 0x7ff07ff07ff07ff0ULL, 0xfff0fff0fff0fff0ULL,
+    0xfff1fff1fff1fff1ULL, 0xfff3fff3fff3fff3ULL, 0xfff7fff7fff7fff7ULL, 0x0000000000000000ULL,
+    0x1010101010101010ULL, 0x3030303030303030ULL, 0x7070707070707070ULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xf1f1f1f1f1f1f1f1ULL, 0xf3f3f3f3f3f3f3f3ULL, 0xf7f7f7f7f7f7f7f7ULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0008000000080000ULL, 0x0018000000180000ULL, 0x0038000000380000ULL, 0x0078000000780000ULL,
+    0x00f8000000f80000ULL, 0x01f8000001f80000ULL, 0x03f8000003f80000ULL, 0x07f8000007f80000ULL,
+    0x0ff800000ff80000ULL, 0x1ff800001ff80000ULL, 0x3ff800003ff80000ULL, 0x7ff800007ff80000ULL,
+    0xfff80000fff80000ULL, 0xfff80001fff80001ULL, 0xfff80003fff80003ULL, 0xfff80007fff80007ULL,
+    0xfff8000ffff8000fULL, 0xfff8001ffff8001fULL, 0xfff8003ffff8003fULL, 0xfff8007ffff8007fULL,
+    0xfff800fffff800ffULL, 0xfff801fffff801ffULL, 0xfff803fffff803ffULL, 0xfff807fffff807ffULL,
+    0xfff80ffffff80fffULL, 0xfff81ffffff81fffULL, 0xfff83ffffff83fffULL, 0xfff87ffffff87fffULL,
+    0xfff8fffffff8ffffULL, 0xfff9fffffff9ffffULL, 0xfffbfffffffbffffULL, 0x0000000000000000ULL,
+    0x0008000800080008ULL, 0x0018001800180018ULL, 0x0038003800380038ULL, 0x0078007800780078ULL,
+    0x00f800f800f800f8ULL, 0x01f801f801f801f8ULL, 0x03f803f803f803f8ULL, 0x07f807f807f807f8ULL,
+    0x0ff80ff80ff80ff8ULL, 0x1ff81ff81ff81ff8ULL, 0x3ff83ff83ff83ff8ULL, 0x7ff87ff87ff87ff8ULL,
+    0xfff8fff8fff8fff8ULL, 0xfff9fff9fff9fff9ULL, 0xfffbfffbfffbfffbULL, 0x0000000000000000ULL,
+    0x0808080808080808ULL, 0x1818181818181818ULL, 0x3838383838383838ULL, 0x7878787878787878ULL,
+    0xf8f8f8f8f8f8f8f8ULL, 0xf9f9f9f9f9f9f9f9ULL, 0xfbfbfbfbfbfbfbfbULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0004000000040000ULL, 0x000c0000000c0000ULL, 0x001c0000001c0000ULL, 0x003c0000003c0000ULL,
+    0x007c0000007c0000ULL, 0x00fc000000fc0000ULL, 0x01fc000001fc0000ULL, 0x03fc000003fc0000ULL,
+    0x07fc000007fc0000ULL, 0x0ffc00000ffc0000ULL, 0x1ffc00001ffc0000ULL, 0x3ffc00003ffc0000ULL,
+    0x7ffc00007ffc0000ULL, 0xfffc0000fffc0000ULL, 0xfffc0001fffc0001ULL, 0xfffc0003fffc0003ULL,
+    0xfffc0007fffc0007ULL, 0xfffc000ffffc000fULL, 0xfffc001ffffc001fULL, 0xfffc003ffffc003fULL,
+    0xfffc007ffffc007fULL, 0xfffc00fffffc00ffULL, 0xfffc01fffffc01ffULL, 0xfffc03fffffc03ffULL,
+    0xfffc07fffffc07ffULL, 0xfffc0ffffffc0fffULL, 0xfffc1ffffffc1fffULL, 0xfffc3ffffffc3fffULL,
+    0xfffc7ffffffc7fffULL, 0xfffcfffffffcffffULL, 0xfffdfffffffdffffULL, 0x0000000000000000ULL,
+    0x0004000400040004ULL, 0x000c000c000c000cULL, 0x001c001c001c001cULL, 0x003c003c003c003cULL,
+    0x007c007c007c007cULL, 0x00fc00fc00fc00fcULL, 0x01fc01fc01fc01fcULL, 0x03fc03fc03fc03fcULL,
+    0x07fc07fc07fc07fcULL, 0x0ffc0ffc0ffc0ffcULL, 0x1ffc1ffc1ffc1ffcULL, 0x3ffc3ffc3ffc3ffcULL,
+    0x7ffc7ffc7ffc7ffcULL, 0xfffcfffcfffcfffcULL, 0xfffdfffdfffdfffdULL, 0x0000000000000000ULL,
+    0x0404040404040404ULL, 0x0c0c0c0c0c0c0c0cULL, 0x1c1c1c1c1c1c1c1cULL, 0x3c3c3c3c3c3c3c3cULL,
+    0x7c7c7c7c7c7c7c7cULL, 0xfcfcfcfcfcfcfcfcULL, 0xfdfdfdfdfdfdfdfdULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0002000000020000ULL, 0x0006000000060000ULL, 0x000e0000000e0000ULL, 0x001e0000001e0000ULL,
+    0x003e0000003e0000ULL, 0x007e0000007e0000ULL, 0x00fe000000fe0000ULL, 0x01fe000001fe0000ULL,
+    0x03fe000003fe0000ULL, 0x07fe000007fe0000ULL, 0x0ffe00000ffe0000ULL, 0x1ffe00001ffe0000ULL,
+    0x3ffe00003ffe0000ULL, 0x7ffe00007ffe0000ULL, 0xfffe0000fffe0000ULL, 0xfffe0001fffe0001ULL,
+    0xfffe0003fffe0003ULL, 0xfffe0007fffe0007ULL, 0xfffe000ffffe000fULL, 0xfffe001ffffe001fULL,
+    0xfffe003ffffe003fULL, 0xfffe007ffffe007fULL, 0xfffe00fffffe00ffULL, 0xfffe01fffffe01ffULL,
+    0xfffe03fffffe03ffULL, 0xfffe07fffffe07ffULL, 0xfffe0ffffffe0fffULL, 0xfffe1ffffffe1fffULL,
+    0xfffe3ffffffe3fffULL, 0xfffe7ffffffe7fffULL, 0xfffefffffffeffffULL, 0x0000000000000000ULL,
+    0x0002000200020002ULL, 0x0006000600060006ULL, 0x000e000e000e000eULL, 0x001e001e001e001eULL,
+    0x003e003e003e003eULL, 0x007e007e007e007eULL, 0x00fe00fe00fe00feULL, 0x01fe01fe01fe01feULL,
+    0x03fe03fe03fe03feULL, 0x07fe07fe07fe07feULL, 0x0ffe0ffe0ffe0ffeULL, 0x1ffe1ffe1ffe1ffeULL,
+    0x3ffe3ffe3ffe3ffeULL, 0x7ffe7ffe7ffe7ffeULL, 0xfffefffefffefffeULL, 0x0000000000000000ULL,
+    0x0202020202020202ULL, 0x0606060606060606ULL, 0x0e0e0e0e0e0e0e0eULL, 0x1e1e1e1e1e1e1e1eULL,
+    0x3e3e3e3e3e3e3e3eULL, 0x7e7e7e7e7e7e7e7eULL, 0xfefefefefefefefeULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0001000000010000ULL, 0x0003000000030000ULL, 0x0007000000070000ULL, 0x000f0000000f0000ULL,
+    0x001f0000001f0000ULL, 0x003f0000003f0000ULL, 0x007f0000007f0000ULL, 0x00ff000000ff0000ULL,
+    0x01ff000001ff0000ULL, 0x03ff000003ff0000ULL, 0x07ff000007ff0000ULL, 0x0fff00000fff0000ULL,
+    0x1fff00001fff0000ULL, 0x3fff00003fff0000ULL, 0x7fff00007fff0000ULL, 0xffff0000ffff0000ULL,
+    0xffff0001ffff0001ULL, 0xffff0003ffff0003ULL, 0xffff0007ffff0007ULL, 0xffff000fffff000fULL,
+    0xffff001fffff001fULL, 0xffff003fffff003fULL, 0xffff007fffff007fULL, 0xffff00ffffff00ffULL,
+    0xffff01ffffff01ffULL, 0xffff03ffffff03ffULL, 0xffff07ffffff07ffULL, 0xffff0fffffff0fffULL,
+    0xffff1fffffff1fffULL, 0xffff3fffffff3fffULL, 0xffff7fffffff7fffULL, 0x0000000000000000ULL,
+    0x0001000100010001ULL, 0x0003000300030003ULL, 0x0007000700070007ULL, 0x000f000f000f000fULL,
+    0x001f001f001f001fULL, 0x003f003f003f003fULL, 0x007f007f007f007fULL, 0x00ff00ff00ff00ffULL,
+    0x01ff01ff01ff01ffULL, 0x03ff03ff03ff03ffULL, 0x07ff07ff07ff07ffULL, 0x0fff0fff0fff0fffULL,
+    0x1fff1fff1fff1fffULL, 0x3fff3fff3fff3fffULL, 0x7fff7fff7fff7fffULL, 0x0000000000000000ULL,
+    0x0101010101010101ULL, 0x0303030303030303ULL, 0x0707070707070707ULL, 0x0f0f0f0f0f0f0f0fULL,
+    0x1f1f1f1f1f1f1f1fULL, 0x3f3f3f3f3f3f3f3fULL, 0x7f7f7f7f7f7f7f7fULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000800000008000ULL, 0x0001800000018000ULL, 0x0003800000038000ULL, 0x0007800000078000ULL,
+    0x000f8000000f8000ULL, 0x001f8000001f8000ULL, 0x003f8000003f8000ULL, 0x007f8000007f8000ULL,
+    0x00ff800000ff8000ULL, 0x01ff800001ff8000ULL, 0x03ff800003ff8000ULL, 0x07ff800007ff8000ULL,
+    0x0fff80000fff8000ULL, 0x1fff80001fff8000ULL, 0x3fff80003fff8000ULL, 0x7fff80007fff8000ULL,
+    0xffff8000ffff8000ULL, 0xffff8001ffff8001ULL, 0xffff8003ffff8003ULL, 0xffff8007ffff8007ULL,
+    0xffff800fffff800fULL, 0xffff801fffff801fULL, 0xffff803fffff803fULL, 0xffff807fffff807fULL,
+    0xffff80ffffff80ffULL, 0xffff81ffffff81ffULL, 0xffff83ffffff83ffULL, 0xffff87ffffff87ffULL,
+    0xffff8fffffff8fffULL, 0xffff9fffffff9fffULL, 0xffffbfffffffbfffULL, 0x0000000000000000ULL,
+    0x8000800080008000ULL, 0x8001800180018001ULL, 0x8003800380038003ULL, 0x8007800780078007ULL,
+    0x800f800f800f800fULL, 0x801f801f801f801fULL, 0x803f803f803f803fULL, 0x807f807f807f807fULL,
+    0x80ff80ff80ff80ffULL, 0x81ff81ff81ff81ffULL, 0x83ff83ff83ff83ffULL, 0x87ff87ff87ff87ffULL,
+    0x8fff8fff8fff8fffULL, 0x9fff9fff9fff9fffULL, 0xbfffbfffbfffbfffULL, 0x0000000000000000ULL,
+    0x8080808080808080ULL, 0x8181818181818181ULL, 0x8383838383838383ULL, 0x8787878787878787ULL,
+    0x8f8f8f8f8f8f8f8fULL, 0x9f9f9f9f9f9f9f9fULL, 0xbfbfbfbfbfbfbfbfULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000400000004000ULL, 0x0000c0000000c000ULL, 0x0001c0000001c000ULL, 0x0003c0000003c000ULL,
+    0x0007c0000007c000ULL, 0x000fc000000fc000ULL, 0x001fc000001fc000ULL, 0x003fc000003fc000ULL,
+    0x007fc000007fc000ULL, 0x00ffc00000ffc000ULL, 0x01ffc00001ffc000ULL, 0x03ffc00003ffc000ULL,
+    0x07ffc00007ffc000ULL, 0x0fffc0000fffc000ULL, 0x1fffc0001fffc000ULL, 0x3fffc0003fffc000ULL,
+    0x7fffc0007fffc000ULL, 0xffffc000ffffc000ULL, 0xffffc001ffffc001ULL, 0xffffc003ffffc003ULL,
+    0xffffc007ffffc007ULL, 0xffffc00fffffc00fULL, 0xffffc01fffffc01fULL, 0xffffc03fffffc03fULL,
+    0xffffc07fffffc07fULL, 0xffffc0ffffffc0ffULL, 0xffffc1ffffffc1ffULL, 0xffffc3ffffffc3ffULL,
+    0xffffc7ffffffc7ffULL, 0xffffcfffffffcfffULL, 0xffffdfffffffdfffULL, 0x0000000000000000ULL,
+    0x4000400040004000ULL, 0xc000c000c000c000ULL, 0xc001c001c001c001ULL, 0xc003c003c003c003ULL,
+    0xc007c007c007c007ULL, 0xc00fc00fc00fc00fULL, 0xc01fc01fc01fc01fULL, 0xc03fc03fc03fc03fULL,
+    0xc07fc07fc07fc07fULL, 0xc0ffc0ffc0ffc0ffULL, 0xc1ffc1ffc1ffc1ffULL, 0xc3ffc3ffc3ffc3ffULL,
+    0xc7ffc7ffc7ffc7ffULL, 0xcfffcfffcfffcfffULL, 0xdfffdfffdfffdfffULL, 0x0000000000000000ULL,
+    0x4040404040404040ULL, 0xc0c0c0c0c0c0c0c0ULL, 0xc1c1c1c1c1c1c1c1ULL, 0xc3c3c3c3c3c3c3c3ULL,
+    0xc7c7c7c7c7c7c7c7ULL, 0xcfcfcfcfcfcfcfcfULL, 0xdfdfdfdfdfdfdfdfULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000200000002000ULL, 0x0000600000006000ULL, 0x0000e0000000e000ULL, 0x0001e0000001e000ULL,
+    0x0003e0000003e000ULL, 0x0007e0000007e000ULL, 0x000fe000000fe000ULL, 0x001fe000001fe000ULL,
+    0x003fe000003fe000ULL, 0x007fe000007fe000ULL, 0x00ffe00000ffe000ULL, 0x01ffe00001ffe000ULL,
+    0x03ffe00003ffe000ULL, 0x07ffe00007ffe000ULL, 0x0fffe0000fffe000ULL, 0x1fffe0001fffe000ULL,
+    0x3fffe0003fffe000ULL, 0x7fffe0007fffe000ULL, 0xffffe000ffffe000ULL, 0xffffe001ffffe001ULL,
+    0xffffe003ffffe003ULL, 0xffffe007ffffe007ULL, 0xffffe00fffffe00fULL, 0xffffe01fffffe01fULL,
+    0xffffe03fffffe03fULL, 0xffffe07fffffe07fULL, 0xffffe0ffffffe0ffULL, 0xffffe1ffffffe1ffULL,
+    0xffffe3ffffffe3ffULL, 0xffffe7ffffffe7ffULL, 0xffffefffffffefffULL, 0x0000000000000000ULL,
+    0x2000200020002000ULL, 0x6000600060006000ULL, 0xe000e000e000e000ULL, 0xe001e001e001e001ULL,
+    0xe003e003e003e003ULL, 0xe007e007e007e007ULL, 0xe00fe00fe00fe00fULL, 0xe01fe01fe01fe01fULL,
+    0xe03fe03fe03fe03fULL, 0xe07fe07fe07fe07fULL, 0xe0ffe0ffe0ffe0ffULL, 0xe1ffe1ffe1ffe1ffULL,
+    0xe3ffe3ffe3ffe3ffULL, 0xe7ffe7ffe7ffe7ffULL, 0xefffefffefffefffULL, 0x0000000000000000ULL,
+    0x2020202020202020ULL, 0x6060606060606060ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xe1e1e1e1e1e1e1e1ULL,
+    0xe3e3e3e3e3e3e3e3ULL, 0xe7e7e7e7e7e7e7e7ULL, 0xefefefefefefefefULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000100000001000ULL, 0x0000300000003000ULL, 0x0000700000007000ULL, 0x0000f0000000f000ULL,
+    0x0001f0000001f000ULL, 0x0003f0000003f000ULL, 0x0007f0000007f000ULL, 0x000ff000000ff000ULL,
+    0x001ff000001ff000ULL, 0x003ff000003ff000ULL, 0x007ff000007ff000ULL, 0x00fff00000fff000ULL,
+    0x01fff00001fff000ULL, 0x03fff00003fff000ULL, 0x07fff00007fff000ULL, 0x0ffff0000ffff000ULL,
+    0x1ffff0001ffff000ULL, 0x3ffff0003ffff000ULL, 0x7ffff0007ffff000ULL, 0xfffff000fffff000ULL,
+    0xfffff001fffff001ULL, 0xfffff003fffff003ULL, 0xfffff007fffff007ULL, 0xfffff00ffffff00fULL,
+    0xfffff01ffffff01fULL, 0xfffff03ffffff03fULL, 0xfffff07ffffff07fULL, 0xfffff0fffffff0ffULL,
+    0xfffff1fffffff1ffULL, 0xfffff3fffffff3ffULL, 0xfffff7fffffff7ffULL, 0x0000000000000000ULL,
+    0x1000100010001000ULL, 0x3000300030003000ULL, 0x7000700070007000ULL, 0xf000f000f000f000ULL,
+    0xf001f001f001f001ULL, 0xf003f003f003f003ULL, 0xf007f007f007f007ULL, 0xf00ff00ff00ff00fULL,
+    0xf01ff01ff01ff01fULL, 0xf03ff03ff03ff03fULL, 0xf07ff07ff07ff07fULL, 0xf0fff0fff0fff0ffULL,
+    0xf1fff1fff1fff1ffULL, 0xf3fff3fff3fff3ffULL, 0xf7fff7fff7fff7ffULL, 0x0000000000000000ULL,
+    0x1010101010101010ULL, 0x3030303030303030ULL, 0x7070707070707070ULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xf1f1f1f1f1f1f1f1ULL, 0xf3f3f3f3f3f3f3f3ULL, 0xf7f7f7f7f7f7f7f7ULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000080000000800ULL, 0x0000180000001800ULL, 0x0000380000003800ULL, 0x0000780000007800ULL,
+    0x0000f8000000f800ULL, 0x0001f8000001f800ULL, 0x0003f8000003f800ULL, 0x0007f8000007f800ULL,
+    0x000ff800000ff800ULL, 0x001ff800001ff800ULL, 0x003ff800003ff800ULL, 0x007ff800007ff800ULL,
+    0x00fff80000fff800ULL, 0x01fff80001fff800ULL, 0x03fff80003fff800ULL, 0x07fff80007fff800ULL,
+    0x0ffff8000ffff800ULL, 0x1ffff8001ffff800ULL, 0x3ffff8003ffff800ULL, 0x7ffff8007ffff800ULL,
+    0xfffff800fffff800ULL, 0xfffff801fffff801ULL, 0xfffff803fffff803ULL, 0xfffff807fffff807ULL,
+    0xfffff80ffffff80fULL, 0xfffff81ffffff81fULL, 0xfffff83ffffff83fULL, 0xfffff87ffffff87fULL,
+    0xfffff8fffffff8ffULL, 0xfffff9fffffff9ffULL, 0xfffffbfffffffbffULL, 0x0000000000000000ULL,
+    0x0800080008000800ULL, 0x1800180018001800ULL, 0x3800380038003800ULL, 0x7800780078007800ULL,
+    0xf800f800f800f800ULL, 0xf801f801f801f801ULL, 0xf803f803f803f803ULL, 0xf807f807f807f807ULL,
+    0xf80ff80ff80ff80fULL, 0xf81ff81ff81ff81fULL, 0xf83ff83ff83ff83fULL, 0xf87ff87ff87ff87fULL,
+    0xf8fff8fff8fff8ffULL, 0xf9fff9fff9fff9ffULL, 0xfbfffbfffbfffbffULL, 0x0000000000000000ULL,
+    0x0808080808080808ULL, 0x1818181818181818ULL, 0x3838383838383838ULL, 0x7878787878787878ULL,
+    0xf8f8f8f8f8f8f8f8ULL, 0xf9f9f9f9f9f9f9f9ULL, 0xfbfbfbfbfbfbfbfbULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000040000000400ULL, 0x00000c0000000c00ULL, 0x00001c0000001c00ULL, 0x00003c0000003c00ULL,
+    0x00007c0000007c00ULL, 0x0000fc000000fc00ULL, 0x0001fc000001fc00ULL, 0x0003fc000003fc00ULL,
+    0x0007fc000007fc00ULL, 0x000ffc00000ffc00ULL, 0x001ffc00001ffc00ULL, 0x003ffc00003ffc00ULL,
+    0x007ffc00007ffc00ULL, 0x00fffc0000fffc00ULL, 0x01fffc0001fffc00ULL, 0x03fffc0003fffc00ULL,
+    0x07fffc0007fffc00ULL, 0x0ffffc000ffffc00ULL, 0x1ffffc001ffffc00ULL, 0x3ffffc003ffffc00ULL,
+    0x7ffffc007ffffc00ULL, 0xfffffc00fffffc00ULL, 0xfffffc01fffffc01ULL, 0xfffffc03fffffc03ULL,
+    0xfffffc07fffffc07ULL, 0xfffffc0ffffffc0fULL, 0xfffffc1ffffffc1fULL, 0xfffffc3ffffffc3fULL,
+    0xfffffc7ffffffc7fULL, 0xfffffcfffffffcffULL, 0xfffffdfffffffdffULL, 0x0000000000000000ULL,
+    0x0400040004000400ULL, 0x0c000c000c000c00ULL, 0x1c001c001c001c00ULL, 0x3c003c003c003c00ULL,
+    0x7c007c007c007c00ULL, 0xfc00fc00fc00fc00ULL, 0xfc01fc01fc01fc01ULL, 0xfc03fc03fc03fc03ULL,
+    0xfc07fc07fc07fc07ULL, 0xfc0ffc0ffc0ffc0fULL, 0xfc1ffc1ffc1ffc1fULL, 0xfc3ffc3ffc3ffc3fULL,
+    0xfc7ffc7ffc7ffc7fULL, 0xfcfffcfffcfffcffULL, 0xfdfffdfffdfffdffULL, 0x0000000000000000ULL,
+    0x0404040404040404ULL, 0x0c0c0c0c0c0c0c0cULL, 0x1c1c1c1c1c1c1c1cULL, 0x3c3c3c3c3c3c3c3cULL,
+    0x7c7c7c7c7c7c7c7cULL, 0xfcfcfcfcfcfcfcfcULL, 0xfdfdfdfdfdfdfdfdULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000020000000200ULL, 0x0000060000000600ULL, 0x00000e0000000e00ULL, 0x00001e0000001e00ULL,
+    0x00003e0000003e00ULL, 0x00007e0000007e00ULL, 0x0000fe000000fe00ULL, 0x0001fe000001fe00ULL,
+    0x0003fe000003fe00ULL, 0x0007fe000007fe00ULL, 0x000ffe00000ffe00ULL, 0x001ffe00001ffe00ULL,
+    0x003ffe00003ffe00ULL, 0x007ffe00007ffe00ULL, 0x00fffe0000fffe00ULL, 0x01fffe0001fffe00ULL,
+    0x03fffe0003fffe00ULL, 0x07fffe0007fffe00ULL, 0x0ffffe000ffffe00ULL, 0x1ffffe001ffffe00ULL,
+    0x3ffffe003ffffe00ULL, 0x7ffffe007ffffe00ULL, 0xfffffe00fffffe00ULL, 0xfffffe01fffffe01ULL,
+    0xfffffe03fffffe03ULL, 0xfffffe07fffffe07ULL, 0xfffffe0ffffffe0fULL, 0xfffffe1ffffffe1fULL,
+    0xfffffe3ffffffe3fULL, 0xfffffe7ffffffe7fULL, 0xfffffefffffffeffULL, 0x0000000000000000ULL,
+    0x0200020002000200ULL, 0x0600060006000600ULL, 0x0e000e000e000e00ULL, 0x1e001e001e001e00ULL,
+    0x3e003e003e003e00ULL, 0x7e007e007e007e00ULL, 0xfe00fe00fe00fe00ULL, 0xfe01fe01fe01fe01ULL,
+    0xfe03fe03fe03fe03ULL, 0xfe07fe07fe07fe07ULL, 0xfe0ffe0ffe0ffe0fULL, 0xfe1ffe1ffe1ffe1fULL,
+    0xfe3ffe3ffe3ffe3fULL, 0xfe7ffe7ffe7ffe7fULL, 0xfefffefffefffeffULL, 0x0000000000000000ULL,
+    0x0202020202020202ULL, 0x0606060606060606ULL, 0x0e0e0e0e0e0e0e0eULL, 0x1e1e1e1e1e1e1e1eULL,
+    0x3e3e3e3e3e3e3e3eULL, 0x7e7e7e7e7e7e7e7eULL, 0xfefefefefefefefeULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000010000000100ULL, 0x0000030000000300ULL, 0x0000070000000700ULL, 0x00000f0000000f00ULL,
+    0x00001f0000001f00ULL, 0x00003f0000003f00ULL, 0x00007f0000007f00ULL, 0x0000ff000000ff00ULL,
+    0x0001ff000001ff00ULL, 0x0003ff000003ff00ULL, 0x0007ff000007ff00ULL, 0x000fff00000fff00ULL,
+    0x001fff00001fff00ULL, 0x003fff00003fff00ULL, 0x007fff00007fff00ULL, 0x00ffff0000ffff00ULL,
+    0x01ffff0001ffff00ULL, 0x03ffff0003ffff00ULL, 0x07ffff0007ffff00ULL, 0x0fffff000fffff00ULL,
+    0x1fffff001fffff00ULL, 0x3fffff003fffff00ULL, 0x7fffff007fffff00ULL, 0xffffff00ffffff00ULL,
+    0xffffff01ffffff01ULL, 0xffffff03ffffff03ULL, 0xffffff07ffffff07ULL, 0xffffff0fffffff0fULL,
+    0xffffff1fffffff1fULL, 0xffffff3fffffff3fULL, 0xffffff7fffffff7fULL, 0x0000000000000000ULL,
+    0x0100010001000100ULL, 0x0300030003000300ULL, 0x0700070007000700ULL, 0x0f000f000f000f00ULL,
+    0x1f001f001f001f00ULL, 0x3f003f003f003f00ULL, 0x7f007f007f007f00ULL, 0xff00ff00ff00ff00ULL,
+    0xff01ff01ff01ff01ULL, 0xff03ff03ff03ff03ULL, 0xff07ff07ff07ff07ULL, 0xff0fff0fff0fff0fULL,
+    0xff1fff1fff1fff1fULL, 0xff3fff3fff3fff3fULL, 0xff7fff7fff7fff7fULL, 0x0000000000000000ULL,
+    0x0101010101010101ULL, 0x0303030303030303ULL, 0x0707070707070707ULL, 0x0f0f0f0f0f0f0f0fULL,
+    0x1f1f1f1f1f1f1f1fULL, 0x3f3f3f3f3f3f3f3fULL, 0x7f7f7f7f7f7f7f7fULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000008000000080ULL, 0x0000018000000180ULL, 0x0000038000000380ULL, 0x0000078000000780ULL,
+    0x00000f8000000f80ULL, 0x00001f8000001f80ULL, 0x00003f8000003f80ULL, 0x00007f8000007f80ULL,
+    0x0000ff800000ff80ULL, 0x0001ff800001ff80ULL, 0x0003ff800003ff80ULL, 0x0007ff800007ff80ULL,
+    0x000fff80000fff80ULL, 0x001fff80001fff80ULL, 0x003fff80003fff80ULL, 0x007fff80007fff80ULL,
+    0x00ffff8000ffff80ULL, 0x01ffff8001ffff80ULL, 0x03ffff8003ffff80ULL, 0x07ffff8007ffff80ULL,
+    0x0fffff800fffff80ULL, 0x1fffff801fffff80ULL, 0x3fffff803fffff80ULL, 0x7fffff807fffff80ULL,
+    0xffffff80ffffff80ULL, 0xffffff81ffffff81ULL, 0xffffff83ffffff83ULL, 0xffffff87ffffff87ULL,
+    0xffffff8fffffff8fULL, 0xffffff9fffffff9fULL, 0xffffffbfffffffbfULL, 0x0000000000000000ULL,
+    0x0080008000800080ULL, 0x0180018001800180ULL, 0x0380038003800380ULL, 0x0780078007800780ULL,
+    0x0f800f800f800f80ULL, 0x1f801f801f801f80ULL, 0x3f803f803f803f80ULL, 0x7f807f807f807f80ULL,
+    0xff80ff80ff80ff80ULL, 0xff81ff81ff81ff81ULL, 0xff83ff83ff83ff83ULL, 0xff87ff87ff87ff87ULL,
+    0xff8fff8fff8fff8fULL, 0xff9fff9fff9fff9fULL, 0xffbfffbfffbfffbfULL, 0x0000000000000000ULL,
+    0x8080808080808080ULL, 0x8181818181818181ULL, 0x8383838383838383ULL, 0x8787878787878787ULL,
+    0x8f8f8f8f8f8f8f8fULL, 0x9f9f9f9f9f9f9f9fULL, 0xbfbfbfbfbfbfbfbfULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000004000000040ULL, 0x000000c0000000c0ULL, 0x000001c0000001c0ULL, 0x000003c0000003c0ULL,
+    0x000007c0000007c0ULL, 0x00000fc000000fc0ULL, 0x00001fc000001fc0ULL, 0x00003fc000003fc0ULL,
+    0x00007fc000007fc0ULL, 0x0000ffc00000ffc0ULL, 0x0001ffc00001ffc0ULL, 0x0003ffc00003ffc0ULL,
+    0x0007ffc00007ffc0ULL, 0x000fffc0000fffc0ULL, 0x001fffc0001fffc0ULL, 0x003fffc0003fffc0ULL,
+    0x007fffc0007fffc0ULL, 0x00ffffc000ffffc0ULL, 0x01ffffc001ffffc0ULL, 0x03ffffc003ffffc0ULL,
+    0x07ffffc007ffffc0ULL, 0x0fffffc00fffffc0ULL, 0x1fffffc01fffffc0ULL, 0x3fffffc03fffffc0ULL,
+    0x7fffffc07fffffc0ULL, 0xffffffc0ffffffc0ULL, 0xffffffc1ffffffc1ULL, 0xffffffc3ffffffc3ULL,
+    0xffffffc7ffffffc7ULL, 0xffffffcfffffffcfULL, 0xffffffdfffffffdfULL, 0x0000000000000000ULL,
+    0x0040004000400040ULL, 0x00c000c000c000c0ULL, 0x01c001c001c001c0ULL, 0x03c003c003c003c0ULL,
+    0x07c007c007c007c0ULL, 0x0fc00fc00fc00fc0ULL, 0x1fc01fc01fc01fc0ULL, 0x3fc03fc03fc03fc0ULL,
+    0x7fc07fc07fc07fc0ULL, 0xffc0ffc0ffc0ffc0ULL, 0xffc1ffc1ffc1ffc1ULL, 0xffc3ffc3ffc3ffc3ULL,
+    0xffc7ffc7ffc7ffc7ULL, 0xffcfffcfffcfffcfULL, 0xffdfffdfffdfffdfULL, 0x0000000000000000ULL,
+    0x4040404040404040ULL, 0xc0c0c0c0c0c0c0c0ULL, 0xc1c1c1c1c1c1c1c1ULL, 0xc3c3c3c3c3c3c3c3ULL,
+    0xc7c7c7c7c7c7c7c7ULL, 0xcfcfcfcfcfcfcfcfULL, 0xdfdfdfdfdfdfdfdfULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000002000000020ULL, 0x0000006000000060ULL, 0x000000e0000000e0ULL, 0x000001e0000001e0ULL,
+    0x000003e0000003e0ULL, 0x000007e0000007e0ULL, 0x00000fe000000fe0ULL, 0x00001fe000001fe0ULL,
+    0x00003fe000003fe0ULL, 0x00007fe000007fe0ULL, 0x0000ffe00000ffe0ULL, 0x0001ffe00001ffe0ULL,
+    0x0003ffe00003ffe0ULL, 0x0007ffe00007ffe0ULL, 0x000fffe0000fffe0ULL, 0x001fffe0001fffe0ULL,
+    0x003fffe0003fffe0ULL, 0x007fffe0007fffe0ULL, 0x00ffffe000ffffe0ULL, 0x01ffffe001ffffe0ULL,
+    0x03ffffe003ffffe0ULL, 0x07ffffe007ffffe0ULL, 0x0fffffe00fffffe0ULL, 0x1fffffe01fffffe0ULL,
+    0x3fffffe03fffffe0ULL, 0x7fffffe07fffffe0ULL, 0xffffffe0ffffffe0ULL, 0xffffffe1ffffffe1ULL,
+    0xffffffe3ffffffe3ULL, 0xffffffe7ffffffe7ULL, 0xffffffefffffffefULL, 0x0000000000000000ULL,
+    0x0020002000200020ULL, 0x0060006000600060ULL, 0x00e000e000e000e0ULL, 0x01e001e001e001e0ULL,
+    0x03e003e003e003e0ULL, 0x07e007e007e007e0ULL, 0x0fe00fe00fe00fe0ULL, 0x1fe01fe01fe01fe0ULL,
+    0x3fe03fe03fe03fe0ULL, 0x7fe07fe07fe07fe0ULL, 0xffe0ffe0ffe0ffe0ULL, 0xffe1ffe1ffe1ffe1ULL,
+    0xffe3ffe3ffe3ffe3ULL, 0xffe7ffe7ffe7ffe7ULL, 0xffefffefffefffefULL, 0x0000000000000000ULL,
+    0x2020202020202020ULL, 0x6060606060606060ULL, 0xe0e0e0e0e0e0e0e0ULL, 0xe1e1e1e1e1e1e1e1ULL,
+    0xe3e3e3e3e3e3e3e3ULL, 0xe7e7e7e7e7e7e7e7ULL, 0xefefefefefefefefULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000001000000010ULL, 0x0000003000000030ULL, 0x0000007000000070ULL, 0x000000f0000000f0ULL,
+    0x000001f0000001f0ULL, 0x000003f0000003f0ULL, 0x000007f0000007f0ULL, 0x00000ff000000ff0ULL,
+    0x00001ff000001ff0ULL, 0x00003ff000003ff0ULL, 0x00007ff000007ff0ULL, 0x0000fff00000fff0ULL,
+    0x0001fff00001fff0ULL, 0x0003fff00003fff0ULL, 0x0007fff00007fff0ULL, 0x000ffff0000ffff0ULL,
+    0x001ffff0001ffff0ULL, 0x003ffff0003ffff0ULL, 0x007ffff0007ffff0ULL, 0x00fffff000fffff0ULL,
+    0x01fffff001fffff0ULL, 0x03fffff003fffff0ULL, 0x07fffff007fffff0ULL, 0x0ffffff00ffffff0ULL,
+    0x1ffffff01ffffff0ULL, 0x3ffffff03ffffff0ULL, 0x7ffffff07ffffff0ULL, 0xfffffff0fffffff0ULL,
+    0xfffffff1fffffff1ULL, 0xfffffff3fffffff3ULL, 0xfffffff7fffffff7ULL, 0x0000000000000000ULL,
+    0x0010001000100010ULL, 0x0030003000300030ULL, 0x0070007000700070ULL, 0x00f000f000f000f0ULL,
+    0x01f001f001f001f0ULL, 0x03f003f003f003f0ULL, 0x07f007f007f007f0ULL, 0x0ff00ff00ff00ff0ULL,
+    0x1ff01ff01ff01ff0ULL, 0x3ff03ff03ff03ff0ULL, 0x7ff07ff07ff07ff0ULL, 0xfff0fff0fff0fff0ULL,
+    0xfff1fff1fff1fff1ULL, 0xfff3fff3fff3fff3ULL, 0xfff7fff7fff7fff7ULL, 0x0000000000000000ULL,
+    0x1010101010101010ULL, 0x3030303030303030ULL, 0x7070707070707070ULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xf1f1f1f1f1f1f1f1ULL, 0xf3f3f3f3f3f3f3f3ULL, 0xf7f7f7f7f7f7f7f7ULL, 0x0000000000000000ULL,
+    0x1111111111111111ULL, 0x3333333333333333ULL, 0x7777777777777777ULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000800000008ULL, 0x0000001800000018ULL, 0x0000003800000038ULL, 0x0000007800000078ULL,
+    0x000000f8000000f8ULL, 0x000001f8000001f8ULL, 0x000003f8000003f8ULL, 0x000007f8000007f8ULL,
+    0x00000ff800000ff8ULL, 0x00001ff800001ff8ULL, 0x00003ff800003ff8ULL, 0x00007ff800007ff8ULL,
+    0x0000fff80000fff8ULL, 0x0001fff80001fff8ULL, 0x0003fff80003fff8ULL, 0x0007fff80007fff8ULL,
+    0x000ffff8000ffff8ULL, 0x001ffff8001ffff8ULL, 0x003ffff8003ffff8ULL, 0x007ffff8007ffff8ULL,
+    0x00fffff800fffff8ULL, 0x01fffff801fffff8ULL, 0x03fffff803fffff8ULL, 0x07fffff807fffff8ULL,
+    0x0ffffff80ffffff8ULL, 0x1ffffff81ffffff8ULL, 0x3ffffff83ffffff8ULL, 0x7ffffff87ffffff8ULL,
+    0xfffffff8fffffff8ULL, 0xfffffff9fffffff9ULL, 0xfffffffbfffffffbULL, 0x0000000000000000ULL,
+    0x0008000800080008ULL, 0x0018001800180018ULL, 0x0038003800380038ULL, 0x0078007800780078ULL,
+    0x00f800f800f800f8ULL, 0x01f801f801f801f8ULL, 0x03f803f803f803f8ULL, 0x07f807f807f807f8ULL,
+    0x0ff80ff80ff80ff8ULL, 0x1ff81ff81ff81ff8ULL, 0x3ff83ff83ff83ff8ULL, 0x7ff87ff87ff87ff8ULL,
+    0xfff8fff8fff8fff8ULL, 0xfff9fff9fff9fff9ULL, 0xfffbfffbfffbfffbULL, 0x0000000000000000ULL,
+    0x0808080808080808ULL, 0x1818181818181818ULL, 0x3838383838383838ULL, 0x7878787878787878ULL,
+    0xf8f8f8f8f8f8f8f8ULL, 0xf9f9f9f9f9f9f9f9ULL, 0xfbfbfbfbfbfbfbfbULL, 0x0000000000000000ULL,
+    0x8888888888888888ULL, 0x9999999999999999ULL, 0xbbbbbbbbbbbbbbbbULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000400000004ULL, 0x0000000c0000000cULL, 0x0000001c0000001cULL, 0x0000003c0000003cULL,
+    0x0000007c0000007cULL, 0x000000fc000000fcULL, 0x000001fc000001fcULL, 0x000003fc000003fcULL,
+    0x000007fc000007fcULL, 0x00000ffc00000ffcULL, 0x00001ffc00001ffcULL, 0x00003ffc00003ffcULL,
+    0x00007ffc00007ffcULL, 0x0000fffc0000fffcULL, 0x0001fffc0001fffcULL, 0x0003fffc0003fffcULL,
+    0x0007fffc0007fffcULL, 0x000ffffc000ffffcULL, 0x001ffffc001ffffcULL, 0x003ffffc003ffffcULL,
+    0x007ffffc007ffffcULL, 0x00fffffc00fffffcULL, 0x01fffffc01fffffcULL, 0x03fffffc03fffffcULL,
+    0x07fffffc07fffffcULL, 0x0ffffffc0ffffffcULL, 0x1ffffffc1ffffffcULL, 0x3ffffffc3ffffffcULL,
+    0x7ffffffc7ffffffcULL, 0xfffffffcfffffffcULL, 0xfffffffdfffffffdULL, 0x0000000000000000ULL,
+    0x0004000400040004ULL, 0x000c000c000c000cULL, 0x001c001c001c001cULL, 0x003c003c003c003cULL,
+    0x007c007c007c007cULL, 0x00fc00fc00fc00fcULL, 0x01fc01fc01fc01fcULL, 0x03fc03fc03fc03fcULL,
+    0x07fc07fc07fc07fcULL, 0x0ffc0ffc0ffc0ffcULL, 0x1ffc1ffc1ffc1ffcULL, 0x3ffc3ffc3ffc3ffcULL,
+    0x7ffc7ffc7ffc7ffcULL, 0xfffcfffcfffcfffcULL, 0xfffdfffdfffdfffdULL, 0x0000000000000000ULL,
+    0x0404040404040404ULL, 0x0c0c0c0c0c0c0c0cULL, 0x1c1c1c1c1c1c1c1cULL, 0x3c3c3c3c3c3c3c3cULL,
+    0x7c7c7c7c7c7c7c7cULL, 0xfcfcfcfcfcfcfcfcULL, 0xfdfdfdfdfdfdfdfdULL, 0x0000000000000000ULL,
+    0x4444444444444444ULL, 0xccccccccccccccccULL, 0xddddddddddddddddULL, 0x0000000000000000ULL,
+    0x5555555555555555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000200000002ULL, 0x0000000600000006ULL, 0x0000000e0000000eULL, 0x0000001e0000001eULL,
+    0x0000003e0000003eULL, 0x0000007e0000007eULL, 0x000000fe000000feULL, 0x000001fe000001feULL,
+    0x000003fe000003feULL, 0x000007fe000007feULL, 0x00000ffe00000ffeULL, 0x00001ffe00001ffeULL,
+    0x00003ffe00003ffeULL, 0x00007ffe00007ffeULL, 0x0000fffe0000fffeULL, 0x0001fffe0001fffeULL,
+    0x0003fffe0003fffeULL, 0x0007fffe0007fffeULL, 0x000ffffe000ffffeULL, 0x001ffffe001ffffeULL,
+    0x003ffffe003ffffeULL, 0x007ffffe007ffffeULL, 0x00fffffe00fffffeULL, 0x01fffffe01fffffeULL,
+    0x03fffffe03fffffeULL, 0x07fffffe07fffffeULL, 0x0ffffffe0ffffffeULL, 0x1ffffffe1ffffffeULL,
+    0x3ffffffe3ffffffeULL, 0x7ffffffe7ffffffeULL, 0xfffffffefffffffeULL, 0x0000000000000000ULL,
+    0x0002000200020002ULL, 0x0006000600060006ULL, 0x000e000e000e000eULL, 0x001e001e001e001eULL,
+    0x003e003e003e003eULL, 0x007e007e007e007eULL, 0x00fe00fe00fe00feULL, 0x01fe01fe01fe01feULL,
+    0x03fe03fe03fe03feULL, 0x07fe07fe07fe07feULL, 0x0ffe0ffe0ffe0ffeULL, 0x1ffe1ffe1ffe1ffeULL,
+    0x3ffe3ffe3ffe3ffeULL, 0x7ffe7ffe7ffe7ffeULL, 0xfffefffefffefffeULL, 0x0000000000000000ULL,
+    0x0202020202020202ULL, 0x0606060606060606ULL, 0x0e0e0e0e0e0e0e0eULL, 0x1e1e1e1e1e1e1e1eULL,
+    0x3e3e3e3e3e3e3e3eULL, 0x7e7e7e7e7e7e7e7eULL, 0xfefefefefefefefeULL, 0x0000000000000000ULL,
+    0x2222222222222222ULL, 0x6666666666666666ULL, 0xeeeeeeeeeeeeeeeeULL, 0x0000000000000000ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000001ULL, 0x0000000000000003ULL, 0x0000000000000007ULL, 0x000000000000000fULL,
+    0x000000000000001fULL, 0x000000000000003fULL, 0x000000000000007fULL, 0x00000000000000ffULL,
+    0x00000000000001ffULL, 0x00000000000003ffULL, 0x00000000000007ffULL, 0x0000000000000fffULL,
+    0x0000000000001fffULL, 0x0000000000003fffULL, 0x0000000000007fffULL, 0x000000000000ffffULL,
+    0x000000000001ffffULL, 0x000000000003ffffULL, 0x000000000007ffffULL, 0x00000000000fffffULL,
+    0x00000000001fffffULL, 0x00000000003fffffULL, 0x00000000007fffffULL, 0x0000000000ffffffULL,
+    0x0000000001ffffffULL, 0x0000000003ffffffULL, 0x0000000007ffffffULL, 0x000000000fffffffULL,
+    0x000000001fffffffULL, 0x000000003fffffffULL, 0x000000007fffffffULL, 0x00000000ffffffffULL,
+    0x00000001ffffffffULL, 0x00000003ffffffffULL, 0x00000007ffffffffULL, 0x0000000fffffffffULL,
+    0x0000001fffffffffULL, 0x0000003fffffffffULL, 0x0000007fffffffffULL, 0x000000ffffffffffULL,
+    0x000001ffffffffffULL, 0x000003ffffffffffULL, 0x000007ffffffffffULL, 0x00000fffffffffffULL,
+    0x00001fffffffffffULL, 0x00003fffffffffffULL, 0x00007fffffffffffULL, 0x0000ffffffffffffULL,
+    0x0001ffffffffffffULL, 0x0003ffffffffffffULL, 0x0007ffffffffffffULL, 0x000fffffffffffffULL,
+    0x001fffffffffffffULL, 0x003fffffffffffffULL, 0x007fffffffffffffULL, 0x00ffffffffffffffULL,
+    0x01ffffffffffffffULL, 0x03ffffffffffffffULL, 0x07ffffffffffffffULL, 0x0fffffffffffffffULL,
+    0x1fffffffffffffffULL, 0x3fffffffffffffffULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0x8000000000000000ULL, 0x8000000000000001ULL, 0x8000000000000003ULL, 0x8000000000000007ULL,
+    0x800000000000000fULL, 0x800000000000001fULL, 0x800000000000003fULL, 0x800000000000007fULL,
+    0x80000000000000ffULL, 0x80000000000001ffULL, 0x80000000000003ffULL, 0x80000000000007ffULL,
+    0x8000000000000fffULL, 0x8000000000001fffULL, 0x8000000000003fffULL, 0x8000000000007fffULL,
+    0x800000000000ffffULL, 0x800000000001ffffULL, 0x800000000003ffffULL, 0x800000000007ffffULL,
+    0x80000000000fffffULL, 0x80000000001fffffULL, 0x80000000003fffffULL, 0x80000000007fffffULL,
+    0x8000000000ffffffULL, 0x8000000001ffffffULL, 0x8000000003ffffffULL, 0x8000000007ffffffULL,
+    0x800000000fffffffULL, 0x800000001fffffffULL, 0x800000003fffffffULL, 0x800000007fffffffULL,
+    0x80000000ffffffffULL, 0x80000001ffffffffULL, 0x80000003ffffffffULL, 0x80000007ffffffffULL,
+    0x8000000fffffffffULL, 0x8000001fffffffffULL, 0x8000003fffffffffULL, 0x8000007fffffffffULL,
+    0x800000ffffffffffULL, 0x800001ffffffffffULL, 0x800003ffffffffffULL, 0x800007ffffffffffULL,
+    0x80000fffffffffffULL, 0x80001fffffffffffULL, 0x80003fffffffffffULL, 0x80007fffffffffffULL,
+    0x8000ffffffffffffULL, 0x8001ffffffffffffULL, 0x8003ffffffffffffULL, 0x8007ffffffffffffULL,
+    0x800fffffffffffffULL, 0x801fffffffffffffULL, 0x803fffffffffffffULL, 0x807fffffffffffffULL,
+    0x80ffffffffffffffULL, 0x81ffffffffffffffULL, 0x83ffffffffffffffULL, 0x87ffffffffffffffULL,
+    0x8fffffffffffffffULL, 0x9fffffffffffffffULL, 0xbfffffffffffffffULL, 0x0000000000000000ULL,
+    0x4000000000000000ULL, 0xc000000000000000ULL, 0xc000000000000001ULL, 0xc000000000000003ULL,
+    0xc000000000000007ULL, 0xc00000000000000fULL, 0xc00000000000001fULL, 0xc00000000000003fULL,
+    0xc00000000000007fULL, 0xc0000000000000ffULL, 0xc0000000000001ffULL, 0xc0000000000003ffULL,
+    0xc0000000000007ffULL, 0xc000000000000fffULL, 0xc000000000001fffULL, 0xc000000000003fffULL,
+    0xc000000000007fffULL, 0xc00000000000ffffULL, 0xc00000000001ffffULL, 0xc00000000003ffffULL,
+    0xc00000000007ffffULL, 0xc0000000000fffffULL, 0xc0000000001fffffULL, 0xc0000000003fffffULL,
+    0xc0000000007fffffULL, 0xc000000000ffffffULL, 0xc000000001ffffffULL, 0xc000000003ffffffULL,
+    0xc000000007ffffffULL, 0xc00000000fffffffULL, 0xc00000001fffffffULL, 0xc00000003fffffffULL,
+    0xc00000007fffffffULL, 0xc0000000ffffffffULL, 0xc0000001ffffffffULL, 0xc0000003ffffffffULL,
+    0xc0000007ffffffffULL, 0xc000000fffffffffULL, 0xc000001fffffffffULL, 0xc000003fffffffffULL,
+    0xc000007fffffffffULL, 0xc00000ffffffffffULL, 0xc00001ffffffffffULL, 0xc00003ffffffffffULL,
+    0xc00007ffffffffffULL, 0xc0000fffffffffffULL, 0xc0001fffffffffffULL, 0xc0003fffffffffffULL,
+    0xc0007fffffffffffULL, 0xc000ffffffffffffULL, 0xc001ffffffffffffULL, 0xc003ffffffffffffULL,
+    0xc007ffffffffffffULL, 0xc00fffffffffffffULL, 0xc01fffffffffffffULL, 0xc03fffffffffffffULL,
+    0xc07fffffffffffffULL, 0xc0ffffffffffffffULL, 0xc1ffffffffffffffULL, 0xc3ffffffffffffffULL,
+    0xc7ffffffffffffffULL, 0xcfffffffffffffffULL, 0xdfffffffffffffffULL, 0x0000000000000000ULL,
+    0x2000000000000000ULL, 0x6000000000000000ULL, 0xe000000000000000ULL, 0xe000000000000001ULL,
+    0xe000000000000003ULL, 0xe000000000000007ULL, 0xe00000000000000fULL, 0xe00000000000001fULL,
+    0xe00000000000003fULL, 0xe00000000000007fULL, 0xe0000000000000ffULL, 0xe0000000000001ffULL,
+    0xe0000000000003ffULL, 0xe0000000000007ffULL, 0xe000000000000fffULL, 0xe000000000001fffULL,
+    0xe000000000003fffULL, 0xe000000000007fffULL, 0xe00000000000ffffULL, 0xe00000000001ffffULL,
+    0xe00000000003ffffULL, 0xe00000000007ffffULL, 0xe0000000000fffffULL, 0xe0000000001fffffULL,
+    0xe0000000003fffffULL, 0xe0000000007fffffULL, 0xe000000000ffffffULL, 0xe000000001ffffffULL,
+    0xe000000003ffffffULL, 0xe000000007ffffffULL, 0xe00000000fffffffULL, 0xe00000001fffffffULL,
+    0xe00000003fffffffULL, 0xe00000007fffffffULL, 0xe0000000ffffffffULL, 0xe0000001ffffffffULL,
+    0xe0000003ffffffffULL, 0xe0000007ffffffffULL, 0xe000000fffffffffULL, 0xe000001fffffffffULL,
+    0xe000003fffffffffULL, 0xe000007fffffffffULL, 0xe00000ffffffffffULL, 0xe00001ffffffffffULL,
+    0xe00003ffffffffffULL, 0xe00007ffffffffffULL, 0xe0000fffffffffffULL, 0xe0001fffffffffffULL,
+    0xe0003fffffffffffULL, 0xe0007fffffffffffULL, 0xe000ffffffffffffULL, 0xe001ffffffffffffULL,
+    0xe003ffffffffffffULL, 0xe007ffffffffffffULL, 0xe00fffffffffffffULL, 0xe01fffffffffffffULL,
+    0xe03fffffffffffffULL, 0xe07fffffffffffffULL, 0xe0ffffffffffffffULL, 0xe1ffffffffffffffULL,
+    0xe3ffffffffffffffULL, 0xe7ffffffffffffffULL, 0xefffffffffffffffULL, 0x0000000000000000ULL,
+    0x1000000000000000ULL, 0x3000000000000000ULL, 0x7000000000000000ULL, 0xf000000000000000ULL,
+    0xf000000000000001ULL, 0xf000000000000003ULL, 0xf000000000000007ULL, 0xf00000000000000fULL,
+    0xf00000000000001fULL, 0xf00000000000003fULL, 0xf00000000000007fULL, 0xf0000000000000ffULL,
+    0xf0000000000001ffULL, 0xf0000000000003ffULL, 0xf0000000000007ffULL, 0xf000000000000fffULL,
+    0xf000000000001fffULL, 0xf000000000003fffULL, 0xf000000000007fffULL, 0xf00000000000ffffULL,
+    0xf00000000001ffffULL, 0xf00000000003ffffULL, 0xf00000000007ffffULL, 0xf0000000000fffffULL,
+    0xf0000000001fffffULL, 0xf0000000003fffffULL, 0xf0000000007fffffULL, 0xf000000000ffffffULL,
+    0xf000000001ffffffULL, 0xf000000003ffffffULL, 0xf000000007ffffffULL, 0xf00000000fffffffULL,
+    0xf00000001fffffffULL, 0xf00000003fffffffULL, 0xf00000007fffffffULL, 0xf0000000ffffffffULL,
+    0xf0000001ffffffffULL, 0xf0000003ffffffffULL, 0xf0000007ffffffffULL, 0xf000000fffffffffULL,
+    0xf000001fffffffffULL, 0xf000003fffffffffULL, 0xf000007fffffffffULL, 0xf00000ffffffffffULL,
+    0xf00001ffffffffffULL, 0xf00003ffffffffffULL, 0xf00007ffffffffffULL, 0xf0000fffffffffffULL,
+    0xf0001fffffffffffULL, 0xf0003fffffffffffULL, 0xf0007fffffffffffULL, 0xf000ffffffffffffULL,
+    0xf001ffffffffffffULL, 0xf003ffffffffffffULL, 0xf007ffffffffffffULL, 0xf00fffffffffffffULL,
+    0xf01fffffffffffffULL, 0xf03fffffffffffffULL, 0xf07fffffffffffffULL, 0xf0ffffffffffffffULL,
+    0xf1ffffffffffffffULL, 0xf3ffffffffffffffULL, 0xf7ffffffffffffffULL, 0x0000000000000000ULL,
+    0x0800000000000000ULL, 0x1800000000000000ULL, 0x3800000000000000ULL, 0x7800000000000000ULL,
+    0xf800000000000000ULL, 0xf800000000000001ULL, 0xf800000000000003ULL, 0xf800000000000007ULL,
+    0xf80000000000000fULL, 0xf80000000000001fULL, 0xf80000000000003fULL, 0xf80000000000007fULL,
+    0xf8000000000000ffULL, 0xf8000000000001ffULL, 0xf8000000000003ffULL, 0xf8000000000007ffULL,
+    0xf800000000000fffULL, 0xf800000000001fffULL, 0xf800000000003fffULL, 0xf800000000007fffULL,
+    0xf80000000000ffffULL, 0xf80000000001ffffULL, 0xf80000000003ffffULL, 0xf80000000007ffffULL,
+    0xf8000000000fffffULL, 0xf8000000001fffffULL, 0xf8000000003fffffULL, 0xf8000000007fffffULL,
+    0xf800000000ffffffULL, 0xf800000001ffffffULL, 0xf800000003ffffffULL, 0xf800000007ffffffULL,
+    0xf80000000fffffffULL, 0xf80000001fffffffULL, 0xf80000003fffffffULL, 0xf80000007fffffffULL,
+    0xf8000000ffffffffULL, 0xf8000001ffffffffULL, 0xf8000003ffffffffULL, 0xf8000007ffffffffULL,
+    0xf800000fffffffffULL, 0xf800001fffffffffULL, 0xf800003fffffffffULL, 0xf800007fffffffffULL,
+    0xf80000ffffffffffULL, 0xf80001ffffffffffULL, 0xf80003ffffffffffULL, 0xf80007ffffffffffULL,
+    0xf8000fffffffffffULL, 0xf8001fffffffffffULL, 0xf8003fffffffffffULL, 0xf8007fffffffffffULL,
+    0xf800ffffffffffffULL, 0xf801ffffffffffffULL, 0xf803ffffffffffffULL, 0xf807ffffffffffffULL,
+    0xf80fffffffffffffULL, 0xf81fffffffffffffULL, 0xf83fffffffffffffULL, 0xf87fffffffffffffULL,
+    0xf8ffffffffffffffULL, 0xf9ffffffffffffffULL, 0xfbffffffffffffffULL, 0x0000000000000000ULL,
+    0x0400000000000000ULL, 0x0c00000000000000ULL, 0x1c00000000000000ULL, 0x3c00000000000000ULL,
+    0x7c00000000000000ULL, 0xfc00000000000000ULL, 0xfc00000000000001ULL, 0xfc00000000000003ULL,
+    0xfc00000000000007ULL, 0xfc0000000000000fULL, 0xfc0000000000001fULL, 0xfc0000000000003fULL,
+    0xfc0000000000007fULL, 0xfc000000000000ffULL, 0xfc000000000001ffULL, 0xfc000000000003ffULL,
+    0xfc000000000007ffULL, 0xfc00000000000fffULL, 0xfc00000000001fffULL, 0xfc00000000003fffULL,
+    0xfc00000000007fffULL, 0xfc0000000000ffffULL, 0xfc0000000001ffffULL, 0xfc0000000003ffffULL,
+    0xfc0000000007ffffULL, 0xfc000000000fffffULL, 0xfc000000001fffffULL, 0xfc000000003fffffULL,
+    0xfc000000007fffffULL, 0xfc00000000ffffffULL, 0xfc00000001ffffffULL, 0xfc00000003ffffffULL,
+    0xfc00000007ffffffULL, 0xfc0000000fffffffULL, 0xfc0000001fffffffULL, 0xfc0000003fffffffULL,
+    0xfc0000007fffffffULL, 0xfc000000ffffffffULL, 0xfc000001ffffffffULL, 0xfc000003ffffffffULL,
+    0xfc000007ffffffffULL, 0xfc00000fffffffffULL, 0xfc00001fffffffffULL, 0xfc00003fffffffffULL,
+    0xfc00007fffffffffULL, 0xfc0000ffffffffffULL, 0xfc0001ffffffffffULL, 0xfc0003ffffffffffULL,
+    0xfc0007ffffffffffULL, 0xfc000fffffffffffULL, 0xfc001fffffffffffULL, 0xfc003fffffffffffULL,
+    0xfc007fffffffffffULL, 0xfc00ffffffffffffULL, 0xfc01ffffffffffffULL, 0xfc03ffffffffffffULL,
+    0xfc07ffffffffffffULL, 0xfc0fffffffffffffULL, 0xfc1fffffffffffffULL, 0xfc3fffffffffffffULL,
+    0xfc7fffffffffffffULL, 0xfcffffffffffffffULL, 0xfdffffffffffffffULL, 0x0000000000000000ULL,
+    0x0200000000000000ULL, 0x0600000000000000ULL, 0x0e00000000000000ULL, 0x1e00000000000000ULL,
+    0x3e00000000000000ULL, 0x7e00000000000000ULL, 0xfe00000000000000ULL, 0xfe00000000000001ULL,
+    0xfe00000000000003ULL, 0xfe00000000000007ULL, 0xfe0000000000000fULL, 0xfe0000000000001fULL,
+    0xfe0000000000003fULL, 0xfe0000000000007fULL, 0xfe000000000000ffULL, 0xfe000000000001ffULL,
+    0xfe000000000003ffULL, 0xfe000000000007ffULL, 0xfe00000000000fffULL, 0xfe00000000001fffULL,
+    0xfe00000000003fffULL, 0xfe00000000007fffULL, 0xfe0000000000ffffULL, 0xfe0000000001ffffULL,
+    0xfe0000000003ffffULL, 0xfe0000000007ffffULL, 0xfe000000000fffffULL, 0xfe000000001fffffULL,
+    0xfe000000003fffffULL, 0xfe000000007fffffULL, 0xfe00000000ffffffULL, 0xfe00000001ffffffULL,
+    0xfe00000003ffffffULL, 0xfe00000007ffffffULL, 0xfe0000000fffffffULL, 0xfe0000001fffffffULL,
+    0xfe0000003fffffffULL, 0xfe0000007fffffffULL, 0xfe000000ffffffffULL, 0xfe000001ffffffffULL,
+    0xfe000003ffffffffULL, 0xfe000007ffffffffULL, 0xfe00000fffffffffULL, 0xfe00001fffffffffULL,
+    0xfe00003fffffffffULL, 0xfe00007fffffffffULL, 0xfe0000ffffffffffULL, 0xfe0001ffffffffffULL,
+    0xfe0003ffffffffffULL, 0xfe0007ffffffffffULL, 0xfe000fffffffffffULL, 0xfe001fffffffffffULL,
+    0xfe003fffffffffffULL, 0xfe007fffffffffffULL, 0xfe00ffffffffffffULL, 0xfe01ffffffffffffULL,
+    0xfe03ffffffffffffULL, 0xfe07ffffffffffffULL, 0xfe0fffffffffffffULL, 0xfe1fffffffffffffULL,
+    0xfe3fffffffffffffULL, 0xfe7fffffffffffffULL, 0xfeffffffffffffffULL, 0x0000000000000000ULL,
+    0x0100000000000000ULL, 0x0300000000000000ULL, 0x0700000000000000ULL, 0x0f00000000000000ULL,
+    0x1f00000000000000ULL, 0x3f00000000000000ULL, 0x7f00000000000000ULL, 0xff00000000000000ULL,
+    0xff00000000000001ULL, 0xff00000000000003ULL, 0xff00000000000007ULL, 0xff0000000000000fULL,
+    0xff0000000000001fULL, 0xff0000000000003fULL, 0xff0000000000007fULL, 0xff000000000000ffULL,
+    0xff000000000001ffULL, 0xff000000000003ffULL, 0xff000000000007ffULL, 0xff00000000000fffULL,
+    0xff00000000001fffULL, 0xff00000000003fffULL, 0xff00000000007fffULL, 0xff0000000000ffffULL,
+    0xff0000000001ffffULL, 0xff0000000003ffffULL, 0xff0000000007ffffULL, 0xff000000000fffffULL,
+    0xff000000001fffffULL, 0xff000000003fffffULL, 0xff000000007fffffULL, 0xff00000000ffffffULL,
+    0xff00000001ffffffULL, 0xff00000003ffffffULL, 0xff00000007ffffffULL, 0xff0000000fffffffULL,
+    0xff0000001fffffffULL, 0xff0000003fffffffULL, 0xff0000007fffffffULL, 0xff000000ffffffffULL,
+    0xff000001ffffffffULL, 0xff000003ffffffffULL, 0xff000007ffffffffULL, 0xff00000fffffffffULL,
+    0xff00001fffffffffULL, 0xff00003fffffffffULL, 0xff00007fffffffffULL, 0xff0000ffffffffffULL,
+    0xff0001ffffffffffULL, 0xff0003ffffffffffULL, 0xff0007ffffffffffULL, 0xff000fffffffffffULL,
+    0xff001fffffffffffULL, 0xff003fffffffffffULL, 0xff007fffffffffffULL, 0xff00ffffffffffffULL,
+    0xff01ffffffffffffULL, 0xff03ffffffffffffULL, 0xff07ffffffffffffULL, 0xff0fffffffffffffULL,
+    0xff1fffffffffffffULL, 0xff3fffffffffffffULL, 0xff7fffffffffffffULL, 0x0000000000000000ULL,
+    0x0080000000000000ULL, 0x0180000000000000ULL, 0x0380000000000000ULL, 0x0780000000000000ULL,
+    0x0f80000000000000ULL, 0x1f80000000000000ULL, 0x3f80000000000000ULL, 0x7f80000000000000ULL,
+    0xff80000000000000ULL, 0xff80000000000001ULL, 0xff80000000000003ULL, 0xff80000000000007ULL,
+    0xff8000000000000fULL, 0xff8000000000001fULL, 0xff8000000000003fULL, 0xff8000000000007fULL,
+    0xff800000000000ffULL, 0xff800000000001ffULL, 0xff800000000003ffULL, 0xff800000000007ffULL,
+    0xff80000000000fffULL, 0xff80000000001fffULL, 0xff80000000003fffULL, 0xff80000000007fffULL,
+    0xff8000000000ffffULL, 0xff8000000001ffffULL, 0xff8000000003ffffULL, 0xff8000000007ffffULL,
+    0xff800000000fffffULL, 0xff800000001fffffULL, 0xff800000003fffffULL, 0xff800000007fffffULL,
+    0xff80000000ffffffULL, 0xff80000001ffffffULL, 0xff80000003ffffffULL, 0xff80000007ffffffULL,
+    0xff8000000fffffffULL, 0xff8000001fffffffULL, 0xff8000003fffffffULL, 0xff8000007fffffffULL,
+    0xff800000ffffffffULL, 0xff800001ffffffffULL, 0xff800003ffffffffULL, 0xff800007ffffffffULL,
+    0xff80000fffffffffULL, 0xff80001fffffffffULL, 0xff80003fffffffffULL, 0xff80007fffffffffULL,
+    0xff8000ffffffffffULL, 0xff8001ffffffffffULL, 0xff8003ffffffffffULL, 0xff8007ffffffffffULL,
+    0xff800fffffffffffULL, 0xff801fffffffffffULL, 0xff803fffffffffffULL, 0xff807fffffffffffULL,
+    0xff80ffffffffffffULL, 0xff81ffffffffffffULL, 0xff83ffffffffffffULL, 0xff87ffffffffffffULL,
+    0xff8fffffffffffffULL, 0xff9fffffffffffffULL, 0xffbfffffffffffffULL, 0x0000000000000000ULL,
+    0x0040000000000000ULL, 0x00c0000000000000ULL, 0x01c0000000000000ULL, 0x03c0000000000000ULL,
+    0x07c0000000000000ULL, 0x0fc0000000000000ULL, 0x1fc0000000000000ULL, 0x3fc0000000000000ULL,
+    0x7fc0000000000000ULL, 0xffc0000000000000ULL, 0xffc0000000000001ULL, 0xffc0000000000003ULL,
+    0xffc0000000000007ULL, 0xffc000000000000fULL, 0xffc000000000001fULL, 0xffc000000000003fULL,
+    0xffc000000000007fULL, 0xffc00000000000ffULL, 0xffc00000000001ffULL, 0xffc00000000003ffULL,
+    0xffc00000000007ffULL, 0xffc0000000000fffULL, 0xffc0000000001fffULL, 0xffc0000000003fffULL,
+    0xffc0000000007fffULL, 0xffc000000000ffffULL, 0xffc000000001ffffULL, 0xffc000000003ffffULL,
+    0xffc000000007ffffULL, 0xffc00000000fffffULL, 0xffc00000001fffffULL, 0xffc00000003fffffULL,
+    0xffc00000007fffffULL, 0xffc0000000ffffffULL, 0xffc0000001ffffffULL, 0xffc0000003ffffffULL,
+    0xffc0000007ffffffULL, 0xffc000000fffffffULL, 0xffc000001fffffffULL, 0xffc000003fffffffULL,
+    0xffc000007fffffffULL, 0xffc00000ffffffffULL, 0xffc00001ffffffffULL, 0xffc00003ffffffffULL,
+    0xffc00007ffffffffULL, 0xffc0000fffffffffULL, 0xffc0001fffffffffULL, 0xffc0003fffffffffULL,
+    0xffc0007fffffffffULL, 0xffc000ffffffffffULL, 0xffc001ffffffffffULL, 0xffc003ffffffffffULL,
+    0xffc007ffffffffffULL, 0xffc00fffffffffffULL, 0xffc01fffffffffffULL, 0xffc03fffffffffffULL,
+    0xffc07fffffffffffULL, 0xffc0ffffffffffffULL, 0xffc1ffffffffffffULL, 0xffc3ffffffffffffULL,
+    0xffc7ffffffffffffULL, 0xffcfffffffffffffULL, 0xffdfffffffffffffULL, 0x0000000000000000ULL,
+    0x0020000000000000ULL, 0x0060000000000000ULL, 0x00e0000000000000ULL, 0x01e0000000000000ULL,
+    0x03e0000000000000ULL, 0x07e0000000000000ULL, 0x0fe0000000000000ULL, 0x1fe0000000000000ULL,
+    0x3fe0000000000000ULL, 0x7fe0000000000000ULL, 0xffe0000000000000ULL, 0xffe0000000000001ULL,
+    0xffe0000000000003ULL, 0xffe0000000000007ULL, 0xffe000000000000fULL, 0xffe000000000001fULL,
+    0xffe000000000003fULL, 0xffe000000000007fULL, 0xffe00000000000ffULL, 0xffe00000000001ffULL,
+    0xffe00000000003ffULL, 0xffe00000000007ffULL, 0xffe0000000000fffULL, 0xffe0000000001fffULL,
+    0xffe0000000003fffULL, 0xffe0000000007fffULL, 0xffe000000000ffffULL, 0xffe000000001ffffULL,
+    0xffe000000003ffffULL, 0xffe000000007ffffULL, 0xffe00000000fffffULL, 0xffe00000001fffffULL,
+    0xffe00000003fffffULL, 0xffe00000007fffffULL, 0xffe0000000ffffffULL, 0xffe0000001ffffffULL,
+    0xffe0000003ffffffULL, 0xffe0000007ffffffULL, 0xffe000000fffffffULL, 0xffe000001fffffffULL,
+    0xffe000003fffffffULL, 0xffe000007fffffffULL, 0xffe00000ffffffffULL, 0xffe00001ffffffffULL,
+    0xffe00003ffffffffULL, 0xffe00007ffffffffULL, 0xffe0000fffffffffULL, 0xffe0001fffffffffULL,
+    0xffe0003fffffffffULL, 0xffe0007fffffffffULL, 0xffe000ffffffffffULL, 0xffe001ffffffffffULL,
+    0xffe003ffffffffffULL, 0xffe007ffffffffffULL, 0xffe00fffffffffffULL, 0xffe01fffffffffffULL,
+    0xffe03fffffffffffULL, 0xffe07fffffffffffULL, 0xffe0ffffffffffffULL, 0xffe1ffffffffffffULL,
+    0xffe3ffffffffffffULL, 0xffe7ffffffffffffULL, 0xffefffffffffffffULL, 0x0000000000000000ULL,
+    0x0010000000000000ULL, 0x0030000000000000ULL, 0x0070000000000000ULL, 0x00f0000000000000ULL,
+    0x01f0000000000000ULL, 0x03f0000000000000ULL, 0x07f0000000000000ULL, 0x0ff0000000000000ULL,
+    0x1ff0000000000000ULL, 0x3ff0000000000000ULL, 0x7ff0000000000000ULL, 0xfff0000000000000ULL,
+    0xfff0000000000001ULL, 0xfff0000000000003ULL, 0xfff0000000000007ULL, 0xfff000000000000fULL,
+    0xfff000000000001fULL, 0xfff000000000003fULL, 0xfff000000000007fULL, 0xfff00000000000ffULL,
+    0xfff00000000001ffULL, 0xfff00000000003ffULL, 0xfff00000000007ffULL, 0xfff0000000000fffULL,
+    0xfff0000000001fffULL, 0xfff0000000003fffULL, 0xfff0000000007fffULL, 0xfff000000000ffffULL,
+    0xfff000000001ffffULL, 0xfff000000003ffffULL, 0xfff000000007ffffULL, 0xfff00000000fffffULL,
+    0xfff00000001fffffULL, 0xfff00000003fffffULL, 0xfff00000007fffffULL, 0xfff0000000ffffffULL,
+    0xfff0000001ffffffULL, 0xfff0000003ffffffULL, 0xfff0000007ffffffULL, 0xfff000000fffffffULL,
+    0xfff000001fffffffULL, 0xfff000003fffffffULL, 0xfff000007fffffffULL, 0xfff00000ffffffffULL,
+    0xfff00001ffffffffULL, 0xfff00003ffffffffULL, 0xfff00007ffffffffULL, 0xfff0000fffffffffULL,
+    0xfff0001fffffffffULL, 0xfff0003fffffffffULL, 0xfff0007fffffffffULL, 0xfff000ffffffffffULL,
+    0xfff001ffffffffffULL, 0xfff003ffffffffffULL, 0xfff007ffffffffffULL, 0xfff00fffffffffffULL,
+    0xfff01fffffffffffULL, 0xfff03fffffffffffULL, 0xfff07fffffffffffULL, 0xfff0ffffffffffffULL,
+    0xfff1ffffffffffffULL, 0xfff3ffffffffffffULL, 0xfff7ffffffffffffULL, 0x0000000000000000ULL,
+    0x0008000000000000ULL, 0x0018000000000000ULL, 0x0038000000000000ULL, 0x0078000000000000ULL,
+    0x00f8000000000000ULL, 0x01f8000000000000ULL, 0x03f8000000000000ULL, 0x07f8000000000000ULL,
+    0x0ff8000000000000ULL, 0x1ff8000000000000ULL, 0x3ff8000000000000ULL, 0x7ff8000000000000ULL,
+    0xfff8000000000000ULL, 0xfff8000000000001ULL, 0xfff8000000000003ULL, 0xfff8000000000007ULL,
+    0xfff800000000000fULL, 0xfff800000000001fULL, 0xfff800000000003fULL, 0xfff800000000007fULL,
+    0xfff80000000000ffULL, 0xfff80000000001ffULL, 0xfff80000000003ffULL, 0xfff80000000007ffULL,
+    0xfff8000000000fffULL, 0xfff8000000001fffULL, 0xfff8000000003fffULL, 0xfff8000000007fffULL,
+    0xfff800000000ffffULL, 0xfff800000001ffffULL, 0xfff800000003ffffULL, 0xfff800000007ffffULL,
+    0xfff80000000fffffULL, 0xfff80000001fffffULL, 0xfff80000003fffffULL, 0xfff80000007fffffULL,
+    0xfff8000000ffffffULL, 0xfff8000001ffffffULL, 0xfff8000003ffffffULL, 0xfff8000007ffffffULL,
+    0xfff800000fffffffULL, 0xfff800001fffffffULL, 0xfff800003fffffffULL, 0xfff800007fffffffULL,
+    0xfff80000ffffffffULL, 0xfff80001ffffffffULL, 0xfff80003ffffffffULL, 0xfff80007ffffffffULL,
+    0xfff8000fffffffffULL, 0xfff8001fffffffffULL, 0xfff8003fffffffffULL, 0xfff8007fffffffffULL,
+    0xfff800ffffffffffULL, 0xfff801ffffffffffULL, 0xfff803ffffffffffULL, 0xfff807ffffffffffULL,
+    0xfff80fffffffffffULL, 0xfff81fffffffffffULL, 0xfff83fffffffffffULL, 0xfff87fffffffffffULL,
+    0xfff8ffffffffffffULL, 0xfff9ffffffffffffULL, 0xfffbffffffffffffULL, 0x0000000000000000ULL,
+    0x0004000000000000ULL, 0x000c000000000000ULL, 0x001c000000000000ULL, 0x003c000000000000ULL,
+    0x007c000000000000ULL, 0x00fc000000000000ULL, 0x01fc000000000000ULL, 0x03fc000000000000ULL,
+    0x07fc000000000000ULL, 0x0ffc000000000000ULL, 0x1ffc000000000000ULL, 0x3ffc000000000000ULL,
+    0x7ffc000000000000ULL, 0xfffc000000000000ULL, 0xfffc000000000001ULL, 0xfffc000000000003ULL,
+    0xfffc000000000007ULL, 0xfffc00000000000fULL, 0xfffc00000000001fULL, 0xfffc00000000003fULL,
+    0xfffc00000000007fULL, 0xfffc0000000000ffULL, 0xfffc0000000001ffULL, 0xfffc0000000003ffULL,
+    0xfffc0000000007ffULL, 0xfffc000000000fffULL, 0xfffc000000001fffULL, 0xfffc000000003fffULL,
+    0xfffc000000007fffULL, 0xfffc00000000ffffULL, 0xfffc00000001ffffULL, 0xfffc00000003ffffULL,
+    0xfffc00000007ffffULL, 0xfffc0000000fffffULL, 0xfffc0000001fffffULL, 0xfffc0000003fffffULL,
+    0xfffc0000007fffffULL, 0xfffc000000ffffffULL, 0xfffc000001ffffffULL, 0xfffc000003ffffffULL,
+    0xfffc000007ffffffULL, 0xfffc00000fffffffULL, 0xfffc00001fffffffULL, 0xfffc00003fffffffULL,
+    0xfffc00007fffffffULL, 0xfffc0000ffffffffULL, 0xfffc0001ffffffffULL, 0xfffc0003ffffffffULL,
+    0xfffc0007ffffffffULL, 0xfffc000fffffffffULL, 0xfffc001fffffffffULL, 0xfffc003fffffffffULL,
+    0xfffc007fffffffffULL, 0xfffc00ffffffffffULL, 0xfffc01ffffffffffULL, 0xfffc03ffffffffffULL,
+    0xfffc07ffffffffffULL, 0xfffc0fffffffffffULL, 0xfffc1fffffffffffULL, 0xfffc3fffffffffffULL,
+    0xfffc7fffffffffffULL, 0xfffcffffffffffffULL, 0xfffdffffffffffffULL, 0x0000000000000000ULL,
+    0x0002000000000000ULL, 0x0006000000000000ULL, 0x000e000000000000ULL, 0x001e000000000000ULL,
+    0x003e000000000000ULL, 0x007e000000000000ULL, 0x00fe000000000000ULL, 0x01fe000000000000ULL,
+    0x03fe000000000000ULL, 0x07fe000000000000ULL, 0x0ffe000000000000ULL, 0x1ffe000000000000ULL,
+    0x3ffe000000000000ULL, 0x7ffe000000000000ULL, 0xfffe000000000000ULL, 0xfffe000000000001ULL,
+    0xfffe000000000003ULL, 0xfffe000000000007ULL, 0xfffe00000000000fULL, 0xfffe00000000001fULL,
+    0xfffe00000000003fULL, 0xfffe00000000007fULL, 0xfffe0000000000ffULL, 0xfffe0000000001ffULL,
+    0xfffe0000000003ffULL, 0xfffe0000000007ffULL, 0xfffe000000000fffULL, 0xfffe000000001fffULL,
+    0xfffe000000003fffULL, 0xfffe000000007fffULL, 0xfffe00000000ffffULL, 0xfffe00000001ffffULL,
+    0xfffe00000003ffffULL, 0xfffe00000007ffffULL, 0xfffe0000000fffffULL, 0xfffe0000001fffffULL,
+    0xfffe0000003fffffULL, 0xfffe0000007fffffULL, 0xfffe000000ffffffULL, 0xfffe000001ffffffULL,
+    0xfffe000003ffffffULL, 0xfffe000007ffffffULL, 0xfffe00000fffffffULL, 0xfffe00001fffffffULL,
+    0xfffe00003fffffffULL, 0xfffe00007fffffffULL, 0xfffe0000ffffffffULL, 0xfffe0001ffffffffULL,
+    0xfffe0003ffffffffULL, 0xfffe0007ffffffffULL, 0xfffe000fffffffffULL, 0xfffe001fffffffffULL,
+    0xfffe003fffffffffULL, 0xfffe007fffffffffULL, 0xfffe00ffffffffffULL, 0xfffe01ffffffffffULL,
+    0xfffe03ffffffffffULL, 0xfffe07ffffffffffULL, 0xfffe0fffffffffffULL, 0xfffe1fffffffffffULL,
+    0xfffe3fffffffffffULL, 0xfffe7fffffffffffULL, 0xfffeffffffffffffULL, 0x0000000000000000ULL,
+    0x0001000000000000ULL, 0x0003000000000000ULL, 0x0007000000000000ULL, 0x000f000000000000ULL,
+    0x001f000000000000ULL, 0x003f000000000000ULL, 0x007f000000000000ULL, 0x00ff000000000000ULL,
+    0x01ff000000000000ULL, 0x03ff000000000000ULL, 0x07ff000000000000ULL, 0x0fff000000000000ULL,
+    0x1fff000000000000ULL, 0x3fff000000000000ULL, 0x7fff000000000000ULL, 0xffff000000000000ULL,
+    0xffff000000000001ULL, 0xffff000000000003ULL, 0xffff000000000007ULL, 0xffff00000000000fULL,
+    0xffff00000000001fULL, 0xffff00000000003fULL, 0xffff00000000007fULL, 0xffff0000000000ffULL,
+    0xffff0000000001ffULL, 0xffff0000000003ffULL, 0xffff0000000007ffULL, 0xffff000000000fffULL,
+    0xffff000000001fffULL, 0xffff000000003fffULL, 0xffff000000007fffULL, 0xffff00000000ffffULL,
+    0xffff00000001ffffULL, 0xffff00000003ffffULL, 0xffff00000007ffffULL, 0xffff0000000fffffULL,
+    0xffff0000001fffffULL, 0xffff0000003fffffULL, 0xffff0000007fffffULL, 0xffff000000ffffffULL,
+    0xffff000001ffffffULL, 0xffff000003ffffffULL, 0xffff000007ffffffULL, 0xffff00000fffffffULL,
+    0xffff00001fffffffULL, 0xffff00003fffffffULL, 0xffff00007fffffffULL, 0xffff0000ffffffffULL,
+    0xffff0001ffffffffULL, 0xffff0003ffffffffULL, 0xffff0007ffffffffULL, 0xffff000fffffffffULL,
+    0xffff001fffffffffULL, 0xffff003fffffffffULL, 0xffff007fffffffffULL, 0xffff00ffffffffffULL,
+    0xffff01ffffffffffULL, 0xffff03ffffffffffULL, 0xffff07ffffffffffULL, 0xffff0fffffffffffULL,
+    0xffff1fffffffffffULL, 0xffff3fffffffffffULL, 0xffff7fffffffffffULL, 0x0000000000000000ULL,
+    0x0000800000000000ULL, 0x0001800000000000ULL, 0x0003800000000000ULL, 0x0007800000000000ULL,
+    0x000f800000000000ULL, 0x001f800000000000ULL, 0x003f800000000000ULL, 0x007f800000000000ULL,
+    0x00ff800000000000ULL, 0x01ff800000000000ULL, 0x03ff800000000000ULL, 0x07ff800000000000ULL,
+    0x0fff800000000000ULL, 0x1fff800000000000ULL, 0x3fff800000000000ULL, 0x7fff800000000000ULL,
+    0xffff800000000000ULL, 0xffff800000000001ULL, 0xffff800000000003ULL, 0xffff800000000007ULL,
+    0xffff80000000000fULL, 0xffff80000000001fULL, 0xffff80000000003fULL, 0xffff80000000007fULL,
+    0xffff8000000000ffULL, 0xffff8000000001ffULL, 0xffff8000000003ffULL, 0xffff8000000007ffULL,
+    0xffff800000000fffULL, 0xffff800000001fffULL, 0xffff800000003fffULL, 0xffff800000007fffULL,
+    0xffff80000000ffffULL, 0xffff80000001ffffULL, 0xffff80000003ffffULL, 0xffff80000007ffffULL,
+    0xffff8000000fffffULL, 0xffff8000001fffffULL, 0xffff8000003fffffULL, 0xffff8000007fffffULL,
+    0xffff800000ffffffULL, 0xffff800001ffffffULL, 0xffff800003ffffffULL, 0xffff800007ffffffULL,
+    0xffff80000fffffffULL, 0xffff80001fffffffULL, 0xffff80003fffffffULL, 0xffff80007fffffffULL,
+    0xffff8000ffffffffULL, 0xffff8001ffffffffULL, 0xffff8003ffffffffULL, 0xffff8007ffffffffULL,
+    0xffff800fffffffffULL, 0xffff801fffffffffULL, 0xffff803fffffffffULL, 0xffff807fffffffffULL,
+    0xffff80ffffffffffULL, 0xffff81ffffffffffULL, 0xffff83ffffffffffULL, 0xffff87ffffffffffULL,
+    0xffff8fffffffffffULL, 0xffff9fffffffffffULL, 0xffffbfffffffffffULL, 0x0000000000000000ULL,
+    0x0000400000000000ULL, 0x0000c00000000000ULL, 0x0001c00000000000ULL, 0x0003c00000000000ULL,
+    0x0007c00000000000ULL, 0x000fc00000000000ULL, 0x001fc00000000000ULL, 0x003fc00000000000ULL,
+    0x007fc00000000000ULL, 0x00ffc00000000000ULL, 0x01ffc00000000000ULL, 0x03ffc00000000000ULL,
+    0x07ffc00000000000ULL, 0x0fffc00000000000ULL, 0x1fffc00000000000ULL, 0x3fffc00000000000ULL,
+    0x7fffc00000000000ULL, 0xffffc00000000000ULL, 0xffffc00000000001ULL, 0xffffc00000000003ULL,
+    0xffffc00000000007ULL, 0xffffc0000000000fULL, 0xffffc0000000001fULL, 0xffffc0000000003fULL,
+    0xffffc0000000007fULL, 0xffffc000000000ffULL, 0xffffc000000001ffULL, 0xffffc000000003ffULL,
+    0xffffc000000007ffULL, 0xffffc00000000fffULL, 0xffffc00000001fffULL, 0xffffc00000003fffULL,
+    0xffffc00000007fffULL, 0xffffc0000000ffffULL, 0xffffc0000001ffffULL, 0xffffc0000003ffffULL,
+    0xffffc0000007ffffULL, 0xffffc000000fffffULL, 0xffffc000001fffffULL, 0xffffc000003fffffULL,
+    0xffffc000007fffffULL, 0xffffc00000ffffffULL, 0xffffc00001ffffffULL, 0xffffc00003ffffffULL,
+    0xffffc00007ffffffULL, 0xffffc0000fffffffULL, 0xffffc0001fffffffULL, 0xffffc0003fffffffULL,
+    0xffffc0007fffffffULL, 0xffffc000ffffffffULL, 0xffffc001ffffffffULL, 0xffffc003ffffffffULL,
+    0xffffc007ffffffffULL, 0xffffc00fffffffffULL, 0xffffc01fffffffffULL, 0xffffc03fffffffffULL,
+    0xffffc07fffffffffULL, 0xffffc0ffffffffffULL, 0xffffc1ffffffffffULL, 0xffffc3ffffffffffULL,
+    0xffffc7ffffffffffULL, 0xffffcfffffffffffULL, 0xffffdfffffffffffULL, 0x0000000000000000ULL,
+    0x0000200000000000ULL, 0x0000600000000000ULL, 0x0000e00000000000ULL, 0x0001e00000000000ULL,
+    0x0003e00000000000ULL, 0x0007e00000000000ULL, 0x000fe00000000000ULL, 0x001fe00000000000ULL,
+    0x003fe00000000000ULL, 0x007fe00000000000ULL, 0x00ffe00000000000ULL, 0x01ffe00000000000ULL,
+    0x03ffe00000000000ULL, 0x07ffe00000000000ULL, 0x0fffe00000000000ULL, 0x1fffe00000000000ULL,
+    0x3fffe00000000000ULL, 0x7fffe00000000000ULL, 0xffffe00000000000ULL, 0xffffe00000000001ULL,
+    0xffffe00000000003ULL, 0xffffe00000000007ULL, 0xffffe0000000000fULL, 0xffffe0000000001fULL,
+    0xffffe0000000003fULL, 0xffffe0000000007fULL, 0xffffe000000000ffULL, 0xffffe000000001ffULL,
+    0xffffe000000003ffULL, 0xffffe000000007ffULL, 0xffffe00000000fffULL, 0xffffe00000001fffULL,
+    0xffffe00000003fffULL, 0xffffe00000007fffULL, 0xffffe0000000ffffULL, 0xffffe0000001ffffULL,
+    0xffffe0000003ffffULL, 0xffffe0000007ffffULL, 0xffffe000000fffffULL, 0xffffe000001fffffULL,
+    0xffffe000003fffffULL, 0xffffe000007fffffULL, 0xffffe00000ffffffULL, 0xffffe00001ffffffULL,
+    0xffffe00003ffffffULL, 0xffffe00007ffffffULL, 0xffffe0000fffffffULL, 0xffffe0001fffffffULL,
+    0xffffe0003fffffffULL, 0xffffe0007fffffffULL, 0xffffe000ffffffffULL, 0xffffe001ffffffffULL,
+    0xffffe003ffffffffULL, 0xffffe007ffffffffULL, 0xffffe00fffffffffULL, 0xffffe01fffffffffULL,
+    0xffffe03fffffffffULL, 0xffffe07fffffffffULL, 0xffffe0ffffffffffULL, 0xffffe1ffffffffffULL,
+    0xffffe3ffffffffffULL, 0xffffe7ffffffffffULL, 0xffffefffffffffffULL, 0x0000000000000000ULL,
+    0x0000100000000000ULL, 0x0000300000000000ULL, 0x0000700000000000ULL, 0x0000f00000000000ULL,
+    0x0001f00000000000ULL, 0x0003f00000000000ULL, 0x0007f00000000000ULL, 0x000ff00000000000ULL,
+    0x001ff00000000000ULL, 0x003ff00000000000ULL, 0x007ff00000000000ULL, 0x00fff00000000000ULL,
+    0x01fff00000000000ULL, 0x03fff00000000000ULL, 0x07fff00000000000ULL, 0x0ffff00000000000ULL,
+    0x1ffff00000000000ULL, 0x3ffff00000000000ULL, 0x7ffff00000000000ULL, 0xfffff00000000000ULL,
+    0xfffff00000000001ULL, 0xfffff00000000003ULL, 0xfffff00000000007ULL, 0xfffff0000000000fULL,
+    0xfffff0000000001fULL, 0xfffff0000000003fULL, 0xfffff0000000007fULL, 0xfffff000000000ffULL,
+    0xfffff000000001ffULL, 0xfffff000000003ffULL, 0xfffff000000007ffULL, 0xfffff00000000fffULL,
+    0xfffff00000001fffULL, 0xfffff00000003fffULL, 0xfffff00000007fffULL, 0xfffff0000000ffffULL,
+    0xfffff0000001ffffULL, 0xfffff0000003ffffULL, 0xfffff0000007ffffULL, 0xfffff000000fffffULL,
+    0xfffff000001fffffULL, 0xfffff000003fffffULL, 0xfffff000007fffffULL, 0xfffff00000ffffffULL,
+    0xfffff00001ffffffULL, 0xfffff00003ffffffULL, 0xfffff00007ffffffULL, 0xfffff0000fffffffULL,
+    0xfffff0001fffffffULL, 0xfffff0003fffffffULL, 0xfffff0007fffffffULL, 0xfffff000ffffffffULL,
+    0xfffff001ffffffffULL, 0xfffff003ffffffffULL, 0xfffff007ffffffffULL, 0xfffff00fffffffffULL,
+    0xfffff01fffffffffULL, 0xfffff03fffffffffULL, 0xfffff07fffffffffULL, 0xfffff0ffffffffffULL,
+    0xfffff1ffffffffffULL, 0xfffff3ffffffffffULL, 0xfffff7ffffffffffULL, 0x0000000000000000ULL,
+    0x0000080000000000ULL, 0x0000180000000000ULL, 0x0000380000000000ULL, 0x0000780000000000ULL,
+    0x0000f80000000000ULL, 0x0001f80000000000ULL, 0x0003f80000000000ULL, 0x0007f80000000000ULL,
+    0x000ff80000000000ULL, 0x001ff80000000000ULL, 0x003ff80000000000ULL, 0x007ff80000000000ULL,
+    0x00fff80000000000ULL, 0x01fff80000000000ULL, 0x03fff80000000000ULL, 0x07fff80000000000ULL,
+    0x0ffff80000000000ULL, 0x1ffff80000000000ULL, 0x3ffff80000000000ULL, 0x7ffff80000000000ULL,
+    0xfffff80000000000ULL, 0xfffff80000000001ULL, 0xfffff80000000003ULL, 0xfffff80000000007ULL,
+    0xfffff8000000000fULL, 0xfffff8000000001fULL, 0xfffff8000000003fULL, 0xfffff8000000007fULL,
+    0xfffff800000000ffULL, 0xfffff800000001ffULL, 0xfffff800000003ffULL, 0xfffff800000007ffULL,
+    0xfffff80000000fffULL, 0xfffff80000001fffULL, 0xfffff80000003fffULL, 0xfffff80000007fffULL,
+    0xfffff8000000ffffULL, 0xfffff8000001ffffULL, 0xfffff8000003ffffULL, 0xfffff8000007ffffULL,
+    0xfffff800000fffffULL, 0xfffff800001fffffULL, 0xfffff800003fffffULL, 0xfffff800007fffffULL,
+    0xfffff80000ffffffULL, 0xfffff80001ffffffULL, 0xfffff80003ffffffULL, 0xfffff80007ffffffULL,
+    0xfffff8000fffffffULL, 0xfffff8001fffffffULL, 0xfffff8003fffffffULL, 0xfffff8007fffffffULL,
+    0xfffff800ffffffffULL, 0xfffff801ffffffffULL, 0xfffff803ffffffffULL, 0xfffff807ffffffffULL,
+    0xfffff80fffffffffULL, 0xfffff81fffffffffULL, 0xfffff83fffffffffULL, 0xfffff87fffffffffULL,
+    0xfffff8ffffffffffULL, 0xfffff9ffffffffffULL, 0xfffffbffffffffffULL, 0x0000000000000000ULL,
+    0x0000040000000000ULL, 0x00000c0000000000ULL, 0x00001c0000000000ULL, 0x00003c0000000000ULL,
+    0x00007c0000000000ULL, 0x0000fc0000000000ULL, 0x0001fc0000000000ULL, 0x0003fc0000000000ULL,
+    0x0007fc0000000000ULL, 0x000ffc0000000000ULL, 0x001ffc0000000000ULL, 0x003ffc0000000000ULL,
+    0x007ffc0000000000ULL, 0x00fffc0000000000ULL, 0x01fffc0000000000ULL, 0x03fffc0000000000ULL,
+    0x07fffc0000000000ULL, 0x0ffffc0000000000ULL, 0x1ffffc0000000000ULL, 0x3ffffc0000000000ULL,
+    0x7ffffc0000000000ULL, 0xfffffc0000000000ULL, 0xfffffc0000000001ULL, 0xfffffc0000000003ULL,
+    0xfffffc0000000007ULL, 0xfffffc000000000fULL, 0xfffffc000000001fULL, 0xfffffc000000003fULL,
+    0xfffffc000000007fULL, 0xfffffc00000000ffULL, 0xfffffc00000001ffULL, 0xfffffc00000003ffULL,
+    0xfffffc00000007ffULL, 0xfffffc0000000fffULL, 0xfffffc0000001fffULL, 0xfffffc0000003fffULL,
+    0xfffffc0000007fffULL, 0xfffffc000000ffffULL, 0xfffffc000001ffffULL, 0xfffffc000003ffffULL,
+    0xfffffc000007ffffULL, 0xfffffc00000fffffULL, 0xfffffc00001fffffULL, 0xfffffc00003fffffULL,
+    0xfffffc00007fffffULL, 0xfffffc0000ffffffULL, 0xfffffc0001ffffffULL, 0xfffffc0003ffffffULL,
+    0xfffffc0007ffffffULL, 0xfffffc000fffffffULL, 0xfffffc001fffffffULL, 0xfffffc003fffffffULL,
+    0xfffffc007fffffffULL, 0xfffffc00ffffffffULL, 0xfffffc01ffffffffULL, 0xfffffc03ffffffffULL,
+    0xfffffc07ffffffffULL, 0xfffffc0fffffffffULL, 0xfffffc1fffffffffULL, 0xfffffc3fffffffffULL,
+    0xfffffc7fffffffffULL, 0xfffffcffffffffffULL, 0xfffffdffffffffffULL, 0x0000000000000000ULL,
+    0x0000020000000000ULL, 0x0000060000000000ULL, 0x00000e0000000000ULL, 0x00001e0000000000ULL,
+    0x00003e0000000000ULL, 0x00007e0000000000ULL, 0x0000fe0000000000ULL, 0x0001fe0000000000ULL,
+    0x0003fe0000000000ULL, 0x0007fe0000000000ULL, 0x000ffe0000000000ULL, 0x001ffe0000000000ULL,
+    0x003ffe0000000000ULL, 0x007ffe0000000000ULL, 0x00fffe0000000000ULL, 0x01fffe0000000000ULL,
+    0x03fffe0000000000ULL, 0x07fffe0000000000ULL, 0x0ffffe0000000000ULL, 0x1ffffe0000000000ULL,
+    0x3ffffe0000000000ULL, 0x7ffffe0000000000ULL, 0xfffffe0000000000ULL, 0xfffffe0000000001ULL,
+    0xfffffe0000000003ULL, 0xfffffe0000000007ULL, 0xfffffe000000000fULL, 0xfffffe000000001fULL,
+    0xfffffe000000003fULL, 0xfffffe000000007fULL, 0xfffffe00000000ffULL, 0xfffffe00000001ffULL,
+    0xfffffe00000003ffULL, 0xfffffe00000007ffULL, 0xfffffe0000000fffULL, 0xfffffe0000001fffULL,
+    0xfffffe0000003fffULL, 0xfffffe0000007fffULL, 0xfffffe000000ffffULL, 0xfffffe000001ffffULL,
+    0xfffffe000003ffffULL, 0xfffffe000007ffffULL, 0xfffffe00000fffffULL, 0xfffffe00001fffffULL,
+    0xfffffe00003fffffULL, 0xfffffe00007fffffULL, 0xfffffe0000ffffffULL, 0xfffffe0001ffffffULL,
+    0xfffffe0003ffffffULL, 0xfffffe0007ffffffULL, 0xfffffe000fffffffULL, 0xfffffe001fffffffULL,
+    0xfffffe003fffffffULL, 0xfffffe007fffffffULL, 0xfffffe00ffffffffULL, 0xfffffe01ffffffffULL,
+    0xfffffe03ffffffffULL, 0xfffffe07ffffffffULL, 0xfffffe0fffffffffULL, 0xfffffe1fffffffffULL,
+    0xfffffe3fffffffffULL, 0xfffffe7fffffffffULL, 0xfffffeffffffffffULL, 0x0000000000000000ULL,
+    0x0000010000000000ULL, 0x0000030000000000ULL, 0x0000070000000000ULL, 0x00000f0000000000ULL,
+    0x00001f0000000000ULL, 0x00003f0000000000ULL, 0x00007f0000000000ULL, 0x0000ff0000000000ULL,
+    0x0001ff0000000000ULL, 0x0003ff0000000000ULL, 0x0007ff0000000000ULL, 0x000fff0000000000ULL,
+    0x001fff0000000000ULL, 0x003fff0000000000ULL, 0x007fff0000000000ULL, 0x00ffff0000000000ULL,
+    0x01ffff0000000000ULL, 0x03ffff0000000000ULL, 0x07ffff0000000000ULL, 0x0fffff0000000000ULL,
+    0x1fffff0000000000ULL, 0x3fffff0000000000ULL, 0x7fffff0000000000ULL, 0xffffff0000000000ULL,
+    0xffffff0000000001ULL, 0xffffff0000000003ULL, 0xffffff0000000007ULL, 0xffffff000000000fULL,
+    0xffffff000000001fULL, 0xffffff000000003fULL, 0xffffff000000007fULL, 0xffffff00000000ffULL,
+    0xffffff00000001ffULL, 0xffffff00000003ffULL, 0xffffff00000007ffULL, 0xffffff0000000fffULL,
+    0xffffff0000001fffULL, 0xffffff0000003fffULL, 0xffffff0000007fffULL, 0xffffff000000ffffULL,
+    0xffffff000001ffffULL, 0xffffff000003ffffULL, 0xffffff000007ffffULL, 0xffffff00000fffffULL,
+    0xffffff00001fffffULL, 0xffffff00003fffffULL, 0xffffff00007fffffULL, 0xffffff0000ffffffULL,
+    0xffffff0001ffffffULL, 0xffffff0003ffffffULL, 0xffffff0007ffffffULL, 0xffffff000fffffffULL,
+    0xffffff001fffffffULL, 0xffffff003fffffffULL, 0xffffff007fffffffULL, 0xffffff00ffffffffULL,
+    0xffffff01ffffffffULL, 0xffffff03ffffffffULL, 0xffffff07ffffffffULL, 0xffffff0fffffffffULL,
+    0xffffff1fffffffffULL, 0xffffff3fffffffffULL, 0xffffff7fffffffffULL, 0x0000000000000000ULL,
+    0x0000008000000000ULL, 0x0000018000000000ULL, 0x0000038000000000ULL, 0x0000078000000000ULL,
+    0x00000f8000000000ULL, 0x00001f8000000000ULL, 0x00003f8000000000ULL, 0x00007f8000000000ULL,
+    0x0000ff8000000000ULL, 0x0001ff8000000000ULL, 0x0003ff8000000000ULL, 0x0007ff8000000000ULL,
+    0x000fff8000000000ULL, 0x001fff8000000000ULL, 0x003fff8000000000ULL, 0x007fff8000000000ULL,
+    0x00ffff8000000000ULL, 0x01ffff8000000000ULL, 0x03ffff8000000000ULL, 0x07ffff8000000000ULL,
+    0x0fffff8000000000ULL, 0x1fffff8000000000ULL, 0x3fffff8000000000ULL, 0x7fffff8000000000ULL,
+    0xffffff8000000000ULL, 0xffffff8000000001ULL, 0xffffff8000000003ULL, 0xffffff8000000007ULL,
+    0xffffff800000000fULL, 0xffffff800000001fULL, 0xffffff800000003fULL, 0xffffff800000007fULL,
+    0xffffff80000000ffULL, 0xffffff80000001ffULL, 0xffffff80000003ffULL, 0xffffff80000007ffULL,
+    0xffffff8000000fffULL, 0xffffff8000001fffULL, 0xffffff8000003fffULL, 0xffffff8000007fffULL,
+    0xffffff800000ffffULL, 0xffffff800001ffffULL, 0xffffff800003ffffULL, 0xffffff800007ffffULL,
+    0xffffff80000fffffULL, 0xffffff80001fffffULL, 0xffffff80003fffffULL, 0xffffff80007fffffULL,
+    0xffffff8000ffffffULL, 0xffffff8001ffffffULL, 0xffffff8003ffffffULL, 0xffffff8007ffffffULL,
+    0xffffff800fffffffULL, 0xffffff801fffffffULL, 0xffffff803fffffffULL, 0xffffff807fffffffULL,
+    0xffffff80ffffffffULL, 0xffffff81ffffffffULL, 0xffffff83ffffffffULL, 0xffffff87ffffffffULL,
+    0xffffff8fffffffffULL, 0xffffff9fffffffffULL, 0xffffffbfffffffffULL, 0x0000000000000000ULL,
+    0x0000004000000000ULL, 0x000000c000000000ULL, 0x000001c000000000ULL, 0x000003c000000000ULL,
+    0x000007c000000000ULL, 0x00000fc000000000ULL, 0x00001fc000000000ULL, 0x00003fc000000000ULL,
+    0x00007fc000000000ULL, 0x0000ffc000000000ULL, 0x0001ffc000000000ULL, 0x0003ffc000000000ULL,
+    0x0007ffc000000000ULL, 0x000fffc000000000ULL, 0x001fffc000000000ULL, 0x003fffc000000000ULL,
+    0x007fffc000000000ULL, 0x00ffffc000000000ULL, 0x01ffffc000000000ULL, 0x03ffffc000000000ULL,
+    0x07ffffc000000000ULL, 0x0fffffc000000000ULL, 0x1fffffc000000000ULL, 0x3fffffc000000000ULL,
+    0x7fffffc000000000ULL, 0xffffffc000000000ULL, 0xffffffc000000001ULL, 0xffffffc000000003ULL,
+    0xffffffc000000007ULL, 0xffffffc00000000fULL, 0xffffffc00000001fULL, 0xffffffc00000003fULL,
+    0xffffffc00000007fULL, 0xffffffc0000000ffULL, 0xffffffc0000001ffULL, 0xffffffc0000003ffULL,
+    0xffffffc0000007ffULL, 0xffffffc000000fffULL, 0xffffffc000001fffULL, 0xffffffc000003fffULL,
+    0xffffffc000007fffULL, 0xffffffc00000ffffULL, 0xffffffc00001ffffULL, 0xffffffc00003ffffULL,
+    0xffffffc00007ffffULL, 0xffffffc0000fffffULL, 0xffffffc0001fffffULL, 0xffffffc0003fffffULL,
+    0xffffffc0007fffffULL, 0xffffffc000ffffffULL, 0xffffffc001ffffffULL, 0xffffffc003ffffffULL,
+    0xffffffc007ffffffULL, 0xffffffc00fffffffULL, 0xffffffc01fffffffULL, 0xffffffc03fffffffULL,
+    0xffffffc07fffffffULL, 0xffffffc0ffffffffULL, 0xffffffc1ffffffffULL, 0xffffffc3ffffffffULL,
+    0xffffffc7ffffffffULL, 0xffffffcfffffffffULL, 0xffffffdfffffffffULL, 0x0000000000000000ULL,
+    0x0000002000000000ULL, 0x0000006000000000ULL, 0x000000e000000000ULL, 0x000001e000000000ULL,
+    0x000003e000000000ULL, 0x000007e000000000ULL, 0x00000fe000000000ULL, 0x00001fe000000000ULL,
+    0x00003fe000000000ULL, 0x00007fe000000000ULL, 0x0000ffe000000000ULL, 0x0001ffe000000000ULL,
+    0x0003ffe000000000ULL, 0x0007ffe000000000ULL, 0x000fffe000000000ULL, 0x001fffe000000000ULL,
+    0x003fffe000000000ULL, 0x007fffe000000000ULL, 0x00ffffe000000000ULL, 0x01ffffe000000000ULL,
+    0x03ffffe000000000ULL, 0x07ffffe000000000ULL, 0x0fffffe000000000ULL, 0x1fffffe000000000ULL,
+    0x3fffffe000000000ULL, 0x7fffffe000000000ULL, 0xffffffe000000000ULL, 0xffffffe000000001ULL,
+    0xffffffe000000003ULL, 0xffffffe000000007ULL, 0xffffffe00000000fULL, 0xffffffe00000001fULL,
+    0xffffffe00000003fULL, 0xffffffe00000007fULL, 0xffffffe0000000ffULL, 0xffffffe0000001ffULL,
+    0xffffffe0000003ffULL, 0xffffffe0000007ffULL, 0xffffffe000000fffULL, 0xffffffe000001fffULL,
+    0xffffffe000003fffULL, 0xffffffe000007fffULL, 0xffffffe00000ffffULL, 0xffffffe00001ffffULL,
+    0xffffffe00003ffffULL, 0xffffffe00007ffffULL, 0xffffffe0000fffffULL, 0xffffffe0001fffffULL,
+    0xffffffe0003fffffULL, 0xffffffe0007fffffULL, 0xffffffe000ffffffULL, 0xffffffe001ffffffULL,
+    0xffffffe003ffffffULL, 0xffffffe007ffffffULL, 0xffffffe00fffffffULL, 0xffffffe01fffffffULL,
+    0xffffffe03fffffffULL, 0xffffffe07fffffffULL, 0xffffffe0ffffffffULL, 0xffffffe1ffffffffULL,
+    0xffffffe3ffffffffULL, 0xffffffe7ffffffffULL, 0xffffffefffffffffULL, 0x0000000000000000ULL,
+    0x0000001000000000ULL, 0x0000003000000000ULL, 0x0000007000000000ULL, 0x000000f000000000ULL,
+    0x000001f000000000ULL, 0x000003f000000000ULL, 0x000007f000000000ULL, 0x00000ff000000000ULL,
+    0x00001ff000000000ULL, 0x00003ff000000000ULL, 0x00007ff000000000ULL, 0x0000fff000000000ULL,
+    0x0001fff000000000ULL, 0x0003fff000000000ULL, 0x0007fff000000000ULL, 0x000ffff000000000ULL,
+    0x001ffff000000000ULL, 0x003ffff000000000ULL, 0x007ffff000000000ULL, 0x00fffff000000000ULL,
+    0x01fffff000000000ULL, 0x03fffff000000000ULL, 0x07fffff000000000ULL, 0x0ffffff000000000ULL,
+    0x1ffffff000000000ULL, 0x3ffffff000000000ULL, 0x7ffffff000000000ULL, 0xfffffff000000000ULL,
+    0xfffffff000000001ULL, 0xfffffff000000003ULL, 0xfffffff000000007ULL, 0xfffffff00000000fULL,
+    0xfffffff00000001fULL, 0xfffffff00000003fULL, 0xfffffff00000007fULL, 0xfffffff0000000ffULL,
+    0xfffffff0000001ffULL, 0xfffffff0000003ffULL, 0xfffffff0000007ffULL, 0xfffffff000000fffULL,
+    0xfffffff000001fffULL, 0xfffffff000003fffULL, 0xfffffff000007fffULL, 0xfffffff00000ffffULL,
+    0xfffffff00001ffffULL, 0xfffffff00003ffffULL, 0xfffffff00007ffffULL, 0xfffffff0000fffffULL,
+    0xfffffff0001fffffULL, 0xfffffff0003fffffULL, 0xfffffff0007fffffULL, 0xfffffff000ffffffULL,
+    0xfffffff001ffffffULL, 0xfffffff003ffffffULL, 0xfffffff007ffffffULL, 0xfffffff00fffffffULL,
+    0xfffffff01fffffffULL, 0xfffffff03fffffffULL, 0xfffffff07fffffffULL, 0xfffffff0ffffffffULL,
+    0xfffffff1ffffffffULL, 0xfffffff3ffffffffULL, 0xfffffff7ffffffffULL, 0x0000000000000000ULL,
+    0x0000000800000000ULL, 0x0000001800000000ULL, 0x0000003800000000ULL, 0x0000007800000000ULL,
+    0x000000f800000000ULL, 0x000001f800000000ULL, 0x000003f800000000ULL, 0x000007f800000000ULL,
+    0x00000ff800000000ULL, 0x00001ff800000000ULL, 0x00003ff800000000ULL, 0x00007ff800000000ULL,
+    0x0000fff800000000ULL, 0x0001fff800000000ULL, 0x0003fff800000000ULL, 0x0007fff800000000ULL,
+    0x000ffff800000000ULL, 0x001ffff800000000ULL, 0x003ffff800000000ULL, 0x007ffff800000000ULL,
+    0x00fffff800000000ULL, 0x01fffff800000000ULL, 0x03fffff800000000ULL, 0x07fffff800000000ULL,
+    0x0ffffff800000000ULL, 0x1ffffff800000000ULL, 0x3ffffff800000000ULL, 0x7ffffff800000000ULL,
+    0xfffffff800000000ULL, 0xfffffff800000001ULL, 0xfffffff800000003ULL, 0xfffffff800000007ULL,
+    0xfffffff80000000fULL, 0xfffffff80000001fULL, 0xfffffff80000003fULL, 0xfffffff80000007fULL,
+    0xfffffff8000000ffULL, 0xfffffff8000001ffULL, 0xfffffff8000003ffULL, 0xfffffff8000007ffULL,
+    0xfffffff800000fffULL, 0xfffffff800001fffULL, 0xfffffff800003fffULL, 0xfffffff800007fffULL,
+    0xfffffff80000ffffULL, 0xfffffff80001ffffULL, 0xfffffff80003ffffULL, 0xfffffff80007ffffULL,
+    0xfffffff8000fffffULL, 0xfffffff8001fffffULL, 0xfffffff8003fffffULL, 0xfffffff8007fffffULL,
+    0xfffffff800ffffffULL, 0xfffffff801ffffffULL, 0xfffffff803ffffffULL, 0xfffffff807ffffffULL,
+    0xfffffff80fffffffULL, 0xfffffff81fffffffULL, 0xfffffff83fffffffULL, 0xfffffff87fffffffULL,
+    0xfffffff8ffffffffULL, 0xfffffff9ffffffffULL, 0xfffffffbffffffffULL, 0x0000000000000000ULL,
+    0x0000000400000000ULL, 0x0000000c00000000ULL, 0x0000001c00000000ULL, 0x0000003c00000000ULL,
+    0x0000007c00000000ULL, 0x000000fc00000000ULL, 0x000001fc00000000ULL, 0x000003fc00000000ULL,
+    0x000007fc00000000ULL, 0x00000ffc00000000ULL, 0x00001ffc00000000ULL, 0x00003ffc00000000ULL,
+    0x00007ffc00000000ULL, 0x0000fffc00000000ULL, 0x0001fffc00000000ULL, 0x0003fffc00000000ULL,
+    0x0007fffc00000000ULL, 0x000ffffc00000000ULL, 0x001ffffc00000000ULL, 0x003ffffc00000000ULL,
+    0x007ffffc00000000ULL, 0x00fffffc00000000ULL, 0x01fffffc00000000ULL, 0x03fffffc00000000ULL,
+    0x07fffffc00000000ULL, 0x0ffffffc00000000ULL, 0x1ffffffc00000000ULL, 0x3ffffffc00000000ULL,
+    0x7ffffffc00000000ULL, 0xfffffffc00000000ULL, 0xfffffffc00000001ULL, 0xfffffffc00000003ULL,
+    0xfffffffc00000007ULL, 0xfffffffc0000000fULL, 0xfffffffc0000001fULL, 0xfffffffc0000003fULL,
+    0xfffffffc0000007fULL, 0xfffffffc000000ffULL, 0xfffffffc000001ffULL, 0xfffffffc000003ffULL,
+    0xfffffffc000007ffULL, 0xfffffffc00000fffULL, 0xfffffffc00001fffULL, 0xfffffffc00003fffULL,
+    0xfffffffc00007fffULL, 0xfffffffc0000ffffULL, 0xfffffffc0001ffffULL, 0xfffffffc0003ffffULL,
+    0xfffffffc0007ffffULL, 0xfffffffc000fffffULL, 0xfffffffc001fffffULL, 0xfffffffc003fffffULL,
+    0xfffffffc007fffffULL, 0xfffffffc00ffffffULL, 0xfffffffc01ffffffULL, 0xfffffffc03ffffffULL,
+    0xfffffffc07ffffffULL, 0xfffffffc0fffffffULL, 0xfffffffc1fffffffULL, 0xfffffffc3fffffffULL,
+    0xfffffffc7fffffffULL, 0xfffffffcffffffffULL, 0xfffffffdffffffffULL, 0x0000000000000000ULL,
+    0x0000000200000000ULL, 0x0000000600000000ULL, 0x0000000e00000000ULL, 0x0000001e00000000ULL,
+    0x0000003e00000000ULL, 0x0000007e00000000ULL, 0x000000fe00000000ULL, 0x000001fe00000000ULL,
+    0x000003fe00000000ULL, 0x000007fe00000000ULL, 0x00000ffe00000000ULL, 0x00001ffe00000000ULL,
+    0x00003ffe00000000ULL, 0x00007ffe00000000ULL, 0x0000fffe00000000ULL, 0x0001fffe00000000ULL,
+    0x0003fffe00000000ULL, 0x0007fffe00000000ULL, 0x000ffffe00000000ULL, 0x001ffffe00000000ULL,
+    0x003ffffe00000000ULL, 0x007ffffe00000000ULL, 0x00fffffe00000000ULL, 0x01fffffe00000000ULL,
+    0x03fffffe00000000ULL, 0x07fffffe00000000ULL, 0x0ffffffe00000000ULL, 0x1ffffffe00000000ULL,
+    0x3ffffffe00000000ULL, 0x7ffffffe00000000ULL, 0xfffffffe00000000ULL, 0xfffffffe00000001ULL,
+    0xfffffffe00000003ULL, 0xfffffffe00000007ULL, 0xfffffffe0000000fULL, 0xfffffffe0000001fULL,
+    0xfffffffe0000003fULL, 0xfffffffe0000007fULL, 0xfffffffe000000ffULL, 0xfffffffe000001ffULL,
+    0xfffffffe000003ffULL, 0xfffffffe000007ffULL, 0xfffffffe00000fffULL, 0xfffffffe00001fffULL,
+    0xfffffffe00003fffULL, 0xfffffffe00007fffULL, 0xfffffffe0000ffffULL, 0xfffffffe0001ffffULL,
+    0xfffffffe0003ffffULL, 0xfffffffe0007ffffULL, 0xfffffffe000fffffULL, 0xfffffffe001fffffULL,
+    0xfffffffe003fffffULL, 0xfffffffe007fffffULL, 0xfffffffe00ffffffULL, 0xfffffffe01ffffffULL,
+    0xfffffffe03ffffffULL, 0xfffffffe07ffffffULL, 0xfffffffe0fffffffULL, 0xfffffffe1fffffffULL,
+    0xfffffffe3fffffffULL, 0xfffffffe7fffffffULL, 0xfffffffeffffffffULL, 0x0000000000000000ULL,
+    0x0000000100000000ULL, 0x0000000300000000ULL, 0x0000000700000000ULL, 0x0000000f00000000ULL,
+    0x0000001f00000000ULL, 0x0000003f00000000ULL, 0x0000007f00000000ULL, 0x000000ff00000000ULL,
+    0x000001ff00000000ULL, 0x000003ff00000000ULL, 0x000007ff00000000ULL, 0x00000fff00000000ULL,
+    0x00001fff00000000ULL, 0x00003fff00000000ULL, 0x00007fff00000000ULL, 0x0000ffff00000000ULL,
+    0x0001ffff00000000ULL, 0x0003ffff00000000ULL, 0x0007ffff00000000ULL, 0x000fffff00000000ULL,
+    0x001fffff00000000ULL, 0x003fffff00000000ULL, 0x007fffff00000000ULL, 0x00ffffff00000000ULL,
+    0x01ffffff00000000ULL, 0x03ffffff00000000ULL, 0x07ffffff00000000ULL, 0x0fffffff00000000ULL,
+    0x1fffffff00000000ULL, 0x3fffffff00000000ULL, 0x7fffffff00000000ULL, 0xffffffff00000000ULL,
+    0xffffffff00000001ULL, 0xffffffff00000003ULL, 0xffffffff00000007ULL, 0xffffffff0000000fULL,
+    0xffffffff0000001fULL, 0xffffffff0000003fULL, 0xffffffff0000007fULL, 0xffffffff000000ffULL,
+    0xffffffff000001ffULL, 0xffffffff000003ffULL, 0xffffffff000007ffULL, 0xffffffff00000fffULL,
+    0xffffffff00001fffULL, 0xffffffff00003fffULL, 0xffffffff00007fffULL, 0xffffffff0000ffffULL,
+    0xffffffff0001ffffULL, 0xffffffff0003ffffULL, 0xffffffff0007ffffULL, 0xffffffff000fffffULL,
+    0xffffffff001fffffULL, 0xffffffff003fffffULL, 0xffffffff007fffffULL, 0xffffffff00ffffffULL,
+    0xffffffff01ffffffULL, 0xffffffff03ffffffULL, 0xffffffff07ffffffULL, 0xffffffff0fffffffULL,
+    0xffffffff1fffffffULL, 0xffffffff3fffffffULL, 0xffffffff7fffffffULL, 0x0000000000000000ULL,
+    0x0000000080000000ULL, 0x0000000180000000ULL, 0x0000000380000000ULL, 0x0000000780000000ULL,
+    0x0000000f80000000ULL, 0x0000001f80000000ULL, 0x0000003f80000000ULL, 0x0000007f80000000ULL,
+    0x000000ff80000000ULL, 0x000001ff80000000ULL, 0x000003ff80000000ULL, 0x000007ff80000000ULL,
+    0x00000fff80000000ULL, 0x00001fff80000000ULL, 0x00003fff80000000ULL, 0x00007fff80000000ULL,
+    0x0000ffff80000000ULL, 0x0001ffff80000000ULL, 0x0003ffff80000000ULL, 0x0007ffff80000000ULL,
+    0x000fffff80000000ULL, 0x001fffff80000000ULL, 0x003fffff80000000ULL, 0x007fffff80000000ULL,
+    0x00ffffff80000000ULL, 0x01ffffff80000000ULL, 0x03ffffff80000000ULL, 0x07ffffff80000000ULL,
+    0x0fffffff80000000ULL, 0x1fffffff80000000ULL, 0x3fffffff80000000ULL, 0x7fffffff80000000ULL,
+    0xffffffff80000000ULL, 0xffffffff80000001ULL, 0xffffffff80000003ULL, 0xffffffff80000007ULL,
+    0xffffffff8000000fULL, 0xffffffff8000001fULL, 0xffffffff8000003fULL, 0xffffffff8000007fULL,
+    0xffffffff800000ffULL, 0xffffffff800001ffULL, 0xffffffff800003ffULL, 0xffffffff800007ffULL,
+    0xffffffff80000fffULL, 0xffffffff80001fffULL, 0xffffffff80003fffULL, 0xffffffff80007fffULL,
+    0xffffffff8000ffffULL, 0xffffffff8001ffffULL, 0xffffffff8003ffffULL, 0xffffffff8007ffffULL,
+    0xffffffff800fffffULL, 0xffffffff801fffffULL, 0xffffffff803fffffULL, 0xffffffff807fffffULL,
+    0xffffffff80ffffffULL, 0xffffffff81ffffffULL, 0xffffffff83ffffffULL, 0xffffffff87ffffffULL,
+    0xffffffff8fffffffULL, 0xffffffff9fffffffULL, 0xffffffffbfffffffULL, 0x0000000000000000ULL,
+    0x0000000040000000ULL, 0x00000000c0000000ULL, 0x00000001c0000000ULL, 0x00000003c0000000ULL,
+    0x00000007c0000000ULL, 0x0000000fc0000000ULL, 0x0000001fc0000000ULL, 0x0000003fc0000000ULL,
+    0x0000007fc0000000ULL, 0x000000ffc0000000ULL, 0x000001ffc0000000ULL, 0x000003ffc0000000ULL,
+    0x000007ffc0000000ULL, 0x00000fffc0000000ULL, 0x00001fffc0000000ULL, 0x00003fffc0000000ULL,
+    0x00007fffc0000000ULL, 0x0000ffffc0000000ULL, 0x0001ffffc0000000ULL, 0x0003ffffc0000000ULL,
+    0x0007ffffc0000000ULL, 0x000fffffc0000000ULL, 0x001fffffc0000000ULL, 0x003fffffc0000000ULL,
+    0x007fffffc0000000ULL, 0x00ffffffc0000000ULL, 0x01ffffffc0000000ULL, 0x03ffffffc0000000ULL,
+    0x07ffffffc0000000ULL, 0x0fffffffc0000000ULL, 0x1fffffffc0000000ULL, 0x3fffffffc0000000ULL,
+    0x7fffffffc0000000ULL, 0xffffffffc0000000ULL, 0xffffffffc0000001ULL, 0xffffffffc0000003ULL,
+    0xffffffffc0000007ULL, 0xffffffffc000000fULL, 0xffffffffc000001fULL, 0xffffffffc000003fULL,
+    0xffffffffc000007fULL, 0xffffffffc00000ffULL, 0xffffffffc00001ffULL, 0xffffffffc00003ffULL,
+    0xffffffffc00007ffULL, 0xffffffffc0000fffULL, 0xffffffffc0001fffULL, 0xffffffffc0003fffULL,
+    0xffffffffc0007fffULL, 0xffffffffc000ffffULL, 0xffffffffc001ffffULL, 0xffffffffc003ffffULL,
+    0xffffffffc007ffffULL, 0xffffffffc00fffffULL, 0xffffffffc01fffffULL, 0xffffffffc03fffffULL,
+    0xffffffffc07fffffULL, 0xffffffffc0ffffffULL, 0xffffffffc1ffffffULL, 0xffffffffc3ffffffULL,
+    0xffffffffc7ffffffULL, 0xffffffffcfffffffULL, 0xffffffffdfffffffULL, 0x0000000000000000ULL,
+    0x0000000020000000ULL, 0x0000000060000000ULL, 0x00000000e0000000ULL, 0x00000001e0000000ULL,
+    0x00000003e0000000ULL, 0x00000007e0000000ULL, 0x0000000fe0000000ULL, 0x0000001fe0000000ULL,
+    0x0000003fe0000000ULL, 0x0000007fe0000000ULL, 0x000000ffe0000000ULL, 0x000001ffe0000000ULL,
+    0x000003ffe0000000ULL, 0x000007ffe0000000ULL, 0x00000fffe0000000ULL, 0x00001fffe0000000ULL,
+    0x00003fffe0000000ULL, 0x00007fffe0000000ULL, 0x0000ffffe0000000ULL, 0x0001ffffe0000000ULL,
+    0x0003ffffe0000000ULL, 0x0007ffffe0000000ULL, 0x000fffffe0000000ULL, 0x001fffffe0000000ULL,
+    0x003fffffe0000000ULL, 0x007fffffe0000000ULL, 0x00ffffffe0000000ULL, 0x01ffffffe0000000ULL,
+    0x03ffffffe0000000ULL, 0x07ffffffe0000000ULL, 0x0fffffffe0000000ULL, 0x1fffffffe0000000ULL,
+    0x3fffffffe0000000ULL, 0x7fffffffe0000000ULL, 0xffffffffe0000000ULL, 0xffffffffe0000001ULL,
+    0xffffffffe0000003ULL, 0xffffffffe0000007ULL, 0xffffffffe000000fULL, 0xffffffffe000001fULL,
+    0xffffffffe000003fULL, 0xffffffffe000007fULL, 0xffffffffe00000ffULL, 0xffffffffe00001ffULL,
+    0xffffffffe00003ffULL, 0xffffffffe00007ffULL, 0xffffffffe0000fffULL, 0xffffffffe0001fffULL,
+    0xffffffffe0003fffULL, 0xffffffffe0007fffULL, 0xffffffffe000ffffULL, 0xffffffffe001ffffULL,
+    0xffffffffe003ffffULL, 0xffffffffe007ffffULL, 0xffffffffe00fffffULL, 0xffffffffe01fffffULL,
+    0xffffffffe03fffffULL, 0xffffffffe07fffffULL, 0xffffffffe0ffffffULL, 0xffffffffe1ffffffULL,
+    0xffffffffe3ffffffULL, 0xffffffffe7ffffffULL, 0xffffffffefffffffULL, 0x0000000000000000ULL,
+    0x0000000010000000ULL, 0x0000000030000000ULL, 0x0000000070000000ULL, 0x00000000f0000000ULL,
+    0x00000001f0000000ULL, 0x00000003f0000000ULL, 0x00000007f0000000ULL, 0x0000000ff0000000ULL,
+    0x0000001ff0000000ULL, 0x0000003ff0000000ULL, 0x0000007ff0000000ULL, 0x000000fff0000000ULL,
+    0x000001fff0000000ULL, 0x000003fff0000000ULL, 0x000007fff0000000ULL, 0x00000ffff0000000ULL,
+    0x00001ffff0000000ULL, 0x00003ffff0000000ULL, 0x00007ffff0000000ULL, 0x0000fffff0000000ULL,
+    0x0001fffff0000000ULL, 0x0003fffff0000000ULL, 0x0007fffff0000000ULL, 0x000ffffff0000000ULL,
+    0x001ffffff0000000ULL, 0x003ffffff0000000ULL, 0x007ffffff0000000ULL, 0x00fffffff0000000ULL,
+    0x01fffffff0000000ULL, 0x03fffffff0000000ULL, 0x07fffffff0000000ULL, 0x0ffffffff0000000ULL,
+    0x1ffffffff0000000ULL, 0x3ffffffff0000000ULL, 0x7ffffffff0000000ULL, 0xfffffffff0000000ULL,
+    0xfffffffff0000001ULL, 0xfffffffff0000003ULL, 0xfffffffff0000007ULL, 0xfffffffff000000fULL,
+    0xfffffffff000001fULL, 0xfffffffff000003fULL, 0xfffffffff000007fULL, 0xfffffffff00000ffULL,
+    0xfffffffff00001ffULL, 0xfffffffff00003ffULL, 0xfffffffff00007ffULL, 0xfffffffff0000fffULL,
+    0xfffffffff0001fffULL, 0xfffffffff0003fffULL, 0xfffffffff0007fffULL, 0xfffffffff000ffffULL,
+    0xfffffffff001ffffULL, 0xfffffffff003ffffULL, 0xfffffffff007ffffULL, 0xfffffffff00fffffULL,
+    0xfffffffff01fffffULL, 0xfffffffff03fffffULL, 0xfffffffff07fffffULL, 0xfffffffff0ffffffULL,
+    0xfffffffff1ffffffULL, 0xfffffffff3ffffffULL, 0xfffffffff7ffffffULL, 0x0000000000000000ULL,
+    0x0000000008000000ULL, 0x0000000018000000ULL, 0x0000000038000000ULL, 0x0000000078000000ULL,
+    0x00000000f8000000ULL, 0x00000001f8000000ULL, 0x00000003f8000000ULL, 0x00000007f8000000ULL,
+    0x0000000ff8000000ULL, 0x0000001ff8000000ULL, 0x0000003ff8000000ULL, 0x0000007ff8000000ULL,
+    0x000000fff8000000ULL, 0x000001fff8000000ULL, 0x000003fff8000000ULL, 0x000007fff8000000ULL,
+    0x00000ffff8000000ULL, 0x00001ffff8000000ULL, 0x00003ffff8000000ULL, 0x00007ffff8000000ULL,
+    0x0000fffff8000000ULL, 0x0001fffff8000000ULL, 0x0003fffff8000000ULL, 0x0007fffff8000000ULL,
+    0x000ffffff8000000ULL, 0x001ffffff8000000ULL, 0x003ffffff8000000ULL, 0x007ffffff8000000ULL,
+    0x00fffffff8000000ULL, 0x01fffffff8000000ULL, 0x03fffffff8000000ULL, 0x07fffffff8000000ULL,
+    0x0ffffffff8000000ULL, 0x1ffffffff8000000ULL, 0x3ffffffff8000000ULL, 0x7ffffffff8000000ULL,
+    0xfffffffff8000000ULL, 0xfffffffff8000001ULL, 0xfffffffff8000003ULL, 0xfffffffff8000007ULL,
+    0xfffffffff800000fULL, 0xfffffffff800001fULL, 0xfffffffff800003fULL, 0xfffffffff800007fULL,
+    0xfffffffff80000ffULL, 0xfffffffff80001ffULL, 0xfffffffff80003ffULL, 0xfffffffff80007ffULL,
+    0xfffffffff8000fffULL, 0xfffffffff8001fffULL, 0xfffffffff8003fffULL, 0xfffffffff8007fffULL,
+    0xfffffffff800ffffULL, 0xfffffffff801ffffULL, 0xfffffffff803ffffULL, 0xfffffffff807ffffULL,
+    0xfffffffff80fffffULL, 0xfffffffff81fffffULL, 0xfffffffff83fffffULL, 0xfffffffff87fffffULL,
+    0xfffffffff8ffffffULL, 0xfffffffff9ffffffULL, 0xfffffffffbffffffULL, 0x0000000000000000ULL,
+    0x0000000004000000ULL, 0x000000000c000000ULL, 0x000000001c000000ULL, 0x000000003c000000ULL,
+    0x000000007c000000ULL, 0x00000000fc000000ULL, 0x00000001fc000000ULL, 0x00000003fc000000ULL,
+    0x00000007fc000000ULL, 0x0000000ffc000000ULL, 0x0000001ffc000000ULL, 0x0000003ffc000000ULL,
+    0x0000007ffc000000ULL, 0x000000fffc000000ULL, 0x000001fffc000000ULL, 0x000003fffc000000ULL,
+    0x000007fffc000000ULL, 0x00000ffffc000000ULL, 0x00001ffffc000000ULL, 0x00003ffffc000000ULL,
+    0x00007ffffc000000ULL, 0x0000fffffc000000ULL, 0x0001fffffc000000ULL, 0x0003fffffc000000ULL,
+    0x0007fffffc000000ULL, 0x000ffffffc000000ULL, 0x001ffffffc000000ULL, 0x003ffffffc000000ULL,
+    0x007ffffffc000000ULL, 0x00fffffffc000000ULL, 0x01fffffffc000000ULL, 0x03fffffffc000000ULL,
+    0x07fffffffc000000ULL, 0x0ffffffffc000000ULL, 0x1ffffffffc000000ULL, 0x3ffffffffc000000ULL,
+    0x7ffffffffc000000ULL, 0xfffffffffc000000ULL, 0xfffffffffc000001ULL, 0xfffffffffc000003ULL,
+    0xfffffffffc000007ULL, 0xfffffffffc00000fULL, 0xfffffffffc00001fULL, 0xfffffffffc00003fULL,
+    0xfffffffffc00007fULL, 0xfffffffffc0000ffULL, 0xfffffffffc0001ffULL, 0xfffffffffc0003ffULL,
+    0xfffffffffc0007ffULL, 0xfffffffffc000fffULL, 0xfffffffffc001fffULL, 0xfffffffffc003fffULL,
+    0xfffffffffc007fffULL, 0xfffffffffc00ffffULL, 0xfffffffffc01ffffULL, 0xfffffffffc03ffffULL,
+    0xfffffffffc07ffffULL, 0xfffffffffc0fffffULL, 0xfffffffffc1fffffULL, 0xfffffffffc3fffffULL,
+    0xfffffffffc7fffffULL, 0xfffffffffcffffffULL, 0xfffffffffdffffffULL, 0x0000000000000000ULL,
+    0x0000000002000000ULL, 0x0000000006000000ULL, 0x000000000e000000ULL, 0x000000001e000000ULL,
+    0x000000003e000000ULL, 0x000000007e000000ULL, 0x00000000fe000000ULL, 0x00000001fe000000ULL,
+    0x00000003fe000000ULL, 0x00000007fe000000ULL, 0x0000000ffe000000ULL, 0x0000001ffe000000ULL,
+    0x0000003ffe000000ULL, 0x0000007ffe000000ULL, 0x000000fffe000000ULL, 0x000001fffe000000ULL,
+    0x000003fffe000000ULL, 0x000007fffe000000ULL, 0x00000ffffe000000ULL, 0x00001ffffe000000ULL,
+    0x00003ffffe000000ULL, 0x00007ffffe000000ULL, 0x0000fffffe000000ULL, 0x0001fffffe000000ULL,
+    0x0003fffffe000000ULL, 0x0007fffffe000000ULL, 0x000ffffffe000000ULL, 0x001ffffffe000000ULL,
+    0x003ffffffe000000ULL, 0x007ffffffe000000ULL, 0x00fffffffe000000ULL, 0x01fffffffe000000ULL,
+    0x03fffffffe000000ULL, 0x07fffffffe000000ULL, 0x0ffffffffe000000ULL, 0x1ffffffffe000000ULL,
+    0x3ffffffffe000000ULL, 0x7ffffffffe000000ULL, 0xfffffffffe000000ULL, 0xfffffffffe000001ULL,
+    0xfffffffffe000003ULL, 0xfffffffffe000007ULL, 0xfffffffffe00000fULL, 0xfffffffffe00001fULL,
+    0xfffffffffe00003fULL, 0xfffffffffe00007fULL, 0xfffffffffe0000ffULL, 0xfffffffffe0001ffULL,
+    0xfffffffffe0003ffULL, 0xfffffffffe0007ffULL, 0xfffffffffe000fffULL, 0xfffffffffe001fffULL,
+    0xfffffffffe003fffULL, 0xfffffffffe007fffULL, 0xfffffffffe00ffffULL, 0xfffffffffe01ffffULL,
+    0xfffffffffe03ffffULL, 0xfffffffffe07ffffULL, 0xfffffffffe0fffffULL, 0xfffffffffe1fffffULL,
+    0xfffffffffe3fffffULL, 0xfffffffffe7fffffULL, 0xfffffffffeffffffULL, 0x0000000000000000ULL,
+    0x0000000001000000ULL, 0x0000000003000000ULL, 0x0000000007000000ULL, 0x000000000f000000ULL,
+    0x000000001f000000ULL, 0x000000003f000000ULL, 0x000000007f000000ULL, 0x00000000ff000000ULL,
+    0x00000001ff000000ULL, 0x00000003ff000000ULL, 0x00000007ff000000ULL, 0x0000000fff000000ULL,
+    0x0000001fff000000ULL, 0x0000003fff000000ULL, 0x0000007fff000000ULL, 0x000000ffff000000ULL,
+    0x000001ffff000000ULL, 0x000003ffff000000ULL, 0x000007ffff000000ULL, 0x00000fffff000000ULL,
+    0x00001fffff000000ULL, 0x00003fffff000000ULL, 0x00007fffff000000ULL, 0x0000ffffff000000ULL,
+    0x0001ffffff000000ULL, 0x0003ffffff000000ULL, 0x0007ffffff000000ULL, 0x000fffffff000000ULL,
+    0x001fffffff000000ULL, 0x003fffffff000000ULL, 0x007fffffff000000ULL, 0x00ffffffff000000ULL,
+    0x01ffffffff000000ULL, 0x03ffffffff000000ULL, 0x07ffffffff000000ULL, 0x0fffffffff000000ULL,
+    0x1fffffffff000000ULL, 0x3fffffffff000000ULL, 0x7fffffffff000000ULL, 0xffffffffff000000ULL,
+    0xffffffffff000001ULL, 0xffffffffff000003ULL, 0xffffffffff000007ULL, 0xffffffffff00000fULL,
+    0xffffffffff00001fULL, 0xffffffffff00003fULL, 0xffffffffff00007fULL, 0xffffffffff0000ffULL,
+    0xffffffffff0001ffULL, 0xffffffffff0003ffULL, 0xffffffffff0007ffULL, 0xffffffffff000fffULL,
+    0xffffffffff001fffULL, 0xffffffffff003fffULL, 0xffffffffff007fffULL, 0xffffffffff00ffffULL,
+    0xffffffffff01ffffULL, 0xffffffffff03ffffULL, 0xffffffffff07ffffULL, 0xffffffffff0fffffULL,
+    0xffffffffff1fffffULL, 0xffffffffff3fffffULL, 0xffffffffff7fffffULL, 0x0000000000000000ULL,
+    0x0000000000800000ULL, 0x0000000001800000ULL, 0x0000000003800000ULL, 0x0000000007800000ULL,
+    0x000000000f800000ULL, 0x000000001f800000ULL, 0x000000003f800000ULL, 0x000000007f800000ULL,
+    0x00000000ff800000ULL, 0x00000001ff800000ULL, 0x00000003ff800000ULL, 0x00000007ff800000ULL,
+    0x0000000fff800000ULL, 0x0000001fff800000ULL, 0x0000003fff800000ULL, 0x0000007fff800000ULL,
+    0x000000ffff800000ULL, 0x000001ffff800000ULL, 0x000003ffff800000ULL, 0x000007ffff800000ULL,
+    0x00000fffff800000ULL, 0x00001fffff800000ULL, 0x00003fffff800000ULL, 0x00007fffff800000ULL,
+    0x0000ffffff800000ULL, 0x0001ffffff800000ULL, 0x0003ffffff800000ULL, 0x0007ffffff800000ULL,
+    0x000fffffff800000ULL, 0x001fffffff800000ULL, 0x003fffffff800000ULL, 0x007fffffff800000ULL,
+    0x00ffffffff800000ULL, 0x01ffffffff800000ULL, 0x03ffffffff800000ULL, 0x07ffffffff800000ULL,
+    0x0fffffffff800000ULL, 0x1fffffffff800000ULL, 0x3fffffffff800000ULL, 0x7fffffffff800000ULL,
+    0xffffffffff800000ULL, 0xffffffffff800001ULL, 0xffffffffff800003ULL, 0xffffffffff800007ULL,
+    0xffffffffff80000fULL, 0xffffffffff80001fULL, 0xffffffffff80003fULL, 0xffffffffff80007fULL,
+    0xffffffffff8000ffULL, 0xffffffffff8001ffULL, 0xffffffffff8003ffULL, 0xffffffffff8007ffULL,
+    0xffffffffff800fffULL, 0xffffffffff801fffULL, 0xffffffffff803fffULL, 0xffffffffff807fffULL,
+    0xffffffffff80ffffULL, 0xffffffffff81ffffULL, 0xffffffffff83ffffULL, 0xffffffffff87ffffULL,
+    0xffffffffff8fffffULL, 0xffffffffff9fffffULL, 0xffffffffffbfffffULL, 0x0000000000000000ULL,
+    0x0000000000400000ULL, 0x0000000000c00000ULL, 0x0000000001c00000ULL, 0x0000000003c00000ULL,
+    0x0000000007c00000ULL, 0x000000000fc00000ULL, 0x000000001fc00000ULL, 0x000000003fc00000ULL,
+    0x000000007fc00000ULL, 0x00000000ffc00000ULL, 0x00000001ffc00000ULL, 0x00000003ffc00000ULL,
+    0x00000007ffc00000ULL, 0x0000000fffc00000ULL, 0x0000001fffc00000ULL, 0x0000003fffc00000ULL,
+    0x0000007fffc00000ULL, 0x000000ffffc00000ULL, 0x000001ffffc00000ULL, 0x000003ffffc00000ULL,
+    0x000007ffffc00000ULL, 0x00000fffffc00000ULL, 0x00001fffffc00000ULL, 0x00003fffffc00000ULL,
+    0x00007fffffc00000ULL, 0x0000ffffffc00000ULL, 0x0001ffffffc00000ULL, 0x0003ffffffc00000ULL,
+    0x0007ffffffc00000ULL, 0x000fffffffc00000ULL, 0x001fffffffc00000ULL, 0x003fffffffc00000ULL,
+    0x007fffffffc00000ULL, 0x00ffffffffc00000ULL, 0x01ffffffffc00000ULL, 0x03ffffffffc00000ULL,
+    0x07ffffffffc00000ULL, 0x0fffffffffc00000ULL, 0x1fffffffffc00000ULL, 0x3fffffffffc00000ULL,
+    0x7fffffffffc00000ULL, 0xffffffffffc00000ULL, 0xffffffffffc00001ULL, 0xffffffffffc00003ULL,
+    0xffffffffffc00007ULL, 0xffffffffffc0000fULL, 0xffffffffffc0001fULL, 0xffffffffffc0003fULL,
+    0xffffffffffc0007fULL, 0xffffffffffc000ffULL, 0xffffffffffc001ffULL, 0xffffffffffc003ffULL,
+    0xffffffffffc007ffULL, 0xffffffffffc00fffULL, 0xffffffffffc01fffULL, 0xffffffffffc03fffULL,
+    0xffffffffffc07fffULL, 0xffffffffffc0ffffULL, 0xffffffffffc1ffffULL, 0xffffffffffc3ffffULL,
+    0xffffffffffc7ffffULL, 0xffffffffffcfffffULL, 0xffffffffffdfffffULL, 0x0000000000000000ULL,
+    0x0000000000200000ULL, 0x0000000000600000ULL, 0x0000000000e00000ULL, 0x0000000001e00000ULL,
+    0x0000000003e00000ULL, 0x0000000007e00000ULL, 0x000000000fe00000ULL, 0x000000001fe00000ULL,
+    0x000000003fe00000ULL, 0x000000007fe00000ULL, 0x00000000ffe00000ULL, 0x00000001ffe00000ULL,
+    0x00000003ffe00000ULL, 0x00000007ffe00000ULL, 0x0000000fffe00000ULL, 0x0000001fffe00000ULL,
+    0x0000003fffe00000ULL, 0x0000007fffe00000ULL, 0x000000ffffe00000ULL, 0x000001ffffe00000ULL,
+    0x000003ffffe00000ULL, 0x000007ffffe00000ULL, 0x00000fffffe00000ULL, 0x00001fffffe00000ULL,
+    0x00003fffffe00000ULL, 0x00007fffffe00000ULL, 0x0000ffffffe00000ULL, 0x0001ffffffe00000ULL,
+    0x0003ffffffe00000ULL, 0x0007ffffffe00000ULL, 0x000fffffffe00000ULL, 0x001fffffffe00000ULL,
+    0x003fffffffe00000ULL, 0x007fffffffe00000ULL, 0x00ffffffffe00000ULL, 0x01ffffffffe00000ULL,
+    0x03ffffffffe00000ULL, 0x07ffffffffe00000ULL, 0x0fffffffffe00000ULL, 0x1fffffffffe00000ULL,
+    0x3fffffffffe00000ULL, 0x7fffffffffe00000ULL, 0xffffffffffe00000ULL, 0xffffffffffe00001ULL,
+    0xffffffffffe00003ULL, 0xffffffffffe00007ULL, 0xffffffffffe0000fULL, 0xffffffffffe0001fULL,
+    0xffffffffffe0003fULL, 0xffffffffffe0007fULL, 0xffffffffffe000ffULL, 0xffffffffffe001ffULL,
+    0xffffffffffe003ffULL, 0xffffffffffe007ffULL, 0xffffffffffe00fffULL, 0xffffffffffe01fffULL,
+    0xffffffffffe03fffULL, 0xffffffffffe07fffULL, 0xffffffffffe0ffffULL, 0xffffffffffe1ffffULL,
+    0xffffffffffe3ffffULL, 0xffffffffffe7ffffULL, 0xffffffffffefffffULL, 0x0000000000000000ULL,
+    0x0000000000100000ULL, 0x0000000000300000ULL, 0x0000000000700000ULL, 0x0000000000f00000ULL,
+    0x0000000001f00000ULL, 0x0000000003f00000ULL, 0x0000000007f00000ULL, 0x000000000ff00000ULL,
+    0x000000001ff00000ULL, 0x000000003ff00000ULL, 0x000000007ff00000ULL, 0x00000000fff00000ULL,
+    0x00000001fff00000ULL, 0x00000003fff00000ULL, 0x00000007fff00000ULL, 0x0000000ffff00000ULL,
+    0x0000001ffff00000ULL, 0x0000003ffff00000ULL, 0x0000007ffff00000ULL, 0x000000fffff00000ULL,
+    0x000001fffff00000ULL, 0x000003fffff00000ULL, 0x000007fffff00000ULL, 0x00000ffffff00000ULL,
+    0x00001ffffff00000ULL, 0x00003ffffff00000ULL, 0x00007ffffff00000ULL, 0x0000fffffff00000ULL,
+    0x0001fffffff00000ULL, 0x0003fffffff00000ULL, 0x0007fffffff00000ULL, 0x000ffffffff00000ULL,
+    0x001ffffffff00000ULL, 0x003ffffffff00000ULL, 0x007ffffffff00000ULL, 0x00fffffffff00000ULL,
+    0x01fffffffff00000ULL, 0x03fffffffff00000ULL, 0x07fffffffff00000ULL, 0x0ffffffffff00000ULL,
+    0x1ffffffffff00000ULL, 0x3ffffffffff00000ULL, 0x7ffffffffff00000ULL, 0xfffffffffff00000ULL,
+    0xfffffffffff00001ULL, 0xfffffffffff00003ULL, 0xfffffffffff00007ULL, 0xfffffffffff0000fULL,
+    0xfffffffffff0001fULL, 0xfffffffffff0003fULL, 0xfffffffffff0007fULL, 0xfffffffffff000ffULL,
+    0xfffffffffff001ffULL, 0xfffffffffff003ffULL, 0xfffffffffff007ffULL, 0xfffffffffff00fffULL,
+    0xfffffffffff01fffULL, 0xfffffffffff03fffULL, 0xfffffffffff07fffULL, 0xfffffffffff0ffffULL,
+    0xfffffffffff1ffffULL, 0xfffffffffff3ffffULL, 0xfffffffffff7ffffULL, 0x0000000000000000ULL,
+    0x0000000000080000ULL, 0x0000000000180000ULL, 0x0000000000380000ULL, 0x0000000000780000ULL,
+    0x0000000000f80000ULL, 0x0000000001f80000ULL, 0x0000000003f80000ULL, 0x0000000007f80000ULL,
+    0x000000000ff80000ULL, 0x000000001ff80000ULL, 0x000000003ff80000ULL, 0x000000007ff80000ULL,
+    0x00000000fff80000ULL, 0x00000001fff80000ULL, 0x00000003fff80000ULL, 0x00000007fff80000ULL,
+    0x0000000ffff80000ULL, 0x0000001ffff80000ULL, 0x0000003ffff80000ULL, 0x0000007ffff80000ULL,
+    0x000000fffff80000ULL, 0x000001fffff80000ULL, 0x000003fffff80000ULL, 0x000007fffff80000ULL,
+    0x00000ffffff80000ULL, 0x00001ffffff80000ULL, 0x00003ffffff80000ULL, 0x00007ffffff80000ULL,
+    0x0000fffffff80000ULL, 0x0001fffffff80000ULL, 0x0003fffffff80000ULL, 0x0007fffffff80000ULL,
+    0x000ffffffff80000ULL, 0x001ffffffff80000ULL, 0x003ffffffff80000ULL, 0x007ffffffff80000ULL,
+    0x00fffffffff80000ULL, 0x01fffffffff80000ULL, 0x03fffffffff80000ULL, 0x07fffffffff80000ULL,
+    0x0ffffffffff80000ULL, 0x1ffffffffff80000ULL, 0x3ffffffffff80000ULL, 0x7ffffffffff80000ULL,
+    0xfffffffffff80000ULL, 0xfffffffffff80001ULL, 0xfffffffffff80003ULL, 0xfffffffffff80007ULL,
+    0xfffffffffff8000fULL, 0xfffffffffff8001fULL, 0xfffffffffff8003fULL, 0xfffffffffff8007fULL,
+    0xfffffffffff800ffULL, 0xfffffffffff801ffULL, 0xfffffffffff803ffULL, 0xfffffffffff807ffULL,
+    0xfffffffffff80fffULL, 0xfffffffffff81fffULL, 0xfffffffffff83fffULL, 0xfffffffffff87fffULL,
+    0xfffffffffff8ffffULL, 0xfffffffffff9ffffULL, 0xfffffffffffbffffULL, 0x0000000000000000ULL,
+    0x0000000000040000ULL, 0x00000000000c0000ULL, 0x00000000001c0000ULL, 0x00000000003c0000ULL,
+    0x00000000007c0000ULL, 0x0000000000fc0000ULL, 0x0000000001fc0000ULL, 0x0000000003fc0000ULL,
+    0x0000000007fc0000ULL, 0x000000000ffc0000ULL, 0x000000001ffc0000ULL, 0x000000003ffc0000ULL,
+    0x000000007ffc0000ULL, 0x00000000fffc0000ULL, 0x00000001fffc0000ULL, 0x00000003fffc0000ULL,
+    0x00000007fffc0000ULL, 0x0000000ffffc0000ULL, 0x0000001ffffc0000ULL, 0x0000003ffffc0000ULL,
+    0x0000007ffffc0000ULL, 0x000000fffffc0000ULL, 0x000001fffffc0000ULL, 0x000003fffffc0000ULL,
+    0x000007fffffc0000ULL, 0x00000ffffffc0000ULL, 0x00001ffffffc0000ULL, 0x00003ffffffc0000ULL,
+    0x00007ffffffc0000ULL, 0x0000fffffffc0000ULL, 0x0001fffffffc0000ULL, 0x0003fffffffc0000ULL,
+    0x0007fffffffc0000ULL, 0x000ffffffffc0000ULL, 0x001ffffffffc0000ULL, 0x003ffffffffc0000ULL,
+    0x007ffffffffc0000ULL, 0x00fffffffffc0000ULL, 0x01fffffffffc0000ULL, 0x03fffffffffc0000ULL,
+    0x07fffffffffc0000ULL, 0x0ffffffffffc0000ULL, 0x1ffffffffffc0000ULL, 0x3ffffffffffc0000ULL,
+    0x7ffffffffffc0000ULL, 0xfffffffffffc0000ULL, 0xfffffffffffc0001ULL, 0xfffffffffffc0003ULL,
+    0xfffffffffffc0007ULL, 0xfffffffffffc000fULL, 0xfffffffffffc001fULL, 0xfffffffffffc003fULL,
+    0xfffffffffffc007fULL, 0xfffffffffffc00ffULL, 0xfffffffffffc01ffULL, 0xfffffffffffc03ffULL,
+    0xfffffffffffc07ffULL, 0xfffffffffffc0fffULL, 0xfffffffffffc1fffULL, 0xfffffffffffc3fffULL,
+    0xfffffffffffc7fffULL, 0xfffffffffffcffffULL, 0xfffffffffffdffffULL, 0x0000000000000000ULL,
+    0x0000000000020000ULL, 0x0000000000060000ULL, 0x00000000000e0000ULL, 0x00000000001e0000ULL,
+    0x00000000003e0000ULL, 0x00000000007e0000ULL, 0x0000000000fe0000ULL, 0x0000000001fe0000ULL,
+    0x0000000003fe0000ULL, 0x0000000007fe0000ULL, 0x000000000ffe0000ULL, 0x000000001ffe0000ULL,
+    0x000000003ffe0000ULL, 0x000000007ffe0000ULL, 0x00000000fffe0000ULL, 0x00000001fffe0000ULL,
+    0x00000003fffe0000ULL, 0x00000007fffe0000ULL, 0x0000000ffffe0000ULL, 0x0000001ffffe0000ULL,
+    0x0000003ffffe0000ULL, 0x0000007ffffe0000ULL, 0x000000fffffe0000ULL, 0x000001fffffe0000ULL,
+    0x000003fffffe0000ULL, 0x000007fffffe0000ULL, 0x00000ffffffe0000ULL, 0x00001ffffffe0000ULL,
+    0x00003ffffffe0000ULL, 0x00007ffffffe0000ULL, 0x0000fffffffe0000ULL, 0x0001fffffffe0000ULL,
+    0x0003fffffffe0000ULL, 0x0007fffffffe0000ULL, 0x000ffffffffe0000ULL, 0x001ffffffffe0000ULL,
+    0x003ffffffffe0000ULL, 0x007ffffffffe0000ULL, 0x00fffffffffe0000ULL, 0x01fffffffffe0000ULL,
+    0x03fffffffffe0000ULL, 0x07fffffffffe0000ULL, 0x0ffffffffffe0000ULL, 0x1ffffffffffe0000ULL,
+    0x3ffffffffffe0000ULL, 0x7ffffffffffe0000ULL, 0xfffffffffffe0000ULL, 0xfffffffffffe0001ULL,
+    0xfffffffffffe0003ULL, 0xfffffffffffe0007ULL, 0xfffffffffffe000fULL, 0xfffffffffffe001fULL,
+    0xfffffffffffe003fULL, 0xfffffffffffe007fULL, 0xfffffffffffe00ffULL, 0xfffffffffffe01ffULL,
+    0xfffffffffffe03ffULL, 0xfffffffffffe07ffULL, 0xfffffffffffe0fffULL, 0xfffffffffffe1fffULL,
+    0xfffffffffffe3fffULL, 0xfffffffffffe7fffULL, 0xfffffffffffeffffULL, 0x0000000000000000ULL,
+    0x0000000000010000ULL, 0x0000000000030000ULL, 0x0000000000070000ULL, 0x00000000000f0000ULL,
+    0x00000000001f0000ULL, 0x00000000003f0000ULL, 0x00000000007f0000ULL, 0x0000000000ff0000ULL,
+    0x0000000001ff0000ULL, 0x0000000003ff0000ULL, 0x0000000007ff0000ULL, 0x000000000fff0000ULL,
+    0x000000001fff0000ULL, 0x000000003fff0000ULL, 0x000000007fff0000ULL, 0x00000000ffff0000ULL,
+    0x00000001ffff0000ULL, 0x00000003ffff0000ULL, 0x00000007ffff0000ULL, 0x0000000fffff0000ULL,
+    0x0000001fffff0000ULL, 0x0000003fffff0000ULL, 0x0000007fffff0000ULL, 0x000000ffffff0000ULL,
+    0x000001ffffff0000ULL, 0x000003ffffff0000ULL, 0x000007ffffff0000ULL, 0x00000fffffff0000ULL,
+    0x00001fffffff0000ULL, 0x00003fffffff0000ULL, 0x00007fffffff0000ULL, 0x0000ffffffff0000ULL,
+    0x0001ffffffff0000ULL, 0x0003ffffffff0000ULL, 0x0007ffffffff0000ULL, 0x000fffffffff0000ULL,
+    0x001fffffffff0000ULL, 0x003fffffffff0000ULL, 0x007fffffffff0000ULL, 0x00ffffffffff0000ULL,
+    0x01ffffffffff0000ULL, 0x03ffffffffff0000ULL, 0x07ffffffffff0000ULL, 0x0fffffffffff0000ULL,
+    0x1fffffffffff0000ULL, 0x3fffffffffff0000ULL, 0x7fffffffffff0000ULL, 0xffffffffffff0000ULL,
+    0xffffffffffff0001ULL, 0xffffffffffff0003ULL, 0xffffffffffff0007ULL, 0xffffffffffff000fULL,
+    0xffffffffffff001fULL, 0xffffffffffff003fULL, 0xffffffffffff007fULL, 0xffffffffffff00ffULL,
+    0xffffffffffff01ffULL, 0xffffffffffff03ffULL, 0xffffffffffff07ffULL, 0xffffffffffff0fffULL,
+    0xffffffffffff1fffULL, 0xffffffffffff3fffULL, 0xffffffffffff7fffULL, 0x0000000000000000ULL,
+    0x0000000000008000ULL, 0x0000000000018000ULL, 0x0000000000038000ULL, 0x0000000000078000ULL,
+    0x00000000000f8000ULL, 0x00000000001f8000ULL, 0x00000000003f8000ULL, 0x00000000007f8000ULL,
+    0x0000000000ff8000ULL, 0x0000000001ff8000ULL, 0x0000000003ff8000ULL, 0x0000000007ff8000ULL,
+    0x000000000fff8000ULL, 0x000000001fff8000ULL, 0x000000003fff8000ULL, 0x000000007fff8000ULL,
+    0x00000000ffff8000ULL, 0x00000001ffff8000ULL, 0x00000003ffff8000ULL, 0x00000007ffff8000ULL,
+    0x0000000fffff8000ULL, 0x0000001fffff8000ULL, 0x0000003fffff8000ULL, 0x0000007fffff8000ULL,
+    0x000000ffffff8000ULL, 0x000001ffffff8000ULL, 0x000003ffffff8000ULL, 0x000007ffffff8000ULL,
+    0x00000fffffff8000ULL, 0x00001fffffff8000ULL, 0x00003fffffff8000ULL, 0x00007fffffff8000ULL,
+    0x0000ffffffff8000ULL, 0x0001ffffffff8000ULL, 0x0003ffffffff8000ULL, 0x0007ffffffff8000ULL,
+    0x000fffffffff8000ULL, 0x001fffffffff8000ULL, 0x003fffffffff8000ULL, 0x007fffffffff8000ULL,
+    0x00ffffffffff8000ULL, 0x01ffffffffff8000ULL, 0x03ffffffffff8000ULL, 0x07ffffffffff8000ULL,
+    0x0fffffffffff8000ULL, 0x1fffffffffff8000ULL, 0x3fffffffffff8000ULL, 0x7fffffffffff8000ULL,
+    0xffffffffffff8000ULL, 0xffffffffffff8001ULL, 0xffffffffffff8003ULL, 0xffffffffffff8007ULL,
+    0xffffffffffff800fULL, 0xffffffffffff801fULL, 0xffffffffffff803fULL, 0xffffffffffff807fULL,
+    0xffffffffffff80ffULL, 0xffffffffffff81ffULL, 0xffffffffffff83ffULL, 0xffffffffffff87ffULL,
+    0xffffffffffff8fffULL, 0xffffffffffff9fffULL, 0xffffffffffffbfffULL, 0x0000000000000000ULL,
+    0x0000000000004000ULL, 0x000000000000c000ULL, 0x000000000001c000ULL, 0x000000000003c000ULL,
+    0x000000000007c000ULL, 0x00000000000fc000ULL, 0x00000000001fc000ULL, 0x00000000003fc000ULL,
+    0x00000000007fc000ULL, 0x0000000000ffc000ULL, 0x0000000001ffc000ULL, 0x0000000003ffc000ULL,
+    0x0000000007ffc000ULL, 0x000000000fffc000ULL, 0x000000001fffc000ULL, 0x000000003fffc000ULL,
+    0x000000007fffc000ULL, 0x00000000ffffc000ULL, 0x00000001ffffc000ULL, 0x00000003ffffc000ULL,
+    0x00000007ffffc000ULL, 0x0000000fffffc000ULL, 0x0000001fffffc000ULL, 0x0000003fffffc000ULL,
+    0x0000007fffffc000ULL, 0x000000ffffffc000ULL, 0x000001ffffffc000ULL, 0x000003ffffffc000ULL,
+    0x000007ffffffc000ULL, 0x00000fffffffc000ULL, 0x00001fffffffc000ULL, 0x00003fffffffc000ULL,
+    0x00007fffffffc000ULL, 0x0000ffffffffc000ULL, 0x0001ffffffffc000ULL, 0x0003ffffffffc000ULL,
+    0x0007ffffffffc000ULL, 0x000fffffffffc000ULL, 0x001fffffffffc000ULL, 0x003fffffffffc000ULL,
+    0x007fffffffffc000ULL, 0x00ffffffffffc000ULL, 0x01ffffffffffc000ULL, 0x03ffffffffffc000ULL,
+    0x07ffffffffffc000ULL, 0x0fffffffffffc000ULL, 0x1fffffffffffc000ULL, 0x3fffffffffffc000ULL,
+    0x7fffffffffffc000ULL, 0xffffffffffffc000ULL, 0xffffffffffffc001ULL, 0xffffffffffffc003ULL,
+    0xffffffffffffc007ULL, 0xffffffffffffc00fULL, 0xffffffffffffc01fULL, 0xffffffffffffc03fULL,
+    0xffffffffffffc07fULL, 0xffffffffffffc0ffULL, 0xffffffffffffc1ffULL, 0xffffffffffffc3ffULL,
+    0xffffffffffffc7ffULL, 0xffffffffffffcfffULL, 0xffffffffffffdfffULL, 0x0000000000000000ULL,
+    0x0000000000002000ULL, 0x0000000000006000ULL, 0x000000000000e000ULL, 0x000000000001e000ULL,
+    0x000000000003e000ULL, 0x000000000007e000ULL, 0x00000000000fe000ULL, 0x00000000001fe000ULL,
+    0x00000000003fe000ULL, 0x00000000007fe000ULL, 0x0000000000ffe000ULL, 0x0000000001ffe000ULL,
+    0x0000000003ffe000ULL, 0x0000000007ffe000ULL, 0x000000000fffe000ULL, 0x000000001fffe000ULL,
+    0x000000003fffe000ULL, 0x000000007fffe000ULL, 0x00000000ffffe000ULL, 0x00000001ffffe000ULL,
+    0x00000003ffffe000ULL, 0x00000007ffffe000ULL, 0x0000000fffffe000ULL, 0x0000001fffffe000ULL,
+    0x0000003fffffe000ULL, 0x0000007fffffe000ULL, 0x000000ffffffe000ULL, 0x000001ffffffe000ULL,
+    0x000003ffffffe000ULL, 0x000007ffffffe000ULL, 0x00000fffffffe000ULL, 0x00001fffffffe000ULL,
+    0x00003fffffffe000ULL, 0x00007fffffffe000ULL, 0x0000ffffffffe000ULL, 0x0001ffffffffe000ULL,
+    0x0003ffffffffe000ULL, 0x0007ffffffffe000ULL, 0x000fffffffffe000ULL, 0x001fffffffffe000ULL,
+    0x003fffffffffe000ULL, 0x007fffffffffe000ULL, 0x00ffffffffffe000ULL, 0x01ffffffffffe000ULL,
+    0x03ffffffffffe000ULL, 0x07ffffffffffe000ULL, 0x0fffffffffffe000ULL, 0x1fffffffffffe000ULL,
+    0x3fffffffffffe000ULL, 0x7fffffffffffe000ULL, 0xffffffffffffe000ULL, 0xffffffffffffe001ULL,
+    0xffffffffffffe003ULL, 0xffffffffffffe007ULL, 0xffffffffffffe00fULL, 0xffffffffffffe01fULL,
+    0xffffffffffffe03fULL, 0xffffffffffffe07fULL, 0xffffffffffffe0ffULL, 0xffffffffffffe1ffULL,
+    0xffffffffffffe3ffULL, 0xffffffffffffe7ffULL, 0xffffffffffffefffULL, 0x0000000000000000ULL,
+    0x0000000000001000ULL, 0x0000000000003000ULL, 0x0000000000007000ULL, 0x000000000000f000ULL,
+    0x000000000001f000ULL, 0x000000000003f000ULL, 0x000000000007f000ULL, 0x00000000000ff000ULL,
+    0x00000000001ff000ULL, 0x00000000003ff000ULL, 0x00000000007ff000ULL, 0x0000000000fff000ULL,
+    0x0000000001fff000ULL, 0x0000000003fff000ULL, 0x0000000007fff000ULL, 0x000000000ffff000ULL,
+    0x000000001ffff000ULL, 0x000000003ffff000ULL, 0x000000007ffff000ULL, 0x00000000fffff000ULL,
+    0x00000001fffff000ULL, 0x00000003fffff000ULL, 0x00000007fffff000ULL, 0x0000000ffffff000ULL,
+    0x0000001ffffff000ULL, 0x0000003ffffff000ULL, 0x0000007ffffff000ULL, 0x000000fffffff000ULL,
+    0x000001fffffff000ULL, 0x000003fffffff000ULL, 0x000007fffffff000ULL, 0x00000ffffffff000ULL,
+    0x00001ffffffff000ULL, 0x00003ffffffff000ULL, 0x00007ffffffff000ULL, 0x0000fffffffff000ULL,
+    0x0001fffffffff000ULL, 0x0003fffffffff000ULL, 0x0007fffffffff000ULL, 0x000ffffffffff000ULL,
+    0x001ffffffffff000ULL, 0x003ffffffffff000ULL, 0x007ffffffffff000ULL, 0x00fffffffffff000ULL,
+    0x01fffffffffff000ULL, 0x03fffffffffff000ULL, 0x07fffffffffff000ULL, 0x0ffffffffffff000ULL,
+    0x1ffffffffffff000ULL, 0x3ffffffffffff000ULL, 0x7ffffffffffff000ULL, 0xfffffffffffff000ULL,
+    0xfffffffffffff001ULL, 0xfffffffffffff003ULL, 0xfffffffffffff007ULL, 0xfffffffffffff00fULL,
+    0xfffffffffffff01fULL, 0xfffffffffffff03fULL, 0xfffffffffffff07fULL, 0xfffffffffffff0ffULL,
+    0xfffffffffffff1ffULL, 0xfffffffffffff3ffULL, 0xfffffffffffff7ffULL, 0x0000000000000000ULL,
+    0x0000000000000800ULL, 0x0000000000001800ULL, 0x0000000000003800ULL, 0x0000000000007800ULL,
+    0x000000000000f800ULL, 0x000000000001f800ULL, 0x000000000003f800ULL, 0x000000000007f800ULL,
+    0x00000000000ff800ULL, 0x00000000001ff800ULL, 0x00000000003ff800ULL, 0x00000000007ff800ULL,
+    0x0000000000fff800ULL, 0x0000000001fff800ULL, 0x0000000003fff800ULL, 0x0000000007fff800ULL,
+    0x000000000ffff800ULL, 0x000000001ffff800ULL, 0x000000003ffff800ULL, 0x000000007ffff800ULL,
+    0x00000000fffff800ULL, 0x00000001fffff800ULL, 0x00000003fffff800ULL, 0x00000007fffff800ULL,
+    0x0000000ffffff800ULL, 0x0000001ffffff800ULL, 0x0000003ffffff800ULL, 0x0000007ffffff800ULL,
+    0x000000fffffff800ULL, 0x000001fffffff800ULL, 0x000003fffffff800ULL, 0x000007fffffff800ULL,
+    0x00000ffffffff800ULL, 0x00001ffffffff800ULL, 0x00003ffffffff800ULL, 0x00007ffffffff800ULL,
+    0x0000fffffffff800ULL, 0x0001fffffffff800ULL, 0x0003fffffffff800ULL, 0x0007fffffffff800ULL,
+    0x000ffffffffff800ULL, 0x001ffffffffff800ULL, 0x003ffffffffff800ULL, 0x007ffffffffff800ULL,
+    0x00fffffffffff800ULL, 0x01fffffffffff800ULL, 0x03fffffffffff800ULL, 0x07fffffffffff800ULL,
+    0x0ffffffffffff800ULL, 0x1ffffffffffff800ULL, 0x3ffffffffffff800ULL, 0x7ffffffffffff800ULL,
+    0xfffffffffffff800ULL, 0xfffffffffffff801ULL, 0xfffffffffffff803ULL, 0xfffffffffffff807ULL,
+    0xfffffffffffff80fULL, 0xfffffffffffff81fULL, 0xfffffffffffff83fULL, 0xfffffffffffff87fULL,
+    0xfffffffffffff8ffULL, 0xfffffffffffff9ffULL, 0xfffffffffffffbffULL, 0x0000000000000000ULL,
+    0x0000000000000400ULL, 0x0000000000000c00ULL, 0x0000000000001c00ULL, 0x0000000000003c00ULL,
+    0x0000000000007c00ULL, 0x000000000000fc00ULL, 0x000000000001fc00ULL, 0x000000000003fc00ULL,
+    0x000000000007fc00ULL, 0x00000000000ffc00ULL, 0x00000000001ffc00ULL, 0x00000000003ffc00ULL,
+    0x00000000007ffc00ULL, 0x0000000000fffc00ULL, 0x0000000001fffc00ULL, 0x0000000003fffc00ULL,
+    0x0000000007fffc00ULL, 0x000000000ffffc00ULL, 0x000000001ffffc00ULL, 0x000000003ffffc00ULL,
+    0x000000007ffffc00ULL, 0x00000000fffffc00ULL, 0x00000001fffffc00ULL, 0x00000003fffffc00ULL,
+    0x00000007fffffc00ULL, 0x0000000ffffffc00ULL, 0x0000001ffffffc00ULL, 0x0000003ffffffc00ULL,
+    0x0000007ffffffc00ULL, 0x000000fffffffc00ULL, 0x000001fffffffc00ULL, 0x000003fffffffc00ULL,
+    0x000007fffffffc00ULL, 0x00000ffffffffc00ULL, 0x00001ffffffffc00ULL, 0x00003ffffffffc00ULL,
+    0x00007ffffffffc00ULL, 0x0000fffffffffc00ULL, 0x0001fffffffffc00ULL, 0x0003fffffffffc00ULL,
+    0x0007fffffffffc00ULL, 0x000ffffffffffc00ULL, 0x001ffffffffffc00ULL, 0x003ffffffffffc00ULL,
+    0x007ffffffffffc00ULL, 0x00fffffffffffc00ULL, 0x01fffffffffffc00ULL, 0x03fffffffffffc00ULL,
+    0x07fffffffffffc00ULL, 0x0ffffffffffffc00ULL, 0x1ffffffffffffc00ULL, 0x3ffffffffffffc00ULL,
+    0x7ffffffffffffc00ULL, 0xfffffffffffffc00ULL, 0xfffffffffffffc01ULL, 0xfffffffffffffc03ULL,
+    0xfffffffffffffc07ULL, 0xfffffffffffffc0fULL, 0xfffffffffffffc1fULL, 0xfffffffffffffc3fULL,
+    0xfffffffffffffc7fULL, 0xfffffffffffffcffULL, 0xfffffffffffffdffULL, 0x0000000000000000ULL,
+    0x0000000000000200ULL, 0x0000000000000600ULL, 0x0000000000000e00ULL, 0x0000000000001e00ULL,
+    0x0000000000003e00ULL, 0x0000000000007e00ULL, 0x000000000000fe00ULL, 0x000000000001fe00ULL,
+    0x000000000003fe00ULL, 0x000000000007fe00ULL, 0x00000000000ffe00ULL, 0x00000000001ffe00ULL,
+    0x00000000003ffe00ULL, 0x00000000007ffe00ULL, 0x0000000000fffe00ULL, 0x0000000001fffe00ULL,
+    0x0000000003fffe00ULL, 0x0000000007fffe00ULL, 0x000000000ffffe00ULL, 0x000000001ffffe00ULL,
+    0x000000003ffffe00ULL, 0x000000007ffffe00ULL, 0x00000000fffffe00ULL, 0x00000001fffffe00ULL,
+    0x00000003fffffe00ULL, 0x00000007fffffe00ULL, 0x0000000ffffffe00ULL, 0x0000001ffffffe00ULL,
+    0x0000003ffffffe00ULL, 0x0000007ffffffe00ULL, 0x000000fffffffe00ULL, 0x000001fffffffe00ULL,
+    0x000003fffffffe00ULL, 0x000007fffffffe00ULL, 0x00000ffffffffe00ULL, 0x00001ffffffffe00ULL,
+    0x00003ffffffffe00ULL, 0x00007ffffffffe00ULL, 0x0000fffffffffe00ULL, 0x0001fffffffffe00ULL,
+    0x0003fffffffffe00ULL, 0x0007fffffffffe00ULL, 0x000ffffffffffe00ULL, 0x001ffffffffffe00ULL,
+    0x003ffffffffffe00ULL, 0x007ffffffffffe00ULL, 0x00fffffffffffe00ULL, 0x01fffffffffffe00ULL,
+    0x03fffffffffffe00ULL, 0x07fffffffffffe00ULL, 0x0ffffffffffffe00ULL, 0x1ffffffffffffe00ULL,
+    0x3ffffffffffffe00ULL, 0x7ffffffffffffe00ULL, 0xfffffffffffffe00ULL, 0xfffffffffffffe01ULL,
+    0xfffffffffffffe03ULL, 0xfffffffffffffe07ULL, 0xfffffffffffffe0fULL, 0xfffffffffffffe1fULL,
+    0xfffffffffffffe3fULL, 0xfffffffffffffe7fULL, 0xfffffffffffffeffULL, 0x0000000000000000ULL,
+    0x0000000000000100ULL, 0x0000000000000300ULL, 0x0000000000000700ULL, 0x0000000000000f00ULL,
+    0x0000000000001f00ULL, 0x0000000000003f00ULL, 0x0000000000007f00ULL, 0x000000000000ff00ULL,
+    0x000000000001ff00ULL, 0x000000000003ff00ULL, 0x000000000007ff00ULL, 0x00000000000fff00ULL,
+    0x00000000001fff00ULL, 0x00000000003fff00ULL, 0x00000000007fff00ULL, 0x0000000000ffff00ULL,
+    0x0000000001ffff00ULL, 0x0000000003ffff00ULL, 0x0000000007ffff00ULL, 0x000000000fffff00ULL,
+    0x000000001fffff00ULL, 0x000000003fffff00ULL, 0x000000007fffff00ULL, 0x00000000ffffff00ULL,
+    0x00000001ffffff00ULL, 0x00000003ffffff00ULL, 0x00000007ffffff00ULL, 0x0000000fffffff00ULL,
+    0x0000001fffffff00ULL, 0x0000003fffffff00ULL, 0x0000007fffffff00ULL, 0x000000ffffffff00ULL,
+    0x000001ffffffff00ULL, 0x000003ffffffff00ULL, 0x000007ffffffff00ULL, 0x00000fffffffff00ULL,
+    0x00001fffffffff00ULL, 0x00003fffffffff00ULL, 0x00007fffffffff00ULL, 0x0000ffffffffff00ULL,
+    0x0001ffffffffff00ULL, 0x0003ffffffffff00ULL, 0x0007ffffffffff00ULL, 0x000fffffffffff00ULL,
+    0x001fffffffffff00ULL, 0x003fffffffffff00ULL, 0x007fffffffffff00ULL, 0x00ffffffffffff00ULL,
+    0x01ffffffffffff00ULL, 0x03ffffffffffff00ULL, 0x07ffffffffffff00ULL, 0x0fffffffffffff00ULL,
+    0x1fffffffffffff00ULL, 0x3fffffffffffff00ULL, 0x7fffffffffffff00ULL, 0xffffffffffffff00ULL,
+    0xffffffffffffff01ULL, 0xffffffffffffff03ULL, 0xffffffffffffff07ULL, 0xffffffffffffff0fULL,
+    0xffffffffffffff1fULL, 0xffffffffffffff3fULL, 0xffffffffffffff7fULL, 0x0000000000000000ULL,
+    0x0000000000000080ULL, 0x0000000000000180ULL, 0x0000000000000380ULL, 0x0000000000000780ULL,
+    0x0000000000000f80ULL, 0x0000000000001f80ULL, 0x0000000000003f80ULL, 0x0000000000007f80ULL,
+    0x000000000000ff80ULL, 0x000000000001ff80ULL, 0x000000000003ff80ULL, 0x000000000007ff80ULL,
+    0x00000000000fff80ULL, 0x00000000001fff80ULL, 0x00000000003fff80ULL, 0x00000000007fff80ULL,
+    0x0000000000ffff80ULL, 0x0000000001ffff80ULL, 0x0000000003ffff80ULL, 0x0000000007ffff80ULL,
+    0x000000000fffff80ULL, 0x000000001fffff80ULL, 0x000000003fffff80ULL, 0x000000007fffff80ULL,
+    0x00000000ffffff80ULL, 0x00000001ffffff80ULL, 0x00000003ffffff80ULL, 0x00000007ffffff80ULL,
+    0x0000000fffffff80ULL, 0x0000001fffffff80ULL, 0x0000003fffffff80ULL, 0x0000007fffffff80ULL,
+    0x000000ffffffff80ULL, 0x000001ffffffff80ULL, 0x000003ffffffff80ULL, 0x000007ffffffff80ULL,
+    0x00000fffffffff80ULL, 0x00001fffffffff80ULL, 0x00003fffffffff80ULL, 0x00007fffffffff80ULL,
+    0x0000ffffffffff80ULL, 0x0001ffffffffff80ULL, 0x0003ffffffffff80ULL, 0x0007ffffffffff80ULL,
+    0x000fffffffffff80ULL, 0x001fffffffffff80ULL, 0x003fffffffffff80ULL, 0x007fffffffffff80ULL,
+    0x00ffffffffffff80ULL, 0x01ffffffffffff80ULL, 0x03ffffffffffff80ULL, 0x07ffffffffffff80ULL,
+    0x0fffffffffffff80ULL, 0x1fffffffffffff80ULL, 0x3fffffffffffff80ULL, 0x7fffffffffffff80ULL,
+    0xffffffffffffff80ULL, 0xffffffffffffff81ULL, 0xffffffffffffff83ULL, 0xffffffffffffff87ULL,
+    0xffffffffffffff8fULL, 0xffffffffffffff9fULL, 0xffffffffffffffbfULL, 0x0000000000000000ULL,
+    0x0000000000000040ULL, 0x00000000000000c0ULL, 0x00000000000001c0ULL, 0x00000000000003c0ULL,
+    0x00000000000007c0ULL, 0x0000000000000fc0ULL, 0x0000000000001fc0ULL, 0x0000000000003fc0ULL,
+    0x0000000000007fc0ULL, 0x000000000000ffc0ULL, 0x000000000001ffc0ULL, 0x000000000003ffc0ULL,
+    0x000000000007ffc0ULL, 0x00000000000fffc0ULL, 0x00000000001fffc0ULL, 0x00000000003fffc0ULL,
+    0x00000000007fffc0ULL, 0x0000000000ffffc0ULL, 0x0000000001ffffc0ULL, 0x0000000003ffffc0ULL,
+    0x0000000007ffffc0ULL, 0x000000000fffffc0ULL, 0x000000001fffffc0ULL, 0x000000003fffffc0ULL,
+    0x000000007fffffc0ULL, 0x00000000ffffffc0ULL, 0x00000001ffffffc0ULL, 0x00000003ffffffc0ULL,
+    0x00000007ffffffc0ULL, 0x0000000fffffffc0ULL, 0x0000001fffffffc0ULL, 0x0000003fffffffc0ULL,
+    0x0000007fffffffc0ULL, 0x000000ffffffffc0ULL, 0x000001ffffffffc0ULL, 0x000003ffffffffc0ULL,
+    0x000007ffffffffc0ULL, 0x00000fffffffffc0ULL, 0x00001fffffffffc0ULL, 0x00003fffffffffc0ULL,
+    0x00007fffffffffc0ULL, 0x0000ffffffffffc0ULL, 0x0001ffffffffffc0ULL, 0x0003ffffffffffc0ULL,
+    0x0007ffffffffffc0ULL, 0x000fffffffffffc0ULL, 0x001fffffffffffc0ULL, 0x003fffffffffffc0ULL,
+    0x007fffffffffffc0ULL, 0x00ffffffffffffc0ULL, 0x01ffffffffffffc0ULL, 0x03ffffffffffffc0ULL,
+    0x07ffffffffffffc0ULL, 0x0fffffffffffffc0ULL, 0x1fffffffffffffc0ULL, 0x3fffffffffffffc0ULL,
+    0x7fffffffffffffc0ULL, 0xffffffffffffffc0ULL, 0xffffffffffffffc1ULL, 0xffffffffffffffc3ULL,
+    0xffffffffffffffc7ULL, 0xffffffffffffffcfULL, 0xffffffffffffffdfULL, 0x0000000000000000ULL,
+    0x0000000000000020ULL, 0x0000000000000060ULL, 0x00000000000000e0ULL, 0x00000000000001e0ULL,
+    0x00000000000003e0ULL, 0x00000000000007e0ULL, 0x0000000000000fe0ULL, 0x0000000000001fe0ULL,
+    0x0000000000003fe0ULL, 0x0000000000007fe0ULL, 0x000000000000ffe0ULL, 0x000000000001ffe0ULL,
+    0x000000000003ffe0ULL, 0x000000000007ffe0ULL, 0x00000000000fffe0ULL, 0x00000000001fffe0ULL,
+    0x00000000003fffe0ULL, 0x00000000007fffe0ULL, 0x0000000000ffffe0ULL, 0x0000000001ffffe0ULL,
+    0x0000000003ffffe0ULL, 0x0000000007ffffe0ULL, 0x000000000fffffe0ULL, 0x000000001fffffe0ULL,
+    0x000000003fffffe0ULL, 0x000000007fffffe0ULL, 0x00000000ffffffe0ULL, 0x00000001ffffffe0ULL,
+    0x00000003ffffffe0ULL, 0x00000007ffffffe0ULL, 0x0000000fffffffe0ULL, 0x0000001fffffffe0ULL,
+    0x0000003fffffffe0ULL, 0x0000007fffffffe0ULL, 0x000000ffffffffe0ULL, 0x000001ffffffffe0ULL,
+    0x000003ffffffffe0ULL, 0x000007ffffffffe0ULL, 0x00000fffffffffe0ULL, 0x00001fffffffffe0ULL,
+    0x00003fffffffffe0ULL, 0x00007fffffffffe0ULL, 0x0000ffffffffffe0ULL, 0x0001ffffffffffe0ULL,
+    0x0003ffffffffffe0ULL, 0x0007ffffffffffe0ULL, 0x000fffffffffffe0ULL, 0x001fffffffffffe0ULL,
+    0x003fffffffffffe0ULL, 0x007fffffffffffe0ULL, 0x00ffffffffffffe0ULL, 0x01ffffffffffffe0ULL,
+    0x03ffffffffffffe0ULL, 0x07ffffffffffffe0ULL, 0x0fffffffffffffe0ULL, 0x1fffffffffffffe0ULL,
+    0x3fffffffffffffe0ULL, 0x7fffffffffffffe0ULL, 0xffffffffffffffe0ULL, 0xffffffffffffffe1ULL,
+    0xffffffffffffffe3ULL, 0xffffffffffffffe7ULL, 0xffffffffffffffefULL, 0x0000000000000000ULL,
+    0x0000000000000010ULL, 0x0000000000000030ULL, 0x0000000000000070ULL, 0x00000000000000f0ULL,
+    0x00000000000001f0ULL, 0x00000000000003f0ULL, 0x00000000000007f0ULL, 0x0000000000000ff0ULL,
+    0x0000000000001ff0ULL, 0x0000000000003ff0ULL, 0x0000000000007ff0ULL, 0x000000000000fff0ULL,
+    0x000000000001fff0ULL, 0x000000000003fff0ULL, 0x000000000007fff0ULL, 0x00000000000ffff0ULL,
+    0x00000000001ffff0ULL, 0x00000000003ffff0ULL, 0x00000000007ffff0ULL, 0x0000000000fffff0ULL,
+    0x0000000001fffff0ULL, 0x0000000003fffff0ULL, 0x0000000007fffff0ULL, 0x000000000ffffff0ULL,
+    0x000000001ffffff0ULL, 0x000000003ffffff0ULL, 0x000000007ffffff0ULL, 0x00000000fffffff0ULL,
+    0x00000001fffffff0ULL, 0x00000003fffffff0ULL, 0x00000007fffffff0ULL, 0x0000000ffffffff0ULL,
+    0x0000001ffffffff0ULL, 0x0000003ffffffff0ULL, 0x0000007ffffffff0ULL, 0x000000fffffffff0ULL,
+    0x000001fffffffff0ULL, 0x000003fffffffff0ULL, 0x000007fffffffff0ULL, 0x00000ffffffffff0ULL,
+    0x00001ffffffffff0ULL, 0x00003ffffffffff0ULL, 0x00007ffffffffff0ULL, 0x0000fffffffffff0ULL,
+    0x0001fffffffffff0ULL, 0x0003fffffffffff0ULL, 0x0007fffffffffff0ULL, 0x000ffffffffffff0ULL,
+    0x001ffffffffffff0ULL, 0x003ffffffffffff0ULL, 0x007ffffffffffff0ULL, 0x00fffffffffffff0ULL,
+    0x01fffffffffffff0ULL, 0x03fffffffffffff0ULL, 0x07fffffffffffff0ULL, 0x0ffffffffffffff0ULL,
+    0x1ffffffffffffff0ULL, 0x3ffffffffffffff0ULL, 0x7ffffffffffffff0ULL, 0xfffffffffffffff0ULL,
+    0xfffffffffffffff1ULL, 0xfffffffffffffff3ULL, 0xfffffffffffffff7ULL, 0x0000000000000000ULL,
+    0x0000000000000008ULL, 0x0000000000000018ULL, 0x0000000000000038ULL, 0x0000000000000078ULL,
+    0x00000000000000f8ULL, 0x00000000000001f8ULL, 0x00000000000003f8ULL, 0x00000000000007f8ULL,
+    0x0000000000000ff8ULL, 0x0000000000001ff8ULL, 0x0000000000003ff8ULL, 0x0000000000007ff8ULL,
+    0x000000000000fff8ULL, 0x000000000001fff8ULL, 0x000000000003fff8ULL, 0x000000000007fff8ULL,
+    0x00000000000ffff8ULL, 0x00000000001ffff8ULL, 0x00000000003ffff8ULL, 0x00000000007ffff8ULL,
+    0x0000000000fffff8ULL, 0x0000000001fffff8ULL, 0x0000000003fffff8ULL, 0x0000000007fffff8ULL,
+    0x000000000ffffff8ULL, 0x000000001ffffff8ULL, 0x000000003ffffff8ULL, 0x000000007ffffff8ULL,
+    0x00000000fffffff8ULL, 0x00000001fffffff8ULL, 0x00000003fffffff8ULL, 0x00000007fffffff8ULL,
+    0x0000000ffffffff8ULL, 0x0000001ffffffff8ULL, 0x0000003ffffffff8ULL, 0x0000007ffffffff8ULL,
+    0x000000fffffffff8ULL, 0x000001fffffffff8ULL, 0x000003fffffffff8ULL, 0x000007fffffffff8ULL,
+    0x00000ffffffffff8ULL, 0x00001ffffffffff8ULL, 0x00003ffffffffff8ULL, 0x00007ffffffffff8ULL,
+    0x0000fffffffffff8ULL, 0x0001fffffffffff8ULL, 0x0003fffffffffff8ULL, 0x0007fffffffffff8ULL,
+    0x000ffffffffffff8ULL, 0x001ffffffffffff8ULL, 0x003ffffffffffff8ULL, 0x007ffffffffffff8ULL,
+    0x00fffffffffffff8ULL, 0x01fffffffffffff8ULL, 0x03fffffffffffff8ULL, 0x07fffffffffffff8ULL,
+    0x0ffffffffffffff8ULL, 0x1ffffffffffffff8ULL, 0x3ffffffffffffff8ULL, 0x7ffffffffffffff8ULL,
+    0xfffffffffffffff8ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffffbULL, 0x0000000000000000ULL,
+    0x0000000000000004ULL, 0x000000000000000cULL, 0x000000000000001cULL, 0x000000000000003cULL,
+    0x000000000000007cULL, 0x00000000000000fcULL, 0x00000000000001fcULL, 0x00000000000003fcULL,
+    0x00000000000007fcULL, 0x0000000000000ffcULL, 0x0000000000001ffcULL, 0x0000000000003ffcULL,
+    0x0000000000007ffcULL, 0x000000000000fffcULL, 0x000000000001fffcULL, 0x000000000003fffcULL,
+    0x000000000007fffcULL, 0x00000000000ffffcULL, 0x00000000001ffffcULL, 0x00000000003ffffcULL,
+    0x00000000007ffffcULL, 0x0000000000fffffcULL, 0x0000000001fffffcULL, 0x0000000003fffffcULL,
+    0x0000000007fffffcULL, 0x000000000ffffffcULL, 0x000000001ffffffcULL, 0x000000003ffffffcULL,
+    0x000000007ffffffcULL, 0x00000000fffffffcULL, 0x00000001fffffffcULL, 0x00000003fffffffcULL,
+    0x00000007fffffffcULL, 0x0000000ffffffffcULL, 0x0000001ffffffffcULL, 0x0000003ffffffffcULL,
+    0x0000007ffffffffcULL, 0x000000fffffffffcULL, 0x000001fffffffffcULL, 0x000003fffffffffcULL,
+    0x000007fffffffffcULL, 0x00000ffffffffffcULL, 0x00001ffffffffffcULL, 0x00003ffffffffffcULL,
+    0x00007ffffffffffcULL, 0x0000fffffffffffcULL, 0x0001fffffffffffcULL, 0x0003fffffffffffcULL,
+    0x0007fffffffffffcULL, 0x000ffffffffffffcULL, 0x001ffffffffffffcULL, 0x003ffffffffffffcULL,
+    0x007ffffffffffffcULL, 0x00fffffffffffffcULL, 0x01fffffffffffffcULL, 0x03fffffffffffffcULL,
+    0x07fffffffffffffcULL, 0x0ffffffffffffffcULL, 0x1ffffffffffffffcULL, 0x3ffffffffffffffcULL,
+    0x7ffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffdULL, 0x0000000000000000ULL,
+    0x0000000000000002ULL, 0x0000000000000006ULL, 0x000000000000000eULL, 0x000000000000001eULL,
+    0x000000000000003eULL, 0x000000000000007eULL, 0x00000000000000feULL, 0x00000000000001feULL,
+    0x00000000000003feULL, 0x00000000000007feULL, 0x0000000000000ffeULL, 0x0000000000001ffeULL,
+    0x0000000000003ffeULL, 0x0000000000007ffeULL, 0x000000000000fffeULL, 0x000000000001fffeULL,
+    0x000000000003fffeULL, 0x000000000007fffeULL, 0x00000000000ffffeULL, 0x00000000001ffffeULL,
+    0x00000000003ffffeULL, 0x00000000007ffffeULL, 0x0000000000fffffeULL, 0x0000000001fffffeULL,
+    0x0000000003fffffeULL, 0x0000000007fffffeULL, 0x000000000ffffffeULL, 0x000000001ffffffeULL,
+    0x000000003ffffffeULL, 0x000000007ffffffeULL, 0x00000000fffffffeULL, 0x00000001fffffffeULL,
+    0x00000003fffffffeULL, 0x00000007fffffffeULL, 0x0000000ffffffffeULL, 0x0000001ffffffffeULL,
+    0x0000003ffffffffeULL, 0x0000007ffffffffeULL, 0x000000fffffffffeULL, 0x000001fffffffffeULL,
+    0x000003fffffffffeULL, 0x000007fffffffffeULL, 0x00000ffffffffffeULL, 0x00001ffffffffffeULL,
+    0x00003ffffffffffeULL, 0x00007ffffffffffeULL, 0x0000fffffffffffeULL, 0x0001fffffffffffeULL,
+    0x0003fffffffffffeULL, 0x0007fffffffffffeULL, 0x000ffffffffffffeULL, 0x001ffffffffffffeULL,
+    0x003ffffffffffffeULL, 0x007ffffffffffffeULL, 0x00fffffffffffffeULL, 0x01fffffffffffffeULL,
+    0x03fffffffffffffeULL, 0x07fffffffffffffeULL, 0x0ffffffffffffffeULL, 0x1ffffffffffffffeULL,
+    0x3ffffffffffffffeULL, 0x7ffffffffffffffeULL, 0xfffffffffffffffeULL, 0x0000000000000000ULL,
+};
+
+const uint64_t A64_LOGICAL_IMMEDIATES_LEN = sizeof (A64_LOGICAL_IMMEDIATES) / sizeof (*A64_LOGICAL_IMMEDIATES);
+
+const arm64_logical_immediate_t A64_LOGICAL_IMMEDIATE_ENCODINGS[] = {
+    { 0x0000000000000001ULL, 0x1000 }, { 0x0000000000000002ULL, 0x1fc0 },
+    { 0x0000000000000003ULL, 0x1001 }, { 0x0000000000000004ULL, 0x1f80 },
+    { 0x0000000000000006ULL, 0x1fc1 }, { 0x0000000000000007ULL, 0x1002 },
+    { 0x0000000000000008ULL, 0x1f40 }, { 0x000000000000000cULL, 0x1f81 },
+    { 0x000000000000000eULL, 0x1fc2 }, { 0x000000000000000fULL, 0x1003 },
+    { 0x0000000000000010ULL, 0x1f00 }, { 0x0000000000000018ULL, 0x1f41 },
+    { 0x000000000000001cULL, 0x1f82 }, { 0x000000000000001eULL, 0x1fc3 },
+    { 0x000000000000001fULL, 0x1004 }, { 0x0000000000000020ULL, 0x1ec0 },
+    { 0x0000000000000030ULL, 0x1f01 }, { 0x0000000000000038ULL, 0x1f42 },
+    { 0x000000000000003cULL, 0x1f83 }, { 0x000000000000003eULL, 0x1fc4 },
+    { 0x000000000000003fULL, 0x1005 }, { 0x0000000000000040ULL, 0x1e80 },
+    { 0x0000000000000060ULL, 0x1ec1 }, { 0x0000000000000070ULL, 0x1f02 },
+    { 0x0000000000000078ULL, 0x1f43 }, { 0x000000000000007cULL, 0x1f84 },
+    { 0x000000000000007eULL, 0x1fc5 }, { 0x000000000000007fULL, 0x1006 },
+    { 0x0000000000000080ULL, 0x1e40 }, { 0x00000000000000c0ULL, 0x1e81 },
+    { 0x00000000000000e0ULL, 0x1ec2 }, { 0x00000000000000f0ULL, 0x1f03 },
+    { 0x00000000000000f8ULL, 0x1f44 }, { 0x00000000000000fcULL, 0x1f85 },
+    { 0x00000000000000feULL, 0x1fc6 }, { 0x00000000000000ffULL, 0x1007 },
+    { 0x0000000000000100ULL, 0x1e00 }, { 0x0000000000000180ULL, 0x1e41 },
+    { 0x00000000000001c0ULL, 0x1e82 }, { 0x00000000000001e0ULL, 0x1ec3 },
+    { 0x00000000000001f0ULL, 0x1f04 }, { 0x00000000000001f8ULL, 0x1f45 },
+    { 0x00000000000001fcULL, 0x1f86 }, { 0x00000000000001feULL, 0x1fc7 },
+    { 0x00000000000001ffULL, 0x1008 }, { 0x0000000000000200ULL, 0x1dc0 },
+    { 0x0000000000000300ULL, 0x1e01 }, { 0x0000000000000380ULL, 0x1e42 },
+    { 0x00000000000003c0ULL, 0x1e83 }, { 0x00000000000003e0ULL, 0x1ec4 },
+    { 0x00000000000003f0ULL, 0x1f05 }, { 0x00000000000003f8ULL, 0x1f46 },
+    { 0x00000000000003fcULL, 0x1f87 }, { 0x00000000000003feULL, 0x1fc8 },
+    { 0x00000000000003ffULL, 0x1009 }, { 0x0000000000000400ULL, 0x1d80 },
+    { 0x0000000000000600ULL, 0x1dc1 }, { 0x0000000000000700ULL, 0x1e02 },
+    { 0x0000000000000780ULL, 0x1e43 }, { 0x00000000000007c0ULL, 0x1e84 },
+    { 0x00000000000007e0ULL, 0x1ec5 }, { 0x00000000000007f0ULL, 0x1f06 },
+    { 0x00000000000007f8ULL, 0x1f47 }, { 0x00000000000007fcULL, 0x1f88 },
+    { 0x00000000000007feULL, 0x1fc9 }, { 0x00000000000007ffULL, 0x100a },
+    { 0x0000000000000800ULL, 0x1d40 }, { 0x0000000000000c00ULL, 0x1d81 },
+    { 0x0000000000000e00ULL, 0x1dc2 }, { 0x0000000000000f00ULL, 0x1e03 },
+    { 0x0000000000000f80ULL, 0x1e44 }, { 0x0000000000000fc0ULL, 0x1e85 },
+    { 0x0000000000000fe0ULL, 0x1ec6 }, { 0x0000000000000ff0ULL, 0x1f07 },
+    { 0x0000000000000ff8ULL, 0x1f48 }, { 0x0000000000000ffcULL, 0x1f89 },
+    { 0x0000000000000ffeULL, 0x1fca }, { 0x0000000000000fffULL, 0x100b },
+    { 0x0000000000001000ULL, 0x1d00 }, { 0x0000000000001800ULL, 0x1d41 },
+    { 0x0000000000001c00ULL, 0x1d82 }, { 0x0000000000001e00ULL, 0x1dc3 },
+    { 0x0000000000001f00ULL, 0x1e04 }, { 0x0000000000001f80ULL, 0x1e45 },
+    { 0x0000000000001fc0ULL, 0x1e86 }, { 0x0000000000001fe0ULL, 0x1ec7 },
+    { 0x0000000000001ff0ULL, 0x1f08 }, { 0x0000000000001ff8ULL, 0x1f49 },
+    { 0x0000000000001ffcULL, 0x1f8a }, { 0x0000000000001ffeULL, 0x1fcb },
+    { 0x0000000000001fffULL, 0x100c }, { 0x0000000000002000ULL, 0x1cc0 },
+    { 0x0000000000003000ULL, 0x1d01 }, { 0x0000000000003800ULL, 0x1d42 },
+    { 0x0000000000003c00ULL, 0x1d83 }, { 0x0000000000003e00ULL, 0x1dc4 },
+    { 0x0000000000003f00ULL, 0x1e05 }, { 0x0000000000003f80ULL, 0x1e46 },
+    { 0x0000000000003fc0ULL, 0x1e87 }, { 0x0000000000003fe0ULL, 0x1ec8 },
+    { 0x0000000000003ff0ULL, 0x1f09 }, { 0x0000000000003ff8ULL, 0x1f4a },
+    { 0x0000000000003ffcULL, 0x1f8b }, { 0x0000000000003ffeULL, 0x1fcc },
+    { 0x0000000000003fffULL, 0x100d }, { 0x0000000000004000ULL, 0x1c80 },
+    { 0x0000000000006000ULL, 0x1cc1 }, { 0x0000000000007000ULL, 0x1d02 },
+    { 0x0000000000007800ULL, 0x1d43 }, { 0x0000000000007c00ULL, 0x1d84 },
+    { 0x0000000000007e00ULL, 0x1dc5 }, { 0x0000000000007f00ULL, 0x1e06 },
+    { 0x0000000000007f80ULL, 0x1e47 }, { 0x0000000000007fc0ULL, 0x1e88 },
+    { 0x0000000000007fe0ULL, 0x1ec9 }, { 0x0000000000007ff0ULL, 0x1f0a },
+    { 0x0000000000007ff8ULL, 0x1f4b }, { 0x0000000000007ffcULL, 0x1f8c },
+    { 0x0000000000007ffeULL, 0x1fcd }, { 0x0000000000007fffULL, 0x100e },
+    { 0x0000000000008000ULL, 0x1c40 }, { 0x000000000000c000ULL, 0x1c81 },
+    { 0x000000000000e000ULL, 0x1cc2 }, { 0x000000000000f000ULL, 0x1d03 },
+    { 0x000000000000f800ULL, 0x1d44 }, { 0x000000000000fc00ULL, 0x1d85 },
+    { 0x000000000000fe00ULL, 0x1dc6 }, { 0x000000000000ff00ULL, 0x1e07 },
+    { 0x000000000000ff80ULL, 0x1e48 }, { 0x000000000000ffc0ULL, 0x1e89 },
+    { 0x000000000000ffe0ULL, 0x1eca }, { 0x000000000000fff0ULL, 0x1f0b },
+    { 0x000000000000fff8ULL, 0x1f4c }, { 0x000000000000fffcULL, 0x1f8d },
+    { 0x000000000000fffeULL, 0x1fce }, { 0x000000000000ffffULL, 0x100f },
+    { 0x0000000000010000ULL, 0x1c00 }, { 0x0000000000018000ULL, 0x1c41 },
+    { 0x000000000001c000ULL, 0x1c82 }, { 0x000000000001e000ULL, 0x1cc3 },
+    { 0x000000000001f000ULL, 0x1d04 }, { 0x000000000001f800ULL, 0x1d45 },
+    { 0x000000000001fc00ULL, 0x1d86 }, { 0x000000000001fe00ULL, 0x1dc7 },
+    { 0x000000000001ff00ULL, 0x1e08 }, { 0x000000000001ff80ULL, 0x1e49 },
+    { 0x000000000001ffc0ULL, 0x1e8a }, { 0x000000000001ffe0ULL, 0x1ecb },
+    { 0x000000000001fff0ULL, 0x1f0c }, { 0x000000000001fff8ULL, 0x1f4d },
+    { 0x000000000001fffcULL, 0x1f8e }, { 0x000000000001fffeULL, 0x1fcf },
+    { 0x000000000001ffffULL, 0x1010 }, { 0x0000000000020000ULL, 0x1bc0 },
+    { 0x0000000000030000ULL, 0x1c01 }, { 0x0000000000038000ULL, 0x1c42 },
+    { 0x000000000003c000ULL, 0x1c83 }, { 0x000000000003e000ULL, 0x1cc4 },
+    { 0x000000000003f000ULL, 0x1d05 }, { 0x000000000003f800ULL, 0x1d46 },
+    { 0x000000000003fc00ULL, 0x1d87 }, { 0x000000000003fe00ULL, 0x1dc8 },
+    { 0x000000000003ff00ULL, 0x1e09 }, { 0x000000000003ff80ULL, 0x1e4a },
+    { 0x000000000003ffc0ULL, 0x1e8b }, { 0x000000000003ffe0ULL, 0x1ecc },
+    { 0x000000000003fff0ULL, 0x1f0d }, { 0x000000000003fff8ULL, 0x1f4e },
+    { 0x000000000003fffcULL, 0x1f8f }, { 0x000000000003fffeULL, 0x1fd0 },
+    { 0x000000000003ffffULL, 0x1011 }, { 0x0000000000040000ULL, 0x1b80 },
+    { 0x0000000000060000ULL, 0x1bc1 }, { 0x0000000000070000ULL, 0x1c02 },
+    { 0x0000000000078000ULL, 0x1c43 }, { 0x000000000007c000ULL, 0x1c84 },
+    { 0x000000000007e000ULL, 0x1cc5 }, { 0x000000000007f000ULL, 0x1d06 },
+    { 0x000000000007f800ULL, 0x1d47 }, { 0x000000000007fc00ULL, 0x1d88 },
+    { 0x000000000007fe00ULL, 0x1dc9 }, { 0x000000000007ff00ULL, 0x1e0a },
+    { 0x000000000007ff80ULL, 0x1e4b }, { 0x000000000007ffc0ULL, 0x1e8c },
+    { 0x000000000007ffe0ULL, 0x1ecd }, { 0x000000000007fff0ULL, 0x1f0e },
+    { 0x000000000007fff8ULL, 0x1f4f }, { 0x000000000007fffcULL, 0x1f90 },
+    { 0x000000000007fffeULL, 0x1fd1 }, { 0x000000000007ffffULL, 0x1012 },
+    { 0x0000000000080000ULL, 0x1b40 }, { 0x00000000000c0000ULL, 0x1b81 },
+    { 0x00000000000e0000ULL, 0x1bc2 }, { 0x00000000000f0000ULL, 0x1c03 },
+    { 0x00000000000f8000ULL, 0x1c44 }, { 0x00000000000fc000ULL, 0x1c85 },
+    { 0x00000000000fe000ULL, 0x1cc6 }, { 0x00000000000ff000ULL, 0x1d07 },
+    { 0x00000000000ff800ULL, 0x1d48 }, { 0x00000000000ffc00ULL, 0x1d89 },
+    { 0x00000000000ffe00ULL, 0x1dca }, { 0x00000000000fff00ULL, 0x1e0b },
+    { 0x00000000000fff80ULL, 0x1e4c }, { 0x00000000000fffc0ULL, 0x1e8d },
+    { 0x00000000000fffe0ULL, 0x1ece }, { 0x00000000000ffff0ULL, 0x1f0f },
+    { 0x00000000000ffff8ULL, 0x1f50 }, { 0x00000000000ffffcULL, 0x1f91 },
+    { 0x00000000000ffffeULL, 0x1fd2 }, { 0x00000000000fffffULL, 0x1013 },
+    { 0x0000000000100000ULL, 0x1b00 }, { 0x0000000000180000ULL, 0x1b41 },
+    { 0x00000000001c0000ULL, 0x1b82 }, { 0x00000000001e0000ULL, 0x1bc3 },
+    { 0x00000000001f0000ULL, 0x1c04 }, { 0x00000000001f8000ULL, 0x1c45 },
+    { 0x00000000001fc000ULL, 0x1c86 }, { 0x00000000001fe000ULL, 0x1cc7 },
+    { 0x00000000001ff000ULL, 0x1d08 }, { 0x00000000001ff800ULL, 0x1d49 },
+    { 0x00000000001ffc00ULL, 0x1d8a }, { 0x00000000001ffe00ULL, 0x1dcb },
+    { 0x00000000001fff00ULL, 0x1e0c }, { 0x00000000001fff80ULL, 0x1e4d },
+    { 0x00000000001fffc0ULL, 0x1e8e }, { 0x00000000001fffe0ULL, 0x1ecf },
+    { 0x00000000001ffff0ULL, 0x1f10 }, { 0x00000000001ffff8ULL, 0x1f51 },
+    { 0x00000000001ffffcULL, 0x1f92 }, { 0x00000000001ffffeULL, 0x1fd3 },
+    { 0x00000000001fffffULL, 0x1014 }, { 0x0000000000200000ULL, 0x1ac0 },
+    { 0x0000000000300000ULL, 0x1b01 }, { 0x0000000000380000ULL, 0x1b42 },
+    { 0x00000000003c0000ULL, 0x1b83 }, { 0x00000000003e0000ULL, 0x1bc4 },
+    { 0x00000000003f0000ULL, 0x1c05 }, { 0x00000000003f8000ULL, 0x1c46 },
+    { 0x00000000003fc000ULL, 0x1c87 }, { 0x00000000003fe000ULL, 0x1cc8 },
+    { 0x00000000003ff000ULL, 0x1d09 }, { 0x00000000003ff800ULL, 0x1d4a },
+    { 0x00000000003ffc00ULL, 0x1d8b }, { 0x00000000003ffe00ULL, 0x1dcc },
+    { 0x00000000003fff00ULL, 0x1e0d }, { 0x00000000003fff80ULL, 0x1e4e },
+    { 0x00000000003fffc0ULL, 0x1e8f }, { 0x00000000003fffe0ULL, 0x1ed0 },
+    { 0x00000000003ffff0ULL, 0x1f11 }, { 0x00000000003ffff8ULL, 0x1f52 },
+    { 0x00000000003ffffcULL, 0x1f93 }, { 0x00000000003ffffeULL, 0x1fd4 },
+    { 0x00000000003fffffULL, 0x1015 }, { 0x0000000000400000ULL, 0x1a80 },
+    { 0x0000000000600000ULL, 0x1ac1 }, { 0x0000000000700000ULL, 0x1b02 },
+    { 0x0000000000780000ULL, 0x1b43 }, { 0x00000000007c0000ULL, 0x1b84 },
+    { 0x00000000007e0000ULL, 0x1bc5 }, { 0x00000000007f0000ULL, 0x1c06 },
+    { 0x00000000007f8000ULL, 0x1c47 }, { 0x00000000007fc000ULL, 0x1c88 },
+    { 0x00000000007fe000ULL, 0x1cc9 }, { 0x00000000007ff000ULL, 0x1d0a },
+    { 0x00000000007ff800ULL, 0x1d4b }, { 0x00000000007ffc00ULL, 0x1d8c },
+    { 0x00000000007ffe00ULL, 0x1dcd }, { 0x00000000007fff00ULL, 0x1e0e },
+    { 0x00000000007fff80ULL, 0x1e4f }, { 0x00000000007fffc0ULL, 0x1e90 },
+    { 0x00000000007fffe0ULL, 0x1ed1 }, { 0x00000000007ffff0ULL, 0x1f12 },
+    { 0x00000000007ffff8ULL, 0x1f53 }, { 0x00000000007ffffcULL, 0x1f94 },
+    { 0x00000000007ffffeULL, 0x1fd5 }, { 0x00000000007fffffULL, 0x1016 },
+    { 0x0000000000800000ULL, 0x1a40 }, { 0x0000000000c00000ULL, 0x1a81 },
+    { 0x0000000000e00000ULL, 0x1ac2 }, { 0x0000000000f00000ULL, 0x1b03 },
+    { 0x0000000000f80000ULL, 0x1b44 }, { 0x0000000000fc0000ULL, 0x1b85 },
+    { 0x0000000000fe0000ULL, 0x1bc6 }, { 0x0000000000ff0000ULL, 0x1c07 },
+    { 0x0000000000ff8000ULL, 0x1c48 }, { 0x0000000000ffc000ULL, 0x1c89 },
+    { 0x0000000000ffe000ULL, 0x1cca }, { 0x0000000000fff000ULL, 0x1d0b },
+    { 0x0000000000fff800ULL, 0x1d4c }, { 0x0000000000fffc00ULL, 0x1d8d },
+    { 0x0000000000fffe00ULL, 0x1dce }, { 0x0000000000ffff00ULL, 0x1e0f },
+    { 0x0000000000ffff80ULL, 0x1e50 }, { 0x0000000000ffffc0ULL, 0x1e91 },
+    { 0x0000000000ffffe0ULL, 0x1ed2 }, { 0x0000000000fffff0ULL, 0x1f13 },
+    { 0x0000000000fffff8ULL, 0x1f54 }, { 0x0000000000fffffcULL, 0x1f95 },
+    { 0x0000000000fffffeULL, 0x1fd6 }, { 0x0000000000ffffffULL, 0x1017 },
+    { 0x0000000001000000ULL, 0x1a00 }, { 0x0000000001800000ULL, 0x1a41 },
+    { 0x0000000001c00000ULL, 0x1a82 }, { 0x0000000001e00000ULL, 0x1ac3 },
+    { 0x0000000001f00000ULL, 0x1b04 }, { 0x0000000001f80000ULL, 0x1b45 },
+    { 0x0000000001fc0000ULL, 0x1b86 }, { 0x0000000001fe0000ULL, 0x1bc7 },
+    { 0x0000000001ff0000ULL, 0x1c08 }, { 0x0000000001ff8000ULL, 0x1c49 },
+    { 0x0000000001ffc000ULL, 0x1c8a }, { 0x0000000001ffe000ULL, 0x1ccb },
+    { 0x0000000001fff000ULL, 0x1d0c }, { 0x0000000001fff800ULL, 0x1d4d },
+    { 0x0000000001fffc00ULL, 0x1d8e }, { 0x0000000001fffe00ULL, 0x1dcf },
+    { 0x0000000001ffff00ULL, 0x1e10 }, { 0x0000000001ffff80ULL, 0x1e51 },
+    { 0x0000000001ffffc0ULL, 0x1e92 }, { 0x0000000001ffffe0ULL, 0x1ed3 },
+    { 0x0000000001fffff0ULL, 0x1f14 }, { 0x0000000001fffff8ULL, 0x1f55 },
+    { 0x0000000001fffffcULL, 0x1f96 }, { 0x0000000001fffffeULL, 0x1fd7 },
+    { 0x0000000001ffffffULL, 0x1018 }, { 0x0000000002000000ULL, 0x19c0 },
+    { 0x0000000003000000ULL, 0x1a01 }, { 0x0000000003800000ULL, 0x1a42 },
+    { 0x0000000003c00000ULL, 0x1a83 }, { 0x0000000003e00000ULL, 0x1ac4 },
+    { 0x0000000003f00000ULL, 0x1b05 }, { 0x0000000003f80000ULL, 0x1b46 },
+    { 0x0000000003fc0000ULL, 0x1b87 }, { 0x0000000003fe0000ULL, 0x1bc8 },
+    { 0x0000000003ff0000ULL, 0x1c09 }, { 0x0000000003ff8000ULL, 0x1c4a },
+    { 0x0000000003ffc000ULL, 0x1c8b }, { 0x0000000003ffe000ULL, 0x1ccc },
+    { 0x0000000003fff000ULL, 0x1d0d }, { 0x0000000003fff800ULL, 0x1d4e },
+    { 0x0000000003fffc00ULL, 0x1d8f }, { 0x0000000003fffe00ULL, 0x1dd0 },
+    { 0x0000000003ffff00ULL, 0x1e11 }, { 0x0000000003ffff80ULL, 0x1e52 },
+    { 0x0000000003ffffc0ULL, 0x1e93 }, { 0x0000000003ffffe0ULL, 0x1ed4 },
+    { 0x0000000003fffff0ULL, 0x1f15 }, { 0x0000000003fffff8ULL, 0x1f56 },
+    { 0x0000000003fffffcULL, 0x1f97 }, { 0x0000000003fffffeULL, 0x1fd8 },
+    { 0x0000000003ffffffULL, 0x1019 }, { 0x0000000004000000ULL, 0x1980 },
+    { 0x0000000006000000ULL, 0x19c1 }, { 0x0000000007000000ULL, 0x1a02 },
+    { 0x0000000007800000ULL, 0x1a43 }, { 0x0000000007c00000ULL, 0x1a84 },
+    { 0x0000000007e00000ULL, 0x1ac5 }, { 0x0000000007f00000ULL, 0x1b06 },
+    { 0x0000000007f80000ULL, 0x1b47 }, { 0x0000000007fc0000ULL, 0x1b88 },
+    { 0x0000000007fe0000ULL, 0x1bc9 }, { 0x0000000007ff0000ULL, 0x1c0a },
+    { 0x0000000007ff8000ULL, 0x1c4b }, { 0x0000000007ffc000ULL, 0x1c8c },
+    { 0x0000000007ffe000ULL, 0x1ccd }, { 0x0000000007fff000ULL, 0x1d0e },
+    { 0x0000000007fff800ULL, 0x1d4f }, { 0x0000000007fffc00ULL, 0x1d90 },
+    { 0x0000000007fffe00ULL, 0x1dd1 }, { 0x0000000007ffff00ULL, 0x1e12 },
+    { 0x0000000007ffff80ULL, 0x1e53 }, { 0x0000000007ffffc0ULL, 0x1e94 },
+    { 0x0000000007ffffe0ULL, 0x1ed5 }, { 0x0000000007fffff0ULL, 0x1f16 },
+    { 0x0000000007fffff8ULL, 0x1f57 }, { 0x0000000007fffffcULL, 0x1f98 },
+    { 0x0000000007fffffeULL, 0x1fd9 }, { 0x0000000007ffffffULL, 0x101a },
+    { 0x0000000008000000ULL, 0x1940 }, { 0x000000000c000000ULL, 0x1981 },
+    { 0x000000000e000000ULL, 0x19c2 }, { 0x000000000f000000ULL, 0x1a03 },
+    { 0x000000000f800000ULL, 0x1a44 }, { 0x000000000fc00000ULL, 0x1a85 },
+    { 0x000000000fe00000ULL, 0x1ac6 }, { 0x000000000ff00000ULL, 0x1b07 },
+    { 0x000000000ff80000ULL, 0x1b48 }, { 0x000000000ffc0000ULL, 0x1b89 },
+    { 0x000000000ffe0000ULL, 0x1bca }, { 0x000000000fff0000ULL, 0x1c0b },
+    { 0x000000000fff8000ULL, 0x1c4c }, { 0x000000000fffc000ULL, 0x1c8d },
+    { 0x000000000fffe000ULL, 0x1cce }, { 0x000000000ffff000ULL, 0x1d0f },
+    { 0x000000000ffff800ULL, 0x1d50 }, { 0x000000000ffffc00ULL, 0x1d91 },
+    { 0x000000000ffffe00ULL, 0x1dd2 }, { 0x000000000fffff00ULL, 0x1e13 },
+    { 0x000000000fffff80ULL, 0x1e54 }, { 0x000000000fffffc0ULL, 0x1e95 },
+    { 0x000000000fffffe0ULL, 0x1ed6 }, { 0x000000000ffffff0ULL, 0x1f17 },
+    { 0x000000000ffffff8ULL, 0x1f58 }, { 0x000000000ffffffcULL, 0x1f99 },
+    { 0x000000000ffffffeULL, 0x1fda }, { 0x000000000fffffffULL, 0x101b },
+    { 0x0000000010000000ULL, 0x1900 }, { 0x0000000018000000ULL, 0x1941 },
+    { 0x000000001c000000ULL, 0x1982 }, { 0x000000001e000000ULL, 0x19c3 },
+    { 0x000000001f000000ULL, 0x1a04 }, { 0x000000001f800000ULL, 0x1a45 },
+    { 0x000000001fc00000ULL, 0x1a86 }, { 0x000000001fe00000ULL, 0x1ac7 },
+    { 0x000000001ff00000ULL, 0x1b08 }, { 0x000000001ff80000ULL, 0x1b49 },
+    { 0x000000001ffc0000ULL, 0x1b8a }, { 0x000000001ffe0000ULL, 0x1bcb },
+    { 0x000000001fff0000ULL, 0x1c0c }, { 0x000000001fff8000ULL, 0x1c4d },
+    { 0x000000001fffc000ULL, 0x1c8e }, { 0x000000001fffe000ULL, 0x1ccf },
+    { 0x000000001ffff000ULL, 0x1d10 }, { 0x000000001ffff800ULL, 0x1d51 },
+    { 0x000000001ffffc00ULL, 0x1d92 }, { 0x000000001ffffe00ULL, 0x1dd3 },
+    { 0x000000001fffff00ULL, 0x1e14 }, { 0x000000001fffff80ULL, 0x1e55 },
+    { 0x000000001fffffc0ULL, 0x1e96 }, { 0x000000001fffffe0ULL, 0x1ed7 },
+    { 0x000000001ffffff0ULL, 0x1f18 }, { 0x000000001ffffff8ULL, 0x1f59 },
+    { 0x000000001ffffffcULL, 0x1f9a }, { 0x000000001ffffffeULL, 0x1fdb },
+    { 0x000000001fffffffULL, 0x101c }, { 0x0000000020000000ULL, 0x18c0 },
+    { 0x0000000030000000ULL, 0x1901 }, { 0x0000000038000000ULL, 0x1942 },
+    { 0x000000003c000000ULL, 0x1983 }, { 0x000000003e000000ULL, 0x19c4 },
+    { 0x000000003f000000ULL, 0x1a05 }, { 0x000000003f800000ULL, 0x1a46 },
+    { 0x000000003fc00000ULL, 0x1a87 }, { 0x000000003fe00000ULL, 0x1ac8 },
+    { 0x000000003ff00000ULL, 0x1b09 }, { 0x000000003ff80000ULL, 0x1b4a },
+    { 0x000000003ffc0000ULL, 0x1b8b }, { 0x000000003ffe0000ULL, 0x1bcc },
+    { 0x000000003fff0000ULL, 0x1c0d }, { 0x000000003fff8000ULL, 0x1c4e },
+    { 0x000000003fffc000ULL, 0x1c8f }, { 0x000000003fffe000ULL, 0x1cd0 },
+    { 0x000000003ffff000ULL, 0x1d11 }, { 0x000000003ffff800ULL, 0x1d52 },
+    { 0x000000003ffffc00ULL, 0x1d93 }, { 0x000000003ffffe00ULL, 0x1dd4 },
+    { 0x000000003fffff00ULL, 0x1e15 }, { 0x000000003fffff80ULL, 0x1e56 },
+    { 0x000000003fffffc0ULL, 0x1e97 }, { 0x000000003fffffe0ULL, 0x1ed8 },
+    { 0x000000003ffffff0ULL, 0x1f19 }, { 0x000000003ffffff8ULL, 0x1f5a },
+    { 0x000000003ffffffcULL, 0x1f9b }, { 0x000000003ffffffeULL, 0x1fdc },
+    { 0x000000003fffffffULL, 0x101d }, { 0x0000000040000000ULL, 0x1880 },
+    { 0x0000000060000000ULL, 0x18c1 }, { 0x0000000070000000ULL, 0x1902 },
+    { 0x0000000078000000ULL, 0x1943 }, { 0x000000007c000000ULL, 0x1984 },
+    { 0x000000007e000000ULL, 0x19c5 }, { 0x000000007f000000ULL, 0x1a06 },
+    { 0x000000007f800000ULL, 0x1a47 }, { 0x000000007fc00000ULL, 0x1a88 },
+    { 0x000000007fe00000ULL, 0x1ac9 }, { 0x000000007ff00000ULL, 0x1b0a },
+    { 0x000000007ff80000ULL, 0x1b4b }, { 0x000000007ffc0000ULL, 0x1b8c },
+    { 0x000000007ffe0000ULL, 0x1bcd }, { 0x000000007fff0000ULL, 0x1c0e },
+    { 0x000000007fff8000ULL, 0x1c4f }, { 0x000000007fffc000ULL, 0x1c90 },
+    { 0x000000007fffe000ULL, 0x1cd1 }, { 0x000000007ffff000ULL, 0x1d12 },
+    { 0x000000007ffff800ULL, 0x1d53 }, { 0x000000007ffffc00ULL, 0x1d94 },
+    { 0x000000007ffffe00ULL, 0x1dd5 }, { 0x000000007fffff00ULL, 0x1e16 },
+    { 0x000000007fffff80ULL, 0x1e57 }, { 0x000000007fffffc0ULL, 0x1e98 },
+    { 0x000000007fffffe0ULL, 0x1ed9 }, { 0x000000007ffffff0ULL, 0x1f1a },
+    { 0x000000007ffffff8ULL, 0x1f5b }, { 0x000000007ffffffcULL, 0x1f9c },
+    { 0x000000007ffffffeULL, 0x1fdd }, { 0x000000007fffffffULL, 0x101e },
+    { 0x0000000080000000ULL, 0x1840 }, { 0x00000000c0000000ULL, 0x1881 },
+    { 0x00000000e0000000ULL, 0x18c2 }, { 0x00000000f0000000ULL, 0x1903 },
+    { 0x00000000f8000000ULL, 0x1944 }, { 0x00000000fc000000ULL, 0x1985 },
+    { 0x00000000fe000000ULL, 0x19c6 }, { 0x00000000ff000000ULL, 0x1a07 },
+    { 0x00000000ff800000ULL, 0x1a48 }, { 0x00000000ffc00000ULL, 0x1a89 },
+    { 0x00000000ffe00000ULL, 0x1aca }, { 0x00000000fff00000ULL, 0x1b0b },
+    { 0x00000000fff80000ULL, 0x1b4c }, { 0x00000000fffc0000ULL, 0x1b8d },
+    { 0x00000000fffe0000ULL, 0x1bce }, { 0x00000000ffff0000ULL, 0x1c0f },
+    { 0x00000000ffff8000ULL, 0x1c50 }, { 0x00000000ffffc000ULL, 0x1c91 },
+    { 0x00000000ffffe000ULL, 0x1cd2 }, { 0x00000000fffff000ULL, 0x1d13 },
+    { 0x00000000fffff800ULL, 0x1d54 }, { 0x00000000fffffc00ULL, 0x1d95 },
+    { 0x00000000fffffe00ULL, 0x1dd6 }, { 0x00000000ffffff00ULL, 0x1e17 },
+    { 0x00000000ffffff80ULL, 0x1e58 }, { 0x00000000ffffffc0ULL, 0x1e99 },
+    { 0x00000000ffffffe0ULL, 0x1eda }, { 0x00000000fffffff0ULL, 0x1f1b },
+    { 0x00000000fffffff8ULL, 0x1f5c }, { 0x00000000fffffffcULL, 0x1f9d },
+    { 0x00000000fffffffeULL, 0x1fde }, { 0x00000000ffffffffULL, 0x101f },
+    { 0x0000000100000000ULL, 0x1800 }, { 0x0000000100000001ULL, 0x0000 },
+    { 0x0000000180000000ULL, 0x1841 }, { 0x00000001c0000000ULL, 0x1882 },
+    { 0x00000001e0000000ULL, 0x18c3 }, { 0x00000001f0000000ULL, 0x1904 },
+    { 0x00000001f8000000ULL, 0x1945 }, { 0x00000001fc000000ULL, 0x1986 },
+    { 0x00000001fe000000ULL, 0x19c7 }, { 0x00000001ff000000ULL, 0x1a08 },
+    { 0x00000001ff800000ULL, 0x1a49 }, { 0x00000001ffc00000ULL, 0x1a8a },
+    { 0x00000001ffe00000ULL, 0x1acb }, { 0x00000001fff00000ULL, 0x1b0c },
+    { 0x00000001fff80000ULL, 0x1b4d }, { 0x00000001fffc0000ULL, 0x1b8e },
+    { 0x00000001fffe0000ULL, 0x1bcf }, { 0x00000001ffff0000ULL, 0x1c10 },
+    { 0x00000001ffff8000ULL, 0x1c51 }, { 0x00000001ffffc000ULL, 0x1c92 },
+    { 0x00000001ffffe000ULL, 0x1cd3 }, { 0x00000001fffff000ULL, 0x1d14 },
+    { 0x00000001fffff800ULL, 0x1d55 }, { 0x00000001fffffc00ULL, 0x1d96 },
+    { 0x00000001fffffe00ULL, 0x1dd7 }, { 0x00000001ffffff00ULL, 0x1e18 },
+    { 0x00000001ffffff80ULL, 0x1e59 }, { 0x00000001ffffffc0ULL, 0x1e9a },
+    { 0x00000001ffffffe0ULL, 0x1edb }, { 0x00000001fffffff0ULL, 0x1f1c },
+    { 0x00000001fffffff8ULL, 0x1f5d }, { 0x00000001fffffffcULL, 0x1f9e },
+    { 0x00000001fffffffeULL, 0x1fdf }, { 0x00000001ffffffffULL, 0x1020 },
+    { 0x0000000200000000ULL, 0x17c0 }, { 0x0000000200000002ULL, 0x07c0 },
+    { 0x0000000300000000ULL, 0x1801 }, { 0x0000000300000003ULL, 0x0001 },
+    { 0x0000000380000000ULL, 0x1842 }, { 0x00000003c0000000ULL, 0x1883 },
+    { 0x00000003e0000000ULL, 0x18c4 }, { 0x00000003f0000000ULL, 0x1905 },
+    { 0x00000003f8000000ULL, 0x1946 }, { 0x00000003fc000000ULL, 0x1987 },
+    { 0x00000003fe000000ULL, 0x19c8 }, { 0x00000003ff000000ULL, 0x1a09 },
+    { 0x00000003ff800000ULL, 0x1a4a }, { 0x00000003ffc00000ULL, 0x1a8b },
+    { 0x00000003ffe00000ULL, 0x1acc }, { 0x00000003fff00000ULL, 0x1b0d },
+    { 0x00000003fff80000ULL, 0x1b4e }, { 0x00000003fffc0000ULL, 0x1b8f },
+    { 0x00000003fffe0000ULL, 0x1bd0 }, { 0x00000003ffff0000ULL, 0x1c11 },
+    { 0x00000003ffff8000ULL, 0x1c52 }, { 0x00000003ffffc000ULL, 0x1c93 },
+    { 0x00000003ffffe000ULL, 0x1cd4 }, { 0x00000003fffff000ULL, 0x1d15 },
+    { 0x00000003fffff800ULL, 0x1d56 }, { 0x00000003fffffc00ULL, 0x1d97 },
+    { 0x00000003fffffe00ULL, 0x1dd8 }, { 0x00000003ffffff00ULL, 0x1e19 },
+    { 0x00000003ffffff80ULL, 0x1e5a }, { 0x00000003ffffffc0ULL, 0x1e9b },
+    { 0x00000003ffffffe0ULL, 0x1edc }, { 0x00000003fffffff0ULL, 0x1f1d },
+    { 0x00000003fffffff8ULL, 0x1f5e }, { 0x00000003fffffffcULL, 0x1f9f },
+    { 0x00000003fffffffeULL, 0x1fe0 }, { 0x00000003ffffffffULL, 0x1021 },
+    { 0x0000000400000000ULL, 0x1780 }, { 0x0000000400000004ULL, 0x0780 },
+    { 0x0000000600000000ULL, 0x17c1 }, { 0x0000000600000006ULL, 0x07c1 },
+    { 0x0000000700000000ULL, 0x1802 }, { 0x0000000700000007ULL, 0x0002 },
+    { 0x0000000780000000ULL, 0x1843 }, { 0x00000007c0000000ULL, 0x1884 },
+    { 0x00000007e0000000ULL, 0x18c5 }, { 0x00000007f0000000ULL, 0x1906 },
+    { 0x00000007f8000000ULL, 0x1947 }, { 0x00000007fc000000ULL, 0x1988 },
+    { 0x00000007fe000000ULL, 0x19c9 }, { 0x00000007ff000000ULL, 0x1a0a },
+    { 0x00000007ff800000ULL, 0x1a4b }, { 0x00000007ffc00000ULL, 0x1a8c },
+    { 0x00000007ffe00000ULL, 0x1acd }, { 0x00000007fff00000ULL, 0x1b0e },
+    { 0x00000007fff80000ULL, 0x1b4f }, { 0x00000007fffc0000ULL, 0x1b90 },
+    { 0x00000007fffe0000ULL, 0x1bd1 }, { 0x00000007ffff0000ULL, 0x1c12 },
+    { 0x00000007ffff8000ULL, 0x1c53 }, { 0x00000007ffffc000ULL, 0x1c94 },
+    { 0x00000007ffffe000ULL, 0x1cd5 }, { 0x00000007fffff000ULL, 0x1d16 },
+    { 0x00000007fffff800ULL, 0x1d57 }, { 0x00000007fffffc00ULL, 0x1d98 },
+    { 0x00000007fffffe00ULL, 0x1dd9 }, { 0x00000007ffffff00ULL, 0x1e1a },
+    { 0x00000007ffffff80ULL, 0x1e5b }, { 0x00000007ffffffc0ULL, 0x1e9c },
+    { 0x00000007ffffffe0ULL, 0x1edd }, { 0x00000007fffffff0ULL, 0x1f1e },
+    { 0x00000007fffffff8ULL, 0x1f5f }, { 0x00000007fffffffcULL, 0x1fa0 },
+    { 0x00000007fffffffeULL, 0x1fe1 }, { 0x00000007ffffffffULL, 0x1022 },
+    { 0x0000000800000000ULL, 0x1740 }, { 0x0000000800000008ULL, 0x0740 },
+    { 0x0000000c00000000ULL, 0x1781 }, { 0x0000000c0000000cULL, 0x0781 },
+    { 0x0000000e00000000ULL, 0x17c2 }, { 0x0000000e0000000eULL, 0x07c2 },
+    { 0x0000000f00000000ULL, 0x1803 }, { 0x0000000f0000000fULL, 0x0003 },
+    { 0x0000000f80000000ULL, 0x1844 }, { 0x0000000fc0000000ULL, 0x1885 },
+    { 0x0000000fe0000000ULL, 0x18c6 }, { 0x0000000ff0000000ULL, 0x1907 },
+    { 0x0000000ff8000000ULL, 0x1948 }, { 0x0000000ffc000000ULL, 0x1989 },
+    { 0x0000000ffe000000ULL, 0x19ca }, { 0x0000000fff000000ULL, 0x1a0b },
+    { 0x0000000fff800000ULL, 0x1a4c }, { 0x0000000fffc00000ULL, 0x1a8d },
+    { 0x0000000fffe00000ULL, 0x1ace }, { 0x0000000ffff00000ULL, 0x1b0f },
+    { 0x0000000ffff80000ULL, 0x1b50 }, { 0x0000000ffffc0000ULL, 0x1b91 },
+    { 0x0000000ffffe0000ULL, 0x1bd2 }, { 0x0000000fffff0000ULL, 0x1c13 },
+    { 0x0000000fffff8000ULL, 0x1c54 }, { 0x0000000fffffc000ULL, 0x1c95 },
+    { 0x0000000fffffe000ULL, 0x1cd6 }, { 0x0000000ffffff000ULL, 0x1d17 },
+    { 0x0000000ffffff800ULL, 0x1d58 }, { 0x0000000ffffffc00ULL, 0x1d99 },
+    { 0x0000000ffffffe00ULL, 0x1dda }, { 0x0000000fffffff00ULL, 0x1e1b },
+    { 0x0000000fffffff80ULL, 0x1e5c }, { 0x0000000fffffffc0ULL, 0x1e9d },
+    { 0x0000000fffffffe0ULL, 0x1ede }, { 0x0000000ffffffff0ULL, 0x1f1f },
+    { 0x0000000ffffffff8ULL, 0x1f60 }, { 0x0000000ffffffffcULL, 0x1fa1 },
+    { 0x0000000ffffffffeULL, 0x1fe2 }, { 0x0000000fffffffffULL, 0x1023 },
+    { 0x0000001000000000ULL, 0x1700 }, { 0x0000001000000010ULL, 0x0700 },
+    { 0x0000001800000000ULL, 0x1741 }, { 0x0000001800000018ULL, 0x0741 },
+    { 0x0000001c00000000ULL, 0x1782 }, { 0x0000001c0000001cULL, 0x0782 },
+    { 0x0000001e00000000ULL, 0x17c3 }, { 0x0000001e0000001eULL, 0x07c3 },
+    { 0x0000001f00000000ULL, 0x1804 }, { 0x0000001f0000001fULL, 0x0004 },
+    { 0x0000001f80000000ULL, 0x1845 }, { 0x0000001fc0000000ULL, 0x1886 },
+    { 0x0000001fe0000000ULL, 0x18c7 }, { 0x0000001ff0000000ULL, 0x1908 },
+    { 0x0000001ff8000000ULL, 0x1949 }, { 0x0000001ffc000000ULL, 0x198a },
+    { 0x0000001ffe000000ULL, 0x19cb }, { 0x0000001fff000000ULL, 0x1a0c },
+    { 0x0000001fff800000ULL, 0x1a4d }, { 0x0000001fffc00000ULL, 0x1a8e },
+    { 0x0000001fffe00000ULL, 0x1acf }, { 0x0000001ffff00000ULL, 0x1b10 },
+    { 0x0000001ffff80000ULL, 0x1b51 }, { 0x0000001ffffc0000ULL, 0x1b92 },
+    { 0x0000001ffffe0000ULL, 0x1bd3 }, { 0x0000001fffff0000ULL, 0x1c14 },
+    { 0x0000001fffff8000ULL, 0x1c55 }, { 0x0000001fffffc000ULL, 0x1c96 },
+    { 0x0000001fffffe000ULL, 0x1cd7 }, { 0x0000001ffffff000ULL, 0x1d18 },
+    { 0x0000001ffffff800ULL, 0x1d59 }, { 0x0000001ffffffc00ULL, 0x1d9a },
+    { 0x0000001ffffffe00ULL, 0x1ddb }, { 0x0000001fffffff00ULL, 0x1e1c },
+    { 0x0000001fffffff80ULL, 0x1e5d }, { 0x0000001fffffffc0ULL, 0x1e9e },
+    { 0x0000001fffffffe0ULL, 0x1edf }, { 0x0000001ffffffff0ULL, 0x1f20 },
+    { 0x0000001ffffffff8ULL, 0x1f61 }, { 0x0000001ffffffffcULL, 0x1fa2 },
+    { 0x0000001ffffffffeULL, 0x1fe3 }, { 0x0000001fffffffffULL, 0x1024 },
+    { 0x0000002000000000ULL, 0x16c0 }, { 0x0000002000000020ULL, 0x06c0 },
+    { 0x0000003000000000ULL, 0x1701 }, { 0x0000003000000030ULL, 0x0701 },
+    { 0x0000003800000000ULL, 0x1742 }, { 0x0000003800000038ULL, 0x0742 },
+    { 0x0000003c00000000ULL, 0x1783 }, { 0x0000003c0000003cULL, 0x0783 },
+    { 0x0000003e00000000ULL, 0x17c4 }, { 0x0000003e0000003eULL, 0x07c4 },
+    { 0x0000003f00000000ULL, 0x1805 }, { 0x0000003f0000003fULL, 0x0005 },
+    { 0x0000003f80000000ULL, 0x1846 }, { 0x0000003fc0000000ULL, 0x1887 },
+    { 0x0000003fe0000000ULL, 0x18c8 }, { 0x0000003ff0000000ULL, 0x1909 },
+    { 0x0000003ff8000000ULL, 0x194a }, { 0x0000003ffc000000ULL, 0x198b },
+    { 0x0000003ffe000000ULL, 0x19cc }, { 0x0000003fff000000ULL, 0x1a0d },
+    { 0x0000003fff800000ULL, 0x1a4e }, { 0x0000003fffc00000ULL, 0x1a8f },
+    { 0x0000003fffe00000ULL, 0x1ad0 }, { 0x0000003ffff00000ULL, 0x1b11 },
+    { 0x0000003ffff80000ULL, 0x1b52 }, { 0x0000003ffffc0000ULL, 0x1b93 },
+    { 0x0000003ffffe0000ULL, 0x1bd4 }, { 0x0000003fffff0000ULL, 0x1c15 },
+    { 0x0000003fffff8000ULL, 0x1c56 }, { 0x0000003fffffc000ULL, 0x1c97 },
+    { 0x0000003fffffe000ULL, 0x1cd8 }, { 0x0000003ffffff000ULL, 0x1d19 },
+    { 0x0000003ffffff800ULL, 0x1d5a }, { 0x0000003ffffffc00ULL, 0x1d9b },
+    { 0x0000003ffffffe00ULL, 0x1ddc }, { 0x0000003fffffff00ULL, 0x1e1d },
+    { 0x0000003fffffff80ULL, 0x1e5e }, { 0x0000003fffffffc0ULL, 0x1e9f },
+    { 0x0000003fffffffe0ULL, 0x1ee0 }, { 0x0000003ffffffff0ULL, 0x1f21 },
+    { 0x0000003ffffffff8ULL, 0x1f62 }, { 0x0000003ffffffffcULL, 0x1fa3 },
+    { 0x0000003ffffffffeULL, 0x1fe4 }, { 0x0000003fffffffffULL, 0x1025 },
+    { 0x0000004000000000ULL, 0x1680 }, { 0x0000004000000040ULL, 0x0680 },
+    { 0x0000006000000000ULL, 0x16c1 }, { 0x0000006000000060ULL, 0x06c1 },
+    { 0x0000007000000000ULL, 0x1702 }, { 0x0000007000000070ULL, 0x0702 },
+    { 0x0000007800000000ULL, 0x1743 }, { 0x0000007800000078ULL, 0x0743 },
+    { 0x0000007c00000000ULL, 0x1784 }, { 0x0000007c0000007cULL, 0x0784 },
+    { 0x0000007e00000000ULL, 0x17c5 }, { 0x0000007e0000007eULL, 0x07c5 },
+    { 0x0000007f00000000ULL, 0x1806 }, { 0x0000007f0000007fULL, 0x0006 },
+    { 0x0000007f80000000ULL, 0x1847 }, { 0x0000007fc0000000ULL, 0x1888 },
+    { 0x0000007fe0000000ULL, 0x18c9 }, { 0x0000007ff0000000ULL, 0x190a },
+    { 0x0000007ff8000000ULL, 0x194b }, { 0x0000007ffc000000ULL, 0x198c },
+    { 0x0000007ffe000000ULL, 0x19cd }, { 0x0000007fff000000ULL, 0x1a0e },
+    { 0x0000007fff800000ULL, 0x1a4f }, { 0x0000007fffc00000ULL, 0x1a90 },
+    { 0x0000007fffe00000ULL, 0x1ad1 }, { 0x0000007ffff00000ULL, 0x1b12 },
+    { 0x0000007ffff80000ULL, 0x1b53 }, { 0x0000007ffffc0000ULL, 0x1b94 },
+    { 0x0000007ffffe0000ULL, 0x1bd5 }, { 0x0000007fffff0000ULL, 0x1c16 },
+    { 0x0000007fffff8000ULL, 0x1c57 }, { 0x0000007fffffc000ULL, 0x1c98 },
+    { 0x0000007fffffe000ULL, 0x1cd9 }, { 0x0000007ffffff000ULL, 0x1d1a },
+    { 0x0000007ffffff800ULL, 0x1d5b }, { 0x0000007ffffffc00ULL, 0x1d9c },
+    { 0x0000007ffffffe00ULL, 0x1ddd }, { 0x0000007fffffff00ULL, 0x1e1e },
+    { 0x0000007fffffff80ULL, 0x1e5f }, { 0x0000007fffffffc0ULL, 0x1ea0 },
+    { 0x0000007fffffffe0ULL, 0x1ee1 }, { 0x0000007ffffffff0ULL, 0x1f22 },
+    { 0x0000007ffffffff8ULL, 0x1f63 }, { 0x0000007ffffffffcULL, 0x1fa4 },
+    { 0x0000007ffffffffeULL, 0x1fe5 }, { 0x0000007fffffffffULL, 0x1026 },
+    { 0x0000008000000000ULL, 0x1640 }, { 0x0000008000000080ULL, 0x0640 },
+    { 0x000000c000000000ULL, 0x1681 }, { 0x000000c0000000c0ULL, 0x0681 },
+    { 0x000000e000000000ULL, 0x16c2 }, { 0x000000e0000000e0ULL, 0x06c2 },
+    { 0x000000f000000000ULL, 0x1703 }, { 0x000000f0000000f0ULL, 0x0703 },
+    { 0x000000f800000000ULL, 0x1744 }, { 0x000000f8000000f8ULL, 0x0744 },
+    { 0x000000fc00000000ULL, 0x1785 }, { 0x000000fc000000fcULL, 0x0785 },
+    { 0x000000fe00000000ULL, 0x17c6 }, { 0x000000fe000000feULL, 0x07c6 },
+    { 0x000000ff00000000ULL, 0x1807 }, { 0x000000ff000000ffULL, 0x0007 },
+    { 0x000000ff80000000ULL, 0x1848 }, { 0x000000ffc0000000ULL, 0x1889 },
+    { 0x000000ffe0000000ULL, 0x18ca }, { 0x000000fff0000000ULL, 0x190b },
+    { 0x000000fff8000000ULL, 0x194c }, { 0x000000fffc000000ULL, 0x198d },
+    { 0x000000fffe000000ULL, 0x19ce }, { 0x000000ffff000000ULL, 0x1a0f },
+    { 0x000000ffff800000ULL, 0x1a50 }, { 0x000000ffffc00000ULL, 0x1a91 },
+    { 0x000000ffffe00000ULL, 0x1ad2 }, { 0x000000fffff00000ULL, 0x1b13 },
+    { 0x000000fffff80000ULL, 0x1b54 }, { 0x000000fffffc0000ULL, 0x1b95 },
+    { 0x000000fffffe0000ULL, 0x1bd6 }, { 0x000000ffffff0000ULL, 0x1c17 },
+    { 0x000000ffffff8000ULL, 0x1c58 }, { 0x000000ffffffc000ULL, 0x1c99 },
+    { 0x000000ffffffe000ULL, 0x1cda }, { 0x000000fffffff000ULL, 0x1d1b },
+    { 0x000000fffffff800ULL, 0x1d5c }, { 0x000000fffffffc00ULL, 0x1d9d },
+    { 0x000000fffffffe00ULL, 0x1dde }, { 0x000000ffffffff00ULL, 0x1e1f },
+    { 0x000000ffffffff80ULL, 0x1e60 }, { 0x000000ffffffffc0ULL, 0x1ea1 },
+    { 0x000000ffffffffe0ULL, 0x1ee2 }, { 0x000000fffffffff0ULL, 0x1f23 },
+    { 0x000000fffffffff8ULL, 0x1f64 }, { 0x000000fffffffffcULL, 0x1fa5 },
+    { 0x000000fffffffffeULL, 0x1fe6 }, { 0x000000ffffffffffULL, 0x1027 },
+    { 0x0000010000000000ULL, 0x1600 }, { 0x0000010000000100ULL, 0x0600 },
+    { 0x0000018000000000ULL, 0x1641 }, { 0x0000018000000180ULL, 0x0641 },
+    { 0x000001c000000000ULL, 0x1682 }, { 0x000001c0000001c0ULL, 0x0682 },
+    { 0x000001e000000000ULL, 0x16c3 }, { 0x000001e0000001e0ULL, 0x06c3 },
+    { 0x000001f000000000ULL, 0x1704 }, { 0x000001f0000001f0ULL, 0x0704 },
+    { 0x000001f800000000ULL, 0x1745 }, { 0x000001f8000001f8ULL, 0x0745 },
+    { 0x000001fc00000000ULL, 0x1786 }, { 0x000001fc000001fcULL, 0x0786 },
+    { 0x000001fe00000000ULL, 0x17c7 }, { 0x000001fe000001feULL, 0x07c7 },
+    { 0x000001ff00000000ULL, 0x1808 }, { 0x000001ff000001ffULL, 0x0008 },
+    { 0x000001ff80000000ULL, 0x1849 }, { 0x000001ffc0000000ULL, 0x188a },
+    { 0x000001ffe0000000ULL, 0x18cb }, { 0x000001fff0000000ULL, 0x190c },
+    { 0x000001fff8000000ULL, 0x194d }, { 0x000001fffc000000ULL, 0x198e },
+    { 0x000001fffe000000ULL, 0x19cf }, { 0x000001ffff000000ULL, 0x1a10 },
+    { 0x000001ffff800000ULL, 0x1a51 }, { 0x000001ffffc00000ULL, 0x1a92 },
+    { 0x000001ffffe00000ULL, 0x1ad3 }, { 0x000001fffff00000ULL, 0x1b14 },
+    { 0x000001fffff80000ULL, 0x1b55 }, { 0x000001fffffc0000ULL, 0x1b96 },
+    { 0x000001fffffe0000ULL, 0x1bd7 }, { 0x000001ffffff0000ULL, 0x1c18 },
+    { 0x000001ffffff8000ULL, 0x1c59 }, { 0x000001ffffffc000ULL, 0x1c9a },
+    { 0x000001ffffffe000ULL, 0x1cdb }, { 0x000001fffffff000ULL, 0x1d1c },
+    { 0x000001fffffff800ULL, 0x1d5d }, { 0x000001fffffffc00ULL, 0x1d9e },
+    { 0x000001fffffffe00ULL, 0x1ddf }, { 0x000001ffffffff00ULL, 0x1e20 },
+    { 0x000001ffffffff80ULL, 0x1e61 }, { 0x000001ffffffffc0ULL, 0x1ea2 },
+    { 0x000001ffffffffe0ULL, 0x1ee3 }, { 0x000001fffffffff0ULL, 0x1f24 },
+    { 0x000001fffffffff8ULL, 0x1f65 }, { 0x000001fffffffffcULL, 0x1fa6 },
+    { 0x000001fffffffffeULL, 0x1fe7 }, { 0x000001ffffffffffULL, 0x1028 },
+    { 0x0000020000000000ULL, 0x15c0 }, { 0x0000020000000200ULL, 0x05c0 },
+    { 0x0000030000000000ULL, 0x1601 }, { 0x0000030000000300ULL, 0x0601 },
+    { 0x0000038000000000ULL, 0x1642 }, { 0x0000038000000380ULL, 0x0642 },
+    { 0x000003c000000000ULL, 0x1683 }, { 0x000003c0000003c0ULL, 0x0683 },
+    { 0x000003e000000000ULL, 0x16c4 }, { 0x000003e0000003e0ULL, 0x06c4 },
+    { 0x000003f000000000ULL, 0x1705 }, { 0x000003f0000003f0ULL, 0x0705 },
+    { 0x000003f800000000ULL, 0x1746 }, { 0x000003f8000003f8ULL, 0x0746 },
+    { 0x000003fc00000000ULL, 0x1787 }, { 0x000003fc000003fcULL, 0x0787 },
+    { 0x000003fe00000000ULL, 0x17c8 }, { 0x000003fe000003feULL, 0x07c8 },
+    { 0x000003ff00000000ULL, 0x1809 }, { 0x000003ff000003ffULL, 0x0009 },
+    { 0x000003ff80000000ULL, 0x184a }, { 0x000003ffc0000000ULL, 0x188b },
+    { 0x000003ffe0000000ULL, 0x18cc }, { 0x000003fff0000000ULL, 0x190d },
+    { 0x000003fff8000000ULL, 0x194e }, { 0x000003fffc000000ULL, 0x198f },
+    { 0x000003fffe000000ULL, 0x19d0 }, { 0x000003ffff000000ULL, 0x1a11 },
+    { 0x000003ffff800000ULL, 0x1a52 }, { 0x000003ffffc00000ULL, 0x1a93 },
+    { 0x000003ffffe00000ULL, 0x1ad4 }, { 0x000003fffff00000ULL, 0x1b15 },
+    { 0x000003fffff80000ULL, 0x1b56 }, { 0x000003fffffc0000ULL, 0x1b97 },
+    { 0x000003fffffe0000ULL, 0x1bd8 }, { 0x000003ffffff0000ULL, 0x1c19 },
+    { 0x000003ffffff8000ULL, 0x1c5a }, { 0x000003ffffffc000ULL, 0x1c9b },
+    { 0x000003ffffffe000ULL, 0x1cdc }, { 0x000003fffffff000ULL, 0x1d1d },
+    { 0x000003fffffff800ULL, 0x1d5e }, { 0x000003fffffffc00ULL, 0x1d9f },
+    { 0x000003fffffffe00ULL, 0x1de0 }, { 0x000003ffffffff00ULL, 0x1e21 },
+    { 0x000003ffffffff80ULL, 0x1e62 }, { 0x000003ffffffffc0ULL, 0x1ea3 },
+    { 0x000003ffffffffe0ULL, 0x1ee4 }, { 0x000003fffffffff0ULL, 0x1f25 },
+    { 0x000003fffffffff8ULL, 0x1f66 }, { 0x000003fffffffffcULL, 0x1fa7 },
+    { 0x000003fffffffffeULL, 0x1fe8 }, { 0x000003ffffffffffULL, 0x1029 },
+    { 0x0000040000000000ULL, 0x1580 }, { 0x0000040000000400ULL, 0x0580 },
+    { 0x0000060000000000ULL, 0x15c1 }, { 0x0000060000000600ULL, 0x05c1 },
+    { 0x0000070000000000ULL, 0x1602 }, { 0x0000070000000700ULL, 0x0602 },
+    { 0x0000078000000000ULL, 0x1643 }, { 0x0000078000000780ULL, 0x0643 },
+    { 0x000007c000000000ULL, 0x1684 }, { 0x000007c0000007c0ULL, 0x0684 },
+    { 0x000007e000000000ULL, 0x16c5 }, { 0x000007e0000007e0ULL, 0x06c5 },
+    { 0x000007f000000000ULL, 0x1706 }, { 0x000007f0000007f0ULL, 0x0706 },
+    { 0x000007f800000000ULL, 0x1747 }, { 0x000007f8000007f8ULL, 0x0747 },
+    { 0x000007fc00000000ULL, 0x1788 }, { 0x000007fc000007fcULL, 0x0788 },
+    { 0x000007fe00000000ULL, 0x17c9 }, { 0x000007fe000007feULL, 0x07c9 },
+    { 0x000007ff00000000ULL, 0x180a }, { 0x000007ff000007ffULL, 0x000a },
+    { 0x000007ff80000000ULL, 0x184b }, { 0x000007ffc0000000ULL, 0x188c },
+    { 0x000007ffe0000000ULL, 0x18cd }, { 0x000007fff0000000ULL, 0x190e },
+    { 0x000007fff8000000ULL, 0x194f }, { 0x000007fffc000000ULL, 0x1990 },
+    { 0x000007fffe000000ULL, 0x19d1 }, { 0x000007ffff000000ULL, 0x1a12 },
+    { 0x000007ffff800000ULL, 0x1a53 }, { 0x000007ffffc00000ULL, 0x1a94 },
+    { 0x000007ffffe00000ULL, 0x1ad5 }, { 0x000007fffff00000ULL, 0x1b16 },
+    { 0x000007fffff80000ULL, 0x1b57 }, { 0x000007fffffc0000ULL, 0x1b98 },
+    { 0x000007fffffe0000ULL, 0x1bd9 }, { 0x000007ffffff0000ULL, 0x1c1a },
+    { 0x000007ffffff8000ULL, 0x1c5b }, { 0x000007ffffffc000ULL, 0x1c9c },
+    { 0x000007ffffffe000ULL, 0x1cdd }, { 0x000007fffffff000ULL, 0x1d1e },
+    { 0x000007fffffff800ULL, 0x1d5f }, { 0x000007fffffffc00ULL, 0x1da0 },
+    { 0x000007fffffffe00ULL, 0x1de1 }, { 0x000007ffffffff00ULL, 0x1e22 },
+    { 0x000007ffffffff80ULL, 0x1e63 }, { 0x000007ffffffffc0ULL, 0x1ea4 },
+    { 0x000007ffffffffe0ULL, 0x1ee5 }, { 0x000007fffffffff0ULL, 0x1f26 },
+    { 0x000007fffffffff8ULL, 0x1f67 }, { 0x000007fffffffffcULL, 0x1fa8 },
+    { 0x000007fffffffffeULL, 0x1fe9 }, { 0x000007ffffffffffULL, 0x102a },
+    { 0x0000080000000000ULL, 0x1540 }, { 0x0000080000000800ULL, 0x0540 },
+    { 0x00000c0000000000ULL, 0x1581 }, { 0x00000c0000000c00ULL, 0x0581 },
+    { 0x00000e0000000000ULL, 0x15c2 }, { 0x00000e0000000e00ULL, 0x05c2 },
+    { 0x00000f0000000000ULL, 0x1603 }, { 0x00000f0000000f00ULL, 0x0603 },
+    { 0x00000f8000000000ULL, 0x1644 }, { 0x00000f8000000f80ULL, 0x0644 },
+    { 0x00000fc000000000ULL, 0x1685 }, { 0x00000fc000000fc0ULL, 0x0685 },
+    { 0x00000fe000000000ULL, 0x16c6 }, { 0x00000fe000000fe0ULL, 0x06c6 },
+    { 0x00000ff000000000ULL, 0x1707 }, { 0x00000ff000000ff0ULL, 0x0707 },
+    { 0x00000ff800000000ULL, 0x1748 }, { 0x00000ff800000ff8ULL, 0x0748 },
+    { 0x00000ffc00000000ULL, 0x1789 }, { 0x00000ffc00000ffcULL, 0x0789 },
+    { 0x00000ffe00000000ULL, 0x17ca }, { 0x00000ffe00000ffeULL, 0x07ca },
+    { 0x00000fff00000000ULL, 0x180b }, { 0x00000fff00000fffULL, 0x000b },
+    { 0x00000fff80000000ULL, 0x184c }, { 0x00000fffc0000000ULL, 0x188d },
+    { 0x00000fffe0000000ULL, 0x18ce }, { 0x00000ffff0000000ULL, 0x190f },
+    { 0x00000ffff8000000ULL, 0x1950 }, { 0x00000ffffc000000ULL, 0x1991 },
+    { 0x00000ffffe000000ULL, 0x19d2 }, { 0x00000fffff000000ULL, 0x1a13 },
+    { 0x00000fffff800000ULL, 0x1a54 }, { 0x00000fffffc00000ULL, 0x1a95 },
+    { 0x00000fffffe00000ULL, 0x1ad6 }, { 0x00000ffffff00000ULL, 0x1b17 },
+    { 0x00000ffffff80000ULL, 0x1b58 }, { 0x00000ffffffc0000ULL, 0x1b99 },
+    { 0x00000ffffffe0000ULL, 0x1bda }, { 0x00000fffffff0000ULL, 0x1c1b },
+    { 0x00000fffffff8000ULL, 0x1c5c }, { 0x00000fffffffc000ULL, 0x1c9d },
+    { 0x00000fffffffe000ULL, 0x1cde }, { 0x00000ffffffff000ULL, 0x1d1f },
+    { 0x00000ffffffff800ULL, 0x1d60 }, { 0x00000ffffffffc00ULL, 0x1da1 },
+    { 0x00000ffffffffe00ULL, 0x1de2 }, { 0x00000fffffffff00ULL, 0x1e23 },
+    { 0x00000fffffffff80ULL, 0x1e64 }, { 0x00000fffffffffc0ULL, 0x1ea5 },
+    { 0x00000fffffffffe0ULL, 0x1ee6 }, { 0x00000ffffffffff0ULL, 0x1f27 },
+    { 0x00000ffffffffff8ULL, 0x1f68 }, { 0x00000ffffffffffcULL, 0x1fa9 },
+    { 0x00000ffffffffffeULL, 0x1fea }, { 0x00000fffffffffffULL, 0x102b },
+    { 0x0000100000000000ULL, 0x1500 }, { 0x0000100000001000ULL, 0x0500 },
+    { 0x0000180000000000ULL, 0x1541 }, { 0x0000180000001800ULL, 0x0541 },
+    { 0x00001c0000000000ULL, 0x1582 }, { 0x00001c0000001c00ULL, 0x0582 },
+    { 0x00001e0000000000ULL, 0x15c3 }, { 0x00001e0000001e00ULL, 0x05c3 },
+    { 0x00001f0000000000ULL, 0x1604 }, { 0x00001f0000001f00ULL, 0x0604 },
+    { 0x00001f8000000000ULL, 0x1645 }, { 0x00001f8000001f80ULL, 0x0645 },
+    { 0x00001fc000000000ULL, 0x1686 }, { 0x00001fc000001fc0ULL, 0x0686 },
+    { 0x00001fe000000000ULL, 0x16c7 }, { 0x00001fe000001fe0ULL, 0x06c7 },
+    { 0x00001ff000000000ULL, 0x1708 }, { 0x00001ff000001ff0ULL, 0x0708 },
+    { 0x00001ff800000000ULL, 0x1749 }, { 0x00001ff800001ff8ULL, 0x0749 },
+    { 0x00001ffc00000000ULL, 0x178a }, { 0x00001ffc00001ffcULL, 0x078a },
+    { 0x00001ffe00000000ULL, 0x17cb }, { 0x00001ffe00001ffeULL, 0x07cb },
+    { 0x00001fff00000000ULL, 0x180c }, { 0x00001fff00001fffULL, 0x000c },
+    { 0x00001fff80000000ULL, 0x184d }, { 0x00001fffc0000000ULL, 0x188e },
+    { 0x00001fffe0000000ULL, 0x18cf }, { 0x00001ffff0000000ULL, 0x1910 },
+    { 0x00001ffff8000000ULL, 0x1951 }, { 0x00001ffffc000000ULL, 0x1992 },
+    { 0x00001ffffe000000ULL, 0x19d3 }, { 0x00001fffff000000ULL, 0x1a14 },
+    { 0x00001fffff800000ULL, 0x1a55 }, { 0x00001fffffc00000ULL, 0x1a96 },
+    { 0x00001fffffe00000ULL, 0x1ad7 }, { 0x00001ffffff00000ULL, 0x1b18 },
+    { 0x00001ffffff80000ULL, 0x1b59 }, { 0x00001ffffffc0000ULL, 0x1b9a },
+    { 0x00001ffffffe0000ULL, 0x1bdb }, { 0x00001fffffff0000ULL, 0x1c1c },
+    { 0x00001fffffff8000ULL, 0x1c5d }, { 0x00001fffffffc000ULL, 0x1c9e },
+    { 0x00001fffffffe000ULL, 0x1cdf }, { 0x00001ffffffff000ULL, 0x1d20 },
+    { 0x00001ffffffff800ULL, 0x1d61 }, { 0x00001ffffffffc00ULL, 0x1da2 },
+    { 0x00001ffffffffe00ULL, 0x1de3 }, { 0x00001fffffffff00ULL, 0x1e24 },
+    { 0x00001fffffffff80ULL, 0x1e65 }, { 0x00001fffffffffc0ULL, 0x1ea6 },
+    { 0x00001fffffffffe0ULL, 0x1ee7 }, { 0x00001ffffffffff0ULL, 0x1f28 },
+    { 0x00001ffffffffff8ULL, 0x1f69 }, { 0x00001ffffffffffcULL, 0x1faa },
+    { 0x00001ffffffffffeULL, 0x1feb }, { 0x00001fffffffffffULL, 0x102c },
+    { 0x0000200000000000ULL, 0x14c0 }, { 0x0000200000002000ULL, 0x04c0 },
+    { 0x0000300000000000ULL, 0x1501 }, { 0x0000300000003000ULL, 0x0501 },
+    { 0x0000380000000000ULL, 0x1542 }, { 0x0000380000003800ULL, 0x0542 },
+    { 0x00003c0000000000ULL, 0x1583 }, { 0x00003c0000003c00ULL, 0x0583 },
+    { 0x00003e0000000000ULL, 0x15c4 }, { 0x00003e0000003e00ULL, 0x05c4 },
+    { 0x00003f0000000000ULL, 0x1605 }, { 0x00003f0000003f00ULL, 0x0605 },
+    { 0x00003f8000000000ULL, 0x1646 }, { 0x00003f8000003f80ULL, 0x0646 },
+    { 0x00003fc000000000ULL, 0x1687 }, { 0x00003fc000003fc0ULL, 0x0687 },
+    { 0x00003fe000000000ULL, 0x16c8 }, { 0x00003fe000003fe0ULL, 0x06c8 },
+    { 0x00003ff000000000ULL, 0x1709 }, { 0x00003ff000003ff0ULL, 0x0709 },
+    { 0x00003ff800000000ULL, 0x174a }, { 0x00003ff800003ff8ULL, 0x074a },
+    { 0x00003ffc00000000ULL, 0x178b }, { 0x00003ffc00003ffcULL, 0x078b },
+    { 0x00003ffe00000000ULL, 0x17cc }, { 0x00003ffe00003ffeULL, 0x07cc },
+    { 0x00003fff00000000ULL, 0x180d }, { 0x00003fff00003fffULL, 0x000d },
+    { 0x00003fff80000000ULL, 0x184e }, { 0x00003fffc0000000ULL, 0x188f },
+    { 0x00003fffe0000000ULL, 0x18d0 }, { 0x00003ffff0000000ULL, 0x1911 },
+    { 0x00003ffff8000000ULL, 0x1952 }, { 0x00003ffffc000000ULL, 0x1993 },
+    { 0x00003ffffe000000ULL, 0x19d4 }, { 0x00003fffff000000ULL, 0x1a15 },
+    { 0x00003fffff800000ULL, 0x1a56 }, { 0x00003fffffc00000ULL, 0x1a97 },
+    { 0x00003fffffe00000ULL, 0x1ad8 }, { 0x00003ffffff00000ULL, 0x1b19 },
+    { 0x00003ffffff80000ULL, 0x1b5a }, { 0x00003ffffffc0000ULL, 0x1b9b },
+    { 0x00003ffffffe0000ULL, 0x1bdc }, { 0x00003fffffff0000ULL, 0x1c1d },
+    { 0x00003fffffff8000ULL, 0x1c5e }, { 0x00003fffffffc000ULL, 0x1c9f },
+    { 0x00003fffffffe000ULL, 0x1ce0 }, { 0x00003ffffffff000ULL, 0x1d21 },
+    { 0x00003ffffffff800ULL, 0x1d62 }, { 0x00003ffffffffc00ULL, 0x1da3 },
+    { 0x00003ffffffffe00ULL, 0x1de4 }, { 0x00003fffffffff00ULL, 0x1e25 },
+    { 0x00003fffffffff80ULL, 0x1e66 }, { 0x00003fffffffffc0ULL, 0x1ea7 },
+    { 0x00003fffffffffe0ULL, 0x1ee8 }, { 0x00003ffffffffff0ULL, 0x1f29 },
+    { 0x00003ffffffffff8ULL, 0x1f6a }, { 0x00003ffffffffffcULL, 0x1fab },
+    { 0x00003ffffffffffeULL, 0x1fec }, { 0x00003fffffffffffULL, 0x102d },
+    { 0x0000400000000000ULL, 0x1480 }, { 0x0000400000004000ULL, 0x0480 },
+    { 0x0000600000000000ULL, 0x14c1 }, { 0x0000600000006000ULL, 0x04c1 },
+    { 0x0000700000000000ULL, 0x1502 }, { 0x0000700000007000ULL, 0x0502 },
+    { 0x0000780000000000ULL, 0x1543 }, { 0x0000780000007800ULL, 0x0543 },
+    { 0x00007c0000000000ULL, 0x1584 }, { 0x00007c0000007c00ULL, 0x0584 },
+    { 0x00007e0000000000ULL, 0x15c5 }, { 0x00007e0000007e00ULL, 0x05c5 },
+    { 0x00007f0000000000ULL, 0x1606 }, { 0x00007f0000007f00ULL, 0x0606 },
+    { 0x00007f8000000000ULL, 0x1647 }, { 0x00007f8000007f80ULL, 0x0647 },
+    { 0x00007fc000000000ULL, 0x1688 }, { 0x00007fc000007fc0ULL, 0x0688 },
+    { 0x00007fe000000000ULL, 0x16c9 }, { 0x00007fe000007fe0ULL, 0x06c9 },
+    { 0x00007ff000000000ULL, 0x170a }, { 0x00007ff000007ff0ULL, 0x070a },
+    { 0x00007ff800000000ULL, 0x174b }, { 0x00007ff800007ff8ULL, 0x074b },
+    { 0x00007ffc00000000ULL, 0x178c }, { 0x00007ffc00007ffcULL, 0x078c },
+    { 0x00007ffe00000000ULL, 0x17cd }, { 0x00007ffe00007ffeULL, 0x07cd },
+    { 0x00007fff00000000ULL, 0x180e }, { 0x00007fff00007fffULL, 0x000e },
+    { 0x00007fff80000000ULL, 0x184f }, { 0x00007fffc0000000ULL, 0x1890 },
+    { 0x00007fffe0000000ULL, 0x18d1 }, { 0x00007ffff0000000ULL, 0x1912 },
+    { 0x00007ffff8000000ULL, 0x1953 }, { 0x00007ffffc000000ULL, 0x1994 },
+    { 0x00007ffffe000000ULL, 0x19d5 }, { 0x00007fffff000000ULL, 0x1a16 },
+    { 0x00007fffff800000ULL, 0x1a57 }, { 0x00007fffffc00000ULL, 0x1a98 },
+    { 0x00007fffffe00000ULL, 0x1ad9 }, { 0x00007ffffff00000ULL, 0x1b1a },
+    { 0x00007ffffff80000ULL, 0x1b5b }, { 0x00007ffffffc0000ULL, 0x1b9c },
+    { 0x00007ffffffe0000ULL, 0x1bdd }, { 0x00007fffffff0000ULL, 0x1c1e },
+    { 0x00007fffffff8000ULL, 0x1c5f }, { 0x00007fffffffc000ULL, 0x1ca0 },
+    { 0x00007fffffffe000ULL, 0x1ce1 }, { 0x00007ffffffff000ULL, 0x1d22 },
+    { 0x00007ffffffff800ULL, 0x1d63 }, { 0x00007ffffffffc00ULL, 0x1da4 },
+    { 0x00007ffffffffe00ULL, 0x1de5 }, { 0x00007fffffffff00ULL, 0x1e26 },
+    { 0x00007fffffffff80ULL, 0x1e67 }, { 0x00007fffffffffc0ULL, 0x1ea8 },
+    { 0x00007fffffffffe0ULL, 0x1ee9 }, { 0x00007ffffffffff0ULL, 0x1f2a },
+    { 0x00007ffffffffff8ULL, 0x1f6b }, { 0x00007ffffffffffcULL, 0x1fac },
+    { 0x00007ffffffffffeULL, 0x1fed }, { 0x00007fffffffffffULL, 0x102e },
+    { 0x0000800000000000ULL, 0x1440 }, { 0x0000800000008000ULL, 0x0440 },
+    { 0x0000c00000000000ULL, 0x1481 }, { 0x0000c0000000c000ULL, 0x0481 },
+    { 0x0000e00000000000ULL, 0x14c2 }, { 0x0000e0000000e000ULL, 0x04c2 },
+    { 0x0000f00000000000ULL, 0x1503 }, { 0x0000f0000000f000ULL, 0x0503 },
+    { 0x0000f80000000000ULL, 0x1544 }, { 0x0000f8000000f800ULL, 0x0544 },
+    { 0x0000fc0000000000ULL, 0x1585 }, { 0x0000fc000000fc00ULL, 0x0585 },
+    { 0x0000fe0000000000ULL, 0x15c6 }, { 0x0000fe000000fe00ULL, 0x05c6 },
+    { 0x0000ff0000000000ULL, 0x1607 }, { 0x0000ff000000ff00ULL, 0x0607 },
+    { 0x0000ff8000000000ULL, 0x1648 }, { 0x0000ff800000ff80ULL, 0x0648 },
+    { 0x0000ffc000000000ULL, 0x1689 }, { 0x0000ffc00000ffc0ULL, 0x0689 },
+    { 0x0000ffe000000000ULL, 0x16ca }, { 0x0000ffe00000ffe0ULL, 0x06ca },
+    { 0x0000fff000000000ULL, 0x170b }, { 0x0000fff00000fff0ULL, 0x070b },
+    { 0x0000fff800000000ULL, 0x174c }, { 0x0000fff80000fff8ULL, 0x074c },
+    { 0x0000fffc00000000ULL, 0x178d }, { 0x0000fffc0000fffcULL, 0x078d },
+    { 0x0000fffe00000000ULL, 0x17ce }, { 0x0000fffe0000fffeULL, 0x07ce },
+    { 0x0000ffff00000000ULL, 0x180f }, { 0x0000ffff0000ffffULL, 0x000f },
+    { 0x0000ffff80000000ULL, 0x1850 }, { 0x0000ffffc0000000ULL, 0x1891 },
+    { 0x0000ffffe0000000ULL, 0x18d2 }, { 0x0000fffff0000000ULL, 0x1913 },
+    { 0x0000fffff8000000ULL, 0x1954 }, { 0x0000fffffc000000ULL, 0x1995 },
+    { 0x0000fffffe000000ULL, 0x19d6 }, { 0x0000ffffff000000ULL, 0x1a17 },
+    { 0x0000ffffff800000ULL, 0x1a58 }, { 0x0000ffffffc00000ULL, 0x1a99 },
+    { 0x0000ffffffe00000ULL, 0x1ada }, { 0x0000fffffff00000ULL, 0x1b1b },
+    { 0x0000fffffff80000ULL, 0x1b5c }, { 0x0000fffffffc0000ULL, 0x1b9d },
+    { 0x0000fffffffe0000ULL, 0x1bde }, { 0x0000ffffffff0000ULL, 0x1c1f },
+    { 0x0000ffffffff8000ULL, 0x1c60 }, { 0x0000ffffffffc000ULL, 0x1ca1 },
+    { 0x0000ffffffffe000ULL, 0x1ce2 }, { 0x0000fffffffff000ULL, 0x1d23 },
+    { 0x0000fffffffff800ULL, 0x1d64 }, { 0x0000fffffffffc00ULL, 0x1da5 },
+    { 0x0000fffffffffe00ULL, 0x1de6 }, { 0x0000ffffffffff00ULL, 0x1e27 },
+    { 0x0000ffffffffff80ULL, 0x1e68 }, { 0x0000ffffffffffc0ULL, 0x1ea9 },
+    { 0x0000ffffffffffe0ULL, 0x1eea }, { 0x0000fffffffffff0ULL, 0x1f2b },
+    { 0x0000fffffffffff8ULL, 0x1f6c }, { 0x0000fffffffffffcULL, 0x1fad },
+    { 0x0000fffffffffffeULL, 0x1fee }, { 0x0000ffffffffffffULL, 0x102f },
+    { 0x0001000000000000ULL, 0x1400 }, { 0x0001000000010000ULL, 0x0400 },
+    { 0x0001000100010001ULL, 0x0020 }, { 0x0001800000000000ULL, 0x1441 },
+    { 0x0001800000018000ULL, 0x0441 }, { 0x0001c00000000000ULL, 0x1482 },
+    { 0x0001c0000001c000ULL, 0x0482 }, { 0x0001e00000000000ULL, 0x14c3 },
+    { 0x0001e0000001e000ULL, 0x04c3 }, { 0x0001f00000000000ULL, 0x1504 },
+    { 0x0001f0000001f000ULL, 0x0504 }, { 0x0001f80000000000ULL, 0x1545 },
+    { 0x0001f8000001f800ULL, 0x0545 }, { 0x0001fc0000000000ULL, 0x1586 },
+    { 0x0001fc000001fc00ULL, 0x0586 }, { 0x0001fe0000000000ULL, 0x15c7 },
+    { 0x0001fe000001fe00ULL, 0x05c7 }, { 0x0001ff0000000000ULL, 0x1608 },
+    { 0x0001ff000001ff00ULL, 0x0608 }, { 0x0001ff8000000000ULL, 0x1649 },
+    { 0x0001ff800001ff80ULL, 0x0649 }, { 0x0001ffc000000000ULL, 0x168a },
+    { 0x0001ffc00001ffc0ULL, 0x068a }, { 0x0001ffe000000000ULL, 0x16cb },
+    { 0x0001ffe00001ffe0ULL, 0x06cb }, { 0x0001fff000000000ULL, 0x170c },
+    { 0x0001fff00001fff0ULL, 0x070c }, { 0x0001fff800000000ULL, 0x174d },
+    { 0x0001fff80001fff8ULL, 0x074d }, { 0x0001fffc00000000ULL, 0x178e },
+    { 0x0001fffc0001fffcULL, 0x078e }, { 0x0001fffe00000000ULL, 0x17cf },
+    { 0x0001fffe0001fffeULL, 0x07cf }, { 0x0001ffff00000000ULL, 0x1810 },
+    { 0x0001ffff0001ffffULL, 0x0010 }, { 0x0001ffff80000000ULL, 0x1851 },
+    { 0x0001ffffc0000000ULL, 0x1892 }, { 0x0001ffffe0000000ULL, 0x18d3 },
+    { 0x0001fffff0000000ULL, 0x1914 }, { 0x0001fffff8000000ULL, 0x1955 },
+    { 0x0001fffffc000000ULL, 0x1996 }, { 0x0001fffffe000000ULL, 0x19d7 },
+    { 0x0001ffffff000000ULL, 0x1a18 }, { 0x0001ffffff800000ULL, 0x1a59 },
+    { 0x0001ffffffc00000ULL, 0x1a9a }, { 0x0001ffffffe00000ULL, 0x1adb },
+    { 0x0001fffffff00000ULL, 0x1b1c }, { 0x0001fffffff80000ULL, 0x1b5d },
+    { 0x0001fffffffc0000ULL, 0x1b9e }, { 0x0001fffffffe0000ULL, 0x1bdf },
+    { 0x0001ffffffff0000ULL, 0x1c20 }, { 0x0001ffffffff8000ULL, 0x1c61 },
+    { 0x0001ffffffffc000ULL, 0x1ca2 }, { 0x0001ffffffffe000ULL, 0x1ce3 },
+    { 0x0001fffffffff000ULL, 0x1d24 }, { 0x0001fffffffff800ULL, 0x1d65 },
+    { 0x0001fffffffffc00ULL, 0x1da6 }, { 0x0001fffffffffe00ULL, 0x1de7 },
+    { 0x0001ffffffffff00ULL, 0x1e28 }, { 0x0001ffffffffff80ULL, 0x1e69 },
+    { 0x0001ffffffffffc0ULL, 0x1eaa }, { 0x0001ffffffffffe0ULL, 0x1eeb },
+    { 0x0001fffffffffff0ULL, 0x1f2c }, { 0x0001fffffffffff8ULL, 0x1f6d },
+    { 0x0001fffffffffffcULL, 0x1fae }, { 0x0001fffffffffffeULL, 0x1fef },
+    { 0x0001ffffffffffffULL, 0x1030 }, { 0x0002000000000000ULL, 0x13c0 },
+    { 0x0002000000020000ULL, 0x03c0 }, { 0x0002000200020002ULL, 0x03e0 },
+    { 0x0003000000000000ULL, 0x1401 }, { 0x0003000000030000ULL, 0x0401 },
+    { 0x0003000300030003ULL, 0x0021 }, { 0x0003800000000000ULL, 0x1442 },
+    { 0x0003800000038000ULL, 0x0442 }, { 0x0003c00000000000ULL, 0x1483 },
+    { 0x0003c0000003c000ULL, 0x0483 }, { 0x0003e00000000000ULL, 0x14c4 },
+    { 0x0003e0000003e000ULL, 0x04c4 }, { 0x0003f00000000000ULL, 0x1505 },
+    { 0x0003f0000003f000ULL, 0x0505 }, { 0x0003f80000000000ULL, 0x1546 },
+    { 0x0003f8000003f800ULL, 0x0546 }, { 0x0003fc0000000000ULL, 0x1587 },
+    { 0x0003fc000003fc00ULL, 0x0587 }, { 0x0003fe0000000000ULL, 0x15c8 },
+    { 0x0003fe000003fe00ULL, 0x05c8 }, { 0x0003ff0000000000ULL, 0x1609 },
+    { 0x0003ff000003ff00ULL, 0x0609 }, { 0x0003ff8000000000ULL, 0x164a },
+    { 0x0003ff800003ff80ULL, 0x064a }, { 0x0003ffc000000000ULL, 0x168b },
+    { 0x0003ffc00003ffc0ULL, 0x068b }, { 0x0003ffe000000000ULL, 0x16cc },
+    { 0x0003ffe00003ffe0ULL, 0x06cc }, { 0x0003fff000000000ULL, 0x170d },
+    { 0x0003fff00003fff0ULL, 0x070d }, { 0x0003fff800000000ULL, 0x174e },
+    { 0x0003fff80003fff8ULL, 0x074e }, { 0x0003fffc00000000ULL, 0x178f },
+    { 0x0003fffc0003fffcULL, 0x078f }, { 0x0003fffe00000000ULL, 0x17d0 },
+    { 0x0003fffe0003fffeULL, 0x07d0 }, { 0x0003ffff00000000ULL, 0x1811 },
+    { 0x0003ffff0003ffffULL, 0x0011 }, { 0x0003ffff80000000ULL, 0x1852 },
+    { 0x0003ffffc0000000ULL, 0x1893 }, { 0x0003ffffe0000000ULL, 0x18d4 },
+    { 0x0003fffff0000000ULL, 0x1915 }, { 0x0003fffff8000000ULL, 0x1956 },
+    { 0x0003fffffc000000ULL, 0x1997 }, { 0x0003fffffe000000ULL, 0x19d8 },
+    { 0x0003ffffff000000ULL, 0x1a19 }, { 0x0003ffffff800000ULL, 0x1a5a },
+    { 0x0003ffffffc00000ULL, 0x1a9b }, { 0x0003ffffffe00000ULL, 0x1adc },
+    { 0x0003fffffff00000ULL, 0x1b1d }, { 0x0003fffffff80000ULL, 0x1b5e },
+    { 0x0003fffffffc0000ULL, 0x1b9f }, { 0x0003fffffffe0000ULL, 0x1be0 },
+    { 0x0003ffffffff0000ULL, 0x1c21 }, { 0x0003ffffffff8000ULL, 0x1c62 },
+    { 0x0003ffffffffc000ULL, 0x1ca3 }, { 0x0003ffffffffe000ULL, 0x1ce4 },
+    { 0x0003fffffffff000ULL, 0x1d25 }, { 0x0003fffffffff800ULL, 0x1d66 },
+    { 0x0003fffffffffc00ULL, 0x1da7 }, { 0x0003fffffffffe00ULL, 0x1de8 },
+    { 0x0003ffffffffff00ULL, 0x1e29 }, { 0x0003ffffffffff80ULL, 0x1e6a },
+    { 0x0003ffffffffffc0ULL, 0x1eab }, { 0x0003ffffffffffe0ULL, 0x1eec },
+    { 0x0003fffffffffff0ULL, 0x1f2d }, { 0x0003fffffffffff8ULL, 0x1f6e },
+    { 0x0003fffffffffffcULL, 0x1faf }, { 0x0003fffffffffffeULL, 0x1ff0 },
+    { 0x0003ffffffffffffULL, 0x1031 }, { 0x0004000000000000ULL, 0x1380 },
+    { 0x0004000000040000ULL, 0x0380 }, { 0x0004000400040004ULL, 0x03a0 },
+    { 0x0006000000000000ULL, 0x13c1 }, { 0x0006000000060000ULL, 0x03c1 },
+    { 0x0006000600060006ULL, 0x03e1 }, { 0x0007000000000000ULL, 0x1402 },
+    { 0x0007000000070000ULL, 0x0402 }, { 0x0007000700070007ULL, 0x0022 },
+    { 0x0007800000000000ULL, 0x1443 }, { 0x0007800000078000ULL, 0x0443 },
+    { 0x0007c00000000000ULL, 0x1484 }, { 0x0007c0000007c000ULL, 0x0484 },
+    { 0x0007e00000000000ULL, 0x14c5 }, { 0x0007e0000007e000ULL, 0x04c5 },
+    { 0x0007f00000000000ULL, 0x1506 }, { 0x0007f0000007f000ULL, 0x0506 },
+    { 0x0007f80000000000ULL, 0x1547 }, { 0x0007f8000007f800ULL, 0x0547 },
+    { 0x0007fc0000000000ULL, 0x1588 }, { 0x0007fc000007fc00ULL, 0x0588 },
+    { 0x0007fe0000000000ULL, 0x15c9 }, { 0x0007fe000007fe00ULL, 0x05c9 },
+    { 0x0007ff0000000000ULL, 0x160a }, { 0x0007ff000007ff00ULL, 0x060a },
+    { 0x0007ff8000000000ULL, 0x164b }, { 0x0007ff800007ff80ULL, 0x064b },
+    { 0x0007ffc000000000ULL, 0x168c }, { 0x0007ffc00007ffc0ULL, 0x068c },
+    { 0x0007ffe000000000ULL, 0x16cd }, { 0x0007ffe00007ffe0ULL, 0x06cd },
+    { 0x0007fff000000000ULL, 0x170e }, { 0x0007fff00007fff0ULL, 0x070e },
+    { 0x0007fff800000000ULL, 0x174f }, { 0x0007fff80007fff8ULL, 0x074f },
+    { 0x0007fffc00000000ULL, 0x1790 }, { 0x0007fffc0007fffcULL, 0x0790 },
+    { 0x0007fffe00000000ULL, 0x17d1 }, { 0x0007fffe0007fffeULL, 0x07d1 },
+    { 0x0007ffff00000000ULL, 0x1812 }, { 0x0007ffff0007ffffULL, 0x0012 },
+    { 0x0007ffff80000000ULL, 0x1853 }, { 0x0007ffffc0000000ULL, 0x1894 },
+    { 0x0007ffffe0000000ULL, 0x18d5 }, { 0x0007fffff0000000ULL, 0x1916 },
+    { 0x0007fffff8000000ULL, 0x1957 }, { 0x0007fffffc000000ULL, 0x1998 },
+    { 0x0007fffffe000000ULL, 0x19d9 }, { 0x0007ffffff000000ULL, 0x1a1a },
+    { 0x0007ffffff800000ULL, 0x1a5b }, { 0x0007ffffffc00000ULL, 0x1a9c },
+    { 0x0007ffffffe00000ULL, 0x1add }, { 0x0007fffffff00000ULL, 0x1b1e },
+    { 0x0007fffffff80000ULL, 0x1b5f }, { 0x0007fffffffc0000ULL, 0x1ba0 },
+    { 0x0007fffffffe0000ULL, 0x1be1 }, { 0x0007ffffffff0000ULL, 0x1c22 },
+    { 0x0007ffffffff8000ULL, 0x1c63 }, { 0x0007ffffffffc000ULL, 0x1ca4 },
+    { 0x0007ffffffffe000ULL, 0x1ce5 }, { 0x0007fffffffff000ULL, 0x1d26 },
+    { 0x0007fffffffff800ULL, 0x1d67 }, { 0x0007fffffffffc00ULL, 0x1da8 },
+    { 0x0007fffffffffe00ULL, 0x1de9 }, { 0x0007ffffffffff00ULL, 0x1e2a },
+    { 0x0007ffffffffff80ULL, 0x1e6b }, { 0x0007ffffffffffc0ULL, 0x1eac },
+    { 0x0007ffffffffffe0ULL, 0x1eed }, { 0x0007fffffffffff0ULL, 0x1f2e },
+    { 0x0007fffffffffff8ULL, 0x1f6f }, { 0x0007fffffffffffcULL, 0x1fb0 },
+    { 0x0007fffffffffffeULL, 0x1ff1 }, { 0x0007ffffffffffffULL, 0x1032 },
+    { 0x0008000000000000ULL, 0x1340 }, { 0x0008000000080000ULL, 0x0340 },
+    { 0x0008000800080008ULL, 0x0360 }, { 0x000c000000000000ULL, 0x1381 },
+    { 0x000c0000000c0000ULL, 0x0381 }, { 0x000c000c000c000cULL, 0x03a1 },
+    { 0x000e000000000000ULL, 0x13c2 }, { 0x000e0000000e0000ULL, 0x03c2 },
+    { 0x000e000e000e000eULL, 0x03e2 }, { 0x000f000000000000ULL, 0x1403 },
+    { 0x000f0000000f0000ULL, 0x0403 }, { 0x000f000f000f000fULL, 0x0023 },
+    { 0x000f800000000000ULL, 0x1444 }, { 0x000f8000000f8000ULL, 0x0444 },
+    { 0x000fc00000000000ULL, 0x1485 }, { 0x000fc000000fc000ULL, 0x0485 },
+    { 0x000fe00000000000ULL, 0x14c6 }, { 0x000fe000000fe000ULL, 0x04c6 },
+    { 0x000ff00000000000ULL, 0x1507 }, { 0x000ff000000ff000ULL, 0x0507 },
+    { 0x000ff80000000000ULL, 0x1548 }, { 0x000ff800000ff800ULL, 0x0548 },
+    { 0x000ffc0000000000ULL, 0x1589 }, { 0x000ffc00000ffc00ULL, 0x0589 },
+    { 0x000ffe0000000000ULL, 0x15ca }, { 0x000ffe00000ffe00ULL, 0x05ca },
+    { 0x000fff0000000000ULL, 0x160b }, { 0x000fff00000fff00ULL, 0x060b },
+    { 0x000fff8000000000ULL, 0x164c }, { 0x000fff80000fff80ULL, 0x064c },
+    { 0x000fffc000000000ULL, 0x168d }, { 0x000fffc0000fffc0ULL, 0x068d },
+    { 0x000fffe000000000ULL, 0x16ce }, { 0x000fffe0000fffe0ULL, 0x06ce },
+    { 0x000ffff000000000ULL, 0x170f }, { 0x000ffff0000ffff0ULL, 0x070f },
+    { 0x000ffff800000000ULL, 0x1750 }, { 0x000ffff8000ffff8ULL, 0x0750 },
+    { 0x000ffffc00000000ULL, 0x1791 }, { 0x000ffffc000ffffcULL, 0x0791 },
+    { 0x000ffffe00000000ULL, 0x17d2 }, { 0x000ffffe000ffffeULL, 0x07d2 },
+    { 0x000fffff00000000ULL, 0x1813 }, { 0x000fffff000fffffULL, 0x0013 },
+    { 0x000fffff80000000ULL, 0x1854 }, { 0x000fffffc0000000ULL, 0x1895 },
+    { 0x000fffffe0000000ULL, 0x18d6 }, { 0x000ffffff0000000ULL, 0x1917 },
+    { 0x000ffffff8000000ULL, 0x1958 }, { 0x000ffffffc000000ULL, 0x1999 },
+    { 0x000ffffffe000000ULL, 0x19da }, { 0x000fffffff000000ULL, 0x1a1b },
+    { 0x000fffffff800000ULL, 0x1a5c }, { 0x000fffffffc00000ULL, 0x1a9d },
+    { 0x000fffffffe00000ULL, 0x1ade }, { 0x000ffffffff00000ULL, 0x1b1f },
+    { 0x000ffffffff80000ULL, 0x1b60 }, { 0x000ffffffffc0000ULL, 0x1ba1 },
+    { 0x000ffffffffe0000ULL, 0x1be2 }, { 0x000fffffffff0000ULL, 0x1c23 },
+    { 0x000fffffffff8000ULL, 0x1c64 }, { 0x000fffffffffc000ULL, 0x1ca5 },
+    { 0x000fffffffffe000ULL, 0x1ce6 }, { 0x000ffffffffff000ULL, 0x1d27 },
+    { 0x000ffffffffff800ULL, 0x1d68 }, { 0x000ffffffffffc00ULL, 0x1da9 },
+    { 0x000ffffffffffe00ULL, 0x1dea }, { 0x000fffffffffff00ULL, 0x1e2b },
+    { 0x000fffffffffff80ULL, 0x1e6c }, { 0x000fffffffffffc0ULL, 0x1ead },
+    { 0x000fffffffffffe0ULL, 0x1eee }, { 0x000ffffffffffff0ULL, 0x1f2f },
+    { 0x000ffffffffffff8ULL, 0x1f70 }, { 0x000ffffffffffffcULL, 0x1fb1 },
+    { 0x000ffffffffffffeULL, 0x1ff2 }, { 0x000fffffffffffffULL, 0x1033 },
+    { 0x0010000000000000ULL, 0x1300 }, { 0x0010000000100000ULL, 0x0300 },
+    { 0x0010001000100010ULL, 0x0320 }, { 0x0018000000000000ULL, 0x1341 },
+    { 0x0018000000180000ULL, 0x0341 }, { 0x0018001800180018ULL, 0x0361 },
+    { 0x001c000000000000ULL, 0x1382 }, { 0x001c0000001c0000ULL, 0x0382 },
+    { 0x001c001c001c001cULL, 0x03a2 }, { 0x001e000000000000ULL, 0x13c3 },
+    { 0x001e0000001e0000ULL, 0x03c3 }, { 0x001e001e001e001eULL, 0x03e3 },
+    { 0x001f000000000000ULL, 0x1404 }, { 0x001f0000001f0000ULL, 0x0404 },
+    { 0x001f001f001f001fULL, 0x0024 }, { 0x001f800000000000ULL, 0x1445 },
+    { 0x001f8000001f8000ULL, 0x0445 }, { 0x001fc00000000000ULL, 0x1486 },
+    { 0x001fc000001fc000ULL, 0x0486 }, { 0x001fe00000000000ULL, 0x14c7 },
+    { 0x001fe000001fe000ULL, 0x04c7 }, { 0x001ff00000000000ULL, 0x1508 },
+    { 0x001ff000001ff000ULL, 0x0508 }, { 0x001ff80000000000ULL, 0x1549 },
+    { 0x001ff800001ff800ULL, 0x0549 }, { 0x001ffc0000000000ULL, 0x158a },
+    { 0x001ffc00001ffc00ULL, 0x058a }, { 0x001ffe0000000000ULL, 0x15cb },
+    { 0x001ffe00001ffe00ULL, 0x05cb }, { 0x001fff0000000000ULL, 0x160c },
+    { 0x001fff00001fff00ULL, 0x060c }, { 0x001fff8000000000ULL, 0x164d },
+    { 0x001fff80001fff80ULL, 0x064d }, { 0x001fffc000000000ULL, 0x168e },
+    { 0x001fffc0001fffc0ULL, 0x068e }, { 0x001fffe000000000ULL, 0x16cf },
+    { 0x001fffe0001fffe0ULL, 0x06cf }, { 0x001ffff000000000ULL, 0x1710 },
+    { 0x001ffff0001ffff0ULL, 0x0710 }, { 0x001ffff800000000ULL, 0x1751 },
+    { 0x001ffff8001ffff8ULL, 0x0751 }, { 0x001ffffc00000000ULL, 0x1792 },
+    { 0x001ffffc001ffffcULL, 0x0792 }, { 0x001ffffe00000000ULL, 0x17d3 },
+    { 0x001ffffe001ffffeULL, 0x07d3 }, { 0x001fffff00000000ULL, 0x1814 },
+    { 0x001fffff001fffffULL, 0x0014 }, { 0x001fffff80000000ULL, 0x1855 },
+    { 0x001fffffc0000000ULL, 0x1896 }, { 0x001fffffe0000000ULL, 0x18d7 },
+    { 0x001ffffff0000000ULL, 0x1918 }, { 0x001ffffff8000000ULL, 0x1959 },
+    { 0x001ffffffc000000ULL, 0x199a }, { 0x001ffffffe000000ULL, 0x19db },
+    { 0x001fffffff000000ULL, 0x1a1c }, { 0x001fffffff800000ULL, 0x1a5d },
+    { 0x001fffffffc00000ULL, 0x1a9e }, { 0x001fffffffe00000ULL, 0x1adf },
+    { 0x001ffffffff00000ULL, 0x1b20 }, { 0x001ffffffff80000ULL, 0x1b61 },
+    { 0x001ffffffffc0000ULL, 0x1ba2 }, { 0x001ffffffffe0000ULL, 0x1be3 },
+    { 0x001fffffffff0000ULL, 0x1c24 }, { 0x001fffffffff8000ULL, 0x1c65 },
+    { 0x001fffffffffc000ULL, 0x1ca6 }, { 0x001fffffffffe000ULL, 0x1ce7 },
+    { 0x001ffffffffff000ULL, 0x1d28 }, { 0x001ffffffffff800ULL, 0x1d69 },
+    { 0x001ffffffffffc00ULL, 0x1daa }, { 0x001ffffffffffe00ULL, 0x1deb },
+    { 0x001fffffffffff00ULL, 0x1e2c }, { 0x001fffffffffff80ULL, 0x1e6d },
+    { 0x001fffffffffffc0ULL, 0x1eae }, { 0x001fffffffffffe0ULL, 0x1eef },
+    { 0x001ffffffffffff0ULL, 0x1f30 }, { 0x001ffffffffffff8ULL, 0x1f71 },
+    { 0x001ffffffffffffcULL, 0x1fb2 }, { 0x001ffffffffffffeULL, 0x1ff3 },
+    { 0x001fffffffffffffULL, 0x1034 }, { 0x0020000000000000ULL, 0x12c0 },
+    { 0x0020000000200000ULL, 0x02c0 }, { 0x0020002000200020ULL, 0x02e0 },
+    { 0x0030000000000000ULL, 0x1301 }, { 0x0030000000300000ULL, 0x0301 },
+    { 0x0030003000300030ULL, 0x0321 }, { 0x0038000000000000ULL, 0x1342 },
+    { 0x0038000000380000ULL, 0x0342 }, { 0x0038003800380038ULL, 0x0362 },
+    { 0x003c000000000000ULL, 0x1383 }, { 0x003c0000003c0000ULL, 0x0383 },
+    { 0x003c003c003c003cULL, 0x03a3 }, { 0x003e000000000000ULL, 0x13c4 },
+    { 0x003e0000003e0000ULL, 0x03c4 }, { 0x003e003e003e003eULL, 0x03e4 },
+    { 0x003f000000000000ULL, 0x1405 }, { 0x003f0000003f0000ULL, 0x0405 },
+    { 0x003f003f003f003fULL, 0x0025 }, { 0x003f800000000000ULL, 0x1446 },
+    { 0x003f8000003f8000ULL, 0x0446 }, { 0x003fc00000000000ULL, 0x1487 },
+    { 0x003fc000003fc000ULL, 0x0487 }, { 0x003fe00000000000ULL, 0x14c8 },
+    { 0x003fe000003fe000ULL, 0x04c8 }, { 0x003ff00000000000ULL, 0x1509 },
+    { 0x003ff000003ff000ULL, 0x0509 }, { 0x003ff80000000000ULL, 0x154a },
+    { 0x003ff800003ff800ULL, 0x054a }, { 0x003ffc0000000000ULL, 0x158b },
+    { 0x003ffc00003ffc00ULL, 0x058b }, { 0x003ffe0000000000ULL, 0x15cc },
+    { 0x003ffe00003ffe00ULL, 0x05cc }, { 0x003fff0000000000ULL, 0x160d },
+    { 0x003fff00003fff00ULL, 0x060d }, { 0x003fff8000000000ULL, 0x164e },
+    { 0x003fff80003fff80ULL, 0x064e }, { 0x003fffc000000000ULL, 0x168f },
+    { 0x003fffc0003fffc0ULL, 0x068f }, { 0x003fffe000000000ULL, 0x16d0 },
+    { 0x003fffe0003fffe0ULL, 0x06d0 }, { 0x003ffff000000000ULL, 0x1711 },
+    { 0x003ffff0003ffff0ULL, 0x0711 }, { 0x003ffff800000000ULL, 0x1752 },
+    { 0x003ffff8003ffff8ULL, 0x0752 }, { 0x003ffffc00000000ULL, 0x1793 },
+    { 0x003ffffc003ffffcULL, 0x0793 }, { 0x003ffffe00000000ULL, 0x17d4 },
+    { 0x003ffffe003ffffeULL, 0x07d4 }, { 0x003fffff00000000ULL, 0x1815 },
+    { 0x003fffff003fffffULL, 0x0015 }, { 0x003fffff80000000ULL, 0x1856 },
+    { 0x003fffffc0000000ULL, 0x1897 }, { 0x003fffffe0000000ULL, 0x18d8 },
+    { 0x003ffffff0000000ULL, 0x1919 }, { 0x003ffffff8000000ULL, 0x195a },
+    { 0x003ffffffc000000ULL, 0x199b }, { 0x003ffffffe000000ULL, 0x19dc },
+    { 0x003fffffff000000ULL, 0x1a1d }, { 0x003fffffff800000ULL, 0x1a5e },
+    { 0x003fffffffc00000ULL, 0x1a9f }, { 0x003fffffffe00000ULL, 0x1ae0 },
+    { 0x003ffffffff00000ULL, 0x1b21 }, { 0x003ffffffff80000ULL, 0x1b62 },
+    { 0x003ffffffffc0000ULL, 0x1ba3 }, { 0x003ffffffffe0000ULL, 0x1be4 },
+    { 0x003fffffffff0000ULL, 0x1c25 }, { 0x003fffffffff8000ULL, 0x1c66 },
+    { 0x003fffffffffc000ULL, 0x1ca7 }, { 0x003fffffffffe000ULL, 0x1ce8 },
+    { 0x003ffffffffff000ULL, 0x1d29 }, { 0x003ffffffffff800ULL, 0x1d6a },
+    { 0x003ffffffffffc00ULL, 0x1dab }, { 0x003ffffffffffe00ULL, 0x1dec },
+    { 0x003fffffffffff00ULL, 0x1e2d }, { 0x003fffffffffff80ULL, 0x1e6e },
+    { 0x003fffffffffffc0ULL, 0x1eaf }, { 0x003fffffffffffe0ULL, 0x1ef0 },
+    { 0x003ffffffffffff0ULL, 0x1f31 }, { 0x003ffffffffffff8ULL, 0x1f72 },
+    { 0x003ffffffffffffcULL, 0x1fb3 }, { 0x003ffffffffffffeULL, 0x1ff4 },
+    { 0x003fffffffffffffULL, 0x1035 }, { 0x0040000000000000ULL, 0x1280 },
+    { 0x0040000000400000ULL, 0x0280 }, { 0x0040004000400040ULL, 0x02a0 },
+    { 0x0060000000000000ULL, 0x12c1 }, { 0x0060000000600000ULL, 0x02c1 },
+    { 0x0060006000600060ULL, 0x02e1 }, { 0x0070000000000000ULL, 0x1302 },
+    { 0x0070000000700000ULL, 0x0302 }, { 0x0070007000700070ULL, 0x0322 },
+    { 0x0078000000000000ULL, 0x1343 }, { 0x0078000000780000ULL, 0x0343 },
+    { 0x0078007800780078ULL, 0x0363 }, { 0x007c000000000000ULL, 0x1384 },
+    { 0x007c0000007c0000ULL, 0x0384 }, { 0x007c007c007c007cULL, 0x03a4 },
+    { 0x007e000000000000ULL, 0x13c5 }, { 0x007e0000007e0000ULL, 0x03c5 },
+    { 0x007e007e007e007eULL, 0x03e5 }, { 0x007f000000000000ULL, 0x1406 },
+    { 0x007f0000007f0000ULL, 0x0406 }, { 0x007f007f007f007fULL, 0x0026 },
+    { 0x007f800000000000ULL, 0x1447 }, { 0x007f8000007f8000ULL, 0x0447 },
+    { 0x007fc00000000000ULL, 0x1488 }, { 0x007fc000007fc000ULL, 0x0488 },
+    { 0x007fe00000000000ULL, 0x14c9 }, { 0x007fe000007fe000ULL, 0x04c9 },
+    { 0x007ff00000000000ULL, 0x150a }, { 0x007ff000007ff000ULL, 0x050a },
+    { 0x007ff80000000000ULL, 0x154b }, { 0x007ff800007ff800ULL, 0x054b },
+    { 0x007ffc0000000000ULL, 0x158c }, { 0x007ffc00007ffc00ULL, 0x058c },
+    { 0x007ffe0000000000ULL, 0x15cd }, { 0x007ffe00007ffe00ULL, 0x05cd },
+    { 0x007fff0000000000ULL, 0x160e }, { 0x007fff00007fff00ULL, 0x060e },
+    { 0x007fff8000000000ULL, 0x164f }, { 0x007fff80007fff80ULL, 0x064f },
+    { 0x007fffc000000000ULL, 0x1690 }, { 0x007fffc0007fffc0ULL, 0x0690 },
+    { 0x007fffe000000000ULL, 0x16d1 }, { 0x007fffe0007fffe0ULL, 0x06d1 },
+    { 0x007ffff000000000ULL, 0x1712 }, { 0x007ffff0007ffff0ULL, 0x0712 },
+    { 0x007ffff800000000ULL, 0x1753 }, { 0x007ffff8007ffff8ULL, 0x0753 },
+    { 0x007ffffc00000000ULL, 0x1794 }, { 0x007ffffc007ffffcULL, 0x0794 },
+    { 0x007ffffe00000000ULL, 0x17d5 }, { 0x007ffffe007ffffeULL, 0x07d5 },
+    { 0x007fffff00000000ULL, 0x1816 }, { 0x007fffff007fffffULL, 0x0016 },
+    { 0x007fffff80000000ULL, 0x1857 }, { 0x007fffffc0000000ULL, 0x1898 },
+    { 0x007fffffe0000000ULL, 0x18d9 }, { 0x007ffffff0000000ULL, 0x191a },
+    { 0x007ffffff8000000ULL, 0x195b }, { 0x007ffffffc000000ULL, 0x199c },
+    { 0x007ffffffe000000ULL, 0x19dd }, { 0x007fffffff000000ULL, 0x1a1e },
+    { 0x007fffffff800000ULL, 0x1a5f }, { 0x007fffffffc00000ULL, 0x1aa0 },
+    { 0x007fffffffe00000ULL, 0x1ae1 }, { 0x007ffffffff00000ULL, 0x1b22 },
+    { 0x007ffffffff80000ULL, 0x1b63 }, { 0x007ffffffffc0000ULL, 0x1ba4 },
+    { 0x007ffffffffe0000ULL, 0x1be5 }, { 0x007fffffffff0000ULL, 0x1c26 },
+    { 0x007fffffffff8000ULL, 0x1c67 }, { 0x007fffffffffc000ULL, 0x1ca8 },
+    { 0x007fffffffffe000ULL, 0x1ce9 }, { 0x007ffffffffff000ULL, 0x1d2a },
+    { 0x007ffffffffff800ULL, 0x1d6b }, { 0x007ffffffffffc00ULL, 0x1dac },
+    { 0x007ffffffffffe00ULL, 0x1ded }, { 0x007fffffffffff00ULL, 0x1e2e },
+    { 0x007fffffffffff80ULL, 0x1e6f }, { 0x007fffffffffffc0ULL, 0x1eb0 },
+    { 0x007fffffffffffe0ULL, 0x1ef1 }, { 0x007ffffffffffff0ULL, 0x1f32 },
+    { 0x007ffffffffffff8ULL, 0x1f73 }, { 0x007ffffffffffffcULL, 0x1fb4 },
+    { 0x007ffffffffffffeULL, 0x1ff5 }, { 0x007fffffffffffffULL, 0x1036 },
+    { 0x0080000000000000ULL, 0x1240 }, { 0x0080000000800000ULL, 0x0240 },
+    { 0x0080008000800080ULL, 0x0260 }, { 0x00c0000000000000ULL, 0x1281 },
+    { 0x00c0000000c00000ULL, 0x0281 }, { 0x00c000c000c000c0ULL, 0x02a1 },
+    { 0x00e0000000000000ULL, 0x12c2 }, { 0x00e0000000e00000ULL, 0x02c2 },
+    { 0x00e000e000e000e0ULL, 0x02e2 }, { 0x00f0000000000000ULL, 0x1303 },
+    { 0x00f0000000f00000ULL, 0x0303 }, { 0x00f000f000f000f0ULL, 0x0323 },
+    { 0x00f8000000000000ULL, 0x1344 }, { 0x00f8000000f80000ULL, 0x0344 },
+    { 0x00f800f800f800f8ULL, 0x0364 }, { 0x00fc000000000000ULL, 0x1385 },
+    { 0x00fc000000fc0000ULL, 0x0385 }, { 0x00fc00fc00fc00fcULL, 0x03a5 },
+    { 0x00fe000000000000ULL, 0x13c6 }, { 0x00fe000000fe0000ULL, 0x03c6 },
+    { 0x00fe00fe00fe00feULL, 0x03e6 }, { 0x00ff000000000000ULL, 0x1407 },
+    { 0x00ff000000ff0000ULL, 0x0407 }, { 0x00ff00ff00ff00ffULL, 0x0027 },
+    { 0x00ff800000000000ULL, 0x1448 }, { 0x00ff800000ff8000ULL, 0x0448 },
+    { 0x00ffc00000000000ULL, 0x1489 }, { 0x00ffc00000ffc000ULL, 0x0489 },
+    { 0x00ffe00000000000ULL, 0x14ca }, { 0x00ffe00000ffe000ULL, 0x04ca },
+    { 0x00fff00000000000ULL, 0x150b }, { 0x00fff00000fff000ULL, 0x050b },
+    { 0x00fff80000000000ULL, 0x154c }, { 0x00fff80000fff800ULL, 0x054c },
+    { 0x00fffc0000000000ULL, 0x158d }, { 0x00fffc0000fffc00ULL, 0x058d },
+    { 0x00fffe0000000000ULL, 0x15ce }, { 0x00fffe0000fffe00ULL, 0x05ce },
+    { 0x00ffff0000000000ULL, 0x160f }, { 0x00ffff0000ffff00ULL, 0x060f },
+    { 0x00ffff8000000000ULL, 0x1650 }, { 0x00ffff8000ffff80ULL, 0x0650 },
+    { 0x00ffffc000000000ULL, 0x1691 }, { 0x00ffffc000ffffc0ULL, 0x0691 },
+    { 0x00ffffe000000000ULL, 0x16d2 }, { 0x00ffffe000ffffe0ULL, 0x06d2 },
+    { 0x00fffff000000000ULL, 0x1713 }, { 0x00fffff000fffff0ULL, 0x0713 },
+    { 0x00fffff800000000ULL, 0x1754 }, { 0x00fffff800fffff8ULL, 0x0754 },
+    { 0x00fffffc00000000ULL, 0x1795 }, { 0x00fffffc00fffffcULL, 0x0795 },
+    { 0x00fffffe00000000ULL, 0x17d6 }, { 0x00fffffe00fffffeULL, 0x07d6 },
+    { 0x00ffffff00000000ULL, 0x1817 }, { 0x00ffffff00ffffffULL, 0x0017 },
+    { 0x00ffffff80000000ULL, 0x1858 }, { 0x00ffffffc0000000ULL, 0x1899 },
+    { 0x00ffffffe0000000ULL, 0x18da }, { 0x00fffffff0000000ULL, 0x191b },
+    { 0x00fffffff8000000ULL, 0x195c }, { 0x00fffffffc000000ULL, 0x199d },
+    { 0x00fffffffe000000ULL, 0x19de }, { 0x00ffffffff000000ULL, 0x1a1f },
+    { 0x00ffffffff800000ULL, 0x1a60 }, { 0x00ffffffffc00000ULL, 0x1aa1 },
+    { 0x00ffffffffe00000ULL, 0x1ae2 }, { 0x00fffffffff00000ULL, 0x1b23 },
+    { 0x00fffffffff80000ULL, 0x1b64 }, { 0x00fffffffffc0000ULL, 0x1ba5 },
+    { 0x00fffffffffe0000ULL, 0x1be6 }, { 0x00ffffffffff0000ULL, 0x1c27 },
+    { 0x00ffffffffff8000ULL, 0x1c68 }, { 0x00ffffffffffc000ULL, 0x1ca9 },
+    { 0x00ffffffffffe000ULL, 0x1cea }, { 0x00fffffffffff000ULL, 0x1d2b },
+    { 0x00fffffffffff800ULL, 0x1d6c }, { 0x00fffffffffffc00ULL, 0x1dad },
+    { 0x00fffffffffffe00ULL, 0x1dee }, { 0x00ffffffffffff00ULL, 0x1e2f },
+    { 0x00ffffffffffff80ULL, 0x1e70 }, { 0x00ffffffffffffc0ULL, 0x1eb1 },
+    { 0x00ffffffffffffe0ULL, 0x1ef2 }, { 0x00fffffffffffff0ULL, 0x1f33 },
+    { 0x00fffffffffffff8ULL, 0x1f74 }, { 0x00fffffffffffffcULL, 0x1fb5 },
+    { 0x00fffffffffffffeULL, 0x1ff6 }, { 0x00ffffffffffffffULL, 0x1037 },
+    { 0x0100000000000000ULL, 0x1200 }, { 0x0100000001000000ULL, 0x0200 },
+    { 0x0100010001000100ULL, 0x0220 }, { 0x0101010101010101ULL, 0x0030 },
+    { 0x0180000000000000ULL, 0x1241 }, { 0x0180000001800000ULL, 0x0241 },
+    { 0x0180018001800180ULL, 0x0261 }, { 0x01c0000000000000ULL, 0x1282 },
+    { 0x01c0000001c00000ULL, 0x0282 }, { 0x01c001c001c001c0ULL, 0x02a2 },
+    { 0x01e0000000000000ULL, 0x12c3 }, { 0x01e0000001e00000ULL, 0x02c3 },
+    { 0x01e001e001e001e0ULL, 0x02e3 }, { 0x01f0000000000000ULL, 0x1304 },
+    { 0x01f0000001f00000ULL, 0x0304 }, { 0x01f001f001f001f0ULL, 0x0324 },
+    { 0x01f8000000000000ULL, 0x1345 }, { 0x01f8000001f80000ULL, 0x0345 },
+    { 0x01f801f801f801f8ULL, 0x0365 }, { 0x01fc000000000000ULL, 0x1386 },
+    { 0x01fc000001fc0000ULL, 0x0386 }, { 0x01fc01fc01fc01fcULL, 0x03a6 },
+    { 0x01fe000000000000ULL, 0x13c7 }, { 0x01fe000001fe0000ULL, 0x03c7 },
+    { 0x01fe01fe01fe01feULL, 0x03e7 }, { 0x01ff000000000000ULL, 0x1408 },
+    { 0x01ff000001ff0000ULL, 0x0408 }, { 0x01ff01ff01ff01ffULL, 0x0028 },
+    { 0x01ff800000000000ULL, 0x1449 }, { 0x01ff800001ff8000ULL, 0x0449 },
+    { 0x01ffc00000000000ULL, 0x148a }, { 0x01ffc00001ffc000ULL, 0x048a },
+    { 0x01ffe00000000000ULL, 0x14cb }, { 0x01ffe00001ffe000ULL, 0x04cb },
+    { 0x01fff00000000000ULL, 0x150c }, { 0x01fff00001fff000ULL, 0x050c },
+    { 0x01fff80000000000ULL, 0x154d }, { 0x01fff80001fff800ULL, 0x054d },
+    { 0x01fffc0000000000ULL, 0x158e }, { 0x01fffc0001fffc00ULL, 0x058e },
+    { 0x01fffe0000000000ULL, 0x15cf }, { 0x01fffe0001fffe00ULL, 0x05cf },
+    { 0x01ffff0000000000ULL, 0x1610 }, { 0x01ffff0001ffff00ULL, 0x0610 },
+    { 0x01ffff8000000000ULL, 0x1651 }, { 0x01ffff8001ffff80ULL, 0x0651 },
+    { 0x01ffffc000000000ULL, 0x1692 }, { 0x01ffffc001ffffc0ULL, 0x0692 },
+    { 0x01ffffe000000000ULL, 0x16d3 }, { 0x01ffffe001ffffe0ULL, 0x06d3 },
+    { 0x01fffff000000000ULL, 0x1714 }, { 0x01fffff001fffff0ULL, 0x0714 },
+    { 0x01fffff800000000ULL, 0x1755 }, { 0x01fffff801fffff8ULL, 0x0755 },
+    { 0x01fffffc00000000ULL, 0x1796 }, { 0x01fffffc01fffffcULL, 0x0796 },
+    { 0x01fffffe00000000ULL, 0x17d7 }, { 0x01fffffe01fffffeULL, 0x07d7 },
+    { 0x01ffffff00000000ULL, 0x1818 }, { 0x01ffffff01ffffffULL, 0x0018 },
+    { 0x01ffffff80000000ULL, 0x1859 }, { 0x01ffffffc0000000ULL, 0x189a },
+    { 0x01ffffffe0000000ULL, 0x18db }, { 0x01fffffff0000000ULL, 0x191c },
+    { 0x01fffffff8000000ULL, 0x195d }, { 0x01fffffffc000000ULL, 0x199e },
+    { 0x01fffffffe000000ULL, 0x19df }, { 0x01ffffffff000000ULL, 0x1a20 },
+    { 0x01ffffffff800000ULL, 0x1a61 }, { 0x01ffffffffc00000ULL, 0x1aa2 },
+    { 0x01ffffffffe00000ULL, 0x1ae3 }, { 0x01fffffffff00000ULL, 0x1b24 },
+    { 0x01fffffffff80000ULL, 0x1b65 }, { 0x01fffffffffc0000ULL, 0x1ba6 },
+    { 0x01fffffffffe0000ULL, 0x1be7 }, { 0x01ffffffffff0000ULL, 0x1c28 },
+    { 0x01ffffffffff8000ULL, 0x1c69 }, { 0x01ffffffffffc000ULL, 0x1caa },
+    { 0x01ffffffffffe000ULL, 0x1ceb }, { 0x01fffffffffff000ULL, 0x1d2c },
+    { 0x01fffffffffff800ULL, 0x1d6d }, { 0x01fffffffffffc00ULL, 0x1dae },
+    { 0x01fffffffffffe00ULL, 0x1def }, { 0x01ffffffffffff00ULL, 0x1e30 },
+    { 0x01ffffffffffff80ULL, 0x1e71 }, { 0x01ffffffffffffc0ULL, 0x1eb2 },
+    { 0x01ffffffffffffe0ULL, 0x1ef3 }, { 0x01fffffffffffff0ULL, 0x1f34 },
+    { 0x01fffffffffffff8ULL, 0x1f75 }, { 0x01fffffffffffffcULL, 0x1fb6 },
+    { 0x01fffffffffffffeULL, 0x1ff7 }, { 0x01ffffffffffffffULL, 0x1038 },
+    { 0x0200000000000000ULL, 0x11c0 }, { 0x0200000002000000ULL, 0x01c0 },
+    { 0x0200020002000200ULL, 0x01e0 }, { 0x0202020202020202ULL, 0x01f0 },
+    { 0x0300000000000000ULL, 0x1201 }, { 0x0300000003000000ULL, 0x0201 },
+    { 0x0300030003000300ULL, 0x0221 }, { 0x0303030303030303ULL, 0x0031 },
+    { 0x0380000000000000ULL, 0x1242 }, { 0x0380000003800000ULL, 0x0242 },
+    { 0x0380038003800380ULL, 0x0262 }, { 0x03c0000000000000ULL, 0x1283 },
+    { 0x03c0000003c00000ULL, 0x0283 }, { 0x03c003c003c003c0ULL, 0x02a3 },
+    { 0x03e0000000000000ULL, 0x12c4 }, { 0x03e0000003e00000ULL, 0x02c4 },
+    { 0x03e003e003e003e0ULL, 0x02e4 }, { 0x03f0000000000000ULL, 0x1305 },
+    { 0x03f0000003f00000ULL, 0x0305 }, { 0x03f003f003f003f0ULL, 0x0325 },
+    { 0x03f8000000000000ULL, 0x1346 }, { 0x03f8000003f80000ULL, 0x0346 },
+    { 0x03f803f803f803f8ULL, 0x0366 }, { 0x03fc000000000000ULL, 0x1387 },
+    { 0x03fc000003fc0000ULL, 0x0387 }, { 0x03fc03fc03fc03fcULL, 0x03a7 },
+    { 0x03fe000000000000ULL, 0x13c8 }, { 0x03fe000003fe0000ULL, 0x03c8 },
+    { 0x03fe03fe03fe03feULL, 0x03e8 }, { 0x03ff000000000000ULL, 0x1409 },
+    { 0x03ff000003ff0000ULL, 0x0409 }, { 0x03ff03ff03ff03ffULL, 0x0029 },
+    { 0x03ff800000000000ULL, 0x144a }, { 0x03ff800003ff8000ULL, 0x044a },
+    { 0x03ffc00000000000ULL, 0x148b }, { 0x03ffc00003ffc000ULL, 0x048b },
+    { 0x03ffe00000000000ULL, 0x14cc }, { 0x03ffe00003ffe000ULL, 0x04cc },
+    { 0x03fff00000000000ULL, 0x150d }, { 0x03fff00003fff000ULL, 0x050d },
+    { 0x03fff80000000000ULL, 0x154e }, { 0x03fff80003fff800ULL, 0x054e },
+    { 0x03fffc0000000000ULL, 0x158f }, { 0x03fffc0003fffc00ULL, 0x058f },
+    { 0x03fffe0000000000ULL, 0x15d0 }, { 0x03fffe0003fffe00ULL, 0x05d0 },
+    { 0x03ffff0000000000ULL, 0x1611 }, { 0x03ffff0003ffff00ULL, 0x0611 },
+    { 0x03ffff8000000000ULL, 0x1652 }, { 0x03ffff8003ffff80ULL, 0x0652 },
+    { 0x03ffffc000000000ULL, 0x1693 }, { 0x03ffffc003ffffc0ULL, 0x0693 },
+    { 0x03ffffe000000000ULL, 0x16d4 }, { 0x03ffffe003ffffe0ULL, 0x06d4 },
+    { 0x03fffff000000000ULL, 0x1715 }, { 0x03fffff003fffff0ULL, 0x0715 },
+    { 0x03fffff800000000ULL, 0x1756 }, { 0x03fffff803fffff8ULL, 0x0756 },
+    { 0x03fffffc00000000ULL, 0x1797 }, { 0x03fffffc03fffffcULL, 0x0797 },
+    { 0x03fffffe00000000ULL, 0x17d8 }, { 0x03fffffe03fffffeULL, 0x07d8 },
+    { 0x03ffffff00000000ULL, 0x1819 }, { 0x03ffffff03ffffffULL, 0x0019 },
+    { 0x03ffffff80000000ULL, 0x185a }, { 0x03ffffffc0000000ULL, 0x189b },
+    { 0x03ffffffe0000000ULL, 0x18dc }, { 0x03fffffff0000000ULL, 0x191d },
+    { 0x03fffffff8000000ULL, 0x195e }, { 0x03fffffffc000000ULL, 0x199f },
+    { 0x03fffffffe000000ULL, 0x19e0 }, { 0x03ffffffff000000ULL, 0x1a21 },
+    { 0x03ffffffff800000ULL, 0x1a62 }, { 0x03ffffffffc00000ULL, 0x1aa3 },
+    { 0x03ffffffffe00000ULL, 0x1ae4 }, { 0x03fffffffff00000ULL, 0x1b25 },
+    { 0x03fffffffff80000ULL, 0x1b66 }, { 0x03fffffffffc0000ULL, 0x1ba7 },
+    { 0x03fffffffffe0000ULL, 0x1be8 }, { 0x03ffffffffff0000ULL, 0x1c29 },
+    { 0x03ffffffffff8000ULL, 0x1c6a }, { 0x03ffffffffffc000ULL, 0x1cab },
+    { 0x03ffffffffffe000ULL, 0x1cec }, { 0x03fffffffffff000ULL, 0x1d2d },
+    { 0x03fffffffffff800ULL, 0x1d6e }, { 0x03fffffffffffc00ULL, 0x1daf },
+    { 0x03fffffffffffe00ULL, 0x1df0 }, { 0x03ffffffffffff00ULL, 0x1e31 },
+    { 0x03ffffffffffff80ULL, 0x1e72 }, { 0x03ffffffffffffc0ULL, 0x1eb3 },
+    { 0x03ffffffffffffe0ULL, 0x1ef4 }, { 0x03fffffffffffff0ULL, 0x1f35 },
+    { 0x03fffffffffffff8ULL, 0x1f76 }, { 0x03fffffffffffffcULL, 0x1fb7 },
+    { 0x03fffffffffffffeULL, 0x1ff8 }, { 0x03ffffffffffffffULL, 0x1039 },
+    { 0x0400000000000000ULL, 0x1180 }, { 0x0400000004000000ULL, 0x0180 },
+    { 0x0400040004000400ULL, 0x01a0 }, { 0x0404040404040404ULL, 0x01b0 },
+    { 0x0600000000000000ULL, 0x11c1 }, { 0x0600000006000000ULL, 0x01c1 },
+    { 0x0600060006000600ULL, 0x01e1 }, { 0x0606060606060606ULL, 0x01f1 },
+    { 0x0700000000000000ULL, 0x1202 }, { 0x0700000007000000ULL, 0x0202 },
+    { 0x0700070007000700ULL, 0x0222 }, { 0x0707070707070707ULL, 0x0032 },
+    { 0x0780000000000000ULL, 0x1243 }, { 0x0780000007800000ULL, 0x0243 },
+    { 0x0780078007800780ULL, 0x0263 }, { 0x07c0000000000000ULL, 0x1284 },
+    { 0x07c0000007c00000ULL, 0x0284 }, { 0x07c007c007c007c0ULL, 0x02a4 },
+    { 0x07e0000000000000ULL, 0x12c5 }, { 0x07e0000007e00000ULL, 0x02c5 },
+    { 0x07e007e007e007e0ULL, 0x02e5 }, { 0x07f0000000000000ULL, 0x1306 },
+    { 0x07f0000007f00000ULL, 0x0306 }, { 0x07f007f007f007f0ULL, 0x0326 },
+    { 0x07f8000000000000ULL, 0x1347 }, { 0x07f8000007f80000ULL, 0x0347 },
+    { 0x07f807f807f807f8ULL, 0x0367 }, { 0x07fc000000000000ULL, 0x1388 },
+    { 0x07fc000007fc0000ULL, 0x0388 }, { 0x07fc07fc07fc07fcULL, 0x03a8 },
+    { 0x07fe000000000000ULL, 0x13c9 }, { 0x07fe000007fe0000ULL, 0x03c9 },
+    { 0x07fe07fe07fe07feULL, 0x03e9 }, { 0x07ff000000000000ULL, 0x140a },
+    { 0x07ff000007ff0000ULL, 0x040a }, { 0x07ff07ff07ff07ffULL, 0x002a },
+    { 0x07ff800000000000ULL, 0x144b }, { 0x07ff800007ff8000ULL, 0x044b },
+    { 0x07ffc00000000000ULL, 0x148c }, { 0x07ffc00007ffc000ULL, 0x048c },
+    { 0x07ffe00000000000ULL, 0x14cd }, { 0x07ffe00007ffe000ULL, 0x04cd },
+    { 0x07fff00000000000ULL, 0x150e }, { 0x07fff00007fff000ULL, 0x050e },
+    { 0x07fff80000000000ULL, 0x154f }, { 0x07fff80007fff800ULL, 0x054f },
+    { 0x07fffc0000000000ULL, 0x1590 }, { 0x07fffc0007fffc00ULL, 0x0590 },
+    { 0x07fffe0000000000ULL, 0x15d1 }, { 0x07fffe0007fffe00ULL, 0x05d1 },
+    { 0x07ffff0000000000ULL, 0x1612 }, { 0x07ffff0007ffff00ULL, 0x0612 },
+    { 0x07ffff8000000000ULL, 0x1653 }, { 0x07ffff8007ffff80ULL, 0x0653 },
+    { 0x07ffffc000000000ULL, 0x1694 }, { 0x07ffffc007ffffc0ULL, 0x0694 },
+    { 0x07ffffe000000000ULL, 0x16d5 }, { 0x07ffffe007ffffe0ULL, 0x06d5 },
+    { 0x07fffff000000000ULL, 0x1716 }, { 0x07fffff007fffff0ULL, 0x0716 },
+    { 0x07fffff800000000ULL, 0x1757 }, { 0x07fffff807fffff8ULL, 0x0757 },
+    { 0x07fffffc00000000ULL, 0x1798 }, { 0x07fffffc07fffffcULL, 0x0798 },
+    { 0x07fffffe00000000ULL, 0x17d9 }, { 0x07fffffe07fffffeULL, 0x07d9 },
+    { 0x07ffffff00000000ULL, 0x181a }, { 0x07ffffff07ffffffULL, 0x001a },
+    { 0x07ffffff80000000ULL, 0x185b }, { 0x07ffffffc0000000ULL, 0x189c },
+    { 0x07ffffffe0000000ULL, 0x18dd }, { 0x07fffffff0000000ULL, 0x191e },
+    { 0x07fffffff8000000ULL, 0x195f }, { 0x07fffffffc000000ULL, 0x19a0 },
+    { 0x07fffffffe000000ULL, 0x19e1 }, { 0x07ffffffff000000ULL, 0x1a22 },
+    { 0x07ffffffff800000ULL, 0x1a63 }, { 0x07ffffffffc00000ULL, 0x1aa4 },
+    { 0x07ffffffffe00000ULL, 0x1ae5 }, { 0x07fffffffff00000ULL, 0x1b26 },
+    { 0x07fffffffff80000ULL, 0x1b67 }, { 0x07fffffffffc0000ULL, 0x1ba8 },
+    { 0x07fffffffffe0000ULL, 0x1be9 }, { 0x07ffffffffff0000ULL, 0x1c2a },
+    { 0x07ffffffffff8000ULL, 0x1c6b }, { 0x07ffffffffffc000ULL, 0x1cac },
+    { 0x07ffffffffffe000ULL, 0x1ced }, { 0x07fffffffffff000ULL, 0x1d2e },
+    { 0x07fffffffffff800ULL, 0x1d6f }, { 0x07fffffffffffc00ULL, 0x1db0 },
+    { 0x07fffffffffffe00ULL, 0x1df1 }, { 0x07ffffffffffff00ULL, 0x1e32 },
+    { 0x07ffffffffffff80ULL, 0x1e73 }, { 0x07ffffffffffffc0ULL, 0x1eb4 },
+    { 0x07ffffffffffffe0ULL, 0x1ef5 }, { 0x07fffffffffffff0ULL, 0x1f36 },
+    { 0x07fffffffffffff8ULL, 0x1f77 }, { 0x07fffffffffffffcULL, 0x1fb8 },
+    { 0x07fffffffffffffeULL, 0x1ff9 }, { 0x07ffffffffffffffULL, 0x103a },
+    { 0x0800000000000000ULL, 0x1140 }, { 0x0800000008000000ULL, 0x0140 },
+    { 0x0800080008000800ULL, 0x0160 }, { 0x0808080808080808ULL, 0x0170 },
+    { 0x0c00000000000000ULL, 0x1181 }, { 0x0c0000000c000000ULL, 0x0181 },
+    { 0x0c000c000c000c00ULL, 0x01a1 }, { 0x0c0c0c0c0c0c0c0cULL, 0x01b1 },
+    { 0x0e00000000000000ULL, 0x11c2 }, { 0x0e0000000e000000ULL, 0x01c2 },
+    { 0x0e000e000e000e00ULL, 0x01e2 }, { 0x0e0e0e0e0e0e0e0eULL, 0x01f2 },
+    { 0x0f00000000000000ULL, 0x1203 }, { 0x0f0000000f000000ULL, 0x0203 },
+    { 0x0f000f000f000f00ULL, 0x0223 }, { 0x0f0f0f0f0f0f0f0fULL, 0x0033 },
+    { 0x0f80000000000000ULL, 0x1244 }, { 0x0f8000000f800000ULL, 0x0244 },
+    { 0x0f800f800f800f80ULL, 0x0264 }, { 0x0fc0000000000000ULL, 0x1285 },
+    { 0x0fc000000fc00000ULL, 0x0285 }, { 0x0fc00fc00fc00fc0ULL, 0x02a5 },
+    { 0x0fe0000000000000ULL, 0x12c6 }, { 0x0fe000000fe00000ULL, 0x02c6 },
+    { 0x0fe00fe00fe00fe0ULL, 0x02e6 }, { 0x0ff0000000000000ULL, 0x1307 },
+    { 0x0ff000000ff00000ULL, 0x0307 }, { 0x0ff00ff00ff00ff0ULL, 0x0327 },
+    { 0x0ff8000000000000ULL, 0x1348 }, { 0x0ff800000ff80000ULL, 0x0348 },
+    { 0x0ff80ff80ff80ff8ULL, 0x0368 }, { 0x0ffc000000000000ULL, 0x1389 },
+    { 0x0ffc00000ffc0000ULL, 0x0389 }, { 0x0ffc0ffc0ffc0ffcULL, 0x03a9 },
+    { 0x0ffe000000000000ULL, 0x13ca }, { 0x0ffe00000ffe0000ULL, 0x03ca },
+    { 0x0ffe0ffe0ffe0ffeULL, 0x03ea }, { 0x0fff000000000000ULL, 0x140b },
+    { 0x0fff00000fff0000ULL, 0x040b }, { 0x0fff0fff0fff0fffULL, 0x002b },
+    { 0x0fff800000000000ULL, 0x144c }, { 0x0fff80000fff8000ULL, 0x044c },
+    { 0x0fffc00000000000ULL, 0x148d }, { 0x0fffc0000fffc000ULL, 0x048d },
+    { 0x0fffe00000000000ULL, 0x14ce }, { 0x0fffe0000fffe000ULL, 0x04ce },
+    { 0x0ffff00000000000ULL, 0x150f }, { 0x0ffff0000ffff000ULL, 0x050f },
+    { 0x0ffff80000000000ULL, 0x1550 }, { 0x0ffff8000ffff800ULL, 0x0550 },
+    { 0x0ffffc0000000000ULL, 0x1591 }, { 0x0ffffc000ffffc00ULL, 0x0591 },
+    { 0x0ffffe0000000000ULL, 0x15d2 }, { 0x0ffffe000ffffe00ULL, 0x05d2 },
+    { 0x0fffff0000000000ULL, 0x1613 }, { 0x0fffff000fffff00ULL, 0x0613 },
+    { 0x0fffff8000000000ULL, 0x1654 }, { 0x0fffff800fffff80ULL, 0x0654 },
+    { 0x0fffffc000000000ULL, 0x1695 }, { 0x0fffffc00fffffc0ULL, 0x0695 },
+    { 0x0fffffe000000000ULL, 0x16d6 }, { 0x0fffffe00fffffe0ULL, 0x06d6 },
+    { 0x0ffffff000000000ULL, 0x1717 }, { 0x0ffffff00ffffff0ULL, 0x0717 },
+    { 0x0ffffff800000000ULL, 0x1758 }, { 0x0ffffff80ffffff8ULL, 0x0758 },
+    { 0x0ffffffc00000000ULL, 0x1799 }, { 0x0ffffffc0ffffffcULL, 0x0799 },
+    { 0x0ffffffe00000000ULL, 0x17da }, { 0x0ffffffe0ffffffeULL, 0x07da },
+    { 0x0fffffff00000000ULL, 0x181b }, { 0x0fffffff0fffffffULL, 0x001b },
+    { 0x0fffffff80000000ULL, 0x185c }, { 0x0fffffffc0000000ULL, 0x189d },
+    { 0x0fffffffe0000000ULL, 0x18de }, { 0x0ffffffff0000000ULL, 0x191f },
+    { 0x0ffffffff8000000ULL, 0x1960 }, { 0x0ffffffffc000000ULL, 0x19a1 },
+    { 0x0ffffffffe000000ULL, 0x19e2 }, { 0x0fffffffff000000ULL, 0x1a23 },
+    { 0x0fffffffff800000ULL, 0x1a64 }, { 0x0fffffffffc00000ULL, 0x1aa5 },
+    { 0x0fffffffffe00000ULL, 0x1ae6 }, { 0x0ffffffffff00000ULL, 0x1b27 },
+    { 0x0ffffffffff80000ULL, 0x1b68 }, { 0x0ffffffffffc0000ULL, 0x1ba9 },
+    { 0x0ffffffffffe0000ULL, 0x1bea }, { 0x0fffffffffff0000ULL, 0x1c2b },
+    { 0x0fffffffffff8000ULL, 0x1c6c }, { 0x0fffffffffffc000ULL, 0x1cad },
+    { 0x0fffffffffffe000ULL, 0x1cee }, { 0x0ffffffffffff000ULL, 0x1d2f },
+    { 0x0ffffffffffff800ULL, 0x1d70 }, { 0x0ffffffffffffc00ULL, 0x1db1 },
+    { 0x0ffffffffffffe00ULL, 0x1df2 }, { 0x0fffffffffffff00ULL, 0x1e33 },
+    { 0x0fffffffffffff80ULL, 0x1e74 }, { 0x0fffffffffffffc0ULL, 0x1eb5 },
+    { 0x0fffffffffffffe0ULL, 0x1ef6 }, { 0x0ffffffffffffff0ULL, 0x1f37 },
+    { 0x0ffffffffffffff8ULL, 0x1f78 }, { 0x0ffffffffffffffcULL, 0x1fb9 },
+    { 0x0ffffffffffffffeULL, 0x1ffa }, { 0x0fffffffffffffffULL, 0x103b },
+    { 0x1000000000000000ULL, 0x1100 }, { 0x1000000010000000ULL, 0x0100 },
+    { 0x1000100010001000ULL, 0x0120 }, { 0x1010101010101010ULL, 0x0130 },
+    { 0x1111111111111111ULL, 0x0038 }, { 0x1800000000000000ULL, 0x1141 },
+    { 0x1800000018000000ULL, 0x0141 }, { 0x1800180018001800ULL, 0x0161 },
+    { 0x1818181818181818ULL, 0x0171 }, { 0x1c00000000000000ULL, 0x1182 },
+    { 0x1c0000001c000000ULL, 0x0182 }, { 0x1c001c001c001c00ULL, 0x01a2 },
+    { 0x1c1c1c1c1c1c1c1cULL, 0x01b2 }, { 0x1e00000000000000ULL, 0x11c3 },
+    { 0x1e0000001e000000ULL, 0x01c3 }, { 0x1e001e001e001e00ULL, 0x01e3 },
+    { 0x1e1e1e1e1e1e1e1eULL, 0x01f3 }, { 0x1f00000000000000ULL, 0x1204 },
+    { 0x1f0000001f000000ULL, 0x0204 }, { 0x1f001f001f001f00ULL, 0x0224 },
+    { 0x1f1f1f1f1f1f1f1fULL, 0x0034 }, { 0x1f80000000000000ULL, 0x1245 },
+    { 0x1f8000001f800000ULL, 0x0245 }, { 0x1f801f801f801f80ULL, 0x0265 },
+    { 0x1fc0000000000000ULL, 0x1286 }, { 0x1fc000001fc00000ULL, 0x0286 },
+    { 0x1fc01fc01fc01fc0ULL, 0x02a6 }, { 0x1fe0000000000000ULL, 0x12c7 },
+    { 0x1fe000001fe00000ULL, 0x02c7 }, { 0x1fe01fe01fe01fe0ULL, 0x02e7 },
+    { 0x1ff0000000000000ULL, 0x1308 }, { 0x1ff000001ff00000ULL, 0x0308 },
+    { 0x1ff01ff01ff01ff0ULL, 0x0328 }, { 0x1ff8000000000000ULL, 0x1349 },
+    { 0x1ff800001ff80000ULL, 0x0349 }, { 0x1ff81ff81ff81ff8ULL, 0x0369 },
+    { 0x1ffc000000000000ULL, 0x138a }, { 0x1ffc00001ffc0000ULL, 0x038a },
+    { 0x1ffc1ffc1ffc1ffcULL, 0x03aa }, { 0x1ffe000000000000ULL, 0x13cb },
+    { 0x1ffe00001ffe0000ULL, 0x03cb }, { 0x1ffe1ffe1ffe1ffeULL, 0x03eb },
+    { 0x1fff000000000000ULL, 0x140c }, { 0x1fff00001fff0000ULL, 0x040c },
+    { 0x1fff1fff1fff1fffULL, 0x002c }, { 0x1fff800000000000ULL, 0x144d },
+    { 0x1fff80001fff8000ULL, 0x044d }, { 0x1fffc00000000000ULL, 0x148e },
+    { 0x1fffc0001fffc000ULL, 0x048e }, { 0x1fffe00000000000ULL, 0x14cf },
+    { 0x1fffe0001fffe000ULL, 0x04cf }, { 0x1ffff00000000000ULL, 0x1510 },
+    { 0x1ffff0001ffff000ULL, 0x0510 }, { 0x1ffff80000000000ULL, 0x1551 },
+    { 0x1ffff8001ffff800ULL, 0x0551 }, { 0x1ffffc0000000000ULL, 0x1592 },
+    { 0x1ffffc001ffffc00ULL, 0x0592 }, { 0x1ffffe0000000000ULL, 0x15d3 },
+    { 0x1ffffe001ffffe00ULL, 0x05d3 }, { 0x1fffff0000000000ULL, 0x1614 },
+    { 0x1fffff001fffff00ULL, 0x0614 }, { 0x1fffff8000000000ULL, 0x1655 },
+    { 0x1fffff801fffff80ULL, 0x0655 }, { 0x1fffffc000000000ULL, 0x1696 },
+    { 0x1fffffc01fffffc0ULL, 0x0696 }, { 0x1fffffe000000000ULL, 0x16d7 },
+    { 0x1fffffe01fffffe0ULL, 0x06d7 }, { 0x1ffffff000000000ULL, 0x1718 },
+    { 0x1ffffff01ffffff0ULL, 0x0718 }, { 0x1ffffff800000000ULL, 0x1759 },
+    { 0x1ffffff81ffffff8ULL, 0x0759 }, { 0x1ffffffc00000000ULL, 0x179a },
+    { 0x1ffffffc1ffffffcULL, 0x079a }, { 0x1ffffffe00000000ULL, 0x17db },
+    { 0x1ffffffe1ffffffeULL, 0x07db }, { 0x1fffffff00000000ULL, 0x181c },
+    { 0x1fffffff1fffffffULL, 0x001c }, { 0x1fffffff80000000ULL, 0x185d },
+    { 0x1fffffffc0000000ULL, 0x189e }, { 0x1fffffffe0000000ULL, 0x18df },
+    { 0x1ffffffff0000000ULL, 0x1920 }, { 0x1ffffffff8000000ULL, 0x1961 },
+    { 0x1ffffffffc000000ULL, 0x19a2 }, { 0x1ffffffffe000000ULL, 0x19e3 },
+    { 0x1fffffffff000000ULL, 0x1a24 }, { 0x1fffffffff800000ULL, 0x1a65 },
+    { 0x1fffffffffc00000ULL, 0x1aa6 }, { 0x1fffffffffe00000ULL, 0x1ae7 },
+    { 0x1ffffffffff00000ULL, 0x1b28 }, { 0x1ffffffffff80000ULL, 0x1b69 },
+    { 0x1ffffffffffc0000ULL, 0x1baa }, { 0x1ffffffffffe0000ULL, 0x1beb },
+    { 0x1fffffffffff0000ULL, 0x1c2c }, { 0x1fffffffffff8000ULL, 0x1c6d },
+    { 0x1fffffffffffc000ULL, 0x1cae }, { 0x1fffffffffffe000ULL, 0x1cef },
+    { 0x1ffffffffffff000ULL, 0x1d30 }, { 0x1ffffffffffff800ULL, 0x1d71 },
+    { 0x1ffffffffffffc00ULL, 0x1db2 }, { 0x1ffffffffffffe00ULL, 0x1df3 },
+    { 0x1fffffffffffff00ULL, 0x1e34 }, { 0x1fffffffffffff80ULL, 0x1e75 },
+    { 0x1fffffffffffffc0ULL, 0x1eb6 }, { 0x1fffffffffffffe0ULL, 0x1ef7 },
+    { 0x1ffffffffffffff0ULL, 0x1f38 }, { 0x1ffffffffffffff8ULL, 0x1f79 },
+    { 0x1ffffffffffffffcULL, 0x1fba }, { 0x1ffffffffffffffeULL, 0x1ffb },
+    { 0x1fffffffffffffffULL, 0x103c }, { 0x2000000000000000ULL, 0x10c0 },
+    { 0x2000000020000000ULL, 0x00c0 }, { 0x2000200020002000ULL, 0x00e0 },
+    { 0x2020202020202020ULL, 0x00f0 }, { 0x2222222222222222ULL, 0x00f8 },
+    { 0x3000000000000000ULL, 0x1101 }, { 0x3000000030000000ULL, 0x0101 },
+    { 0x3000300030003000ULL, 0x0121 }, { 0x3030303030303030ULL, 0x0131 },
+    { 0x3333333333333333ULL, 0x0039 }, { 0x3800000000000000ULL, 0x1142 },
+    { 0x3800000038000000ULL, 0x0142 }, { 0x3800380038003800ULL, 0x0162 },
+    { 0x3838383838383838ULL, 0x0172 }, { 0x3c00000000000000ULL, 0x1183 },
+    { 0x3c0000003c000000ULL, 0x0183 }, { 0x3c003c003c003c00ULL, 0x01a3 },
+    { 0x3c3c3c3c3c3c3c3cULL, 0x01b3 }, { 0x3e00000000000000ULL, 0x11c4 },
+    { 0x3e0000003e000000ULL, 0x01c4 }, { 0x3e003e003e003e00ULL, 0x01e4 },
+    { 0x3e3e3e3e3e3e3e3eULL, 0x01f4 }, { 0x3f00000000000000ULL, 0x1205 },
+    { 0x3f0000003f000000ULL, 0x0205 }, { 0x3f003f003f003f00ULL, 0x0225 },
+    { 0x3f3f3f3f3f3f3f3fULL, 0x0035 }, { 0x3f80000000000000ULL, 0x1246 },
+    { 0x3f8000003f800000ULL, 0x0246 }, { 0x3f803f803f803f80ULL, 0x0266 },
+    { 0x3fc0000000000000ULL, 0x1287 }, { 0x3fc000003fc00000ULL, 0x0287 },
+    { 0x3fc03fc03fc03fc0ULL, 0x02a7 }, { 0x3fe0000000000000ULL, 0x12c8 },
+    { 0x3fe000003fe00000ULL, 0x02c8 }, { 0x3fe03fe03fe03fe0ULL, 0x02e8 },
+    { 0x3ff0000000000000ULL, 0x1309 }, { 0x3ff000003ff00000ULL, 0x0309 },
+    { 0x3ff03ff03ff03ff0ULL, 0x0329 }, { 0x3ff8000000000000ULL, 0x134a },
+    { 0x3ff800003ff80000ULL, 0x034a }, { 0x3ff83ff83ff83ff8ULL, 0x036a },
+    { 0x3ffc000000000000ULL, 0x138b }, { 0x3ffc00003ffc0000ULL, 0x038b },
+    { 0x3ffc3ffc3ffc3ffcULL, 0x03ab }, { 0x3ffe000000000000ULL, 0x13cc },
+    { 0x3ffe00003ffe0000ULL, 0x03cc }, { 0x3ffe3ffe3ffe3ffeULL, 0x03ec },
+    { 0x3fff000000000000ULL, 0x140d }, { 0x3fff00003fff0000ULL, 0x040d },
+    { 0x3fff3fff3fff3fffULL, 0x002d }, { 0x3fff800000000000ULL, 0x144e },
+    { 0x3fff80003fff8000ULL, 0x044e }, { 0x3fffc00000000000ULL, 0x148f },
+    { 0x3fffc0003fffc000ULL, 0x048f }, { 0x3fffe00000000000ULL, 0x14d0 },
+    { 0x3fffe0003fffe000ULL, 0x04d0 }, { 0x3ffff00000000000ULL, 0x1511 },
+    { 0x3ffff0003ffff000ULL, 0x0511 }, { 0x3ffff80000000000ULL, 0x1552 },
+    { 0x3ffff8003ffff800ULL, 0x0552 }, { 0x3ffffc0000000000ULL, 0x1593 },
+    { 0x3ffffc003ffffc00ULL, 0x0593 }, { 0x3ffffe0000000000ULL, 0x15d4 },
+    { 0x3ffffe003ffffe00ULL, 0x05d4 }, { 0x3fffff0000000000ULL, 0x1615 },
+    { 0x3fffff003fffff00ULL, 0x0615 }, { 0x3fffff8000000000ULL, 0x1656 },
+    { 0x3fffff803fffff80ULL, 0x0656 }, { 0x3fffffc000000000ULL, 0x1697 },
+    { 0x3fffffc03fffffc0ULL, 0x0697 }, { 0x3fffffe000000000ULL, 0x16d8 },
+    { 0x3fffffe03fffffe0ULL, 0x06d8 }, { 0x3ffffff000000000ULL, 0x1719 },
+    { 0x3ffffff03ffffff0ULL, 0x0719 }, { 0x3ffffff800000000ULL, 0x175a },
+    { 0x3ffffff83ffffff8ULL, 0x075a }, { 0x3ffffffc00000000ULL, 0x179b },
+    { 0x3ffffffc3ffffffcULL, 0x079b }, { 0x3ffffffe00000000ULL, 0x17dc },
+    { 0x3ffffffe3ffffffeULL, 0x07dc }, { 0x3fffffff00000000ULL, 0x181d },
+    { 0x3fffffff3fffffffULL, 0x001d }, { 0x3fffffff80000000ULL, 0x185e },
+    { 0x3fffffffc0000000ULL, 0x189f }, { 0x3fffffffe0000000ULL, 0x18e0 },
+    { 0x3ffffffff0000000ULL, 0x1921 }, { 0x3ffffffff8000000ULL, 0x1962 },
+    { 0x3ffffffffc000000ULL, 0x19a3 }, { 0x3ffffffffe000000ULL, 0x19e4 },
+    { 0x3fffffffff000000ULL, 0x1a25 }, { 0x3fffffffff800000ULL, 0x1a66 },
+    { 0x3fffffffffc00000ULL, 0x1aa7 }, { 0x3fffffffffe00000ULL, 0x1ae8 },
+    { 0x3ffffffffff00000ULL, 0x1b29 }, { 0x3ffffffffff80000ULL, 0x1b6a },
+    { 0x3ffffffffffc0000ULL, 0x1bab }, { 0x3ffffffffffe0000ULL, 0x1bec },
+    { 0x3fffffffffff0000ULL, 0x1c2d }, { 0x3fffffffffff8000ULL, 0x1c6e },
+    { 0x3fffffffffffc000ULL, 0x1caf }, { 0x3fffffffffffe000ULL, 0x1cf0 },
+    { 0x3ffffffffffff000ULL, 0x1d31 }, { 0x3ffffffffffff800ULL, 0x1d72 },
+    { 0x3ffffffffffffc00ULL, 0x1db3 }, { 0x3ffffffffffffe00ULL, 0x1df4 },
+    { 0x3fffffffffffff00ULL, 0x1e35 }, { 0x3fffffffffffff80ULL, 0x1e76 },
+    { 0x3fffffffffffffc0ULL, 0x1eb7 }, { 0x3fffffffffffffe0ULL, 0x1ef8 },
+    { 0x3ffffffffffffff0ULL, 0x1f39 }, { 0x3ffffffffffffff8ULL, 0x1f7a },
+    { 0x3ffffffffffffffcULL, 0x1fbb }, { 0x3ffffffffffffffeULL, 0x1ffc },
+    { 0x3fffffffffffffffULL, 0x103d }, { 0x4000000000000000ULL, 0x1080 },
+    { 0x4000000040000000ULL, 0x0080 }, { 0x4000400040004000ULL, 0x00a0 },
+    { 0x4040404040404040ULL, 0x00b0 }, { 0x4444444444444444ULL, 0x00b8 },
+    { 0x5555555555555555ULL, 0x003c }, { 0x6000000000000000ULL, 0x10c1 },
+    { 0x6000000060000000ULL, 0x00c1 }, { 0x6000600060006000ULL, 0x00e1 },
+    { 0x6060606060606060ULL, 0x00f1 }, { 0x6666666666666666ULL, 0x00f9 },
+    { 0x7000000000000000ULL, 0x1102 }, { 0x7000000070000000ULL, 0x0102 },
+    { 0x7000700070007000ULL, 0x0122 }, { 0x7070707070707070ULL, 0x0132 },
+    { 0x7777777777777777ULL, 0x003a }, { 0x7800000000000000ULL, 0x1143 },
+    { 0x7800000078000000ULL, 0x0143 }, { 0x7800780078007800ULL, 0x0163 },
+    { 0x7878787878787878ULL, 0x0173 }, { 0x7c00000000000000ULL, 0x1184 },
+    { 0x7c0000007c000000ULL, 0x0184 }, { 0x7c007c007c007c00ULL, 0x01a4 },
+    { 0x7c7c7c7c7c7c7c7cULL, 0x01b4 }, { 0x7e00000000000000ULL, 0x11c5 },
+    { 0x7e0000007e000000ULL, 0x01c5 }, { 0x7e007e007e007e00ULL, 0x01e5 },
+    { 0x7e7e7e7e7e7e7e7eULL, 0x01f5 }, { 0x7f00000000000000ULL, 0x1206 },
+    { 0x7f0000007f000000ULL, 0x0206 }, { 0x7f007f007f007f00ULL, 0x0226 },
+    { 0x7f7f7f7f7f7f7f7fULL, 0x0036 }, { 0x7f80000000000000ULL, 0x1247 },
+    { 0x7f8000007f800000ULL, 0x0247 }, { 0x7f807f807f807f80ULL, 0x0267 },
+    { 0x7fc0000000000000ULL, 0x1288 }, { 0x7fc000007fc00000ULL, 0x0288 },
+    { 0x7fc07fc07fc07fc0ULL, 0x02a8 }, { 0x7fe0000000000000ULL, 0x12c9 },
+    { 0x7fe000007fe00000ULL, 0x02c9 }, { 0x7fe07fe07fe07fe0ULL, 0x02e9 },
+    { 0x7ff0000000000000ULL, 0x130a }, { 0x7ff000007ff00000ULL, 0x030a },
+    { 0x7ff07ff07ff07ff0ULL, 0x032a }, { 0x7ff8000000000000ULL, 0x134b },
+    { 0x7ff800007ff80000ULL, 0x034b }, { 0x7ff87ff87ff87ff8ULL, 0x036b },
+    { 0x7ffc000000000000ULL, 0x138c }, { 0x7ffc00007ffc0000ULL, 0x038c },
+    { 0x7ffc7ffc7ffc7ffcULL, 0x03ac }, { 0x7ffe000000000000ULL, 0x13cd },
+    { 0x7ffe00007ffe0000ULL, 0x03cd }, { 0x7ffe7ffe7ffe7ffeULL, 0x03ed },
+    { 0x7fff000000000000ULL, 0x140e }, { 0x7fff00007fff0000ULL, 0x040e },
+    { 0x7fff7fff7fff7fffULL, 0x002e }, { 0x7fff800000000000ULL, 0x144f },
+    { 0x7fff80007fff8000ULL, 0x044f }, { 0x7fffc00000000000ULL, 0x1490 },
+    { 0x7fffc0007fffc000ULL, 0x0490 }, { 0x7fffe00000000000ULL, 0x14d1 },
+    { 0x7fffe0007fffe000ULL, 0x04d1 }, { 0x7ffff00000000000ULL, 0x1512 },
+    { 0x7ffff0007ffff000ULL, 0x0512 }, { 0x7ffff80000000000ULL, 0x1553 },
+    { 0x7ffff8007ffff800ULL, 0x0553 }, { 0x7ffffc0000000000ULL, 0x1594 },
+    { 0x7ffffc007ffffc00ULL, 0x0594 }, { 0x7ffffe0000000000ULL, 0x15d5 },
+    { 0x7ffffe007ffffe00ULL, 0x05d5 }, { 0x7fffff0000000000ULL, 0x1616 },
+    { 0x7fffff007fffff00ULL, 0x0616 }, { 0x7fffff8000000000ULL, 0x1657 },
+    { 0x7fffff807fffff80ULL, 0x0657 }, { 0x7fffffc000000000ULL, 0x1698 },
+    { 0x7fffffc07fffffc0ULL, 0x0698 }, { 0x7fffffe000000000ULL, 0x16d9 },
+    { 0x7fffffe07fffffe0ULL, 0x06d9 }, { 0x7ffffff000000000ULL, 0x171a },
+    { 0x7ffffff07ffffff0ULL, 0x071a }, { 0x7ffffff800000000ULL, 0x175b },
+    { 0x7ffffff87ffffff8ULL, 0x075b }, { 0x7ffffffc00000000ULL, 0x179c },
+    { 0x7ffffffc7ffffffcULL, 0x079c }, { 0x7ffffffe00000000ULL, 0x17dd },
+    { 0x7ffffffe7ffffffeULL, 0x07dd }, { 0x7fffffff00000000ULL, 0x181e },
+    { 0x7fffffff7fffffffULL, 0x001e }, { 0x7fffffff80000000ULL, 0x185f },
+    { 0x7fffffffc0000000ULL, 0x18a0 }, { 0x7fffffffe0000000ULL, 0x18e1 },
+    { 0x7ffffffff0000000ULL, 0x1922 }, { 0x7ffffffff8000000ULL, 0x1963 },
+    { 0x7ffffffffc000000ULL, 0x19a4 }, { 0x7ffffffffe000000ULL, 0x19e5 },
+    { 0x7fffffffff000000ULL, 0x1a26 }, { 0x7fffffffff800000ULL, 0x1a67 },
+    { 0x7fffffffffc00000ULL, 0x1aa8 }, { 0x7fffffffffe00000ULL, 0x1ae9 },
+    { 0x7ffffffffff00000ULL, 0x1b2a }, { 0x7ffffffffff80000ULL, 0x1b6b },
+    { 0x7ffffffffffc0000ULL, 0x1bac }, { 0x7ffffffffffe0000ULL, 0x1bed },
+    { 0x7fffffffffff0000ULL, 0x1c2e }, { 0x7fffffffffff8000ULL, 0x1c6f },
+    { 0x7fffffffffffc000ULL, 0x1cb0 }, { 0x7fffffffffffe000ULL, 0x1cf1 },
+    { 0x7ffffffffffff000ULL, 0x1d32 }, { 0x7ffffffffffff800ULL, 0x1d73 },
+    { 0x7ffffffffffffc00ULL, 0x1db4 }, { 0x7ffffffffffffe00ULL, 0x1df5 },
+    { 0x7fffffffffffff00ULL, 0x1e36 }, { 0x7fffffffffffff80ULL, 0x1e77 },
+    { 0x7fffffffffffffc0ULL, 0x1eb8 }, { 0x7fffffffffffffe0ULL, 0x1ef9 },
+    { 0x7ffffffffffffff0ULL, 0x1f3a }, { 0x7ffffffffffffff8ULL, 0x1f7b },
+    { 0x7ffffffffffffffcULL, 0x1fbc }, { 0x7ffffffffffffffeULL, 0x1ffd },
+    { 0x7fffffffffffffffULL, 0x103e }, { 0x8000000000000000ULL, 0x1040 },
+    { 0x8000000000000001ULL, 0x1041 }, { 0x8000000000000003ULL, 0x1042 },
+    { 0x8000000000000007ULL, 0x1043 }, { 0x800000000000000fULL, 0x1044 },
+    { 0x800000000000001fULL, 0x1045 }, { 0x800000000000003fULL, 0x1046 },
+    { 0x800000000000007fULL, 0x1047 }, { 0x80000000000000ffULL, 0x1048 },
+    { 0x80000000000001ffULL, 0x1049 }, { 0x80000000000003ffULL, 0x104a },
+    { 0x80000000000007ffULL, 0x104b }, { 0x8000000000000fffULL, 0x104c },
+    { 0x8000000000001fffULL, 0x104d }, { 0x8000000000003fffULL, 0x104e },
+    { 0x8000000000007fffULL, 0x104f }, { 0x800000000000ffffULL, 0x1050 },
+    { 0x800000000001ffffULL, 0x1051 }, { 0x800000000003ffffULL, 0x1052 },
+    { 0x800000000007ffffULL, 0x1053 }, { 0x80000000000fffffULL, 0x1054 },
+    { 0x80000000001fffffULL, 0x1055 }, { 0x80000000003fffffULL, 0x1056 },
+    { 0x80000000007fffffULL, 0x1057 }, { 0x8000000000ffffffULL, 0x1058 },
+    { 0x8000000001ffffffULL, 0x1059 }, { 0x8000000003ffffffULL, 0x105a },
+    { 0x8000000007ffffffULL, 0x105b }, { 0x800000000fffffffULL, 0x105c },
+    { 0x800000001fffffffULL, 0x105d }, { 0x800000003fffffffULL, 0x105e },
+    { 0x800000007fffffffULL, 0x105f }, { 0x8000000080000000ULL, 0x0040 },
+    { 0x80000000ffffffffULL, 0x1060 }, { 0x8000000180000001ULL, 0x0041 },
+    { 0x80000001ffffffffULL, 0x1061 }, { 0x8000000380000003ULL, 0x0042 },
+    { 0x80000003ffffffffULL, 0x1062 }, { 0x8000000780000007ULL, 0x0043 },
+    { 0x80000007ffffffffULL, 0x1063 }, { 0x8000000f8000000fULL, 0x0044 },
+    { 0x8000000fffffffffULL, 0x1064 }, { 0x8000001f8000001fULL, 0x0045 },
+    { 0x8000001fffffffffULL, 0x1065 }, { 0x8000003f8000003fULL, 0x0046 },
+    { 0x8000003fffffffffULL, 0x1066 }, { 0x8000007f8000007fULL, 0x0047 },
+    { 0x8000007fffffffffULL, 0x1067 }, { 0x800000ff800000ffULL, 0x0048 },
+    { 0x800000ffffffffffULL, 0x1068 }, { 0x800001ff800001ffULL, 0x0049 },
+    { 0x800001ffffffffffULL, 0x1069 }, { 0x800003ff800003ffULL, 0x004a },
+    { 0x800003ffffffffffULL, 0x106a }, { 0x800007ff800007ffULL, 0x004b },
+    { 0x800007ffffffffffULL, 0x106b }, { 0x80000fff80000fffULL, 0x004c },
+    { 0x80000fffffffffffULL, 0x106c }, { 0x80001fff80001fffULL, 0x004d },
+    { 0x80001fffffffffffULL, 0x106d }, { 0x80003fff80003fffULL, 0x004e },
+    { 0x80003fffffffffffULL, 0x106e }, { 0x80007fff80007fffULL, 0x004f },
+    { 0x80007fffffffffffULL, 0x106f }, { 0x8000800080008000ULL, 0x0060 },
+    { 0x8000ffff8000ffffULL, 0x0050 }, { 0x8000ffffffffffffULL, 0x1070 },
+    { 0x8001800180018001ULL, 0x0061 }, { 0x8001ffff8001ffffULL, 0x0051 },
+    { 0x8001ffffffffffffULL, 0x1071 }, { 0x8003800380038003ULL, 0x0062 },
+    { 0x8003ffff8003ffffULL, 0x0052 }, { 0x8003ffffffffffffULL, 0x1072 },
+    { 0x8007800780078007ULL, 0x0063 }, { 0x8007ffff8007ffffULL, 0x0053 },
+    { 0x8007ffffffffffffULL, 0x1073 }, { 0x800f800f800f800fULL, 0x0064 },
+    { 0x800fffff800fffffULL, 0x0054 }, { 0x800fffffffffffffULL, 0x1074 },
+    { 0x801f801f801f801fULL, 0x0065 }, { 0x801fffff801fffffULL, 0x0055 },
+    { 0x801fffffffffffffULL, 0x1075 }, { 0x803f803f803f803fULL, 0x0066 },
+    { 0x803fffff803fffffULL, 0x0056 }, { 0x803fffffffffffffULL, 0x1076 },
+    { 0x807f807f807f807fULL, 0x0067 }, { 0x807fffff807fffffULL, 0x0057 },
+    { 0x807fffffffffffffULL, 0x1077 }, { 0x8080808080808080ULL, 0x0070 },
+    { 0x80ff80ff80ff80ffULL, 0x0068 }, { 0x80ffffff80ffffffULL, 0x0058 },
+    { 0x80ffffffffffffffULL, 0x1078 }, { 0x8181818181818181ULL, 0x0071 },
+    { 0x81ff81ff81ff81ffULL, 0x0069 }, { 0x81ffffff81ffffffULL, 0x0059 },
+    { 0x81ffffffffffffffULL, 0x1079 }, { 0x8383838383838383ULL, 0x0072 },
+    { 0x83ff83ff83ff83ffULL, 0x006a }, { 0x83ffffff83ffffffULL, 0x005a },
+    { 0x83ffffffffffffffULL, 0x107a }, { 0x8787878787878787ULL, 0x0073 },
+    { 0x87ff87ff87ff87ffULL, 0x006b }, { 0x87ffffff87ffffffULL, 0x005b },
+    { 0x87ffffffffffffffULL, 0x107b }, { 0x8888888888888888ULL, 0x0078 },
+    { 0x8f8f8f8f8f8f8f8fULL, 0x0074 }, { 0x8fff8fff8fff8fffULL, 0x006c },
+    { 0x8fffffff8fffffffULL, 0x005c }, { 0x8fffffffffffffffULL, 0x107c },
+    { 0x9999999999999999ULL, 0x0079 }, { 0x9f9f9f9f9f9f9f9fULL, 0x0075 },
+    { 0x9fff9fff9fff9fffULL, 0x006d }, { 0x9fffffff9fffffffULL, 0x005d },
+    { 0x9fffffffffffffffULL, 0x107d }, { 0xaaaaaaaaaaaaaaaaULL, 0x007c },
+    { 0xbbbbbbbbbbbbbbbbULL, 0x007a }, { 0xbfbfbfbfbfbfbfbfULL, 0x0076 },
+    { 0xbfffbfffbfffbfffULL, 0x006e }, { 0xbfffffffbfffffffULL, 0x005e },
+    { 0xbfffffffffffffffULL, 0x107e }, { 0xc000000000000000ULL, 0x1081 },
+    { 0xc000000000000001ULL, 0x1082 }, { 0xc000000000000003ULL, 0x1083 },
+    { 0xc000000000000007ULL, 0x1084 }, { 0xc00000000000000fULL, 0x1085 },
+    { 0xc00000000000001fULL, 0x1086 }, { 0xc00000000000003fULL, 0x1087 },
+    { 0xc00000000000007fULL, 0x1088 }, { 0xc0000000000000ffULL, 0x1089 },
+    { 0xc0000000000001ffULL, 0x108a }, { 0xc0000000000003ffULL, 0x108b },
+    { 0xc0000000000007ffULL, 0x108c }, { 0xc000000000000fffULL, 0x108d },
+    { 0xc000000000001fffULL, 0x108e }, { 0xc000000000003fffULL, 0x108f },
+    { 0xc000000000007fffULL, 0x1090 }, { 0xc00000000000ffffULL, 0x1091 },
+    { 0xc00000000001ffffULL, 0x1092 }, { 0xc00000000003ffffULL, 0x1093 },
+    { 0xc00000000007ffffULL, 0x1094 }, { 0xc0000000000fffffULL, 0x1095 },
+    { 0xc0000000001fffffULL, 0x1096 }, { 0xc0000000003fffffULL, 0x1097 },
+    { 0xc0000000007fffffULL, 0x1098 }, { 0xc000000000ffffffULL, 0x1099 },
+    { 0xc000000001ffffffULL, 0x109a }, { 0xc000000003ffffffULL, 0x109b },
+    { 0xc000000007ffffffULL, 0x109c }, { 0xc00000000fffffffULL, 0x109d },
+    { 0xc00000001fffffffULL, 0x109e }, { 0xc00000003fffffffULL, 0x109f },
+    { 0xc00000007fffffffULL, 0x10a0 }, { 0xc0000000c0000000ULL, 0x0081 },
+    { 0xc0000000ffffffffULL, 0x10a1 }, { 0xc0000001c0000001ULL, 0x0082 },
+    { 0xc0000001ffffffffULL, 0x10a2 }, { 0xc0000003c0000003ULL, 0x0083 },
+    { 0xc0000003ffffffffULL, 0x10a3 }, { 0xc0000007c0000007ULL, 0x0084 },
+    { 0xc0000007ffffffffULL, 0x10a4 }, { 0xc000000fc000000fULL, 0x0085 },
+    { 0xc000000fffffffffULL, 0x10a5 }, { 0xc000001fc000001fULL, 0x0086 },
+    { 0xc000001fffffffffULL, 0x10a6 }, { 0xc000003fc000003fULL, 0x0087 },
+    { 0xc000003fffffffffULL, 0x10a7 }, { 0xc000007fc000007fULL, 0x0088 },
+    { 0xc000007fffffffffULL, 0x10a8 }, { 0xc00000ffc00000ffULL, 0x0089 },
+    { 0xc00000ffffffffffULL, 0x10a9 }, { 0xc00001ffc00001ffULL, 0x008a },
+    { 0xc00001ffffffffffULL, 0x10aa }, { 0xc00003ffc00003ffULL, 0x008b },
+    { 0xc00003ffffffffffULL, 0x10ab }, { 0xc00007ffc00007ffULL, 0x008c },
+    { 0xc00007ffffffffffULL, 0x10ac }, { 0xc0000fffc0000fffULL, 0x008d },
+    { 0xc0000fffffffffffULL, 0x10ad }, { 0xc0001fffc0001fffULL, 0x008e },
+    { 0xc0001fffffffffffULL, 0x10ae }, { 0xc0003fffc0003fffULL, 0x008f },
+    { 0xc0003fffffffffffULL, 0x10af }, { 0xc0007fffc0007fffULL, 0x0090 },
+    { 0xc0007fffffffffffULL, 0x10b0 }, { 0xc000c000c000c000ULL, 0x00a1 },
+    { 0xc000ffffc000ffffULL, 0x0091 }, { 0xc000ffffffffffffULL, 0x10b1 },
+    { 0xc001c001c001c001ULL, 0x00a2 }, { 0xc001ffffc001ffffULL, 0x0092 },
+    { 0xc001ffffffffffffULL, 0x10b2 }, { 0xc003c003c003c003ULL, 0x00a3 },
+    { 0xc003ffffc003ffffULL, 0x0093 }, { 0xc003ffffffffffffULL, 0x10b3 },
+    { 0xc007c007c007c007ULL, 0x00a4 }, { 0xc007ffffc007ffffULL, 0x0094 },
+    { 0xc007ffffffffffffULL, 0x10b4 }, { 0xc00fc00fc00fc00fULL, 0x00a5 },
+    { 0xc00fffffc00fffffULL, 0x0095 }, { 0xc00fffffffffffffULL, 0x10b5 },
+    { 0xc01fc01fc01fc01fULL, 0x00a6 }, { 0xc01fffffc01fffffULL, 0x0096 },
+    { 0xc01fffffffffffffULL, 0x10b6 }, { 0xc03fc03fc03fc03fULL, 0x00a7 },
+    { 0xc03fffffc03fffffULL, 0x0097 }, { 0xc03fffffffffffffULL, 0x10b7 },
+    { 0xc07fc07fc07fc07fULL, 0x00a8 }, { 0xc07fffffc07fffffULL, 0x0098 },
+    { 0xc07fffffffffffffULL, 0x10b8 }, { 0xc0c0c0c0c0c0c0c0ULL, 0x00b1 },
+    { 0xc0ffc0ffc0ffc0ffULL, 0x00a9 }, { 0xc0ffffffc0ffffffULL, 0x0099 },
+    { 0xc0ffffffffffffffULL, 0x10b9 }, { 0xc1c1c1c1c1c1c1c1ULL, 0x00b2 },
+    { 0xc1ffc1ffc1ffc1ffULL, 0x00aa }, { 0xc1ffffffc1ffffffULL, 0x009a },
+    { 0xc1ffffffffffffffULL, 0x10ba }, { 0xc3c3c3c3c3c3c3c3ULL, 0x00b3 },
+    { 0xc3ffc3ffc3ffc3ffULL, 0x00ab }, { 0xc3ffffffc3ffffffULL, 0x009b },
+    { 0xc3ffffffffffffffULL, 0x10bb }, { 0xc7c7c7c7c7c7c7c7ULL, 0x00b4 },
+    { 0xc7ffc7ffc7ffc7ffULL, 0x00ac }, { 0xc7ffffffc7ffffffULL, 0x009c },
+    { 0xc7ffffffffffffffULL, 0x10bc }, { 0xccccccccccccccccULL, 0x00b9 },
+    { 0xcfcfcfcfcfcfcfcfULL, 0x00b5 }, { 0xcfffcfffcfffcfffULL, 0x00ad },
+    { 0xcfffffffcfffffffULL, 0x009d }, { 0xcfffffffffffffffULL, 0x10bd },
+    { 0xddddddddddddddddULL, 0x00ba }, { 0xdfdfdfdfdfdfdfdfULL, 0x00b6 },
+    { 0xdfffdfffdfffdfffULL, 0x00ae }, { 0xdfffffffdfffffffULL, 0x009e },
+    { 0xdfffffffffffffffULL, 0x10be }, { 0xe000000000000000ULL, 0x10c2 },
+    { 0xe000000000000001ULL, 0x10c3 }, { 0xe000000000000003ULL, 0x10c4 },
+    { 0xe000000000000007ULL, 0x10c5 }, { 0xe00000000000000fULL, 0x10c6 },
+    { 0xe00000000000001fULL, 0x10c7 }, { 0xe00000000000003fULL, 0x10c8 },
+    { 0xe00000000000007fULL, 0x10c9 }, { 0xe0000000000000ffULL, 0x10ca },
+    { 0xe0000000000001ffULL, 0x10cb }, { 0xe0000000000003ffULL, 0x10cc },
+    { 0xe0000000000007ffULL, 0x10cd }, { 0xe000000000000fffULL, 0x10ce },
+    { 0xe000000000001fffULL, 0x10cf }, { 0xe000000000003fffULL, 0x10d0 },
+    { 0xe000000000007fffULL, 0x10d1 }, { 0xe00000000000ffffULL, 0x10d2 },
+    { 0xe00000000001ffffULL, 0x10d3 }, { 0xe00000000003ffffULL, 0x10d4 },
+    { 0xe00000000007ffffULL, 0x10d5 }, { 0xe0000000000fffffULL, 0x10d6 },
+    { 0xe0000000001fffffULL, 0x10d7 }, { 0xe0000000003fffffULL, 0x10d8 },
+    { 0xe0000000007fffffULL, 0x10d9 }, { 0xe000000000ffffffULL, 0x10da },
+    { 0xe000000001ffffffULL, 0x10db }, { 0xe000000003ffffffULL, 0x10dc },
+    { 0xe000000007ffffffULL, 0x10dd }, { 0xe00000000fffffffULL, 0x10de },
+    { 0xe00000001fffffffULL, 0x10df }, { 0xe00000003fffffffULL, 0x10e0 },
+    { 0xe00000007fffffffULL, 0x10e1 }, { 0xe0000000e0000000ULL, 0x00c2 },
+    { 0xe0000000ffffffffULL, 0x10e2 }, { 0xe0000001e0000001ULL, 0x00c3 },
+    { 0xe0000001ffffffffULL, 0x10e3 }, { 0xe0000003e0000003ULL, 0x00c4 },
+    { 0xe0000003ffffffffULL, 0x10e4 }, { 0xe0000007e0000007ULL, 0x00c5 },
+    { 0xe0000007ffffffffULL, 0x10e5 }, { 0xe000000fe000000fULL, 0x00c6 },
+    { 0xe000000fffffffffULL, 0x10e6 }, { 0xe000001fe000001fULL, 0x00c7 },
+    { 0xe000001fffffffffULL, 0x10e7 }, { 0xe000003fe000003fULL, 0x00c8 },
+    { 0xe000003fffffffffULL, 0x10e8 }, { 0xe000007fe000007fULL, 0x00c9 },
+    { 0xe000007fffffffffULL, 0x10e9 }, { 0xe00000ffe00000ffULL, 0x00ca },
+    { 0xe00000ffffffffffULL, 0x10ea }, { 0xe00001ffe00001ffULL, 0x00cb },
+    { 0xe00001ffffffffffULL, 0x10eb }, { 0xe00003ffe00003ffULL, 0x00cc },
+    { 0xe00003ffffffffffULL, 0x10ec }, { 0xe00007ffe00007ffULL, 0x00cd },
+    { 0xe00007ffffffffffULL, 0x10ed }, { 0xe0000fffe0000fffULL, 0x00ce },
+    { 0xe0000fffffffffffULL, 0x10ee }, { 0xe0001fffe0001fffULL, 0x00cf },
+    { 0xe0001fffffffffffULL, 0x10ef }, { 0xe0003fffe0003fffULL, 0x00d0 },
+    { 0xe0003fffffffffffULL, 0x10f0 }, { 0xe0007fffe0007fffULL, 0x00d1 },
+    { 0xe0007fffffffffffULL, 0x10f1 }, { 0xe000e000e000e000ULL, 0x00e2 },
+    { 0xe000ffffe000ffffULL, 0x00d2 }, { 0xe000ffffffffffffULL, 0x10f2 },
+    { 0xe001e001e001e001ULL, 0x00e3 }, { 0xe001ffffe001ffffULL, 0x00d3 },
+    { 0xe001ffffffffffffULL, 0x10f3 }, { 0xe003e003e003e003ULL, 0x00e4 },
+    { 0xe003ffffe003ffffULL, 0x00d4 }, { 0xe003ffffffffffffULL, 0x10f4 },
+    { 0xe007e007e007e007ULL, 0x00e5 }, { 0xe007ffffe007ffffULL, 0x00d5 },
+    { 0xe007ffffffffffffULL, 0x10f5 }, { 0xe00fe00fe00fe00fULL, 0x00e6 },
+    { 0xe00fffffe00fffffULL, 0x00d6 }, { 0xe00fffffffffffffULL, 0x10f6 },
+    { 0xe01fe01fe01fe01fULL, 0x00e7 }, { 0xe01fffffe01fffffULL, 0x00d7 },
+    { 0xe01fffffffffffffULL, 0x10f7 }, { 0xe03fe03fe03fe03fULL, 0x00e8 },
+    { 0xe03fffffe03fffffULL, 0x00d8 }, { 0xe03fffffffffffffULL, 0x10f8 },
+    { 0xe07fe07fe07fe07fULL, 0x00e9 }, { 0xe07fffffe07fffffULL, 0x00d9 },
+    { 0xe07fffffffffffffULL, 0x10f9 }, { 0xe0e0e0e0e0e0e0e0ULL, 0x00f2 },
+    { 0xe0ffe0ffe0ffe0ffULL, 0x00ea }, { 0xe0ffffffe0ffffffULL, 0x00da },
+    { 0xe0ffffffffffffffULL, 0x10fa }, { 0xe1e1e1e1e1e1e1e1ULL, 0x00f3 },
+    { 0xe1ffe1ffe1ffe1ffULL, 0x00eb }, { 0xe1ffffffe1ffffffULL, 0x00db },
+    { 0xe1ffffffffffffffULL, 0x10fb }, { 0xe3e3e3e3e3e3e3e3ULL, 0x00f4 },
+    { 0xe3ffe3ffe3ffe3ffULL, 0x00ec }, { 0xe3ffffffe3ffffffULL, 0x00dc },
+    { 0xe3ffffffffffffffULL, 0x10fc }, { 0xe7e7e7e7e7e7e7e7ULL, 0x00f5 },
+    { 0xe7ffe7ffe7ffe7ffULL, 0x00ed }, { 0xe7ffffffe7ffffffULL, 0x00dd },
+    { 0xe7ffffffffffffffULL, 0x10fd }, { 0xeeeeeeeeeeeeeeeeULL, 0x00fa },
+    { 0xefefefefefefefefULL, 0x00f6 }, { 0xefffefffefffefffULL, 0x00ee },
+    { 0xefffffffefffffffULL, 0x00de }, { 0xefffffffffffffffULL, 0x10fe },
+    { 0xf000000000000000ULL, 0x1103 }, { 0xf000000000000001ULL, 0x1104 },
+    { 0xf000000000000003ULL, 0x1105 }, { 0xf000000000000007ULL, 0x1106 },
+    { 0xf00000000000000fULL, 0x1107 }, { 0xf00000000000001fULL, 0x1108 },
+    { 0xf00000000000003fULL, 0x1109 }, { 0xf00000000000007fULL, 0x110a },
+    { 0xf0000000000000ffULL, 0x110b }, { 0xf0000000000001ffULL, 0x110c },
+    { 0xf0000000000003ffULL, 0x110d }, { 0xf0000000000007ffULL, 0x110e },
+    { 0xf000000000000fffULL, 0x110f }, { 0xf000000000001fffULL, 0x1110 },
+    { 0xf000000000003fffULL, 0x1111 }, { 0xf000000000007fffULL, 0x1112 },
+    { 0xf00000000000ffffULL, 0x1113 }, { 0xf00000000001ffffULL, 0x1114 },
+    { 0xf00000000003ffffULL, 0x1115 }, { 0xf00000000007ffffULL, 0x1116 },
+    { 0xf0000000000fffffULL, 0x1117 }, { 0xf0000000001fffffULL, 0x1118 },
+    { 0xf0000000003fffffULL, 0x1119 }, { 0xf0000000007fffffULL, 0x111a },
+    { 0xf000000000ffffffULL, 0x111b }, { 0xf000000001ffffffULL, 0x111c },
+    { 0xf000000003ffffffULL, 0x111d }, { 0xf000000007ffffffULL, 0x111e },
+    { 0xf00000000fffffffULL, 0x111f }, { 0xf00000001fffffffULL, 0x1120 },
+    { 0xf00000003fffffffULL, 0x1121 }, { 0xf00000007fffffffULL, 0x1122 },
+    { 0xf0000000f0000000ULL, 0x0103 }, { 0xf0000000ffffffffULL, 0x1123 },
+    { 0xf0000001f0000001ULL, 0x0104 }, { 0xf0000001ffffffffULL, 0x1124 },
+    { 0xf0000003f0000003ULL, 0x0105 }, { 0xf0000003ffffffffULL, 0x1125 },
+    { 0xf0000007f0000007ULL, 0x0106 }, { 0xf0000007ffffffffULL, 0x1126 },
+    { 0xf000000ff000000fULL, 0x0107 }, { 0xf000000fffffffffULL, 0x1127 },
+    { 0xf000001ff000001fULL, 0x0108 }, { 0xf000001fffffffffULL, 0x1128 },
+    { 0xf000003ff000003fULL, 0x0109 }, { 0xf000003fffffffffULL, 0x1129 },
+    { 0xf000007ff000007fULL, 0x010a }, { 0xf000007fffffffffULL, 0x112a },
+    { 0xf00000fff00000ffULL, 0x010b }, { 0xf00000ffffffffffULL, 0x112b },
+    { 0xf00001fff00001ffULL, 0x010c }, { 0xf00001ffffffffffULL, 0x112c },
+    { 0xf00003fff00003ffULL, 0x010d }, { 0xf00003ffffffffffULL, 0x112d },
+    { 0xf00007fff00007ffULL, 0x010e }, { 0xf00007ffffffffffULL, 0x112e },
+    { 0xf0000ffff0000fffULL, 0x010f }, { 0xf0000fffffffffffULL, 0x112f },
+    { 0xf0001ffff0001fffULL, 0x0110 }, { 0xf0001fffffffffffULL, 0x1130 },
+    { 0xf0003ffff0003fffULL, 0x0111 }, { 0xf0003fffffffffffULL, 0x1131 },
+    { 0xf0007ffff0007fffULL, 0x0112 }, { 0xf0007fffffffffffULL, 0x1132 },
+    { 0xf000f000f000f000ULL, 0x0123 }, { 0xf000fffff000ffffULL, 0x0113 },
+    { 0xf000ffffffffffffULL, 0x1133 }, { 0xf001f001f001f001ULL, 0x0124 },
+    { 0xf001fffff001ffffULL, 0x0114 }, { 0xf001ffffffffffffULL, 0x1134 },
+    { 0xf003f003f003f003ULL, 0x0125 }, { 0xf003fffff003ffffULL, 0x0115 },
+    { 0xf003ffffffffffffULL, 0x1135 }, { 0xf007f007f007f007ULL, 0x0126 },
+    { 0xf007fffff007ffffULL, 0x0116 }, { 0xf007ffffffffffffULL, 0x1136 },
+    { 0xf00ff00ff00ff00fULL, 0x0127 }, { 0xf00ffffff00fffffULL, 0x0117 },
+    { 0xf00fffffffffffffULL, 0x1137 }, { 0xf01ff01ff01ff01fULL, 0x0128 },
+    { 0xf01ffffff01fffffULL, 0x0118 }, { 0xf01fffffffffffffULL, 0x1138 },
+    { 0xf03ff03ff03ff03fULL, 0x0129 }, { 0xf03ffffff03fffffULL, 0x0119 },
+    { 0xf03fffffffffffffULL, 0x1139 }, { 0xf07ff07ff07ff07fULL, 0x012a },
+    { 0xf07ffffff07fffffULL, 0x011a }, { 0xf07fffffffffffffULL, 0x113a },
+    { 0xf0f0f0f0f0f0f0f0ULL, 0x0133 }, { 0xf0fff0fff0fff0ffULL, 0x012b },
+    { 0xf0fffffff0ffffffULL, 0x011b }, { 0xf0ffffffffffffffULL, 0x113b },
+    { 0xf1f1f1f1f1f1f1f1ULL, 0x0134 }, { 0xf1fff1fff1fff1ffULL, 0x012c },
+    { 0xf1fffffff1ffffffULL, 0x011c }, { 0xf1ffffffffffffffULL, 0x113c },
+    { 0xf3f3f3f3f3f3f3f3ULL, 0x0135 }, { 0xf3fff3fff3fff3ffULL, 0x012d },
+    { 0xf3fffffff3ffffffULL, 0x011d }, { 0xf3ffffffffffffffULL, 0x113d },
+    { 0xf7f7f7f7f7f7f7f7ULL, 0x0136 }, { 0xf7fff7fff7fff7ffULL, 0x012e },
+    { 0xf7fffffff7ffffffULL, 0x011e }, { 0xf7ffffffffffffffULL, 0x113e },
+    { 0xf800000000000000ULL, 0x1144 }, { 0xf800000000000001ULL, 0x1145 },
+    { 0xf800000000000003ULL, 0x1146 }, { 0xf800000000000007ULL, 0x1147 },
+    { 0xf80000000000000fULL, 0x1148 }, { 0xf80000000000001fULL, 0x1149 },
+    { 0xf80000000000003fULL, 0x114a }, { 0xf80000000000007fULL, 0x114b },
+    { 0xf8000000000000ffULL, 0x114c }, { 0xf8000000000001ffULL, 0x114d },
+    { 0xf8000000000003ffULL, 0x114e }, { 0xf8000000000007ffULL, 0x114f },
+    { 0xf800000000000fffULL, 0x1150 }, { 0xf800000000001fffULL, 0x1151 },
+    { 0xf800000000003fffULL, 0x1152 }, { 0xf800000000007fffULL, 0x1153 },
+    { 0xf80000000000ffffULL, 0x1154 }, { 0xf80000000001ffffULL, 0x1155 },
+    { 0xf80000000003ffffULL, 0x1156 }, { 0xf80000000007ffffULL, 0x1157 },
+    { 0xf8000000000fffffULL, 0x1158 }, { 0xf8000000001fffffULL, 0x1159 },
+    { 0xf8000000003fffffULL, 0x115a }, { 0xf8000000007fffffULL, 0x115b },
+    { 0xf800000000ffffffULL, 0x115c }, { 0xf800000001ffffffULL, 0x115d },
+    { 0xf800000003ffffffULL, 0x115e }, { 0xf800000007ffffffULL, 0x115f },
+    { 0xf80000000fffffffULL, 0x1160 }, { 0xf80000001fffffffULL, 0x1161 },
+    { 0xf80000003fffffffULL, 0x1162 }, { 0xf80000007fffffffULL, 0x1163 },
+    { 0xf8000000f8000000ULL, 0x0144 }, { 0xf8000000ffffffffULL, 0x1164 },
+    { 0xf8000001f8000001ULL, 0x0145 }, { 0xf8000001ffffffffULL, 0x1165 },
+    { 0xf8000003f8000003ULL, 0x0146 }, { 0xf8000003ffffffffULL, 0x1166 },
+    { 0xf8000007f8000007ULL, 0x0147 }, { 0xf8000007ffffffffULL, 0x1167 },
+    { 0xf800000ff800000fULL, 0x0148 }, { 0xf800000fffffffffULL, 0x1168 },
+    { 0xf800001ff800001fULL, 0x0149 }, { 0xf800001fffffffffULL, 0x1169 },
+    { 0xf800003ff800003fULL, 0x014a }, { 0xf800003fffffffffULL, 0x116a },
+    { 0xf800007ff800007fULL, 0x014b }, { 0xf800007fffffffffULL, 0x116b },
+    { 0xf80000fff80000ffULL, 0x014c }, { 0xf80000ffffffffffULL, 0x116c },
+    { 0xf80001fff80001ffULL, 0x014d }, { 0xf80001ffffffffffULL, 0x116d },
+    { 0xf80003fff80003ffULL, 0x014e }, { 0xf80003ffffffffffULL, 0x116e },
+    { 0xf80007fff80007ffULL, 0x014f }, { 0xf80007ffffffffffULL, 0x116f },
+    { 0xf8000ffff8000fffULL, 0x0150 }, { 0xf8000fffffffffffULL, 0x1170 },
+    { 0xf8001ffff8001fffULL, 0x0151 }, { 0xf8001fffffffffffULL, 0x1171 },
+    { 0xf8003ffff8003fffULL, 0x0152 }, { 0xf8003fffffffffffULL, 0x1172 },
+    { 0xf8007ffff8007fffULL, 0x0153 }, { 0xf8007fffffffffffULL, 0x1173 },
+    { 0xf800f800f800f800ULL, 0x0164 }, { 0xf800fffff800ffffULL, 0x0154 },
+    { 0xf800ffffffffffffULL, 0x1174 }, { 0xf801f801f801f801ULL, 0x0165 },
+    { 0xf801fffff801ffffULL, 0x0155 }, { 0xf801ffffffffffffULL, 0x1175 },
+    { 0xf803f803f803f803ULL, 0x0166 }, { 0xf803fffff803ffffULL, 0x0156 },
+    { 0xf803ffffffffffffULL, 0x1176 }, { 0xf807f807f807f807ULL, 0x0167 },
+    { 0xf807fffff807ffffULL, 0x0157 }, { 0xf807ffffffffffffULL, 0x1177 },
+    { 0xf80ff80ff80ff80fULL, 0x0168 }, { 0xf80ffffff80fffffULL, 0x0158 },
+    { 0xf80fffffffffffffULL, 0x1178 }, { 0xf81ff81ff81ff81fULL, 0x0169 },
+    { 0xf81ffffff81fffffULL, 0x0159 }, { 0xf81fffffffffffffULL, 0x1179 },
+    { 0xf83ff83ff83ff83fULL, 0x016a }, { 0xf83ffffff83fffffULL, 0x015a },
+    { 0xf83fffffffffffffULL, 0x117a }, { 0xf87ff87ff87ff87fULL, 0x016b },
+    { 0xf87ffffff87fffffULL, 0x015b }, { 0xf87fffffffffffffULL, 0x117b },
+    { 0xf8f8f8f8f8f8f8f8ULL, 0x0174 }, { 0xf8fff8fff8fff8ffULL, 0x016c },
+    { 0xf8fffffff8ffffffULL, 0x015c }, { 0xf8ffffffffffffffULL, 0x117c },
+    { 0xf9f9f9f9f9f9f9f9ULL, 0x0175 }, { 0xf9fff9fff9fff9ffULL, 0x016d },
+    { 0xf9fffffff9ffffffULL, 0x015d }, { 0xf9ffffffffffffffULL, 0x117d },
+    { 0xfbfbfbfbfbfbfbfbULL, 0x0176 }, { 0xfbfffbfffbfffbffULL, 0x016e },
+    { 0xfbfffffffbffffffULL, 0x015e }, { 0xfbffffffffffffffULL, 0x117e },
+    { 0xfc00000000000000ULL, 0x1185 }, { 0xfc00000000000001ULL, 0x1186 },
+    { 0xfc00000000000003ULL, 0x1187 }, { 0xfc00000000000007ULL, 0x1188 },
+    { 0xfc0000000000000fULL, 0x1189 }, { 0xfc0000000000001fULL, 0x118a },
+    { 0xfc0000000000003fULL, 0x118b }, { 0xfc0000000000007fULL, 0x118c },
+    { 0xfc000000000000ffULL, 0x118d }, { 0xfc000000000001ffULL, 0x118e },
+    { 0xfc000000000003ffULL, 0x118f }, { 0xfc000000000007ffULL, 0x1190 },
+    { 0xfc00000000000fffULL, 0x1191 }, { 0xfc00000000001fffULL, 0x1192 },
+    { 0xfc00000000003fffULL, 0x1193 }, { 0xfc00000000007fffULL, 0x1194 },
+    { 0xfc0000000000ffffULL, 0x1195 }, { 0xfc0000000001ffffULL, 0x1196 },
+    { 0xfc0000000003ffffULL, 0x1197 }, { 0xfc0000000007ffffULL, 0x1198 },
+    { 0xfc000000000fffffULL, 0x1199 }, { 0xfc000000001fffffULL, 0x119a },
+    { 0xfc000000003fffffULL, 0x119b }, { 0xfc000000007fffffULL, 0x119c },
+    { 0xfc00000000ffffffULL, 0x119d }, { 0xfc00000001ffffffULL, 0x119e },
+    { 0xfc00000003ffffffULL, 0x119f }, { 0xfc00000007ffffffULL, 0x11a0 },
+    { 0xfc0000000fffffffULL, 0x11a1 }, { 0xfc0000001fffffffULL, 0x11a2 },
+    { 0xfc0000003fffffffULL, 0x11a3 }, { 0xfc0000007fffffffULL, 0x11a4 },
+    { 0xfc000000fc000000ULL, 0x0185 }, { 0xfc000000ffffffffULL, 0x11a5 },
+    { 0xfc000001fc000001ULL, 0x0186 }, { 0xfc000001ffffffffULL, 0x11a6 },
+    { 0xfc000003fc000003ULL, 0x0187 }, { 0xfc000003ffffffffULL, 0x11a7 },
+    { 0xfc000007fc000007ULL, 0x0188 }, { 0xfc000007ffffffffULL, 0x11a8 },
+    { 0xfc00000ffc00000fULL, 0x0189 }, { 0xfc00000fffffffffULL, 0x11a9 },
+    { 0xfc00001ffc00001fULL, 0x018a }, { 0xfc00001fffffffffULL, 0x11aa },
+    { 0xfc00003ffc00003fULL, 0x018b }, { 0xfc00003fffffffffULL, 0x11ab },
+    { 0xfc00007ffc00007fULL, 0x018c }, { 0xfc00007fffffffffULL, 0x11ac },
+    { 0xfc0000fffc0000ffULL, 0x018d }, { 0xfc0000ffffffffffULL, 0x11ad },
+    { 0xfc0001fffc0001ffULL, 0x018e }, { 0xfc0001ffffffffffULL, 0x11ae },
+    { 0xfc0003fffc0003ffULL, 0x018f }, { 0xfc0003ffffffffffULL, 0x11af },
+    { 0xfc0007fffc0007ffULL, 0x0190 }, { 0xfc0007ffffffffffULL, 0x11b0 },
+    { 0xfc000ffffc000fffULL, 0x0191 }, { 0xfc000fffffffffffULL, 0x11b1 },
+    { 0xfc001ffffc001fffULL, 0x0192 }, { 0xfc001fffffffffffULL, 0x11b2 },
+    { 0xfc003ffffc003fffULL, 0x0193 }, { 0xfc003fffffffffffULL, 0x11b3 },
+    { 0xfc007ffffc007fffULL, 0x0194 }, { 0xfc007fffffffffffULL, 0x11b4 },
+    { 0xfc00fc00fc00fc00ULL, 0x01a5 }, { 0xfc00fffffc00ffffULL, 0x0195 },
+    { 0xfc00ffffffffffffULL, 0x11b5 }, { 0xfc01fc01fc01fc01ULL, 0x01a6 },
+    { 0xfc01fffffc01ffffULL, 0x0196 }, { 0xfc01ffffffffffffULL, 0x11b6 },
+    { 0xfc03fc03fc03fc03ULL, 0x01a7 }, { 0xfc03fffffc03ffffULL, 0x0197 },
+    { 0xfc03ffffffffffffULL, 0x11b7 }, { 0xfc07fc07fc07fc07ULL, 0x01a8 },
+    { 0xfc07fffffc07ffffULL, 0x0198 }, { 0xfc07ffffffffffffULL, 0x11b8 },
+    { 0xfc0ffc0ffc0ffc0fULL, 0x01a9 }, { 0xfc0ffffffc0fffffULL, 0x0199 },
+    { 0xfc0fffffffffffffULL, 0x11b9 }, { 0xfc1ffc1ffc1ffc1fULL, 0x01aa },
+    { 0xfc1ffffffc1fffffULL, 0x019a }, { 0xfc1fffffffffffffULL, 0x11ba },
+    { 0xfc3ffc3ffc3ffc3fULL, 0x01ab }, { 0xfc3ffffffc3fffffULL, 0x019b },
+    { 0xfc3fffffffffffffULL, 0x11bb }, { 0xfc7ffc7ffc7ffc7fULL, 0x01ac },
+    { 0xfc7ffffffc7fffffULL, 0x019c }, { 0xfc7fffffffffffffULL, 0x11bc },
+    { 0xfcfcfcfcfcfcfcfcULL, 0x01b5 }, { 0xfcfffcfffcfffcffULL, 0x01ad },
+    { 0xfcfffffffcffffffULL, 0x019d }, { 0xfcffffffffffffffULL, 0x11bd },
+    { 0xfdfdfdfdfdfdfdfdULL, 0x01b6 }, { 0xfdfffdfffdfffdffULL, 0x01ae },
+    { 0xfdfffffffdffffffULL, 0x019e }, { 0xfdffffffffffffffULL, 0x11be },
+    { 0xfe00000000000000ULL, 0x11c6 }, { 0xfe00000000000001ULL, 0x11c7 },
+    { 0xfe00000000000003ULL, 0x11c8 }, { 0xfe00000000000007ULL, 0x11c9 },
+    { 0xfe0000000000000fULL, 0x11ca }, { 0xfe0000000000001fULL, 0x11cb },
+    { 0xfe0000000000003fULL, 0x11cc }, { 0xfe0000000000007fULL, 0x11cd },
+    { 0xfe000000000000ffULL, 0x11ce }, { 0xfe000000000001ffULL, 0x11cf },
+    { 0xfe000000000003ffULL, 0x11d0 }, { 0xfe000000000007ffULL, 0x11d1 },
+    { 0xfe00000000000fffULL, 0x11d2 }, { 0xfe00000000001fffULL, 0x11d3 },
+    { 0xfe00000000003fffULL, 0x11d4 }, { 0xfe00000000007fffULL, 0x11d5 },
+    { 0xfe0000000000ffffULL, 0x11d6 }, { 0xfe0000000001ffffULL, 0x11d7 },
+    { 0xfe0000000003ffffULL, 0x11d8 }, { 0xfe0000000007ffffULL, 0x11d9 },
+    { 0xfe000000000fffffULL, 0x11da }, { 0xfe000000001fffffULL, 0x11db },
+    { 0xfe000000003fffffULL, 0x11dc }, { 0xfe000000007fffffULL, 0x11dd },
+    { 0xfe00000000ffffffULL, 0x11de }, { 0xfe00000001ffffffULL, 0x11df },
+    { 0xfe00000003ffffffULL, 0x11e0 }, { 0xfe00000007ffffffULL, 0x11e1 },
+    { 0xfe0000000fffffffULL, 0x11e2 }, { 0xfe0000001fffffffULL, 0x11e3 },
+    { 0xfe0000003fffffffULL, 0x11e4 }, { 0xfe0000007fffffffULL, 0x11e5 },
+    { 0xfe000000fe000000ULL, 0x01c6 }, { 0xfe000000ffffffffULL, 0x11e6 },
+    { 0xfe000001fe000001ULL, 0x01c7 }, { 0xfe000001ffffffffULL, 0x11e7 },
+    { 0xfe000003fe000003ULL, 0x01c8 }, { 0xfe000003ffffffffULL, 0x11e8 },
+    { 0xfe000007fe000007ULL, 0x01c9 }, { 0xfe000007ffffffffULL, 0x11e9 },
+    { 0xfe00000ffe00000fULL, 0x01ca }, { 0xfe00000fffffffffULL, 0x11ea },
+    { 0xfe00001ffe00001fULL, 0x01cb }, { 0xfe00001fffffffffULL, 0x11eb },
+    { 0xfe00003ffe00003fULL, 0x01cc }, { 0xfe00003fffffffffULL, 0x11ec },
+    { 0xfe00007ffe00007fULL, 0x01cd }, { 0xfe00007fffffffffULL, 0x11ed },
+    { 0xfe0000fffe0000ffULL, 0x01ce }, { 0xfe0000ffffffffffULL, 0x11ee },
+    { 0xfe0001fffe0001ffULL, 0x01cf }, { 0xfe0001ffffffffffULL, 0x11ef },
+    { 0xfe0003fffe0003ffULL, 0x01d0 }, { 0xfe0003ffffffffffULL, 0x11f0 },
+    { 0xfe0007fffe0007ffULL, 0x01d1 }, { 0xfe0007ffffffffffULL, 0x11f1 },
+    { 0xfe000ffffe000fffULL, 0x01d2 }, { 0xfe000fffffffffffULL, 0x11f2 },
+    { 0xfe001ffffe001fffULL, 0x01d3 }, { 0xfe001fffffffffffULL, 0x11f3 },
+    { 0xfe003ffffe003fffULL, 0x01d4 }, { 0xfe003fffffffffffULL, 0x11f4 },
+    { 0xfe007ffffe007fffULL, 0x01d5 }, { 0xfe007fffffffffffULL, 0x11f5 },
+    { 0xfe00fe00fe00fe00ULL, 0x01e6 }, { 0xfe00fffffe00ffffULL, 0x01d6 },
+    { 0xfe00ffffffffffffULL, 0x11f6 }, { 0xfe01fe01fe01fe01ULL, 0x01e7 },
+    { 0xfe01fffffe01ffffULL, 0x01d7 }, { 0xfe01ffffffffffffULL, 0x11f7 },
+    { 0xfe03fe03fe03fe03ULL, 0x01e8 }, { 0xfe03fffffe03ffffULL, 0x01d8 },
+    { 0xfe03ffffffffffffULL, 0x11f8 }, { 0xfe07fe07fe07fe07ULL, 0x01e9 },
+    { 0xfe07fffffe07ffffULL, 0x01d9 }, { 0xfe07ffffffffffffULL, 0x11f9 },
+    { 0xfe0ffe0ffe0ffe0fULL, 0x01ea }, { 0xfe0ffffffe0fffffULL, 0x01da },
+    { 0xfe0fffffffffffffULL, 0x11fa }, { 0xfe1ffe1ffe1ffe1fULL, 0x01eb },
+    { 0xfe1ffffffe1fffffULL, 0x01db }, { 0xfe1fffffffffffffULL, 0x11fb },
+    { 0xfe3ffe3ffe3ffe3fULL, 0x01ec }, { 0xfe3ffffffe3fffffULL, 0x01dc },
+    { 0xfe3fffffffffffffULL, 0x11fc }, { 0xfe7ffe7ffe7ffe7fULL, 0x01ed },
+    { 0xfe7ffffffe7fffffULL, 0x01dd }, { 0xfe7fffffffffffffULL, 0x11fd },
+    { 0xfefefefefefefefeULL, 0x01f6 }, { 0xfefffefffefffeffULL, 0x01ee },
+    { 0xfefffffffeffffffULL, 0x01de }, { 0xfeffffffffffffffULL, 0x11fe },
+    { 0xff00000000000000ULL, 0x1207 }, { 0xff00000000000001ULL, 0x1208 },
+    { 0xff00000000000003ULL, 0x1209 }, { 0xff00000000000007ULL, 0x120a },
+    { 0xff0000000000000fULL, 0x120b }, { 0xff0000000000001fULL, 0x120c },
+    { 0xff0000000000003fULL, 0x120d }, { 0xff0000000000007fULL, 0x120e },
+    { 0xff000000000000ffULL, 0x120f }, { 0xff000000000001ffULL, 0x1210 },
+    { 0xff000000000003ffULL, 0x1211 }, { 0xff000000000007ffULL, 0x1212 },
+    { 0xff00000000000fffULL, 0x1213 }, { 0xff00000000001fffULL, 0x1214 },
+    { 0xff00000000003fffULL, 0x1215 }, { 0xff00000000007fffULL, 0x1216 },
+    { 0xff0000000000ffffULL, 0x1217 }, { 0xff0000000001ffffULL, 0x1218 },
+    { 0xff0000000003ffffULL, 0x1219 }, { 0xff0000000007ffffULL, 0x121a },
+    { 0xff000000000fffffULL, 0x121b }, { 0xff000000001fffffULL, 0x121c },
+    { 0xff000000003fffffULL, 0x121d }, { 0xff000000007fffffULL, 0x121e },
+    { 0xff00000000ffffffULL, 0x121f }, { 0xff00000001ffffffULL, 0x1220 },
+    { 0xff00000003ffffffULL, 0x1221 }, { 0xff00000007ffffffULL, 0x1222 },
+    { 0xff0000000fffffffULL, 0x1223 }, { 0xff0000001fffffffULL, 0x1224 },
+    { 0xff0000003fffffffULL, 0x1225 }, { 0xff0000007fffffffULL, 0x1226 },
+    { 0xff000000ff000000ULL, 0x0207 }, { 0xff000000ffffffffULL, 0x1227 },
+    { 0xff000001ff000001ULL, 0x0208 }, { 0xff000001ffffffffULL, 0x1228 },
+    { 0xff000003ff000003ULL, 0x0209 }, { 0xff000003ffffffffULL, 0x1229 },
+    { 0xff000007ff000007ULL, 0x020a }, { 0xff000007ffffffffULL, 0x122a },
+    { 0xff00000fff00000fULL, 0x020b }, { 0xff00000fffffffffULL, 0x122b },
+    { 0xff00001fff00001fULL, 0x020c }, { 0xff00001fffffffffULL, 0x122c },
+    { 0xff00003fff00003fULL, 0x020d }, { 0xff00003fffffffffULL, 0x122d },
+    { 0xff00007fff00007fULL, 0x020e }, { 0xff00007fffffffffULL, 0x122e },
+    { 0xff0000ffff0000ffULL, 0x020f }, { 0xff0000ffffffffffULL, 0x122f },
+    { 0xff0001ffff0001ffULL, 0x0210 }, { 0xff0001ffffffffffULL, 0x1230 },
+    { 0xff0003ffff0003ffULL, 0x0211 }, { 0xff0003ffffffffffULL, 0x1231 },
+    { 0xff0007ffff0007ffULL, 0x0212 }, { 0xff0007ffffffffffULL, 0x1232 },
+    { 0xff000fffff000fffULL, 0x0213 }, { 0xff000fffffffffffULL, 0x1233 },
+    { 0xff001fffff001fffULL, 0x0214 }, { 0xff001fffffffffffULL, 0x1234 },
+    { 0xff003fffff003fffULL, 0x0215 }, { 0xff003fffffffffffULL, 0x1235 },
+    { 0xff007fffff007fffULL, 0x0216 }, { 0xff007fffffffffffULL, 0x1236 },
+    { 0xff00ff00ff00ff00ULL, 0x0227 }, { 0xff00ffffff00ffffULL, 0x0217 },
+    { 0xff00ffffffffffffULL, 0x1237 }, { 0xff01ff01ff01ff01ULL, 0x0228 },
+    { 0xff01ffffff01ffffULL, 0x0218 }, { 0xff01ffffffffffffULL, 0x1238 },
+    { 0xff03ff03ff03ff03ULL, 0x0229 }, { 0xff03ffffff03ffffULL, 0x0219 },
+    { 0xff03ffffffffffffULL, 0x1239 }, { 0xff07ff07ff07ff07ULL, 0x022a },
+    { 0xff07ffffff07ffffULL, 0x021a }, { 0xff07ffffffffffffULL, 0x123a },
+    { 0xff0fff0fff0fff0fULL, 0x022b }, { 0xff0fffffff0fffffULL, 0x021b },
+    { 0xff0fffffffffffffULL, 0x123b }, { 0xff1fff1fff1fff1fULL, 0x022c },
+    { 0xff1fffffff1fffffULL, 0x021c }, { 0xff1fffffffffffffULL, 0x123c },
+    { 0xff3fff3fff3fff3fULL, 0x022d }, { 0xff3fffffff3fffffULL, 0x021d },
+    { 0xff3fffffffffffffULL, 0x123d }, { 0xff7fff7fff7fff7fULL, 0x022e },
+    { 0xff7fffffff7fffffULL, 0x021e }, { 0xff7fffffffffffffULL, 0x123e },
+    { 0xff80000000000000ULL, 0x1248 }, { 0xff80000000000001ULL, 0x1249 },
+    { 0xff80000000000003ULL, 0x124a }, { 0xff80000000000007ULL, 0x124b },
+    { 0xff8000000000000fULL, 0x124c }, { 0xff8000000000001fULL, 0x124d },
+    { 0xff8000000000003fULL, 0x124e }, { 0xff8000000000007fULL, 0x124f },
+    { 0xff800000000000ffULL, 0x1250 }, { 0xff800000000001ffULL, 0x1251 },
+    { 0xff800000000003ffULL, 0x1252 }, { 0xff800000000007ffULL, 0x1253 },
+    { 0xff80000000000fffULL, 0x1254 }, { 0xff80000000001fffULL, 0x1255 },
+    { 0xff80000000003fffULL, 0x1256 }, { 0xff80000000007fffULL, 0x1257 },
+    { 0xff8000000000ffffULL, 0x1258 }, { 0xff8000000001ffffULL, 0x1259 },
+    { 0xff8000000003ffffULL, 0x125a }, { 0xff8000000007ffffULL, 0x125b },
+    { 0xff800000000fffffULL, 0x125c }, { 0xff800000001fffffULL, 0x125d },
+    { 0xff800000003fffffULL, 0x125e }, { 0xff800000007fffffULL, 0x125f },
+    { 0xff80000000ffffffULL, 0x1260 }, { 0xff80000001ffffffULL, 0x1261 },
+    { 0xff80000003ffffffULL, 0x1262 }, { 0xff80000007ffffffULL, 0x1263 },
+    { 0xff8000000fffffffULL, 0x1264 }, { 0xff8000001fffffffULL, 0x1265 },
+    { 0xff8000003fffffffULL, 0x1266 }, { 0xff8000007fffffffULL, 0x1267 },
+    { 0xff800000ff800000ULL, 0x0248 }, { 0xff800000ffffffffULL, 0x1268 },
+    { 0xff800001ff800001ULL, 0x0249 }, { 0xff800001ffffffffULL, 0x1269 },
+    { 0xff800003ff800003ULL, 0x024a }, { 0xff800003ffffffffULL, 0x126a },
+    { 0xff800007ff800007ULL, 0x024b }, { 0xff800007ffffffffULL, 0x126b },
+    { 0xff80000fff80000fULL, 0x024c }, { 0xff80000fffffffffULL, 0x126c },
+    { 0xff80001fff80001fULL, 0x024d }, { 0xff80001fffffffffULL, 0x126d },
+    { 0xff80003fff80003fULL, 0x024e }, { 0xff80003fffffffffULL, 0x126e },
+    { 0xff80007fff80007fULL, 0x024f }, { 0xff80007fffffffffULL, 0x126f },
+    { 0xff8000ffff8000ffULL, 0x0250 }, { 0xff8000ffffffffffULL, 0x1270 },
+    { 0xff8001ffff8001ffULL, 0x0251 }, { 0xff8001ffffffffffULL, 0x1271 },
+    { 0xff8003ffff8003ffULL, 0x0252 }, { 0xff8003ffffffffffULL, 0x1272 },
+    { 0xff8007ffff8007ffULL, 0x0253 }, { 0xff8007ffffffffffULL, 0x1273 },
+    { 0xff800fffff800fffULL, 0x0254 }, { 0xff800fffffffffffULL, 0x1274 },
+    { 0xff801fffff801fffULL, 0x0255 }, { 0xff801fffffffffffULL, 0x1275 },
+    { 0xff803fffff803fffULL, 0x0256 }, { 0xff803fffffffffffULL, 0x1276 },
+    { 0xff807fffff807fffULL, 0x0257 }, { 0xff807fffffffffffULL, 0x1277 },
+    { 0xff80ff80ff80ff80ULL, 0x0268 }, { 0xff80ffffff80ffffULL, 0x0258 },
+    { 0xff80ffffffffffffULL, 0x1278 }, { 0xff81ff81ff81ff81ULL, 0x0269 },
+    { 0xff81ffffff81ffffULL, 0x0259 }, { 0xff81ffffffffffffULL, 0x1279 },
+    { 0xff83ff83ff83ff83ULL, 0x026a }, { 0xff83ffffff83ffffULL, 0x025a },
+    { 0xff83ffffffffffffULL, 0x127a }, { 0xff87ff87ff87ff87ULL, 0x026b },
+    { 0xff87ffffff87ffffULL, 0x025b }, { 0xff87ffffffffffffULL, 0x127b },
+    { 0xff8fff8fff8fff8fULL, 0x026c }, { 0xff8fffffff8fffffULL, 0x025c },
+    { 0xff8fffffffffffffULL, 0x127c }, { 0xff9fff9fff9fff9fULL, 0x026d },
+    { 0xff9fffffff9fffffULL, 0x025d }, { 0xff9fffffffffffffULL, 0x127d },
+    { 0xffbfffbfffbfffbfULL, 0x026e }, { 0xffbfffffffbfffffULL, 0x025e },
+    { 0xffbfffffffffffffULL, 0x127e }, { 0xffc0000000000000ULL, 0x1289 },
+    { 0xffc0000000000001ULL, 0x128a }, { 0xffc0000000000003ULL, 0x128b },
+    { 0xffc0000000000007ULL, 0x128c }, { 0xffc000000000000fULL, 0x128d },
+    { 0xffc000000000001fULL, 0x128e }, { 0xffc000000000003fULL, 0x128f },
+    { 0xffc000000000007fULL, 0x1290 }, { 0xffc00000000000ffULL, 0x1291 },
+    { 0xffc00000000001ffULL, 0x1292 }, { 0xffc00000000003ffULL, 0x1293 },
+    { 0xffc00000000007ffULL, 0x1294 }, { 0xffc0000000000fffULL, 0x1295 },
+    { 0xffc0000000001fffULL, 0x1296 }, { 0xffc0000000003fffULL, 0x1297 },
+    { 0xffc0000000007fffULL, 0x1298 }, { 0xffc000000000ffffULL, 0x1299 },
+    { 0xffc000000001ffffULL, 0x129a }, { 0xffc000000003ffffULL, 0x129b },
+    { 0xffc000000007ffffULL, 0x129c }, { 0xffc00000000fffffULL, 0x129d },
+    { 0xffc00000001fffffULL, 0x129e }, { 0xffc00000003fffffULL, 0x129f },
+    { 0xffc00000007fffffULL, 0x12a0 }, { 0xffc0000000ffffffULL, 0x12a1 },
+    { 0xffc0000001ffffffULL, 0x12a2 }, { 0xffc0000003ffffffULL, 0x12a3 },
+    { 0xffc0000007ffffffULL, 0x12a4 }, { 0xffc000000fffffffULL, 0x12a5 },
+    { 0xffc000001fffffffULL, 0x12a6 }, { 0xffc000003fffffffULL, 0x12a7 },
+    { 0xffc000007fffffffULL, 0x12a8 }, { 0xffc00000ffc00000ULL, 0x0289 },
+    { 0xffc00000ffffffffULL, 0x12a9 }, { 0xffc00001ffc00001ULL, 0x028a },
+    { 0xffc00001ffffffffULL, 0x12aa }, { 0xffc00003ffc00003ULL, 0x028b },
+    { 0xffc00003ffffffffULL, 0x12ab }, { 0xffc00007ffc00007ULL, 0x028c },
+    { 0xffc00007ffffffffULL, 0x12ac }, { 0xffc0000fffc0000fULL, 0x028d },
+    { 0xffc0000fffffffffULL, 0x12ad }, { 0xffc0001fffc0001fULL, 0x028e },
+    { 0xffc0001fffffffffULL, 0x12ae }, { 0xffc0003fffc0003fULL, 0x028f },
+    { 0xffc0003fffffffffULL, 0x12af }, { 0xffc0007fffc0007fULL, 0x0290 },
+    { 0xffc0007fffffffffULL, 0x12b0 }, { 0xffc000ffffc000ffULL, 0x0291 },
+    { 0xffc000ffffffffffULL, 0x12b1 }, { 0xffc001ffffc001ffULL, 0x0292 },
+    { 0xffc001ffffffffffULL, 0x12b2 }, { 0xffc003ffffc003ffULL, 0x0293 },
+    { 0xffc003ffffffffffULL, 0x12b3 }, { 0xffc007ffffc007ffULL, 0x0294 },
+    { 0xffc007ffffffffffULL, 0x12b4 }, { 0xffc00fffffc00fffULL, 0x0295 },
+    { 0xffc00fffffffffffULL, 0x12b5 }, { 0xffc01fffffc01fffULL, 0x0296 },
+    { 0xffc01fffffffffffULL, 0x12b6 }, { 0xffc03fffffc03fffULL, 0x0297 },
+    { 0xffc03fffffffffffULL, 0x12b7 }, { 0xffc07fffffc07fffULL, 0x0298 },
+    { 0xffc07fffffffffffULL, 0x12b8 }, { 0xffc0ffc0ffc0ffc0ULL, 0x02a9 },
+    { 0xffc0ffffffc0ffffULL, 0x0299 }, { 0xffc0ffffffffffffULL, 0x12b9 },
+    { 0xffc1ffc1ffc1ffc1ULL, 0x02aa }, { 0xffc1ffffffc1ffffULL, 0x029a },
+    { 0xffc1ffffffffffffULL, 0x12ba }, { 0xffc3ffc3ffc3ffc3ULL, 0x02ab },
+    { 0xffc3ffffffc3ffffULL, 0x029b }, { 0xffc3ffffffffffffULL, 0x12bb },
+    { 0xffc7ffc7ffc7ffc7ULL, 0x02ac }, { 0xffc7ffffffc7ffffULL, 0x029c },
+    { 0xffc7ffffffffffffULL, 0x12bc }, { 0xffcfffcfffcfffcfULL, 0x02ad },
+    { 0xffcfffffffcfffffULL, 0x029d }, { 0xffcfffffffffffffULL, 0x12bd },
+    { 0xffdfffdfffdfffdfULL, 0x02ae }, { 0xffdfffffffdfffffULL, 0x029e },
+    { 0xffdfffffffffffffULL, 0x12be }, { 0xffe0000000000000ULL, 0x12ca },
+    { 0xffe0000000000001ULL, 0x12cb }, { 0xffe0000000000003ULL, 0x12cc },
+    { 0xffe0000000000007ULL, 0x12cd }, { 0xffe000000000000fULL, 0x12ce },
+    { 0xffe000000000001fULL, 0x12cf }, { 0xffe000000000003fULL, 0x12d0 },
+    { 0xffe000000000007fULL, 0x12d1 }, { 0xffe00000000000ffULL, 0x12d2 },
+    { 0xffe00000000001ffULL, 0x12d3 }, { 0xffe00000000003ffULL, 0x12d4 },
+    { 0xffe00000000007ffULL, 0x12d5 }, { 0xffe0000000000fffULL, 0x12d6 },
+    { 0xffe0000000001fffULL, 0x12d7 }, { 0xffe0000000003fffULL, 0x12d8 },
+    { 0xffe0000000007fffULL, 0x12d9 }, { 0xffe000000000ffffULL, 0x12da },
+    { 0xffe000000001ffffULL, 0x12db }, { 0xffe000000003ffffULL, 0x12dc },
+    { 0xffe000000007ffffULL, 0x12dd }, { 0xffe00000000fffffULL, 0x12de },
+    { 0xffe00000001fffffULL, 0x12df }, { 0xffe00000003fffffULL, 0x12e0 },
+    { 0xffe00000007fffffULL, 0x12e1 }, { 0xffe0000000ffffffULL, 0x12e2 },
+    { 0xffe0000001ffffffULL, 0x12e3 }, { 0xffe0000003ffffffULL, 0x12e4 },
+    { 0xffe0000007ffffffULL, 0x12e5 }, { 0xffe000000fffffffULL, 0x12e6 },
+    { 0xffe000001fffffffULL, 0x12e7 }, { 0xffe000003fffffffULL, 0x12e8 },
+    { 0xffe000007fffffffULL, 0x12e9 }, { 0xffe00000ffe00000ULL, 0x02ca },
+    { 0xffe00000ffffffffULL, 0x12ea }, { 0xffe00001ffe00001ULL, 0x02cb },
+    { 0xffe00001ffffffffULL, 0x12eb }, { 0xffe00003ffe00003ULL, 0x02cc },
+    { 0xffe00003ffffffffULL, 0x12ec }, { 0xffe00007ffe00007ULL, 0x02cd },
+    { 0xffe00007ffffffffULL, 0x12ed }, { 0xffe0000fffe0000fULL, 0x02ce },
+    { 0xffe0000fffffffffULL, 0x12ee }, { 0xffe0001fffe0001fULL, 0x02cf },
+    { 0xffe0001fffffffffULL, 0x12ef }, { 0xffe0003fffe0003fULL, 0x02d0 },
+    { 0xffe0003fffffffffULL, 0x12f0 }, { 0xffe0007fffe0007fULL, 0x02d1 },
+    { 0xffe0007fffffffffULL, 0x12f1 }, { 0xffe000ffffe000ffULL, 0x02d2 },
+    { 0xffe000ffffffffffULL, 0x12f2 }, { 0xffe001ffffe001ffULL, 0x02d3 },
+    { 0xffe001ffffffffffULL, 0x12f3 }, { 0xffe003ffffe003ffULL, 0x02d4 },
+    { 0xffe003ffffffffffULL, 0x12f4 }, { 0xffe007ffffe007ffULL, 0x02d5 },
+    { 0xffe007ffffffffffULL, 0x12f5 }, { 0xffe00fffffe00fffULL, 0x02d6 },
+    { 0xffe00fffffffffffULL, 0x12f6 }, { 0xffe01fffffe01fffULL, 0x02d7 },
+    { 0xffe01fffffffffffULL, 0x12f7 }, { 0xffe03fffffe03fffULL, 0x02d8 },
+    { 0xffe03fffffffffffULL, 0x12f8 }, { 0xffe07fffffe07fffULL, 0x02d9 },
+    { 0xffe07fffffffffffULL, 0x12f9 }, { 0xffe0ffe0ffe0ffe0ULL, 0x02ea },
+    { 0xffe0ffffffe0ffffULL, 0x02da }, { 0xffe0ffffffffffffULL, 0x12fa },
+    { 0xffe1ffe1ffe1ffe1ULL, 0x02eb }, { 0xffe1ffffffe1ffffULL, 0x02db },
+    { 0xffe1ffffffffffffULL, 0x12fb }, { 0xffe3ffe3ffe3ffe3ULL, 0x02ec },
+    { 0xffe3ffffffe3ffffULL, 0x02dc }, { 0xffe3ffffffffffffULL, 0x12fc },
+    { 0xffe7ffe7ffe7ffe7ULL, 0x02ed }, { 0xffe7ffffffe7ffffULL, 0x02dd },
+    { 0xffe7ffffffffffffULL, 0x12fd }, { 0xffefffefffefffefULL, 0x02ee },
+    { 0xffefffffffefffffULL, 0x02de }, { 0xffefffffffffffffULL, 0x12fe },
+    { 0xfff0000000000000ULL, 0x130b }, { 0xfff0000000000001ULL, 0x130c },
+    { 0xfff0000000000003ULL, 0x130d }, { 0xfff0000000000007ULL, 0x130e },
+    { 0xfff000000000000fULL, 0x130f }, { 0xfff000000000001fULL, 0x1310 },
+    { 0xfff000000000003fULL, 0x1311 }, { 0xfff000000000007fULL, 0x1312 },
+    { 0xfff00000000000ffULL, 0x1313 }, { 0xfff00000000001ffULL, 0x1314 },
+    { 0xfff00000000003ffULL, 0x1315 }, { 0xfff00000000007ffULL, 0x1316 },
+    { 0xfff0000000000fffULL, 0x1317 }, { 0xfff0000000001fffULL, 0x1318 },
+    { 0xfff0000000003fffULL, 0x1319 }, { 0xfff0000000007fffULL, 0x131a },
+    { 0xfff000000000ffffULL, 0x131b }, { 0xfff000000001ffffULL, 0x131c },
+    { 0xfff000000003ffffULL, 0x131d }, { 0xfff000000007ffffULL, 0x131e },
+    { 0xfff00000000fffffULL, 0x131f }, { 0xfff00000001fffffULL, 0x1320 },
+    { 0xfff00000003fffffULL, 0x1321 }, { 0xfff00000007fffffULL, 0x1322 },
+    { 0xfff0000000ffffffULL, 0x1323 }, { 0xfff0000001ffffffULL, 0x1324 },
+    { 0xfff0000003ffffffULL, 0x1325 }, { 0xfff0000007ffffffULL, 0x1326 },
+    { 0xfff000000fffffffULL, 0x1327 }, { 0xfff000001fffffffULL, 0x1328 },
+    { 0xfff000003fffffffULL, 0x1329 }, { 0xfff000007fffffffULL, 0x132a },
+    { 0xfff00000fff00000ULL, 0x030b }, { 0xfff00000ffffffffULL, 0x132b },
+    { 0xfff00001fff00001ULL, 0x030c }, { 0xfff00001ffffffffULL, 0x132c },
+    { 0xfff00003fff00003ULL, 0x030d }, { 0xfff00003ffffffffULL, 0x132d },
+    { 0xfff00007fff00007ULL, 0x030e }, { 0xfff00007ffffffffULL, 0x132e },
+    { 0xfff0000ffff0000fULL, 0x030f }, { 0xfff0000fffffffffULL, 0x132f },
+    { 0xfff0001ffff0001fULL, 0x0310 }, { 0xfff0001fffffffffULL, 0x1330 },
+    { 0xfff0003ffff0003fULL, 0x0311 }, { 0xfff0003fffffffffULL, 0x1331 },
+    { 0xfff0007ffff0007fULL, 0x0312 }, { 0xfff0007fffffffffULL, 0x1332 },
+    { 0xfff000fffff000ffULL, 0x0313 }, { 0xfff000ffffffffffULL, 0x1333 },
+    { 0xfff001fffff001ffULL, 0x0314 }, { 0xfff001ffffffffffULL, 0x1334 },
+    { 0xfff003fffff003ffULL, 0x0315 }, { 0xfff003ffffffffffULL, 0x1335 },
+    { 0xfff007fffff007ffULL, 0x0316 }, { 0xfff007ffffffffffULL, 0x1336 },
+    { 0xfff00ffffff00fffULL, 0x0317 }, { 0xfff00fffffffffffULL, 0x1337 },
+    { 0xfff01ffffff01fffULL, 0x0318 }, { 0xfff01fffffffffffULL, 0x1338 },
+    { 0xfff03ffffff03fffULL, 0x0319 }, { 0xfff03fffffffffffULL, 0x1339 },
+    { 0xfff07ffffff07fffULL, 0x031a }, { 0xfff07fffffffffffULL, 0x133a },
+    { 0xfff0fff0fff0fff0ULL, 0x032b }, { 0xfff0fffffff0ffffULL, 0x031b },
+    { 0xfff0ffffffffffffULL, 0x133b }, { 0xfff1fff1fff1fff1ULL, 0x032c },
+    { 0xfff1fffffff1ffffULL, 0x031c }, { 0xfff1ffffffffffffULL, 0x133c },
+    { 0xfff3fff3fff3fff3ULL, 0x032d }, { 0xfff3fffffff3ffffULL, 0x031d },
+    { 0xfff3ffffffffffffULL, 0x133d }, { 0xfff7fff7fff7fff7ULL, 0x032e },
+    { 0xfff7fffffff7ffffULL, 0x031e }, { 0xfff7ffffffffffffULL, 0x133e },
+    { 0xfff8000000000000ULL, 0x134c }, { 0xfff8000000000001ULL, 0x134d },
+    { 0xfff8000000000003ULL, 0x134e }, { 0xfff8000000000007ULL, 0x134f },
+    { 0xfff800000000000fULL, 0x1350 }, { 0xfff800000000001fULL, 0x1351 },
+    { 0xfff800000000003fULL, 0x1352 }, { 0xfff800000000007fULL, 0x1353 },
+    { 0xfff80000000000ffULL, 0x1354 }, { 0xfff80000000001ffULL, 0x1355 },
+    { 0xfff80000000003ffULL, 0x1356 }, { 0xfff80000000007ffULL, 0x1357 },
+    { 0xfff8000000000fffULL, 0x1358 }, { 0xfff8000000001fffULL, 0x1359 },
+    { 0xfff8000000003fffULL, 0x135a }, { 0xfff8000000007fffULL, 0x135b },
+    { 0xfff800000000ffffULL, 0x135c }, { 0xfff800000001ffffULL, 0x135d },
+    { 0xfff800000003ffffULL, 0x135e }, { 0xfff800000007ffffULL, 0x135f },
+    { 0xfff80000000fffffULL, 0x1360 }, { 0xfff80000001fffffULL, 0x1361 },
+    { 0xfff80000003fffffULL, 0x1362 }, { 0xfff80000007fffffULL, 0x1363 },
+    { 0xfff8000000ffffffULL, 0x1364 }, { 0xfff8000001ffffffULL, 0x1365 },
+    { 0xfff8000003ffffffULL, 0x1366 }, { 0xfff8000007ffffffULL, 0x1367 },
+    { 0xfff800000fffffffULL, 0x1368 }, { 0xfff800001fffffffULL, 0x1369 },
+    { 0xfff800003fffffffULL, 0x136a }, { 0xfff800007fffffffULL, 0x136b },
+    { 0xfff80000fff80000ULL, 0x034c }, { 0xfff80000ffffffffULL, 0x136c },
+    { 0xfff80001fff80001ULL, 0x034d }, { 0xfff80001ffffffffULL, 0x136d },
+    { 0xfff80003fff80003ULL, 0x034e }, { 0xfff80003ffffffffULL, 0x136e },
+    { 0xfff80007fff80007ULL, 0x034f }, { 0xfff80007ffffffffULL, 0x136f },
+    { 0xfff8000ffff8000fULL, 0x0350 }, { 0xfff8000fffffffffULL, 0x1370 },
+    { 0xfff8001ffff8001fULL, 0x0351 }, { 0xfff8001fffffffffULL, 0x1371 },
+    { 0xfff8003ffff8003fULL, 0x0352 }, { 0xfff8003fffffffffULL, 0x1372 },
+    { 0xfff8007ffff8007fULL, 0x0353 }, { 0xfff8007fffffffffULL, 0x1373 },
+    { 0xfff800fffff800ffULL, 0x0354 }, { 0xfff800ffffffffffULL, 0x1374 },
+    { 0xfff801fffff801ffULL, 0x0355 }, { 0xfff801ffffffffffULL, 0x1375 },
+    { 0xfff803fffff803ffULL, 0x0356 }, { 0xfff803ffffffffffULL, 0x1376 },
+    { 0xfff807fffff807ffULL, 0x0357 }, { 0xfff807ffffffffffULL, 0x1377 },
+    { 0xfff80ffffff80fffULL, 0x0358 }, { 0xfff80fffffffffffULL, 0x1378 },
+    { 0xfff81ffffff81fffULL, 0x0359 }, { 0xfff81fffffffffffULL, 0x1379 },
+    { 0xfff83ffffff83fffULL, 0x035a }, { 0xfff83fffffffffffULL, 0x137a },
+    { 0xfff87ffffff87fffULL, 0x035b }, { 0xfff87fffffffffffULL, 0x137b },
+    { 0xfff8fff8fff8fff8ULL, 0x036c }, { 0xfff8fffffff8ffffULL, 0x035c },
+    { 0xfff8ffffffffffffULL, 0x137c }, { 0xfff9fff9fff9fff9ULL, 0x036d },
+    { 0xfff9fffffff9ffffULL, 0x035d }, { 0xfff9ffffffffffffULL, 0x137d },
+    { 0xfffbfffbfffbfffbULL, 0x036e }, { 0xfffbfffffffbffffULL, 0x035e },
+    { 0xfffbffffffffffffULL, 0x137e }, { 0xfffc000000000000ULL, 0x138d },
+    { 0xfffc000000000001ULL, 0x138e }, { 0xfffc000000000003ULL, 0x138f },
+    { 0xfffc000000000007ULL, 0x1390 }, { 0xfffc00000000000fULL, 0x1391 },
+    { 0xfffc00000000001fULL, 0x1392 }, { 0xfffc00000000003fULL, 0x1393 },
+    { 0xfffc00000000007fULL, 0x1394 }, { 0xfffc0000000000ffULL, 0x1395 },
+    { 0xfffc0000000001ffULL, 0x1396 }, { 0xfffc0000000003ffULL, 0x1397 },
+    { 0xfffc0000000007ffULL, 0x1398 }, { 0xfffc000000000fffULL, 0x1399 },
+    { 0xfffc000000001fffULL, 0x139a }, { 0xfffc000000003fffULL, 0x139b },
+    { 0xfffc000000007fffULL, 0x139c }, { 0xfffc00000000ffffULL, 0x139d },
+    { 0xfffc00000001ffffULL, 0x139e }, { 0xfffc00000003ffffULL, 0x139f },
+    { 0xfffc00000007ffffULL, 0x13a0 }, { 0xfffc0000000fffffULL, 0x13a1 },
+    { 0xfffc0000001fffffULL, 0x13a2 }, { 0xfffc0000003fffffULL, 0x13a3 },
+    { 0xfffc0000007fffffULL, 0x13a4 }, { 0xfffc000000ffffffULL, 0x13a5 },
+    { 0xfffc000001ffffffULL, 0x13a6 }, { 0xfffc000003ffffffULL, 0x13a7 },
+    { 0xfffc000007ffffffULL, 0x13a8 }, { 0xfffc00000fffffffULL, 0x13a9 },
+    { 0xfffc00001fffffffULL, 0x13aa }, { 0xfffc00003fffffffULL, 0x13ab },
+    { 0xfffc00007fffffffULL, 0x13ac }, { 0xfffc0000fffc0000ULL, 0x038d },
+    { 0xfffc0000ffffffffULL, 0x13ad }, { 0xfffc0001fffc0001ULL, 0x038e },
+    { 0xfffc0001ffffffffULL, 0x13ae }, { 0xfffc0003fffc0003ULL, 0x038f },
+    { 0xfffc0003ffffffffULL, 0x13af }, { 0xfffc0007fffc0007ULL, 0x0390 },
+    { 0xfffc0007ffffffffULL, 0x13b0 }, { 0xfffc000ffffc000fULL, 0x0391 },
+    { 0xfffc000fffffffffULL, 0x13b1 }, { 0xfffc001ffffc001fULL, 0x0392 },
+    { 0xfffc001fffffffffULL, 0x13b2 }, { 0xfffc003ffffc003fULL, 0x0393 },
+    { 0xfffc003fffffffffULL, 0x13b3 }, { 0xfffc007ffffc007fULL, 0x0394 },
+    { 0xfffc007fffffffffULL, 0x13b4 }, { 0xfffc00fffffc00ffULL, 0x0395 },
+    { 0xfffc00ffffffffffULL, 0x13b5 }, { 0xfffc01fffffc01ffULL, 0x0396 },
+    { 0xfffc01ffffffffffULL, 0x13b6 }, { 0xfffc03fffffc03ffULL, 0x0397 },
+    { 0xfffc03ffffffffffULL, 0x13b7 }, { 0xfffc07fffffc07ffULL, 0x0398 },
+    { 0xfffc07ffffffffffULL, 0x13b8 }, { 0xfffc0ffffffc0fffULL, 0x0399 },
+    { 0xfffc0fffffffffffULL, 0x13b9 }, { 0xfffc1ffffffc1fffULL, 0x039a },
+    { 0xfffc1fffffffffffULL, 0x13ba }, { 0xfffc3ffffffc3fffULL, 0x039b },
+    { 0xfffc3fffffffffffULL, 0x13bb }, { 0xfffc7ffffffc7fffULL, 0x039c },
+    { 0xfffc7fffffffffffULL, 0x13bc }, { 0xfffcfffcfffcfffcULL, 0x03ad },
+    { 0xfffcfffffffcffffULL, 0x039d }, { 0xfffcffffffffffffULL, 0x13bd },
+    { 0xfffdfffdfffdfffdULL, 0x03ae }, { 0xfffdfffffffdffffULL, 0x039e },
+    { 0xfffdffffffffffffULL, 0x13be }, { 0xfffe000000000000ULL, 0x13ce },
+    { 0xfffe000000000001ULL, 0x13cf }, { 0xfffe000000000003ULL, 0x13d0 },
+    { 0xfffe000000000007ULL, 0x13d1 }, { 0xfffe00000000000fULL, 0x13d2 },
+    { 0xfffe00000000001fULL, 0x13d3 }, { 0xfffe00000000003fULL, 0x13d4 },
+    { 0xfffe00000000007fULL, 0x13d5 }, { 0xfffe0000000000ffULL, 0x13d6 },
+    { 0xfffe0000000001ffULL, 0x13d7 }, { 0xfffe0000000003ffULL, 0x13d8 },
+    { 0xfffe0000000007ffULL, 0x13d9 }, { 0xfffe000000000fffULL, 0x13da },
+    { 0xfffe000000001fffULL, 0x13db }, { 0xfffe000000003fffULL, 0x13dc },
+    { 0xfffe000000007fffULL, 0x13dd }, { 0xfffe00000000ffffULL, 0x13de },
+    { 0xfffe00000001ffffULL, 0x13df }, { 0xfffe00000003ffffULL, 0x13e0 },
+    { 0xfffe00000007ffffULL, 0x13e1 }, { 0xfffe0000000fffffULL, 0x13e2 },
+    { 0xfffe0000001fffffULL, 0x13e3 }, { 0xfffe0000003fffffULL, 0x13e4 },
+    { 0xfffe0000007fffffULL, 0x13e5 }, { 0xfffe000000ffffffULL, 0x13e6 },
+    { 0xfffe000001ffffffULL, 0x13e7 }, { 0xfffe000003ffffffULL, 0x13e8 },
+    { 0xfffe000007ffffffULL, 0x13e9 }, { 0xfffe00000fffffffULL, 0x13ea },
+    { 0xfffe00001fffffffULL, 0x13eb }, { 0xfffe00003fffffffULL, 0x13ec },
+    { 0xfffe00007fffffffULL, 0x13ed }, { 0xfffe0000fffe0000ULL, 0x03ce },
+    { 0xfffe0000ffffffffULL, 0x13ee }, { 0xfffe0001fffe0001ULL, 0x03cf },
+    { 0xfffe0001ffffffffULL, 0x13ef }, { 0xfffe0003fffe0003ULL, 0x03d0 },
+    { 0xfffe0003ffffffffULL, 0x13f0 }, { 0xfffe0007fffe0007ULL, 0x03d1 },
+    { 0xfffe0007ffffffffULL, 0x13f1 }, { 0xfffe000ffffe000fULL, 0x03d2 },
+    { 0xfffe000fffffffffULL, 0x13f2 }, { 0xfffe001ffffe001fULL, 0x03d3 },
+    { 0xfffe001fffffffffULL, 0x13f3 }, { 0xfffe003ffffe003fULL, 0x03d4 },
+    { 0xfffe003fffffffffULL, 0x13f4 }, { 0xfffe007ffffe007fULL, 0x03d5 },
+    { 0xfffe007fffffffffULL, 0x13f5 }, { 0xfffe00fffffe00ffULL, 0x03d6 },
+    { 0xfffe00ffffffffffULL, 0x13f6 }, { 0xfffe01fffffe01ffULL, 0x03d7 },
+    { 0xfffe01ffffffffffULL, 0x13f7 }, { 0xfffe03fffffe03ffULL, 0x03d8 },
+    { 0xfffe03ffffffffffULL, 0x13f8 }, { 0xfffe07fffffe07ffULL, 0x03d9 },
+    { 0xfffe07ffffffffffULL, 0x13f9 }, { 0xfffe0ffffffe0fffULL, 0x03da },
+    { 0xfffe0fffffffffffULL, 0x13fa }, { 0xfffe1ffffffe1fffULL, 0x03db },
+    { 0xfffe1fffffffffffULL, 0x13fb }, { 0xfffe3ffffffe3fffULL, 0x03dc },
+    { 0xfffe3fffffffffffULL, 0x13fc }, { 0xfffe7ffffffe7fffULL, 0x03dd },
+    { 0xfffe7fffffffffffULL, 0x13fd }, { 0xfffefffefffefffeULL, 0x03ee },
+    { 0xfffefffffffeffffULL, 0x03de }, { 0xfffeffffffffffffULL, 0x13fe },
+    { 0xffff000000000000ULL, 0x140f }, { 0xffff000000000001ULL, 0x1410 },
+    { 0xffff000000000003ULL, 0x1411 }, { 0xffff000000000007ULL, 0x1412 },
+    { 0xffff00000000000fULL, 0x1413 }, { 0xffff00000000001fULL, 0x1414 },
+    { 0xffff00000000003fULL, 0x1415 }, { 0xffff00000000007fULL, 0x1416 },
+    { 0xffff0000000000ffULL, 0x1417 }, { 0xffff0000000001ffULL, 0x1418 },
+    { 0xffff0000000003ffULL, 0x1419 }, { 0xffff0000000007ffULL, 0x141a },
+    { 0xffff000000000fffULL, 0x141b }, { 0xffff000000001fffULL, 0x141c },
+    { 0xffff000000003fffULL, 0x141d }, { 0xffff000000007fffULL, 0x141e },
+    { 0xffff00000000ffffULL, 0x141f }, { 0xffff00000001ffffULL, 0x1420 },
+    { 0xffff00000003ffffULL, 0x1421 }, { 0xffff00000007ffffULL, 0x1422 },
+    { 0xffff0000000fffffULL, 0x1423 }, { 0xffff0000001fffffULL, 0x1424 },
+    { 0xffff0000003fffffULL, 0x1425 }, { 0xffff0000007fffffULL, 0x1426 },
+    { 0xffff000000ffffffULL, 0x1427 }, { 0xffff000001ffffffULL, 0x1428 },
+    { 0xffff000003ffffffULL, 0x1429 }, { 0xffff000007ffffffULL, 0x142a },
+    { 0xffff00000fffffffULL, 0x142b }, { 0xffff00001fffffffULL, 0x142c },
+    { 0xffff00003fffffffULL, 0x142d }, { 0xffff00007fffffffULL, 0x142e },
+    { 0xffff0000ffff0000ULL, 0x040f }, { 0xffff0000ffffffffULL, 0x142f },
+    { 0xffff0001ffff0001ULL, 0x0410 }, { 0xffff0001ffffffffULL, 0x1430 },
+    { 0xffff0003ffff0003ULL, 0x0411 }, { 0xffff0003ffffffffULL, 0x1431 },
+    { 0xffff0007ffff0007ULL, 0x0412 }, { 0xffff0007ffffffffULL, 0x1432 },
+    { 0xffff000fffff000fULL, 0x0413 }, { 0xffff000fffffffffULL, 0x1433 },
+    { 0xffff001fffff001fULL, 0x0414 }, { 0xffff001fffffffffULL, 0x1434 },
+    { 0xffff003fffff003fULL, 0x0415 }, { 0xffff003fffffffffULL, 0x1435 },
+    { 0xffff007fffff007fULL, 0x0416 }, { 0xffff007fffffffffULL, 0x1436 },
+    { 0xffff00ffffff00ffULL, 0x0417 }, { 0xffff00ffffffffffULL, 0x1437 },
+    { 0xffff01ffffff01ffULL, 0x0418 }, { 0xffff01ffffffffffULL, 0x1438 },
+    { 0xffff03ffffff03ffULL, 0x0419 }, { 0xffff03ffffffffffULL, 0x1439 },
+    { 0xffff07ffffff07ffULL, 0x041a }, { 0xffff07ffffffffffULL, 0x143a },
+    { 0xffff0fffffff0fffULL, 0x041b }, { 0xffff0fffffffffffULL, 0x143b },
+    { 0xffff1fffffff1fffULL, 0x041c }, { 0xffff1fffffffffffULL, 0x143c },
+    { 0xffff3fffffff3fffULL, 0x041d }, { 0xffff3fffffffffffULL, 0x143d },
+    { 0xffff7fffffff7fffULL, 0x041e }, { 0xffff7fffffffffffULL, 0x143e },
+    { 0xffff800000000000ULL, 0x1450 }, { 0xffff800000000001ULL, 0x1451 },
+    { 0xffff800000000003ULL, 0x1452 }, { 0xffff800000000007ULL, 0x1453 },
+    { 0xffff80000000000fULL, 0x1454 }, { 0xffff80000000001fULL, 0x1455 },
+    { 0xffff80000000003fULL, 0x1456 }, { 0xffff80000000007fULL, 0x1457 },
+    { 0xffff8000000000ffULL, 0x1458 }, { 0xffff8000000001ffULL, 0x1459 },
+    { 0xffff8000000003ffULL, 0x145a }, { 0xffff8000000007ffULL, 0x145b },
+    { 0xffff800000000fffULL, 0x145c }, { 0xffff800000001fffULL, 0x145d },
+    { 0xffff800000003fffULL, 0x145e }, { 0xffff800000007fffULL, 0x145f },
+    { 0xffff80000000ffffULL, 0x1460 }, { 0xffff80000001ffffULL, 0x1461 },
+    { 0xffff80000003ffffULL, 0x1462 }, { 0xffff80000007ffffULL, 0x1463 },
+    { 0xffff8000000fffffULL, 0x1464 }, { 0xffff8000001fffffULL, 0x1465 },
+    { 0xffff8000003fffffULL, 0x1466 }, { 0xffff8000007fffffULL, 0x1467 },
+    { 0xffff800000ffffffULL, 0x1468 }, { 0xffff800001ffffffULL, 0x1469 },
+    { 0xffff800003ffffffULL, 0x146a }, { 0xffff800007ffffffULL, 0x146b },
+    { 0xffff80000fffffffULL, 0x146c }, { 0xffff80001fffffffULL, 0x146d },
+    { 0xffff80003fffffffULL, 0x146e }, { 0xffff80007fffffffULL, 0x146f },
+    { 0xffff8000ffff8000ULL, 0x0450 }, { 0xffff8000ffffffffULL, 0x1470 },
+    { 0xffff8001ffff8001ULL, 0x0451 }, { 0xffff8001ffffffffULL, 0x1471 },
+    { 0xffff8003ffff8003ULL, 0x0452 }, { 0xffff8003ffffffffULL, 0x1472 },
+    { 0xffff8007ffff8007ULL, 0x0453 }, { 0xffff8007ffffffffULL, 0x1473 },
+    { 0xffff800fffff800fULL, 0x0454 }, { 0xffff800fffffffffULL, 0x1474 },
+    { 0xffff801fffff801fULL, 0x0455 }, { 0xffff801fffffffffULL, 0x1475 },
+    { 0xffff803fffff803fULL, 0x0456 }, { 0xffff803fffffffffULL, 0x1476 },
+    { 0xffff807fffff807fULL, 0x0457 }, { 0xffff807fffffffffULL, 0x1477 },
+    { 0xffff80ffffff80ffULL, 0x0458 }, { 0xffff80ffffffffffULL, 0x1478 },
+    { 0xffff81ffffff81ffULL, 0x0459 }, { 0xffff81ffffffffffULL, 0x1479 },
+    { 0xffff83ffffff83ffULL, 0x045a }, { 0xffff83ffffffffffULL, 0x147a },
+    { 0xffff87ffffff87ffULL, 0x045b }, { 0xffff87ffffffffffULL, 0x147b },
+    { 0xffff8fffffff8fffULL, 0x045c }, { 0xffff8fffffffffffULL, 0x147c },
+    { 0xffff9fffffff9fffULL, 0x045d }, { 0xffff9fffffffffffULL, 0x147d },
+    { 0xffffbfffffffbfffULL, 0x045e }, { 0xffffbfffffffffffULL, 0x147e },
+    { 0xffffc00000000000ULL, 0x1491 }, { 0xffffc00000000001ULL, 0x1492 },
+    { 0xffffc00000000003ULL, 0x1493 }, { 0xffffc00000000007ULL, 0x1494 },
+    { 0xffffc0000000000fULL, 0x1495 }, { 0xffffc0000000001fULL, 0x1496 },
+    { 0xffffc0000000003fULL, 0x1497 }, { 0xffffc0000000007fULL, 0x1498 },
+    { 0xffffc000000000ffULL, 0x1499 }, { 0xffffc000000001ffULL, 0x149a },
+    { 0xffffc000000003ffULL, 0x149b }, { 0xffffc000000007ffULL, 0x149c },
+    { 0xffffc00000000fffULL, 0x149d }, { 0xffffc00000001fffULL, 0x149e },
+    { 0xffffc00000003fffULL, 0x149f }, { 0xffffc00000007fffULL, 0x14a0 },
+    { 0xffffc0000000ffffULL, 0x14a1 }, { 0xffffc0000001ffffULL, 0x14a2 },
+    { 0xffffc0000003ffffULL, 0x14a3 }, { 0xffffc0000007ffffULL, 0x14a4 },
+    { 0xffffc000000fffffULL, 0x14a5 }, { 0xffffc000001fffffULL, 0x14a6 },
+    { 0xffffc000003fffffULL, 0x14a7 }, { 0xffffc000007fffffULL, 0x14a8 },
+    { 0xffffc00000ffffffULL, 0x14a9 }, { 0xffffc00001ffffffULL, 0x14aa },
+    { 0xffffc00003ffffffULL, 0x14ab }, { 0xffffc00007ffffffULL, 0x14ac },
+    { 0xffffc0000fffffffULL, 0x14ad }, { 0xffffc0001fffffffULL, 0x14ae },
+    { 0xffffc0003fffffffULL, 0x14af }, { 0xffffc0007fffffffULL, 0x14b0 },
+    { 0xffffc000ffffc000ULL, 0x0491 }, { 0xffffc000ffffffffULL, 0x14b1 },
+    { 0xffffc001ffffc001ULL, 0x0492 }, { 0xffffc001ffffffffULL, 0x14b2 },
+    { 0xffffc003ffffc003ULL, 0x0493 }, { 0xffffc003ffffffffULL, 0x14b3 },
+    { 0xffffc007ffffc007ULL, 0x0494 }, { 0xffffc007ffffffffULL, 0x14b4 },
+    { 0xffffc00fffffc00fULL, 0x0495 }, { 0xffffc00fffffffffULL, 0x14b5 },
+    { 0xffffc01fffffc01fULL, 0x0496 }, { 0xffffc01fffffffffULL, 0x14b6 },
+    { 0xffffc03fffffc03fULL, 0x0497 }, { 0xffffc03fffffffffULL, 0x14b7 },
+    { 0xffffc07fffffc07fULL, 0x0498 }, { 0xffffc07fffffffffULL, 0x14b8 },
+    { 0xffffc0ffffffc0ffULL, 0x0499 }, { 0xffffc0ffffffffffULL, 0x14b9 },
+    { 0xffffc1ffffffc1ffULL, 0x049a }, { 0xffffc1ffffffffffULL, 0x14ba },
+    { 0xffffc3ffffffc3ffULL, 0x049b }, { 0xffffc3ffffffffffULL, 0x14bb },
+    { 0xffffc7ffffffc7ffULL, 0x049c }, { 0xffffc7ffffffffffULL, 0x14bc },
+    { 0xffffcfffffffcfffULL, 0x049d }, { 0xffffcfffffffffffULL, 0x14bd },
+    { 0xffffdfffffffdfffULL, 0x049e }, { 0xffffdfffffffffffULL, 0x14be },
+    { 0xffffe00000000000ULL, 0x14d2 }, { 0xffffe00000000001ULL, 0x14d3 },
+    { 0xffffe00000000003ULL, 0x14d4 }, { 0xffffe00000000007ULL, 0x14d5 },
+    { 0xffffe0000000000fULL, 0x14d6 }, { 0xffffe0000000001fULL, 0x14d7 },
+    { 0xffffe0000000003fULL, 0x14d8 }, { 0xffffe0000000007fULL, 0x14d9 },
+    { 0xffffe000000000ffULL, 0x14da }, { 0xffffe000000001ffULL, 0x14db },
+    { 0xffffe000000003ffULL, 0x14dc }, { 0xffffe000000007ffULL, 0x14dd },
+    { 0xffffe00000000fffULL, 0x14de }, { 0xffffe00000001fffULL, 0x14df },
+    { 0xffffe00000003fffULL, 0x14e0 }, { 0xffffe00000007fffULL, 0x14e1 },
+    { 0xffffe0000000ffffULL, 0x14e2 }, { 0xffffe0000001ffffULL, 0x14e3 },
+    { 0xffffe0000003ffffULL, 0x14e4 }, { 0xffffe0000007ffffULL, 0x14e5 },
+    { 0xffffe000000fffffULL, 0x14e6 }, { 0xffffe000001fffffULL, 0x14e7 },
+    { 0xffffe000003fffffULL, 0x14e8 }, { 0xffffe000007fffffULL, 0x14e9 },
+    { 0xffffe00000ffffffULL, 0x14ea }, { 0xffffe00001ffffffULL, 0x14eb },
+    { 0xffffe00003ffffffULL, 0x14ec }, { 0xffffe00007ffffffULL, 0x14ed },
+    { 0xffffe0000fffffffULL, 0x14ee }, { 0xffffe0001fffffffULL, 0x14ef },
+    { 0xffffe0003fffffffULL, 0x14f0 }, { 0xffffe0007fffffffULL, 0x14f1 },
+    { 0xffffe000ffffe000ULL, 0x04d2 }, { 0xffffe000ffffffffULL, 0x14f2 },
+    { 0xffffe001ffffe001ULL, 0x04d3 }, { 0xffffe001ffffffffULL, 0x14f3 },
+    { 0xffffe003ffffe003ULL, 0x04d4 }, { 0xffffe003ffffffffULL, 0x14f4 },
+    { 0xffffe007ffffe007ULL, 0x04d5 }, { 0xffffe007ffffffffULL, 0x14f5 },
+    { 0xffffe00fffffe00fULL, 0x04d6 }, { 0xffffe00fffffffffULL, 0x14f6 },
+    { 0xffffe01fffffe01fULL, 0x04d7 }, { 0xffffe01fffffffffULL, 0x14f7 },
+    { 0xffffe03fffffe03fULL, 0x04d8 }, { 0xffffe03fffffffffULL, 0x14f8 },
+    { 0xffffe07fffffe07fULL, 0x04d9 }, { 0xffffe07fffffffffULL, 0x14f9 },
+    { 0xffffe0ffffffe0ffULL, 0x04da }, { 0xffffe0ffffffffffULL, 0x14fa },
+    { 0xffffe1ffffffe1ffULL, 0x04db }, { 0xffffe1ffffffffffULL, 0x14fb },
+    { 0xffffe3ffffffe3ffULL, 0x04dc }, { 0xffffe3ffffffffffULL, 0x14fc },
+    { 0xffffe7ffffffe7ffULL, 0x04dd }, { 0xffffe7ffffffffffULL, 0x14fd },
+    { 0xffffefffffffefffULL, 0x04de }, { 0xffffefffffffffffULL, 0x14fe },
+    { 0xfffff00000000000ULL, 0x1513 }, { 0xfffff00000000001ULL, 0x1514 },
+    { 0xfffff00000000003ULL, 0x1515 }, { 0xfffff00000000007ULL, 0x1516 },
+    { 0xfffff0000000000fULL, 0x1517 }, { 0xfffff0000000001fULL, 0x1518 },
+    { 0xfffff0000000003fULL, 0x1519 }, { 0xfffff0000000007fULL, 0x151a },
+    { 0xfffff000000000ffULL, 0x151b }, { 0xfffff000000001ffULL, 0x151c },
+    { 0xfffff000000003ffULL, 0x151d }, { 0xfffff000000007ffULL, 0x151e },
+    { 0xfffff00000000fffULL, 0x151f }, { 0xfffff00000001fffULL, 0x1520 },
+    { 0xfffff00000003fffULL, 0x1521 }, { 0xfffff00000007fffULL, 0x1522 },
+    { 0xfffff0000000ffffULL, 0x1523 }, { 0xfffff0000001ffffULL, 0x1524 },
+    { 0xfffff0000003ffffULL, 0x1525 }, { 0xfffff0000007ffffULL, 0x1526 },
+    { 0xfffff000000fffffULL, 0x1527 }, { 0xfffff000001fffffULL, 0x1528 },
+    { 0xfffff000003fffffULL, 0x1529 }, { 0xfffff000007fffffULL, 0x152a },
+    { 0xfffff00000ffffffULL, 0x152b }, { 0xfffff00001ffffffULL, 0x152c },
+    { 0xfffff00003ffffffULL, 0x152d }, { 0xfffff00007ffffffULL, 0x152e },
+    { 0xfffff0000fffffffULL, 0x152f }, { 0xfffff0001fffffffULL, 0x1530 },
+    { 0xfffff0003fffffffULL, 0x1531 }, { 0xfffff0007fffffffULL, 0x1532 },
+    { 0xfffff000fffff000ULL, 0x0513 }, { 0xfffff000ffffffffULL, 0x1533 },
+    { 0xfffff001fffff001ULL, 0x0514 }, { 0xfffff001ffffffffULL, 0x1534 },
+    { 0xfffff003fffff003ULL, 0x0515 }, { 0xfffff003ffffffffULL, 0x1535 },
+    { 0xfffff007fffff007ULL, 0x0516 }, { 0xfffff007ffffffffULL, 0x1536 },
+    { 0xfffff00ffffff00fULL, 0x0517 }, { 0xfffff00fffffffffULL, 0x1537 },
+    { 0xfffff01ffffff01fULL, 0x0518 }, { 0xfffff01fffffffffULL, 0x1538 },
+    { 0xfffff03ffffff03fULL, 0x0519 }, { 0xfffff03fffffffffULL, 0x1539 },
+    { 0xfffff07ffffff07fULL, 0x051a }, { 0xfffff07fffffffffULL, 0x153a },
+    { 0xfffff0fffffff0ffULL, 0x051b }, { 0xfffff0ffffffffffULL, 0x153b },
+    { 0xfffff1fffffff1ffULL, 0x051c }, { 0xfffff1ffffffffffULL, 0x153c },
+    { 0xfffff3fffffff3ffULL, 0x051d }, { 0xfffff3ffffffffffULL, 0x153d },
+    { 0xfffff7fffffff7ffULL, 0x051e }, { 0xfffff7ffffffffffULL, 0x153e },
+    { 0xfffff80000000000ULL, 0x1554 }, { 0xfffff80000000001ULL, 0x1555 },
+    { 0xfffff80000000003ULL, 0x1556 }, { 0xfffff80000000007ULL, 0x1557 },
+    { 0xfffff8000000000fULL, 0x1558 }, { 0xfffff8000000001fULL, 0x1559 },
+    { 0xfffff8000000003fULL, 0x155a }, { 0xfffff8000000007fULL, 0x155b },
+    { 0xfffff800000000ffULL, 0x155c }, { 0xfffff800000001ffULL, 0x155d },
+    { 0xfffff800000003ffULL, 0x155e }, { 0xfffff800000007ffULL, 0x155f },
+    { 0xfffff80000000fffULL, 0x1560 }, { 0xfffff80000001fffULL, 0x1561 },
+    { 0xfffff80000003fffULL, 0x1562 }, { 0xfffff80000007fffULL, 0x1563 },
+    { 0xfffff8000000ffffULL, 0x1564 }, { 0xfffff8000001ffffULL, 0x1565 },
+    { 0xfffff8000003ffffULL, 0x1566 }, { 0xfffff8000007ffffULL, 0x1567 },
+    { 0xfffff800000fffffULL, 0x1568 }, { 0xfffff800001fffffULL, 0x1569 },
+    { 0xfffff800003fffffULL, 0x156a }, { 0xfffff800007fffffULL, 0x156b },
+    { 0xfffff80000ffffffULL, 0x156c }, { 0xfffff80001ffffffULL, 0x156d },
+    { 0xfffff80003ffffffULL, 0x156e }, { 0xfffff80007ffffffULL, 0x156f },
+    { 0xfffff8000fffffffULL, 0x1570 }, { 0xfffff8001fffffffULL, 0x1571 },
+    { 0xfffff8003fffffffULL, 0x1572 }, { 0xfffff8007fffffffULL, 0x1573 },
+    { 0xfffff800fffff800ULL, 0x0554 }, { 0xfffff800ffffffffULL, 0x1574 },
+    { 0xfffff801fffff801ULL, 0x0555 }, { 0xfffff801ffffffffULL, 0x1575 },
+    { 0xfffff803fffff803ULL, 0x0556 }, { 0xfffff803ffffffffULL, 0x1576 },
+    { 0xfffff807fffff807ULL, 0x0557 }, { 0xfffff807ffffffffULL, 0x1577 },
+    { 0xfffff80ffffff80fULL, 0x0558 }, { 0xfffff80fffffffffULL, 0x1578 },
+    { 0xfffff81ffffff81fULL, 0x0559 }, { 0xfffff81fffffffffULL, 0x1579 },
+    { 0xfffff83ffffff83fULL, 0x055a }, { 0xfffff83fffffffffULL, 0x157a },
+    { 0xfffff87ffffff87fULL, 0x055b }, { 0xfffff87fffffffffULL, 0x157b },
+    { 0xfffff8fffffff8ffULL, 0x055c }, { 0xfffff8ffffffffffULL, 0x157c },
+    { 0xfffff9fffffff9ffULL, 0x055d }, { 0xfffff9ffffffffffULL, 0x157d },
+    { 0xfffffbfffffffbffULL, 0x055e }, { 0xfffffbffffffffffULL, 0x157e },
+    { 0xfffffc0000000000ULL, 0x1595 }, { 0xfffffc0000000001ULL, 0x1596 },
+    { 0xfffffc0000000003ULL, 0x1597 }, { 0xfffffc0000000007ULL, 0x1598 },
+    { 0xfffffc000000000fULL, 0x1599 }, { 0xfffffc000000001fULL, 0x159a },
+    { 0xfffffc000000003fULL, 0x159b }, { 0xfffffc000000007fULL, 0x159c },
+    { 0xfffffc00000000ffULL, 0x159d }, { 0xfffffc00000001ffULL, 0x159e },
+    { 0xfffffc00000003ffULL, 0x159f }, { 0xfffffc00000007ffULL, 0x15a0 },
+    { 0xfffffc0000000fffULL, 0x15a1 }, { 0xfffffc0000001fffULL, 0x15a2 },
+    { 0xfffffc0000003fffULL, 0x15a3 }, { 0xfffffc0000007fffULL, 0x15a4 },
+    { 0xfffffc000000ffffULL, 0x15a5 }, { 0xfffffc000001ffffULL, 0x15a6 },
+    { 0xfffffc000003ffffULL, 0x15a7 }, { 0xfffffc000007ffffULL, 0x15a8 },
+    { 0xfffffc00000fffffULL, 0x15a9 }, { 0xfffffc00001fffffULL, 0x15aa },
+    { 0xfffffc00003fffffULL, 0x15ab }, { 0xfffffc00007fffffULL, 0x15ac },
+    { 0xfffffc0000ffffffULL, 0x15ad }, { 0xfffffc0001ffffffULL, 0x15ae },
+    { 0xfffffc0003ffffffULL, 0x15af }, { 0xfffffc0007ffffffULL, 0x15b0 },
+    { 0xfffffc000fffffffULL, 0x15b1 }, { 0xfffffc001fffffffULL, 0x15b2 },
+    { 0xfffffc003fffffffULL, 0x15b3 }, { 0xfffffc007fffffffULL, 0x15b4 },
+    { 0xfffffc00fffffc00ULL, 0x0595 }, { 0xfffffc00ffffffffULL, 0x15b5 },
+    { 0xfffffc01fffffc01ULL, 0x0596 }, { 0xfffffc01ffffffffULL, 0x15b6 },
+    { 0xfffffc03fffffc03ULL, 0x0597 }, { 0xfffffc03ffffffffULL, 0x15b7 },
+    { 0xfffffc07fffffc07ULL, 0x0598 }, { 0xfffffc07ffffffffULL, 0x15b8 },
+    { 0xfffffc0ffffffc0fULL, 0x0599 }, { 0xfffffc0fffffffffULL, 0x15b9 },
+    { 0xfffffc1ffffffc1fULL, 0x059a }, { 0xfffffc1fffffffffULL, 0x15ba },
+    { 0xfffffc3ffffffc3fULL, 0x059b }, { 0xfffffc3fffffffffULL, 0x15bb },
+    { 0xfffffc7ffffffc7fULL, 0x059c }, { 0xfffffc7fffffffffULL, 0x15bc },
+    { 0xfffffcfffffffcffULL, 0x059d }, { 0xfffffcffffffffffULL, 0x15bd },
+    { 0xfffffdfffffffdffULL, 0x059e }, { 0xfffffdffffffffffULL, 0x15be },
+    { 0xfffffe0000000000ULL, 0x15d6 }, { 0xfffffe0000000001ULL, 0x15d7 },
+    { 0xfffffe0000000003ULL, 0x15d8 }, { 0xfffffe0000000007ULL, 0x15d9 },
+    { 0xfffffe000000000fULL, 0x15da }, { 0xfffffe000000001fULL, 0x15db },
+    { 0xfffffe000000003fULL, 0x15dc }, { 0xfffffe000000007fULL, 0x15dd },
+    { 0xfffffe00000000ffULL, 0x15de }, { 0xfffffe00000001ffULL, 0x15df },
+    { 0xfffffe00000003ffULL, 0x15e0 }, { 0xfffffe00000007ffULL, 0x15e1 },
+    { 0xfffffe0000000fffULL, 0x15e2 }, { 0xfffffe0000001fffULL, 0x15e3 },
+    { 0xfffffe0000003fffULL, 0x15e4 }, { 0xfffffe0000007fffULL, 0x15e5 },
+    { 0xfffffe000000ffffULL, 0x15e6 }, { 0xfffffe000001ffffULL, 0x15e7 },
+    { 0xfffffe000003ffffULL, 0x15e8 }, { 0xfffffe000007ffffULL, 0x15e9 },
+    { 0xfffffe00000fffffULL, 0x15ea }, { 0xfffffe00001fffffULL, 0x15eb },
+    { 0xfffffe00003fffffULL, 0x15ec }, { 0xfffffe00007fffffULL, 0x15ed },
+    { 0xfffffe0000ffffffULL, 0x15ee }, { 0xfffffe0001ffffffULL, 0x15ef },
+    { 0xfffffe0003ffffffULL, 0x15f0 }, { 0xfffffe0007ffffffULL, 0x15f1 },
+    { 0xfffffe000fffffffULL, 0x15f2 }, { 0xfffffe001fffffffULL, 0x15f3 },
+    { 0xfffffe003fffffffULL, 0x15f4 }, { 0xfffffe007fffffffULL, 0x15f5 },
+    { 0xfffffe00fffffe00ULL, 0x05d6 }, { 0xfffffe00ffffffffULL, 0x15f6 },
+    { 0xfffffe01fffffe01ULL, 0x05d7 }, { 0xfffffe01ffffffffULL, 0x15f7 },
+    { 0xfffffe03fffffe03ULL, 0x05d8 }, { 0xfffffe03ffffffffULL, 0x15f8 },
+    { 0xfffffe07fffffe07ULL, 0x05d9 }, { 0xfffffe07ffffffffULL, 0x15f9 },
+    { 0xfffffe0ffffffe0fULL, 0x05da }, { 0xfffffe0fffffffffULL, 0x15fa },
+    { 0xfffffe1ffffffe1fULL, 0x05db }, { 0xfffffe1fffffffffULL, 0x15fb },
+    { 0xfffffe3ffffffe3fULL, 0x05dc }, { 0xfffffe3fffffffffULL, 0x15fc },
+    { 0xfffffe7ffffffe7fULL, 0x05dd }, { 0xfffffe7fffffffffULL, 0x15fd },
+    { 0xfffffefffffffeffULL, 0x05de }, { 0xfffffeffffffffffULL, 0x15fe },
+    { 0xffffff0000000000ULL, 0x1617 }, { 0xffffff0000000001ULL, 0x1618 },
+    { 0xffffff0000000003ULL, 0x1619 }, { 0xffffff0000000007ULL, 0x161a },
+    { 0xffffff000000000fULL, 0x161b }, { 0xffffff000000001fULL, 0x161c },
+    { 0xffffff000000003fULL, 0x161d }, { 0xffffff000000007fULL, 0x161e },
+    { 0xffffff00000000ffULL, 0x161f }, { 0xffffff00000001ffULL, 0x1620 },
+    { 0xffffff00000003ffULL, 0x1621 }, { 0xffffff00000007ffULL, 0x1622 },
+    { 0xffffff0000000fffULL, 0x1623 }, { 0xffffff0000001fffULL, 0x1624 },
+    { 0xffffff0000003fffULL, 0x1625 }, { 0xffffff0000007fffULL, 0x1626 },
+    { 0xffffff000000ffffULL, 0x1627 }, { 0xffffff000001ffffULL, 0x1628 },
+    { 0xffffff000003ffffULL, 0x1629 }, { 0xffffff000007ffffULL, 0x162a },
+    { 0xffffff00000fffffULL, 0x162b }, { 0xffffff00001fffffULL, 0x162c },
+    { 0xffffff00003fffffULL, 0x162d }, { 0xffffff00007fffffULL, 0x162e },
+    { 0xffffff0000ffffffULL, 0x162f }, { 0xffffff0001ffffffULL, 0x1630 },
+    { 0xffffff0003ffffffULL, 0x1631 }, { 0xffffff0007ffffffULL, 0x1632 },
+    { 0xffffff000fffffffULL, 0x1633 }, { 0xffffff001fffffffULL, 0x1634 },
+    { 0xffffff003fffffffULL, 0x1635 }, { 0xffffff007fffffffULL, 0x1636 },
+    { 0xffffff00ffffff00ULL, 0x0617 }, { 0xffffff00ffffffffULL, 0x1637 },
+    { 0xffffff01ffffff01ULL, 0x0618 }, { 0xffffff01ffffffffULL, 0x1638 },
+    { 0xffffff03ffffff03ULL, 0x0619 }, { 0xffffff03ffffffffULL, 0x1639 },
+    { 0xffffff07ffffff07ULL, 0x061a }, { 0xffffff07ffffffffULL, 0x163a },
+    { 0xffffff0fffffff0fULL, 0x061b }, { 0xffffff0fffffffffULL, 0x163b },
+    { 0xffffff1fffffff1fULL, 0x061c }, { 0xffffff1fffffffffULL, 0x163c },
+    { 0xffffff3fffffff3fULL, 0x061d }, { 0xffffff3fffffffffULL, 0x163d },
+    { 0xffffff7fffffff7fULL, 0x061e }, { 0xffffff7fffffffffULL, 0x163e },
+    { 0xffffff8000000000ULL, 0x1658 }, { 0xffffff8000000001ULL, 0x1659 },
+    { 0xffffff8000000003ULL, 0x165a }, { 0xffffff8000000007ULL, 0x165b },
+    { 0xffffff800000000fULL, 0x165c }, { 0xffffff800000001fULL, 0x165d },
+    { 0xffffff800000003fULL, 0x165e }, { 0xffffff800000007fULL, 0x165f },
+    { 0xffffff80000000ffULL, 0x1660 }, { 0xffffff80000001ffULL, 0x1661 },
+    { 0xffffff80000003ffULL, 0x1662 }, { 0xffffff80000007ffULL, 0x1663 },
+    { 0xffffff8000000fffULL, 0x1664 }, { 0xffffff8000001fffULL, 0x1665 },
+    { 0xffffff8000003fffULL, 0x1666 }, { 0xffffff8000007fffULL, 0x1667 },
+    { 0xffffff800000ffffULL, 0x1668 }, { 0xffffff800001ffffULL, 0x1669 },
+    { 0xffffff800003ffffULL, 0x166a }, { 0xffffff800007ffffULL, 0x166b },
+    { 0xffffff80000fffffULL, 0x166c }, { 0xffffff80001fffffULL, 0x166d },
+    { 0xffffff80003fffffULL, 0x166e }, { 0xffffff80007fffffULL, 0x166f },
+    { 0xffffff8000ffffffULL, 0x1670 }, { 0xffffff8001ffffffULL, 0x1671 },
+    { 0xffffff8003ffffffULL, 0x1672 }, { 0xffffff8007ffffffULL, 0x1673 },
+    { 0xffffff800fffffffULL, 0x1674 }, { 0xffffff801fffffffULL, 0x1675 },
+    { 0xffffff803fffffffULL, 0x1676 }, { 0xffffff807fffffffULL, 0x1677 },
+    { 0xffffff80ffffff80ULL, 0x0658 }, { 0xffffff80ffffffffULL, 0x1678 },
+    { 0xffffff81ffffff81ULL, 0x0659 }, { 0xffffff81ffffffffULL, 0x1679 },
+    { 0xffffff83ffffff83ULL, 0x065a }, { 0xffffff83ffffffffULL, 0x167a },
+    { 0xffffff87ffffff87ULL, 0x065b }, { 0xffffff87ffffffffULL, 0x167b },
+    { 0xffffff8fffffff8fULL, 0x065c }, { 0xffffff8fffffffffULL, 0x167c },
+    { 0xffffff9fffffff9fULL, 0x065d }, { 0xffffff9fffffffffULL, 0x167d },
+    { 0xffffffbfffffffbfULL, 0x065e }, { 0xffffffbfffffffffULL, 0x167e },
+    { 0xffffffc000000000ULL, 0x1699 }, { 0xffffffc000000001ULL, 0x169a },
+    { 0xffffffc000000003ULL, 0x169b }, { 0xffffffc000000007ULL, 0x169c },
+    { 0xffffffc00000000fULL, 0x169d }, { 0xffffffc00000001fULL, 0x169e },
+    { 0xffffffc00000003fULL, 0x169f }, { 0xffffffc00000007fULL, 0x16a0 },
+    { 0xffffffc0000000ffULL, 0x16a1 }, { 0xffffffc0000001ffULL, 0x16a2 },
+    { 0xffffffc0000003ffULL, 0x16a3 }, { 0xffffffc0000007ffULL, 0x16a4 },
+    { 0xffffffc000000fffULL, 0x16a5 }, { 0xffffffc000001fffULL, 0x16a6 },
+    { 0xffffffc000003fffULL, 0x16a7 }, { 0xffffffc000007fffULL, 0x16a8 },
+    { 0xffffffc00000ffffULL, 0x16a9 }, { 0xffffffc00001ffffULL, 0x16aa },
+    { 0xffffffc00003ffffULL, 0x16ab }, { 0xffffffc00007ffffULL, 0x16ac },
+    { 0xffffffc0000fffffULL, 0x16ad }, { 0xffffffc0001fffffULL, 0x16ae },
+    { 0xffffffc0003fffffULL, 0x16af }, { 0xffffffc0007fffffULL, 0x16b0 },
+    { 0xffffffc000ffffffULL, 0x16b1 }, { 0xffffffc001ffffffULL, 0x16b2 },
+    { 0xffffffc003ffffffULL, 0x16b3 }, { 0xffffffc007ffffffULL, 0x16b4 },
+    { 0xffffffc00fffffffULL, 0x16b5 }, { 0xffffffc01fffffffULL, 0x16b6 },
+    { 0xffffffc03fffffffULL, 0x16b7 }, { 0xffffffc07fffffffULL, 0x16b8 },
+    { 0xffffffc0ffffffc0ULL, 0x0699 }, { 0xffffffc0ffffffffULL, 0x16b9 },
+    { 0xffffffc1ffffffc1ULL, 0x069a }, { 0xffffffc1ffffffffULL, 0x16ba },
+    { 0xffffffc3ffffffc3ULL, 0x069b }, { 0xffffffc3ffffffffULL, 0x16bb },
+    { 0xffffffc7ffffffc7ULL, 0x069c }, { 0xffffffc7ffffffffULL, 0x16bc },
+    { 0xffffffcfffffffcfULL, 0x069d }, { 0xffffffcfffffffffULL, 0x16bd },
+    { 0xffffffdfffffffdfULL, 0x069e }, { 0xffffffdfffffffffULL, 0x16be },
+    { 0xffffffe000000000ULL, 0x16da }, { 0xffffffe000000001ULL, 0x16db },
+    { 0xffffffe000000003ULL, 0x16dc }, { 0xffffffe000000007ULL, 0x16dd },
+    { 0xffffffe00000000fULL, 0x16de }, { 0xffffffe00000001fULL, 0x16df },
+    { 0xffffffe00000003fULL, 0x16e0 }, { 0xffffffe00000007fULL, 0x16e1 },
+    { 0xffffffe0000000ffULL, 0x16e2 }, { 0xffffffe0000001ffULL, 0x16e3 },
+    { 0xffffffe0000003ffULL, 0x16e4 }, { 0xffffffe0000007ffULL, 0x16e5 },
+    { 0xffffffe000000fffULL, 0x16e6 }, { 0xffffffe000001fffULL, 0x16e7 },
+    { 0xffffffe000003fffULL, 0x16e8 }, { 0xffffffe000007fffULL, 0x16e9 },
+    { 0xffffffe00000ffffULL, 0x16ea }, { 0xffffffe00001ffffULL, 0x16eb },
+    { 0xffffffe00003ffffULL, 0x16ec }, { 0xffffffe00007ffffULL, 0x16ed },
+    { 0xffffffe0000fffffULL, 0x16ee }, { 0xffffffe0001fffffULL, 0x16ef },
+    { 0xffffffe0003fffffULL, 0x16f0 }, { 0xffffffe0007fffffULL, 0x16f1 },
+    { 0xffffffe000ffffffULL, 0x16f2 }, { 0xffffffe001ffffffULL, 0x16f3 },
+    { 0xffffffe003ffffffULL, 0x16f4 }, { 0xffffffe007ffffffULL, 0x16f5 },
+    { 0xffffffe00fffffffULL, 0x16f6 }, { 0xffffffe01fffffffULL, 0x16f7 },
+    { 0xffffffe03fffffffULL, 0x16f8 }, { 0xffffffe07fffffffULL, 0x16f9 },
+    { 0xffffffe0ffffffe0ULL, 0x06da }, { 0xffffffe0ffffffffULL, 0x16fa },
+    { 0xffffffe1ffffffe1ULL, 0x06db }, { 0xffffffe1ffffffffULL, 0x16fb },
+    { 0xffffffe3ffffffe3ULL, 0x06dc }, { 0xffffffe3ffffffffULL, 0x16fc },
+    { 0xffffffe7ffffffe7ULL, 0x06dd }, { 0xffffffe7ffffffffULL, 0x16fd },
+    { 0xffffffefffffffefULL, 0x06de }, { 0xffffffefffffffffULL, 0x16fe },
+    { 0xfffffff000000000ULL, 0x171b }, { 0xfffffff000000001ULL, 0x171c },
+    { 0xfffffff000000003ULL, 0x171d }, { 0xfffffff000000007ULL, 0x171e },
+    { 0xfffffff00000000fULL, 0x171f }, { 0xfffffff00000001fULL, 0x1720 },
+    { 0xfffffff00000003fULL, 0x1721 }, { 0xfffffff00000007fULL, 0x1722 },
+    { 0xfffffff0000000ffULL, 0x1723 }, { 0xfffffff0000001ffULL, 0x1724 },
+    { 0xfffffff0000003ffULL, 0x1725 }, { 0xfffffff0000007ffULL, 0x1726 },
+    { 0xfffffff000000fffULL, 0x1727 }, { 0xfffffff000001fffULL, 0x1728 },
+    { 0xfffffff000003fffULL, 0x1729 }, { 0xfffffff000007fffULL, 0x172a },
+    { 0xfffffff00000ffffULL, 0x172b }, { 0xfffffff00001ffffULL, 0x172c },
+    { 0xfffffff00003ffffULL, 0x172d }, { 0xfffffff00007ffffULL, 0x172e },
+    { 0xfffffff0000fffffULL, 0x172f }, { 0xfffffff0001fffffULL, 0x1730 },
+    { 0xfffffff0003fffffULL, 0x1731 }, { 0xfffffff0007fffffULL, 0x1732 },
+    { 0xfffffff000ffffffULL, 0x1733 }, { 0xfffffff001ffffffULL, 0x1734 },
+    { 0xfffffff003ffffffULL, 0x1735 }, { 0xfffffff007ffffffULL, 0x1736 },
+    { 0xfffffff00fffffffULL, 0x1737 }, { 0xfffffff01fffffffULL, 0x1738 },
+    { 0xfffffff03fffffffULL, 0x1739 }, { 0xfffffff07fffffffULL, 0x173a },
+    { 0xfffffff0fffffff0ULL, 0x071b }, { 0xfffffff0ffffffffULL, 0x173b },
+    { 0xfffffff1fffffff1ULL, 0x071c }, { 0xfffffff1ffffffffULL, 0x173c },
+    { 0xfffffff3fffffff3ULL, 0x071d }, { 0xfffffff3ffffffffULL, 0x173d },
+    { 0xfffffff7fffffff7ULL, 0x071e }, { 0xfffffff7ffffffffULL, 0x173e },
+    { 0xfffffff800000000ULL, 0x175c }, { 0xfffffff800000001ULL, 0x175d },
+    { 0xfffffff800000003ULL, 0x175e }, { 0xfffffff800000007ULL, 0x175f },
+    { 0xfffffff80000000fULL, 0x1760 }, { 0xfffffff80000001fULL, 0x1761 },
+    { 0xfffffff80000003fULL, 0x1762 }, { 0xfffffff80000007fULL, 0x1763 },
+    { 0xfffffff8000000ffULL, 0x1764 }, { 0xfffffff8000001ffULL, 0x1765 },
+    { 0xfffffff8000003ffULL, 0x1766 }, { 0xfffffff8000007ffULL, 0x1767 },
+    { 0xfffffff800000fffULL, 0x1768 }, { 0xfffffff800001fffULL, 0x1769 },
+    { 0xfffffff800003fffULL, 0x176a }, { 0xfffffff800007fffULL, 0x176b },
+    { 0xfffffff80000ffffULL, 0x176c }, { 0xfffffff80001ffffULL, 0x176d },
+    { 0xfffffff80003ffffULL, 0x176e }, { 0xfffffff80007ffffULL, 0x176f },
+    { 0xfffffff8000fffffULL, 0x1770 }, { 0xfffffff8001fffffULL, 0x1771 },
+    { 0xfffffff8003fffffULL, 0x1772 }, { 0xfffffff8007fffffULL, 0x1773 },
+    { 0xfffffff800ffffffULL, 0x1774 }, { 0xfffffff801ffffffULL, 0x1775 },
+    { 0xfffffff803ffffffULL, 0x1776 }, { 0xfffffff807ffffffULL, 0x1777 },
+    { 0xfffffff80fffffffULL, 0x1778 }, { 0xfffffff81fffffffULL, 0x1779 },
+    { 0xfffffff83fffffffULL, 0x177a }, { 0xfffffff87fffffffULL, 0x177b },
+    { 0xfffffff8fffffff8ULL, 0x075c }, { 0xfffffff8ffffffffULL, 0x177c },
+    { 0xfffffff9fffffff9ULL, 0x075d }, { 0xfffffff9ffffffffULL, 0x177d },
+    { 0xfffffffbfffffffbULL, 0x075e }, { 0xfffffffbffffffffULL, 0x177e },
+    { 0xfffffffc00000000ULL, 0x179d }, { 0xfffffffc00000001ULL, 0x179e },
+    { 0xfffffffc00000003ULL, 0x179f }, { 0xfffffffc00000007ULL, 0x17a0 },
+    { 0xfffffffc0000000fULL, 0x17a1 }, { 0xfffffffc0000001fULL, 0x17a2 },
+    { 0xfffffffc0000003fULL, 0x17a3 }, { 0xfffffffc0000007fULL, 0x17a4 },
+    { 0xfffffffc000000ffULL, 0x17a5 }, { 0xfffffffc000001ffULL, 0x17a6 },
+    { 0xfffffffc000003ffULL, 0x17a7 }, { 0xfffffffc000007ffULL, 0x17a8 },
+    { 0xfffffffc00000fffULL, 0x17a9 }, { 0xfffffffc00001fffULL, 0x17aa },
+    { 0xfffffffc00003fffULL, 0x17ab }, { 0xfffffffc00007fffULL, 0x17ac },
+    { 0xfffffffc0000ffffULL, 0x17ad }, { 0xfffffffc0001ffffULL, 0x17ae },
+    { 0xfffffffc0003ffffULL, 0x17af }, { 0xfffffffc0007ffffULL, 0x17b0 },
+    { 0xfffffffc000fffffULL, 0x17b1 }, { 0xfffffffc001fffffULL, 0x17b2 },
+    { 0xfffffffc003fffffULL, 0x17b3 }, { 0xfffffffc007fffffULL, 0x17b4 },
+    { 0xfffffffc00ffffffULL, 0x17b5 }, { 0xfffffffc01ffffffULL, 0x17b6 },
+    { 0xfffffffc03ffffffULL, 0x17b7 }, { 0xfffffffc07ffffffULL, 0x17b8 },
+    { 0xfffffffc0fffffffULL, 0x17b9 }, { 0xfffffffc1fffffffULL, 0x17ba },
+    { 0xfffffffc3fffffffULL, 0x17bb }, { 0xfffffffc7fffffffULL, 0x17bc },
+    { 0xfffffffcfffffffcULL, 0x079d }, { 0xfffffffcffffffffULL, 0x17bd },
+    { 0xfffffffdfffffffdULL, 0x079e }, { 0xfffffffdffffffffULL, 0x17be },
+    { 0xfffffffe00000000ULL, 0x17de }, { 0xfffffffe00000001ULL, 0x17df },
+    { 0xfffffffe00000003ULL, 0x17e0 }, { 0xfffffffe00000007ULL, 0x17e1 },
+    { 0xfffffffe0000000fULL, 0x17e2 }, { 0xfffffffe0000001fULL, 0x17e3 },
+    { 0xfffffffe0000003fULL, 0x17e4 }, { 0xfffffffe0000007fULL, 0x17e5 },
+    { 0xfffffffe000000ffULL, 0x17e6 }, { 0xfffffffe000001ffULL, 0x17e7 },
+    { 0xfffffffe000003ffULL, 0x17e8 }, { 0xfffffffe000007ffULL, 0x17e9 },
+    { 0xfffffffe00000fffULL, 0x17ea }, { 0xfffffffe00001fffULL, 0x17eb },
+    { 0xfffffffe00003fffULL, 0x17ec }, { 0xfffffffe00007fffULL, 0x17ed },
+    { 0xfffffffe0000ffffULL, 0x17ee }, { 0xfffffffe0001ffffULL, 0x17ef },
+    { 0xfffffffe0003ffffULL, 0x17f0 }, { 0xfffffffe0007ffffULL, 0x17f1 },
+    { 0xfffffffe000fffffULL, 0x17f2 }, { 0xfffffffe001fffffULL, 0x17f3 },
+    { 0xfffffffe003fffffULL, 0x17f4 }, { 0xfffffffe007fffffULL, 0x17f5 },
+    { 0xfffffffe00ffffffULL, 0x17f6 }, { 0xfffffffe01ffffffULL, 0x17f7 },
+    { 0xfffffffe03ffffffULL, 0x17f8 }, { 0xfffffffe07ffffffULL, 0x17f9 },
+    { 0xfffffffe0fffffffULL, 0x17fa }, { 0xfffffffe1fffffffULL, 0x17fb },
+    { 0xfffffffe3fffffffULL, 0x17fc }, { 0xfffffffe7fffffffULL, 0x17fd },
+    { 0xfffffffefffffffeULL, 0x07de }, { 0xfffffffeffffffffULL, 0x17fe },
+    { 0xffffffff00000000ULL, 0x181f }, { 0xffffffff00000001ULL, 0x1820 },
+    { 0xffffffff00000003ULL, 0x1821 }, { 0xffffffff00000007ULL, 0x1822 },
+    { 0xffffffff0000000fULL, 0x1823 }, { 0xffffffff0000001fULL, 0x1824 },
+    { 0xffffffff0000003fULL, 0x1825 }, { 0xffffffff0000007fULL, 0x1826 },
+    { 0xffffffff000000ffULL, 0x1827 }, { 0xffffffff000001ffULL, 0x1828 },
+    { 0xffffffff000003ffULL, 0x1829 }, { 0xffffffff000007ffULL, 0x182a },
+    { 0xffffffff00000fffULL, 0x182b }, { 0xffffffff00001fffULL, 0x182c },
+    { 0xffffffff00003fffULL, 0x182d }, { 0xffffffff00007fffULL, 0x182e },
+    { 0xffffffff0000ffffULL, 0x182f }, { 0xffffffff0001ffffULL, 0x1830 },
+    { 0xffffffff0003ffffULL, 0x1831 }, { 0xffffffff0007ffffULL, 0x1832 },
+    { 0xffffffff000fffffULL, 0x1833 }, { 0xffffffff001fffffULL, 0x1834 },
+    { 0xffffffff003fffffULL, 0x1835 }, { 0xffffffff007fffffULL, 0x1836 },
+    { 0xffffffff00ffffffULL, 0x1837 }, { 0xffffffff01ffffffULL, 0x1838 },
+    { 0xffffffff03ffffffULL, 0x1839 }, { 0xffffffff07ffffffULL, 0x183a },
+    { 0xffffffff0fffffffULL, 0x183b }, { 0xffffffff1fffffffULL, 0x183c },
+    { 0xffffffff3fffffffULL, 0x183d }, { 0xffffffff7fffffffULL, 0x183e },
+    { 0xffffffff80000000ULL, 0x1860 }, { 0xffffffff80000001ULL, 0x1861 },
+    { 0xffffffff80000003ULL, 0x1862 }, { 0xffffffff80000007ULL, 0x1863 },
+    { 0xffffffff8000000fULL, 0x1864 }, { 0xffffffff8000001fULL, 0x1865 },
+    { 0xffffffff8000003fULL, 0x1866 }, { 0xffffffff8000007fULL, 0x1867 },
+    { 0xffffffff800000ffULL, 0x1868 }, { 0xffffffff800001ffULL, 0x1869 },
+    { 0xffffffff800003ffULL, 0x186a }, { 0xffffffff800007ffULL, 0x186b },
+    { 0xffffffff80000fffULL, 0x186c }, { 0xffffffff80001fffULL, 0x186d },
+    { 0xffffffff80003fffULL, 0x186e }, { 0xffffffff80007fffULL, 0x186f },
+    { 0xffffffff8000ffffULL, 0x1870 }, { 0xffffffff8001ffffULL, 0x1871 },
+    { 0xffffffff8003ffffULL, 0x1872 }, { 0xffffffff8007ffffULL, 0x1873 },
+    { 0xffffffff800fffffULL, 0x1874 }, { 0xffffffff801fffffULL, 0x1875 },
+    { 0xffffffff803fffffULL, 0x1876 }, { 0xffffffff807fffffULL, 0x1877 },
+    { 0xffffffff80ffffffULL, 0x1878 }, { 0xffffffff81ffffffULL, 0x1879 },
+    { 0xffffffff83ffffffULL, 0x187a }, { 0xffffffff87ffffffULL, 0x187b },
+    { 0xffffffff8fffffffULL, 0x187c }, { 0xffffffff9fffffffULL, 0x187d },
+    { 0xffffffffbfffffffULL, 0x187e }, { 0xffffffffc0000000ULL, 0x18a1 },
+    { 0xffffffffc0000001ULL, 0x18a2 }, { 0xffffffffc0000003ULL, 0x18a3 },
+    { 0xffffffffc0000007ULL, 0x18a4 }, { 0xffffffffc000000fULL, 0x18a5 },
+    { 0xffffffffc000001fULL, 0x18a6 }, { 0xffffffffc000003fULL, 0x18a7 },
+    { 0xffffffffc000007fULL, 0x18a8 }, { 0xffffffffc00000ffULL, 0x18a9 },
+    { 0xffffffffc00001ffULL, 0x18aa }, { 0xffffffffc00003ffULL, 0x18ab },
+    { 0xffffffffc00007ffULL, 0x18ac }, { 0xffffffffc0000fffULL, 0x18ad },
+    { 0xffffffffc0001fffULL, 0x18ae }, { 0xffffffffc0003fffULL, 0x18af },
+    { 0xffffffffc0007fffULL, 0x18b0 }, { 0xffffffffc000ffffULL, 0x18b1 },
+    { 0xffffffffc001ffffULL, 0x18b2 }, { 0xffffffffc003ffffULL, 0x18b3 },
+    { 0xffffffffc007ffffULL, 0x18b4 }, { 0xffffffffc00fffffULL, 0x18b5 },
+    { 0xffffffffc01fffffULL, 0x18b6 }, { 0xffffffffc03fffffULL, 0x18b7 },
+    { 0xffffffffc07fffffULL, 0x18b8 }, { 0xffffffffc0ffffffULL, 0x18b9 },
+    { 0xffffffffc1ffffffULL, 0x18ba }, { 0xffffffffc3ffffffULL, 0x18bb },
+    { 0xffffffffc7ffffffULL, 0x18bc }, { 0xffffffffcfffffffULL, 0x18bd },
+    { 0xffffffffdfffffffULL, 0x18be }, { 0xffffffffe0000000ULL, 0x18e2 },
+    { 0xffffffffe0000001ULL, 0x18e3 }, { 0xffffffffe0000003ULL, 0x18e4 },
+    { 0xffffffffe0000007ULL, 0x18e5 }, { 0xffffffffe000000fULL, 0x18e6 },
+    { 0xffffffffe000001fULL, 0x18e7 }, { 0xffffffffe000003fULL, 0x18e8 },
+    { 0xffffffffe000007fULL, 0x18e9 }, { 0xffffffffe00000ffULL, 0x18ea },
+    { 0xffffffffe00001ffULL, 0x18eb }, { 0xffffffffe00003ffULL, 0x18ec },
+    { 0xffffffffe00007ffULL, 0x18ed }, { 0xffffffffe0000fffULL, 0x18ee },
+    { 0xffffffffe0001fffULL, 0x18ef }, { 0xffffffffe0003fffULL, 0x18f0 },
+    { 0xffffffffe0007fffULL, 0x18f1 }, { 0xffffffffe000ffffULL, 0x18f2 },
+    { 0xffffffffe001ffffULL, 0x18f3 }, { 0xffffffffe003ffffULL, 0x18f4 },
+    { 0xffffffffe007ffffULL, 0x18f5 }, { 0xffffffffe00fffffULL, 0x18f6 },
+    { 0xffffffffe01fffffULL, 0x18f7 }, { 0xffffffffe03fffffULL, 0x18f8 },
+    { 0xffffffffe07fffffULL, 0x18f9 }, { 0xffffffffe0ffffffULL, 0x18fa },
+    { 0xffffffffe1ffffffULL, 0x18fb }, { 0xffffffffe3ffffffULL, 0x18fc },
+    { 0xffffffffe7ffffffULL, 0x18fd }, { 0xffffffffefffffffULL, 0x18fe },
+    { 0xfffffffff0000000ULL, 0x1923 }, { 0xfffffffff0000001ULL, 0x1924 },
+    { 0xfffffffff0000003ULL, 0x1925 }, { 0xfffffffff0000007ULL, 0x1926 },
+    { 0xfffffffff000000fULL, 0x1927 }, { 0xfffffffff000001fULL, 0x1928 },
+    { 0xfffffffff000003fULL, 0x1929 }, { 0xfffffffff000007fULL, 0x192a },
+    { 0xfffffffff00000ffULL, 0x192b }, { 0xfffffffff00001ffULL, 0x192c },
+    { 0xfffffffff00003ffULL, 0x192d }, { 0xfffffffff00007ffULL, 0x192e },
+    { 0xfffffffff0000fffULL, 0x192f }, { 0xfffffffff0001fffULL, 0x1930 },
+    { 0xfffffffff0003fffULL, 0x1931 }, { 0xfffffffff0007fffULL, 0x1932 },
+    { 0xfffffffff000ffffULL, 0x1933 }, { 0xfffffffff001ffffULL, 0x1934 },
+    { 0xfffffffff003ffffULL, 0x1935 }, { 0xfffffffff007ffffULL, 0x1936 },
+    { 0xfffffffff00fffffULL, 0x1937 }, { 0xfffffffff01fffffULL, 0x1938 },
+    { 0xfffffffff03fffffULL, 0x1939 }, { 0xfffffffff07fffffULL, 0x193a },
+    { 0xfffffffff0ffffffULL, 0x193b }, { 0xfffffffff1ffffffULL, 0x193c },
+    { 0xfffffffff3ffffffULL, 0x193d }, { 0xfffffffff7ffffffULL, 0x193e },
+    { 0xfffffffff8000000ULL, 0x1964 }, { 0xfffffffff8000001ULL, 0x1965 },
+    { 0xfffffffff8000003ULL, 0x1966 }, { 0xfffffffff8000007ULL, 0x1967 },
+    { 0xfffffffff800000fULL, 0x1968 }, { 0xfffffffff800001fULL, 0x1969 },
+    { 0xfffffffff800003fULL, 0x196a }, { 0xfffffffff800007fULL, 0x196b },
+    { 0xfffffffff80000ffULL, 0x196c }, { 0xfffffffff80001ffULL, 0x196d },
+    { 0xfffffffff80003ffULL, 0x196e }, { 0xfffffffff80007ffULL, 0x196f },
+    { 0xfffffffff8000fffULL, 0x1970 }, { 0xfffffffff8001fffULL, 0x1971 },
+    { 0xfffffffff8003fffULL, 0x1972 }, { 0xfffffffff8007fffULL, 0x1973 },
+    { 0xfffffffff800ffffULL, 0x1974 }, { 0xfffffffff801ffffULL, 0x1975 },
+    { 0xfffffffff803ffffULL, 0x1976 }, { 0xfffffffff807ffffULL, 0x1977 },
+    { 0xfffffffff80fffffULL, 0x1978 }, { 0xfffffffff81fffffULL, 0x1979 },
+    { 0xfffffffff83fffffULL, 0x197a }, { 0xfffffffff87fffffULL, 0x197b },
+    { 0xfffffffff8ffffffULL, 0x197c }, { 0xfffffffff9ffffffULL, 0x197d },
+    { 0xfffffffffbffffffULL, 0x197e }, { 0xfffffffffc000000ULL, 0x19a5 },
+    { 0xfffffffffc000001ULL, 0x19a6 }, { 0xfffffffffc000003ULL, 0x19a7 },
+    { 0xfffffffffc000007ULL, 0x19a8 }, { 0xfffffffffc00000fULL, 0x19a9 },
+    { 0xfffffffffc00001fULL, 0x19aa }, { 0xfffffffffc00003fULL, 0x19ab },
+    { 0xfffffffffc00007fULL, 0x19ac }, { 0xfffffffffc0000ffULL, 0x19ad },
+    { 0xfffffffffc0001ffULL, 0x19ae }, { 0xfffffffffc0003ffULL, 0x19af },
+    { 0xfffffffffc0007ffULL, 0x19b0 }, { 0xfffffffffc000fffULL, 0x19b1 },
+    { 0xfffffffffc001fffULL, 0x19b2 }, { 0xfffffffffc003fffULL, 0x19b3 },
+    { 0xfffffffffc007fffULL, 0x19b4 }, { 0xfffffffffc00ffffULL, 0x19b5 },
+    { 0xfffffffffc01ffffULL, 0x19b6 }, { 0xfffffffffc03ffffULL, 0x19b7 },
+    { 0xfffffffffc07ffffULL, 0x19b8 }, { 0xfffffffffc0fffffULL, 0x19b9 },
+    { 0xfffffffffc1fffffULL, 0x19ba }, { 0xfffffffffc3fffffULL, 0x19bb },
+    { 0xfffffffffc7fffffULL, 0x19bc }, { 0xfffffffffcffffffULL, 0x19bd },
+    { 0xfffffffffdffffffULL, 0x19be }, { 0xfffffffffe000000ULL, 0x19e6 },
+    { 0xfffffffffe000001ULL, 0x19e7 }, { 0xfffffffffe000003ULL, 0x19e8 },
+    { 0xfffffffffe000007ULL, 0x19e9 }, { 0xfffffffffe00000fULL, 0x19ea },
+    { 0xfffffffffe00001fULL, 0x19eb }, { 0xfffffffffe00003fULL, 0x19ec },
+    { 0xfffffffffe00007fULL, 0x19ed }, { 0xfffffffffe0000ffULL, 0x19ee },
+    { 0xfffffffffe0001ffULL, 0x19ef }, { 0xfffffffffe0003ffULL, 0x19f0 },
+    { 0xfffffffffe0007ffULL, 0x19f1 }, { 0xfffffffffe000fffULL, 0x19f2 },
+    { 0xfffffffffe001fffULL, 0x19f3 }, { 0xfffffffffe003fffULL, 0x19f4 },
+    { 0xfffffffffe007fffULL, 0x19f5 }, { 0xfffffffffe00ffffULL, 0x19f6 },
+    { 0xfffffffffe01ffffULL, 0x19f7 }, { 0xfffffffffe03ffffULL, 0x19f8 },
+    { 0xfffffffffe07ffffULL, 0x19f9 }, { 0xfffffffffe0fffffULL, 0x19fa },
+    { 0xfffffffffe1fffffULL, 0x19fb }, { 0xfffffffffe3fffffULL, 0x19fc },
+    { 0xfffffffffe7fffffULL, 0x19fd }, { 0xfffffffffeffffffULL, 0x19fe },
+    { 0xffffffffff000000ULL, 0x1a27 }, { 0xffffffffff000001ULL, 0x1a28 },
+    { 0xffffffffff000003ULL, 0x1a29 }, { 0xffffffffff000007ULL, 0x1a2a },
+    { 0xffffffffff00000fULL, 0x1a2b }, { 0xffffffffff00001fULL, 0x1a2c },
+    { 0xffffffffff00003fULL, 0x1a2d }, { 0xffffffffff00007fULL, 0x1a2e },
+    { 0xffffffffff0000ffULL, 0x1a2f }, { 0xffffffffff0001ffULL, 0x1a30 },
+    { 0xffffffffff0003ffULL, 0x1a31 }, { 0xffffffffff0007ffULL, 0x1a32 },
+    { 0xffffffffff000fffULL, 0x1a33 }, { 0xffffffffff001fffULL, 0x1a34 },
+    { 0xffffffffff003fffULL, 0x1a35 }, { 0xffffffffff007fffULL, 0x1a36 },
+    { 0xffffffffff00ffffULL, 0x1a37 }, { 0xffffffffff01ffffULL, 0x1a38 },
+    { 0xffffffffff03ffffULL, 0x1a39 }, { 0xffffffffff07ffffULL, 0x1a3a },
+    { 0xffffffffff0fffffULL, 0x1a3b }, { 0xffffffffff1fffffULL, 0x1a3c },
+    { 0xffffffffff3fffffULL, 0x1a3d }, { 0xffffffffff7fffffULL, 0x1a3e },
+    { 0xffffffffff800000ULL, 0x1a68 }, { 0xffffffffff800001ULL, 0x1a69 },
+    { 0xffffffffff800003ULL, 0x1a6a }, { 0xffffffffff800007ULL, 0x1a6b },
+    { 0xffffffffff80000fULL, 0x1a6c }, { 0xffffffffff80001fULL, 0x1a6d },
+    { 0xffffffffff80003fULL, 0x1a6e }, { 0xffffffffff80007fULL, 0x1a6f },
+    { 0xffffffffff8000ffULL, 0x1a70 }, { 0xffffffffff8001ffULL, 0x1a71 },
+    { 0xffffffffff8003ffULL, 0x1a72 }, { 0xffffffffff8007ffULL, 0x1a73 },
+    { 0xffffffffff800fffULL, 0x1a74 }, { 0xffffffffff801fffULL, 0x1a75 },
+    { 0xffffffffff803fffULL, 0x1a76 }, { 0xffffffffff807fffULL, 0x1a77 },
+    { 0xffffffffff80ffffULL, 0x1a78 }, { 0xffffffffff81ffffULL, 0x1a79 },
+    { 0xffffffffff83ffffULL, 0x1a7a }, { 0xffffffffff87ffffULL, 0x1a7b },
+    { 0xffffffffff8fffffULL, 0x1a7c }, { 0xffffffffff9fffffULL, 0x1a7d },
+    { 0xffffffffffbfffffULL, 0x1a7e }, { 0xffffffffffc00000ULL, 0x1aa9 },
+    { 0xffffffffffc00001ULL, 0x1aaa }, { 0xffffffffffc00003ULL, 0x1aab },
+    { 0xffffffffffc00007ULL, 0x1aac }, { 0xffffffffffc0000fULL, 0x1aad },
+    { 0xffffffffffc0001fULL, 0x1aae }, { 0xffffffffffc0003fULL, 0x1aaf },
+    { 0xffffffffffc0007fULL, 0x1ab0 }, { 0xffffffffffc000ffULL, 0x1ab1 },
+    { 0xffffffffffc001ffULL, 0x1ab2 }, { 0xffffffffffc003ffULL, 0x1ab3 },
+    { 0xffffffffffc007ffULL, 0x1ab4 }, { 0xffffffffffc00fffULL, 0x1ab5 },
+    { 0xffffffffffc01fffULL, 0x1ab6 }, { 0xffffffffffc03fffULL, 0x1ab7 },
+    { 0xffffffffffc07fffULL, 0x1ab8 }, { 0xffffffffffc0ffffULL, 0x1ab9 },
+    { 0xffffffffffc1ffffULL, 0x1aba }, { 0xffffffffffc3ffffULL, 0x1abb },
+    { 0xffffffffffc7ffffULL, 0x1abc }, { 0xffffffffffcfffffULL, 0x1abd },
+    { 0xffffffffffdfffffULL, 0x1abe }, { 0xffffffffffe00000ULL, 0x1aea },
+    { 0xffffffffffe00001ULL, 0x1aeb }, { 0xffffffffffe00003ULL, 0x1aec },
+    { 0xffffffffffe00007ULL, 0x1aed }, { 0xffffffffffe0000fULL, 0x1aee },
+    { 0xffffffffffe0001fULL, 0x1aef }, { 0xffffffffffe0003fULL, 0x1af0 },
+    { 0xffffffffffe0007fULL, 0x1af1 }, { 0xffffffffffe000ffULL, 0x1af2 },
+    { 0xffffffffffe001ffULL, 0x1af3 }, { 0xffffffffffe003ffULL, 0x1af4 },
+    { 0xffffffffffe007ffULL, 0x1af5 }, { 0xffffffffffe00fffULL, 0x1af6 },
+    { 0xffffffffffe01fffULL, 0x1af7 }, { 0xffffffffffe03fffULL, 0x1af8 },
+    { 0xffffffffffe07fffULL, 0x1af9 }, { 0xffffffffffe0ffffULL, 0x1afa },
+    { 0xffffffffffe1ffffULL, 0x1afb }, { 0xffffffffffe3ffffULL, 0x1afc },
+    { 0xffffffffffe7ffffULL, 0x1afd }, { 0xffffffffffefffffULL, 0x1afe },
+    { 0xfffffffffff00000ULL, 0x1b2b }, { 0xfffffffffff00001ULL, 0x1b2c },
+    { 0xfffffffffff00003ULL, 0x1b2d }, { 0xfffffffffff00007ULL, 0x1b2e },
+    { 0xfffffffffff0000fULL, 0x1b2f }, { 0xfffffffffff0001fULL, 0x1b30 },
+    { 0xfffffffffff0003fULL, 0x1b31 }, { 0xfffffffffff0007fULL, 0x1b32 },
+    { 0xfffffffffff000ffULL, 0x1b33 }, { 0xfffffffffff001ffULL, 0x1b34 },
+    { 0xfffffffffff003ffULL, 0x1b35 }, { 0xfffffffffff007ffULL, 0x1b36 },
+    { 0xfffffffffff00fffULL, 0x1b37 }, { 0xfffffffffff01fffULL, 0x1b38 },
+    { 0xfffffffffff03fffULL, 0x1b39 }, { 0xfffffffffff07fffULL, 0x1b3a },
+    { 0xfffffffffff0ffffULL, 0x1b3b }, { 0xfffffffffff1ffffULL, 0x1b3c },
+    { 0xfffffffffff3ffffULL, 0x1b3d }, { 0xfffffffffff7ffffULL, 0x1b3e },
+    { 0xfffffffffff80000ULL, 0x1b6c }, { 0xfffffffffff80001ULL, 0x1b6d },
+    { 0xfffffffffff80003ULL, 0x1b6e }, { 0xfffffffffff80007ULL, 0x1b6f },
+    { 0xfffffffffff8000fULL, 0x1b70 }, { 0xfffffffffff8001fULL, 0x1b71 },
+    { 0xfffffffffff8003fULL, 0x1b72 }, { 0xfffffffffff8007fULL, 0x1b73 },
+    { 0xfffffffffff800ffULL, 0x1b74 }, { 0xfffffffffff801ffULL, 0x1b75 },
+    { 0xfffffffffff803ffULL, 0x1b76 }, { 0xfffffffffff807ffULL, 0x1b77 },
+    { 0xfffffffffff80fffULL, 0x1b78 }, { 0xfffffffffff81fffULL, 0x1b79 },
+    { 0xfffffffffff83fffULL, 0x1b7a }, { 0xfffffffffff87fffULL, 0x1b7b },
+    { 0xfffffffffff8ffffULL, 0x1b7c }, { 0xfffffffffff9ffffULL, 0x1b7d },
+    { 0xfffffffffffbffffULL, 0x1b7e }, { 0xfffffffffffc0000ULL, 0x1bad },
+    { 0xfffffffffffc0001ULL, 0x1bae }, { 0xfffffffffffc0003ULL, 0x1baf },
+    { 0xfffffffffffc0007ULL, 0x1bb0 }, { 0xfffffffffffc000fULL, 0x1bb1 },
+    { 0xfffffffffffc001fULL, 0x1bb2 }, { 0xfffffffffffc003fULL, 0x1bb3 },
+    { 0xfffffffffffc007fULL, 0x1bb4 }, { 0xfffffffffffc00ffULL, 0x1bb5 },
+    { 0xfffffffffffc01ffULL, 0x1bb6 }, { 0xfffffffffffc03ffULL, 0x1bb7 },
+    { 0xfffffffffffc07ffULL, 0x1bb8 }, { 0xfffffffffffc0fffULL, 0x1bb9 },
+    { 0xfffffffffffc1fffULL, 0x1bba }, { 0xfffffffffffc3fffULL, 0x1bbb },
+    { 0xfffffffffffc7fffULL, 0x1bbc }, { 0xfffffffffffcffffULL, 0x1bbd },
+    { 0xfffffffffffdffffULL, 0x1bbe }, { 0xfffffffffffe0000ULL, 0x1bee },
+    { 0xfffffffffffe0001ULL, 0x1bef }, { 0xfffffffffffe0003ULL, 0x1bf0 },
+    { 0xfffffffffffe0007ULL, 0x1bf1 }, { 0xfffffffffffe000fULL, 0x1bf2 },
+    { 0xfffffffffffe001fULL, 0x1bf3 }, { 0xfffffffffffe003fULL, 0x1bf4 },
+    { 0xfffffffffffe007fULL, 0x1bf5 }, { 0xfffffffffffe00ffULL, 0x1bf6 },
+    { 0xfffffffffffe01ffULL, 0x1bf7 }, { 0xfffffffffffe03ffULL, 0x1bf8 },
+    { 0xfffffffffffe07ffULL, 0x1bf9 }, { 0xfffffffffffe0fffULL, 0x1bfa },
+    { 0xfffffffffffe1fffULL, 0x1bfb }, { 0xfffffffffffe3fffULL, 0x1bfc },
+    { 0xfffffffffffe7fffULL, 0x1bfd }, { 0xfffffffffffeffffULL, 0x1bfe },
+    { 0xffffffffffff0000ULL, 0x1c2f }, { 0xffffffffffff0001ULL, 0x1c30 },
+    { 0xffffffffffff0003ULL, 0x1c31 }, { 0xffffffffffff0007ULL, 0x1c32 },
+    { 0xffffffffffff000fULL, 0x1c33 }, { 0xffffffffffff001fULL, 0x1c34 },
+    { 0xffffffffffff003fULL, 0x1c35 }, { 0xffffffffffff007fULL, 0x1c36 },
+    { 0xffffffffffff00ffULL, 0x1c37 }, { 0xffffffffffff01ffULL, 0x1c38 },
+    { 0xffffffffffff03ffULL, 0x1c39 }, { 0xffffffffffff07ffULL, 0x1c3a },
+    { 0xffffffffffff0fffULL, 0x1c3b }, { 0xffffffffffff1fffULL, 0x1c3c },
+    { 0xffffffffffff3fffULL, 0x1c3d }, { 0xffffffffffff7fffULL, 0x1c3e },
+    { 0xffffffffffff8000ULL, 0x1c70 }, { 0xffffffffffff8001ULL, 0x1c71 },
+    { 0xffffffffffff8003ULL, 0x1c72 }, { 0xffffffffffff8007ULL, 0x1c73 },
+    { 0xffffffffffff800fULL, 0x1c74 }, { 0xffffffffffff801fULL, 0x1c75 },
+    { 0xffffffffffff803fULL, 0x1c76 }, { 0xffffffffffff807fULL, 0x1c77 },
+    { 0xffffffffffff80ffULL, 0x1c78 }, { 0xffffffffffff81ffULL, 0x1c79 },
+    { 0xffffffffffff83ffULL, 0x1c7a }, { 0xffffffffffff87ffULL, 0x1c7b },
+    { 0xffffffffffff8fffULL, 0x1c7c }, { 0xffffffffffff9fffULL, 0x1c7d },
+    { 0xffffffffffffbfffULL, 0x1c7e }, { 0xffffffffffffc000ULL, 0x1cb1 },
+    { 0xffffffffffffc001ULL, 0x1cb2 }, { 0xffffffffffffc003ULL, 0x1cb3 },
+    { 0xffffffffffffc007ULL, 0x1cb4 }, { 0xffffffffffffc00fULL, 0x1cb5 },
+    { 0xffffffffffffc01fULL, 0x1cb6 }, { 0xffffffffffffc03fULL, 0x1cb7 },
+    { 0xffffffffffffc07fULL, 0x1cb8 }, { 0xffffffffffffc0ffULL, 0x1cb9 },
+    { 0xffffffffffffc1ffULL, 0x1cba }, { 0xffffffffffffc3ffULL, 0x1cbb },
+    { 0xffffffffffffc7ffULL, 0x1cbc }, { 0xffffffffffffcfffULL, 0x1cbd },
+    { 0xffffffffffffdfffULL, 0x1cbe }, { 0xffffffffffffe000ULL, 0x1cf2 },
+    { 0xffffffffffffe001ULL, 0x1cf3 }, { 0xffffffffffffe003ULL, 0x1cf4 },
+    { 0xffffffffffffe007ULL, 0x1cf5 }, { 0xffffffffffffe00fULL, 0x1cf6 },
+    { 0xffffffffffffe01fULL, 0x1cf7 }, { 0xffffffffffffe03fULL, 0x1cf8 },
+    { 0xffffffffffffe07fULL, 0x1cf9 }, { 0xffffffffffffe0ffULL, 0x1cfa },
+    { 0xffffffffffffe1ffULL, 0x1cfb }, { 0xffffffffffffe3ffULL, 0x1cfc },
+    { 0xffffffffffffe7ffULL, 0x1cfd }, { 0xffffffffffffefffULL, 0x1cfe },
+    { 0xfffffffffffff000ULL, 0x1d33 }, { 0xfffffffffffff001ULL, 0x1d34 },
+    { 0xfffffffffffff003ULL, 0x1d35 }, { 0xfffffffffffff007ULL, 0x1d36 },
+    { 0xfffffffffffff00fULL, 0x1d37 }, { 0xfffffffffffff01fULL, 0x1d38 },
+    { 0xfffffffffffff03fULL, 0x1d39 }, { 0xfffffffffffff07fULL, 0x1d3a },
+    { 0xfffffffffffff0ffULL, 0x1d3b }, { 0xfffffffffffff1ffULL, 0x1d3c },
+    { 0xfffffffffffff3ffULL, 0x1d3d }, { 0xfffffffffffff7ffULL, 0x1d3e },
+    { 0xfffffffffffff800ULL, 0x1d74 }, { 0xfffffffffffff801ULL, 0x1d75 },
+    { 0xfffffffffffff803ULL, 0x1d76 }, { 0xfffffffffffff807ULL, 0x1d77 },
+    { 0xfffffffffffff80fULL, 0x1d78 }, { 0xfffffffffffff81fULL, 0x1d79 },
+    { 0xfffffffffffff83fULL, 0x1d7a }, { 0xfffffffffffff87fULL, 0x1d7b },
+    { 0xfffffffffffff8ffULL, 0x1d7c }, { 0xfffffffffffff9ffULL, 0x1d7d },
+    { 0xfffffffffffffbffULL, 0x1d7e }, { 0xfffffffffffffc00ULL, 0x1db5 },
+    { 0xfffffffffffffc01ULL, 0x1db6 }, { 0xfffffffffffffc03ULL, 0x1db7 },
+    { 0xfffffffffffffc07ULL, 0x1db8 }, { 0xfffffffffffffc0fULL, 0x1db9 },
+    { 0xfffffffffffffc1fULL, 0x1dba }, { 0xfffffffffffffc3fULL, 0x1dbb },
+    { 0xfffffffffffffc7fULL, 0x1dbc }, { 0xfffffffffffffcffULL, 0x1dbd },
+    { 0xfffffffffffffdffULL, 0x1dbe }, { 0xfffffffffffffe00ULL, 0x1df6 },
+    { 0xfffffffffffffe01ULL, 0x1df7 }, { 0xfffffffffffffe03ULL, 0x1df8 },
+    { 0xfffffffffffffe07ULL, 0x1df9 }, { 0xfffffffffffffe0fULL, 0x1dfa },
+    { 0xfffffffffffffe1fULL, 0x1dfb }, { 0xfffffffffffffe3fULL, 0x1dfc },
+    { 0xfffffffffffffe7fULL, 0x1dfd }, { 0xfffffffffffffeffULL, 0x1dfe },
+    { 0xffffffffffffff00ULL, 0x1e37 }, { 0xffffffffffffff01ULL, 0x1e38 },
+    { 0xffffffffffffff03ULL, 0x1e39 }, { 0xffffffffffffff07ULL, 0x1e3a },
+    { 0xffffffffffffff0fULL, 0x1e3b }, { 0xffffffffffffff1fULL, 0x1e3c },
+    { 0xffffffffffffff3fULL, 0x1e3d }, { 0xffffffffffffff7fULL, 0x1e3e },
+    { 0xffffffffffffff80ULL, 0x1e78 }, { 0xffffffffffffff81ULL, 0x1e79 },
+    { 0xffffffffffffff83ULL, 0x1e7a }, { 0xffffffffffffff87ULL, 0x1e7b },
+    { 0xffffffffffffff8fULL, 0x1e7c }, { 0xffffffffffffff9fULL, 0x1e7d },
+    { 0xffffffffffffffbfULL, 0x1e7e }, { 0xffffffffffffffc0ULL, 0x1eb9 },
+    { 0xffffffffffffffc1ULL, 0x1eba }, { 0xffffffffffffffc3ULL, 0x1ebb },
+    { 0xffffffffffffffc7ULL, 0x1ebc }, { 0xffffffffffffffcfULL, 0x1ebd },
+    { 0xffffffffffffffdfULL, 0x1ebe }, { 0xffffffffffffffe0ULL, 0x1efa },
+    { 0xffffffffffffffe1ULL, 0x1efb }, { 0xffffffffffffffe3ULL, 0x1efc },
+    { 0xffffffffffffffe7ULL, 0x1efd }, { 0xffffffffffffffefULL, 0x1efe },
+    { 0xfffffffffffffff0ULL, 0x1f3b }, { 0xfffffffffffffff1ULL, 0x1f3c },
+    { 0xfffffffffffffff3ULL, 0x1f3d }, { 0xfffffffffffffff7ULL, 0x1f3e },
+    { 0xfffffffffffffff8ULL, 0x1f7c }, { 0xfffffffffffffff9ULL, 0x1f7d },
+    { 0xfffffffffffffffbULL, 0x1f7e }, { 0xfffffffffffffffcULL, 0x1fbd },
+    { 0xfffffffffffffffdULL, 0x1fbe }, { 0xfffffffffffffffeULL, 0x1ffe },
+};
+
+const uint64_t A64_LOGICAL_IMMEDIATE_ENCODINGS_LEN = sizeof (A64_LOGICAL_IMMEDIATE_ENCODINGS) / sizeof (*A64_LOGICAL_IMMEDIATE_ENCODINGS);
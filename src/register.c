@@ -17,9 +17,9 @@
 #include "register.h"
 
 const char *
-libarch_get_general_register (arm64_reg_t reg, const char **list, uint64_t len)
+libarch_get_general_register (arm64_reg_t reg, const char *const *list, uint64_t len)
 {
-    if (reg > len) return "(unk)";
+    if (reg >= len) return "(unk)";
     return list[reg];
 }
 
@@ -0,0 +1,293 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "symbol.h"
+
+/**
+ *  The last symbol found by each thread, and the table it was found in. The
+ *  generation guards against a freed table's memory being reused for a new
+ *  one, since every finalise gets a new generation.
+ */
+typedef struct symtab_cache_t
+{
+    const libarch_symtab_t     *symtab;
+    uint64_t                    generation;
+    size_t                      index;
+} symtab_cache_t;
+
+static _Thread_local symtab_cache_t _last_hit;
+static uint64_t _generation;
+
+/* Before finalising, a symbol's name is an offset into the name arena */
+#define NAME_OFFSET(s)          ((size_t) (uintptr_t) (s)->name)
+
+/* Entry used to sort symbols by address, then by the order they were added */
+typedef struct symtab_sort_t
+{
+    uint64_t            addr;
+    size_t              index;
+} symtab_sort_t;
+
+LIBARCH_PRIVATE LIBARCH_API
+uint32_t
+_hash_name (const char *name, size_t len)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) h = (h ^ (uint8_t) name[i]) * 16777619u;
+    return h;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_grow_hash (libarch_symtab_t *symtab)
+{
+    size_t cap = (symtab->hash_cap) ? symtab->hash_cap * 2 : 1024;
+    uint32_t *hash = calloc (cap, sizeof (uint32_t));
+    if (!hash) return LIBARCH_RETURN_FAILURE;
+
+    /* Re-insert every name already in the old table */
+    for (size_t i = 0; i < symtab->hash_cap; i++) {
+        uint32_t off = symtab->hash[i];
+        if (!off) continue;
+
+        const char *name = symtab->names + off - 1;
+        size_t j = _hash_name (name, strlen (name)) & (cap - 1);
+        while (hash[j]) j = (j + 1) & (cap - 1);
+        hash[j] = off;
+    }
+
+    free (symtab->hash);
+    symtab->hash = hash;
+    symtab->hash_cap = cap;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+/* Find `name` in the arena, or add it. Returns it's offset, or -1 on failure */
+LIBARCH_PRIVATE LIBARCH_API
+long
+_intern_name (libarch_symtab_t *symtab, const char *name)
+{
+    size_t len = strlen (name);
+
+    /**
+     *  Keep the hash table at most half full. It's sized by the names in it,
+     *  not the symbols, as finalising drops symbols but keeps their names.
+     */
+    if ((symtab->hash_len + 1) * 2 > symtab->hash_cap && !_grow_hash (symtab))
+        return -1;
+
+    size_t j = _hash_name (name, len) & (symtab->hash_cap - 1);
+    for (; symtab->hash[j]; j = (j + 1) & (symtab->hash_cap - 1)) {
+        const char *s = symtab->names + symtab->hash[j] - 1;
+        if (!strcmp (s, name)) return symtab->hash[j] - 1;
+    }
+
+    if (symtab->names_len + len + 1 > symtab->names_cap) {
+        size_t cap = (symtab->names_cap) ? symtab->names_cap * 2 : 4096;
+        while (cap < symtab->names_len + len + 1) cap *= 2;
+
+        char *names = realloc (symtab->names, cap);
+        if (!names) return -1;
+        symtab->names = names;
+        symtab->names_cap = cap;
+    }
+
+    size_t off = symtab->names_len;
+    if (off + 1 > UINT32_MAX) return -1;
+
+    memcpy (symtab->names + off, name, len + 1);
+    symtab->names_len += len + 1;
+    symtab->hash[j] = (uint32_t) off + 1;
+    symtab->hash_len++;
+    return (long) off;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+int
+_compare_sort (const void *a, const void *b)
+{
+    const symtab_sort_t *x = a, *y = b;
+    if (x->addr != y->addr) return (x->addr < y->addr) ? -1 : 1;
+    return (x->index < y->index) ? -1 : (x->index > y->index);
+}
+
+/* Fill the Eytzinger index from the sorted symbols with an in-order walk */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_build_index (libarch_symtab_t *symtab, size_t *i, size_t k)
+{
+    if (k > symtab->len) return;
+
+    _build_index (symtab, i, 2 * k);
+    symtab->index[k] = symtab->symbols[*i].addr;
+    symtab->index_symbol[k] = (uint32_t) (*i)++;
+    _build_index (symtab, i, 2 * k + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+LIBARCH_API
+void
+libarch_symtab_init (libarch_symtab_t *symtab)
+{
+    memset (symtab, 0, sizeof (libarch_symtab_t));
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_symtab_add (libarch_symtab_t *symtab, uint64_t addr, uint64_t size, const char *name)
+{
+    /* Go back to storing names as offsets, as the arena may move */
+    if (symtab->finalised) {
+        for (size_t i = 0; i < symtab->len; i++)
+            symtab->symbols[i].name = (const char *) (uintptr_t) (symtab->symbols[i].name - symtab->names);
+        symtab->finalised = 0;
+    }
+
+    if (symtab->len == symtab->cap) {
+        size_t cap = (symtab->cap) ? symtab->cap * 2 : 256;
+        libarch_symbol_t *symbols = realloc (symtab->symbols, cap * sizeof (libarch_symbol_t));
+        if (!symbols) return LIBARCH_RETURN_FAILURE;
+        symtab->symbols = symbols;
+        symtab->cap = cap;
+    }
+
+    long off = _intern_name (symtab, name);
+    if (off < 0) return LIBARCH_RETURN_FAILURE;
+
+    libarch_symbol_t *sym = &symtab->symbols[symtab->len++];
+    sym->addr = addr;
+    sym->size = size;
+    sym->name = (const char *) (uintptr_t) off;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+libarch_return_t
+libarch_symtab_finalise (libarch_symtab_t *symtab)
+{
+    size_t n = symtab->len;
+
+    if (symtab->finalised) return LIBARCH_RETURN_SUCCESS;
+
+    symtab_sort_t *sort = malloc ((n ? n : 1) * sizeof (symtab_sort_t));
+    libarch_symbol_t *symbols = malloc ((n ? n : 1) * sizeof (libarch_symbol_t));
+    if (!sort || !symbols) {
+        free (sort);
+        free (symbols);
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        sort[i].addr = symtab->symbols[i].addr;
+        sort[i].index = i;
+    }
+    qsort (sort, n, sizeof (symtab_sort_t), _compare_sort);
+
+    /* Keep the first symbol added at each address, and resolve the names */
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (len && symbols[len - 1].addr == sort[i].addr) continue;
+        symbols[len] = symtab->symbols[sort[i].index];
+        symbols[len].name = symtab->names + NAME_OFFSET (&symbols[len]);
+        len++;
+    }
+    free (sort);
+    free (symtab->symbols);
+    symtab->symbols = symbols;
+    symtab->len = len;
+    symtab->cap = (n ? n : 1);
+
+    free (symtab->index);
+    free (symtab->index_symbol);
+    symtab->index = malloc ((len + 1) * sizeof (uint64_t));
+    symtab->index_symbol = malloc ((len + 1) * sizeof (uint32_t));
+    if (!symtab->index || !symtab->index_symbol) {
+        for (size_t i = 0; i < len; i++)
+            symtab->symbols[i].name = (const char *) (uintptr_t) (symtab->symbols[i].name - symtab->names);
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    size_t i = 0;
+    _build_index (symtab, &i, 1);
+
+    symtab->generation = __atomic_add_fetch (&_generation, 1, __ATOMIC_RELAXED);
+    symtab->finalised = 1;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+
+LIBARCH_API
+const libarch_symbol_t *
+libarch_symtab_lookup (const libarch_symtab_t *symtab, uint64_t addr, uint64_t *offset)
+{
+    const libarch_symbol_t *symbols = symtab->symbols;
+    size_t n = symtab->len, i;
+
+    if (!symtab->finalised || !n) return NULL;
+
+    /* Targets cluster, so first try the symbol this thread found last time */
+    i = _last_hit.index;
+    if (_last_hit.symtab != symtab || _last_hit.generation != symtab->generation ||
+        addr < symbols[i].addr || (i + 1 < n && addr >= symbols[i + 1].addr)) {
+
+        /**
+         *  Descend the tree, going right while the node is <= addr. The path
+         *  ends below the first symbol above `addr`, which is recovered by
+         *  dropping the trailing right turns and the final left one.
+         */
+        size_t k = 1;
+        while (k <= n) k = 2 * k + (symtab->index[k] <= addr);
+        k >>= __builtin_ffsll ((long long) ~k);
+
+        i = (k) ? symtab->index_symbol[k] : n;
+        if (i == 0) return NULL;
+        i--;
+
+        _last_hit.symtab = symtab;
+        _last_hit.generation = symtab->generation;
+        _last_hit.index = i;
+    }
+
+    if (symbols[i].size && addr - symbols[i].addr >= symbols[i].size) return NULL;
+    if (offset) *offset = addr - symbols[i].addr;
+    return &symbols[i];
+}
+
+
+LIBARCH_API
+const char *
+libarch_symtab_symbolize (void *arg, uint64_t addr, uint64_t *offset)
+{
+    const libarch_symbol_t *sym = libarch_symtab_lookup ((const libarch_symtab_t *) arg, addr, offset);
+    return (sym) ? sym->name : NULL;
+}
+
+
+LIBARCH_API
+void
+libarch_symtab_free (libarch_symtab_t *symtab)
+{
+    free (symtab->symbols);
+    free (symtab->names);
+    free (symtab->hash);
+    free (symtab->index);
+    free (symtab->index_symbol);
+    memset (symtab, 0, sizeof (libarch_symtab_t));
+}
@@ -0,0 +1,1328 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ *  String tables used by the decoder and clients for converting enum values
+ *  into their textual form. These used to be defined `static` in each header
+ *  under include/arm64/, which gave every translation unit its own copy. They
+ *  are now defined once here, as read-only data, and declared in the headers.
+ */
+
+#include "arm64/arm64-instructions.h"
+#include "arm64/arm64-registers.h"
+#include "arm64/arm64-conditions.h"
+#include "arm64/arm64-index-extend.h"
+#include "arm64/arm64-pstate.h"
+#include "arm64/arm64-prefetch-ops.h"
+#include "arm64/arm64-sve-patterns.h"
+#include "arm64/arm64-translation.h"
+#include "arm64/arm64-tlbi-ops.h"
+#include "arm64/arm64-vector-specifiers.h"
+
+/******************************************************************************
+*       Instructions
+*******************************************************************************/
+
+const char *const A64_INSTRUCTIONS_STR[] =
+{
+    "unk",
+    "adc",
+    "adcs",
+    "add",
+    "addg",
+    "adds",
+    "adr",
+    "adrp",
+    "and",
+    "ands",
+    "asr",
+    "asrv",
+    "at",
+    "autda",
+    "autdza",
+    "autdb",
+    "autdzb",
+    "autia",
+    "autiza",
+    "autia1716",
+    "autiasp",
+    "autiaz",
+    "autib",
+    "autizb",
+    "autib1716",
+    "autibsp",
+    "autibz",
+    "axflag",
+    "arm_ddi",
+    "b",
+    "bfc",
+    "bfi",
+    "bfm",
+    "bfxil",
+    "bic",
+    "bics",
+    "bl",
+    "blr",
+    "blraaz",
+    "blraa",
+    "blrabz",
+    "blrab",
+    "br",
+    "braaz",
+    "braa",
+    "brabz",
+    "brab",
+    "brk",
+    "bti",
+    "casab",
+    "casalb",
+    "casb",
+    "caslb",
+    "casah",
+    "casalh",
+    "cash",
+    "caslh",
+    "casp",
+    "caspa",
+    "caspal",
+    "caspl",
+    "cas",
+    "casa",
+    "casal",
+    "casl",
+    "cbnz",
+    "cbz",
+    "ccmn",
+    "ccmp",
+    "cfinv",
+    "cfp",
+    "cinc",
+    "cinv",
+    "clrex",
+    "cls",
+    "clz",
+    "cmn",
+    "cmp",
+    "cmpp",
+    "cneg",
+    "cpp",
+    "crc32b",
+    "crc32h",
+    "crc32w",
+    "crc32x",
+    "crc32cb",
+    "crc32ch",
+    "crc32cw",
+    "crc32cx",
+    "csdb",
+    "csel",
+    "cset",
+    "csetm",
+    "csinc",
+    "csinv",
+    "csneg",
+    "dc",
+    "dcps1",
+    "dcps2",
+    "dcps3",
+    "dmb",
+    "drps",
+    "dsb",
+    "dvp",
+    "eon",
+    "eor",
+    "eret",
+    "eretaa",
+    "eretab",
+    "esb",
+    "extr",
+    "gmi",
+    "hint",
+    "hlt",
+    "hvc",
+    "ic",
+    "irg",
+    "isb",
+    "ldaddab",
+    "ldaddalb",
+    "ldaddb",
+    "ldaddlb",
+    "ldaddah",
+    "ldaddalh",
+    "ldaddh",
+    "ldaddlh",
+    "ldadd",
+    "ldadda",
+    "ldaddal",
+    "ldaddl",
+    "ldapr",
+    "ldaprb",
+    "ldaprh",
+    "ldapur",
+    "ldapurb",
+    "ldapurh",
+    "ldapursb",
+    "ldapursh",
+    "ldapursw",
+    "ldar",
+    "ldarb",
+    "ldarh",
+    "ldaxp",
+    "ldaxr",
+    "ldaxrb",
+    "ldaxrh",
+    "ldclrab",
+    "ldclralb",
+    "ldclrb",
+    "ldclrlb",
+    "ldclrah",
+    "ldclralh",
+    "ldclrh",
+    "ldclrlh",
+    "ldclr",
+    "ldclra",
+    "ldclral",
+    "ldclrl",
+    "ldeorab",
+    "ldeoralb",
+    "ldeorb",
+    "ldeorlb",
+    "ldeorah",
+    "ldeoralh",
+    "ldeorh",
+    "ldeorlh",
+    "ldeor",
+    "ldeora",
+    "ldeoral",
+    "ldeorl",
+    "ldg",
+    "ldgm",
+    "ldlarb",
+    "ldlarh",
+    "ldlar",
+    "ldnp",
+    "ldp",
+    "ldpsw",
+    "ldr",
+    "ldraa",
+    "ldrab",
+    "ldrb",
+    "ldrh",
+    "ldrsb",
+    "ldrsh",
+    "ldrsw",
+    "ldsetab",
+    "ldsetalb",
+    "ldsetb",
+    "ldsetlb",
+    "ldsetah",
+    "ldsetalh",
+    "ldseth",
+    "ldsetlh",
+    "ldset",
+    "ldseta",
+    "ldsetal",
+    "ldsetl",
+    "ldsmaxab",
+    "ldsmaxalb",
+    "ldsmaxb",
+    "ldsmaxlb",
+    "ldsmaxah",
+    "ldsmaxalh",
+    "ldsmaxh",
+    "ldsmaxlh",
+    "ldsmax",
+    "ldsmaxa",
+    "ldsmaxal",
+    "ldsmaxl",
+    "ldsminab",
+    "ldsminalb",
+    "ldsminb",
+    "ldsminlb",
+    "ldsminah",
+    "ldsminalh",
+    "ldsminh",
+    "ldsminlh",
+    "ldsmin",
+    "ldsmina",
+    "ldsminal",
+    "ldsminl",
+    "ldtr",
+    "ldtrb",
+    "ldtrh",
+    "ldtrsb",
+    "ldtrsh",
+    "ldtrsw",
+    "ldumaxab",
+    "ldumaxalb",
+    "ldumaxb",
+    "ldumaxlb",
+    "ldumaxah",
+    "ldumaxalh",
+    "ldumaxh",
+    "ldumaxlh",
+    "ldumax",
+    "ldumaxa",
+    "ldumaxal",
+    "ldumaxl",
+    "lduminab",
+    "lduminalb",
+    "lduminb",
+    "lduminlb",
+    "lduminah",
+    "lduminalh",
+    "lduminh",
+    "lduminlh",
+    "ldumin",
+    "ldumina",
+    "lduminal",
+    "lduminl",
+    "ldur",
+    "ldurb",
+    "ldurh",
+    "ldursb",
+    "ldursh",
+    "ldursw",
+    "ldxp",
+    "ldxr",
+    "ldxrb",
+    "ldxrh",
+    "lsl",
+    "lslv",
+    "lsr",
+    "lsrv",
+    "madd",
+    "mneg",
+    "mov",
+    "movk",
+    "movn",
+    "movz",
+    "mrs",
+    "msr",
+    "msub",
+    "mul",
+    "mvn",
+    "neg",
+    "negs",
+    "ngc",
+    "ngcs",
+    "nop",
+    "orn",
+    "orr",
+    "pacda",
+    "pacdza",
+    "pacdb",
+    "pacdzb",
+    "pacga",
+    "pacia",
+    "paciza",
+    "pacia1716",
+    "paciasp",
+    "paciaz",
+    "pacib",
+    "pacizb",
+    "pacib1716",
+    "pacibsp",
+    "pacibz",
+    "prfm",
+    "prfum",
+    "psb_csync",
+    "pssbb",
+    "rbit",
+    "ret",
+    "retaa",
+    "retab",
+    "rev",
+    "rev16",
+    "rev32",
+    "rev64",
+    "rmif",
+    "ror",
+    "rorv",
+    "sb",
+    "sbc",
+    "sbcs",
+    "sbfiz",
+    "sbfm",
+    "sbfx",
+    "sdiv",
+    "setf8",
+    "setf16",
+    "sev",
+    "sevl",
+    "smaddl",
+    "smc",
+    "smnegl",
+    "smsubl",
+    "smulh",
+    "smull",
+    "ssbb",
+    "st2g",
+    "staddb",
+    "staddlb",
+    "staddh",
+    "staddlh",
+    "stadd",
+    "staddl",
+    "stclrb",
+    "stclrlb",
+    "stclrh",
+    "stclrlh",
+    "stclr",
+    "stclrl",
+    "steorb",
+    "steorlb",
+    "steorh",
+    "steorlh",
+    "steor",
+    "steorl",
+    "stg",
+    "stgm",
+    "stgp",
+    "stllrb",
+    "stllrh",
+    "stllr",
+    "stlr",
+    "stlrb",
+    "stlrh",
+    "stlur",
+    "stlurb",
+    "stlurh",
+    "stlxp",
+    "stlxr",
+    "stlxrb",
+    "stlxrh",
+    "stnp",
+    "stp",
+    "str",
+    "strb",
+    "strh",
+    "stsetb",
+    "stsetlb",
+    "stseth",
+    "stsetlh",
+    "stset",
+    "stsetl",
+    "stsmaxb",
+    "stsmaxlb",
+    "stsmaxh",
+    "stsmaxlh",
+    "stsmax",
+    "stsmaxl",
+    "stsminb",
+    "stsminlb",
+    "stsminh",
+    "stsminlh",
+    "stsmin",
+    "stsminl",
+    "sttr",
+    "sttrb",
+    "sttrh",
+    "stumaxb",
+    "stumaxlb",
+    "stumaxh",
+    "stumaxlh",
+    "stumax",
+    "stumaxl",
+    "stuminb",
+    "stuminlb",
+    "stuminh",
+    "stuminlh",
+    "stumin",
+    "stuminl",
+    "stur",
+    "sturb",
+    "sturh",
+    "stxp",
+    "stxr",
+    "stxrb",
+    "stxrh",
+    "stz2g",
+    "stzg",
+    "stzgm",
+    "sub",
+    "subg",
+    "subp",
+    "subps",
+    "subs",
+    "svc",
+    "swpab",
+    "swpalb",
+    "swpb",
+    "swplb",
+    "swpah",
+    "swpalh",
+    "swph",
+    "swplh",
+    "swp",
+    "swpa",
+    "swpal",
+    "swpl",
+    "sxtb",
+    "sxth",
+    "sxtw",
+    "sys",
+    "sysl",
+    "tbnz",
+    "tbz",
+    "tlbi",
+    "tsb_csync",
+    "tst",
+    "ubfiz",
+    "ubfm",
+    "ubfx",
+    "udf",
+    "udiv",
+    "umaddl",
+    "umnegl",
+    "umsubl",
+    "umulh",
+    "umull",
+    "uxtb",
+    "uxth",
+    "wfe",
+    "wfi",
+    "xaflag",
+    "xpacd",
+    "xpaci",
+    "xpaclri",
+    "yield",
+    "abs",
+    "addhn",
+    "addhn2",
+    "addp",
+    "addv",
+    "aesd",
+    "aese",
+    "aesimc",
+    "aesmc",
+    "bcax",
+    "bif",
+    "bit",
+    "bsl",
+    "cmeq",
+    "cmge",
+    "cmgt",
+    "cmhi",
+    "cmhs",
+    "cmle",
+    "cmlt",
+    "cmtst",
+    "cnt",
+    "dup",
+    "eor3",
+    "ext",
+    "fabd",
+    "fabs",
+    "facge",
+    "facgt",
+    "fadd",
+    "faddp",
+    "fcadd",
+    "fccmp",
+    "fccmpe",
+    "fcmeq",
+    "fcmge",
+    "fcmgt",
+    "fcmla",
+    "fcmle",
+    "fcmlt",
+    "fcmp",
+    "fcmpe",
+    "fcsel",
+    "fcvt",
+    "fcvtas",
+    "fcvtau",
+    "fcvtl",
+    "fcvtl2",
+    "fcvtms",
+    "fcvtmu",
+    "fcvtn",
+    "fcvtn2",
+    "fcvtns",
+    "fcvtnu",
+    "fcvtps",
+    "fcvtpu",
+    "fcvtxn",
+    "fcvtxn2",
+    "fcvtzs",
+    "fcvtzu",
+    "fdiv",
+    "fjcvtzs",
+    "fmadd",
+    "fmax",
+    "fmaxnm",
+    "fmaxnmp",
+    "fmaxnmv",
+    "fmaxp",
+    "fmaxv",
+    "fmin",
+    "fminnm",
+    "fminnmp",
+    "fminnmv",
+    "fminp",
+    "fminv",
+    "fmla",
+    "fmlal",
+    "fmlal2",
+    "fmls",
+    "fmlsl",
+    "fmlsl2",
+    "fmov",
+    "fmsub",
+    "fmul",
+    "fmulx",
+    "fneg",
+    "fnmadd",
+    "fnmsub",
+    "fnmul",
+    "frecpe",
+    "frecps",
+    "frecpx",
+    "frint32x",
+    "frint32z",
+    "frint64x",
+    "frint64z",
+    "frinta",
+    "frinti",
+    "frintm",
+    "frintn",
+    "frintp",
+    "frintx",
+    "frintz",
+    "frsqrte",
+    "frsqrts",
+    "fsqrt",
+    "fsub",
+    "ins",
+    "ld1",
+    "ld1r",
+    "ld2",
+    "ld2r",
+    "ld3",
+    "ld3r",
+    "ld4",
+    "ld4r",
+    "mla",
+    "mls",
+    "movi",
+    "mvni",
+    "not",
+    "pmul",
+    "pmull",
+    "pmull2",
+    "raddhn",
+    "raddhn2",
+    "rax1",
+    "rshrn",
+    "rshrn2",
+    "rsubhn",
+    "rsubhn2",
+    "saba",
+    "sabal",
+    "sabal2",
+    "sabd",
+    "sabdl",
+    "sabdl2",
+    "sadalp",
+    "saddl",
+    "saddl2",
+    "saddlp",
+    "saddlv",
+    "saddw",
+    "saddw2",
+    "scvtf",
+    "sdot",
+    "sha1c",
+    "sha1h",
+    "sha1m",
+    "sha1p",
+    "sha1su0",
+    "sha1su1",
+    "sha256h2",
+    "sha256h",
+    "sha256su0",
+    "sha256su1",
+    "sha512h",
+    "sha512h2",
+    "sha512su0",
+    "sha512su1",
+    "shadd",
+    "shl",
+    "shll",
+    "shll2",
+    "shrn",
+    "shrn2",
+    "shsub",
+    "sli",
+    "sm3partw1",
+    "sm3partw2",
+    "sm3ss1",
+    "sm3tt1a",
+    "sm3tt1b",
+    "sm3tt2a",
+    "sm3tt2b",
+    "sm4e",
+    "sm4ekey",
+    "smax",
+    "smaxp",
+    "smaxv",
+    "smin",
+    "sminp",
+    "sminv",
+    "smlal",
+    "smlal2",
+    "smlsl",
+    "smlsl2",
+    "smov",
+    "smull2",
+    "sqabs",
+    "sqadd",
+    "sqdmlal",
+    "sqdmlal2",
+    "sqdmlsl",
+    "sqdmlsl2",
+    "sqdmulh",
+    "sqdmull",
+    "sqdmull2",
+    "sqneg",
+    "sqrdmlah",
+    "sqrdmlsh",
+    "sqrdmulh",
+    "sqrshl",
+    "sqrshrn",
+    "sqrshrn2",
+    "sqrshrun",
+    "sqrshrun2",
+    "sqshl",
+    "sqshlu",
+    "sqshrn",
+    "sqshrn2",
+    "sqshrun",
+    "sqshrun2",
+    "sqsub",
+    "sqxtn",
+    "sqxtn2",
+    "sqxtun",
+    "sqxtun2",
+    "srhadd",
+    "sri",
+    "srshl",
+    "srshr",
+    "srsra",
+    "sshl",
+    "sshll",
+    "sshll2",
+    "sshr",
+    "ssra",
+    "ssubl",
+    "ssubl2",
+    "ssubw",
+    "ssubw2",
+    "st1",
+    "st2",
+    "st3",
+    "st4",
+    "subhn",
+    "subhn2",
+    "suqadd",
+    "sxtl",
+    "sxtl2",
+    "tbl",
+    "tbx",
+    "trn1",
+    "trn2",
+    "uaba",
+    "uabal",
+    "uabal2",
+    "uabd",
+    "uabdl",
+    "uabdl2",
+    "uadalp",
+    "uaddl",
+    "uaddl2",
+    "uaddlp",
+    "uaddlv",
+    "uaddw",
+    "uaddw2",
+    "ucvtf",
+    "udot",
+    "uhadd",
+    "uhsub",
+    "umax",
+    "umaxp",
+    "umaxv",
+    "umin",
+    "uminp",
+    "uminv",
+    "umlal",
+    "umlal2",
+    "umlsl",
+    "umlsl2",
+    "umov",
+    "umull2",
+    "uqadd",
+    "uqrshl",
+    "uqrshrn",
+    "uqrshrn2",
+    "uqshl",
+    "uqshrn",
+    "uqshrn2",
+    "uqsub",
+    "uqxtn",
+    "uqxtn2",
+    "urecpe",
+    "urhadd",
+    "urshl",
+    "urshr",
+    "ursqrte",
+    "ursra",
+    "ushl",
+    "ushll",
+    "ushll2",
+    "ushr",
+    "usqadd",
+    "usra",
+    "usubl",
+    "usubl2",
+    "usubw",
+    "usubw2",
+    "uxtl",
+    "uxtl2",
+    "uzp1",
+    "uzp2",
+    "xar",
+    "xtn",
+    "xtn2",
+    "zip1",
+    "zip2",
+    "wfet",
+    "wfit",
+    "dgh",
+    "tcommit",
+    "addpl",
+    "addvl",
+    "andv",
+    "asrd",
+    "asrr",
+    "cmpeq",
+    "cmpge",
+    "cmpgt",
+    "cmphi",
+    "cmphs",
+    "cmple",
+    "cmplo",
+    "cmpls",
+    "cmplt",
+    "cmpne",
+    "cnot",
+    "cntb",
+    "cntd",
+    "cnth",
+    "cntp",
+    "cntw",
+    "decb",
+    "decd",
+    "dech",
+    "decw",
+    "eors",
+    "eorv",
+    "faddv",
+    "fcmne",
+    "fcmuo",
+    "fdivr",
+    "fmad",
+    "fmsb",
+    "fnmad",
+    "fnmla",
+    "fnmls",
+    "fnmsb",
+    "fscale",
+    "fsubr",
+    "ftsmul",
+    "incb",
+    "incd",
+    "inch",
+    "incw",
+    "index",
+    "ld1b",
+    "ld1d",
+    "ld1h",
+    "ld1sb",
+    "ld1sh",
+    "ld1sw",
+    "ld1w",
+    "ld2b",
+    "ld2d",
+    "ld2h",
+    "ld2w",
+    "ld3b",
+    "ld3d",
+    "ld3h",
+    "ld3w",
+    "ld4b",
+    "ld4d",
+    "ld4h",
+    "ld4w",
+    "ldff1b",
+    "ldff1d",
+    "ldff1h",
+    "ldff1sb",
+    "ldff1sh",
+    "ldff1sw",
+    "ldff1w",
+    "ldnf1b",
+    "ldnf1d",
+    "ldnf1h",
+    "ldnf1sb",
+    "ldnf1sh",
+    "ldnf1sw",
+    "ldnf1w",
+    "ldnt1b",
+    "ldnt1d",
+    "ldnt1h",
+    "ldnt1w",
+    "lslr",
+    "lsrr",
+    "mad",
+    "movprfx",
+    "movs",
+    "msb",
+    "nand",
+    "nands",
+    "nor",
+    "nors",
+    "nots",
+    "orns",
+    "orrs",
+    "orv",
+    "pfalse",
+    "ptest",
+    "ptrue",
+    "ptrues",
+    "rdvl",
+    "saddv",
+    "sdivr",
+    "sel",
+    "st1b",
+    "st1d",
+    "st1h",
+    "st1w",
+    "st2b",
+    "st2d",
+    "st2h",
+    "st2w",
+    "st3b",
+    "st3d",
+    "st3h",
+    "st3w",
+    "st4b",
+    "st4d",
+    "st4h",
+    "st4w",
+    "stnt1b",
+    "stnt1d",
+    "stnt1h",
+    "stnt1w",
+    "subr",
+    "uaddv",
+    "udivr",
+    "uxtw",
+    "whilege",
+    "whilegt",
+    "whilehi",
+    "whilehs",
+    "whilele",
+    "whilelo",
+    "whilels",
+    "whilelt",
+    "histcnt",
+    "sabdlb",
+    "sabdlt",
+    "saddlb",
+    "saddlt",
+    "smlalb",
+    "smlalt",
+    "smlslb",
+    "smlslt",
+    "smullb",
+    "smullt",
+    "sqdmullb",
+    "sqdmullt",
+    "ssublb",
+    "ssublt",
+    "uabdlb",
+    "uabdlt",
+    "uaddlb",
+    "uaddlt",
+    "umlalb",
+    "umlalt",
+    "umlslb",
+    "umlslt",
+    "umullb",
+    "umullt",
+    "usublb",
+    "usublt",
+    "cpyfp",
+    "cpyfpwt",
+    "cpyfprt",
+    "cpyfpt",
+    "cpyfpwn",
+    "cpyfpwtwn",
+    "cpyfprtwn",
+    "cpyfptwn",
+    "cpyfprn",
+    "cpyfpwtrn",
+    "cpyfprtrn",
+    "cpyfptrn",
+    "cpyfpn",
+    "cpyfpwtn",
+    "cpyfprtn",
+    "cpyfptn",
+    "cpyfm",
+    "cpyfmwt",
+    "cpyfmrt",
+    "cpyfmt",
+    "cpyfmwn",
+    "cpyfmwtwn",
+    "cpyfmrtwn",
+    "cpyfmtwn",
+    "cpyfmrn",
+    "cpyfmwtrn",
+    "cpyfmrtrn",
+    "cpyfmtrn",
+    "cpyfmn",
+    "cpyfmwtn",
+    "cpyfmrtn",
+    "cpyfmtn",
+    "cpyfe",
+    "cpyfewt",
+    "cpyfert",
+    "cpyfet",
+    "cpyfewn",
+    "cpyfewtwn",
+    "cpyfertwn",
+    "cpyfetwn",
+    "cpyfern",
+    "cpyfewtrn",
+    "cpyfertrn",
+    "cpyfetrn",
+    "cpyfen",
+    "cpyfewtn",
+    "cpyfertn",
+    "cpyfetn",
+    "cpyp",
+    "cpypwt",
+    "cpyprt",
+    "cpypt",
+    "cpypwn",
+    "cpypwtwn",
+    "cpyprtwn",
+    "cpyptwn",
+    "cpyprn",
+    "cpypwtrn",
+    "cpyprtrn",
+    "cpyptrn",
+    "cpypn",
+    "cpypwtn",
+    "cpyprtn",
+    "cpyptn",
+    "cpym",
+    "cpymwt",
+    "cpymrt",
+    "cpymt",
+    "cpymwn",
+    "cpymwtwn",
+    "cpymrtwn",
+    "cpymtwn",
+    "cpymrn",
+    "cpymwtrn",
+    "cpymrtrn",
+    "cpymtrn",
+    "cpymn",
+    "cpymwtn",
+    "cpymrtn",
+    "cpymtn",
+    "cpye",
+    "cpyewt",
+    "cpyert",
+    "cpyet",
+    "cpyewn",
+    "cpyewtwn",
+    "cpyertwn",
+    "cpyetwn",
+    "cpyern",
+    "cpyewtrn",
+    "cpyertrn",
+    "cpyetrn",
+    "cpyen",
+    "cpyewtn",
+    "cpyertn",
+    "cpyetn",
+    "setp",
+    "setpt",
+    "setpn",
+    "setptn",
+    "setm",
+    "setmt",
+    "setmn",
+    "setmtn",
+    "sete",
+    "setet",
+    "seten",
+    "setetn",
+    "setgp",
+    "setgpt",
+    "setgpn",
+    "setgptn",
+    "setgm",
+    "setgmt",
+    "setgmn",
+    "setgmtn",
+    "setge",
+    "setget",
+    "setgen",
+    "setgetn",
+};
+
+const uint64_t A64_INSTRUCTIONS_STR_LEN = sizeof (A64_INSTRUCTIONS_STR) / sizeof (*A64_INSTRUCTIONS_STR);
+
+/******************************************************************************
+*       Registers
+*******************************************************************************/
+
+const char *const A64_REGISTERS_GP_64[] = {
+    "x0",  "x1",  "x2",  "x3",  "x4",  "x5",  "x6",  "x7",
+    "x8",  "x9",  "x10", "x11", "x12", "x13", "x14", "x15",
+    "x16", "x17", "x18", "x19", "x20", "x21", "x22", "x23",
+    "x24", "x25", "x26", "x27", "x28", "x29", "x30",
+    "sp",  "xzr"
+};
+
+const char *const A64_REGISTERS_GP_32[] = {
+    "w0",  "w1",  "w2",  "w3",  "w4",  "w5",  "w6",  "w7",
+    "w8",  "w9",  "w10", "w11", "w12", "w13", "w14", "w15",
+    "w16", "w17", "w18", "w19", "w20", "w21", "w22", "w23",
+    "w24", "w25", "w26", "w27", "w28", "w29", "w30",
+    "wsp",  "wzr"
+};
+
+const char *const A64_REGISTERS_FP_128[] = {
+    "v0",  "v1",  "v2",  "v3",  "v4",  "v5",  "v6",  "v7",
+    "v8",  "v9",  "v10", "v11", "v12", "v13", "v14", "v15",
+    "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23",
+    "v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31",
+};
+
+const char *const A64_REGISTERS_FP_8[] = {
+    "b0",  "b1",  "b2",  "b3",  "b4",  "b5",  "b6",  "b7",
+    "b8",  "b9",  "b10", "b11", "b12", "b13", "b14", "b15",
+    "b16", "b17", "b18", "b19", "b20", "b21", "b22", "b23",
+    "b24", "b25", "b26", "b27", "b28", "b29", "b30", "b31",
+};
+
+const char *const A64_REGISTERS_FP_16[] = {
+    "h0",  "h1",  "h2",  "h3",  "h4",  "h5",  "h6",  "h7",
+    "h8",  "h9",  "h10", "h11", "h12", "h13", "h14", "h15",
+    "h16", "h17", "h18", "h19", "h20", "h21", "h22", "h23",
+    "h24", "h25", "h26", "h27", "h28", "h29", "h30", "h31",
+};
+
+const char *const A64_REGISTERS_FP_32[] = {
+    "s0",  "s1",  "s2",  "s3",  "s4",  "s5",  "s6",  "s7",
+    "s8",  "s9",  "s10", "s11", "s12", "s13", "s14", "s15",
+    "s16", "s17", "s18", "s19", "s20", "s21", "s22", "s23",
+    "s24", "s25", "s26", "s27", "s28", "s29", "s30", "s31",
+};
+
+const char *const A64_REGISTERS_FP_64[] = {
+    "d0",  "d1",  "d2",  "d3",  "d4",  "d5",  "d6",  "d7",
+    "d8",  "d9",  "d10", "d11", "d12", "d13", "d14", "d15",
+    "d16", "d17", "d18", "d19", "d20", "d21", "d22", "d23",
+    "d24", "d25", "d26", "d27", "d28", "d29", "d30", "d31",
+};
+
+const char *const A64_REGISTERS_FP_Q[] = {
+    "q0",  "q1",  "q2",  "q3",  "q4",  "q5",  "q6",  "q7",
+    "q8",  "q9",  "q10", "q11", "q12", "q13", "q14", "q15",
+    "q16", "q17", "q18", "q19", "q20", "q21", "q22", "q23",
+    "q24", "q25", "q26", "q27", "q28", "q29", "q30", "q31",
+};
+
+const char *const A64_REGISTERS_SVE_Z[] = {
+    "z0",  "z1",  "z2",  "z3",  "z4",  "z5",  "z6",  "z7",
+    "z8",  "z9",  "z10", "z11", "z12", "z13", "z14", "z15",
+    "z16", "z17", "z18", "z19", "z20", "z21", "z22", "z23",
+    "z24", "z25", "z26", "z27", "z28", "z29", "z30", "z31",
+};
+
+const char *const A64_REGISTERS_SVE_P[] = {
+    "p0",  "p1",  "p2",  "p3",  "p4",  "p5",  "p6",  "p7",
+    "p8",  "p9",  "p10", "p11", "p12", "p13", "p14", "p15",
+};
+
+const uint64_t A64_REGISTERS_GP_64_LEN = sizeof (A64_REGISTERS_GP_64) / sizeof (*A64_REGISTERS_GP_64);
+
+const uint64_t A64_REGISTERS_GP_32_LEN = sizeof (A64_REGISTERS_GP_32) / sizeof (*A64_REGISTERS_GP_32);
+
+const uint64_t A64_REGISTERS_FP_128_LEN = sizeof (A64_REGISTERS_FP_128) / sizeof (*A64_REGISTERS_FP_128);
+
+const uint64_t A64_REGISTERS_FP_8_LEN = sizeof (A64_REGISTERS_FP_8) / sizeof (*A64_REGISTERS_FP_8);
+
+const uint64_t A64_REGISTERS_FP_16_LEN = sizeof (A64_REGISTERS_FP_16) / sizeof (*A64_REGISTERS_FP_16);
+
+const uint64_t A64_REGISTERS_FP_32_LEN = sizeof (A64_REGISTERS_FP_32) / sizeof (*A64_REGISTERS_FP_32);
+
+const uint64_t A64_REGISTERS_FP_64_LEN = sizeof (A64_REGISTERS_FP_64) / sizeof (*A64_REGISTERS_FP_64);
+
+const uint64_t A64_REGISTERS_FP_Q_LEN = sizeof (A64_REGISTERS_FP_Q) / sizeof (*A64_REGISTERS_FP_Q);
+
+const uint64_t A64_REGISTERS_SVE_Z_LEN = sizeof (A64_REGISTERS_SVE_Z) / sizeof (*A64_REGISTERS_SVE_Z);
+
+const uint64_t A64_REGISTERS_SVE_P_LEN = sizeof (A64_REGISTERS_SVE_P) / sizeof (*A64_REGISTERS_SVE_P);
+
+/******************************************************************************
+*       Conditions
+*******************************************************************************/
+
+const char *const A64_CONDITIONS_STR[] =
+{
+    "eq", "ne", "hs", "lo", "mi", "pl",
+    "vs", "vc", "hi", "ls", "ge", "lt",
+    "gt", "le", "al", "nv",
+};
+
+const char *const A64_MEM_BARRIER_CONDITIONS_STR[] =
+{
+    "#0x0", "oshld", "oshst", "osh", "#0x4",
+    "nshld", "nshst", "nsh", "#0x8", "ishld", 
+    "ishst", "ish", "#0xb", "ld", "st", "sy",
+};
+
+const uint64_t A64_CONDITIONS_STR_LEN = sizeof (A64_CONDITIONS_STR) / sizeof (*A64_CONDITIONS_STR);
+
+const uint64_t A64_MEM_BARRIER_CONDITIONS_STR_LEN = sizeof (A64_MEM_BARRIER_CONDITIONS_STR) / sizeof (*A64_MEM_BARRIER_CONDITIONS_STR);
+
+/******************************************************************************
+*       Index Extend
+*******************************************************************************/
+
+const char *const A64_INDEX_EXTEND_STR[] =
+{
+    "uxtb", "uxth", "uxtw", "uxtx", "sxtb", "sxth", "sxtw", "sxtx",
+};
+
+const uint64_t A64_INDEX_EXTEND_LEN = sizeof (A64_INDEX_EXTEND_STR) / sizeof (*A64_INDEX_EXTEND_STR);
+
+/******************************************************************************
+*       PSTATE Fields
+*******************************************************************************/
+
+const char *const A64_PSTATE_STR[] =
+{
+    "SPSel", "DAIFSet", "DAIFClr", "UAO",
+    "PAN", "ALLINT", "SSBS", "DIT", "SVCRSM",
+    "SVCRZA", "SVCRSMZA", "TC0",
+};
+
+const uint64_t A64_PSTATE_STR_LEN = sizeof (A64_PSTATE_STR) / sizeof (*A64_PSTATE_STR);
+
+/******************************************************************************
+*       Prefetch Operations
+*******************************************************************************/
+
+const char *const A64_PRFOP_STR[] =
+{
+    "pldl1keep", "pldl2keep", "pldl3keep", "pldl1strm", "pldl2strm", "pldl3strm",
+    "plil1keep", "plil2keep", "plil3keep", "plil1strm", "plil2strm", "plil3strm",
+    "pstl1keep", "pstl2keep", "pstl3keep", "pstl1strm", "pstl2strm", "pstl3strm", 
+};
+
+const uint64_t A64_PRFOP_STR_LEN = sizeof (A64_PRFOP_STR) / sizeof (*A64_PRFOP_STR);
+
+/******************************************************************************
+*       Address Translation
+*******************************************************************************/
+
+const char *const A64_AT_NAMES_STR[] =
+{
+    "S1E1R", "S1E1W", "S1E0R", "S1E0W",
+    "S1E2R", "S1E2W", "S12E1R", "S12E1W",
+    "S12E0R", "S12E0W", "S1E3R", "S1E3W",
+    "S1E1RP", "S1E1WP",
+};
+
+const uint64_t A64_AT_NAMES_STR_LEN = sizeof (A64_AT_NAMES_STR) / sizeof (*A64_AT_NAMES_STR);
+
+/******************************************************************************
+*       TLBI Operations
+*******************************************************************************/
+
+const char *const A64_TLBI_OPS_STR[] =
+{
+    "vmalle1is", "vae1is", "aside1is", "vaae1is", "vale1is", "vaale1is",
+    "vmalle1", "vae1", "aside1", "vaae1", "vale1", "vaale1", "ipas2e1is", 
+    "ipas2le1is", "alle2is", "vae2is", "alle1is", "vale2is", "vmalls12e1is", 
+    "ipas2e1", "ipas2le1", "alle2", "vae2", "alle1", "vale2", "vmalls12e1", 
+    "alle3is", "vae3is", "vale3is", "alle3", "vae3", "vale3", "vmalle1os",
+    "vae1os", "aside1os", "vaae1os", "vale1os", "vaale1os", "alle2os", "vae2os",
+    "alle1os", "vale2os", "vmalls12e1os", "ipas2e1os", "ipas2le1os", "alle3os", 
+    "vae3os", "vale3os", "rvae1is", "rvaae1is", "rvale1is", "rvaale1is", "rvae1os",
+    "rvaae1os", "rvale1os", "rvaale1os", "rvae1", "rvaae1", "rvale1", "rvaale1",
+    "ripas2e1is", "ripas2le1is", "rvae2is", "rvale2is", "ripas2e1", "ripas2e1os", 
+    "ripas2le1", "ripas2le1os", "rvae2os", "rvale2os", "rvae2", "rvale2", "rvae3is",
+    "rvale3is", "rvae3os", "rvale3os", "rvae3", "rvale3", "vmalle1osnxs", "vae1osnxs",
+    "aside1osnxs", "vaae1osnxs", "vale1osnxs", "vaale1osnxs", "rvae1isnxs", "rvaae1isnxs",
+    "rvale1isnxs","rvaale1isnxs","vmalle1isnxs","vae1isnxs","aside1isnxs","vaae1isnxs",
+    "vale1isnxs", "vaale1isnxs", "rvae1osnxs", "rvaae1osnxs", "rvale1osnxs", "rvaale1osnxs",
+    "rvae1nxs", "rvaae1nxs", "rvale1nxs", "rvaale1nxs", "vmalle1nxs", "vae1nxs",
+    "aside1nxs", "vaae1nxs", "vale1nxs", "vaale1nxs", "ipas2e1isnxs", "ripas2e1isnxs",
+    "ipas2le1isnxs", "ripas2le1isnxs", "alle2osnxs", "vae2osnxs", "alle1osnxs", "vale2osnxs",
+    "vmalls12e1osnxs", "rvae2isnxs", "rvale2isnxs", "alle2isnxs", "vae2isnxs", "alle1isnxs",
+    "vale2isnxs", "vmalls12e1isnxs", "ipas2e1osnxs", "ipas2e1nxs", "ripas2e1nxs", "ripas2e1osnxs",
+    "ipas2le1osnxs", "ipas2le1nxs", "ripas2le1nxs", "ripas2le1osnxs", "rvae2osnxs",
+    "rvale2osnxs", "rvae2nxs", "rvale2nxs", "alle2nxs", "vae2nxs", "alle1nxs",
+    "vale2nxs", "vmalls12e1nxs", "alle3osnxs", "vae3osnxs", "vale3osnxs", "rvae3isnxs",
+    "rvale3isnxs", "alle3isnxs", "vae3isnxs", "vale3isnxs", "rvae3osnxs", "rvale3osnxs",
+    "rvae3nxs", "rvale3nxs", "alle3nxs", "vae3nxs", "vale3nxs", "unknown",
+};
+
+const uint64_t A64_TLBI_OPS_STR_LEN = sizeof (A64_TLBI_OPS_STR) / sizeof (*A64_TLBI_OPS_STR);
+
+/******************************************************************************
+*       Vector Specifiers
+*******************************************************************************/
+
+const char *const A64_VEC_SPECIFIER_STR[] =
+{
+    "b", "8b", "16b", "h", "4h", "8h", "s", "2s",
+    "4s", "d", "2d", "1d", "q", "1q",
+};
+
+const uint64_t A64_VEC_SPECIFIER_STR_LEN = sizeof (A64_VEC_SPECIFIER_STR) / sizeof (*A64_VEC_SPECIFIER_STR);
+
+/******************************************************************************
+*       SVE Predicate Patterns
+*******************************************************************************/
+
+const char *const A64_SVE_PATTERN_STR[] =
+{
+    "pow2", "vl1", "vl2", "vl3", "vl4", "vl5", "vl6", "vl7",
+    "vl8", "vl16", "vl32", "vl64", "vl128", "vl256", "#14", "#15",
+    "#16", "#17", "#18", "#19", "#20", "#21", "#22", "#23",
+    "#24", "#25", "#26", "#27", "#28", "mul4", "mul3", "all",
+};
+
+const uint64_t A64_SVE_PATTERN_STR_LEN = sizeof (A64_SVE_PATTERN_STR) / sizeof (*A64_SVE_PATTERN_STR);
@@ -0,0 +1,866 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "tracker.h"
+
+#include "arm64/arm64-common.h"
+#include "arm64/arm64-instructions.h"
+#include "arm64/arm64-logical-immediates.h"
+
+/**
+ *  The evaluators work from the opcode rather than the operands, so they don't
+ *  need to know which alias the decoder picked, e.g. MOV, ORR, MOVZ and MOVN
+ *  all end up in the same few lines. Register 31 is the stack pointer or the
+ *  zero register depending on the encoding, so each evaluator says which it
+ *  wants when it reads or writes a register.
+ */
+
+/* Result of evaluating a single instruction */
+typedef struct tracker_write_t
+{
+    int         reg;            // Lattice index written, or -1 for none
+    int         known;          // Set if `value` is a constant
+    int         chained;        // Set if the destination was also a source
+    uint64_t    value;
+} tracker_write_t;
+
+typedef void (*eval_func_t) (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w);
+
+/* Registers a call may clobber, x0-x18 */
+#define TRACKER_CALLER_SAVED        0x0007ffff
+
+/* Link register, written by calls and the PAC/AUT hints */
+#define TRACKER_REG_LR              30
+
+/* The PAC/AUT 1716 hints write x17 */
+#define TRACKER_REG_IP1             17
+
+
+/******************************************************************************
+*       Lattice Helpers
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_mask (unsigned sf)
+{
+    return (sf) ? UINT64_MAX : UINT32_MAX;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_sext (uint64_t val, unsigned bits)
+{
+    if (bits >= 64) return val;
+    uint64_t m = 1ULL << (bits - 1);
+    val &= (1ULL << bits) - 1;
+    return (val ^ m) - m;
+}
+
+/**
+ *  Read register `n`, setting `val` and returning 1 if it's a constant. If `zr`
+ *  is set, register 31 is the zero register, otherwise it's the stack pointer.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_get (const libarch_tracker_t *tracker, unsigned n, int zr, uint64_t *val)
+{
+    if (n == 31 && zr) {
+        *val = 0;
+        return 1;
+    }
+    if (!(tracker->known & (1U << n))) return 0;
+    *val = tracker->values[n];
+    return 1;
+}
+
+/* Lattice index of the destination register `n`, or -1 for the zero register */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_dest (unsigned n, int sp)
+{
+    return (n == 31 && !sp) ? -1 : (int) n;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_write (tracker_write_t *w, uint64_t value, unsigned sf)
+{
+    w->value = value & _mask (sf);
+    w->known = 1;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_clobber (libarch_tracker_t *tracker, uint32_t regs)
+{
+    tracker->known &= ~regs;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_shift (uint64_t val, unsigned type, unsigned amount, unsigned sf)
+{
+    unsigned width = (sf) ? 64 : 32;
+
+    val &= _mask (sf);
+    amount %= width;
+    if (!amount) return val;
+
+    switch (type) {
+        case 0: return (val << amount) & _mask (sf);                        // LSL
+        case 1: return val >> amount;                                       // LSR
+        case 2: return (uint64_t) ((int64_t) _sext (val, width) >> amount) & _mask (sf); // ASR
+        default: return ((val >> amount) | (val << (width - amount))) & _mask (sf); // ROR
+    }
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+uint64_t
+_extend (uint64_t val, unsigned option, unsigned amount)
+{
+    static const unsigned bits[] = { 8, 16, 32, 64 };
+    unsigned size = bits[option & 3];
+
+    if (size < 64) val &= (1ULL << size) - 1;
+    if (option & 4) val = _sext (val, size);
+    return val << amount;
+}
+
+
+/******************************************************************************
+*       Data Processing (Immediate)
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_pc_relative_addressing (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    uint64_t imm = _sext ((select_bits (op, 5, 23) << 2) | select_bits (op, 29, 30), 21);
+
+    (void) tracker;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+    if (select_bits (op, 31, 31)) _write (w, (addr & ~0xfffULL) + (imm << 12), 1);
+    else _write (w, addr + imm, 1);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_add_subtract_immediate (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned sub = select_bits (op, 30, 30);
+    unsigned S = select_bits (op, 29, 29);
+    unsigned Rn = select_bits (op, 5, 9);
+    uint64_t imm = (uint64_t) select_bits (op, 10, 21) << (select_bits (op, 22, 22) * 12);
+    uint64_t a;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), !S);
+    w->chained = (w->reg == (int) Rn);
+    if (!_get (tracker, Rn, 0, &a)) return;
+
+    _write (w, (sub) ? a - imm : a + imm, sf);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_add_subtract_immediate_tags (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    (void) tracker;
+    (void) addr;
+
+    /* ADDG and SUBG insert a tag that isn't known statically */
+    w->reg = _dest (select_bits (op, 0, 4), 1);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_logical (unsigned opc, uint64_t a, uint64_t b, unsigned sf, tracker_write_t *w)
+{
+    switch (opc) {
+        case 0: case 3: _write (w, a & b, sf); break;   // AND, ANDS
+        case 1: _write (w, a | b, sf); break;           // ORR
+        case 2: _write (w, a ^ b, sf); break;           // EOR
+    }
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_logical_immediate (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned opc = select_bits (op, 29, 30);
+    unsigned Rn = select_bits (op, 5, 9);
+    uint64_t imm = A64_LOGICAL_IMMEDIATES[ARM64_LOGICAL_IMMEDIATE_INDEX (select_bits (op, 22, 22),
+                                                                        select_bits (op, 16, 21),
+                                                                        select_bits (op, 10, 15))];
+    uint64_t a;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), opc != 3);
+    w->chained = (w->reg == (int) Rn);
+    if (!_get (tracker, Rn, 1, &a)) return;
+
+    eval_logical (opc, a, imm, sf, w);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_move_wide_immediate (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned opc = select_bits (op, 29, 30);
+    unsigned shift = select_bits (op, 21, 22) * 16;
+    uint64_t imm = (uint64_t) select_bits (op, 5, 20) << shift;
+    uint64_t a;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+
+    if (opc == 0) _write (w, ~imm, sf);             // MOVN
+    else if (opc == 2) _write (w, imm, sf);         // MOVZ
+    else if (opc == 3) {                            // MOVK
+        w->chained = 1;
+        if (w->reg < 0 || !_get (tracker, w->reg, 1, &a)) return;
+        _write (w, (a & ~(0xffffULL << shift)) | imm, sf);
+    }
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_bitfield (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned opc = select_bits (op, 29, 30);
+    unsigned immr = select_bits (op, 16, 21);
+    unsigned imms = select_bits (op, 10, 15);
+    unsigned Rn = select_bits (op, 5, 9);
+    unsigned width = (sf) ? 64 : 32;
+    unsigned lsb, len;
+    uint64_t a, d = 0, field, fmask;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+    w->chained = (w->reg == (int) Rn) || (opc == 1);
+    if (opc == 3 || immr >= width || imms >= width) return;
+    if (!_get (tracker, Rn, 1, &a)) return;
+    if (opc == 1 && (w->reg < 0 || !_get (tracker, w->reg, 1, &d))) return;
+
+    /**
+     *  When imms >= immr, bits immr:imms of the source are extracted to the
+     *  bottom of the result (UBFX, SBFX, LSR, ASR, ...). Otherwise the bottom
+     *  imms + 1 bits are inserted at width - immr (UBFIZ, SBFIZ, LSL, BFI, ...).
+     */
+    if (imms >= immr) {
+        lsb = 0;
+        len = imms - immr + 1;
+        a >>= immr;
+    } else {
+        lsb = width - immr;
+        len = imms + 1;
+    }
+    fmask = ((len >= 64) ? UINT64_MAX : (1ULL << len) - 1) << lsb;
+    field = (a << lsb) & fmask;
+
+    if (opc == 0) {
+        /* SBFM copies the top bit of the field into every bit above it */
+        field = _sext (field, lsb + len);
+    } else if (opc == 1) {
+        field |= d & ~fmask;
+    }
+    _write (w, field, sf);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_extract (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned Rm = select_bits (op, 16, 20);
+    unsigned Rn = select_bits (op, 5, 9);
+    unsigned lsb = select_bits (op, 10, 15);
+    unsigned width = (sf) ? 64 : 32;
+    uint64_t hi, lo;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+    w->chained = (w->reg == (int) Rn) || (w->reg == (int) Rm);
+    if (lsb >= width) return;
+    if (!_get (tracker, Rn, 1, &hi) || !_get (tracker, Rm, 1, &lo)) return;
+
+    lo &= _mask (sf);
+    _write (w, (lsb) ? (lo >> lsb) | (hi << (width - lsb)) : lo, sf);
+}
+
+
+/******************************************************************************
+*       Data Processing (Register)
+*******************************************************************************/
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_none (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    (void) tracker;
+    (void) op;
+    (void) addr;
+
+    /* Only the condition flags are written */
+    w->reg = -1;
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_unknown_result (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    (void) tracker;
+    (void) addr;
+
+    /* Depends on the condition flags, which aren't tracked */
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_logical_shifted_register (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned Rm = select_bits (op, 16, 20);
+    unsigned Rn = select_bits (op, 5, 9);
+    uint64_t a, b;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+    w->chained = (w->reg == (int) Rn) || (w->reg == (int) Rm);
+    if (!_get (tracker, Rn, 1, &a) || !_get (tracker, Rm, 1, &b)) return;
+
+    b = _shift (b, select_bits (op, 22, 23), select_bits (op, 10, 15), sf);
+    if (select_bits (op, 21, 21)) b = ~b;
+    eval_logical (select_bits (op, 29, 30), a, b, sf, w);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_add_subtract_shifted_register (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned Rm = select_bits (op, 16, 20);
+    unsigned Rn = select_bits (op, 5, 9);
+    uint64_t a, b;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+    w->chained = (w->reg == (int) Rn) || (w->reg == (int) Rm);
+    if (!_get (tracker, Rn, 1, &a) || !_get (tracker, Rm, 1, &b)) return;
+
+    b = _shift (b, select_bits (op, 22, 23), select_bits (op, 10, 15), sf);
+    _write (w, (select_bits (op, 30, 30)) ? a - b : a + b, sf);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_add_subtract_extended_register (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned Rm = select_bits (op, 16, 20);
+    unsigned Rn = select_bits (op, 5, 9);
+    unsigned amount = select_bits (op, 10, 12);
+    uint64_t a, b;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), !select_bits (op, 29, 29));
+    w->chained = (w->reg == (int) Rn) || (w->reg == (int) Rm);
+    if (amount > 4) return;
+    if (!_get (tracker, Rn, 0, &a) || !_get (tracker, Rm, 1, &b)) return;
+
+    b = _extend (b, select_bits (op, 13, 15), amount);
+    _write (w, (select_bits (op, 30, 30)) ? a - b : a + b, sf);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_conditional_select (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned Rm = select_bits (op, 16, 20);
+    unsigned Rn = select_bits (op, 5, 9);
+    uint64_t a, b;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+    w->chained = (w->reg == (int) Rn) || (w->reg == (int) Rm);
+    if (!_get (tracker, Rn, 1, &a) || !_get (tracker, Rm, 1, &b)) return;
+
+    /* CSINV and CSNEG invert or negate the second source, CSINC increments */
+    if (select_bits (op, 30, 30)) b = ~b;
+    if (select_bits (op, 10, 10)) b++;
+
+    /* The flags aren't tracked, so the result is only known if both agree */
+    if (((a ^ b) & _mask (sf)) == 0) _write (w, a, sf);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_data_processing_2_source (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned opcode = select_bits (op, 10, 15);
+    unsigned Rm = select_bits (op, 16, 20);
+    unsigned Rn = select_bits (op, 5, 9);
+    unsigned width = (sf) ? 64 : 32;
+    uint64_t a, b;
+
+    (void) addr;
+
+    /* IRG and the MTE pointer subtract can write the stack pointer */
+    w->reg = (int) select_bits (op, 0, 4);
+    w->chained = (w->reg == (int) Rn) || (w->reg == (int) Rm);
+    if (opcode != 2 && opcode != 3 && (opcode < 8 || opcode > 11)) return;
+
+    w->reg = _dest (w->reg, 0);
+    if (!_get (tracker, Rn, 1, &a) || !_get (tracker, Rm, 1, &b)) return;
+    a &= _mask (sf);
+    b &= _mask (sf);
+
+    switch (opcode) {
+        case 2:                                                 // UDIV
+            _write (w, (b) ? a / b : 0, sf);
+            break;
+        case 3:                                                 // SDIV
+            if (!b) _write (w, 0, sf);
+            else if (b == _mask (sf) && a == (1ULL << (width - 1))) _write (w, a, sf);
+            else _write (w, (uint64_t) ((int64_t) _sext (a, width) / (int64_t) _sext (b, width)), sf);
+            break;
+        default:                                                // LSLV, LSRV, ASRV, RORV
+            _write (w, _shift (a, opcode - 8, b, sf), sf);
+            break;
+    }
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_data_processing_1_source (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned opcode = select_bits (op, 10, 15);
+    unsigned Rn = select_bits (op, 5, 9);
+    unsigned width = (sf) ? 64 : 32;
+    uint64_t a, r = 0;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+    w->chained = (w->reg == (int) Rn);
+
+    /* The PAC and AUT forms use keys that aren't known statically */
+    if (select_bits (op, 16, 20) != 0 || opcode > 5) return;
+    if (!_get (tracker, Rn, 1, &a)) return;
+    a &= _mask (sf);
+
+    switch (opcode) {
+        case 0:                                                 // RBIT
+            for (unsigned i = 0; i < width; i++)
+                if (a & (1ULL << i)) r |= 1ULL << (width - 1 - i);
+            break;
+        case 1: case 2: case 3: {                               // REV16, REV32, REV
+            /* Reverse the bytes within each 16, 32 or 64-bit container */
+            unsigned container = (opcode == 3 || (opcode == 2 && !sf)) ? width : 16U << (opcode - 1);
+            for (unsigned i = 0; i < width; i += 8) {
+                unsigned base = i - (i % container);
+                unsigned rev = base + container - 8 - (i - base);
+                r |= ((a >> i) & 0xff) << rev;
+            }
+            break;
+        }
+        case 4:                                                 // CLZ
+            while (r < width && !(a & (1ULL << (width - 1 - r)))) r++;
+            break;
+        case 5: {                                               // CLS
+            unsigned top = (a >> (width - 1)) & 1;
+            while (r < width - 1 && ((a >> (width - 2 - r)) & 1) == top) r++;
+            break;
+        }
+    }
+    _write (w, r, sf);
+}
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+eval_data_processing_3_source (const libarch_tracker_t *tracker, uint32_t op, uint64_t addr, tracker_write_t *w)
+{
+    unsigned sf = select_bits (op, 31, 31);
+    unsigned op31 = select_bits (op, 21, 23);
+    unsigned o0 = select_bits (op, 15, 15);
+    unsigned Rm = select_bits (op, 16, 20);
+    unsigned Ra = select_bits (op, 10, 14);
+    unsigned Rn = select_bits (op, 5, 9);
+    uint64_t a, b, c, r;
+
+    (void) addr;
+
+    w->reg = _dest (select_bits (op, 0, 4), 0);
+    w->chained = (w->reg == (int) Rn) || (w->reg == (int) Rm) || (w->reg == (int) Ra);
+    if (!_get (tracker, Rn, 1, &a) || !_get (tracker, Rm, 1, &b) || !_get (tracker, Ra, 1, &c)) return;
+
+    switch (op31) {
+        case 0:                                                 // MADD, MSUB
+            r = a * b;
+            break;
+        case 1:                                                 // SMADDL, SMSUBL
+            r = (uint64_t) ((int64_t) (int32_t) a * (int64_t) (int32_t) b);
+            break;
+        case 5:                                                 // UMADDL, UMSUBL
+            r = (uint64_t) (uint32_t) a * (uint32_t) b;
+            break;
+#if defined(__SIZEOF_INT128__)
+        case 2:                                                 // SMULH
+            _write (w, (uint64_t) (((__int128) (int64_t) a * (int64_t) b) >> 64), 1);
+            return;
+        case 6:                                                 // UMULH
+            _write (w, (uint64_t) (((unsigned __int128) a * b) >> 64), 1);
+            return;
+#endif
+        default:
+            return;
+    }
+    _write (w, (o0) ? c - r : c + r, sf);
+}
+
+
+/******************************************************************************
+*       Tracker
+*******************************************************************************/
+
+/**
+ *  Evaluators for each data processing subgroup. Subgroup numbers are only
+ *  unique within a group, so both are matched.
+ */
+static const struct {
+    uint32_t        group;
+    uint32_t        subgroup;
+    eval_func_t     eval;
+} eval_table[] = {
+    { ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE, ARM64_DECODE_SUBGROUP_PC_RELATIVE_ADDRESSING, eval_pc_relative_addressing },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE, ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_IMMEDIATE, eval_add_subtract_immediate },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE, ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_IMMEDIATE_TAGS, eval_add_subtract_immediate_tags },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE, ARM64_DECODE_SUBGROUP_LOGICAL_IMMEDIATE, eval_logical_immediate },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE, ARM64_DECODE_SUBGROUP_MOVE_WIDE_IMMEDIATE, eval_move_wide_immediate },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE, ARM64_DECODE_SUBGROUP_BITFIELD, eval_bitfield },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE, ARM64_DECODE_SUBGROUP_EXTRACT, eval_extract },
+
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_DATA_PROCESSING_2_SOURCE, eval_data_processing_2_source },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_DATA_PROCESSING_1_SOURCE, eval_data_processing_1_source },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_LOGICAL_SHIFTED_REGISTER, eval_logical_shifted_register },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_SHIFTED_REGISTER, eval_add_subtract_shifted_register },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_EXTENDED_REGISTER, eval_add_subtract_extended_register },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_ADD_SUBTRACT_WITH_CARRY, eval_unknown_result },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_ROTATE_RIGHT_INTO_FLAGS, eval_none },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_EVALUATE_INTO_FLAGS, eval_none },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_CONDITIONAL_COMPARE, eval_none },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_CONDITIONAL_SELECT, eval_conditional_select },
+    { ARM64_DECODE_GROUP_DATA_PROCESS_REGISTER, ARM64_DECODE_SUBGROUP_DATA_PROCESSING_3_SOURCE, eval_data_processing_3_source },
+};
+
+LIBARCH_PRIVATE LIBARCH_API
+void
+_call (libarch_tracker_t *tracker, uint64_t addr)
+{
+    _clobber (tracker, TRACKER_CALLER_SAVED);
+    tracker->values[TRACKER_REG_LR] = addr + 4;
+    tracker->known |= 1U << TRACKER_REG_LR;
+}
+
+/**
+ *  Branch, exception and system instructions. Returns 1 and fills `event` if
+ *  the instruction branches through a register holding a constant.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_step_branch (libarch_tracker_t *tracker, const instruction_t *instr, libarch_tracker_event_t *event)
+{
+    unsigned Rn = select_bits (instr->opcode, 5, 9);
+    uint64_t target;
+    int found = 0;
+
+    switch (instr->type) {
+        case ARM64_INSTRUCTION_BL:
+            _call (tracker, instr->addr);
+            break;
+
+        case ARM64_INSTRUCTION_BR: case ARM64_INSTRUCTION_BRAA: case ARM64_INSTRUCTION_BRAAZ:
+        case ARM64_INSTRUCTION_BRAB: case ARM64_INSTRUCTION_BRABZ:
+        case ARM64_INSTRUCTION_BLR: case ARM64_INSTRUCTION_BLRAA: case ARM64_INSTRUCTION_BLRAAZ:
+        case ARM64_INSTRUCTION_BLRAB: case ARM64_INSTRUCTION_BLRABZ:
+            if (_get (tracker, Rn, 0, &target) && Rn != 31) {
+                event->addr = instr->addr;
+                event->value = target;
+                event->type = LIBARCH_TRACKER_EVENT_BRANCH_TARGET;
+                event->reg = Rn;
+                found = 1;
+            }
+            if (select_bits (instr->opcode, 21, 22) == 1) _call (tracker, instr->addr);
+            break;
+
+        case ARM64_INSTRUCTION_MRS: case ARM64_INSTRUCTION_SYSL:
+            if ((instr->opcode & 0x1f) != 31) _clobber (tracker, 1U << (instr->opcode & 0x1f));
+            break;
+
+        case ARM64_INSTRUCTION_SVC: case ARM64_INSTRUCTION_HVC: case ARM64_INSTRUCTION_SMC:
+            _clobber (tracker, TRACKER_CALLER_SAVED);
+            break;
+
+        case ARM64_INSTRUCTION_PACIA1716: case ARM64_INSTRUCTION_PACIB1716:
+        case ARM64_INSTRUCTION_AUTIA1716: case ARM64_INSTRUCTION_AUTIB1716:
+        case ARM64_INSTRUCTION_PACIASP: case ARM64_INSTRUCTION_PACIBSP:
+        case ARM64_INSTRUCTION_AUTIASP: case ARM64_INSTRUCTION_AUTIBSP:
+        case ARM64_INSTRUCTION_PACIAZ: case ARM64_INSTRUCTION_PACIBZ:
+        case ARM64_INSTRUCTION_AUTIAZ: case ARM64_INSTRUCTION_AUTIBZ:
+        case ARM64_INSTRUCTION_XPACLRI:
+            _clobber (tracker, (1U << TRACKER_REG_IP1) | (1U << TRACKER_REG_LR));
+            break;
+
+        default:
+            break;
+    }
+    return found;
+}
+
+/* Mark every general purpose register operand of `instr` as unknown */
+LIBARCH_PRIVATE LIBARCH_API
+void
+_clobber_operands (libarch_tracker_t *tracker, const instruction_t *instr)
+{
+    for (uint32_t i = 0; i < instr->operands_len; i++) {
+        const operand_t *op = &instr->operands[i];
+        if (op->op_type == ARM64_OPERAND_TYPE_REGISTER && op->reg.type == ARM64_REGISTER_TYPE_GENERAL &&
+            op->reg.reg < LIBARCH_TRACKER_REGISTERS)
+            _clobber (tracker, 1U << op->reg.reg);
+    }
+}
+
+/* The tracker bit for register field `r`, where 31 is the zero register */
+LIBARCH_PRIVATE LIBARCH_API
+uint32_t
+_bit (unsigned r)
+{
+    return (r < 31) ? 1U << r : 0;
+}
+
+/**
+ *  Find the general purpose registers written by a load or store: Rt and Rt2
+ *  of loads, the status or compare register of exclusives and atomics, and
+ *  the base register of the pre and post-indexed forms. Returns 0 for the
+ *  classes that aren't modelled.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_load_store_writes (uint32_t op, uint32_t *regs)
+{
+    unsigned Rt = select_bits (op, 0, 4);
+    unsigned Rn = select_bits (op, 5, 9);
+    unsigned Rs = select_bits (op, 16, 20);
+    unsigned V = select_bits (op, 26, 26);
+    unsigned opc = select_bits (op, 22, 23);
+    int load = !V && opc && !(select_bits (op, 30, 31) == 3 && opc == 2);  // not PRFM
+
+    *regs = 0;
+    switch (select_bits (op, 27, 29)) {
+        /* Load/store register, atomics and LDRAA/LDRAB */
+        case 7:
+            if (select_bits (op, 24, 24) || !select_bits (op, 21, 21)) {
+                if (load) *regs |= _bit (Rt);
+                if (!select_bits (op, 24, 24) && !select_bits (op, 21, 21) && select_bits (op, 10, 10))
+                    *regs |= 1U << Rn;                                      // pre/post-indexed
+                return 1;
+            }
+            switch (select_bits (op, 10, 11)) {
+                case 0:
+                    if (V) break;
+                    if (select_bits (op, 12, 15) == 0xd) *regs |= (Rt < 24) ? 0xffU << Rt : 0; // LD64B
+                    else if ((select_bits (op, 12, 15) & 0xe) == 0xa) *regs |= _bit (Rs);      // ST64BV(0)
+                    else *regs |= _bit (Rt);
+                    break;
+                case 2:
+                    if (load) *regs |= _bit (Rt);                           // register offset
+                    break;
+                default:
+                    *regs |= _bit (Rt);                                     // LDRAA, LDRAB
+                    if (select_bits (op, 11, 11)) *regs |= 1U << Rn;
+                    break;
+            }
+            return 1;
+
+        /* Load/store pair, with writeback when bit 23 is set */
+        case 5:
+            if (select_bits (op, 22, 22) && !V) *regs |= _bit (Rt) | _bit (select_bits (op, 10, 14));
+            if (select_bits (op, 23, 23)) *regs |= 1U << Rn;
+            return 1;
+
+        /* Load register (literal) */
+        case 3:
+            if (select_bits (op, 24, 25)) return 0;
+            if (!V && select_bits (op, 30, 31) != 3) *regs |= _bit (Rt);
+            return 1;
+
+        /* Exclusives, load-acquire/store-release, compare and swap, SIMD structures */
+        case 1:
+            if (V) {
+                if (select_bits (op, 31, 31) || select_bits (op, 25, 25)) return 0;
+                if (select_bits (op, 23, 23)) *regs |= 1U << Rn;
+                return 1;
+            }
+            if (select_bits (op, 24, 25)) return 0;
+            *regs |= _bit (Rs);
+            if (!select_bits (op, 31, 31) && !select_bits (op, 23, 23) && select_bits (op, 21, 21))
+                *regs |= _bit (Rs + 1);                                     // CASP
+            if (select_bits (op, 22, 22)) {
+                *regs |= _bit (Rt);
+                if (select_bits (op, 21, 21)) *regs |= _bit (select_bits (op, 10, 14));
+            }
+            return 1;
+    }
+    return 0;
+}
+
+/**
+ *  Update the tracker, and set `chained` if the instruction read the register
+ *  it wrote, so libarch_tracker_run can fold the event into the last one.
+ */
+LIBARCH_PRIVATE LIBARCH_API
+libarch_return_t
+_step (libarch_tracker_t *tracker, const instruction_t *instr, libarch_tracker_event_t *event, int *chained)
+{
+    tracker_write_t w;
+    uint32_t regs;
+
+    *chained = 0;
+    if (instr->group < ARM64_DECODE_GROUP_DATA_PROCESS_IMMEDIATE || instr->group > ARM64_DECODE_GROUP_SVE ||
+        instr->type == ARM64_INSTRUCTION_UNK) {
+        /* Nothing is known about what an undecoded instruction writes */
+        libarch_tracker_init (tracker);
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    if (instr->group == ARM64_DECODE_GROUP_BRANCH_EXCEPTION_SYSREG)
+        return (_step_branch (tracker, instr, event)) ? LIBARCH_RETURN_SUCCESS : LIBARCH_RETURN_FAILURE;
+
+    for (size_t i = 0; i < sizeof (eval_table) / sizeof (*eval_table); i++) {
+        if (eval_table[i].group != instr->group || eval_table[i].subgroup != instr->subgroup)
+            continue;
+
+        memset (&w, 0, sizeof (w));
+        w.reg = -1;
+        eval_table[i].eval (tracker, instr->opcode, instr->addr, &w);
+        if (w.reg < 0) return LIBARCH_RETURN_FAILURE;
+
+        if (!w.known) {
+            _clobber (tracker, 1U << w.reg);
+            return LIBARCH_RETURN_FAILURE;
+        }
+
+        tracker->values[w.reg] = w.value;
+        tracker->known |= 1U << w.reg;
+
+        event->addr = instr->addr;
+        event->value = w.value;
+        event->type = LIBARCH_TRACKER_EVENT_CONSTANT;
+        event->reg = w.reg;
+        *chained = w.chained;
+        return LIBARCH_RETURN_SUCCESS;
+    }
+
+    if (instr->group == ARM64_DECODE_GROUP_LOAD_AND_STORE && _load_store_writes (instr->opcode, &regs)) {
+        _clobber (tracker, regs);
+        return LIBARCH_RETURN_FAILURE;
+    }
+
+    /* Floating point, SIMD, SVE and the remaining loads and stores */
+    _clobber_operands (tracker, instr);
+    return LIBARCH_RETURN_FAILURE;
+}
+
+
+LIBARCH_API
+void
+libarch_tracker_init (libarch_tracker_t *tracker)
+{
+    memset (tracker, 0, sizeof (libarch_tracker_t));
+}
+
+LIBARCH_API
+libarch_return_t
+libarch_tracker_set (libarch_tracker_t *tracker, unsigned reg, uint64_t value)
+{
+    if (reg >= LIBARCH_TRACKER_REGISTERS) return LIBARCH_RETURN_FAILURE;
+    tracker->values[reg] = value;
+    tracker->known |= 1U << reg;
+    return LIBARCH_RETURN_SUCCESS;
+}
+
+LIBARCH_API
+libarch_return_t
+libarch_tracker_get (const libarch_tracker_t *tracker, unsigned reg, uint64_t *value)
+{
+    if (reg >= LIBARCH_TRACKER_REGISTERS) return LIBARCH_RETURN_FAILURE;
+    return (_get (tracker, reg, 0, value)) ? LIBARCH_RETURN_SUCCESS : LIBARCH_RETURN_FAILURE;
+}
+
+LIBARCH_API
+libarch_return_t
+libarch_tracker_step (libarch_tracker_t *tracker, const instruction_t *instr, libarch_tracker_event_t *event)
+{
+    libarch_tracker_event_t tmp;
+    int chained;
+    return _step (tracker, instr, (event) ? event : &tmp, &chained);
+}
+
+LIBARCH_API
+size_t
+libarch_tracker_run (libarch_tracker_t *tracker, instruction_t **instrs, size_t len, libarch_tracker_event_t *events, size_t max)
+{
+    libarch_tracker_event_t ev, last = { 0 };
+    size_t count = 0;
+    int chained;
+
+    for (size_t i = 0; i < len; i++) {
+        if (!_step (tracker, instrs[i], &ev, &chained)) continue;
+
+        /**
+         *  A constant that extends the previous one in the same register, e.g.
+         *  a MOVK after a MOVZ, replaces it rather than adding a new event.
+         */
+        if (chained && count && last.type == LIBARCH_TRACKER_EVENT_CONSTANT &&
+            ev.type == LIBARCH_TRACKER_EVENT_CONSTANT && last.reg == ev.reg)
+            count--;
+
+        if (events && count < max) events[count] = ev;
+        last = ev;
+        count++;
+    }
+    return count;
+}
@@ -16,7 +16,9 @@
 #include <stdio.h>
 
 #include "arm64/arm64-tlbi-ops.h"
+#include "arm64/arm64-translation.h"
 #include "arm64/arm64-common.h"
+#include "arm64/arm64-logical-immediates.h"
 
 /**
  *  AArch64 Reference Manual shared/functions/common/
@@ -69,36 +71,45 @@ arm64_zero_extend_ones (unsigned M, unsigned N)
 }
 
 LIBARCH_API ARM64_COMMON 
-unsigned int
+uint64_t
 arm64_ror_zero_extend_ones (unsigned M, unsigned N, unsigned R)
 {
-    uint64_t val = arm64_zero_extend_ones (M, N);
+    uint64_t val = arm64_ones (M, N);
     if (R == 0) return val;
-    return ((val >> R) & (((uint64_t)1 << (N - R)) - 1)) | ((val & (((uint64_t)1 << R) - 1)) << (N - R));
+    return ((val >> R) & arm64_ones (N - R, N)) | ((val & arm64_ones (R, N)) << (N - R));
 }
 
 LIBARCH_API ARM64_COMMON 
-unsigned int
-arm64_replicate (unsigned int val, unsigned bits)
+uint64_t
+arm64_replicate (uint64_t val, unsigned bits)
 {
-    unsigned int ret = val;
+    uint64_t ret = val;
     for (unsigned shift = bits; shift < 64; shift += bits)
         ret |= (val << shift);
     return ret;
 }
 
 LIBARCH_API ARM64_COMMON 
-unsigned int
+int
 arm64_decode_bitmasks (unsigned immN, unsigned imms, unsigned immr, int immediate, uint64_t *newval)
 {
     unsigned levels, S, R, esize;
+
+    /* Immediate bitmasks are a single load, reserved encodings are stored as zero */
+    if (immediate) {
+        uint64_t val = A64_LOGICAL_IMMEDIATES[ARM64_LOGICAL_IMMEDIATE_INDEX (immN & 1, immr & 0x3f, imms & 0x3f)];
+        if (val == 0)
+            return -1;
+
+        *newval = val;
+        return 0;
+    }
+
 	int len = arm64_highest_set_bit (7, (immN << 6) | (~imms & 0x3F));
 	if (len < 1)
 		return -1;
 
 	levels = arm64_zero_extend_ones (len, 6);
-	if (immediate && (imms & levels) == levels)
-		return -1;
 
 	S = imms & levels;
 	R = immr & levels;
@@ -108,24 +119,53 @@ arm64_decode_bitmasks (unsigned immN, unsigned imms, unsigned immr, int immediat
 }
 
 LIBARCH_API ARM64_COMMON 
-int 
-arm64_move_wide_preferred (unsigned int sf, unsigned int immN, unsigned int immr, unsigned int imms)
+int
+arm64_encode_bitmasks (uint64_t imm, unsigned size, unsigned *immN, unsigned *immr, unsigned *imms)
 {
-    int width = sf == 1 ? 64 : 32;
-    unsigned int combined = (immN << 6) | imms;
+    /* The table holds 64-bit values, so 32-bit immediates are replicated first */
+    if (size == 32) imm = arm64_replicate (imm & 0xffffffff, 32);
+
+    size_t lo = 0, hi = A64_LOGICAL_IMMEDIATE_ENCODINGS_LEN;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (A64_LOGICAL_IMMEDIATE_ENCODINGS[mid].value < imm) lo = mid + 1;
+        else hi = mid;
+    }
 
-    if(sf == 1 && (combined >> 6) != 1)
-        return 0;
+    if (lo == A64_LOGICAL_IMMEDIATE_ENCODINGS_LEN || A64_LOGICAL_IMMEDIATE_ENCODINGS[lo].value != imm)
+        return -1;
 
-    if(sf == 0 && (combined >> 5) != 0)
-        return 0;
+    unsigned encoding = A64_LOGICAL_IMMEDIATE_ENCODINGS[lo].encoding;
+
+    /* 64-bit element sizes need N, which the 32-bit forms can't encode */
+    if (size == 32 && (encoding >> 12)) return -1;
 
-    if(imms < 16)
-        return (-immr % 16) <= (15 - imms);
+    *immN = encoding >> 12;
+    *immr = (encoding >> 6) & 0x3f;
+    *imms = encoding & 0x3f;
+    return 0;
+}
 
-    if(imms >= (width - 15))
-        return (immr % 16) <= (imms - (width - 15));
+LIBARCH_API ARM64_COMMON 
+int 
+arm64_move_wide_preferred (unsigned int sf, unsigned int immN, unsigned int imms, unsigned int immr)
+{
+    uint64_t mask = (sf == 1) ? ~(uint64_t) 0 : 0xffffffff;
+    uint64_t imm;
 
+    if (arm64_decode_bitmasks (immN, imms, immr, 1, &imm) != 0)
+        return 0;
+
+    /**
+     *  MOVZ is preferred if the ones fit in a single halfword, and MOVN if
+     *  the zeros do. Checking the decoded value directly also covers
+     *  rotations the field-based test misses, e.g. 0xfffffffffffffff0.
+     */
+    for (int shift = 0; shift < ((sf == 1) ? 64 : 32); shift += 16) {
+        uint64_t halfword = (uint64_t) 0xffff << shift;
+        if ((imm & mask & ~halfword) == 0 || (~imm & mask & ~halfword) == 0)
+            return 1;
+    }
     return 0;
 }
 
@@ -173,7 +213,7 @@ arm64_bfx_preferred (unsigned sf, unsigned uns, unsigned imms, unsigned immr)
     if (imms < immr) return 0;
 
     // must not match LSR/ASR/LSL alias
-    if (imms == select_bits (sf, 0, 31)) return 0;
+    if (imms == ((sf << 5) | 0b11111)) return 0;
 
     // must not match UXTx/SXTx alias
     if (immr == 0) {
@@ -181,7 +221,7 @@ arm64_bfx_preferred (unsigned sf, unsigned uns, unsigned imms, unsigned immr)
         if (sf == 0 && (imms == 0b000111 || imms == 0b001111))
             return 0;
         // must not match 64-bit SXT[BHW]
-        if ((select_bits (sf, 0, uns) == 0b10) && (imms == 0b000111 || imms == 0b001111 || imms == 0b011111))
+        if (sf == 1 && uns == 0 && (imms == 0b000111 || imms == 0b001111 || imms == 0b011111))
             return 0;
     }
 
@@ -189,168 +229,207 @@ arm64_bfx_preferred (unsigned sf, unsigned uns, unsigned imms, unsigned immr)
     return 1;
 }
 
+LIBARCH_API ARM64_COMMON
+uint64_t
+arm64_fp_expand_imm (unsigned imm8)
+{
+    uint64_t sign = (imm8 >> 7) & 1;
+    uint64_t b = (imm8 >> 6) & 1;
+    uint64_t exp = ((b ^ 1) << 10) | ((b) ? 0xff << 2 : 0) | ((imm8 >> 4) & 3);
+    uint64_t frac = (uint64_t) (imm8 & 15) << 48;
+
+    return (sign << 63) | (exp << 52) | frac;
+}
+
+/**
+ *  System instruction operations, indexed by SYS_OP_INDEX (op1, CRn, CRm, op2).
+ *  Every AT, DC, IC, BRB and TLBI operation has CRn of 7 or 8, so only those
+ *  two are given space, and the table is small enough to index directly.
+ *  Entries not listed are plain SYS operations. `op` is the AT or TLBI
+ *  operation, and the same table is searched to find the encoding of one when
+ *  assembling.
+ */
+#define SYS_OP_INDEX(op1, CRn, CRm, op2)    (((op1) << 8) | (((CRn) - 7) << 7) | ((CRm) << 3) | (op2))
+#define SYS_OP(op1, CRn, CRm, op2, sysop, op)   [SYS_OP_INDEX (op1, CRn, CRm, op2)] = { 1, sysop, op }
+
+typedef struct {
+    uint8_t         known;
+    uint8_t         sysop;
+    uint16_t        op;
+} sys_op_t;
+
+static const sys_op_t sys_op_table[2048] = {
+    /* Address Translation */
+    SYS_OP (0, 7, 8, 0, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E1R),
+    SYS_OP (0, 7, 8, 1, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E1W),
+    SYS_OP (0, 7, 8, 2, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E0R),
+    SYS_OP (0, 7, 8, 3, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E0W),
+    SYS_OP (0, 7, 9, 0, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E1RP),
+    SYS_OP (0, 7, 9, 1, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E1WP),
+    SYS_OP (4, 7, 8, 0, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E2R),
+    SYS_OP (4, 7, 8, 1, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E2W),
+    SYS_OP (4, 7, 8, 4, ARM64_SYSOP_AT, ARM64_AT_NAME_S12E1R),
+    SYS_OP (4, 7, 8, 5, ARM64_SYSOP_AT, ARM64_AT_NAME_S12E1W),
+    SYS_OP (4, 7, 8, 6, ARM64_SYSOP_AT, ARM64_AT_NAME_S12E0R),
+    SYS_OP (4, 7, 8, 7, ARM64_SYSOP_AT, ARM64_AT_NAME_S12E0W),
+    SYS_OP (6, 7, 8, 0, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E3R),
+    SYS_OP (6, 7, 8, 1, ARM64_SYSOP_AT, ARM64_AT_NAME_S1E3W),
+
+    /* Data Cache */
+    SYS_OP (3, 7, 4, 1, ARM64_SYSOP_DC, 0),
+    SYS_OP (0, 7, 6, 1, ARM64_SYSOP_DC, 0),
+    SYS_OP (0, 7, 6, 2, ARM64_SYSOP_DC, 0),
+    SYS_OP (3, 7, 10, 1, ARM64_SYSOP_DC, 0),
+    SYS_OP (0, 7, 10, 2, ARM64_SYSOP_DC, 0),
+    SYS_OP (3, 7, 11, 1, ARM64_SYSOP_DC, 0),
+    SYS_OP (3, 7, 13, 1, ARM64_SYSOP_DC, 0),
+    SYS_OP (3, 7, 14, 1, ARM64_SYSOP_DC, 0),
+    SYS_OP (0, 7, 14, 2, ARM64_SYSOP_DC, 0),
+
+    /* Instruction Cache */
+    SYS_OP (0, 7, 1, 0, ARM64_SYSOP_IC, 0),
+    SYS_OP (0, 7, 5, 0, ARM64_SYSOP_IC, 0),
+    SYS_OP (3, 7, 5, 1, ARM64_SYSOP_IC, 0),
+
+    /* Branch Record Buffer */
+    SYS_OP (1, 7, 2, 4, ARM64_SYSOP_BRB, 0),
+    SYS_OP (1, 7, 2, 5, ARM64_SYSOP_BRB, 0),
+
+    /* TLB Invalidate */
+    SYS_OP (0, 8, 3, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VMALLE1IS),
+    SYS_OP (0, 8, 3, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE1IS),
+    SYS_OP (0, 8, 3, 2, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ASIDE1IS),
+    SYS_OP (0, 8, 3, 3, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAAE1IS),
+    SYS_OP (0, 8, 3, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE1IS),
+    SYS_OP (0, 8, 3, 7, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAALE1IS),
+    SYS_OP (0, 8, 7, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VMALLE1),
+    SYS_OP (0, 8, 7, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE1),
+    SYS_OP (0, 8, 7, 2, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ASIDE1),
+    SYS_OP (0, 8, 7, 3, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAAE1),
+    SYS_OP (0, 8, 7, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE1),
+    SYS_OP (0, 8, 7, 7, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAALE1),
+    SYS_OP (4, 8, 0, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_IPAS2E1IS),
+    SYS_OP (4, 8, 0, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_IPAS2LE1IS),
+    SYS_OP (4, 8, 3, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE2IS),
+    SYS_OP (4, 8, 3, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE2IS),
+    SYS_OP (4, 8, 3, 4, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE1IS),
+    SYS_OP (4, 8, 3, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE2IS),
+    SYS_OP (4, 8, 3, 6, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VMALLS12E1IS),
+    SYS_OP (4, 8, 4, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_IPAS2E1),
+    SYS_OP (4, 8, 4, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_IPAS2LE1),
+    SYS_OP (4, 8, 7, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE2),
+    SYS_OP (4, 8, 7, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE2),
+    SYS_OP (4, 8, 7, 4, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE1),
+    SYS_OP (4, 8, 7, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE2),
+    SYS_OP (4, 8, 7, 6, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VMALLS12E1),
+    SYS_OP (6, 8, 3, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE3IS),
+    SYS_OP (6, 8, 3, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE3IS),
+    SYS_OP (6, 8, 3, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE3IS),
+    SYS_OP (6, 8, 7, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE3),
+    SYS_OP (6, 8, 7, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE3),
+    SYS_OP (6, 8, 7, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE3),
+    SYS_OP (0, 8, 1, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VMALLE1OS),
+    SYS_OP (0, 8, 1, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE1OS),
+    SYS_OP (0, 8, 1, 2, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ASIDE1OS),
+    SYS_OP (0, 8, 1, 3, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAAE1OS),
+    SYS_OP (0, 8, 1, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE1OS),
+    SYS_OP (0, 8, 1, 7, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAALE1OS),
+    SYS_OP (0, 8, 2, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE1IS),
+    SYS_OP (0, 8, 2, 3, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAAE1IS),
+    SYS_OP (0, 8, 2, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE1IS),
+    SYS_OP (0, 8, 2, 7, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAALE1IS),
+    SYS_OP (0, 8, 5, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE1OS),
+    SYS_OP (0, 8, 5, 3, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAAE1OS),
+    SYS_OP (0, 8, 5, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE1OS),
+    SYS_OP (0, 8, 5, 7, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAALE1OS),
+    SYS_OP (0, 8, 6, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE1),
+    SYS_OP (0, 8, 6, 3, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAAE1),
+    SYS_OP (0, 8, 6, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE1),
+    SYS_OP (0, 8, 6, 7, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAALE1),
+    SYS_OP (4, 8, 0, 2, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RIPAS2E1IS),
+    SYS_OP (4, 8, 0, 6, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RIPAS2LE1IS),
+    SYS_OP (4, 8, 1, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE2OS),
+    SYS_OP (4, 8, 1, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE2OS),
+    SYS_OP (4, 8, 1, 4, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE1OS),
+    SYS_OP (4, 8, 1, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE2OS),
+    SYS_OP (4, 8, 1, 6, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VMALLS12E1OS),
+    SYS_OP (4, 8, 2, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE2IS),
+    SYS_OP (4, 8, 2, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE2IS),
+    SYS_OP (4, 8, 4, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_IPAS2E1OS),
+    SYS_OP (4, 8, 4, 4, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_IPAS2LE1OS),
+    SYS_OP (6, 8, 1, 0, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_ALLE3OS),
+    SYS_OP (6, 8, 1, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VAE3OS),
+    SYS_OP (6, 8, 1, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_VALE3OS),
+    SYS_OP (4, 8, 4, 2, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RIPAS2E1),
+    SYS_OP (4, 8, 4, 3, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RIPAS2E1OS),
+    SYS_OP (4, 8, 4, 6, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RIPAS2LE1),
+    SYS_OP (4, 8, 4, 7, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RIPAS2LE1OS),
+    SYS_OP (4, 8, 5, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE2OS),
+    SYS_OP (4, 8, 5, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE2OS),
+    SYS_OP (4, 8, 6, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE2),
+    SYS_OP (4, 8, 6, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE2),
+    SYS_OP (6, 8, 2, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE3IS),
+    SYS_OP (6, 8, 2, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE3IS),
+    SYS_OP (6, 8, 5, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE3OS),
+    SYS_OP (6, 8, 5, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE3OS),
+    SYS_OP (6, 8, 6, 1, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVAE3),
+    SYS_OP (6, 8, 6, 5, ARM64_SYSOP_TLBI, ARM64_TLBI_OP_RVALE3),
+};
+
+/* Table entry for an operation, or NULL if it isn't an AT, DC, IC, BRB or TLBI operation */
+LIBARCH_PRIVATE LIBARCH_API
+const sys_op_t *
+_sys_op_lookup (unsigned op1, unsigned CRn, unsigned CRm, unsigned op2)
+{
+    const sys_op_t *entry;
+
+    if (CRn < 7 || CRn > 8 || op1 > 7 || CRm > 15 || op2 > 7) return NULL;
+    entry = &sys_op_table[SYS_OP_INDEX (op1, CRn, CRm, op2)];
+    return (entry->known) ? entry : NULL;
+}
+
+/* op1:CRm:op2 encoding of the first `sysop` entry for `op`, or -1 */
+LIBARCH_PRIVATE LIBARCH_API
+int
+_sys_op_encoding (unsigned sysop, int op)
+{
+    for (unsigned i = 0; i < sizeof (sys_op_table) / sizeof (*sys_op_table); i++)
+        if (sys_op_table[i].known && sys_op_table[i].sysop == sysop && sys_op_table[i].op == op)
+            return ((i >> 8) << 7) | (i & 0x7f);
+    return -1;
+}
+
 int 
 SysOp (unsigned op1, unsigned CRn, unsigned CRm, unsigned op2)
 {
-    unsigned encoding = (op1 << 11);
-    encoding |= (CRn << 7);
-    encoding |= (CRm << 3);
-    encoding |= op2;
-
-    switch(encoding){
-        /* SysOp AT */
-        case 0x3c0:
-        case 0x23c0:
-        case 0x33c0:
-        case 0x3c1:
-        case 0x23c1:
-        case 0x33c1:
-        case 0x3c2:
-        case 0x3c3:
-        case 0x23c4:
-        case 0x23c5:
-        case 0x23c6:
-        case 0x23c7:
-            return ARM64_SYSOP_AT;
-
-        /* SysOP DC */
-        case 0x1ba1:
-        case 0x3b1:
-        case 0x3b2:
-        case 0x1bd1:
-        case 0x3d2:
-        case 0x1bd9:
-        case 0x1bf1:
-        case 0x3f2:
-        case 0x1be9:
-            return ARM64_SYSOP_DC;
-
-        /* SysOp IC */
-        case 0x388:
-        case 0x3a8:
-        case 0x1ba9:
-            return ARM64_SYSOP_IC;
-
-        /* SysOp BRB */
-        case 0xb94:
-        case 0xb95:
-            return ARM64_SYSOP_BRB;
-
-        /* SysOp TLBI */
-        case 0x2401:
-        case 0x2405:
-        case 0x418:
-        case 0x2418:
-        case 0x3418:
-        case 0x419:
-        case 0x2419:
-        case 0x3419:
-        case 0x41a:
-        case 0x41b:
-        case 0x241c:
-        case 0x41d:
-        case 0x241d:
-        case 0x341d:
-        case 0x241e:
-        case 0x41f:
-        case 0x2421:
-        case 0x2425:
-        case 0x438:
-        case 0x2438:
-        case 0x3438:
-        case 0x439:
-        case 0x2439:
-        case 0x3439:
-        case 0x43a:
-        case 0x43b:
-        case 0x243c:
-        case 0x43d:
-        case 0x243d:
-        case 0x343d:
-        case 0x243e:
-        case 0x43f:
-            return ARM64_SYSOP_TLBI;
-
-        /* SysOp Sys */
-        default: 
-            return ARM64_SYSOP_SYS;
-    };
+    const sys_op_t *entry = _sys_op_lookup (op1, CRn, CRm, op2);
+    return (entry) ? entry->sysop : ARM64_SYSOP_SYS;
 }
 
 int
 get_tlbi (unsigned op1, unsigned CRn, unsigned CRm, unsigned op2)
 {
-    unsigned encoding = (((op1 << 7) | (CRm << 3)) | op2);
-    switch (encoding) 
-    {
-        case 0x18: return ARM64_TLBI_OP_VMALLE1IS;
-        case 0x19: return ARM64_TLBI_OP_VAE1IS;
-        case 0x1a: return ARM64_TLBI_OP_ASIDE1IS;
-        case 0x1b: return ARM64_TLBI_OP_VAAE1IS;
-        case 0x1d: return ARM64_TLBI_OP_VALE1IS;
-        case 0x1f: return ARM64_TLBI_OP_VAALE1IS;
-        case 0x38: return ARM64_TLBI_OP_VMALLE1;
-        case 0x39: return ARM64_TLBI_OP_VAE1;
-        case 0x3a: return ARM64_TLBI_OP_ASIDE1;
-        case 0x3b: return ARM64_TLBI_OP_VAAE1;
-        case 0x3d: return ARM64_TLBI_OP_VALE1;
-        case 0x3f: return ARM64_TLBI_OP_VAALE1;
-        case 0x201: return ARM64_TLBI_OP_IPAS2E1IS;
-        case 0x205: return ARM64_TLBI_OP_IPAS2LE1IS;
-        case 0x218: return ARM64_TLBI_OP_ALLE2IS;
-        case 0x219: return ARM64_TLBI_OP_VAE2IS;
-        case 0x21c: return ARM64_TLBI_OP_ALLE1IS;
-        case 0x21d: return ARM64_TLBI_OP_VALE2IS;
-        case 0x21e: return ARM64_TLBI_OP_VMALLS12E1IS;
-        case 0x221: return ARM64_TLBI_OP_IPAS2E1;
-        case 0x225: return ARM64_TLBI_OP_IPAS2LE1;
-        case 0x238: return ARM64_TLBI_OP_ALLE2;
-        case 0x239: return ARM64_TLBI_OP_VAE2;
-        case 0x23c: return ARM64_TLBI_OP_ALLE1;
-        case 0x23d: return ARM64_TLBI_OP_VALE2;
-        case 0x23e: return ARM64_TLBI_OP_VMALLS12E1;
-        case 0x318: return ARM64_TLBI_OP_ALLE3IS;
-        case 0x319: return ARM64_TLBI_OP_VAE3IS;
-        case 0x31d: return ARM64_TLBI_OP_VALE3IS;
-        case 0x338: return ARM64_TLBI_OP_ALLE3;
-        case 0x339: return ARM64_TLBI_OP_VAE3;
-        case 0x33d: return ARM64_TLBI_OP_VALE3;
-        case 0x8: return ARM64_TLBI_OP_VMALLE1OS;
-        case 0x9: return ARM64_TLBI_OP_VAE1OS;
-        case 0xa: return ARM64_TLBI_OP_ASIDE1OS;
-        case 0xb: return ARM64_TLBI_OP_VAAE1OS;
-        case 0xd: return ARM64_TLBI_OP_VALE1OS;
-        case 0xf: return ARM64_TLBI_OP_VAALE1OS;
-        case 0x11: return ARM64_TLBI_OP_RVAE1IS;
-        case 0x13: return ARM64_TLBI_OP_RVAAE1IS;
-        case 0x15: return ARM64_TLBI_OP_RVALE1IS;
-        case 0x17: return ARM64_TLBI_OP_RVAALE1IS;
-        case 0x29: return ARM64_TLBI_OP_RVAE1OS;
-        case 0x2b: return ARM64_TLBI_OP_RVAAE1OS;
-        case 0x2d: return ARM64_TLBI_OP_RVALE1OS;
-        case 0x2f: return ARM64_TLBI_OP_RVAALE1OS;
-        case 0x31: return ARM64_TLBI_OP_RVAE1;
-        case 0x33: return ARM64_TLBI_OP_RVAAE1;
-        case 0x35: return ARM64_TLBI_OP_RVALE1;
-        case 0x37: return ARM64_TLBI_OP_RVAALE1;
-        case 0x202: return ARM64_TLBI_OP_RIPAS2E1IS;
-        case 0x206: return ARM64_TLBI_OP_RIPAS2LE1IS;
-        case 0x208: return ARM64_TLBI_OP_ALLE2OS;
-        case 0x209: return ARM64_TLBI_OP_VAE2OS;
-        case 0x20c: return ARM64_TLBI_OP_ALLE1OS;
-        case 0x20d: return ARM64_TLBI_OP_VALE2OS;
-        case 0x20e: return ARM64_TLBI_OP_VMALLS12E1OS;
-        case 0x211: return ARM64_TLBI_OP_RVAE2IS;
-        case 0x215: return ARM64_TLBI_OP_RVALE2IS;
-        case 0x220: return ARM64_TLBI_OP_IPAS2E1OS;
-
-        case 0x224: return ARM64_TLBI_OP_IPAS2LE1OS;
-        case 0x308: return ARM64_TLBI_OP_ALLE3OS;
-        case 0x309: return ARM64_TLBI_OP_VAE3OS;
-        case 0x30d: return ARM64_TLBI_OP_VALE3OS;
-
-        default: return ARM64_TLBI_OP_UNKNOWN;
-    }
+    const sys_op_t *entry = _sys_op_lookup (op1, 8, CRm, op2);
+    return (entry && entry->sysop == ARM64_SYSOP_TLBI) ? entry->op : ARM64_TLBI_OP_UNKNOWN;
+}
+
+int
+arm64_tlbi_encoding (int op)
+{
+    return _sys_op_encoding (ARM64_SYSOP_TLBI, op);
+}
+
+int
+get_at_name (unsigned op1, unsigned CRm, unsigned op2)
+{
+    const sys_op_t *entry = _sys_op_lookup (op1, 7, CRm, op2);
+    return (entry && entry->sysop == ARM64_SYSOP_AT) ? entry->op : -1;
+}
+
+int
+arm64_at_encoding (int name)
+{
+    return _sys_op_encoding (ARM64_SYSOP_AT, name);
 }
 
 /* --------------------------------------------------------------------------- */
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <instruction.h>
+#include <format.h>
+#include <alias.h>
+
+#include "test.h"
+
+/**
+ *  A raw decode must format the same as a normal one once the alias is picked,
+ *  either by the formatter or by libarch_alias_instruction, across the data
+ *  processing encodings.
+ */
+static void
+test_raw (void)
+{
+    char expected[LIBARCH_FORMAT_MAX_LEN], buf[LIBARCH_FORMAT_MAX_LEN];
+    libarch_ctx_t raw;
+    uint32_t seed = 0x2545f491;
+
+    libarch_ctx_init (&raw);
+    raw.options = LIBARCH_OPT_RAW;
+
+    for (int i = 0; i < 0x20000; i++) {
+        seed = seed * 1664525 + 1013904223;
+
+        /* Alternate between the immediate and register groups */
+        uint32_t opcode = (i & 1) ? (seed & ~(7u << 26)) | (4u << 26) : (seed & ~(7u << 25)) | (5u << 25);
+
+        instruction_t *in = libarch_instruction_create (opcode, 0);
+        libarch_disass (&in);
+        libarch_format_instruction (NULL, in, expected, sizeof (expected));
+
+        instruction_t *out = libarch_instruction_create (opcode, 0);
+        libarch_disass_ctx (&raw, &out);
+        libarch_format_instruction (NULL, out, buf, sizeof (buf));
+        CHECK (!strcmp (buf, expected), "0x%08x formatted raw as \"%s\", not \"%s\"", opcode, buf, expected);
+
+        libarch_alias_instruction (out);
+        libarch_format_instruction (&raw, out, buf, sizeof (buf));
+        CHECK (!strcmp (buf, expected) && out->type == in->type,
+            "0x%08x aliased to \"%s\", not \"%s\"", opcode, buf, expected);
+
+        libarch_instruction_free (in);
+        libarch_instruction_free (out);
+    }
+
+    /* The raw context formats the canonical instruction */
+    struct { uint32_t opcode; const char *text; } canonical[] = {
+        { 0xaa0103e0, "orr\tx0, xzr, x1" },
+        { 0xf100041f, "subs\txzr, x0, 0x1" },
+        { 0xd3441c20, "ubfm\tx0, x1, 0x4, 0x7" },
+        { 0x1a9f17e0, "csinc\tw0, wzr, wzr, ne" },
+        { 0x13917e37, "extr\tw23, w17, w17, 0x1f" },
+    };
+    for (size_t i = 0; i < sizeof (canonical) / sizeof (*canonical); i++) {
+        instruction_t *in = libarch_instruction_create (canonical[i].opcode, 0);
+        libarch_disass_ctx (&raw, &in);
+        libarch_format_instruction (&raw, in, buf, sizeof (buf));
+        CHECK (!strcmp (buf, canonical[i].text), "0x%08x raw is \"%s\", not \"%s\"",
+            canonical[i].opcode, buf, canonical[i].text);
+        libarch_instruction_free (in);
+    }
+
+    libarch_ctx_cleanup (&raw);
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("alias-test\n");
+
+    test_raw ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
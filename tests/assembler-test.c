@@ -0,0 +1,271 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include "arm64/arm64-conditions.h"
+#include "arm64/arm64-instructions.h"
+#include "arm64/arm64-logical-immediates.h"
+#include "arm64/arm64-registers.h"
+#include "arm64/arm64-tlbi-ops.h"
+#include "arm64/arm64-translation.h"
+
+#include <instruction.h>
+#include <format.h>
+#include <assembler.h>
+#include <corpus.h>
+
+#include "test.h"
+
+/**
+ *  Assembler tests. Every instruction is checked by round-tripping it through
+ *  libarch_disass: opcodes from a test file are decoded and assembled again,
+ *  and instructions built by hand are assembled and then decoded.
+ */
+
+/* Decode, re-assemble and compare a single opcode */
+static void
+round_trip (uint32_t opcode, uint64_t addr)
+{
+    char buf[LIBARCH_FORMAT_MAX_LEN];
+    uint32_t encoded = 0;
+
+    instruction_t *in = libarch_instruction_create (opcode, addr);
+    libarch_disass (&in);
+    libarch_format_instruction (NULL, in, buf, sizeof (buf));
+
+    CHECK (libarch_assemble (in, &encoded) && encoded == opcode,
+        "0x%08x @ 0x%llx (%s) assembled to 0x%08x", opcode, (unsigned long long) addr, buf, encoded);
+
+    libarch_instruction_free (in);
+}
+
+/* Round-trip every opcode in a corpus file, see corpus.h for the format */
+static int
+test_file (const char *path)
+{
+    libarch_corpus_t corpus;
+
+    if (!libarch_corpus_load (&corpus, path)) {
+        printf ("    FAIL: could not open %s\n", path);
+        return ++failures;
+    }
+
+    /* Labels are absolute, so check they survive a different address */
+    for (size_t i = 0; i < corpus.len; i++) {
+        round_trip (corpus.opcodes[i], 0);
+        round_trip (corpus.opcodes[i], 0xfffffff007004000ULL + i * 4);
+    }
+
+    int count = (int) corpus.len;
+    printf ("    %s: %d opcodes\n", path, count);
+    libarch_corpus_free (&corpus);
+    return count;
+}
+
+/* Assemble a hand built instruction, check the opcode, and that it decodes to the same type */
+static void
+check_built (instruction_t *in, uint32_t expected)
+{
+    uint32_t opcode = 0;
+
+    CHECK (libarch_assemble (in, &opcode) && opcode == expected,
+        "%s assembled to 0x%08x, expected 0x%08x", A64_INSTRUCTIONS_STR[in->type], opcode, expected);
+
+    instruction_t *out = libarch_instruction_create (opcode, in->addr);
+    libarch_disass (&out);
+    CHECK (out->type == in->type && out->operands_len == in->operands_len,
+        "0x%08x decoded as %s", opcode, A64_INSTRUCTIONS_STR[out->type]);
+
+    libarch_instruction_free (out);
+    libarch_instruction_free (in);
+}
+
+static instruction_t *
+build (arm64_instr_t type, uint64_t addr)
+{
+    instruction_t *in = libarch_instruction_create (0, addr);
+    in->type = type;
+    return in;
+}
+
+static void
+test_built (void)
+{
+    instruction_t *in;
+    uint32_t opcode;
+
+    /* b 0x2000 */
+    in = build (ARM64_INSTRUCTION_B, 0x1000);
+    libarch_instruction_add_operand_immediate (&in, 0x2000, ARM64_IMMEDIATE_TYPE_LONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    check_built (in, 0x14000400);
+
+    /* bl 0x800 */
+    in = build (ARM64_INSTRUCTION_BL, 0x1000);
+    libarch_instruction_add_operand_immediate (&in, 0x800, ARM64_IMMEDIATE_TYPE_LONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    check_built (in, 0x97fffe00);
+
+    /* b.ne 0x1010 */
+    in = build (ARM64_INSTRUCTION_B, 0x1000);
+    in->cond = ARM64_BRANCH_CONDITION_NE;
+    libarch_instruction_add_operand_immediate (&in, 0x1010, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    check_built (in, 0x54000081);
+
+    /* nop */
+    check_built (build (ARM64_INSTRUCTION_NOP, 0), 0xd503201f);
+
+    /* movk x0, #0x1234, lsl #16 */
+    in = build (ARM64_INSTRUCTION_MOVK, 0);
+    libarch_instruction_add_operand_register (&in, 0, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_immediate (&in, 0x1234, ARM64_IMMEDIATE_TYPE_UINT, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    libarch_instruction_add_operand_shift (&in, 16, ARM64_SHIFT_TYPE_LSL);
+    check_built (in, 0xf2a24680);
+
+    /* msr sctlr_el1, x0 */
+    in = build (ARM64_INSTRUCTION_MSR, 0);
+    libarch_instruction_add_operand_register (&in, ARM64_SYSREG_SCTLR_EL1, 64, ARM64_REGISTER_TYPE_SYSTEM, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_register (&in, 0, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    check_built (in, 0xd5181000);
+
+    /* tlbi vmalle1is */
+    in = build (ARM64_INSTRUCTION_TLBI, 0);
+    libarch_instruction_add_operand_extra (&in, ARM64_OPERAND_TYPE_TLBI_OP, ARM64_TLBI_OP_VMALLE1IS);
+    check_built (in, 0xd508831f);
+
+    /* at s1e1r, x0 */
+    in = build (ARM64_INSTRUCTION_AT, 0);
+    libarch_instruction_add_operand_extra (&in, ARM64_OPERAND_TYPE_AT_NAME, ARM64_AT_NAME_S1E1R);
+    libarch_instruction_add_operand_register (&in, 0, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+    check_built (in, 0xd5087800);
+
+    /* Out of range branches are rejected */
+    in = build (ARM64_INSTRUCTION_B, 0);
+    in->cond = ARM64_BRANCH_CONDITION_EQ;
+    libarch_instruction_add_operand_immediate (&in, 0x100000, ARM64_IMMEDIATE_TYPE_ULONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    CHECK (!libarch_assemble (in, &opcode), "b.eq out of range was assembled to 0x%08x", opcode);
+    libarch_instruction_free (in);
+
+    /* Values that aren't bitmask immediates are rejected */
+    in = build (ARM64_INSTRUCTION_AND, 0);
+    libarch_instruction_add_operand_register (&in, 0, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+    libarch_instruction_add_operand_register (&in, 1, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+    libarch_instruction_add_operand_immediate (&in, 0x1234, ARM64_IMMEDIATE_TYPE_LONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+    CHECK (!libarch_assemble (in, &opcode), "and x0, x1, #0x1234 was assembled to 0x%08x", opcode);
+    libarch_instruction_free (in);
+}
+
+/* Every bitmask immediate encodes through the inverse table and decodes back to the same value */
+static void
+test_logical_immediates (void)
+{
+    for (uint64_t i = 0; i < A64_LOGICAL_IMMEDIATE_ENCODINGS_LEN; i++) {
+        uint64_t value = A64_LOGICAL_IMMEDIATE_ENCODINGS[i].value;
+        uint32_t opcode = 0;
+
+        instruction_t *in = build (ARM64_INSTRUCTION_EOR, 0);
+        libarch_instruction_add_operand_register (&in, 2, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_NONE);
+        libarch_instruction_add_operand_register (&in, 3, 64, ARM64_REGISTER_TYPE_GENERAL, ARM64_REGISTER_OPERAND_OPT_PREFER_ZERO);
+        libarch_instruction_add_operand_immediate (&in, value, ARM64_IMMEDIATE_TYPE_LONG, ARM64_IMMEDIATE_OPERAND_OPT_NONE);
+
+        CHECK (libarch_assemble (in, &opcode), "eor x2, x3, #0x%llx was not assembled", (unsigned long long) value);
+        libarch_instruction_free (in);
+
+        instruction_t *out = libarch_instruction_create (opcode, 0);
+        libarch_disass (&out);
+
+        const operand_t *op = libarch_instruction_get_operand (out, 2);
+        CHECK (out->type == ARM64_INSTRUCTION_EOR && op && libarch_operand_get_immediate (op) == value,
+            "eor x2, x3, #0x%llx assembled to 0x%08x", (unsigned long long) value, opcode);
+        libarch_instruction_free (out);
+    }
+}
+
+/* Run a MOVZ/MOVN/MOVK/MOV sequence through the decoder and return the value it loads */
+static uint64_t
+run_move_sequence (const uint32_t *opcodes, size_t len, uint8_t size)
+{
+    uint64_t value = 0;
+    uint64_t mask = (size == 64) ? ~0ULL : 0xffffffffULL;
+
+    for (size_t i = 0; i < len; i++) {
+        instruction_t *in = libarch_instruction_create (opcodes[i], 0);
+        libarch_disass (&in);
+
+        const operand_t *imm = libarch_instruction_get_operand (in, 1);
+        const operand_t *shift = libarch_instruction_get_operand (in, 2);
+        uint64_t v = libarch_operand_get_immediate (imm);
+        unsigned s = (shift) ? libarch_operand_get_shift (shift) : 0;
+
+        if (in->type == ARM64_INSTRUCTION_MOV) value = v;
+        else if (in->type == ARM64_INSTRUCTION_MOVZ) value = v << s;
+        else if (in->type == ARM64_INSTRUCTION_MOVN) value = ~(v << s);
+        else if (in->type == ARM64_INSTRUCTION_MOVK) value = (value & ~(0xffffULL << s)) | (v << s);
+        else CHECK (0, "0x%08x is not a move", opcodes[i]);
+
+        libarch_instruction_free (in);
+    }
+    return value & mask;
+}
+
+static void
+test_move_immediate (void)
+{
+    uint64_t values[] = {
+        0, 1, 0xffff, 0x10000, 0xffffffff, ~0ULL, 0xfffffffffffffffe,
+        0xfffffff007004000, 0x0000ffff00000000, 0xffff1234ffffffff,
+        0x5555555555555555, 0x00ff00ff00ff00ff, 0x123456789abcdef0,
+    };
+    uint64_t seed = 0x2545f4914f6cdd1d;
+
+    for (int i = 0; i < 4096; i++) {
+        uint64_t value = (i < sizeof (values) / sizeof (*values)) ? values[i] : seed;
+        uint32_t opcodes[LIBARCH_ASSEMBLE_MOVE_MAX_LEN];
+
+        /* xorshift for the rest of the values */
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        for (uint8_t size = 32; size <= 64; size += 32) {
+            uint64_t expected = (size == 64) ? value : value & 0xffffffff;
+            size_t len = libarch_assemble_move_immediate (5, size, value, opcodes);
+
+            CHECK (len >= 1 && len <= size / 16, "%d-bit load of 0x%llx took %zu instructions",
+                size, (unsigned long long) value, len);
+            CHECK (run_move_sequence (opcodes, len, size) == expected, "%d-bit load of 0x%llx loaded 0x%llx",
+                size, (unsigned long long) value, (unsigned long long) run_move_sequence (opcodes, len, size));
+        }
+    }
+}
+
+int main (int argc, char *argv[])
+{
+    if (argc < 2) {
+        printf ("usage: %s <test file>\n", argv[0]);
+        return 1;
+    }
+
+    for (int i = 1; i < argc; i++) test_file (argv[i]);
+    test_built ();
+    test_logical_immediates ();
+    test_move_immediate ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
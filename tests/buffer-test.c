@@ -0,0 +1,152 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <buffer.h>
+#include <format.h>
+
+#include "test.h"
+
+/**
+ *  Buffer decoding tests. Run lengths are checked with the mismatch at every
+ *  position of the vector loops and their tails, then a buffer of padding,
+ *  branches and undecodable words is decoded with and without collapsing.
+ */
+
+#define BASE            0x100000ULL
+#define NOP             0xd503201f
+#define B_NEXT          0x14000001
+
+static void
+test_run_length (void)
+{
+    uint32_t words[128];
+
+    CHECK (libarch_run_length (words, 0) == 0, "empty buffer");
+
+    words[0] = NOP;
+    CHECK (libarch_run_length (words, 1) == 1, "single word");
+
+    /* Every run length in every buffer length, so each loop ends every way */
+    for (size_t len = 2; len <= 128; len++) {
+        for (size_t run = 1; run <= len; run++) {
+            for (size_t i = 0; i < len; i++) words[i] = (i < run) ? NOP : 0;
+
+            size_t got = libarch_run_length (words, len);
+            CHECK (got == run, "run of %zu in %zu words, got %zu", run, len, got);
+        }
+    }
+}
+
+/* 100 nops, three branches to the next word, five zeros, and a nop */
+static size_t
+build_buffer (uint32_t *words)
+{
+    size_t n = 0;
+
+    for (size_t i = 0; i < 100; i++) words[n++] = NOP;
+    for (size_t i = 0; i < 3; i++) words[n++] = B_NEXT;
+    for (size_t i = 0; i < 5; i++) words[n++] = 0;
+    words[n++] = NOP;
+    return n;
+}
+
+static void
+free_records (instruction_t **instrs, size_t n)
+{
+    for (size_t i = 0; i < n; i++) libarch_instruction_free (instrs[i]);
+}
+
+static void
+test_decode (void)
+{
+    uint32_t words[128];
+    instruction_t *instrs[128] = { NULL };
+    size_t len = build_buffer (words), n, used;
+    libarch_ctx_t ctx;
+
+    libarch_ctx_init (&ctx);
+
+    /* Without collapsing, a record per word */
+    n = libarch_disass_buffer (&ctx, words, BASE, len, instrs, 128, &used);
+    CHECK (n == len && used == len, "%zu records for %zu words", n, len);
+    for (size_t i = 0; i < n; i++)
+        CHECK (instrs[i]->run == 1 && instrs[i]->addr == BASE + i * 4, "record %zu", i);
+
+    /* Collapsed into the records already there, except the branches */
+    ctx.options |= LIBARCH_OPT_COLLAPSE_RUNS;
+    n = libarch_disass_buffer (&ctx, words, BASE, len, instrs, 128, &used);
+    CHECK (n == 6 && used == len, "%zu records collapsed", n);
+    if (n == 6) {
+        static const uint32_t runs[] = { 100, 1, 1, 1, 5, 1 };
+        static const uint64_t offsets[] = { 0, 400, 404, 408, 412, 432 };
+
+        for (size_t i = 0; i < n; i++)
+            CHECK (instrs[i]->run == runs[i] && instrs[i]->addr == BASE + offsets[i],
+                "record %zu: run %u at 0x%llx", i, instrs[i]->run, (unsigned long long) instrs[i]->addr);
+        CHECK (instrs[1]->type == ARM64_INSTRUCTION_B, "branch");
+    }
+
+    /* Stopping when the records run out */
+    n = libarch_disass_buffer (&ctx, words, BASE, len, instrs, 2, &used);
+    CHECK (n == 2 && used == 101, "%zu records, %zu words with two slots", n, used);
+
+    free_records (instrs, 128);
+    libarch_ctx_cleanup (&ctx);
+}
+
+static void
+test_format (void)
+{
+    uint32_t words[128];
+    instruction_t *instrs[128] = { NULL };
+    size_t len = build_buffer (words);
+    char buf[LIBARCH_FORMAT_MAX_LEN];
+    libarch_ctx_t ctx;
+
+    libarch_ctx_init (&ctx);
+    ctx.options |= LIBARCH_OPT_COLLAPSE_RUNS;
+    libarch_disass_buffer (&ctx, words, BASE, len, instrs, 128, NULL);
+
+    libarch_format_instruction (&ctx, instrs[0], buf, sizeof (buf));
+    CHECK (!strncmp (buf, "... 100 x nop", 13), "got \"%s\"", buf);
+
+    libarch_format_instruction (&ctx, instrs[5], buf, sizeof (buf));
+    CHECK (!strncmp (buf, "nop", 3), "got \"%s\"", buf);
+
+    /* Only collapsed when the format context asks for it */
+    libarch_format_instruction (NULL, instrs[0], buf, sizeof (buf));
+    CHECK (!strncmp (buf, "nop", 3), "got \"%s\"", buf);
+
+    free_records (instrs, 128);
+    libarch_ctx_cleanup (&ctx);
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("buffer-test\n");
+
+    test_run_length ();
+    test_decode ();
+    test_format ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <byteorder.h>
+
+#include "test.h"
+
+/**
+ *  Byte order loader tests. Every combination of source and destination
+ *  alignment, length and partial tail is checked against words assembled one
+ *  byte at a time, in both byte orders and in place.
+ */
+
+#define MAX_WORDS       80
+
+static uint32_t
+reference (const uint8_t *p, int order)
+{
+    if (order == LIBARCH_BYTE_ORDER_BIG)
+        return (uint32_t) p[0] << 24 | (uint32_t) p[1] << 16 | (uint32_t) p[2] << 8 | p[3];
+    return (uint32_t) p[3] << 24 | (uint32_t) p[2] << 16 | (uint32_t) p[1] << 8 | p[0];
+}
+
+static void
+test_buffers (int order)
+{
+    static uint8_t src[MAX_WORDS * 4 + 64];
+    static uint32_t dst[MAX_WORDS + 16];
+
+    for (size_t i = 0; i < sizeof (src); i++) src[i] = (uint8_t) (i * 37 + 11);
+
+    for (size_t soff = 0; soff < 4; soff++)
+    for (size_t doff = 0; doff < 8; doff++)
+    for (size_t words = 0; words <= MAX_WORDS; words++)
+    for (size_t tail = 0; tail < 4; tail++) {
+        const uint8_t *in = src + soff;
+        uint32_t *out = dst + doff;
+
+        memset (dst, 0xa5, sizeof (dst));
+        size_t n = libarch_load_opcodes (out, in, words * 4 + tail, order);
+
+        if (n != words) {
+            printf ("    FAIL: %zu words loaded, expected %zu\n", n, words);
+            failures++;
+            continue;
+        }
+        for (size_t i = 0; i < words; i++) {
+            if (out[i] != reference (in + i * 4, order)) {
+                printf ("    FAIL: order %d, offsets %zu/%zu, %zu words: word %zu is 0x%08x, expected 0x%08x\n",
+                    order, soff, doff, words, i, out[i], reference (in + i * 4, order));
+                failures++;
+                break;
+            }
+        }
+        if (out[words] != 0xa5a5a5a5 || (doff && dst[doff - 1] != 0xa5a5a5a5)) {
+            printf ("    FAIL: order %d, %zu words: wrote outside the output\n", order, words);
+            failures++;
+        }
+    }
+}
+
+static void
+test_in_place (int order)
+{
+    uint32_t buf[MAX_WORDS + 8], expect[MAX_WORDS + 8];
+
+    for (size_t off = 0; off < 8; off++) {
+        for (size_t i = 0; i < MAX_WORDS; i++) buf[off + i] = (uint32_t) (i * 0x01020304 + 0x0a0b0c0d);
+        for (size_t i = 0; i < MAX_WORDS; i++) expect[i] = reference ((uint8_t *) &buf[off + i], order);
+
+        libarch_load_opcodes (buf + off, buf + off, MAX_WORDS * 4, order);
+        if (memcmp (buf + off, expect, MAX_WORDS * 4)) {
+            printf ("    FAIL: order %d, in place at offset %zu\n", order, off);
+            failures++;
+        }
+    }
+}
+
+static void
+test_single (void)
+{
+    const uint8_t nop[] = { 0xff, 0x1f, 0x20, 0x03, 0xd5 };
+
+    if (libarch_load_opcode (nop + 1, LIBARCH_BYTE_ORDER_LITTLE) != 0xd503201f ||
+        libarch_load_opcode (nop + 1, LIBARCH_BYTE_ORDER_BIG) != 0x1f2003d5) {
+        printf ("    FAIL: single opcode load\n");
+        failures++;
+    }
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("byteorder-test\n");
+
+    test_buffers (LIBARCH_BYTE_ORDER_LITTLE);
+    test_buffers (LIBARCH_BYTE_ORDER_BIG);
+    test_in_place (LIBARCH_BYTE_ORDER_LITTLE);
+    test_in_place (LIBARCH_BYTE_ORDER_BIG);
+    test_single ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include "arm64/arm64-instructions.h"
+
+#include <context.h>
+#include <instruction.h>
+#include <format.h>
+
+#include "test.h"
+
+/* Instructions from a disabled feature decode as unknown, or as HINT for the PAC hints */
+static void
+test_features (void)
+{
+    char buf[LIBARCH_FORMAT_MAX_LEN];
+    struct { uint32_t opcode; uint64_t feature; const char *text; } tests[] = {
+        { 0xf8250108, LIBARCH_FEATURE_LSE, "unk" },            // ldadd x5, x8, [x8]
+        { 0xc8b57d2a, LIBARCH_FEATURE_LSE, "unk" },            // cas x21, x10, [x9]
+        { 0x082c7d20, LIBARCH_FEATURE_LSE, "unk" },            // casp w12, w13, w0, w1, [x9]
+        { 0x191c0755, LIBARCH_FEATURE_MOPS, "unk" },           // cpyfp [x21]!, [x28]!, x26!
+        { 0xd503233f, LIBARCH_FEATURE_PAUTH, "hint\t25" },     // paciasp
+        { 0xdac10020, LIBARCH_FEATURE_PAUTH, "unk" },          // pacia x0, x1
+        { 0x9ac23020, LIBARCH_FEATURE_PAUTH, "unk" },          // pacga x0, x1, x2
+        { 0x91810820, LIBARCH_FEATURE_MTE, "unk" },            // addg x0, x1, 0x10, 0x2
+        { 0x9adf1020, LIBARCH_FEATURE_MTE, "unk" },            // irg x0, x1
+        { 0xd9200820, LIBARCH_FEATURE_MTE, "unk" },            // stg x0, [x1]
+        { 0x69031f3d, LIBARCH_FEATURE_MTE, "unk" },            // stgp x29, x7, [x25, 96]
+    };
+
+    for (size_t i = 0; i < sizeof (tests) / sizeof (*tests); i++) {
+        libarch_ctx_t ctx;
+
+        libarch_ctx_init (&ctx);
+        instruction_t *in = libarch_instruction_create (tests[i].opcode, 0);
+        libarch_disass_ctx (&ctx, &in);
+        CHECK (in->type != ARM64_INSTRUCTION_UNK && in->type != ARM64_INSTRUCTION_HINT,
+            "0x%08x didn't decode with every feature", tests[i].opcode);
+        libarch_instruction_free (in);
+
+        ctx.features &= ~tests[i].feature;
+        in = libarch_instruction_create (tests[i].opcode, 0);
+        libarch_disass_ctx (&ctx, &in);
+        libarch_format_instruction (&ctx, in, buf, sizeof (buf));
+        CHECK (!strncmp (buf, tests[i].text, strlen (tests[i].text)), "0x%08x without it's feature is \"%s\", not \"%s\"",
+            tests[i].opcode, buf, tests[i].text);
+        libarch_instruction_free (in);
+        libarch_ctx_cleanup (&ctx);
+    }
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("context-test\n");
+
+    test_features ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
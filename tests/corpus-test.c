@@ -0,0 +1,199 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <instruction.h>
+#include <format.h>
+#include <corpus.h>
+
+#include "test.h"
+
+/**
+ *  Corpus loader tests. A corpus in memory covers the header, separator and
+ *  whitespace handling, every hex digit is checked against strtoul, and the
+ *  files given on the command line are compared against a line-by-line
+ *  sscanf parse. Files after a -d are in libarch's own syntax, so each entry
+ *  is also decoded and compared with it's expected text.
+ */
+
+static const char corpus_text[] =
+    "* Header line\n"
+    "\n"
+    "1f2003d5    -  \tnop\n"
+    "FD7BBFA9  \t-   stp\tx29, x30, [sp, #-16]!   \r\n"
+    "c0035fd6 - ret\n"
+    "1f2003d5\n"                        /* no separator */
+    "1f2003d    -  short\n"             /* seven digits */
+    "1f2003dg    -  bad digit\n"
+    "1f2003d5x   -  no blank\n"
+    "00000000    -\n"                   /* empty expected text */
+    "e0031faa    -  mov\tx0, xzr";      /* no trailing newline */
+
+static void
+check_entry (const libarch_corpus_t *c, size_t i, uint32_t opcode, const char *expected, uint32_t line)
+{
+    if (i >= c->len) {
+        CHECK (0, "entry %zu missing", i);
+        return;
+    }
+    CHECK (c->opcodes[i] == opcode, "entry %zu opcode 0x%08x, expected 0x%08x", i, c->opcodes[i], opcode);
+    CHECK (c->expected_len[i] == strlen (expected) && !memcmp (c->expected[i], expected, strlen (expected)),
+        "entry %zu text \"%.*s\", expected \"%s\"", i, (int) c->expected_len[i], c->expected[i], expected);
+    CHECK (c->lines[i] == line, "entry %zu on line %u, expected %u", i, c->lines[i], line);
+}
+
+static void
+test_memory (void)
+{
+    libarch_corpus_t c;
+
+    CHECK (libarch_corpus_parse (&c, corpus_text, strlen (corpus_text)), "parse failed");
+    CHECK (c.len == 5, "%zu entries, expected 5", c.len);
+
+    check_entry (&c, 0, 0xd503201f, "nop", 3);
+    check_entry (&c, 1, 0xa9bf7bfd, "stp\tx29, x30, [sp, #-16]!", 4);
+    check_entry (&c, 2, 0xd65f03c0, "ret", 5);
+    check_entry (&c, 3, 0x00000000, "", 10);
+    check_entry (&c, 4, 0xaa1f03e0, "mov\tx0, xzr", 11);
+    libarch_corpus_free (&c);
+
+    CHECK (libarch_corpus_parse (&c, NULL, 0) && c.len == 0, "empty corpus");
+    libarch_corpus_free (&c);
+}
+
+/* Every digit in every position, upper and lower case */
+static void
+test_digits (void)
+{
+    static const char digits[] = "0123456789abcdefABCDEF";
+    char line[32];
+    libarch_corpus_t c;
+
+    for (int pos = 0; pos < 8; pos++) {
+        for (const char *d = digits; *d; d++) {
+            memcpy (line, "13579bdf - x\n", 14);
+            line[pos] = *d;
+
+            char bytes[9];
+            memcpy (bytes, line, 8);
+            bytes[8] = '\0';
+            uint32_t be = (uint32_t) strtoul (bytes, NULL, 16);
+            uint32_t expect = __builtin_bswap32 (be);
+
+            libarch_corpus_parse (&c, line, strlen (line));
+            CHECK (c.len == 1 && c.opcodes[0] == expect, "\"%.8s\" parsed as 0x%08x, expected 0x%08x",
+                line, c.len ? c.opcodes[0] : 0, expect);
+            libarch_corpus_free (&c);
+        }
+    }
+
+    /* Characters either side of each digit range */
+    for (const char *d = "/:@G`g \x80"; *d; d++) {
+        memcpy (line, "13579bdf - x\n", 14);
+        line[3] = *d;
+        libarch_corpus_parse (&c, line, strlen (line));
+        CHECK (c.len == 0, "0x%02x accepted as a hex digit", (unsigned char) *d);
+        libarch_corpus_free (&c);
+    }
+}
+
+/* Compare the loader with a simple parse of the same file */
+static void
+test_file (const char *path)
+{
+    libarch_corpus_t c;
+    char line[512];
+    size_t n = 0;
+    FILE *fp = fopen (path, "r");
+
+    if (!fp || !libarch_corpus_load (&c, path)) {
+        CHECK (0, "could not open %s", path);
+        if (fp) fclose (fp);
+        return;
+    }
+
+    while (fgets (line, sizeof (line), fp)) {
+        unsigned b[4];
+        char sep;
+        if (sscanf (line, "%2x%2x%2x%2x %c", &b[0], &b[1], &b[2], &b[3], &sep) != 5 || sep != '-')
+            continue;
+
+        uint32_t opcode = b[0] | (b[1] << 8) | (b[2] << 16) | (b[3] << 24);
+        CHECK (n < c.len && c.opcodes[n] == opcode, "%s: entry %zu mismatch", path, n);
+        n++;
+    }
+    CHECK (n == c.len, "%s: %zu entries, expected %zu", path, c.len, n);
+    printf ("    %s: %zu entries\n", path, c.len);
+
+    fclose (fp);
+    libarch_corpus_free (&c);
+}
+
+/* Decode every entry and compare the formatted instruction with the expected text */
+static void
+test_decode (const char *path)
+{
+    char buf[LIBARCH_FORMAT_MAX_LEN];
+    libarch_corpus_t c;
+    size_t len;
+
+    if (!libarch_corpus_load (&c, path)) {
+        CHECK (0, "could not open %s", path);
+        return;
+    }
+
+    for (size_t i = 0; i < c.len; i++) {
+        instruction_t *in = libarch_instruction_create (c.opcodes[i], 0);
+        libarch_disass (&in);
+        libarch_format_instruction (NULL, in, buf, sizeof (buf));
+
+        /* Instructions without operands keep the tab after the mnemonic, corpus lines don't */
+        len = strlen (buf);
+        while (len && buf[len - 1] == '\t') buf[--len] = '\0';
+
+        CHECK (len == c.expected_len[i] && !memcmp (buf, c.expected[i], c.expected_len[i]),
+            "%s:%u: 0x%08x is \"%s\", expected \"%.*s\"", path, c.lines[i], c.opcodes[i], buf,
+            (int) c.expected_len[i], c.expected[i]);
+        libarch_instruction_free (in);
+    }
+    printf ("    %s: %zu decoded\n", path, c.len);
+    libarch_corpus_free (&c);
+}
+
+int main (int argc, char *argv[])
+{
+    int decode = 0;
+
+    printf ("corpus-test\n");
+
+    test_memory ();
+    test_digits ();
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp (argv[i], "-d")) {
+            decode = 1;
+            continue;
+        }
+        test_file (argv[i]);
+        if (decode) test_decode (argv[i]);
+    }
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
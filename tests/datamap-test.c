@@ -0,0 +1,184 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <datamap.h>
+#include <descent.h>
+#include <format.h>
+
+#include "test.h"
+
+/**
+ *  Data detection tests. The images mix code with a 64-bit literal, a 32-bit
+ *  literal pool that runs into a word that doesn't decode, a run of padding,
+ *  and a jump table, and check which ranges are found and why.
+ */
+
+#define BASE            0x100000ULL
+#define WORDS           64
+#define NOP             0xd503201f
+#define RET             0xd65f03c0
+
+/**
+ *  Words 0-2 load a 64-bit literal at word 20 and a 32-bit one at word 24,
+ *  and return. Word 25, after the 32-bit literal, doesn't decode. Words 32-47
+ *  are padding, word 53 is a lone `udf` in code, and word 56, which nothing
+ *  reaches, loads a literal at word 60.
+ */
+static void
+build_image (uint32_t *image)
+{
+    for (size_t i = 0; i < WORDS; i++) image[i] = NOP;
+
+    image[0] = 0x58000280;          /* ldr   x0, word 20 */
+    image[1] = 0x180002e1;          /* ldr   w1, word 24 */
+    image[2] = RET;
+    image[20] = 0x07004000;
+    image[21] = 0xfffffff0;
+    image[24] = 0x12345678;
+    image[25] = 0x00000000;
+    for (size_t i = 32; i < 48; i++) image[i] = 0;
+    image[49] = RET;
+    image[53] = 0x00000000;
+    image[55] = RET;
+    image[56] = 0x58000082;         /* ldr   x2, word 60 */
+    image[57] = RET;
+}
+
+/* The range covering word `i`, or NULL */
+static const libarch_data_range_t *
+range_at (const libarch_datamap_t *map, size_t i)
+{
+    const libarch_data_range_t *r = libarch_datamap_find (map, BASE + i * 4);
+    return (r && r->addr <= BASE + i * 4) ? r : NULL;
+}
+
+static void
+test_detect (void)
+{
+    uint32_t image[WORDS];
+    libarch_datamap_t map;
+    const libarch_data_range_t *r;
+
+    build_image (image);
+    CHECK (libarch_datamap_detect (&map, image, BASE, WORDS, NULL), "detect failed");
+
+    r = range_at (&map, 20);
+    CHECK (r && r->addr == BASE + 80 && r->size == 8 && r->unit == 8 && r->reasons == LIBARCH_DATAMAP_LITERAL,
+        "64-bit literal");
+
+    r = range_at (&map, 24);
+    CHECK (r && r->addr == BASE + 96 && r->size == 8 && r->unit == 4 && (r->reasons & LIBARCH_DATAMAP_LITERAL),
+        "32-bit literal pool");
+
+    r = range_at (&map, 32);
+    CHECK (r && r->addr == BASE + 128 && r->size == 64 && r->reasons == LIBARCH_DATAMAP_UNDECODABLE,
+        "padding");
+
+    CHECK (range_at (&map, 60), "unreached literal without a descent");
+
+    /* Code, including the lone udf, is left alone */
+    for (size_t i = 0; i < WORDS; i++) {
+        if ((i >= 20 && i < 22) || (i >= 24 && i < 26) || (i >= 32 && i < 48) || (i >= 60 && i < 62)) continue;
+        CHECK (!range_at (&map, i), "word %zu is data", i);
+    }
+
+    CHECK (map.len == 4, "%zu ranges", map.len);
+    CHECK (libarch_datamap_find (&map, BASE + WORDS * 4) == NULL, "range past the end");
+    CHECK (libarch_datamap_find (&map, BASE) == &map.ranges[0], "first range");
+    libarch_datamap_free (&map);
+}
+
+/* With a descent, only literal loads that were reached count */
+static void
+test_descent (void)
+{
+    uint32_t image[WORDS];
+    libarch_datamap_t map;
+    libarch_descent_t d;
+    uint64_t entry = BASE;
+
+    build_image (image);
+    CHECK (libarch_descent_init (&d, image, BASE, WORDS) && libarch_descent_run (&d, &entry, 1, NULL, 1),
+        "descent failed");
+    CHECK (libarch_datamap_detect (&map, image, BASE, WORDS, &d), "detect failed");
+
+    CHECK (range_at (&map, 20) && range_at (&map, 24), "reached literals");
+    CHECK (!range_at (&map, 60), "unreached literal");
+    CHECK (map.len == 3, "%zu ranges", map.len);
+
+    libarch_datamap_free (&map);
+    libarch_descent_free (&d);
+}
+
+/* A switch dispatch's table, at word 32, is found without a descent */
+static void
+test_jumptable (void)
+{
+    static const uint32_t dispatch[] = {
+        0x7100151f,     /* cmp   w8, #5 */
+        0x54000268,     /* b.hi  default */
+        0x90000009,     /* adrp  x9, table@PAGE */
+        0x91020129,     /* add   x9, x9, table@PAGEOFF */
+        0x1000008a,     /* adr   x10, case 0 */
+        0x3868692b,     /* ldrb  w11, [x9, x8] */
+        0x8b0b094a,     /* add   x10, x10, x11, lsl #2 */
+        0xd61f0140,     /* br    x10 */
+    };
+    uint32_t image[WORDS];
+    libarch_datamap_t map;
+    const libarch_data_range_t *r;
+
+    for (size_t i = 0; i < WORDS; i++) image[i] = RET;
+    memcpy (image, dispatch, sizeof (dispatch));
+    image[32] = 0x02010005;
+    image[33] = 0x00000403;
+
+    CHECK (libarch_datamap_detect (&map, image, BASE, WORDS, NULL), "detect failed");
+    r = range_at (&map, 32);
+    CHECK (r && r->addr == BASE + 128 && r->size == 8 && r->reasons == LIBARCH_DATAMAP_JUMPTABLE, "jump table");
+    CHECK (map.len == 1, "%zu ranges", map.len);
+    libarch_datamap_free (&map);
+}
+
+static void
+test_format (void)
+{
+    char buf[LIBARCH_FORMAT_MAX_LEN];
+
+    libarch_format_data (NULL, 0x12345678, 4, buf, sizeof (buf));
+    CHECK (!strcmp (buf, ".word\t0x12345678"), "got \"%s\"", buf);
+
+    libarch_format_data (NULL, 0xfffffff007004000ULL, 8, buf, sizeof (buf));
+    CHECK (!strcmp (buf, ".quad\t0xfffffff007004000"), "got \"%s\"", buf);
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("datamap-test\n");
+
+    test_detect ();
+    test_descent ();
+    test_jumptable ();
+    test_format ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
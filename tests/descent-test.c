@@ -0,0 +1,174 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <descent.h>
+#include <symbol.h>
+
+#include "test.h"
+
+/**
+ *  Recursive-descent tests. A small hand-built image checks which words are
+ *  found as code and which as function starts, and a large random image is
+ *  descended with one thread and with several, which must find exactly the
+ *  same code, as the result doesn't depend on the order blocks are run in.
+ */
+
+#define BASE            0xfffffff007004000ULL
+
+static const uint32_t image[] =
+{
+    /* func_a, the entry point */
+    0xa9bf7bfd,         /*  0: stp  x29, x30, [sp, #-16]! */
+    0x94000007,         /*  1: bl   func_b */
+    0xb4000060,         /*  2: cbz  x0, 5 */
+    0x58000121,         /*  3: ldr  x1, literal at 12 */
+    0x14000002,         /*  4: b    6 */
+    0xd503201f,         /*  5: nop */
+    0xa8c17bfd,         /*  6: ldp  x29, x30, [sp], #16 */
+    0xd65f03c0,         /*  7: ret */
+
+    /* func_b, only called */
+    0xd2800020,         /*  8: mov  x0, #1 */
+    0xd65f03c0,         /*  9: ret */
+
+    /* Padding and a literal pool */
+    0x00000000,         /* 10: udf  #0 */
+    0xd503201f,         /* 11: nop */
+    0xdeadbeef,         /* 12 */
+    0x12345678,         /* 13 */
+
+    /* func_c, only a symbol */
+    0x54000040,         /* 14: b.eq 16 */
+    0xd4200000,         /* 15: brk  #0 */
+    0x97ffff8c,         /* 16: bl   outside the image */
+    0xd63f0100,         /* 17: blr  x8 */
+    0xd61f0120,         /* 18: br   x9 */
+    0xd503201f,         /* 19: nop */
+};
+
+#define IMAGE_LEN       (sizeof (image) / sizeof (image[0]))
+
+static void
+check_bits (const libarch_descent_t *d, const char *code, const char *functions, const char *what)
+{
+    for (size_t i = 0; i < IMAGE_LEN; i++) {
+        CHECK (libarch_descent_is_code (d, BASE + i * 4) == (code[i] == '1'),
+            "%s: word %zu code %d", what, i, libarch_descent_is_code (d, BASE + i * 4));
+        CHECK (libarch_descent_is_function (d, BASE + i * 4) == (functions[i] == '1'),
+            "%s: word %zu function %d", what, i, libarch_descent_is_function (d, BASE + i * 4));
+    }
+}
+
+static void
+test_image (unsigned threads)
+{
+    libarch_descent_t d;
+    libarch_symtab_t symtab;
+    uint64_t entry = BASE;
+    char what[32];
+
+    snprintf (what, sizeof (what), "%u threads", threads);
+
+    /* Only the entry point, then continue from the symbols */
+    CHECK (libarch_descent_init (&d, image, BASE, IMAGE_LEN), "%s: init", what);
+    CHECK (libarch_descent_run (&d, &entry, 1, NULL, threads), "%s: run", what);
+    check_bits (&d, "11111111110000000000", "10000000100000000000", what);
+    CHECK (d.instructions == 10 && d.function_count == 2, "%s: %zu instructions, %zu functions",
+        what, d.instructions, d.function_count);
+
+    libarch_symtab_init (&symtab);
+    libarch_symtab_add (&symtab, BASE + 14 * 4, 0, "func_c");
+    libarch_symtab_add (&symtab, BASE + 8 * 4, 0, "func_b");
+    libarch_symtab_add (&symtab, BASE - 0x1000, 0, "outside");
+    libarch_symtab_finalise (&symtab);
+
+    CHECK (libarch_descent_run (&d, NULL, 0, &symtab, threads), "%s: run symbols", what);
+    check_bits (&d, "11111111110000111110", "10000000100000100000", what);
+    CHECK (d.instructions == 15 && d.function_count == 3, "%s: %zu instructions, %zu functions",
+        what, d.instructions, d.function_count);
+
+    libarch_symtab_free (&symtab);
+    libarch_descent_free (&d);
+}
+
+static uint64_t rng_state = 0x2545f4914f6cdd1dULL;
+
+static uint32_t
+rng (void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t) rng_state;
+}
+
+static void
+test_random (void)
+{
+    size_t len = 1 << 20, nentries = 256;
+    uint32_t *words = malloc (len * sizeof (uint32_t));
+    uint64_t *entries = malloc (nentries * sizeof (uint64_t));
+    libarch_descent_t a, b;
+
+    /* Mostly nops, with short-range branches, calls, returns and junk */
+    for (size_t i = 0; i < len; i++) {
+        uint32_t r = rng (), off = (rng () % 4096) - 2048;
+        switch (r % 16) {
+            case 0:  words[i] = 0x94000000 | (off & 0x3ffffff); break;          /* bl */
+            case 1:  words[i] = 0x54000000 | ((off & 0x7ffff) << 5) | (r >> 28); break;  /* b.cond */
+            case 2:  words[i] = 0x14000000 | (off & 0x3ffffff); break;          /* b */
+            case 3:  words[i] = 0xb4000000 | ((off & 0x7ffff) << 5); break;     /* cbz */
+            case 4:  words[i] = 0xd65f03c0; break;                              /* ret */
+            case 5:  words[i] = rng (); break;
+            default: words[i] = 0xd503201f; break;                              /* nop */
+        }
+    }
+    for (size_t i = 0; i < nentries; i++)
+        entries[i] = BASE + (rng () % len) * 4;
+
+    CHECK (libarch_descent_init (&a, words, BASE, len) && libarch_descent_init (&b, words, BASE, len), "init");
+    CHECK (libarch_descent_run (&a, entries, nentries, NULL, 1), "run 1 thread");
+    CHECK (libarch_descent_run (&b, entries, nentries, NULL, 8), "run 8 threads");
+
+    CHECK (a.instructions == b.instructions && a.function_count == b.function_count,
+        "random: %zu/%zu instructions, %zu/%zu functions", a.instructions, b.instructions,
+        a.function_count, b.function_count);
+    CHECK (!memcmp (a.code, b.code, (len / 64) * sizeof (uint64_t)), "random: code bitmaps differ");
+    CHECK (!memcmp (a.functions, b.functions, (len / 64) * sizeof (uint64_t)), "random: function bitmaps differ");
+    printf ("    random: %zu instructions, %zu functions\n", a.instructions, a.function_count);
+
+    libarch_descent_free (&a);
+    libarch_descent_free (&b);
+    free (entries);
+    free (words);
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("descent-test\n");
+
+    test_image (1);
+    test_image (4);
+    test_random ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
@@ -0,0 +1,184 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <instruction.h>
+#include <function.h>
+
+#include "test.h"
+
+/**
+ *  Function hash tests. The same function, moved and with it's registers
+ *  allocated differently, must hash the same, and a real change must not.
+ */
+
+/* A small function with a loop, an indirect call and a direct call */
+static const uint32_t func_a[] = {
+    0xa9be7bfd,     // stp x29, x30, [sp, #-32]!
+    0x910003fd,     // mov x29, sp
+    0xf9000bf3,     // str x19, [sp, #16]
+    0xaa0003f3,     // mov x19, x0
+    0xb40000e0,     // cbz x0, 1f
+    0x90000028,     // adrp x8, #0x4000
+    0xf9409108,     // ldr x8, [x8, #0x120]
+    0xd63f0100,     // blr x8
+    0x91000673,     // 2: add x19, x19, #1
+    0xf1002a7f,     // cmp x19, #10
+    0x54ffffc1,     // b.ne 2b
+    0x94040000,     // 1: bl #0x100000
+    0xaa1303e0,     // mov x0, x19
+    0xf9400bf3,     // ldr x19, [sp, #16]
+    0xa8c27bfd,     // ldp x29, x30, [sp], #32
+    0xd65f03c0,     // ret
+};
+
+/* func_a with x20/x9 in place of x19/x8, and different pages and callee */
+static const uint32_t func_b[] = {
+    0xa9be7bfd, 0x910003fd, 0xf9000bf4, 0xaa0003f4, 0xb40000e0, 0xf0000029, 0xf9404529, 0xd63f0120,
+    0x91000694, 0xf1002a9f, 0x54ffffc1, 0x97fff800, 0xaa1403e0, 0xf9400bf4, 0xa8c27bfd, 0xd65f03c0,
+};
+
+/* func_a with the add in the loop changed to a sub */
+static const uint32_t func_c[] = {
+    0xa9be7bfd, 0x910003fd, 0xf9000bf3, 0xaa0003f3, 0xb40000e0, 0x90000028, 0xf9409108, 0xd63f0100,
+    0xd1000673, 0xf1002a7f, 0x54ffffc1, 0x94040000, 0xaa1303e0, 0xf9400bf3, 0xa8c27bfd, 0xd65f03c0,
+};
+
+#define FUNC(_code, _addr)      { _code, _addr, sizeof (_code) / sizeof (*_code) }
+
+static void
+test_hash (void)
+{
+    libarch_function_t a = FUNC (func_a, 0xfffffff007004000);
+    libarch_function_t b = FUNC (func_b, 0xfffffff007a81230);
+    libarch_function_t c = FUNC (func_c, 0xfffffff007004000);
+    libarch_function_hash_t ha, hb, hc, hd;
+
+    CHECK (libarch_function_hash (NULL, &a, &ha), "failed to hash func_a");
+    CHECK (libarch_function_hash (NULL, &b, &hb), "failed to hash func_b");
+    CHECK (libarch_function_hash (NULL, &c, &hc), "failed to hash func_c");
+
+    CHECK (ha.hash == hb.hash, "moved function hashed differently, 0x%llx 0x%llx",
+        (unsigned long long) ha.hash, (unsigned long long) hb.hash);
+    CHECK (ha.hash != hc.hash, "changed function hashed the same");
+
+    /* entry, cbz, loop, call/exit */
+    CHECK (ha.instructions == 16 && ha.blocks == 4 && ha.calls == 2 && ha.edges == 5,
+        "func_a has %u instructions, %u blocks, %u edges, %u calls",
+        ha.instructions, ha.blocks, ha.edges, ha.calls);
+
+    /* Hashing already decoded instructions gives the same result */
+    instruction_t *instrs[16];
+    for (int i = 0; i < 16; i++) {
+        instrs[i] = libarch_instruction_create (func_a[i], a.addr + i * 4);
+        libarch_disass (&instrs[i]);
+    }
+    CHECK (libarch_function_hash_instructions (instrs, 16, &hd) && !memcmp (&ha, &hd, sizeof (ha)),
+        "decoded hash doesn't match");
+    for (int i = 0; i < 16; i++) libarch_instruction_free (instrs[i]);
+
+    libarch_function_t empty = { func_a, 0, 0 };
+    CHECK (!libarch_function_hash (NULL, &empty, &hd), "empty function hashed");
+}
+
+/**
+ *  Build `count` functions that hash differently: function i is i loop
+ *  blocks, and each loop block is one to three adds.
+ */
+static uint32_t *
+build_functions (size_t count, uint64_t base, libarch_function_t *funcs, size_t *order)
+{
+    size_t total = 0, off = 0;
+    for (size_t i = 0; i < count; i++) total += 4 * (i % 64 + 1) + 1;
+
+    uint32_t *code = calloc (total, sizeof (uint32_t));
+    for (size_t n = 0; n < count; n++) {
+        size_t i = order[n];
+        size_t start = off;
+        for (size_t j = 0; j <= i % 64; j++) {
+            unsigned adds = (unsigned) ((i / 64 + j) % 3) + 1;
+            for (unsigned k = 0; k < adds; k++) code[off++] = 0x91000673;       // add x19, x19, #1
+            code[off] = 0x54000001 | ((uint32_t) (-(int) adds & 0x7ffff) << 5); // b.ne <first add>
+            off++;
+        }
+        code[off++] = 0xd65f03c0;                                               // ret
+        funcs[n].code = &code[start];
+        funcs[n].addr = base + start * 4;
+        funcs[n].len = off - start;
+    }
+    return code;
+}
+
+static void
+test_parallel_match (void)
+{
+    const size_t count = 3 * 64;
+    libarch_function_t *fa = calloc (count, sizeof (libarch_function_t));
+    libarch_function_t *fb = calloc (count, sizeof (libarch_function_t));
+    libarch_function_hash_t *ha = calloc (count, sizeof (libarch_function_hash_t));
+    libarch_function_hash_t *hb = calloc (count, sizeof (libarch_function_hash_t));
+    libarch_function_hash_t serial;
+    libarch_function_match_t *matches = calloc (count, sizeof (libarch_function_match_t));
+    size_t *oa = calloc (count, sizeof (size_t));
+    size_t *ob = calloc (count, sizeof (size_t));
+
+    /* Image B has the same functions in reverse order, at another address */
+    for (size_t i = 0; i < count; i++) {
+        oa[i] = i;
+        ob[i] = count - 1 - i;
+    }
+    uint32_t *ca = build_functions (count, 0xfffffff007004000, fa, oa);
+    uint32_t *cb = build_functions (count, 0xfffffff008000000, fb, ob);
+
+    CHECK (libarch_function_hash_parallel (fa, count, ha, 4), "parallel hash failed");
+    CHECK (libarch_function_hash_parallel (fb, count, hb, 0), "parallel hash failed");
+
+    for (size_t i = 0; i < count; i++) {
+        libarch_function_hash (NULL, &fa[i], &serial);
+        CHECK (!memcmp (&serial, &ha[i], sizeof (serial)), "parallel hash of %zu doesn't match", i);
+    }
+
+    size_t n = libarch_function_hash_match (ha, count, hb, count, matches);
+    CHECK (n == count, "matched %zu of %zu functions", n, count);
+    for (size_t i = 0; i < n; i++)
+        CHECK (matches[i].b == count - 1 - matches[i].a, "function %zu matched %zu", matches[i].a, matches[i].b);
+
+    /* A hash that appears twice in A is ambiguous, so it isn't matched */
+    ha[1] = ha[0];
+    n = libarch_function_hash_match (ha, count, hb, count, matches);
+    CHECK (n == count - 2, "matched %zu functions with a duplicate", n);
+
+    free (ca); free (cb);
+    free (fa); free (fb);
+    free (ha); free (hb);
+    free (oa); free (ob);
+    free (matches);
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("function-test\n");
+
+    test_hash ();
+    test_parallel_match ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
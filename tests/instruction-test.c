@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <instruction.h>
+#include <format.h>
+
+#include "test.h"
+
+/**
+ *  Instruction record tests. A record that is reset and decoded again, or
+ *  taken from a context's cache, must match a freshly created one without
+ *  allocating.
+ */
+
+/* Allocator that counts calls, to check that reset records stop allocating */
+static size_t allocations = 0;
+
+static void *
+counting_alloc (size_t size)
+{
+    allocations++;
+    return malloc (size);
+}
+
+static void *
+counting_resize (void *ptr, size_t size)
+{
+    allocations++;
+    return realloc (ptr, size);
+}
+
+/* A reset record must decode exactly as a new one, without allocating */
+static void
+test_reset (void)
+{
+    uint32_t opcodes[] = {
+        0xa9bf7bfd, 0x910003fd, 0xd503201f, 0x4e208400,
+        0xf9400020, 0x54000040, 0x8b020020, 0xd65f03c0,
+    };
+    size_t len = sizeof (opcodes) / sizeof (*opcodes);
+    char expected[LIBARCH_FORMAT_MAX_LEN], buf[LIBARCH_FORMAT_MAX_LEN];
+    libarch_ctx_t ctx;
+
+    libarch_ctx_init (&ctx);
+    ctx.allocator.alloc = counting_alloc;
+    ctx.allocator.resize = counting_resize;
+
+    instruction_t *in = libarch_instruction_create_ctx (&ctx, 0, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        allocations = 0;
+
+        for (size_t i = 0; i < len; i++) {
+            instruction_t *fresh = libarch_instruction_create (opcodes[i], i * 4);
+            libarch_disass (&fresh);
+            libarch_format_instruction (NULL, fresh, expected, sizeof (expected));
+
+            libarch_instruction_reset (in, opcodes[i], i * 4);
+            libarch_disass_ctx (&ctx, &in);
+            libarch_format_instruction (&ctx, in, buf, sizeof (buf));
+
+            CHECK (!strcmp (buf, expected) && in->operands_len == fresh->operands_len &&
+                   in->fields_len == fresh->fields_len && in->type == fresh->type,
+                "0x%08x decoded to \"%s\" after a reset, not \"%s\"", opcodes[i], buf, expected);
+            libarch_instruction_free (fresh);
+        }
+        CHECK (pass == 0 || allocations == 0, "reset record made %zu allocations", allocations);
+    }
+
+    /* Records released to the context's cache keep their arrays too */
+    libarch_instruction_free (in);
+    allocations = 0;
+    in = libarch_instruction_create_ctx (&ctx, opcodes[0], 0);
+    libarch_disass_ctx (&ctx, &in);
+    CHECK (allocations == 0, "cached record made %zu allocations", allocations);
+
+    libarch_instruction_free (in);
+    libarch_ctx_cleanup (&ctx);
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("instruction-test\n");
+
+    test_reset ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
@@ -0,0 +1,247 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <instruction.h>
+#include <jumptable.h>
+#include <function.h>
+#include <descent.h>
+
+#include "test.h"
+
+/**
+ *  Jump table tests. Each image is a switch dispatch in one of the shapes
+ *  compilers emit, with it's cases, a default case at word 20, and the table
+ *  at word 32. The table is recovered from the decoded dispatch, and then
+ *  followed by the descent and the function hash.
+ */
+
+#define BASE            0x100000ULL
+#define WORDS           40
+#define RET             0xd65f03c0
+
+typedef struct jumptable_case_t
+{
+    const char         *name;
+    uint32_t            dispatch[8];
+    uint32_t            table[6];
+    size_t              targets[6];
+    libarch_jumptable_t expected;
+} jumptable_case_t;
+
+static const jumptable_case_t cases[] =
+{
+    {
+        "ldrb, adr base",
+        {
+            0x7100151f,     /* cmp   w8, #5 */
+            0x54000268,     /* b.hi  default */
+            0x90000009,     /* adrp  x9, table@PAGE */
+            0x91020129,     /* add   x9, x9, table@PAGEOFF */
+            0x1000008a,     /* adr   x10, case 0 */
+            0x3868692b,     /* ldrb  w11, [x9, x8] */
+            0x8b0b094a,     /* add   x10, x10, x11, lsl #2 */
+            0xd61f0140,     /* br    x10 */
+        },
+        { 0x02010005, 0x00000403 },
+        { 13, 8, 9, 10, 11, 12 },
+        { BASE + 0x1c, BASE + 0x80, BASE + 0x20, 6, 1, 2, 0 },
+    },
+    {
+        "ldrsw, table base",
+        {
+            0x71000c1f,     /* cmp   w0, #3 */
+            0x54000262,     /* b.hs  default */
+            0x2a0003e8,     /* mov   w8, w0 */
+            0x90000009,     /* adrp  x9, table@PAGE */
+            0x91020129,     /* add   x9, x9, table@PAGEOFF */
+            0xb8a8792a,     /* ldrsw x10, [x9, x8, lsl #2] */
+            0x8b0a012a,     /* add   x10, x9, x10 */
+            0xd61f0140,     /* br    x10 */
+        },
+        { 0xffffffa8, 0xffffffa0, 0xffffffa4 },
+        { 10, 8, 9 },
+        { BASE + 0x1c, BASE + 0x80, BASE + 0x80, 3, 4, 0, 1 },
+    },
+    {
+        "absolute, register bound",
+        {
+            0x5280004a,     /* mov   w10, #2 */
+            0x6b0a011f,     /* cmp   w8, w10 */
+            0x54000248,     /* b.hi  default */
+            0x100003a9,     /* adr   x9, table */
+            0xf8687928,     /* ldr   x8, [x9, x8, lsl #3] */
+            0xd61f0100,     /* br    x8 */
+            RET, RET,
+        },
+        { BASE + 0x18, 0, BASE + 0x20, 0, BASE + 0x1c, 0 },
+        { 6, 8, 7 },
+        { BASE + 0x14, BASE + 0x80, 0, 3, 8, 0, 0 },
+    },
+    {
+        "ldrb, sxtb add",
+        {
+            0x71000c1f,     /* cmp   w0, #3 */
+            0x54000268,     /* b.hi  default */
+            0x90000001,     /* adrp  x1, table@PAGE */
+            0x91020021,     /* add   x1, x1, table@PAGEOFF */
+            0x38604821,     /* ldrb  w1, [x1, w0, uxtw] */
+            0x100000e2,     /* adr   x2, base */
+            0x8b218841,     /* add   x1, x2, w1, sxtb #2 */
+            0xd61f0020,     /* br    x1 */
+        },
+        { 0xfcff0100 },
+        { 12, 13, 11, 8 },
+        { BASE + 0x1c, BASE + 0x80, BASE + 0x30, 4, 1, 2, 1 },
+    },
+};
+
+#define NCASES          (sizeof (cases) / sizeof (cases[0]))
+
+/* Lay out a case: dispatch, then returns for the cases and default, then the table */
+static void
+build_image (const jumptable_case_t *c, uint32_t *image)
+{
+    memset (image, 0, WORDS * sizeof (uint32_t));
+    memcpy (image, c->dispatch, sizeof (c->dispatch));
+    for (size_t i = 8; i < 16; i++) image[i] = RET;
+    image[20] = RET;
+    memcpy (image + 32, c->table, sizeof (c->table));
+}
+
+/* Decode the words up to and including `end` and recover the table */
+static libarch_return_t
+recover (const uint32_t *image, size_t end, libarch_jumptable_t *table)
+{
+    instruction_t *instrs[LIBARCH_JUMPTABLE_WINDOW];
+    libarch_return_t res;
+
+    for (size_t i = 0; i <= end; i++) {
+        instrs[i] = libarch_instruction_create (image[i], BASE + i * 4);
+        libarch_disass (&instrs[i]);
+    }
+    res = libarch_jumptable_recover (instrs, end + 1, table);
+    for (size_t i = 0; i <= end; i++) libarch_instruction_free (instrs[i]);
+    return res;
+}
+
+static void
+test_recover (void)
+{
+    uint32_t image[WORDS];
+
+    for (size_t n = 0; n < NCASES; n++) {
+        const jumptable_case_t *c = &cases[n];
+        const libarch_jumptable_t *e = &c->expected;
+        libarch_jumptable_t t;
+        uint64_t targets[8];
+        size_t end = (e->branch - BASE) / 4;
+
+        build_image (c, image);
+        if (!recover (image, end, &t)) {
+            CHECK (0, "%s: not recovered", c->name);
+            continue;
+        }
+
+        CHECK (t.branch == e->branch && t.table == e->table && t.base == e->base && t.count == e->count &&
+               t.entry_size == e->entry_size && t.shift == e->shift && t.is_signed == e->is_signed,
+            "%s: table 0x%llx, base 0x%llx, %u x %u bytes << %u, signed %u", c->name,
+            (unsigned long long) t.table, (unsigned long long) t.base, t.count, t.entry_size, t.shift, t.is_signed);
+
+        size_t got = libarch_jumptable_targets (&t, image, BASE, WORDS, targets, 8);
+        CHECK (got == t.count, "%s: %zu targets", c->name, got);
+        for (size_t i = 0; i < got; i++)
+            CHECK (targets[i] == BASE + c->targets[i] * 4, "%s: target %zu is 0x%llx", c->name, i,
+                (unsigned long long) targets[i]);
+
+        /* A table running off the end of the image is cut short */
+        CHECK (libarch_jumptable_targets (&t, image, BASE, 32, targets, 8) == 0, "%s: read past the image", c->name);
+    }
+
+    /* Without the bound, or with the bound on another path, there's no table */
+    build_image (&cases[0], image);
+    image[0] = 0xd503201f;
+    CHECK (!recover (image, 7, &(libarch_jumptable_t) { 0 }), "recovered without a bound");
+
+    build_image (&cases[0], image);
+    image[1] = RET;
+    CHECK (!recover (image, 7, &(libarch_jumptable_t) { 0 }), "recovered across a ret");
+
+    /* The index changed after the bounds check */
+    build_image (&cases[0], image);
+    image[2] = 0x11000508;          /* add w8, w8, #1 */
+    CHECK (!recover (image, 7, &(libarch_jumptable_t) { 0 }), "recovered with a changed index");
+}
+
+static void
+test_follow (void)
+{
+    uint32_t image[WORDS];
+
+    for (size_t n = 0; n < NCASES; n++) {
+        const jumptable_case_t *c = &cases[n];
+        libarch_function_hash_t with, without;
+        libarch_descent_t d;
+        uint64_t entry = BASE;
+
+        build_image (c, image);
+
+        /* Every case is found, and only the cases */
+        CHECK (libarch_descent_init (&d, image, BASE, WORDS) && libarch_descent_run (&d, &entry, 1, NULL, 2),
+            "%s: descent failed", c->name);
+        CHECK (d.tables_len == 1 && d.tables[0].table == c->expected.table, "%s: %zu tables", c->name, d.tables_len);
+        for (size_t i = 8; i < 16; i++) {
+            int is_case = 0;
+            for (size_t k = 0; k < c->expected.count; k++) is_case |= (c->targets[k] == i);
+            if (i < (c->expected.branch - BASE) / 4 + 1) continue;
+            CHECK (libarch_descent_is_code (&d, BASE + i * 4) == is_case, "%s: word %zu", c->name, i);
+        }
+        libarch_descent_free (&d);
+
+        /* The table is outside the function, so it's only read with the image */
+        libarch_function_t f = { image, BASE, 21 };
+        CHECK (libarch_function_hash (NULL, &f, &without), "%s: hash failed", c->name);
+        f.image = image;
+        f.image_addr = BASE;
+        f.image_len = WORDS;
+        CHECK (libarch_function_hash (NULL, &f, &with), "%s: hash failed", c->name);
+
+        /* One edge to each distinct case */
+        size_t distinct = 0;
+        for (size_t k = 0; k < c->expected.count; k++) {
+            int seen = 0;
+            for (size_t j = 0; j < k; j++) seen |= (c->targets[j] == c->targets[k]);
+            distinct += !seen;
+        }
+        CHECK (with.edges == without.edges + distinct && with.hash != without.hash,
+            "%s: %u edges with the table, %u without", c->name, with.edges, without.edges);
+    }
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("jumptable-test\n");
+
+    test_recover ();
+    test_follow ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
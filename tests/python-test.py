@@ -0,0 +1,86 @@
+##===----------------------------------------------------------------------===//
+##
+##                         === The LIBARCH Project ===
+##
+##  This  document  is the property of "Is This On?" It is considered to be
+##  confidential and proprietary and may not be, in any form, reproduced or
+##  transmitted, in whole or in part, without express permission of Is This
+##  On?.
+##
+##  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+##
+##  Harry Moulton <me@h3adsh0tzz.com>
+##
+##===----------------------------------------------------------------------===//
+
+import mmap
+import struct
+import sys
+import tempfile
+
+import libarch
+
+# stp x29, x30, [sp, #-16]!; mov x29, sp; add x0, x1, #16; ldr x0, [x0]; ret
+WORDS = [0xa9bf7bfd, 0x910003fd, 0x91004020, 0xf9400000, 0xd65f03c0]
+CODE = struct.pack("<%dI" % len(WORDS), *WORDS)
+ADDR = 0xfffffff007004000
+
+failures = 0
+
+def check(cond, msg):
+    global failures
+    if not cond:
+        print("FAIL: " + msg)
+        failures += 1
+
+def check_columns(cols, words, addr):
+    check(len(cols["addr"]) == len(words), "instruction count")
+    check(len(cols["operand_start"]) == len(words) + 1, "operand_start length")
+    check(len(cols["op_type"]) == cols["operand_start"][len(words)], "operand count")
+    for i, w in enumerate(words):
+        check(cols["addr"][i] == addr + i * 4, "addr %d" % i)
+        check(cols["opcode"][i] == w, "opcode %d" % i)
+        check(cols["status"][i] == libarch.DECODE_STATUS_SUCCESS, "status %d" % i)
+
+# bytes
+cols = libarch.decode(CODE, ADDR)
+check_columns(cols, WORDS, ADDR)
+check(libarch.mnemonic(cols["type"][0]) == "stp", "mnemonic of stp")
+check(libarch.mnemonic(cols["type"][4]) == "ret", "mnemonic of ret")
+
+# add x0, x1, #16: register, register, immediate
+s, e = cols["operand_start"][2], cols["operand_start"][3]
+check(e - s == 3, "add operand count")
+check([cols["op_type"][j] for j in range(s, e)] ==
+      [libarch.OPERAND_TYPE_REGISTER, libarch.OPERAND_TYPE_REGISTER, libarch.OPERAND_TYPE_IMMEDIATE],
+      "add operand types")
+check(cols["op_reg"][s + 1] == 1, "add source register")
+check(cols["op_value"][s + 2] == 16, "add immediate")
+
+# Zero-copy views: a memoryview slice and an mmap
+check_columns(libarch.decode(memoryview(CODE)[4:12], ADDR + 4), WORDS[1:3], ADDR + 4)
+
+with tempfile.TemporaryFile() as f:
+    f.write(CODE + b"\x00\x01")
+    f.flush()
+    with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as m:
+        check_columns(libarch.decode(m, ADDR), WORDS, ADDR)
+
+# Columns are read-only
+try:
+    memoryview(libarch._libarch.decode(CODE)["opcode"])[0] = 0
+    check(False, "column is writable")
+except TypeError:
+    pass
+
+check(libarch.disassemble(CODE[:4])[0].startswith("stp"), "disassemble")
+check(len(libarch.decode(b"")["addr"]) == 0, "empty buffer")
+
+try:
+    libarch.decode(12345)
+    check(False, "decode accepted a non-buffer")
+except TypeError:
+    pass
+
+print("%d failures" % failures)
+sys.exit(1 if failures else 0)
@@ -0,0 +1,214 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <instruction.h>
+#include <format.h>
+#include <symbol.h>
+
+#include "test.h"
+
+/**
+ *  Symbol table tests. Lookups in a random table are compared against a
+ *  linear scan, both at random addresses and sweeping forward as a listing
+ *  would, and the formatter is checked for naming each kind of target.
+ */
+
+#define NSYMBOLS        5000
+
+typedef struct ref_symbol_t
+{
+    uint64_t            addr;
+    uint64_t            size;
+    char                name[16];
+} ref_symbol_t;
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t
+rng (void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/* The symbol containing `addr` by linear scan, the first added at the highest address */
+static const ref_symbol_t *
+ref_lookup (const ref_symbol_t *ref, size_t n, uint64_t addr)
+{
+    const ref_symbol_t *best = NULL;
+
+    for (size_t i = 0; i < n; i++) {
+        if (ref[i].addr > addr) continue;
+        if (!best || ref[i].addr > best->addr) best = &ref[i];
+    }
+    if (!best) return NULL;
+
+    /* A symbol without a size extends up to the next one */
+    if (best->size && addr - best->addr >= best->size) return NULL;
+    return best;
+}
+
+static void
+check_lookup (const libarch_symtab_t *symtab, const ref_symbol_t *ref, size_t n, uint64_t addr)
+{
+    const ref_symbol_t *want = ref_lookup (ref, n, addr);
+    uint64_t offset = ~0ULL;
+    const libarch_symbol_t *got = libarch_symtab_lookup (symtab, addr, &offset);
+
+    if (!want) {
+        CHECK (!got, "0x%llx: found %s, expected none", (unsigned long long) addr, got->name);
+        return;
+    }
+    CHECK (got && !strcmp (got->name, want->name) && offset == addr - want->addr,
+        "0x%llx: found %s+%llu, expected %s+%llu", (unsigned long long) addr,
+        (got) ? got->name : "none", (unsigned long long) offset, want->name,
+        (unsigned long long) (addr - want->addr));
+}
+
+static void
+test_lookup (void)
+{
+    ref_symbol_t *ref = malloc (NSYMBOLS * sizeof (ref_symbol_t));
+    libarch_symtab_t symtab;
+    uint64_t lo = 0x10000, hi = lo + NSYMBOLS * 0x100;
+
+    libarch_symtab_init (&symtab);
+    CHECK (!libarch_symtab_lookup (&symtab, lo, NULL), "lookup in an empty table");
+
+    /* Some sizes are zero, some names repeat, and some addresses are shared */
+    for (size_t i = 0; i < NSYMBOLS; i++) {
+        ref[i].addr = (i % 50 == 49) ? ref[i - 1].addr : lo + (rng () % (hi - lo)) / 4 * 4;
+        ref[i].size = (rng () % 3) ? (rng () % 0x200) : 0;
+        snprintf (ref[i].name, sizeof (ref[i].name), "sym_%zu", (i % 7 == 0) ? i / 7 : i);
+        CHECK (libarch_symtab_add (&symtab, ref[i].addr, ref[i].size, ref[i].name), "add %zu", i);
+    }
+
+    /* The first symbol added at an address is kept, so drop the rest */
+    for (size_t i = 0; i < NSYMBOLS; i++)
+        for (size_t j = 0; j < i; j++)
+            if (ref[j].addr == ref[i].addr) { ref[i].addr = ~0ULL; break; }
+
+    CHECK (libarch_symtab_finalise (&symtab), "finalise");
+    CHECK (!libarch_symtab_lookup (&symtab, 0, NULL), "lookup below every symbol");
+
+    for (int i = 0; i < 20000; i++)
+        check_lookup (&symtab, ref, NSYMBOLS, lo - 0x100 + rng () % (hi - lo + 0x400));
+    for (uint64_t addr = lo - 8; addr < lo + 0x8000; addr += 4)
+        check_lookup (&symtab, ref, NSYMBOLS, addr);
+
+    /* Equal names are interned to one string */
+    const libarch_symbol_t *a = libarch_symtab_lookup (&symtab, ref[1].addr, NULL);
+    const libarch_symbol_t *b = libarch_symtab_lookup (&symtab, ref[7].addr, NULL);
+    CHECK (a && b && (a->name == b->name || ref[1].addr == ~0ULL || ref[7].addr == ~0ULL),
+        "names not interned");
+
+    /* Adding to a finalised table, then finalising again */
+    CHECK (libarch_symtab_add (&symtab, 0x100, 0x10, "sym_low"), "add after finalise");
+    CHECK (libarch_symtab_finalise (&symtab), "finalise again");
+
+    uint64_t offset;
+    a = libarch_symtab_lookup (&symtab, 0x108, &offset);
+    CHECK (a && !strcmp (a->name, "sym_low") && offset == 8, "lookup after adding");
+    check_lookup (&symtab, ref, NSYMBOLS, ref[1].addr + 4);
+
+    libarch_symtab_free (&symtab);
+    free (ref);
+}
+
+/* Names of symbols dropped by finalising stay interned, so the hash has to grow */
+static void
+test_reinsert (void)
+{
+    libarch_symtab_t symtab;
+    char name[32];
+
+    libarch_symtab_init (&symtab);
+    for (int round = 0; round < 4; round++) {
+        for (int i = 0; i < 800; i++) {
+            snprintf (name, sizeof (name), "dup_%d_%d", round, i);
+            CHECK (libarch_symtab_add (&symtab, 0x1000, 0, name), "add %s", name);
+        }
+        CHECK (libarch_symtab_finalise (&symtab), "finalise round %d", round);
+    }
+
+    const libarch_symbol_t *sym = libarch_symtab_lookup (&symtab, 0x1000, NULL);
+    CHECK (sym && !strcmp (sym->name, "dup_0_0"), "first symbol kept");
+    libarch_symtab_free (&symtab);
+}
+
+static void
+check_format (libarch_ctx_t *ctx, uint32_t opcode, uint64_t addr, const char *expected)
+{
+    char buf[LIBARCH_FORMAT_MAX_LEN];
+    instruction_t *instr = libarch_instruction_create_ctx (ctx, opcode, addr);
+
+    libarch_disass_ctx (ctx, &instr);
+    libarch_format_instruction (ctx, instr, buf, sizeof (buf));
+    CHECK (!strcmp (buf, expected), "0x%08x: \"%s\", expected \"%s\"", opcode, buf, expected);
+    libarch_instruction_free (instr);
+}
+
+static void
+test_format (void)
+{
+    libarch_symtab_t symtab;
+    libarch_ctx_t ctx;
+
+    libarch_symtab_init (&symtab);
+    libarch_symtab_add (&symtab, 0x1000, 0, "_start");
+    libarch_symtab_add (&symtab, 0x2000, 0x40, "func");
+    libarch_symtab_add (&symtab, 0x4000, 0, "data");
+    libarch_symtab_finalise (&symtab);
+
+    libarch_ctx_init (&ctx);
+    ctx.symbolizer = libarch_symtab_symbolize;
+    ctx.symbolizer_arg = &symtab;
+
+    check_format (&ctx, 0x94000400, 0x1000, "bl\t0x2000 <func>");
+    check_format (&ctx, 0x17fffffe, 0x1010, "b\t0x1008 <_start+0x8>");
+    check_format (&ctx, 0x54000080, 0x2000, "b.eq\t0x2010 <func+0x10>");
+    check_format (&ctx, 0xb4000200, 0x2000, "cbz\tx0, 0x2040");
+    check_format (&ctx, 0x36000100, 0x2000, "tbz\tw0, 0x0, 0x2020 <func+0x20>");
+    check_format (&ctx, 0x10010000, 0x2000, "adr\tx0, 0x4000 <data>");
+    check_format (&ctx, 0x58010040, 0x2000, "ldr\tx0, 0x4008 <data+0x8>");
+    check_format (&ctx, 0xd2840000, 0x1000, "mov\tx0, 8192");
+
+    /* No symbolizer, no names */
+    ctx.symbolizer = NULL;
+    check_format (&ctx, 0x94000400, 0x1000, "bl\t0x2000");
+
+    libarch_ctx_cleanup (&ctx);
+    libarch_symtab_free (&symtab);
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("symbol-test\n");
+
+    test_lookup ();
+    test_reinsert ();
+    test_format ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
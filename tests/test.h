@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+//
+//                       === Libarch Disassembler ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBARCH_TEST_H__
+#define __LIBARCH_TEST_H__
+
+#include <stdio.h>
+
+/**
+ *  Shared by the unit tests. Each test counts it's failed checks, prints them
+ *  as they happen, and returns non-zero from main if there were any.
+ */
+
+static int failures = 0;
+
+#define CHECK(_cond, ...)                                   \
+    do {                                                    \
+        if (!(_cond)) {                                     \
+            printf ("    FAIL: " __VA_ARGS__);              \
+            printf ("\n");                                  \
+            failures++;                                     \
+        }                                                   \
+    } while (0)
+
+#endif /* __libarch_test_h__ */
@@ -0,0 +1,278 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libarch.h>
+
+#include <instruction.h>
+#include <assembler.h>
+#include <tracker.h>
+
+#include "test.h"
+
+/**
+ *  Register value tracker tests. Single instructions are checked against known
+ *  results with a fixed set of register values, and short sequences check the
+ *  events produced for constants and indirect branches.
+ */
+
+#define BASE_ADDR       0x100000
+
+/* Decode `len` opcodes starting at BASE_ADDR */
+static instruction_t **
+decode (const uint32_t *opcodes, size_t len)
+{
+    instruction_t **instrs = calloc (len, sizeof (instruction_t *));
+    for (size_t i = 0; i < len; i++) {
+        instrs[i] = libarch_instruction_create (opcodes[i], BASE_ADDR + i * 4);
+        libarch_disass (&instrs[i]);
+    }
+    return instrs;
+}
+
+static void
+release (instruction_t **instrs, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+        libarch_instruction_free (instrs[i]);
+    free (instrs);
+}
+
+/* x1, x2 and x3 are seeded with these, and the stack pointer with 0x7ff0 */
+#define X1              0x0123456789abcdefULL
+#define X2              0xfedcba9876543210ULL
+#define X3              5
+
+static void
+test_instructions (void)
+{
+    static const struct {
+        uint32_t    opcode;
+        int         reg;
+        uint64_t    value;
+    } tests[] = {
+        { 0xd2a24680,  0, 0x0000000012340000ULL },  // movz x0, #0x1234, lsl #16
+        { 0x92824680,  0, 0xffffffffffffedcbULL },  // movn x0, #0x1234
+        { 0x12824680,  0, 0x00000000ffffedcbULL },  // movn w0, #0x1234
+        { 0xf2d7dde1,  1, 0x0123beef89abcdefULL },  // movk x1, #0xbeef, lsl #32
+        { 0xb2089fe0,  0, 0xff00ff00ff00ff00ULL },  // orr x0, xzr, #0xff00ff00ff00ff00
+        { 0x927c2c20,  0, 0x000000000000cde0ULL },  // and x0, x1, #0xfff0
+        { 0x52010440,  0, 0x00000000f6543211ULL },  // eor w0, w2, #0x80000001
+        { 0x91448c20,  0, 0x0123456789bdfdefULL },  // add x0, x1, #0x123, lsl #12
+        { 0x71001860,  0, 0x00000000ffffffffULL },  // subs w0, w3, #6
+        { 0x8b020c20,  0, 0xf8091a2b3c4d5e6fULL },  // add x0, x1, x2, lsl #3
+        { 0x4b821c20,  0, 0x0000000088bf258bULL },  // sub w0, w1, w2, asr #7
+        { 0xcb42f020,  0, 0x0123456789abcde0ULL },  // sub x0, x1, x2, lsr #60
+        { 0x8b22c820,  0, 0x0123456962fc962fULL },  // add x0, x1, w2, sxtw #2
+        { 0x8b221020,  0, 0x0123456789abceefULL },  // add x0, x1, w2, uxtb #4
+        { 0xaae23020,  0, 0xdff35777dffbdfffULL },  // orn x0, x1, x2, ror #12
+        { 0x0a220020,  0, 0x0000000089abcdefULL },  // bic w0, w1, w2
+        { 0xca220420,  0, 0x0365cfa89afc5630ULL },  // eon x0, x1, x2, lsl #1
+        { 0xaa2203e0,  0, 0x0123456789abcdefULL },  // mvn x0, x2
+        { 0xaa0103e0,  0, 0x0123456789abcdefULL },  // mov x0, x1
+        { 0xd373c820,  0, 0x68acf13579bde000ULL },  // lsl x0, x1, #13
+        { 0x53097c40,  0, 0x00000000003b2a19ULL },  // lsr w0, w2, #9
+        { 0x9351fc40,  0, 0xffffff6e5d4c3b2aULL },  // asr x0, x2, #17
+        { 0x13057c40,  0, 0x0000000003b2a190ULL },  // asr w0, w2, #5
+        { 0xd3486c20,  0, 0x000000000009abcdULL },  // ubfx x0, x1, #8, #20
+        { 0x937cfc40,  0, 0xffffffffffffffffULL },  // sbfx x0, x2, #60, #4
+        { 0x93782c40,  0, 0x0000000000021000ULL },  // sbfiz x0, x2, #8, #12
+        { 0x531d1820,  0, 0x0000000000000378ULL },  // ubfiz w0, w1, #3, #7
+        { 0xb3701c41,  1, 0x012345678910cdefULL },  // bfi x1, x2, #16, #8
+        { 0x33043c41,  1, 0x0000000089abc321ULL },  // bfxil w1, w2, #4, #12
+        { 0x93401c20,  0, 0xffffffffffffffefULL },  // sxtb x0, w1
+        { 0x13003c40,  0, 0x0000000000003210ULL },  // sxth w0, w2
+        { 0x93407c40,  0, 0x0000000076543210ULL },  // sxtw x0, w2
+        { 0x53001c20,  0, 0x00000000000000efULL },  // uxtb w0, w1
+        { 0x93c25020,  0, 0xbcdeffedcba98765ULL },  // extr x0, x1, x2, #20
+        { 0x13811c20,  0, 0x00000000df13579bULL },  // ror w0, w1, #7
+        { 0x9ac30820,  0, 0x003a4114b5225c63ULL },  // udiv x0, x1, x3
+        { 0x9ac30c40,  0, 0xffc5beeb4adda39dULL },  // sdiv x0, x2, x3
+        { 0x1ac30c40,  0, 0x0000000017aa7069ULL },  // sdiv w0, w2, w3
+        { 0x9adf0820,  0, 0x0000000000000000ULL },  // udiv x0, x1, xzr
+        { 0x9ac32020,  0, 0x2468acf13579bde0ULL },  // lslv x0, x1, x3
+        { 0x1ac32840,  0, 0x0000000003b2a190ULL },  // asrv w0, w2, w3
+        { 0x9ac32c20,  0, 0x78091a2b3c4d5e6fULL },  // rorv x0, x1, x3
+        { 0xdac00020,  0, 0xf7b3d591e6a2c480ULL },  // rbit x0, x1
+        { 0x5ac00020,  0, 0x00000000f7b3d591ULL },  // rbit w0, w1
+        { 0xdac00c20,  0, 0xefcdab8967452301ULL },  // rev x0, x1
+        { 0x5ac00820,  0, 0x00000000efcdab89ULL },  // rev w0, w1
+        { 0xdac00820,  0, 0x67452301efcdab89ULL },  // rev32 x0, x1
+        { 0xdac00420,  0, 0x23016745ab89efcdULL },  // rev16 x0, x1
+        { 0xdac01020,  0, 0x0000000000000007ULL },  // clz x0, x1
+        { 0x5ac01060,  0, 0x000000000000001dULL },  // clz w0, w3
+        { 0xdac01440,  0, 0x0000000000000006ULL },  // cls x0, x2
+        { 0x5ac01460,  0, 0x000000000000001cULL },  // cls w0, w3
+        { 0x9b020c20,  0, 0x2236d88fe5618cf5ULL },  // madd x0, x1, x2, x3
+        { 0x1b028c20,  0, 0x000000001a9e7315ULL },  // msub w0, w1, w2, w3
+        { 0x9b227c20,  0, 0xc94e4627e5618cf0ULL },  // smull x0, w1, w2
+        { 0x9ba20c20,  0, 0x3fa27837e5618cf5ULL },  // umaddl x0, w1, w2, x3
+        { 0x9b427c20,  0, 0xfffeb49923cc0953ULL },  // smulh x0, x1, x2
+        { 0x9bc27c20,  0, 0x0121fa00ad77d742ULL },  // umulh x0, x1, x2
+        { 0x9a810020,  0, 0x0123456789abcdefULL },  // csel x0, x1, x1, eq
+        { 0x10ffff80,  0, 0x00000000000ffff0ULL },  // adr x0, #-0x10
+        { 0xf0000000,  0, 0x0000000000103000ULL },  // adrp x0, #0x3000
+        { 0xd0ffffe0,  0, 0x00000000000fe000ULL },  // adrp x0, #-0x2000
+        { 0x9100403f, 31, 0x0123456789abcdffULL },  // add sp, x1, #0x10
+        { 0x910003e0,  0, 0x0000000000007ff0ULL },  // mov x0, sp
+    };
+
+    for (size_t i = 0; i < sizeof (tests) / sizeof (*tests); i++) {
+        libarch_tracker_t tracker;
+        libarch_tracker_event_t ev;
+        instruction_t **in = decode (&tests[i].opcode, 1);
+
+        libarch_tracker_init (&tracker);
+        libarch_tracker_set (&tracker, 1, X1);
+        libarch_tracker_set (&tracker, 2, X2);
+        libarch_tracker_set (&tracker, 3, X3);
+        libarch_tracker_set (&tracker, LIBARCH_TRACKER_REG_SP, 0x7ff0);
+
+        CHECK (libarch_tracker_step (&tracker, in[0], &ev), "0x%08x produced no event", tests[i].opcode);
+        CHECK (ev.type == LIBARCH_TRACKER_EVENT_CONSTANT && ev.reg == tests[i].reg && ev.value == tests[i].value,
+            "0x%08x wrote x%d = 0x%llx, expected x%d = 0x%llx", tests[i].opcode, ev.reg,
+            (unsigned long long) ev.value, tests[i].reg, (unsigned long long) tests[i].value);
+        release (in, 1);
+    }
+}
+
+static void
+test_branches (void)
+{
+    static const uint32_t opcodes[] = {
+        0xb0000030,     // adrp x16, 0x105000
+        0x91048e10,     // add x16, x16, #0x123
+        0xd61f0200,     // br x16
+        0xd2880008,     // mov x8, #0x4000
+        0xf2bffe08,     // movk x8, #0xfff0, lsl #16
+        0xf2dfffe8,     // movk x8, #0xffff, lsl #32
+        0xd63f0100,     // blr x8
+        0xf9400200,     // ldr x0, [x16]
+        0xaa0003e9,     // mov x9, x0
+        0xd61f0120,     // br x9
+    };
+    const size_t len = sizeof (opcodes) / sizeof (*opcodes);
+    libarch_tracker_event_t events[8];
+    libarch_tracker_t tracker;
+    uint64_t value;
+
+    instruction_t **instrs = decode (opcodes, len);
+    libarch_tracker_init (&tracker);
+    size_t count = libarch_tracker_run (&tracker, instrs, len, events, 8);
+
+    CHECK (count == 4, "branch sequence produced %zu events", count);
+    if (count == 4) {
+        CHECK (events[0].type == LIBARCH_TRACKER_EVENT_CONSTANT && events[0].reg == 16 &&
+            events[0].value == 0x105123 && events[0].addr == BASE_ADDR + 4, "adrp/add folded incorrectly");
+        CHECK (events[1].type == LIBARCH_TRACKER_EVENT_BRANCH_TARGET && events[1].value == 0x105123,
+            "br x16 resolved to 0x%llx", (unsigned long long) events[1].value);
+        CHECK (events[2].type == LIBARCH_TRACKER_EVENT_CONSTANT && events[2].reg == 8 &&
+            events[2].value == 0xfffffff04000ULL && events[2].addr == BASE_ADDR + 20, "mov/movk folded incorrectly");
+        CHECK (events[3].type == LIBARCH_TRACKER_EVENT_BRANCH_TARGET && events[3].value == 0xfffffff04000ULL,
+            "blr x8 resolved to 0x%llx", (unsigned long long) events[3].value);
+    }
+
+    /* The call clobbers x16 and sets the link register */
+    CHECK (!libarch_tracker_get (&tracker, 16, &value), "x16 survived a call");
+    CHECK (libarch_tracker_get (&tracker, 30, &value) && value == BASE_ADDR + 28, "link register not set by blr");
+
+    /* A short array still reports the full count */
+    libarch_tracker_init (&tracker);
+    CHECK (libarch_tracker_run (&tracker, instrs, len, events, 1) == 4, "event count truncated");
+
+    release (instrs, len);
+}
+
+static void
+test_move_immediate (void)
+{
+    uint64_t seed = 0x2545f4914f6cdd1d;
+
+    for (int i = 0; i < 1024; i++) {
+        uint32_t opcodes[LIBARCH_ASSEMBLE_MOVE_MAX_LEN];
+        libarch_tracker_event_t ev;
+        libarch_tracker_t tracker;
+
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        size_t len = libarch_assemble_move_immediate (7, 64, seed, opcodes);
+        instruction_t **instrs = decode (opcodes, len);
+
+        libarch_tracker_init (&tracker);
+        size_t count = libarch_tracker_run (&tracker, instrs, len, &ev, 1);
+        CHECK (count == 1 && ev.reg == 7 && ev.value == seed, "load of 0x%llx produced %zu events, 0x%llx",
+            (unsigned long long) seed, count, (unsigned long long) ev.value);
+
+        release (instrs, len);
+    }
+}
+
+/* Loads and stores only forget the registers they write */
+static void
+test_loads (void)
+{
+    static const struct {
+        uint32_t    opcode;
+        uint32_t    clobbered;
+    } tests[] = {
+        { 0xf9400420, 0x1 },        // ldr x0, [x1, #8]
+        { 0xf8408c20, 0x3 },        // ldr x0, [x1, #8]!
+        { 0xf8408420, 0x3 },        // ldr x0, [x1], #8
+        { 0xf9000422, 0x0 },        // str x2, [x1, #8]
+        { 0xf9800020, 0x0 },        // prfm pldl1keep, [x1]
+        { 0x38636822, 0x4 },        // ldrb w2, [x1, x3]
+        { 0xa9400c22, 0xc },        // ldp x2, x3, [x1]
+        { 0xa9bf0c22, 0x2 },        // stp x2, x3, [x1, #-16]!
+        { 0x58000040, 0x1 },        // ldr x0, #8
+        { 0xc8037c22, 0x8 },        // stxr w3, x2, [x1]
+        { 0xc85f7c20, 0x1 },        // ldxr x0, [x1]
+        { 0xf8220023, 0x8 },        // ldadd x2, x3, [x1]
+        { 0x4cdf7020, 0x2 },        // ld1 {v0.16b}, [x1], #16
+        { 0x3dc00420, 0x0 },        // ldr q0, [x1, #16]
+    };
+
+    for (size_t i = 0; i < sizeof (tests) / sizeof (*tests); i++) {
+        instruction_t **in = decode (&tests[i].opcode, 1);
+        libarch_tracker_t tracker;
+        uint64_t value;
+
+        libarch_tracker_init (&tracker);
+        for (unsigned r = 0; r < 4; r++) libarch_tracker_set (&tracker, r, r);
+        libarch_tracker_step (&tracker, in[0], NULL);
+
+        for (unsigned r = 0; r < 4; r++)
+            CHECK (!libarch_tracker_get (&tracker, r, &value) == !!(tests[i].clobbered & (1U << r)),
+                "0x%08x: x%u %s", tests[i].opcode, r, (tests[i].clobbered & (1U << r)) ? "kept" : "forgotten");
+        release (in, 1);
+    }
+}
+
+int main (int argc, char *argv[])
+{
+    printf ("tracker-test\n");
+
+    test_instructions ();
+    test_branches ();
+    test_loads ();
+    test_move_immediate ();
+
+    printf ("    %d failures\n", failures);
+    return (failures) ? 1 : 0;
+}
@@ -0,0 +1,236 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2022, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#define BLUE            "\x1b[38;5;32m"
+#define RED             "\x1b[38;5;88m"
+#define RESET           "\x1b[0m"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <libarch.h>
+#include <libarch-version.h>
+
+#include "arm64/arm64-instructions.h"
+
+#include <instruction.h>
+#include <format.h>
+#include <corpus.h>
+
+/**
+ *  Decode throughput benchmark. Each corpus is a small set of instruction
+ *  words that is decoded, and then decoded and formatted, repeatedly so the
+ *  per-instruction cost of each decode group can be compared.
+ *
+ *  Any .arm64 corpus files given after the iteration count are loaded and
+ *  benchmarked as well, with the same total number of instructions as the
+ *  built-in corpora.
+ */
+
+typedef struct bench_corpus {
+    const char          *name;
+    const uint32_t      *words;
+    uint32_t             len;
+} bench_corpus_t;
+
+static const uint32_t corpus_common[] = {
+    0xa9bf7bfd,     /* stp      x29, x30, [sp, #-16]! */
+    0x910003fd,     /* mov      x29, sp */
+    0xd2800000,     /* mov      x0, #0 */
+    0x52800020,     /* mov      w0, #1 */
+    0xaa0103e0,     /* mov      x0, x1 */
+    0x8b020020,     /* add      x0, x1, x2 */
+    0xeb01001f,     /* cmp      x0, x1 */
+    0x1a9f07e0,     /* cset     w0, ne */
+    0xf9400000,     /* ldr      x0, [x0] */
+    0xb9400fe8,     /* ldr      w8, [sp, #12] */
+    0xf90007e0,     /* str      x0, [sp, #8] */
+    0x54000040,     /* b.eq     #8 */
+    0x94000000,     /* bl       #0 */
+    0xf9400bfe,     /* ldr      x30, [sp, #16] */
+    0xd65f03c0,     /* ret */
+};
+
+static const uint32_t corpus_exclusive[] = {
+    0xc85f7c20,     /* ldxr     x0, [x1] */
+    0xc8027c20,     /* stxr     w2, x0, [x1] */
+    0x885ffc20,     /* ldaxr    w0, [x1] */
+    0xc8dffc20,     /* ldar     x0, [x1] */
+    0xc89ffc20,     /* stlr     x0, [x1] */
+};
+
+static const uint32_t corpus_atomic[] = {
+    0xf8250108,     /* ldadd    x5, x8, [x8] */
+    0xf8f800b8,     /* ldaddal  x24, x24, [x5] */
+    0x78b811cb,     /* ldclrah  w24, w11, [x14] */
+    0xf82721b3,     /* ldeor    x7, x19, [x13] */
+    0xf8383056,     /* ldset    x24, x22, [x2] */
+    0xf83f43f3,     /* ldsmax   xzr, x19, [sp] */
+    0xb82a7202,     /* ldumin   w10, w2, [x16] */
+    0xf823009f,     /* stadd    x3, [x4] */
+    0x386503ff,     /* staddlb  w5, [sp] */
+    0xb869605f,     /* stumaxl  w9, [x2] */
+    0xb82380c6,     /* swp      w3, w6, [x6] */
+    0xb8f58070,     /* swpal    w21, w16, [x3] */
+    0xf8bfc367,     /* ldapr    x7, [x27] */
+    0x38bfc332,     /* ldaprb   w18, [x25] */
+};
+
+static const uint32_t corpus_cas[] = {
+    0xc8b57d2a,     /* cas      x21, x10, [x9] */
+    0xc8e1fd76,     /* casal    x1, x22, [x11] */
+    0x08a17d11,     /* casb     w1, w17, [x8] */
+    0x082c7d20,     /* casp     w12, w13, w0, w1, [x9] */
+    0x086eff80,     /* caspal   w14, w15, w0, w1, [x28] */
+};
+
+static const uint32_t corpus_rcpc[] = {
+    0x99497271,     /* ldapur   w17, [x19, #151] */
+    0x99824278,     /* ldapursw x24, [x19, #36] */
+    0x591ad346,     /* stlurh   w6, [x26, #-83] */
+};
+
+static const uint32_t corpus_mops[] = {
+    0x191c0755,     /* cpyfp    [x21]!, [x28]!, x26! */
+    0x19420619,     /* cpyfm    [x25]!, [x2]!, x16! */
+    0x1d8206f0,     /* cpye     [x16]!, [x2]!, x23! */
+    0x19de06f4,     /* setp     [x20]!, x23!, x30 */
+    0x1dc746f9,     /* setgm    [x25]!, x23!, x7 */
+    0x19d086e6,     /* sete     [x6]!, x23!, x16 */
+};
+
+#define BENCH_CORPUS(_name, _words)     { _name, _words, sizeof (_words) / sizeof (*_words) }
+
+static const bench_corpus_t corpora[] = {
+    BENCH_CORPUS ("common",             corpus_common),
+    BENCH_CORPUS ("exclusive",          corpus_exclusive),
+    BENCH_CORPUS ("atomic",             corpus_atomic),
+    BENCH_CORPUS ("compare-and-swap",   corpus_cas),
+    BENCH_CORPUS ("rcpc-unscaled",      corpus_rcpc),
+    BENCH_CORPUS ("memory-copy-set",    corpus_mops),
+};
+
+static double
+bench_now (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+/* Returns the number of words in the corpus that failed to decode */
+static int
+bench_check (libarch_ctx_t *ctx, const bench_corpus_t *corpus)
+{
+    char buf[LIBARCH_FORMAT_MAX_LEN];
+    int unknown = 0;
+
+    for (uint32_t i = 0; i < corpus->len; i++) {
+        instruction_t *in = libarch_instruction_create_ctx (ctx, corpus->words[i], 0);
+
+        libarch_disass_ctx (ctx, &in);
+        if (in->type == ARM64_INSTRUCTION_UNK) {
+            libarch_format_instruction (ctx, in, buf, sizeof (buf));
+            printf (RED "    %s: 0x%08x did not decode (%s)\n" RESET, corpus->name, corpus->words[i], buf);
+            unknown++;
+        }
+        libarch_instruction_free (in);
+    }
+    return unknown;
+}
+
+static double
+bench_run (libarch_ctx_t *ctx, const bench_corpus_t *corpus, long iterations, int format)
+{
+    char buf[LIBARCH_FORMAT_MAX_LEN];
+    double start = bench_now ();
+
+    for (long n = 0; n < iterations; n++) {
+        for (uint32_t i = 0; i < corpus->len; i++) {
+            instruction_t *in = libarch_instruction_create_ctx (ctx, corpus->words[i], i * 4);
+
+            libarch_disass_ctx (ctx, &in);
+            if (format) libarch_format_instruction (ctx, in, buf, sizeof (buf));
+            libarch_instruction_free (in);
+        }
+    }
+    return (bench_now () - start) / ((double) iterations * corpus->len);
+}
+
+/* Load and benchmark a corpus file, returning 0 if it couldn't be loaded */
+static int
+bench_file (libarch_ctx_t *ctx, const char *path, long iterations)
+{
+    libarch_corpus_t corpus;
+    double start = bench_now ();
+
+    if (!libarch_corpus_load (&corpus, path)) {
+        printf (RED "    %s: could not load\n" RESET, path);
+        return 0;
+    }
+    double load = bench_now () - start;
+
+    if (corpus.len) {
+        bench_corpus_t file = { path, corpus.opcodes, (uint32_t) corpus.len };
+        long n = iterations * 16 / (long) corpus.len;
+        if (n < 1) n = 1;
+
+        double decode = bench_run (ctx, &file, n, 0);
+        double format = bench_run (ctx, &file, n, 1);
+
+        printf ("    %-20s %8u %14.1f %14.1f %14.1f\n", path, file.len, decode, format, load / corpus.len);
+    }
+
+    libarch_corpus_free (&corpus);
+    return 1;
+}
+
+int main (int argc, char *argv[])
+{
+    long iterations = (argc > 1) ? strtol (argv[1], NULL, 10) : 100000;
+    libarch_ctx_t ctx;
+    int unknown = 0;
+
+    if (iterations <= 0) {
+        printf ("usage: %s [iterations] [corpus.arm64 ...]\n", argv[0]);
+        return 1;
+    }
+
+    printf (BLUE "\n    LIBARCH Version %s: %s; root:%s/%s_%s %s\n\n" RESET,
+        LIBARCH_BUILD_VERSION, __TIMESTAMP__, LIBARCH_SOURCE_VERSION, LIBARCH_BUILD_TYPE, BUILD_ARCH_CAP, BUILD_ARCH);
+
+    libarch_ctx_init (&ctx);
+
+    /* Every word in the corpus is expected to decode */
+    for (int i = 0; i < sizeof (corpora) / sizeof (*corpora); i++)
+        unknown += bench_check (&ctx, &corpora[i]);
+
+    printf ("    %-20s %8s %14s %14s\n", "corpus", "words", "decode ns/op", "format ns/op");
+    for (int i = 0; i < sizeof (corpora) / sizeof (*corpora); i++) {
+        double decode = bench_run (&ctx, &corpora[i], iterations, 0);
+        double format = bench_run (&ctx, &corpora[i], iterations, 1);
+
+        printf ("    %-20s %8u %14.1f %14.1f\n", corpora[i].name, corpora[i].len, decode, format);
+    }
+
+    if (argc > 2)
+        printf ("\n    %-20s %8s %14s %14s %14s\n", "file", "words", "decode ns/op", "format ns/op", "load ns/line");
+    for (int i = 2; i < argc; i++)
+        if (!bench_file (&ctx, argv[i], iterations)) unknown++;
+
+    libarch_ctx_cleanup (&ctx);
+    return (unknown) ? 1 : 0;
+}
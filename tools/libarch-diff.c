@@ -0,0 +1,938 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#define BLUE            "\x1b[38;5;32m"
+#define RED             "\x1b[38;5;88m"
+#define GREEN           "\x1b[38;5;28m"
+#define RESET           "\x1b[0m"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include <libarch.h>
+#include <libarch-version.h>
+
+#include "arm64/arm64-common.h"
+#include "arm64/arm64-instructions.h"
+
+#include <instruction.h>
+#include <format.h>
+#include <function.h>
+
+/**
+ *  Binary diff between two raw images, e.g. the __TEXT_EXEC of two kernelcache
+ *  builds. Functions are found in both images, hashed with the address
+ *  independent function hash, and paired first by unique hash and then by
+ *  their position in the call graph around functions already paired. Only the
+ *  pairs whose code changed are printed, with an instruction-level diff.
+ *
+ *  Discovery, hashing and the diffs run as tasks on a small work-stealing
+ *  pool. Each worker owns a queue and takes from the back of it, and when it
+ *  runs dry it steals from the front of another worker's queue, so one image
+ *  with a few very large functions doesn't leave the other workers idle.
+ */
+
+/* Words scanned by each discovery task */
+#define DIFF_CHUNK_WORDS        0x10000
+
+/* Lines of unchanged context printed around each change */
+#define DIFF_CONTEXT            2
+
+/* Largest middle section, in cells, that is diffed with a full LCS table */
+#define DIFF_LCS_MAX            (4 * 1024 * 1024)
+
+#define OPCODE_PACIBSP          0xd503237f
+#define OPCODE_BTI_C            0xd503245f
+
+
+/******************************************************************************
+*       Work-stealing Pool
+*******************************************************************************/
+
+struct diff_pool;
+struct diff_worker;
+
+typedef void (*diff_task_func_t) (struct diff_worker *w, void *arg, size_t idx);
+
+typedef struct diff_task
+{
+    diff_task_func_t    func;
+    void               *arg;
+    size_t              idx;
+} diff_task_t;
+
+typedef struct diff_queue
+{
+    pthread_mutex_t     lock;
+    diff_task_t        *tasks;
+    size_t              head;
+    size_t              tail;
+    size_t              cap;
+} diff_queue_t;
+
+typedef struct diff_worker
+{
+    struct diff_pool   *pool;
+    pthread_t           thread;
+    unsigned            id;
+    uint64_t            steals;
+    libarch_ctx_t       ctx;
+} diff_worker_t;
+
+typedef struct diff_pool
+{
+    diff_queue_t       *queues;
+    diff_worker_t      *workers;
+    unsigned            nthreads;
+    unsigned            next;
+
+    atomic_size_t       queued;         // Tasks waiting in a queue
+    atomic_size_t       pending;        // Tasks submitted and not finished
+
+    pthread_mutex_t     lock;
+    pthread_cond_t      work;
+    pthread_cond_t      done;
+    int                 stop;
+} diff_pool_t;
+
+static int
+queue_push (diff_queue_t *q, diff_task_t task)
+{
+    pthread_mutex_lock (&q->lock);
+    if (q->tail == q->cap) {
+        /* Compact before growing, the front may have been stolen */
+        memmove (q->tasks, q->tasks + q->head, (q->tail - q->head) * sizeof (diff_task_t));
+        q->tail -= q->head;
+        q->head = 0;
+        if (q->tail == q->cap) {
+            size_t cap = (q->cap) ? q->cap * 2 : 256;
+            diff_task_t *tasks = realloc (q->tasks, cap * sizeof (diff_task_t));
+            if (!tasks) {
+                pthread_mutex_unlock (&q->lock);
+                return 0;
+            }
+            q->tasks = tasks;
+            q->cap = cap;
+        }
+    }
+    q->tasks[q->tail++] = task;
+    pthread_mutex_unlock (&q->lock);
+    return 1;
+}
+
+/* The owner takes from the back, thieves take from the front */
+static int
+queue_take (diff_queue_t *q, diff_task_t *task, int steal)
+{
+    int found = 0;
+
+    pthread_mutex_lock (&q->lock);
+    if (q->head < q->tail) {
+        *task = (steal) ? q->tasks[q->head++] : q->tasks[--q->tail];
+        found = 1;
+    }
+    pthread_mutex_unlock (&q->lock);
+    return found;
+}
+
+static void *
+pool_worker (void *arg)
+{
+    diff_worker_t *w = (diff_worker_t *) arg;
+    diff_pool_t *pool = w->pool;
+    diff_task_t task;
+
+    for (;;) {
+        int found = queue_take (&pool->queues[w->id], &task, 0);
+
+        for (unsigned i = 1; !found && i < pool->nthreads; i++) {
+            if ((found = queue_take (&pool->queues[(w->id + i) % pool->nthreads], &task, 1)))
+                w->steals++;
+        }
+
+        if (found) {
+            atomic_fetch_sub (&pool->queued, 1);
+            task.func (w, task.arg, task.idx);
+
+            if (atomic_fetch_sub (&pool->pending, 1) == 1) {
+                pthread_mutex_lock (&pool->lock);
+                pthread_cond_broadcast (&pool->done);
+                pthread_mutex_unlock (&pool->lock);
+            }
+            continue;
+        }
+
+        pthread_mutex_lock (&pool->lock);
+        while (!pool->stop && atomic_load (&pool->queued) == 0)
+            pthread_cond_wait (&pool->work, &pool->lock);
+        if (pool->stop) {
+            pthread_mutex_unlock (&pool->lock);
+            break;
+        }
+        pthread_mutex_unlock (&pool->lock);
+    }
+    return NULL;
+}
+
+static int
+pool_create (diff_pool_t *pool, unsigned nthreads)
+{
+    memset (pool, 0, sizeof (diff_pool_t));
+    pool->nthreads = nthreads;
+    pool->queues = calloc (nthreads, sizeof (diff_queue_t));
+    pool->workers = calloc (nthreads, sizeof (diff_worker_t));
+    if (!pool->queues || !pool->workers) return 0;
+
+    atomic_init (&pool->queued, 0);
+    atomic_init (&pool->pending, 0);
+    pthread_mutex_init (&pool->lock, NULL);
+    pthread_cond_init (&pool->work, NULL);
+    pthread_cond_init (&pool->done, NULL);
+
+    /* Workers steal from every queue, so all the queue locks are set up before any thread starts */
+    for (unsigned i = 0; i < nthreads; i++) {
+        pthread_mutex_init (&pool->queues[i].lock, NULL);
+        pool->workers[i].pool = pool;
+        pool->workers[i].id = i;
+        libarch_ctx_init (&pool->workers[i].ctx);
+    }
+
+    for (unsigned i = 0; i < nthreads; i++) {
+        if (pthread_create (&pool->workers[i].thread, NULL, pool_worker, &pool->workers[i]))
+            return 0;
+    }
+    return 1;
+}
+
+/* Queue a task. Workers aren't woken until pool_wait */
+static void
+pool_submit (diff_pool_t *pool, diff_task_func_t func, void *arg, size_t idx)
+{
+    diff_task_t task = { func, arg, idx };
+
+    atomic_fetch_add (&pool->pending, 1);
+    atomic_fetch_add (&pool->queued, 1);
+    if (!queue_push (&pool->queues[pool->next++ % pool->nthreads], task)) {
+        printf (RED "error: " RESET "out of memory\n");
+        exit (1);
+    }
+}
+
+/* Wake the workers and wait for every submitted task to finish */
+static void
+pool_wait (diff_pool_t *pool)
+{
+    pthread_mutex_lock (&pool->lock);
+    pthread_cond_broadcast (&pool->work);
+    while (atomic_load (&pool->pending))
+        pthread_cond_wait (&pool->done, &pool->lock);
+    pthread_mutex_unlock (&pool->lock);
+}
+
+static void
+pool_destroy (diff_pool_t *pool)
+{
+    pthread_mutex_lock (&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast (&pool->work);
+    pthread_mutex_unlock (&pool->lock);
+
+    for (unsigned i = 0; i < pool->nthreads; i++) {
+        pthread_join (pool->workers[i].thread, NULL);
+        libarch_ctx_cleanup (&pool->workers[i].ctx);
+        free (pool->queues[i].tasks);
+    }
+    free (pool->queues);
+    free (pool->workers);
+}
+
+
+/******************************************************************************
+*       Images and Functions
+*******************************************************************************/
+
+typedef struct diff_func
+{
+    libarch_function_t          range;
+    long                       *callees;        // Functions called, in call order, or -1
+    uint32_t                    ncalls;
+    long                        match;          // Index in the other image, or -1
+    int                         changed;
+    char                       *diff;           // Instruction diff, if changed
+} diff_func_t;
+
+typedef struct diff_image
+{
+    const char                 *path;
+    const uint32_t             *code;
+    size_t                      len;            // Words
+    size_t                      size;           // Bytes mapped
+    uint64_t                    base;
+
+    /* Function starts from each discovery task */
+    uint64_t                  **chunk_starts;
+    size_t                     *chunk_len;
+    size_t                      nchunks;
+
+    diff_func_t                *funcs;
+    libarch_function_hash_t    *hashes;
+    size_t                      nfuncs;
+
+    /* Callers of each function, callers[caller_start[i]] onwards */
+    long                       *callers;
+    size_t                     *caller_start;
+} diff_image_t;
+
+static int
+image_load (diff_image_t *img, const char *path, uint64_t base)
+{
+    struct stat st;
+    int fd;
+
+    memset (img, 0, sizeof (diff_image_t));
+    img->path = path;
+    img->base = base;
+
+    if ((fd = open (path, O_RDONLY)) < 0 || fstat (fd, &st) < 0) {
+        printf (RED "error: " RESET "could not open %s\n", path);
+        return 0;
+    }
+    img->size = st.st_size;
+    img->len = st.st_size / sizeof (uint32_t);
+
+    if (img->len) {
+        img->code = mmap (NULL, img->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (img->code == MAP_FAILED) {
+            printf (RED "error: " RESET "could not map %s\n", path);
+            close (fd);
+            return 0;
+        }
+    }
+    close (fd);
+
+    img->nchunks = (img->len + DIFF_CHUNK_WORDS - 1) / DIFF_CHUNK_WORDS;
+    img->chunk_starts = calloc (img->nchunks + 1, sizeof (uint64_t *));
+    img->chunk_len = calloc (img->nchunks + 1, sizeof (size_t));
+    return img->chunk_starts && img->chunk_len;
+}
+
+static void
+image_free (diff_image_t *img)
+{
+    for (size_t i = 0; i < img->nchunks; i++) free (img->chunk_starts[i]);
+    for (size_t i = 0; i < img->nfuncs; i++) {
+        free (img->funcs[i].callees);
+        free (img->funcs[i].diff);
+    }
+    free (img->chunk_starts);
+    free (img->chunk_len);
+    free (img->funcs);
+    free (img->hashes);
+    free (img->callers);
+    free (img->caller_start);
+    if (img->len) munmap ((void *) img->code, img->size);
+}
+
+static int
+_is_bl (uint32_t op)
+{
+    return (op & 0xfc000000) == 0x94000000;
+}
+
+static uint64_t
+_bl_target (uint64_t addr, uint32_t op)
+{
+    return addr + (int64_t) (int) arm64_sign_extend (op & 0x3ffffff, 26) * 4;
+}
+
+/* Bits of `op` that are compared between images, everything but a PC-relative offset */
+static uint32_t
+_offset_mask (uint32_t op)
+{
+    if ((op & 0x7c000000) == 0x14000000) return 0xfc000000;     // B, BL
+    if ((op & 0xff000000) == 0x54000000) return 0xff00001f;     // B.cond, BC.cond
+    if ((op & 0x7e000000) == 0x34000000) return 0xff00001f;     // CBZ, CBNZ
+    if ((op & 0x7e000000) == 0x36000000) return 0xfff8001f;     // TBZ, TBNZ
+    if ((op & 0x1f000000) == 0x10000000) return 0x9f00001f;     // ADR, ADRP
+    if ((op & 0x3b000000) == 0x18000000) return 0xff00001f;     // LDR (literal)
+    return 0xffffffff;
+}
+
+/* stp x29, x30, [sp, #-n]! */
+static int
+_is_frame_push (uint32_t op)
+{
+    return (op & 0xffc07fff) == 0xa9807bfd;
+}
+
+/**
+ *  Function starts in one chunk of an image. A start is either the target of
+ *  a BL, or a frame push that isn't preceded by a PACIBSP or BTI, which would
+ *  be the start instead.
+ */
+static void
+task_discover (diff_worker_t *w, void *arg, size_t chunk)
+{
+    diff_image_t *img = (diff_image_t *) arg;
+    size_t start = chunk * DIFF_CHUNK_WORDS;
+    size_t end = (start + DIFF_CHUNK_WORDS < img->len) ? start + DIFF_CHUNK_WORDS : img->len;
+    uint64_t img_end = img->base + img->len * 4;
+    size_t len = 0, cap = 256;
+    uint64_t *starts = malloc (cap * sizeof (uint64_t));
+
+    for (size_t i = start; starts && i < end; i++) {
+        uint32_t op = img->code[i];
+        uint64_t addr = img->base + i * 4, found = 0;
+
+        if (_is_bl (op)) {
+            uint64_t target = _bl_target (addr, op);
+            if (target >= img->base && target < img_end) found = target;
+        } else if (op == OPCODE_PACIBSP || _is_frame_push (op)) {
+            uint32_t prev = (i) ? img->code[i - 1] : 0;
+            if (prev != OPCODE_PACIBSP && prev != OPCODE_BTI_C) found = addr;
+        }
+        if (!found) continue;
+
+        if (len == cap) {
+            uint64_t *grown = realloc (starts, (cap *= 2) * sizeof (uint64_t));
+            if (!grown) break;
+            starts = grown;
+        }
+        starts[len++] = found;
+    }
+
+    img->chunk_starts[chunk] = starts;
+    img->chunk_len[chunk] = (starts) ? len : 0;
+}
+
+static int
+_compare_addr (const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+/* Merge the starts from every chunk into the function list */
+static int
+image_build_functions (diff_image_t *img)
+{
+    size_t total = 1, n = 0;
+    uint64_t *starts;
+
+    for (size_t i = 0; i < img->nchunks; i++) total += img->chunk_len[i];
+    if (!(starts = malloc (total * sizeof (uint64_t)))) return 0;
+
+    starts[n++] = img->base;
+    for (size_t i = 0; i < img->nchunks; i++) {
+        memcpy (starts + n, img->chunk_starts[i], img->chunk_len[i] * sizeof (uint64_t));
+        n += img->chunk_len[i];
+    }
+    qsort (starts, n, sizeof (uint64_t), _compare_addr);
+
+    img->funcs = calloc (n, sizeof (diff_func_t));
+    img->hashes = calloc (n, sizeof (libarch_function_hash_t));
+    if (!img->funcs || !img->hashes) {
+        free (starts);
+        return 0;
+    }
+
+    for (size_t i = 0; i < n && img->len; i++) {
+        if (i && starts[i] == starts[i - 1]) continue;
+
+        size_t first = (starts[i] - img->base) / 4;
+        size_t last = img->len;
+        for (size_t j = i + 1; j < n; j++)
+            if (starts[j] != starts[i]) { last = (starts[j] - img->base) / 4; break; }
+
+        /* Trailing zero words are alignment padding */
+        while (last > first + 1 && img->code[last - 1] == 0) last--;
+
+        diff_func_t *f = &img->funcs[img->nfuncs++];
+        f->range.code = img->code + first;
+        f->range.addr = starts[i];
+        f->range.len = last - first;
+        f->range.image = img->code;
+        f->range.image_addr = img->base;
+        f->range.image_len = img->len;
+        f->match = -1;
+    }
+
+    free (starts);
+    return 1;
+}
+
+/* Index of the function starting at `addr`, or -1 */
+static long
+image_find_function (const diff_image_t *img, uint64_t addr)
+{
+    size_t lo = 0, hi = img->nfuncs;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (img->funcs[mid].range.addr < addr) lo = mid + 1;
+        else hi = mid;
+    }
+    return (lo < img->nfuncs && img->funcs[lo].range.addr == addr) ? (long) lo : -1;
+}
+
+static void
+task_hash (diff_worker_t *w, void *arg, size_t idx)
+{
+    diff_image_t *img = (diff_image_t *) arg;
+    diff_func_t *f = &img->funcs[idx];
+    uint32_t n = 0;
+
+    libarch_function_hash (&w->ctx, &f->range, &img->hashes[idx]);
+
+    for (size_t i = 0; i < f->range.len; i++) n += _is_bl (f->range.code[i]);
+    if (!n || !(f->callees = malloc (n * sizeof (long)))) return;
+
+    for (size_t i = 0; i < f->range.len; i++)
+        if (_is_bl (f->range.code[i])) {
+            uint64_t target = _bl_target (f->range.addr + i * 4, f->range.code[i]);
+            f->callees[f->ncalls++] = image_find_function (img, target);
+        }
+}
+
+/* Invert the call lists, once every function has been hashed */
+static int
+image_build_callers (diff_image_t *img)
+{
+    size_t total = 0;
+
+    img->caller_start = calloc (img->nfuncs + 1, sizeof (size_t));
+    if (!img->caller_start) return 0;
+
+    for (size_t i = 0; i < img->nfuncs; i++)
+        for (uint32_t k = 0; k < img->funcs[i].ncalls; k++)
+            if (img->funcs[i].callees[k] >= 0) {
+                img->caller_start[img->funcs[i].callees[k] + 1]++;
+                total++;
+            }
+    for (size_t i = 0; i < img->nfuncs; i++)
+        img->caller_start[i + 1] += img->caller_start[i];
+
+    size_t *fill = calloc (img->nfuncs + 1, sizeof (size_t));
+    img->callers = malloc ((total + 1) * sizeof (long));
+    if (!fill || !img->callers) {
+        free (fill);
+        return 0;
+    }
+
+    for (size_t i = 0; i < img->nfuncs; i++)
+        for (uint32_t k = 0; k < img->funcs[i].ncalls; k++) {
+            long callee = img->funcs[i].callees[k];
+            if (callee >= 0) img->callers[img->caller_start[callee] + fill[callee]++] = (long) i;
+        }
+
+    free (fill);
+    return 1;
+}
+
+
+/******************************************************************************
+*       Matching
+*******************************************************************************/
+
+/**
+ *  Check whether two functions have the same code. The hash leaves out
+ *  immediates, so paired functions are compared word by word, ignoring the
+ *  offsets of PC-relative instructions and trailing NOP or zero padding,
+ *  which move with the layout.
+ */
+static int
+_same_code (const libarch_function_t *fa, const libarch_function_t *fb)
+{
+    size_t na = fa->len, nb = fb->len;
+
+    /* Alignment padding at the end comes and goes with the layout too */
+    while (na > 1 && (fa->code[na - 1] == 0xd503201f || !fa->code[na - 1])) na--;
+    while (nb > 1 && (fb->code[nb - 1] == 0xd503201f || !fb->code[nb - 1])) nb--;
+    if (na != nb) return 0;
+
+    for (size_t i = 0; i < na; i++) {
+        uint32_t mask = _offset_mask (fa->code[i]);
+        if ((fa->code[i] & mask) != (fb->code[i] & mask)) return 0;
+    }
+    return 1;
+}
+
+static void
+_pair (diff_image_t *a, diff_image_t *b, long ia, long ib, long *worklist, size_t *wl_len)
+{
+    a->funcs[ia].match = ib;
+    b->funcs[ib].match = ia;
+    a->funcs[ia].changed = b->funcs[ib].changed = !_same_code (&a->funcs[ia].range, &b->funcs[ib].range);
+    worklist[(*wl_len)++] = ia;
+}
+
+/* The only unpaired caller of function `idx`, or -1 if there isn't exactly one */
+static long
+_unpaired_caller (const diff_image_t *img, long idx)
+{
+    long found = -1;
+
+    for (size_t i = img->caller_start[idx]; i < img->caller_start[idx + 1]; i++) {
+        long caller = img->callers[i];
+        if (img->funcs[caller].match >= 0 || caller == found) continue;
+        if (found >= 0) return -1;
+        found = caller;
+    }
+    return found;
+}
+
+/**
+ *  Pair functions by unique hash, then walk out from each pair through the
+ *  call graph. If both functions make the same number of calls, the unpaired
+ *  callees at the same position are paired, and if both have exactly one
+ *  unpaired caller, those are paired. The walk continues from each new pair.
+ */
+static size_t
+match_functions (diff_image_t *a, diff_image_t *b)
+{
+    size_t nmax = (a->nfuncs < b->nfuncs) ? a->nfuncs : b->nfuncs;
+    libarch_function_match_t *matches = malloc ((nmax + 1) * sizeof (libarch_function_match_t));
+    long *worklist = malloc ((a->nfuncs + 1) * sizeof (long));
+    size_t n, wl_len = 0, paired = 0;
+
+    if (!matches || !worklist) {
+        free (matches);
+        free (worklist);
+        return 0;
+    }
+
+    n = libarch_function_hash_match (a->hashes, a->nfuncs, b->hashes, b->nfuncs, matches);
+    for (size_t i = 0; i < n; i++)
+        _pair (a, b, matches[i].a, matches[i].b, worklist, &wl_len);
+    paired = n;
+
+    while (wl_len) {
+        long ia = worklist[--wl_len];
+        const diff_func_t *fa = &a->funcs[ia];
+        const diff_func_t *fb = &b->funcs[fa->match];
+
+        long ca = _unpaired_caller (a, ia), cb = _unpaired_caller (b, fa->match);
+        if (ca >= 0 && cb >= 0) {
+            _pair (a, b, ca, cb, worklist, &wl_len);
+            paired++;
+        }
+
+        for (uint32_t k = 0; fa->ncalls == fb->ncalls && k < fa->ncalls; k++) {
+            ca = fa->callees[k];
+            cb = fb->callees[k];
+
+            if (ca < 0 || cb < 0 || a->funcs[ca].match >= 0 || b->funcs[cb].match >= 0)
+                continue;
+            _pair (a, b, ca, cb, worklist, &wl_len);
+            paired++;
+        }
+    }
+
+    free (matches);
+    free (worklist);
+    return paired;
+}
+
+
+/******************************************************************************
+*       Instruction Diff
+*******************************************************************************/
+
+typedef struct diff_line
+{
+    uint64_t        addr;
+    char            text[LIBARCH_FORMAT_MAX_LEN];
+    size_t          key_len;            // Length of `text` that is compared
+} diff_line_t;
+
+static diff_line_t *
+_format_lines (libarch_ctx_t *ctx, const libarch_function_t *f)
+{
+    diff_line_t *lines = malloc ((f->len + 1) * sizeof (diff_line_t));
+    if (!lines) return NULL;
+
+    for (size_t i = 0; i < f->len; i++) {
+        diff_line_t *l = &lines[i];
+        instruction_t *instr = libarch_instruction_create_ctx (ctx, f->code[i], f->addr + i * 4);
+
+        l->addr = f->addr + i * 4;
+        if (!instr) {
+            snprintf (l->text, sizeof (l->text), ".long 0x%08x", f->code[i]);
+            l->key_len = strlen (l->text);
+            continue;
+        }
+
+        libarch_disass_ctx (ctx, &instr);
+        libarch_format_instruction (ctx, instr, l->text, sizeof (l->text));
+        l->key_len = strlen (l->text);
+
+        /* Drop the target, i.e. everything after the last comma, or the
+           mnemonic's operand for a plain branch */
+        if (libarch_instruction_is_pc_relative (instr)) {
+            char *cut = strrchr (l->text, ',');
+            if (!cut) cut = strpbrk (l->text, " \t");
+            if (cut) l->key_len = cut - l->text;
+        }
+        libarch_instruction_free (instr);
+    }
+    return lines;
+}
+
+static int
+_line_equal (const diff_line_t *a, const diff_line_t *b)
+{
+    return a->key_len == b->key_len && !memcmp (a->text, b->text, a->key_len);
+}
+
+/* Edit script operations */
+#define EDIT_KEEP       0
+#define EDIT_DELETE     1
+#define EDIT_INSERT     2
+
+typedef struct diff_edit
+{
+    uint8_t         op;
+    size_t          a;
+    size_t          b;
+} diff_edit_t;
+
+/**
+ *  Build the edit script between two functions. The common prefix and suffix
+ *  are trimmed first, and the middle is diffed with an LCS table if it's small
+ *  enough, or replaced wholesale otherwise.
+ */
+static diff_edit_t *
+_edit_script (const diff_line_t *a, size_t na, const diff_line_t *b, size_t nb, size_t *len)
+{
+    diff_edit_t *edits = malloc ((na + nb + 1) * sizeof (diff_edit_t));
+    size_t pre = 0, suf = 0, n = 0;
+
+    if (!edits) return NULL;
+
+    while (pre < na && pre < nb && _line_equal (&a[pre], &b[pre])) pre++;
+    while (suf < na - pre && suf < nb - pre && _line_equal (&a[na - 1 - suf], &b[nb - 1 - suf])) suf++;
+
+    for (size_t i = 0; i < pre; i++) edits[n++] = (diff_edit_t) { EDIT_KEEP, i, i };
+
+    size_t ma = na - pre - suf, mb = nb - pre - suf;
+    uint16_t *lcs = (ma * mb <= DIFF_LCS_MAX) ? calloc ((ma + 1) * (mb + 1), sizeof (uint16_t)) : NULL;
+
+    if (lcs) {
+        #define LCS(i, j)   lcs[(i) * (mb + 1) + (j)]
+        for (size_t i = ma; i-- > 0;)
+            for (size_t j = mb; j-- > 0;)
+                LCS (i, j) = _line_equal (&a[pre + i], &b[pre + j]) ? LCS (i + 1, j + 1) + 1 :
+                    (LCS (i + 1, j) > LCS (i, j + 1) ? LCS (i + 1, j) : LCS (i, j + 1));
+
+        size_t i = 0, j = 0;
+        while (i < ma || j < mb) {
+            if (i < ma && j < mb && _line_equal (&a[pre + i], &b[pre + j]))
+                edits[n++] = (diff_edit_t) { EDIT_KEEP, pre + i++, pre + j++ };
+            else if (i < ma && (j == mb || LCS (i + 1, j) >= LCS (i, j + 1)))
+                edits[n++] = (diff_edit_t) { EDIT_DELETE, pre + i++, pre + j };
+            else
+                edits[n++] = (diff_edit_t) { EDIT_INSERT, pre + i, pre + j++ };
+        }
+        #undef LCS
+        free (lcs);
+    } else {
+        for (size_t i = 0; i < ma; i++) edits[n++] = (diff_edit_t) { EDIT_DELETE, pre + i, pre };
+        for (size_t j = 0; j < mb; j++) edits[n++] = (diff_edit_t) { EDIT_INSERT, pre + ma, pre + j };
+    }
+
+    for (size_t i = 0; i < suf; i++)
+        edits[n++] = (diff_edit_t) { EDIT_KEEP, na - suf + i, nb - suf + i };
+
+    *len = n;
+    return edits;
+}
+
+typedef struct diff_job
+{
+    diff_image_t       *a;
+    diff_image_t       *b;
+    int                 color;
+} diff_job_t;
+
+static void
+task_diff (diff_worker_t *w, void *arg, size_t idx)
+{
+    diff_job_t *job = (diff_job_t *) arg;
+    diff_func_t *fa = &job->a->funcs[idx];
+    diff_func_t *fb = &job->b->funcs[fa->match];
+    diff_line_t *la = _format_lines (&w->ctx, &fa->range);
+    diff_line_t *lb = _format_lines (&w->ctx, &fb->range);
+    diff_edit_t *edits = NULL;
+    size_t nedits = 0, size = 0;
+    FILE *out;
+
+    if (la && lb) edits = _edit_script (la, fa->range.len, lb, fb->range.len, &nedits);
+    if (!edits || !(out = open_memstream (&fa->diff, &size))) goto done;
+
+    fprintf (out, "%s@@ 0x%016llx (%zu) -> 0x%016llx (%zu) @@%s\n", (job->color) ? BLUE : "",
+        (unsigned long long) fa->range.addr, fa->range.len,
+        (unsigned long long) fb->range.addr, fb->range.len, (job->color) ? RESET : "");
+
+    /* Print each change with a few lines of context, and elide the rest */
+    for (size_t i = 0, last = 0; i < nedits; i++) {
+        int near = 0;
+        for (size_t j = (i > DIFF_CONTEXT) ? i - DIFF_CONTEXT : 0; j < nedits && j <= i + DIFF_CONTEXT; j++)
+            if (edits[j].op != EDIT_KEEP) near = 1;
+        if (!near) continue;
+
+        if (last && i > last + 1) fprintf (out, "    ...\n");
+        last = i;
+
+        const diff_edit_t *e = &edits[i];
+        if (e->op == EDIT_KEEP)
+            fprintf (out, "    0x%016llx  %s\n", (unsigned long long) la[e->a].addr, la[e->a].text);
+        else if (e->op == EDIT_DELETE)
+            fprintf (out, "%s-   0x%016llx  %s%s\n", (job->color) ? RED : "",
+                (unsigned long long) la[e->a].addr, la[e->a].text, (job->color) ? RESET : "");
+        else
+            fprintf (out, "%s+   0x%016llx  %s%s\n", (job->color) ? GREEN : "",
+                (unsigned long long) lb[e->b].addr, lb[e->b].text, (job->color) ? RESET : "");
+    }
+    fclose (out);
+
+done:
+    free (edits);
+    free (la);
+    free (lb);
+}
+
+
+/******************************************************************************
+*       Main
+*******************************************************************************/
+
+static double
+diff_now (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+static void
+usage (const char *name)
+{
+    printf ("usage: %s [-j threads] [-a base] [-b base] [-s] [-c] <image a> <image b>\n\n", name);
+    printf ("    -j threads    worker threads, default is one per CPU\n");
+    printf ("    -a base       load address of image a, default 0\n");
+    printf ("    -b base       load address of image b, default 0\n");
+    printf ("    -s            summary only, don't print instruction diffs\n");
+    printf ("    -c            colour output\n");
+}
+
+int main (int argc, char *argv[])
+{
+    uint64_t base_a = 0, base_b = 0;
+    unsigned nthreads = 0;
+    int summary = 0, color = 0, opt;
+    diff_image_t a, b;
+    diff_pool_t pool;
+    double t0, t1, t2, t3;
+
+    while ((opt = getopt (argc, argv, "j:a:b:sch")) != -1) {
+        switch (opt) {
+            case 'j': nthreads = (unsigned) strtoul (optarg, NULL, 0); break;
+            case 'a': base_a = strtoull (optarg, NULL, 0); break;
+            case 'b': base_b = strtoull (optarg, NULL, 0); break;
+            case 's': summary = 1; break;
+            case 'c': color = 1; break;
+            default: usage (argv[0]); return 1;
+        }
+    }
+    if (argc - optind != 2) {
+        usage (argv[0]);
+        return 1;
+    }
+
+    if (!nthreads) {
+        long cpus = sysconf (_SC_NPROCESSORS_ONLN);
+        nthreads = (cpus > 0) ? (unsigned) cpus : 1;
+    }
+
+    if (!image_load (&a, argv[optind], base_a) || !image_load (&b, argv[optind + 1], base_b))
+        return 1;
+    if (!pool_create (&pool, nthreads)) {
+        printf (RED "error: " RESET "could not start %u threads\n", nthreads);
+        return 1;
+    }
+
+    /* Function discovery in both images */
+    t0 = diff_now ();
+    for (size_t i = 0; i < a.nchunks; i++) pool_submit (&pool, task_discover, &a, i);
+    for (size_t i = 0; i < b.nchunks; i++) pool_submit (&pool, task_discover, &b, i);
+    pool_wait (&pool);
+
+    if (!image_build_functions (&a) || !image_build_functions (&b)) {
+        printf (RED "error: " RESET "out of memory\n");
+        return 1;
+    }
+
+    /* Hash every function, interleaving the two images */
+    t1 = diff_now ();
+    for (size_t i = 0; i < a.nfuncs || i < b.nfuncs; i++) {
+        if (i < a.nfuncs) pool_submit (&pool, task_hash, &a, i);
+        if (i < b.nfuncs) pool_submit (&pool, task_hash, &b, i);
+    }
+    pool_wait (&pool);
+
+    if (!image_build_callers (&a) || !image_build_callers (&b)) {
+        printf (RED "error: " RESET "out of memory\n");
+        return 1;
+    }
+
+    t2 = diff_now ();
+    size_t paired = match_functions (&a, &b);
+    size_t changed = 0;
+    diff_job_t job = { &a, &b, color };
+
+    for (size_t i = 0; i < a.nfuncs; i++) {
+        if (a.funcs[i].match < 0 || !a.funcs[i].changed) continue;
+        changed++;
+        if (!summary) pool_submit (&pool, task_diff, &job, i);
+    }
+    pool_wait (&pool);
+    t3 = diff_now ();
+
+    for (size_t i = 0; !summary && i < a.nfuncs; i++)
+        if (a.funcs[i].diff) printf ("%s\n", a.funcs[i].diff);
+
+    uint64_t steals = 0;
+    for (unsigned i = 0; i < nthreads; i++) steals += pool.workers[i].steals;
+
+    printf ("%s: %zu functions\n", a.path, a.nfuncs);
+    printf ("%s: %zu functions\n", b.path, b.nfuncs);
+    printf ("    paired:    %zu (%zu changed)\n", paired, changed);
+    printf ("    removed:   %zu\n", a.nfuncs - paired);
+    printf ("    added:     %zu\n", b.nfuncs - paired);
+    printf ("    time:      discover %.3fs, hash %.3fs, match and diff %.3fs, %u threads, %llu steals\n",
+        t1 - t0, t2 - t1, t3 - t2, nthreads, (unsigned long long) steals);
+
+    pool_destroy (&pool);
+    image_free (&a);
+    image_free (&b);
+    return 0;
+}
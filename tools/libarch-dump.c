@@ -0,0 +1,935 @@
+//===----------------------------------------------------------------------===//
+//
+//                         === The LIBARCH Project ===
+//
+//  This  document  is the property of "Is This On?" It is considered to be
+//  confidential and proprietary and may not be, in any form, reproduced or
+//  transmitted, in whole or in part, without express permission of Is This
+//  On?.
+//
+//  Copyright (C) 2023, Harry Moulton - Is This On? Holdings Ltd
+//
+//  Harry Moulton <me@h3adsh0tzz.com>
+//
+//===----------------------------------------------------------------------===//
+
+#define BLUE            "\x1b[38;5;32m"
+#define RED             "\x1b[38;5;88m"
+#define RESET           "\x1b[0m"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include <libarch.h>
+#include <libarch-version.h>
+
+#include <instruction.h>
+#include <format.h>
+#include <byteorder.h>
+#include <symbol.h>
+#include <datamap.h>
+#include <buffer.h>
+
+/**
+ *  Disassemble a raw image to text, e.g. the __TEXT_EXEC of a kernelcache.
+ *
+ *  The image is split into batches that flow through a pipeline:
+ *
+ *      reader -> decode workers -> format workers -> writer
+ *
+ *  The reader maps the file, or reads ahead from a pipe, and hands out batches
+ *  in order. Decode and format each run on their own set of threads, and the
+ *  writer puts the batches back in order and writes them out. The stages are
+ *  connected by bounded lock-free rings, and a fixed set of batches is
+ *  recycled from the writer back to the reader, so a slow disk or a slow
+ *  stage holds the reader back instead of buffering the whole image.
+ *
+ *  -s runs the same work on a single thread, for comparison.
+ *
+ *  -S loads symbols from `nm` output, "<hex address> [type] <name>" per line,
+ *  to name branch and literal targets. Lines without an address are skipped.
+ *
+ *  -d first finds the literal pools, jump tables and padding in the image, and
+ *  writes them as .word and .quad directives instead of decoding them. It
+ *  needs the whole image up front, so the image can't be a pipe.
+ *
+ *  -c decodes each run of identical words once, and writes it as a single
+ *  line, e.g. "... 4096 x nop". A batch of a mapped image is grown to the end
+ *  of the run it finishes in, so a run is only split by the end of the image.
+ */
+
+/* Default number of words in each batch */
+#define DUMP_BATCH_WORDS        4096
+
+/* Batches per worker in flight at once */
+#define DUMP_BATCHES_PER_WORKER 4
+
+/* Longest line: address, opcode, instruction and newline */
+#define DUMP_LINE_MAX           (16 + 2 + 8 + 2 + LIBARCH_FORMAT_MAX_LEN + 1)
+
+
+/******************************************************************************
+*       Lock-free Ring
+*******************************************************************************/
+
+/**
+ *  Bounded multi-producer, multi-consumer ring of pointers. Each slot has a
+ *  sequence number that says whether it's ready to be written or read for the
+ *  current lap, so producers and consumers only contend on their own index.
+ */
+typedef struct dump_slot
+{
+    atomic_size_t       seq;
+    void               *data;
+} dump_slot_t;
+
+typedef struct dump_ring
+{
+    dump_slot_t        *slots;
+    size_t              mask;
+
+    _Alignas (64) atomic_size_t     head;       // Next slot to write
+    _Alignas (64) atomic_size_t     tail;       // Next slot to read
+    _Alignas (64) atomic_size_t     stalls;     // Times a push found it full
+    atomic_size_t                   waits;      // Times a pop found it empty
+} dump_ring_t;
+
+static int
+ring_init (dump_ring_t *ring, size_t min)
+{
+    size_t cap = 1;
+    while (cap < min) cap <<= 1;
+
+    if (!(ring->slots = malloc (cap * sizeof (dump_slot_t))))
+        return 0;
+    for (size_t i = 0; i < cap; i++)
+        atomic_init (&ring->slots[i].seq, i);
+
+    ring->mask = cap - 1;
+    atomic_init (&ring->head, 0);
+    atomic_init (&ring->tail, 0);
+    atomic_init (&ring->stalls, 0);
+    atomic_init (&ring->waits, 0);
+    return 1;
+}
+
+static int
+ring_try_push (dump_ring_t *ring, void *data)
+{
+    size_t pos = atomic_load_explicit (&ring->head, memory_order_relaxed);
+    dump_slot_t *slot;
+
+    for (;;) {
+        slot = &ring->slots[pos & ring->mask];
+        size_t seq = atomic_load_explicit (&slot->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t) seq - (intptr_t) pos;
+
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit (&ring->head, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (dif < 0) {
+            return 0;
+        } else {
+            pos = atomic_load_explicit (&ring->head, memory_order_relaxed);
+        }
+    }
+
+    slot->data = data;
+    atomic_store_explicit (&slot->seq, pos + 1, memory_order_release);
+    return 1;
+}
+
+static int
+ring_try_pop (dump_ring_t *ring, void **data)
+{
+    size_t pos = atomic_load_explicit (&ring->tail, memory_order_relaxed);
+    dump_slot_t *slot;
+
+    for (;;) {
+        slot = &ring->slots[pos & ring->mask];
+        size_t seq = atomic_load_explicit (&slot->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t) seq - (intptr_t) (pos + 1);
+
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit (&ring->tail, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (dif < 0) {
+            return 0;
+        } else {
+            pos = atomic_load_explicit (&ring->tail, memory_order_relaxed);
+        }
+    }
+
+    *data = slot->data;
+    atomic_store_explicit (&slot->seq, pos + ring->mask + 1, memory_order_release);
+    return 1;
+}
+
+/* Back off while waiting on a ring: spin briefly, then yield, then sleep */
+static void
+_backoff (unsigned *spins)
+{
+    unsigned n = (*spins)++;
+
+    if (n < 64) {
+#if defined(__aarch64__)
+        __asm__ volatile ("yield");
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause ();
+#endif
+    } else if (n < 1024) {
+        sched_yield ();
+    } else {
+        struct timespec ts = { 0, 50000 };
+        nanosleep (&ts, NULL);
+    }
+}
+
+static void
+ring_push (dump_ring_t *ring, void *data)
+{
+    unsigned spins = 0;
+
+    if (ring_try_push (ring, data)) return;
+    atomic_fetch_add_explicit (&ring->stalls, 1, memory_order_relaxed);
+    while (!ring_try_push (ring, data)) _backoff (&spins);
+}
+
+static void *
+ring_pop (dump_ring_t *ring)
+{
+    unsigned spins = 0;
+    void *data;
+
+    if (ring_try_pop (ring, &data)) return data;
+    atomic_fetch_add_explicit (&ring->waits, 1, memory_order_relaxed);
+    while (!ring_try_pop (ring, &data)) _backoff (&spins);
+    return data;
+}
+
+
+/******************************************************************************
+*       Pipeline
+*******************************************************************************/
+
+typedef struct dump_batch
+{
+    size_t              seq;
+    uint64_t            addr;
+    const uint32_t     *words;
+    size_t              count;
+
+    /* Read buffer, when the input isn't mapped or needs swapping */
+    uint32_t           *buf;
+
+    /* Decoded records, in address order, one per instruction or run */
+    instruction_t     **instrs;
+    size_t              instrs_cap;
+
+    char               *text;
+    size_t              text_len;
+    size_t              text_cap;
+} dump_batch_t;
+
+typedef struct dump_input
+{
+    int                 fd;
+    const uint32_t     *map;
+    size_t              map_size;
+    size_t              len;            // Words, when mapped
+    int                 order;          // LIBARCH_BYTE_ORDER_*
+} dump_input_t;
+
+typedef struct dump_pipeline
+{
+    dump_input_t       *input;
+    uint64_t            base;
+    size_t              batch_words;
+    unsigned            workers;
+
+    /* Decode and format options, only read while the workers run */
+    libarch_ctx_t       ctx;
+    const libarch_datamap_t *data;
+
+    dump_batch_t       *batches;
+    size_t              nbatches;
+
+    dump_ring_t         free_ring;
+    dump_ring_t         decode_ring;
+    dump_ring_t         format_ring;
+    dump_ring_t         write_ring;
+
+    atomic_uint         decoders;       // Decode workers still running
+    atomic_uint         formatters;     // Format workers still running
+    int                 read_error;
+} dump_pipeline_t;
+
+static char *
+_hex (char *p, uint64_t v, int digits)
+{
+    static const char hex[] = "0123456789abcdef";
+    for (int i = digits - 1; i >= 0; i--, v >>= 4) p[i] = hex[v & 0xf];
+    return p + digits;
+}
+
+/* Append one line, "<address>  <opcode>  <instruction>\n", to `text` */
+static size_t
+_format_line (char *text, const libarch_ctx_t *ctx, const instruction_t *instr)
+{
+    char *p = text;
+
+    p = _hex (p, instr->addr, 16);
+    *p++ = ' ';
+    *p++ = ' ';
+    p = _hex (p, instr->opcode, 8);
+    *p++ = ' ';
+    *p++ = ' ';
+    size_t len = libarch_format_instruction (ctx, instr, p, LIBARCH_FORMAT_MAX_LEN);
+    p += (len < LIBARCH_FORMAT_MAX_LEN) ? len : LIBARCH_FORMAT_MAX_LEN - 1;
+    *p++ = '\n';
+    return p - text;
+}
+
+/* The data range covering `addr`, moving `*next` past the ranges before it */
+static const libarch_data_range_t *
+_data_at (const libarch_datamap_t *data, const libarch_data_range_t **next, uint64_t addr)
+{
+    const libarch_data_range_t *end;
+
+    if (!data || !*next) return NULL;
+    end = data->ranges + data->len;
+    while (*next < end && addr >= (*next)->addr + (*next)->size) (*next)++;
+    return (*next < end && addr >= (*next)->addr) ? *next : NULL;
+}
+
+/**
+ *  Append one line of data, "<address>  <word>  .word 0x...\n", or a .quad
+ *  for a 64-bit value in `range`, and set `used` to the words it took. A
+ *  64-bit value split across two batches is written as two words.
+ */
+static size_t
+_format_data_line (char *text, const libarch_ctx_t *ctx, const libarch_data_range_t *range,
+                   uint64_t addr, const uint32_t *words, size_t avail, int order, size_t *used)
+{
+    uint64_t value = words[0];
+    unsigned size = 4;
+    size_t run = 1;
+    char *p = text;
+
+    if (range->unit == 8 && !((addr - range->addr) & 7) && avail >= 2) {
+        value = (order == LIBARCH_BYTE_ORDER_BIG) ? (value << 32) | words[1] : ((uint64_t) words[1] << 32) | value;
+        size = 8;
+    }
+
+    p = _hex (p, addr, 16);
+    *p++ = ' ';
+    *p++ = ' ';
+    p = _hex (p, words[0], 8);
+    *p++ = ' ';
+    *p++ = ' ';
+
+    /* Collapse a run of the same word, within the range */
+    if (size == 4 && (ctx->options & LIBARCH_OPT_COLLAPSE_RUNS)) {
+        size_t left = (range->addr + range->size - addr) / 4;
+        if ((run = libarch_run_length (words, (avail < left) ? avail : left)) > 1)
+            p += sprintf (p, "... %zu x ", run);
+    }
+    size_t len = libarch_format_data (ctx, value, size, p, LIBARCH_FORMAT_MAX_LEN);
+    p += (len < LIBARCH_FORMAT_MAX_LEN) ? len : LIBARCH_FORMAT_MAX_LEN - 1;
+    *p++ = '\n';
+
+    *used = (size == 8) ? 2 : run;
+    return p - text;
+}
+
+/**
+ *  Decode a batch into `*instrs`, growing it if needed, and return the number
+ *  of records. Data is skipped, so the records are left for the words between
+ *  the ranges.
+ */
+static size_t
+_decode_batch (libarch_ctx_t *ctx, const libarch_datamap_t *data, const uint32_t *words, size_t count,
+               uint64_t addr, instruction_t ***instrs, size_t *cap)
+{
+    const libarch_data_range_t *next = (data) ? libarch_datamap_find (data, addr) : NULL, *range;
+    size_t n = 0, used;
+
+    /* There's never more than a record per word */
+    if (count > *cap) {
+        instruction_t **grown = realloc (*instrs, count * sizeof (instruction_t *));
+        if (!grown) {
+            printf (RED "error: " RESET "out of memory\n");
+            exit (1);
+        }
+        memset (grown + *cap, 0, (count - *cap) * sizeof (instruction_t *));
+        *instrs = grown;
+        *cap = count;
+    }
+
+    for (size_t i = 0; i < count; i += used) {
+        uint64_t at = addr + i * 4;
+        size_t end = count;
+
+        if ((range = _data_at (data, &next, at))) {
+            used = (range->addr + range->size - at) / 4;
+            if (used > count - i) used = count - i;
+            continue;
+        }
+
+        /* Decode up to the next range */
+        if (next && next < data->ranges + data->len && (next->addr - addr) / 4 < count)
+            end = (next->addr - addr) / 4;
+
+        n += libarch_disass_buffer (ctx, words + i, at, end - i, *instrs + n, *cap - n, &used);
+        if (!used) {
+            printf (RED "error: " RESET "out of memory\n");
+            exit (1);
+        }
+    }
+    return n;
+}
+
+/**
+ *  Format a decoded batch into `*text`, growing it as needed, and return the
+ *  length. The words are walked alongside the records, so each line is
+ *  either data or the next record.
+ */
+static size_t
+_format_batch (const libarch_ctx_t *ctx, const libarch_datamap_t *data, const uint32_t *words, size_t count,
+               uint64_t addr, instruction_t **instrs, int order, char **text, size_t *cap)
+{
+    const libarch_data_range_t *next = (data) ? libarch_datamap_find (data, addr) : NULL, *range;
+    size_t len = 0, k = 0, used;
+
+    for (size_t i = 0; i < count; i += used) {
+        if (*cap - len < DUMP_LINE_MAX) {
+            size_t grown_cap = *cap * 2 + DUMP_LINE_MAX;
+            char *grown = realloc (*text, grown_cap);
+            if (!grown) {
+                printf (RED "error: " RESET "out of memory\n");
+                exit (1);
+            }
+            *text = grown;
+            *cap = grown_cap;
+        }
+
+        if ((range = _data_at (data, &next, addr + i * 4))) {
+            len += _format_data_line (*text + len, ctx, range, addr + i * 4, words + i, count - i, order, &used);
+            continue;
+        }
+
+        len += _format_line (*text + len, ctx, instrs[k]);
+        used = instrs[k++]->run;
+    }
+    return len;
+}
+
+/* Grow a mapped batch to the end of the run it finishes in, when collapsing runs */
+static size_t
+_extend_batch (const dump_input_t *in, const libarch_ctx_t *ctx, size_t pos, size_t count)
+{
+    /* Swapped batches are read into a buffer of the batch size */
+    if (!(ctx->options & LIBARCH_OPT_COLLAPSE_RUNS) || !in->map || in->order != LIBARCH_BYTE_ORDER_HOST ||
+        pos + count >= in->len)
+        return count;
+
+    size_t last = pos + count - 1;
+    return count + libarch_run_length (in->map + last, in->len - last) - 1;
+}
+
+static int
+_write_all (int fd, const char *buf, size_t len)
+{
+    while (len) {
+        ssize_t n = write (fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 1;
+}
+
+/* Read up to `words` words from a pipe or file, returning the count */
+static size_t
+_read_words (int fd, uint32_t *buf, size_t words, int *error)
+{
+    size_t want = words * sizeof (uint32_t), got = 0;
+
+    while (got < want) {
+        ssize_t n = read (fd, (char *) buf + got, want - got);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) *error = errno;
+        if (n <= 0) break;
+        got += n;
+    }
+    return got / sizeof (uint32_t);
+}
+
+static void *
+stage_read (void *arg)
+{
+    dump_pipeline_t *p = (dump_pipeline_t *) arg;
+    dump_input_t *in = p->input;
+    size_t seq = 0, pos = 0;
+
+    for (;;) {
+        dump_batch_t *b = ring_pop (&p->free_ring);
+
+        if (in->map) {
+            if (pos >= in->len) {
+                ring_push (&p->free_ring, b);
+                break;
+            }
+            b->words = in->map + pos;
+            b->count = (in->len - pos < p->batch_words) ? in->len - pos : p->batch_words;
+            b->count = _extend_batch (in, &p->ctx, pos, b->count);
+
+            /* Ask for the batch after this one to be paged in */
+            size_t next = pos + b->count, ahead = next * sizeof (uint32_t);
+            if (next < in->len) {
+                size_t page = (size_t) sysconf (_SC_PAGESIZE);
+                size_t start = ahead & ~(page - 1);
+                size_t len = p->batch_words * sizeof (uint32_t) + (ahead - start);
+                if (start + len > in->map_size) len = in->map_size - start;
+                madvise ((char *) in->map + start, len, MADV_WILLNEED);
+            }
+        } else {
+            b->words = b->buf;
+            b->count = _read_words (in->fd, b->buf, p->batch_words, &p->read_error);
+            if (!b->count) {
+                ring_push (&p->free_ring, b);
+                break;
+            }
+        }
+
+        b->seq = seq++;
+        b->addr = p->base + pos * 4;
+        pos += b->count;
+        ring_push (&p->decode_ring, b);
+    }
+
+    /* One stop marker for each decode worker */
+    for (unsigned i = 0; i < p->workers; i++) ring_push (&p->decode_ring, NULL);
+    return NULL;
+}
+
+static void *
+stage_decode (void *arg)
+{
+    dump_pipeline_t *p = (dump_pipeline_t *) arg;
+    dump_batch_t *b;
+
+    /**
+     *  Each batch keeps it's records, reset for every pass through the
+     *  pipeline, so decoding stops allocating once the records have grown.
+     *  They move between threads with the batch, so they are created without
+     *  a context: a context's cache can't be shared between threads. The
+     *  pipeline's context is only used for it's options until teardown.
+     */
+    while ((b = ring_pop (&p->decode_ring))) {
+        if (p->input->order != LIBARCH_BYTE_ORDER_HOST) {
+            libarch_load_opcodes (b->buf, b->words, b->count * 4, p->input->order);
+            b->words = b->buf;
+        }
+        _decode_batch (&p->ctx, p->data, b->words, b->count, b->addr, &b->instrs, &b->instrs_cap);
+        ring_push (&p->format_ring, b);
+    }
+
+    /* The last decoder out stops the format workers */
+    if (atomic_fetch_sub (&p->decoders, 1) == 1)
+        for (unsigned i = 0; i < p->workers; i++) ring_push (&p->format_ring, NULL);
+    return NULL;
+}
+
+static void *
+stage_format (void *arg)
+{
+    dump_pipeline_t *p = (dump_pipeline_t *) arg;
+    dump_batch_t *b;
+
+    while ((b = ring_pop (&p->format_ring))) {
+        b->text_len = _format_batch (&p->ctx, p->data, b->words, b->count, b->addr, b->instrs,
+                                     p->input->order, &b->text, &b->text_cap);
+        ring_push (&p->write_ring, b);
+    }
+
+    if (atomic_fetch_sub (&p->formatters, 1) == 1)
+        ring_push (&p->write_ring, NULL);
+    return NULL;
+}
+
+/* Write batches in order as they arrive, returning them to the reader */
+static int
+stage_write (dump_pipeline_t *p, int fd)
+{
+    dump_batch_t **pending = calloc (p->nbatches, sizeof (dump_batch_t *));
+    dump_batch_t *b;
+    size_t next = 0;
+    int ok = (pending != NULL);
+
+    while ((b = ring_pop (&p->write_ring))) {
+        if (!ok) {
+            ring_push (&p->free_ring, b);
+            continue;
+        }
+
+        /* At most `nbatches` are in flight, so their slots can't collide */
+        pending[b->seq % p->nbatches] = b;
+
+        while ((b = pending[next % p->nbatches]) && b->seq == next) {
+            pending[next % p->nbatches] = NULL;
+            if (ok && !_write_all (fd, b->text, b->text_len)) ok = 0;
+            ring_push (&p->free_ring, b);
+            next++;
+        }
+    }
+
+    free (pending);
+    return ok;
+}
+
+static int
+pipeline_run (dump_pipeline_t *p, int fd)
+{
+    size_t ring_size = p->nbatches + p->workers + 1;
+    pthread_t reader, *threads;
+    int ok;
+
+    p->batches = calloc (p->nbatches, sizeof (dump_batch_t));
+    threads = calloc (p->workers * 2, sizeof (pthread_t));
+    if (!p->batches || !threads ||
+        !ring_init (&p->free_ring, ring_size) || !ring_init (&p->decode_ring, ring_size) ||
+        !ring_init (&p->format_ring, ring_size) || !ring_init (&p->write_ring, ring_size))
+        return 0;
+
+    for (size_t i = 0; i < p->nbatches; i++) {
+        dump_batch_t *b = &p->batches[i];
+
+        b->instrs = calloc (p->batch_words, sizeof (instruction_t *));
+        if (!b->instrs) return 0;
+        b->instrs_cap = p->batch_words;
+        if ((!p->input->map || p->input->order != LIBARCH_BYTE_ORDER_HOST) &&
+            !(b->buf = malloc (p->batch_words * sizeof (uint32_t))))
+            return 0;
+        ring_push (&p->free_ring, b);
+    }
+
+    atomic_init (&p->decoders, p->workers);
+    atomic_init (&p->formatters, p->workers);
+
+    pthread_create (&reader, NULL, stage_read, p);
+    for (unsigned i = 0; i < p->workers; i++) {
+        pthread_create (&threads[i], NULL, stage_decode, p);
+        pthread_create (&threads[p->workers + i], NULL, stage_format, p);
+    }
+
+    ok = stage_write (p, fd);
+
+    pthread_join (reader, NULL);
+    for (unsigned i = 0; i < p->workers * 2; i++) pthread_join (threads[i], NULL);
+
+    for (size_t i = 0; i < p->nbatches; i++) {
+        free (p->batches[i].buf);
+        for (size_t j = 0; j < p->batches[i].instrs_cap; j++)
+            libarch_instruction_free (p->batches[i].instrs[j]);
+        free (p->batches[i].instrs);
+        free (p->batches[i].text);
+    }
+    free (p->batches);
+    free (threads);
+    libarch_ctx_cleanup (&p->ctx);
+    free (p->free_ring.slots);
+    free (p->decode_ring.slots);
+    free (p->format_ring.slots);
+    free (p->write_ring.slots);
+    return ok;
+}
+
+/* The whole dump on the calling thread, for comparison with the pipeline */
+static int
+dump_serial (dump_input_t *in, uint64_t base, size_t batch_words, const libarch_ctx_t *opts,
+             const libarch_datamap_t *data, int fd, int *read_error)
+{
+    size_t cap = batch_words * DUMP_LINE_MAX, len = 0, count = 0, instrs_cap = 0;
+    instruction_t **instrs = NULL;
+    uint32_t *buf = NULL;
+    char *text = malloc (cap);
+    libarch_ctx_t ctx;
+    int ok = 1;
+
+    if (!text || ((!in->map || in->order != LIBARCH_BYTE_ORDER_HOST) &&
+                  !(buf = malloc (batch_words * sizeof (uint32_t))))) {
+        free (text);
+        return 0;
+    }
+    ctx = *opts;
+
+    for (size_t pos = 0; ok; pos += count) {
+        const uint32_t *words;
+
+        if (in->map) {
+            words = in->map + pos;
+            count = (in->len - pos < batch_words) ? in->len - pos : batch_words;
+            count = _extend_batch (in, &ctx, pos, count);
+        } else {
+            words = buf;
+            count = _read_words (in->fd, buf, batch_words, read_error);
+        }
+        if (!count) break;
+
+        if (in->order != LIBARCH_BYTE_ORDER_HOST) {
+            libarch_load_opcodes (buf, words, count * 4, in->order);
+            words = buf;
+        }
+
+        _decode_batch (&ctx, data, words, count, base + pos * 4, &instrs, &instrs_cap);
+        len = _format_batch (&ctx, data, words, count, base + pos * 4, instrs, in->order, &text, &cap);
+        ok = _write_all (fd, text, len);
+    }
+
+    for (size_t i = 0; i < instrs_cap; i++) libarch_instruction_free (instrs[i]);
+    free (instrs);
+    libarch_ctx_cleanup (&ctx);
+    free (text);
+    free (buf);
+    return ok;
+}
+
+static int
+input_open (dump_input_t *in, const char *path)
+{
+    struct stat st;
+
+    memset (in, 0, sizeof (dump_input_t));
+    in->fd = (!strcmp (path, "-")) ? STDIN_FILENO : open (path, O_RDONLY);
+
+    if (in->fd < 0 || fstat (in->fd, &st) < 0) {
+        printf (RED "error: " RESET "could not open %s\n", path);
+        return 0;
+    }
+
+    /* Regular files are mapped, anything else is read in batches */
+    if (S_ISREG (st.st_mode) && st.st_size >= (off_t) sizeof (uint32_t)) {
+        in->map_size = st.st_size;
+        in->len = st.st_size / sizeof (uint32_t);
+        in->map = mmap (NULL, in->map_size, PROT_READ, MAP_PRIVATE, in->fd, 0);
+        if (in->map == MAP_FAILED) {
+            printf (RED "error: " RESET "could not map %s\n", path);
+            return 0;
+        }
+        madvise ((void *) in->map, in->map_size, MADV_SEQUENTIAL);
+    }
+    return 1;
+}
+
+/* Load symbols from `nm` output */
+static int
+load_symbols (libarch_symtab_t *symtab, const char *path)
+{
+    FILE *f = fopen (path, "r");
+    char *line = NULL, *p, *end;
+    size_t cap = 0;
+    int ok = 1;
+
+    if (!f) {
+        printf (RED "error: " RESET "could not open %s\n", path);
+        return 0;
+    }
+
+    while (ok && getline (&line, &cap, f) > 0) {
+        uint64_t addr = strtoull (line, &end, 16);
+        if (end == line || (*end != ' ' && *end != '\t')) continue;
+
+        /* The name is the last field */
+        line[strcspn (line, "\r\n")] = '\0';
+        if (!(p = strrchr (end, ' ')) && !(p = strrchr (end, '\t'))) continue;
+        if (*++p == '\0') continue;
+
+        ok = libarch_symtab_add (symtab, addr, 0, p);
+    }
+
+    free (line);
+    fclose (f);
+    if (ok) ok = libarch_symtab_finalise (symtab);
+    if (!ok) printf (RED "error: " RESET "could not load symbols from %s\n", path);
+    return ok;
+}
+
+/* Find the data in a mapped image, swapping a copy of it first if needed */
+static int
+detect_data (libarch_datamap_t *data, const dump_input_t *in, uint64_t base)
+{
+    uint32_t *buf = NULL;
+    const uint32_t *words = in->map;
+    int ok;
+
+    if (in->order != LIBARCH_BYTE_ORDER_HOST) {
+        if (!(buf = malloc (in->len * sizeof (uint32_t)))) {
+            printf (RED "error: " RESET "out of memory\n");
+            return 0;
+        }
+        libarch_load_opcodes (buf, in->map, in->len * 4, in->order);
+        words = buf;
+    }
+
+    ok = libarch_datamap_detect (data, words, base, in->len, NULL);
+    if (!ok) printf (RED "error: " RESET "could not find the data in the image\n");
+    free (buf);
+    return ok;
+}
+
+static double
+dump_now (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+usage (const char *name)
+{
+    printf ("usage: %s [-j threads] [-a base] [-n words] [-o output] [-B] [-c] [-d] [-r] [-s] [-S symbols] [-v] <image>\n\n", name);
+    printf ("    -j threads    decode and format threads each, default is half the CPUs\n");
+    printf ("    -a base       load address of the image, default 0\n");
+    printf ("    -n words      instructions per batch, default %d\n", DUMP_BATCH_WORDS);
+    printf ("    -o output     output file, default stdout\n");
+    printf ("    -B            the image is big-endian\n");
+    printf ("    -c            collapse runs of identical words into one line\n");
+    printf ("    -d            write literal pools, jump tables and padding as data\n");
+    printf ("    -r            print canonical instructions rather than aliases\n");
+    printf ("    -s            disassemble on a single thread\n");
+    printf ("    -S symbols    name targets using symbols from nm output\n");
+    printf ("    -v            print timing and ring stalls to stderr\n");
+    printf ("\n    The image is read from stdin if it's \"-\".\n");
+}
+
+int main (int argc, char *argv[])
+{
+    const char *output = NULL, *symbols = NULL;
+    size_t batch_words = DUMP_BATCH_WORDS;
+    uint64_t base = 0;
+    uint32_t options = LIBARCH_OPT_NONE;
+    unsigned nthreads = 0;
+    int serial = 0, verbose = 0, detect = 0, read_error = 0, order = LIBARCH_BYTE_ORDER_LITTLE, opt, fd, ok;
+    libarch_datamap_t data = { 0 };
+    libarch_symtab_t symtab;
+    libarch_ctx_t ctx;
+    dump_input_t in;
+    double t0;
+
+    while ((opt = getopt (argc, argv, "j:a:n:o:BcdrsS:vh")) != -1) {
+        switch (opt) {
+            case 'j': nthreads = (unsigned) strtoul (optarg, NULL, 0); break;
+            case 'a': base = strtoull (optarg, NULL, 0); break;
+            case 'n': batch_words = strtoull (optarg, NULL, 0); break;
+            case 'o': output = optarg; break;
+            case 'B': order = LIBARCH_BYTE_ORDER_BIG; break;
+            case 'c': options |= LIBARCH_OPT_COLLAPSE_RUNS; break;
+            case 'd': detect = 1; break;
+            case 'r': options |= LIBARCH_OPT_RAW; break;
+            case 's': serial = 1; break;
+            case 'S': symbols = optarg; break;
+            case 'v': verbose = 1; break;
+            default: usage (argv[0]); return 1;
+        }
+    }
+    if (argc - optind != 1 || !batch_words) {
+        usage (argv[0]);
+        return 1;
+    }
+
+    if (!nthreads) {
+        long cpus = sysconf (_SC_NPROCESSORS_ONLN);
+        nthreads = (cpus > 1) ? (unsigned) cpus / 2 : 1;
+    }
+
+    libarch_ctx_init (&ctx);
+    ctx.options = options;
+
+    libarch_symtab_init (&symtab);
+    if (symbols) {
+        if (!load_symbols (&symtab, symbols)) return 1;
+        ctx.symbolizer = libarch_symtab_symbolize;
+        ctx.symbolizer_arg = &symtab;
+    }
+
+    if (!input_open (&in, argv[optind]))
+        return 1;
+    in.order = order;
+
+    if (detect) {
+        if (!in.map) {
+            printf (RED "error: " RESET "-d needs an image file, not a pipe\n");
+            return 1;
+        }
+
+        t0 = dump_now ();
+        if (!detect_data (&data, &in, base)) return 1;
+
+        if (verbose) {
+            size_t bytes = 0;
+            for (size_t i = 0; i < data.len; i++) bytes += data.ranges[i].size;
+            fprintf (stderr, "data: %zu ranges, %zu bytes, %.3fs\n", data.len, bytes, dump_now () - t0);
+        }
+    }
+
+    fd = (output) ? open (output, O_WRONLY | O_CREAT | O_TRUNC, 0644) : STDOUT_FILENO;
+    if (fd < 0) {
+        printf (RED "error: " RESET "could not open %s\n", output);
+        return 1;
+    }
+
+    t0 = dump_now ();
+    if (serial) {
+        ok = dump_serial (&in, base, batch_words, &ctx, (detect) ? &data : NULL, fd, &read_error);
+    } else {
+        dump_pipeline_t p = {
+            .input = &in,
+            .base = base,
+            .batch_words = batch_words,
+            .workers = nthreads,
+            .nbatches = (size_t) nthreads * 2 * DUMP_BATCHES_PER_WORKER,
+            .ctx = ctx,
+            .data = (detect) ? &data : NULL,
+        };
+
+        ok = pipeline_run (&p, fd);
+        read_error = p.read_error;
+
+        /* A push stalls when the next stage is behind, a pop waits when it's ahead */
+        if (verbose)
+            fprintf (stderr, "stalls: decode %zu, format %zu, write %zu; waits: reader %zu, writer %zu\n",
+                atomic_load (&p.decode_ring.stalls), atomic_load (&p.format_ring.stalls),
+                atomic_load (&p.write_ring.stalls), atomic_load (&p.free_ring.waits),
+                atomic_load (&p.write_ring.waits));
+    }
+
+    if (verbose)
+        fprintf (stderr, "time: %.3fs, %s\n", dump_now () - t0,
+            (serial) ? "serial" : "pipelined");
+    if (read_error) fprintf (stderr, RED "error: " RESET "read failed: %s\n", strerror (read_error));
+    if (!ok) fprintf (stderr, RED "error: " RESET "could not write output\n");
+
+    libarch_datamap_free (&data);
+    libarch_symtab_free (&symtab);
+    if (in.map) munmap ((void *) in.map, in.map_size);
+    if (in.fd != STDIN_FILENO) close (in.fd);
+    if (output) close (fd);
+    return (ok && !read_error) ? 0 : 1;
+}